@@ -119,17 +119,17 @@ dump_rrset_lruhash(SSL* ssl, struct lruhash* h, time_t now)
 static int
 dump_rrset_cache(SSL* ssl, struct worker* worker)
 {
-	struct rrset_cache* r = worker->env.rrset_cache;
+	struct slab_array* r = slabhash_array(&worker->env.rrset_cache->table);
 	size_t slab;
 	if(!ssl_printf(ssl, "START_RRSET_CACHE\n")) return 0;
-	for(slab=0; slab<r->table.size; slab++) {
-		lock_quick_lock(&r->table.array[slab]->lock);
-		if(!dump_rrset_lruhash(ssl, r->table.array[slab],
+	for(slab=0; slab<r->size; slab++) {
+		lock_quick_lock(&r->array[slab]->lock);
+		if(!dump_rrset_lruhash(ssl, r->array[slab],
 			*worker->env.now)) {
-			lock_quick_unlock(&r->table.array[slab]->lock);
+			lock_quick_unlock(&r->array[slab]->lock);
 			return 0;
 		}
-		lock_quick_unlock(&r->table.array[slab]->lock);
+		lock_quick_unlock(&r->array[slab]->lock);
 	}
 	return ssl_printf(ssl, "END_RRSET_CACHE\n");
 }
@@ -275,7 +275,7 @@ dump_msg_lruhash(SSL* ssl, struct worker* worker, struct lruhash* h)
 static int
 dump_msg_cache(SSL* ssl, struct worker* worker)
 {
-	struct slabhash* sh = worker->env.msg_cache;
+	struct slab_array* sh = slabhash_array(worker->env.msg_cache);
 	size_t slab;
 	if(!ssl_printf(ssl, "START_MSG_CACHE\n")) return 0;
 	for(slab=0; slab<sh->size; slab++) {
@@ -402,7 +402,7 @@ move_into_cache(struct ub_packed_rrset_key* k,
 		sizeof(time_t))* num;
 	for(i=0; i<num; i++)
 		s += d->rr_len[i];
-	ad = (struct packed_rrset_data*)malloc(s);
+	ad = (struct packed_rrset_data*)alloc_sized_obtain(&worker->alloc, s);
 	if(!ad) {
 		log_warn("error out of memory");
 		ub_packed_rrset_parsedelete(ak, &worker->alloc);
@@ -728,8 +728,8 @@ print_dp_details(SSL* ssl, struct worker* worker, struct delegpt* dp)
 		/* lookup in infra cache */
 		delay=0;
 		entry_ttl = infra_get_host_rto(worker->env.infra_cache,
-			&a->addr, a->addrlen, dp->name, dp->namelen,
-			&ri, &delay, *worker->env.now, &tA, &tAAAA, &tother);
+			&a->addr, a->addrlen, &ri, &delay, *worker->env.now,
+			&tA, &tAAAA, &tother);
 		if(entry_ttl == -2 && ri.rto >= USEFUL_SERVER_TOP_TIMEOUT) {
 			if(!ssl_printf(ssl, "expired, rto %d msec, tA %d "
 				"tAAAA %d tother %d.\n", ri.rto, tA, tAAAA,
@@ -765,8 +765,7 @@ print_dp_details(SSL* ssl, struct worker* worker, struct delegpt* dp)
 			if(!ssl_printf(ssl, ", probedelay %d", delay))
 				return;
 		if(infra_host(worker->env.infra_cache, &a->addr, a->addrlen,
-			dp->name, dp->namelen, *worker->env.now, &edns_vs,
-			&edns_lame_known, &to)) {
+			*worker->env.now, &edns_vs, &edns_lame_known, &to)) {
 			if(edns_vs == -1) {
 				if(!ssl_printf(ssl, ", noEDNS%s.",
 					edns_lame_known?" probed":" assumed"))
@@ -69,12 +69,16 @@
 #include "daemon/daemon.h"
 #include "daemon/worker.h"
 #include "daemon/remote.h"
+#include "daemon/metrics.h"
 #include "daemon/acl_list.h"
+#include "daemon/rrl.h"
+#include "util/querylog.h"
 #include "util/log.h"
 #include "util/config_file.h"
 #include "util/data/msgreply.h"
 #include "util/shm_side/shm_main.h"
 #include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/storage/slabhash.h"
 #include "services/listen_dnsport.h"
 #include "services/cache/rrset.h"
@@ -350,6 +354,19 @@ daemon_open_shared_ports(struct daemon* daemon)
 			return 0;
 		daemon->rc_port = daemon->cfg->control_port;
 	}
+	if(!daemon->cfg->metrics_enable && daemon->metrics_port) {
+		listening_ports_free(daemon->metrics_ports);
+		daemon->metrics_ports = NULL;
+		daemon->metrics_port = 0;
+	}
+	if(daemon->cfg->metrics_enable &&
+		daemon->cfg->metrics_port != daemon->metrics_port) {
+		listening_ports_free(daemon->metrics_ports);
+		if(!(daemon->metrics_ports=daemon_metrics_open_ports(
+			daemon->cfg)))
+			return 0;
+		daemon->metrics_port = daemon->cfg->metrics_port;
+	}
 	return 1;
 }
 
@@ -413,6 +430,7 @@ daemon_create_workers(struct daemon* daemon)
 {
 	int i, numport;
 	int* shufport;
+	uint8_t hashkey[KEYHASH_KEYSIZE];
 	log_assert(daemon && daemon->cfg);
 	if(!daemon->rand) {
 		unsigned int seed = (unsigned int)time(NULL) ^ 
@@ -420,6 +438,11 @@ daemon_create_workers(struct daemon* daemon)
 		daemon->rand = ub_initstate(seed, NULL);
 		if(!daemon->rand)
 			fatal_exit("could not init random generator");
+		/* the cache hash key stays the same between reloads,
+		 * because the caches can be kept */
+		for(i=0; i<KEYHASH_KEYSIZE; i++)
+			hashkey[i] = (uint8_t)ub_random_max(daemon->rand, 256);
+		keyhash_set_key(hashkey);
 	}
 	hash_set_raninit((uint32_t)ub_random(daemon->rand));
 	shufport = (int*)calloc(65536, sizeof(int));
@@ -450,6 +473,9 @@ daemon_create_workers(struct daemon* daemon)
 		fatal_exit("dnstap enabled in config but not built with dnstap support");
 #endif
 	}
+	if((daemon->cfg->log_queries || daemon->cfg->log_replies) &&
+		daemon->cfg->log_async)
+		daemon->qlog = qlog_create(daemon->cfg, daemon->num);
 	for(i=0; i<daemon->num; i++) {
 		if(!(daemon->workers[i] = worker_create(daemon, i,
 			shufport+numport*i/daemon->num, 
@@ -591,6 +617,10 @@ daemon_fork(struct daemon* daemon)
 		fatal_exit("Could not initialize main thread");
 #endif
 	
+	/* the log thread runs until the workers have stopped */
+	if(daemon->qlog)
+		qlog_start(daemon->qlog);
+
 	/* Now create the threads and init the workers.
 	 * By the way, this is thread #0 (the main thread).
 	 */
@@ -646,11 +676,15 @@ daemon_cleanup(struct daemon* daemon)
 	daemon->views = NULL;
 	/* key cache is cleared by module desetup during next daemon_fork() */
 	daemon_remote_clear(daemon->rc);
+	daemon_metrics_delete(daemon->metrics);
+	daemon->metrics = NULL;
 	for(i=0; i<daemon->num; i++)
 		worker_delete(daemon->workers[i]);
 	free(daemon->workers);
 	daemon->workers = NULL;
 	daemon->num = 0;
+	qlog_delete(daemon->qlog);
+	daemon->qlog = NULL;
 #ifdef USE_DNSTAP
 	dt_delete(daemon->dtenv);
 #endif
@@ -669,6 +703,7 @@ daemon_delete(struct daemon* daemon)
 		listening_ports_free(daemon->ports[i]);
 	free(daemon->ports);
 	listening_ports_free(daemon->rc_ports);
+	listening_ports_free(daemon->metrics_ports);
 	if(daemon->env) {
 		slabhash_delete(daemon->env->msg_cache);
 		rrset_cache_delete(daemon->env->rrset_cache);
@@ -679,6 +714,7 @@ daemon_delete(struct daemon* daemon)
 	ub_randfree(daemon->rand);
 	alloc_clear(&daemon->superalloc);
 	acl_list_delete(daemon->acl);
+	rrl_delete(daemon->rrl);
 	free(daemon->chroot);
 	free(daemon->pidfile);
 	free(daemon->env);
@@ -738,17 +774,18 @@ void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 {
         daemon->cfg = cfg;
 	config_apply(cfg);
-	if(!daemon->env->msg_cache ||
-	   cfg->msg_cache_size != slabhash_get_size(daemon->env->msg_cache) ||
-	   cfg->msg_cache_slabs != daemon->env->msg_cache->size) {
-		slabhash_delete(daemon->env->msg_cache);
+	if(!daemon->env->msg_cache) {
 		daemon->env->msg_cache = slabhash_create(cfg->msg_cache_slabs,
 			HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size,
 			msgreply_sizefunc, query_info_compare,
-			query_entry_delete, reply_info_delete, NULL);
+			query_entry_delete, reply_info_delete,
+			&daemon->superalloc);
 		if(!daemon->env->msg_cache) {
 			fatal_exit("malloc failure updating config settings");
 		}
+	} else if(!slabhash_adjust(daemon->env->msg_cache,
+		cfg->msg_cache_slabs, cfg->msg_cache_size)) {
+		fatal_exit("malloc failure updating config settings");
 	}
 	if((daemon->env->rrset_cache = rrset_cache_adjust(
 		daemon->env->rrset_cache, cfg, &daemon->superalloc)) == 0)
@@ -756,4 +793,5 @@ void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 	if((daemon->env->infra_cache = infra_adjust(daemon->env->infra_cache,
 		cfg))==0)
 		fatal_exit("malloc failure updating config settings");
+	daemon->rrl = rrl_adjust(daemon->rrl, cfg);
 }
@@ -56,6 +56,9 @@ struct local_zones;
 struct views;
 struct ub_randstate;
 struct daemon_remote;
+struct daemon_metrics;
+struct rrl_table;
+struct qlog;
 
 #include "dnstap/dnstap_config.h"
 #ifdef USE_DNSTAP
@@ -88,6 +91,12 @@ struct daemon {
 	struct listen_port* rc_ports;
 	/** remote control connections management (for first worker) */
 	struct daemon_remote* rc;
+	/** port number for the metrics endpoint that has ports opened */
+	int metrics_port;
+	/** listening ports for the metrics endpoint */
+	struct listen_port* metrics_ports;
+	/** metrics endpoint (for first worker), NULL if not enabled */
+	struct daemon_metrics* metrics;
 	/** ssl context for listening to dnstcp over ssl, and connecting ssl */
 	void* listen_sslctx, *connect_sslctx;
 	/** num threads allocated */
@@ -106,6 +115,8 @@ struct daemon {
 	struct module_stack mods;
 	/** access control, which client IPs are allowed to connect */
 	struct acl_list* acl;
+	/** response rate limit table, NULL if not enabled */
+	struct rrl_table* rrl;
 	/** local authority zones */
 	struct local_zones* local_zones;
 	/** last time of statistics printout */
@@ -114,6 +125,9 @@ struct daemon {
 	struct timeval time_boot;
 	/** views structure containing view tree */
 	struct views* views;
+	/** asynchronous query log, NULL if queries and replies are logged
+	 * by the workers themselves */
+	struct qlog* qlog;
 #ifdef USE_DNSTAP
 	/** the dnstap environment master value, copied and changed by threads*/
 	struct dt_env* dtenv;
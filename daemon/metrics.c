@@ -0,0 +1,533 @@
+/*
+ * daemon/metrics.c - statistics scrape endpoint for the unbound daemon.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the metrics endpoint of the daemon. The first thread
+ * accepts the HTTP connections, reads the counters of all threads
+ * directly (like the stats_noreset command does) and formats them into
+ * the reply buffer of the connection. The buffers are allocated when the
+ * endpoint is created, and a scrape does not need to allocate memory.
+ */
+#include "config.h"
+#include "daemon/metrics.h"
+#include "daemon/worker.h"
+#include "daemon/daemon.h"
+#include "daemon/stats.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "util/net_help.h"
+#include "util/netevent.h"
+#include "util/module.h"
+#include "util/alloc.h"
+#include "util/timehist.h"
+#include "util/fptr_wlist.h"
+#include "util/storage/slabhash.h"
+#include "services/listen_dnsport.h"
+#include "services/cache/rrset.h"
+#include "services/mesh.h"
+#include "sldns/sbuffer.h"
+#ifdef HAVE_NETDB_H
+#include <netdb.h>
+#endif
+
+/** the content type of the reply */
+#define METRICS_CONTENT_TYPE \
+	"application/openmetrics-text; version=1.0.0; charset=utf-8"
+
+/**
+ * Add and open a new metrics port
+ * @param ip: ip str
+ * @param nr: port nr
+ * @param list: list head
+ * @param noproto_is_err: if lack of protocol support is an error.
+ * @param cfg: config with the socket options.
+ * @return false on failure.
+ */
+static int
+metrics_add_open(const char* ip, int nr, struct listen_port** list,
+	int noproto_is_err, struct config_file* cfg)
+{
+	struct addrinfo hints;
+	struct addrinfo* res;
+	struct listen_port* n;
+	int noproto;
+	int fd, r;
+	char port[15];
+	snprintf(port, sizeof(port), "%d", nr);
+	port[sizeof(port)-1]=0;
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_flags = AI_PASSIVE | AI_NUMERICHOST;
+	if((r = getaddrinfo(ip, port, &hints, &res)) != 0 || !res) {
+		log_err("metrics interface %s:%s getaddrinfo: %s %s",
+			ip?ip:"default", port, gai_strerror(r),
+#ifdef EAI_SYSTEM
+			r==EAI_SYSTEM?(char*)strerror(errno):""
+#else
+			""
+#endif
+		);
+		return 0;
+	}
+	fd = create_tcp_accept_sock(res, 1, &noproto, 0,
+		cfg->ip_transparent, 0, cfg->ip_freebind, cfg->use_systemd);
+	freeaddrinfo(res);
+	if(fd == -1 && noproto) {
+		if(!noproto_is_err)
+			return 1; /* return success, but do nothing */
+		log_err("cannot open metrics interface %s %d : "
+			"protocol not supported", ip, nr);
+		return 0;
+	}
+	if(fd == -1) {
+		log_err("cannot open metrics interface %s %d", ip, nr);
+		return 0;
+	}
+	n = (struct listen_port*)calloc(1, sizeof(*n));
+	if(!n) {
+#ifndef USE_WINSOCK
+		close(fd);
+#else
+		closesocket(fd);
+#endif
+		log_err("out of memory");
+		return 0;
+	}
+	n->next = *list;
+	*list = n;
+	n->fd = fd;
+	return 1;
+}
+
+struct listen_port* daemon_metrics_open_ports(struct config_file* cfg)
+{
+	struct listen_port* l = NULL;
+	log_assert(cfg->metrics_enable && cfg->metrics_port);
+	if(cfg->metrics_ifs) {
+		struct config_strlist* p;
+		for(p = cfg->metrics_ifs; p; p = p->next) {
+			if(!metrics_add_open(p->str, cfg->metrics_port, &l, 1,
+				cfg)) {
+				listening_ports_free(l);
+				return NULL;
+			}
+		}
+	} else {
+		/* defaults */
+		if(cfg->do_ip6 && !metrics_add_open("::1", cfg->metrics_port,
+			&l, 0, cfg)) {
+			listening_ports_free(l);
+			return NULL;
+		}
+		if(cfg->do_ip4 && !metrics_add_open("127.0.0.1",
+			cfg->metrics_port, &l, 1, cfg)) {
+			listening_ports_free(l);
+			return NULL;
+		}
+	}
+	return l;
+}
+
+struct daemon_metrics* daemon_metrics_create(struct worker* worker,
+	struct listen_port* ports)
+{
+	struct daemon_metrics* dm = (struct daemon_metrics*)calloc(1,
+		sizeof(*dm));
+	struct listen_port* p;
+	int i;
+	if(!dm) {
+		log_err("out of memory");
+		return NULL;
+	}
+	dm->worker = worker;
+	dm->num = worker->daemon->num;
+	dm->stats = (struct stats_info*)calloc((size_t)dm->num+1,
+		sizeof(struct stats_info));
+	dm->thread_free = (size_t*)calloc((size_t)dm->num, sizeof(size_t));
+	if(!dm->stats || !dm->thread_free) {
+		log_err("out of memory");
+		daemon_metrics_delete(dm);
+		return NULL;
+	}
+	for(i=0; i<METRICS_MAX_ACTIVE; i++) {
+		dm->conns[i].dm = dm;
+		dm->conns[i].buf = sldns_buffer_new(METRICS_BUF_SIZE);
+		if(!dm->conns[i].buf) {
+			log_err("out of memory");
+			daemon_metrics_delete(dm);
+			return NULL;
+		}
+	}
+	for(p = ports; p; p = p->next) {
+		struct listen_list* n = (struct listen_list*)malloc(
+			sizeof(*n));
+		if(!n) {
+			log_err("out of memory");
+			daemon_metrics_delete(dm);
+			return NULL;
+		}
+		n->next = dm->accept_list;
+		dm->accept_list = n;
+		n->com = comm_point_create_raw(worker->base, p->fd, 0,
+			&metrics_accept_callback, dm);
+		if(!n->com) {
+			log_err("could not create metrics accept comm point");
+			daemon_metrics_delete(dm);
+			return NULL;
+		}
+		/* keep this port open, its fd is kept in the portlist */
+		n->com->do_not_close = 1;
+	}
+	return dm;
+}
+
+/** close the connection and free the slot */
+static void
+metrics_conn_close(struct metrics_conn* s)
+{
+	comm_point_delete(s->c);
+	s->c = NULL;
+	s->dm->active--;
+}
+
+void daemon_metrics_delete(struct daemon_metrics* dm)
+{
+	struct listen_list* p, *np;
+	int i;
+	if(!dm)
+		return;
+	p = dm->accept_list;
+	while(p) {
+		np = p->next;
+		comm_point_delete(p->com);
+		free(p);
+		p = np;
+	}
+	for(i=0; i<METRICS_MAX_ACTIVE; i++) {
+		if(dm->conns[i].c)
+			metrics_conn_close(&dm->conns[i]);
+		sldns_buffer_free(dm->conns[i].buf);
+	}
+	free(dm->stats);
+	free(dm->thread_free);
+	free(dm);
+}
+
+void daemon_metrics_stop_accept(struct daemon_metrics* dm)
+{
+	struct listen_list* p;
+	if(!dm)
+		return;
+	for(p=dm->accept_list; p; p=p->next) {
+		comm_point_stop_listening(p->com);
+	}
+}
+
+void daemon_metrics_start_accept(struct daemon_metrics* dm)
+{
+	struct listen_list* p;
+	if(!dm)
+		return;
+	for(p=dm->accept_list; p; p=p->next) {
+		comm_point_start_listening(p->com, -1, -1);
+	}
+}
+
+/** read the counters of the threads, they are not reset, and the memory
+ * use, into the metrics state */
+static void
+metrics_collect(struct daemon_metrics* dm)
+{
+	struct worker* worker = dm->worker;
+	struct daemon* daemon = worker->daemon;
+	struct stats_info* total = &dm->stats[dm->num];
+	int i, m;
+	for(i=0; i<dm->num; i++) {
+		server_stats_compile(daemon->workers[i], &dm->stats[i], 0);
+		if(i == 0)
+			*total = dm->stats[0];
+		else	server_stats_add(total, &dm->stats[i]);
+		dm->thread_free[i] = alloc_get_free_mem(
+			&daemon->workers[i]->alloc);
+	}
+	dm->mem_rrset = slabhash_get_mem(&daemon->env->rrset_cache->table);
+	dm->mem_msg = slabhash_get_mem(daemon->env->msg_cache);
+	dm->mem_alloc = alloc_sized_total(&daemon->superalloc);
+	dm->mem_val = 0;
+	dm->mem_iter = 0;
+	m = modstack_find(&worker->env.mesh->mods, "validator");
+	if(m != -1) {
+		fptr_ok(fptr_whitelist_mod_get_mem(worker->env.mesh->
+			mods.mod[m]->get_mem));
+		dm->mem_val = (*worker->env.mesh->mods.mod[m]->get_mem)
+			(&worker->env, m);
+	}
+	m = modstack_find(&worker->env.mesh->mods, "iterator");
+	if(m != -1) {
+		fptr_ok(fptr_whitelist_mod_get_mem(worker->env.mesh->
+			mods.mod[m]->get_mem));
+		dm->mem_iter = (*worker->env.mesh->mods.mod[m]->get_mem)
+			(&worker->env, m);
+	}
+	dm->hist = worker->env.mesh->histogram;
+	dm->extended = worker->env.cfg->stat_extended;
+	dm->up.tv_sec = worker->env.now_tv->tv_sec -
+		daemon->time_boot.tv_sec;
+	dm->up.tv_usec = worker->env.now_tv->tv_usec -
+		daemon->time_boot.tv_usec;
+	if(dm->up.tv_usec < 0) {
+		dm->up.tv_usec += 1000000;
+		dm->up.tv_sec--;
+	}
+}
+
+int metrics_print(struct daemon_metrics* dm, sldns_buffer* b)
+{
+	metrics_collect(dm);
+	return metrics_print_text(dm, b);
+}
+
+/** put the reply with the HTTP header in the buffer of the connection,
+ * the text starts at METRICS_HDR_MAX in the buffer */
+static void
+metrics_reply(struct metrics_conn* s, const char* status, int head)
+{
+	char hdr[METRICS_HDR_MAX];
+	size_t len = sldns_buffer_position(s->buf) - METRICS_HDR_MAX;
+	size_t hlen;
+	snprintf(hdr, sizeof(hdr), "HTTP/1.0 %s\r\n"
+		"Content-Type: %s\r\n"
+		"Content-Length: %u\r\n"
+		"Connection: close\r\n\r\n", status,
+		(strcmp(status, "200 OK") == 0)?METRICS_CONTENT_TYPE:
+		"text/plain", (unsigned)len);
+	hdr[sizeof(hdr)-1] = 0;
+	hlen = strlen(hdr);
+	memmove(sldns_buffer_at(s->buf, METRICS_HDR_MAX - hlen), hdr, hlen);
+	s->send_pos = METRICS_HDR_MAX - hlen;
+	s->send_end = head?METRICS_HDR_MAX:sldns_buffer_position(s->buf);
+	s->writing = 1;
+}
+
+/** handle the HTTP request, and make the reply. */
+static void
+metrics_handle_req(struct metrics_conn* s)
+{
+	char* path;
+	int head = 0;
+	sldns_buffer_clear(s->buf);
+	sldns_buffer_set_position(s->buf, METRICS_HDR_MAX);
+	if(strncmp(s->req, "GET ", 4) == 0)
+		path = s->req+4;
+	else if(strncmp(s->req, "HEAD ", 5) == 0) {
+		path = s->req+5;
+		head = 1;
+	} else {
+		(void)sldns_buffer_printf(s->buf, "method not allowed\n");
+		metrics_reply(s, "405 Method Not Allowed", 0);
+		return;
+	}
+	if(strncmp(path, "/metrics", 8) != 0 || (path[8] != ' ' &&
+		path[8] != '?' && path[8] != '\r' && path[8] != '\n')) {
+		(void)sldns_buffer_printf(s->buf, "not found, use /metrics\n");
+		metrics_reply(s, "404 Not Found", head);
+		return;
+	}
+	if(!metrics_print(s->dm, s->buf)) {
+		sldns_buffer* nb = sldns_buffer_new(METRICS_BUF_SIZE);
+		log_err("metrics: out of memory");
+		/* the buffer keeps the error, start again with a new one */
+		if(nb) {
+			sldns_buffer_free(s->buf);
+			s->buf = nb;
+		}
+		sldns_buffer_clear(s->buf);
+		sldns_buffer_set_position(s->buf, METRICS_HDR_MAX);
+		metrics_reply(s, "500 Internal Server Error", head);
+		return;
+	}
+	metrics_reply(s, "200 OK", head);
+}
+
+/** see if the request is complete, with the empty line after the header
+ * @return true if it is complete. */
+static int
+metrics_req_done(struct metrics_conn* s)
+{
+	return strstr(s->req, "\r\n\r\n") != NULL ||
+		strstr(s->req, "\n\n") != NULL;
+}
+
+/** read the request, returns false if the connection has to be closed */
+static int
+metrics_read(struct metrics_conn* s)
+{
+	ssize_t r;
+	if(s->req_len >= sizeof(s->req)-1) {
+		verbose(VERB_QUERY, "metrics: request too long");
+		return 0;
+	}
+	r = recv(s->c->fd, s->req+s->req_len, sizeof(s->req)-1-s->req_len, 0);
+	if(r == 0)
+		return 0; /* closed */
+	if(r == -1) {
+#ifndef USE_WINSOCK
+		if(errno == EINTR || errno == EAGAIN)
+			return 1;
+		verbose(VERB_QUERY, "metrics: recv: %s", strerror(errno));
+#else
+		if(WSAGetLastError() == WSAEINPROGRESS ||
+			WSAGetLastError() == WSAEWOULDBLOCK)
+			return 1;
+		verbose(VERB_QUERY, "metrics: recv: %s",
+			wsa_strerror(WSAGetLastError()));
+#endif
+		return 0;
+	}
+	s->req_len += (size_t)r;
+	s->req[s->req_len] = 0;
+	if(!metrics_req_done(s))
+		return 1;
+	metrics_handle_req(s);
+	comm_point_listen_for_rw(s->c, 0, 1);
+	return 1;
+}
+
+/** write the reply, returns false if the connection has to be closed,
+ * also when the reply has been written */
+static int
+metrics_write(struct metrics_conn* s)
+{
+	ssize_t r;
+	while(s->send_pos < s->send_end) {
+		r = send(s->c->fd, (void*)sldns_buffer_at(s->buf, s->send_pos),
+			s->send_end - s->send_pos, 0);
+		if(r == -1) {
+#ifndef USE_WINSOCK
+			if(errno == EINTR)
+				continue;
+			if(errno == EAGAIN)
+				return 1;
+			verbose(VERB_QUERY, "metrics: send: %s",
+				strerror(errno));
+#else
+			if(WSAGetLastError() == WSAEINPROGRESS ||
+				WSAGetLastError() == WSAEWOULDBLOCK)
+				return 1;
+			verbose(VERB_QUERY, "metrics: send: %s",
+				wsa_strerror(WSAGetLastError()));
+#endif
+			return 0;
+		}
+		s->send_pos += (size_t)r;
+	}
+	return 0;
+}
+
+int metrics_accept_callback(struct comm_point* c, void* arg, int err,
+	struct comm_reply* ATTR_UNUSED(rep))
+{
+	struct daemon_metrics* dm = (struct daemon_metrics*)arg;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct metrics_conn* s = NULL;
+	int newfd, i;
+	if(err != NETEVENT_NOERROR) {
+		log_err("error %d on metrics_accept_callback", err);
+		return 0;
+	}
+	newfd = comm_point_perform_accept(c, &addr, &addrlen);
+	if(newfd == -1)
+		return 0;
+	for(i=0; i<METRICS_MAX_ACTIVE; i++) {
+		if(!dm->conns[i].c) {
+			s = &dm->conns[i];
+			break;
+		}
+	}
+	if(!s) {
+		verbose(VERB_OPS, "drop incoming metrics connection: "
+			"too many connections");
+	close_exit:
+#ifndef USE_WINSOCK
+		close(newfd);
+#else
+		closesocket(newfd);
+#endif
+		return 0;
+	}
+	fd_set_nonblock(newfd);
+	s->c = comm_point_create_raw(dm->worker->base, newfd, 0,
+		&metrics_conn_callback, s);
+	if(!s->c) {
+		log_err("out of memory");
+		goto close_exit;
+	}
+	log_addr(VERB_ALGO, "new metrics connection from", &addr, addrlen);
+	s->c->do_not_close = 0;
+	comm_point_stop_listening(s->c);
+	comm_point_start_listening(s->c, -1, METRICS_TCP_TIMEOUT);
+	s->req_len = 0;
+	s->req[0] = 0;
+	s->writing = 0;
+	dm->active++;
+	return 0;
+}
+
+int metrics_conn_callback(struct comm_point* ATTR_UNUSED(c), void* arg,
+	int err, struct comm_reply* ATTR_UNUSED(rep))
+{
+	struct metrics_conn* s = (struct metrics_conn*)arg;
+	log_assert(s->c == c);
+	if(err != NETEVENT_NOERROR) {
+		if(err == NETEVENT_TIMEOUT)
+			verbose(VERB_QUERY, "metrics connection timed out");
+		metrics_conn_close(s);
+		return 0;
+	}
+	if(!s->writing) {
+		if(!metrics_read(s)) {
+			metrics_conn_close(s);
+			return 0;
+		}
+		if(!s->writing)
+			return 0;
+	}
+	if(!metrics_write(s))
+		metrics_conn_close(s);
+	return 0;
+}
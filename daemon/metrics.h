@@ -0,0 +1,185 @@
+/*
+ * daemon/metrics.h - statistics scrape endpoint for the unbound daemon.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the metrics endpoint of the daemon. It is a small
+ * HTTP listener that serves the statistics counters in the OpenMetrics
+ * (Prometheus) text format, for monitoring systems that scrape them.
+ * The counters are the same as for unbound-control stats_noreset, and
+ * scrapes do not reset them.
+ */
+
+#ifndef DAEMON_METRICS_H
+#define DAEMON_METRICS_H
+struct config_file;
+struct listen_list;
+struct listen_port;
+struct worker;
+struct comm_reply;
+struct comm_point;
+struct stats_info;
+struct timehist;
+struct sldns_buffer;
+
+/** number of milliseconds timeout on a metrics connection */
+#define METRICS_TCP_TIMEOUT 10000
+/** max number of metrics connections that are serviced at the same time */
+#define METRICS_MAX_ACTIVE 4
+/** size of the buffer for the HTTP request */
+#define METRICS_REQ_MAX 2048
+/** initial size of the reply buffer, it grows if the output is larger */
+#define METRICS_BUF_SIZE 65536
+/** space before the reply text in the buffer, for the HTTP header */
+#define METRICS_HDR_MAX 256
+
+/**
+ * A metrics connection. These are allocated, with their buffers, when
+ * the listener is created, a scrape does not allocate memory.
+ */
+struct metrics_conn {
+	/** the metrics state this is part of */
+	struct daemon_metrics* dm;
+	/** the commpoint, NULL if this slot is free */
+	struct comm_point* c;
+	/** the request that is read */
+	char req[METRICS_REQ_MAX];
+	/** length of the request read so far */
+	size_t req_len;
+	/** if the reply is being written */
+	int writing;
+	/** the reply, the HTTP header is put just before the text */
+	struct sldns_buffer* buf;
+	/** position of the next byte to write */
+	size_t send_pos;
+	/** end of the reply to write */
+	size_t send_end;
+};
+
+/**
+ * The metrics endpoint state. It is created for the first thread, that
+ * listens on the metrics port and reads the counters of all threads.
+ */
+struct daemon_metrics {
+	/** the worker for this metrics endpoint */
+	struct worker* worker;
+	/** commpoints for accepting metrics connections */
+	struct listen_list* accept_list;
+	/** number of active connections */
+	int active;
+	/** the connections */
+	struct metrics_conn conns[METRICS_MAX_ACTIVE];
+	/** the statistics of the threads, and after them, the total */
+	struct stats_info* stats;
+	/** number of threads in the stats array */
+	int num;
+	/** memory in the free lists of the allocation cache of each thread */
+	size_t* thread_free;
+	/** memory used by the rrset cache, the message cache, and the cache
+	 * memory blocks */
+	size_t mem_rrset, mem_msg, mem_alloc;
+	/** memory used by the iterator and the validator */
+	size_t mem_iter, mem_val;
+	/** the recursion time histogram, for the bucket bounds */
+	struct timehist* hist;
+	/** if the extended statistics are printed */
+	int extended;
+	/** the time the server is up */
+	struct timeval up;
+};
+
+/**
+ * Open and create the listening ports for the metrics endpoint.
+ * @param cfg: config with port number and interfaces.
+ * @return list of ports or NULL on failure.
+ * 	can be freed with listening_ports_free().
+ */
+struct listen_port* daemon_metrics_open_ports(struct config_file* cfg);
+
+/**
+ * Create the metrics endpoint, and setup the accept commpoints.
+ * @param worker: the first worker, that runs the endpoint.
+ * @param ports: the list of open ports, from daemon_metrics_open_ports.
+ * @return new state, or NULL on failure.
+ */
+struct daemon_metrics* daemon_metrics_create(struct worker* worker,
+	struct listen_port* ports);
+
+/**
+ * Delete the metrics endpoint, closes its connections, but not the
+ * listening ports.
+ * @param dm: the metrics state to delete.
+ */
+void daemon_metrics_delete(struct daemon_metrics* dm);
+
+/**
+ * Stop accept handlers for TCP (until enabled again)
+ * @param dm: state
+ */
+void daemon_metrics_stop_accept(struct daemon_metrics* dm);
+
+/**
+ * Start accept handlers for TCP (that were stopped before)
+ * @param dm: state
+ */
+void daemon_metrics_start_accept(struct daemon_metrics* dm);
+
+/**
+ * Print the statistics in OpenMetrics text format.
+ * @param dm: state, with the workers to read.
+ * @param buf: the text is appended here, the buffer grows if needed.
+ * @return false on failure (out of memory).
+ */
+int metrics_print(struct daemon_metrics* dm, struct sldns_buffer* buf);
+
+/**
+ * Print the statistics that are read into the metrics state, in
+ * OpenMetrics text format.  It does not look at the workers.
+ * @param dm: state, with the statistics, memory and histogram filled in.
+ * @param buf: the text is appended here, the buffer grows if needed.
+ * @return false on failure (out of memory).
+ */
+int metrics_print_text(struct daemon_metrics* dm, struct sldns_buffer* buf);
+
+/** metrics accept callback */
+int metrics_accept_callback(struct comm_point* c, void* arg, int err,
+	struct comm_reply* rep);
+
+/** metrics connection callback */
+int metrics_conn_callback(struct comm_point* c, void* arg, int err,
+	struct comm_reply* rep);
+
+#endif /* DAEMON_METRICS_H */
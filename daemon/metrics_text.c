@@ -0,0 +1,386 @@
+/*
+ * daemon/metrics_text.c - statistics in the OpenMetrics text format.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file formats the statistics that the metrics endpoint has read
+ * into the OpenMetrics text format.  It only uses the values in the
+ * daemon_metrics struct, not the workers, so it can be tested by itself.
+ */
+#include "config.h"
+#include "daemon/metrics.h"
+#include "daemon/stats.h"
+#include "util/timehist.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
+#include "sldns/wire2str.h"
+#include "sldns/parseutil.h"
+
+/** print the TYPE and HELP lines of a metric family */
+static void
+mx_family(sldns_buffer* b, const char* name, const char* type,
+	const char* help)
+{
+	(void)sldns_buffer_printf(b, "# TYPE unbound_%s %s\n"
+		"# HELP unbound_%s %s\n", name, type, name, help);
+}
+
+/** print a counter family with a value for every thread */
+static void
+mx_thread_counter(struct daemon_metrics* dm, sldns_buffer* b,
+	const char* name, const char* help, size_t off)
+{
+	int i;
+	mx_family(b, name, "counter", help);
+	for(i=0; i<dm->num; i++)
+		(void)sldns_buffer_printf(b, "unbound_%s_total{thread=\"%d\"} "
+			"%lu\n", name, i, (unsigned long)*(size_t*)
+			((uint8_t*)&dm->stats[i] + off));
+}
+
+/** print a gauge family with a value for every thread */
+static void
+mx_thread_gauge(struct daemon_metrics* dm, sldns_buffer* b,
+	const char* name, const char* help, size_t off)
+{
+	int i;
+	mx_family(b, name, "gauge", help);
+	for(i=0; i<dm->num; i++)
+		(void)sldns_buffer_printf(b, "unbound_%s{thread=\"%d\"} %lu\n",
+			name, i, (unsigned long)*(size_t*)
+			((uint8_t*)&dm->stats[i] + off));
+}
+
+/** print a counter family with one value */
+static void
+mx_counter(sldns_buffer* b, const char* name, const char* help, size_t v)
+{
+	mx_family(b, name, "counter", help);
+	(void)sldns_buffer_printf(b, "unbound_%s_total %lu\n", name,
+		(unsigned long)v);
+}
+
+/** offset of a member in the stats_info */
+#define MX_OFF(member) offsetof(struct stats_info, member)
+
+/** time value in seconds */
+static double
+mx_secs(struct timeval* tv)
+{
+	return (double)tv->tv_sec + (double)tv->tv_usec/1000000.;
+}
+
+/** print the per thread statistics, like print_stats of the remote */
+static void
+mx_threads(struct daemon_metrics* dm, sldns_buffer* b)
+{
+	int i;
+	mx_thread_counter(dm, b, "queries", "Queries received from clients.",
+		MX_OFF(svr.num_queries));
+	mx_thread_counter(dm, b, "queries_ip_ratelimited",
+		"Queries dropped by the ip ratelimit.",
+		MX_OFF(svr.num_queries_ip_ratelimited));
+	mx_thread_counter(dm, b, "rrl_dropped",
+		"Replies dropped by the response rate limit.",
+		MX_OFF(svr.rrl_dropped));
+	mx_thread_counter(dm, b, "rrl_slipped",
+		"Replies truncated by the response rate limit.",
+		MX_OFF(svr.rrl_slipped));
+	mx_family(b, "cache_hits", "counter",
+		"Queries answered from the cache.");
+	for(i=0; i<dm->num; i++)
+		(void)sldns_buffer_printf(b, "unbound_cache_hits_total"
+			"{thread=\"%d\"} %lu\n", i, (unsigned long)(
+			dm->stats[i].svr.num_queries -
+			dm->stats[i].svr.num_queries_missed_cache));
+	mx_thread_counter(dm, b, "cache_misses",
+		"Queries that needed recursive processing.",
+		MX_OFF(svr.num_queries_missed_cache));
+	mx_thread_counter(dm, b, "prefetches", "Cache prefetches performed.",
+		MX_OFF(svr.num_queries_prefetch));
+	mx_thread_counter(dm, b, "zero_ttl_responses",
+		"Answers served from expired cache.",
+		MX_OFF(svr.zero_ttl_responses));
+	mx_thread_counter(dm, b, "hedge_sent",
+		"Hedged queries sent to another server.",
+		MX_OFF(svr.num_hedge_sent));
+	mx_thread_counter(dm, b, "hedge_won",
+		"Hedged queries that were answered first.",
+		MX_OFF(svr.num_hedge_won));
+	mx_thread_counter(dm, b, "udppool_opened",
+		"Sockets opened for the outgoing UDP pool.",
+		MX_OFF(svr.num_udppool_opened));
+	mx_thread_counter(dm, b, "udppool_rotated",
+		"Outgoing UDP pool sockets rotated to a new port.",
+		MX_OFF(svr.num_udppool_rotated));
+	mx_thread_counter(dm, b, "recursive_replies",
+		"Replies sent to queries that needed recursive processing.",
+		MX_OFF(mesh_replies_sent));
+	mx_thread_counter(dm, b, "requestlist_overwritten",
+		"Requests in the request list that were overwritten.",
+		MX_OFF(mesh_jostled));
+	mx_thread_counter(dm, b, "requestlist_exceeded",
+		"Requests dropped because the request list was full.",
+		MX_OFF(mesh_dropped));
+	mx_thread_counter(dm, b, "requestlist_quota_client",
+		"Requests dropped because of the client network quota.",
+		MX_OFF(mesh_adm_client));
+	mx_thread_counter(dm, b, "requestlist_quota_zone",
+		"Requests dropped because of the zone quota.",
+		MX_OFF(mesh_adm_zone));
+	mx_thread_counter(dm, b, "requestlist_evicted",
+		"Requests evicted to make space for a less busy client.",
+		MX_OFF(mesh_adm_evicted));
+	mx_thread_counter(dm, b, "requestlist_prefetch_dropped",
+		"Prefetches dropped because the request list was full.",
+		MX_OFF(mesh_adm_prefetch));
+	mx_thread_gauge(dm, b, "requestlist_max",
+		"Maximum size of the request list.",
+		MX_OFF(svr.max_query_list_size));
+	mx_thread_gauge(dm, b, "requestlist_current_all",
+		"Current size of the request list, with internal requests.",
+		MX_OFF(mesh_num_states));
+	mx_thread_gauge(dm, b, "requestlist_current_user",
+		"Current size of the request list, client requests only.",
+		MX_OFF(mesh_num_reply_states));
+	mx_thread_gauge(dm, b, "tcp_usage",
+		"Number of TCP buffers in use.",
+		MX_OFF(svr.tcp_accept_usage));
+	mx_family(b, "requestlist_avg", "gauge",
+		"Average size of the request list on a cache miss.");
+	for(i=0; i<dm->num; i++) {
+		struct server_stats* s = &dm->stats[i].svr;
+		size_t n = s->num_queries_missed_cache+s->num_queries_prefetch;
+		(void)sldns_buffer_printf(b, "unbound_requestlist_avg"
+			"{thread=\"%d\"} %g\n", i, n?(double)
+			s->sum_query_list_size/(double)n : 0.0);
+	}
+	mx_family(b, "recursion_time_avg_seconds", "gauge",
+		"Average time to answer queries that needed recursion.");
+	for(i=0; i<dm->num; i++) {
+		struct stats_info* s = &dm->stats[i];
+		(void)sldns_buffer_printf(b, "unbound_recursion_time_avg_seconds"
+			"{thread=\"%d\"} %g\n", i, s->mesh_replies_sent?
+			mx_secs(&s->mesh_replies_sum_wait)/
+			(double)s->mesh_replies_sent : 0.0);
+	}
+	mx_family(b, "recursion_time_median_seconds", "gauge",
+		"Median time to answer queries that needed recursion.");
+	for(i=0; i<dm->num; i++)
+		(void)sldns_buffer_printf(b, "unbound_recursion_time_median_"
+			"seconds{thread=\"%d\"} %g\n", i,
+			dm->stats[i].mesh_time_median);
+	mx_family(b, "memory_thread_free_bytes", "gauge",
+		"Memory in the free lists of the thread allocation cache.");
+	for(i=0; i<dm->num; i++)
+		(void)sldns_buffer_printf(b, "unbound_memory_thread_free_bytes"
+			"{thread=\"%d\"} %lu\n", i,
+			(unsigned long)dm->thread_free[i]);
+}
+
+/** print the memory use, like print_mem of the remote */
+static void
+mx_mem(struct daemon_metrics* dm, sldns_buffer* b)
+{
+	mx_family(b, "memory_cache_bytes", "gauge", "Memory used by caches.");
+	(void)sldns_buffer_printf(b,
+		"unbound_memory_cache_bytes{cache=\"rrset\"} %lu\n"
+		"unbound_memory_cache_bytes{cache=\"message\"} %lu\n"
+		"unbound_memory_cache_bytes{cache=\"alloc\"} %lu\n",
+		(unsigned long)dm->mem_rrset, (unsigned long)dm->mem_msg,
+		(unsigned long)dm->mem_alloc);
+	mx_family(b, "memory_module_bytes", "gauge",
+		"Memory used by modules.");
+	(void)sldns_buffer_printf(b,
+		"unbound_memory_module_bytes{module=\"iterator\"} %lu\n"
+		"unbound_memory_module_bytes{module=\"validator\"} %lu\n",
+		(unsigned long)dm->mem_iter, (unsigned long)dm->mem_val);
+}
+
+/** print one counter of a labelled family */
+static void
+mx_label(sldns_buffer* b, const char* name, const char* label,
+	const char* value, size_t v)
+{
+	(void)sldns_buffer_printf(b, "unbound_%s_total{%s=\"%s\"} %lu\n",
+		name, label, value, (unsigned long)v);
+}
+
+/** print the extended statistics, like print_ext of the remote */
+static void
+mx_ext(sldns_buffer* b, struct stats_info* s)
+{
+	int i;
+	char nm[32];
+	const sldns_rr_descriptor* desc;
+	const sldns_lookup_table* lt;
+	mx_family(b, "query_types", "counter", "Queries by query type.");
+	for(i=0; i<STATS_QTYPE_NUM; i++) {
+		if(s->svr.qtype[i] == 0)
+			continue;
+		desc = sldns_rr_descript((uint16_t)i);
+		if(desc && desc->_name)
+			snprintf(nm, sizeof(nm), "%s", desc->_name);
+		else if(i == LDNS_RR_TYPE_IXFR)
+			snprintf(nm, sizeof(nm), "IXFR");
+		else if(i == LDNS_RR_TYPE_AXFR)
+			snprintf(nm, sizeof(nm), "AXFR");
+		else if(i == LDNS_RR_TYPE_MAILA)
+			snprintf(nm, sizeof(nm), "MAILA");
+		else if(i == LDNS_RR_TYPE_MAILB)
+			snprintf(nm, sizeof(nm), "MAILB");
+		else if(i == LDNS_RR_TYPE_ANY)
+			snprintf(nm, sizeof(nm), "ANY");
+		else	snprintf(nm, sizeof(nm), "TYPE%d", i);
+		mx_label(b, "query_types", "type", nm, s->svr.qtype[i]);
+	}
+	mx_label(b, "query_types", "type", "other", s->svr.qtype_big);
+	mx_family(b, "query_classes", "counter", "Queries by query class.");
+	for(i=0; i<STATS_QCLASS_NUM; i++) {
+		if(s->svr.qclass[i] == 0)
+			continue;
+		lt = sldns_lookup_by_id(sldns_rr_classes, i);
+		if(lt && lt->name)
+			snprintf(nm, sizeof(nm), "%s", lt->name);
+		else	snprintf(nm, sizeof(nm), "CLASS%d", i);
+		mx_label(b, "query_classes", "class", nm, s->svr.qclass[i]);
+	}
+	mx_label(b, "query_classes", "class", "other", s->svr.qclass_big);
+	mx_family(b, "query_opcodes", "counter", "Queries by opcode.");
+	for(i=0; i<STATS_OPCODE_NUM; i++) {
+		if(s->svr.qopcode[i] == 0)
+			continue;
+		lt = sldns_lookup_by_id(sldns_opcodes, i);
+		if(lt && lt->name)
+			snprintf(nm, sizeof(nm), "%s", lt->name);
+		else	snprintf(nm, sizeof(nm), "OPCODE%d", i);
+		mx_label(b, "query_opcodes", "opcode", nm, s->svr.qopcode[i]);
+	}
+	mx_counter(b, "query_tcp", "Queries received over TCP.",
+		s->svr.qtcp);
+	mx_counter(b, "query_tcp_out", "Queries sent upstream over TCP.",
+		s->svr.qtcp_outgoing);
+	mx_counter(b, "query_ipv6", "Queries received over IPv6.",
+		s->svr.qipv6);
+	mx_family(b, "query_flags", "counter",
+		"Queries with the header flag set.");
+	mx_label(b, "query_flags", "flag", "QR", s->svr.qbit_QR);
+	mx_label(b, "query_flags", "flag", "AA", s->svr.qbit_AA);
+	mx_label(b, "query_flags", "flag", "TC", s->svr.qbit_TC);
+	mx_label(b, "query_flags", "flag", "RD", s->svr.qbit_RD);
+	mx_label(b, "query_flags", "flag", "RA", s->svr.qbit_RA);
+	mx_label(b, "query_flags", "flag", "Z", s->svr.qbit_Z);
+	mx_label(b, "query_flags", "flag", "AD", s->svr.qbit_AD);
+	mx_label(b, "query_flags", "flag", "CD", s->svr.qbit_CD);
+	mx_counter(b, "query_edns_present", "Queries with EDNS.",
+		s->svr.qEDNS);
+	mx_counter(b, "query_edns_DO", "Queries with the EDNS DO flag.",
+		s->svr.qEDNS_DO);
+	mx_family(b, "answer_rcodes", "counter", "Answers by rcode.");
+	for(i=0; i<STATS_RCODE_NUM; i++) {
+		/* always include RCODEs 0-5 */
+		if(i > LDNS_RCODE_REFUSED && s->svr.ans_rcode[i] == 0)
+			continue;
+		lt = sldns_lookup_by_id(sldns_rcodes, i);
+		if(lt && lt->name)
+			snprintf(nm, sizeof(nm), "%s", lt->name);
+		else	snprintf(nm, sizeof(nm), "RCODE%d", i);
+		mx_label(b, "answer_rcodes", "rcode", nm, s->svr.ans_rcode[i]);
+	}
+	mx_counter(b, "answers_nodata", "Answers with NOERROR and no data.",
+		s->svr.ans_rcode_nodata);
+	mx_counter(b, "answers_secure", "Answers that were secure.",
+		s->svr.ans_secure);
+	mx_counter(b, "answers_bogus", "Answers that were bogus.",
+		s->svr.ans_bogus);
+	mx_counter(b, "rrset_bogus", "RRsets marked bogus by the validator.",
+		s->svr.rrset_bogus);
+	mx_counter(b, "unwanted_queries", "Queries refused or dropped.",
+		s->svr.unwanted_queries);
+	mx_counter(b, "unwanted_replies", "Replies that were not expected.",
+		s->svr.unwanted_replies);
+	mx_family(b, "cache_count", "gauge", "Number of entries in caches.");
+	(void)sldns_buffer_printf(b,
+		"unbound_cache_count{cache=\"message\"} %lu\n"
+		"unbound_cache_count{cache=\"rrset\"} %lu\n"
+		"unbound_cache_count{cache=\"infra\"} %lu\n"
+		"unbound_cache_count{cache=\"key\"} %lu\n",
+		(unsigned long)s->svr.msg_cache_count,
+		(unsigned long)s->svr.rrset_cache_count,
+		(unsigned long)s->svr.infra_cache_count,
+		(unsigned long)s->svr.key_cache_count);
+}
+
+/** print the histogram of recursion times, of all threads */
+static void
+mx_hist(struct daemon_metrics* dm, sldns_buffer* b, struct stats_info* t)
+{
+	struct timehist* h = dm->hist;
+	size_t i, n, cum = 0;
+	int j;
+	n = (h->num < NUM_BUCKETS_HIST)?h->num:NUM_BUCKETS_HIST;
+	mx_family(b, "response_time_seconds", "histogram",
+		"Time to answer queries that needed recursion.");
+	for(i=0; i<n; i++) {
+		for(j=0; j<dm->num; j++)
+			cum += dm->stats[j].svr.hist[i];
+		(void)sldns_buffer_printf(b, "unbound_response_time_seconds_"
+			"bucket{le=\"%d.%6.6d\"} %lu\n",
+			(int)h->buckets[i].upper.tv_sec,
+			(int)h->buckets[i].upper.tv_usec, (unsigned long)cum);
+	}
+	(void)sldns_buffer_printf(b, "unbound_response_time_seconds_bucket"
+		"{le=\"+Inf\"} %lu\n"
+		"unbound_response_time_seconds_count %lu\n"
+		"unbound_response_time_seconds_sum %g\n", (unsigned long)cum,
+		(unsigned long)cum, mx_secs(&t->mesh_replies_sum_wait));
+}
+
+int metrics_print_text(struct daemon_metrics* dm, sldns_buffer* b)
+{
+	struct stats_info* total = &dm->stats[dm->num];
+	mx_threads(dm, b);
+	mx_mem(dm, b);
+	mx_hist(dm, b, total);
+	if(dm->extended)
+		mx_ext(b, total);
+	mx_family(b, "time_up_seconds", "gauge", "Uptime of the server.");
+	(void)sldns_buffer_printf(b, "unbound_time_up_seconds %g\n",
+		mx_secs(&dm->up));
+	(void)sldns_buffer_printf(b, "# EOF\n");
+	return sldns_buffer_status_ok(b);
+}
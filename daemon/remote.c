@@ -59,6 +59,7 @@
 #include "daemon/daemon.h"
 #include "daemon/stats.h"
 #include "daemon/cachedump.h"
+#include "daemon/rrl.h"
 #include "util/log.h"
 #include "util/config_file.h"
 #include "util/net_help.h"
@@ -764,6 +765,10 @@ print_stats(SSL* ssl, const char* nm, struct stats_info* s)
 		(unsigned long)s->svr.num_queries)) return 0;
 	if(!ssl_printf(ssl, "%s.num.queries_ip_ratelimited"SQ"%lu\n", nm,
 		(unsigned long)s->svr.num_queries_ip_ratelimited)) return 0;
+	if(!ssl_printf(ssl, "%s.num.rrl_dropped"SQ"%lu\n", nm,
+		(unsigned long)s->svr.rrl_dropped)) return 0;
+	if(!ssl_printf(ssl, "%s.num.rrl_slipped"SQ"%lu\n", nm,
+		(unsigned long)s->svr.rrl_slipped)) return 0;
 	if(!ssl_printf(ssl, "%s.num.cachehits"SQ"%lu\n", nm, 
 		(unsigned long)(s->svr.num_queries 
 			- s->svr.num_queries_missed_cache))) return 0;
@@ -773,6 +778,14 @@ print_stats(SSL* ssl, const char* nm, struct stats_info* s)
 		(unsigned long)s->svr.num_queries_prefetch)) return 0;
 	if(!ssl_printf(ssl, "%s.num.zero_ttl"SQ"%lu\n", nm,
 		(unsigned long)s->svr.zero_ttl_responses)) return 0;
+	if(!ssl_printf(ssl, "%s.num.hedge.sent"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_hedge_sent)) return 0;
+	if(!ssl_printf(ssl, "%s.num.hedge.won"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_hedge_won)) return 0;
+	if(!ssl_printf(ssl, "%s.num.udppool.opened"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_udppool_opened)) return 0;
+	if(!ssl_printf(ssl, "%s.num.udppool.rotated"SQ"%lu\n", nm,
+		(unsigned long)s->svr.num_udppool_rotated)) return 0;
 	if(!ssl_printf(ssl, "%s.num.recursivereplies"SQ"%lu\n", nm, 
 		(unsigned long)s->mesh_replies_sent)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.avg"SQ"%g\n", nm,
@@ -786,6 +799,14 @@ print_stats(SSL* ssl, const char* nm, struct stats_info* s)
 		(unsigned long)s->mesh_jostled)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.exceeded"SQ"%lu\n", nm,
 		(unsigned long)s->mesh_dropped)) return 0;
+	if(!ssl_printf(ssl, "%s.requestlist.quota.client"SQ"%lu\n", nm,
+		(unsigned long)s->mesh_adm_client)) return 0;
+	if(!ssl_printf(ssl, "%s.requestlist.quota.zone"SQ"%lu\n", nm,
+		(unsigned long)s->mesh_adm_zone)) return 0;
+	if(!ssl_printf(ssl, "%s.requestlist.evicted"SQ"%lu\n", nm,
+		(unsigned long)s->mesh_adm_evicted)) return 0;
+	if(!ssl_printf(ssl, "%s.requestlist.prefetch_dropped"SQ"%lu\n", nm,
+		(unsigned long)s->mesh_adm_prefetch)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.current.all"SQ"%lu\n", nm,
 		(unsigned long)s->mesh_num_states)) return 0;
 	if(!ssl_printf(ssl, "%s.requestlist.current.user"SQ"%lu\n", nm,
@@ -830,9 +851,10 @@ static int
 print_mem(SSL* ssl, struct worker* worker, struct daemon* daemon)
 {
 	int m;
-	size_t msg, rrset, val, iter;
+	size_t msg, rrset, val, iter, cmem;
 	msg = slabhash_get_mem(daemon->env->msg_cache);
 	rrset = slabhash_get_mem(&daemon->env->rrset_cache->table);
+	cmem = alloc_sized_total(&daemon->superalloc);
 	val=0;
 	iter=0;
 	m = modstack_find(&worker->env.mesh->mods, "validator");
@@ -854,6 +876,8 @@ print_mem(SSL* ssl, struct worker* worker, struct daemon* daemon)
 		return 0;
 	if(!print_longnum(ssl, "mem.cache.message"SQ, msg))
 		return 0;
+	if(!print_longnum(ssl, "mem.cache.alloc"SQ, cmem))
+		return 0;
 	if(!print_longnum(ssl, "mem.mod.iterator"SQ, iter))
 		return 0;
 	if(!print_longnum(ssl, "mem.mod.validator"SQ, val))
@@ -1053,9 +1077,10 @@ do_stats(SSL* ssl, struct daemon_remote* rc, int reset)
 	struct stats_info s;
 	int i;
 	log_assert(daemon->num > 0);
-	/* gather all thread statistics in one place */
+	/* gather all thread statistics in one place, they are read from
+	 * the threads directly */
 	for(i=0; i<daemon->num; i++) {
-		server_stats_obtain(rc->worker, daemon->workers[i], &s, reset);
+		server_stats_compile(daemon->workers[i], &s, reset);
 		if(!print_thread_stats(ssl, i, &s))
 			return;
 		if(i == 0)
@@ -1458,11 +1483,13 @@ do_flush_type(SSL* ssl, struct worker* worker, char* arg)
 	send_ok(ssl);
 }
 
-/** flush statistics */
+/** flush statistics, of all the threads */
 static void
 do_flush_stats(SSL* ssl, struct worker* worker)
 {
-	worker_stats_clear(worker);
+	int i;
+	for(i=0; i<worker->daemon->num; i++)
+		server_stats_flush(worker->daemon->workers[i]);
 	send_ok(ssl);
 }
 
@@ -1513,6 +1540,22 @@ infra_del_host(struct lruhash_entry* e, void* arg)
 	}
 }
 
+/** callback to delete the lameness of hosts in infra cache */
+static void
+infra_del_lame(struct lruhash_entry* e, void* arg)
+{
+	/* entry is locked */
+	struct del_info* inf = (struct del_info*)arg;
+	struct infra_lame_key* k = (struct infra_lame_key*)e->key;
+	if(sockaddr_cmp(&inf->addr, inf->addrlen, &k->addr, k->addrlen) == 0) {
+		struct infra_lame_data* d = (struct infra_lame_data*)e->data;
+		if(d->ttl > inf->expired) {
+			d->ttl = inf->expired;
+			inf->num_keys++;
+		}
+	}
+}
+
 /** flush infra cache */
 static void
 do_flush_infra(SSL* ssl, struct worker* worker, char* arg)
@@ -1522,6 +1565,7 @@ do_flush_infra(SSL* ssl, struct worker* worker, char* arg)
 	struct del_info inf;
 	if(strcmp(arg, "all") == 0) {
 		slabhash_clear(worker->env.infra_cache->hosts);
+		slabhash_clear(worker->env.infra_cache->lame);
 		send_ok(ssl);
 		return;
 	}
@@ -1544,6 +1588,8 @@ do_flush_infra(SSL* ssl, struct worker* worker, char* arg)
 	memmove(&inf.addr, &addr, len);
 	slabhash_traverse(worker->env.infra_cache->hosts, 1, &infra_del_host,
 		&inf);
+	slabhash_traverse(worker->env.infra_cache->lame, 1, &infra_del_lame,
+		&inf);
 	send_ok(ssl);
 }
 
@@ -2254,13 +2300,21 @@ get_mesh_status(struct mesh_area* mesh, struct mesh_state* m,
 	}
 }
 
+/** compare mesh state pointers, to print the request list sorted */
+static int
+mesh_state_ptr_cmp(const void* a, const void* b)
+{
+	return mesh_state_compare(*(struct mesh_state* const*)a,
+		*(struct mesh_state* const*)b);
+}
+
 /** do the dump_requestlist command */
 static void
 do_dump_requestlist(SSL* ssl, struct worker* worker)
 {
 	struct mesh_area* mesh;
-	struct mesh_state* m;
-	int num = 0;
+	struct mesh_state* m, **list;
+	size_t num = 0, i;
 	char buf[257];
 	char timebuf[32];
 	char statbuf[10240];
@@ -2271,23 +2325,36 @@ do_dump_requestlist(SSL* ssl, struct worker* worker)
 	/* show worker mesh contents */
 	mesh = worker->env.mesh;
 	if(!mesh) return;
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
-		char* t = sldns_wire2str_type(m->s.qinfo.qtype);
-		char* c = sldns_wire2str_class(m->s.qinfo.qclass);
+	/* the states are in a hash index, sort them for the list */
+	list = (struct mesh_state**)malloc(sizeof(*list)*
+		(mesh->all->count+1));
+	if(!list) {
+		(void)ssl_printf(ssl, "error out of memory\n");
+		return;
+	}
+	HASHINDEX_FOR(m, struct mesh_state*, mesh->all)
+		list[num++] = m;
+	qsort(list, num, sizeof(*list), &mesh_state_ptr_cmp);
+	for(i=0; i<num; i++) {
+		char* t, *c;
+		m = list[i];
+		t = sldns_wire2str_type(m->s.qinfo.qtype);
+		c = sldns_wire2str_class(m->s.qinfo.qclass);
 		dname_str(m->s.qinfo.qname, buf);
 		get_mesh_age(m, timebuf, sizeof(timebuf), &worker->env);
 		get_mesh_status(mesh, m, statbuf, sizeof(statbuf));
 		if(!ssl_printf(ssl, "%3d %4s %2s %s %s %s\n", 
-			num, (t?t:"TYPE??"), (c?c:"CLASS??"), buf, timebuf,
+			(int)i, (t?t:"TYPE??"), (c?c:"CLASS??"), buf, timebuf,
 			statbuf)) {
 			free(t);
 			free(c);
+			free(list);
 			return;
 		}
-		num++;
 		free(t);
 		free(c);
 	}
+	free(list);
 }
 
 /** structure for argument data for dump infra host */
@@ -2311,30 +2378,51 @@ dump_infra_host(struct lruhash_entry* e, void* arg)
 	struct infra_key* k = (struct infra_key*)e->key;
 	struct infra_data* d = (struct infra_data*)e->data;
 	char ip_str[1024];
-	char name[257];
 	if(a->ssl_failed)
 		return;
 	addr_to_str(&k->addr, k->addrlen, ip_str, sizeof(ip_str));
-	dname_str(k->zonename, name);
 	/* skip expired stuff (only backed off) */
 	if(d->ttl < a->now) {
 		if(d->rtt.rto >= USEFUL_SERVER_TOP_TIMEOUT) {
-			if(!ssl_printf(a->ssl, "%s %s expired rto %d\n", ip_str,
-				name, d->rtt.rto))  {
+			if(!ssl_printf(a->ssl, "%s expired rto %d\n", ip_str,
+				d->rtt.rto))  {
 				a->ssl_failed = 1;
 				return;
 			}
 		}
 		return;
 	}
-	if(!ssl_printf(a->ssl, "%s %s ttl %lu ping %d var %d rtt %d rto %d "
+	if(!ssl_printf(a->ssl, "%s ttl %lu ping %d var %d rtt %d rto %d "
 		"tA %d tAAAA %d tother %d "
-		"ednsknown %d edns %d delay %d lame dnssec %d rec %d A %d "
-		"other %d\n", ip_str, name, (unsigned long)(d->ttl - a->now),
+		"ednsknown %d edns %d delay %d\n", ip_str,
+		(unsigned long)(d->ttl - a->now),
 		d->rtt.srtt, d->rtt.rttvar, rtt_notimeout(&d->rtt), d->rtt.rto,
 		d->timeout_A, d->timeout_AAAA, d->timeout_other,
 		(int)d->edns_lame_known, (int)d->edns_version,
-		(int)(a->now<d->probedelay?(d->probedelay - a->now):0),
+		(int)(a->now<d->probedelay?(d->probedelay - a->now):0))) {
+		a->ssl_failed = 1;
+		return;
+	}
+}
+
+/** callback for every lameness element in the infra cache */
+static void
+dump_infra_lame(struct lruhash_entry* e, void* arg)
+{
+	struct infra_arg* a = (struct infra_arg*)arg;
+	struct infra_lame_key* k = (struct infra_lame_key*)e->key;
+	struct infra_lame_data* d = (struct infra_lame_data*)e->data;
+	char ip_str[1024];
+	char name[257];
+	if(a->ssl_failed)
+		return;
+	/* skip expired stuff */
+	if(d->ttl < a->now)
+		return;
+	addr_to_str(&k->addr, k->addrlen, ip_str, sizeof(ip_str));
+	dname_str(k->zonename, name);
+	if(!ssl_printf(a->ssl, "%s %s lame ttl %lu dnssec %d rec %d A %d "
+		"other %d\n", ip_str, name, (unsigned long)(d->ttl - a->now),
 		(int)d->isdnsseclame, (int)d->rec_lame, (int)d->lame_type_A,
 		(int)d->lame_other)) {
 		a->ssl_failed = 1;
@@ -2352,6 +2440,7 @@ do_dump_infra(SSL* ssl, struct worker* worker)
 	arg.now = *worker->env.now;
 	arg.ssl_failed = 0;
 	slabhash_traverse(arg.infra->hosts, 0, &dump_infra_host, (void*)&arg);
+	slabhash_traverse(arg.infra->lame, 0, &dump_infra_lame, (void*)&arg);
 }
 
 /** do the log_reopen command */
@@ -2363,17 +2452,67 @@ do_log_reopen(SSL* ssl, struct worker* worker)
 	log_init(cfg->logfile, cfg->use_syslog, cfg->chrootdir);
 }
 
+/** resize the msg, rrset or key cache for a changed set_option value,
+ * the cache contents are kept. returns false on malloc failure */
+static int
+set_option_cache_size(struct worker* worker, const char* opt)
+{
+	struct config_file* cfg = worker->env.cfg;
+	struct slabhash* sl;
+	size_t slabs, size;
+	if(strncmp(opt, "msg-", 4) == 0) {
+		sl = worker->env.msg_cache;
+		slabs = cfg->msg_cache_slabs;
+		size = cfg->msg_cache_size;
+	} else if(strncmp(opt, "rrset-", 6) == 0) {
+		sl = &worker->env.rrset_cache->table;
+		slabs = cfg->rrset_cache_slabs;
+		size = cfg->rrset_cache_size;
+	} else {
+		int m = modstack_find(&worker->env.mesh->mods, "validator");
+		struct val_env* val_env = NULL;
+		if(m != -1) val_env = (struct val_env*)worker->env.modinfo[m];
+		/* the NSEC3 hashes use the slabs of the key cache */
+		if(val_env && val_env->nsec3_hcache && !slabhash_adjust(
+			val_env->nsec3_hcache, cfg->key_cache_slabs,
+			cfg->nsec3_hash_cache_size))
+			return 0;
+		/* and the parsed keys are adjusted with the key cache */
+		if(!worker->env.key_cache)
+			return 1;
+		return key_cache_adjust(worker->env.key_cache, cfg);
+	}
+	/* the other threads keep using the cache while the entries move
+	 * to the new slabs */
+	return slabhash_adjust(sl, slabs, size);
+}
+
 /** do the set_option command */
 static void
 do_set_option(SSL* ssl, struct worker* worker, char* arg)
 {
 	char* arg2;
+	int rrl_ratelimit = worker->env.cfg->rrl_ratelimit;
 	if(!find_arg2(ssl, arg, &arg2))
 		return;
+	if(strcmp(arg, "rrl-size:") == 0 || strcmp(arg, "rrl-slabs:") == 0) {
+		/* the other threads use the table, it is made on reload */
+		(void)ssl_printf(ssl, "error %s needs a reload\n", arg);
+		return;
+	}
 	if(!config_set_option(worker->env.cfg, arg, arg2)) {
 		(void)ssl_printf(ssl, "error setting option\n");
 		return;
 	}
+	if(strcmp(arg, "rrl-ratelimit:") == 0 &&
+		(worker->env.cfg->rrl_ratelimit == 0) !=
+		(worker->daemon->rrl == NULL)) {
+		/* turning it on or off makes or deletes the table */
+		worker->env.cfg->rrl_ratelimit = rrl_ratelimit;
+		(void)ssl_printf(ssl, "error %s on or off needs a reload\n",
+			arg);
+		return;
+	}
 	/* effectuate some arguments */
 	if(strcmp(arg, "val-override-date:") == 0) {
 		int m = modstack_find(&worker->env.mesh->mods, "validator");
@@ -2381,6 +2520,31 @@ do_set_option(SSL* ssl, struct worker* worker, char* arg)
 		if(m != -1) val_env = (struct val_env*)worker->env.modinfo[m];
 		if(val_env)
 			val_env->date_override = worker->env.cfg->val_date_override;
+	} else if(strcmp(arg, "hedge-percentile:") == 0 ||
+		strcmp(arg, "hedge-budget:") == 0) {
+		int m = modstack_find(&worker->env.mesh->mods, "iterator");
+		struct iter_env* ie = NULL;
+		if(m != -1) ie = (struct iter_env*)worker->env.modinfo[m];
+		if(ie) {
+			ie->hedge_percentile = worker->env.cfg->hedge_percentile;
+			ie->hedge_budget = worker->env.cfg->hedge_budget;
+		}
+	} else if(strcmp(arg, "rrl-ratelimit:") == 0 ||
+		strcmp(arg, "rrl-slip:") == 0) {
+		/* the size is the same, the table is kept and updated */
+		if(worker->daemon->rrl)
+			worker->daemon->rrl = rrl_adjust(worker->daemon->rrl,
+				worker->env.cfg);
+	} else if(strcmp(arg, "msg-cache-size:") == 0 ||
+		strcmp(arg, "msg-cache-slabs:") == 0 ||
+		strcmp(arg, "rrset-cache-size:") == 0 ||
+		strcmp(arg, "rrset-cache-slabs:") == 0 ||
+		strcmp(arg, "key-cache-size:") == 0 ||
+		strcmp(arg, "key-cache-slabs:") == 0) {
+		if(!set_option_cache_size(worker, arg)) {
+			(void)ssl_printf(ssl, "error out of memory\n");
+			return;
+		}
 	}
 	send_ok(ssl);
 }
@@ -2752,8 +2916,8 @@ execute_cmd(struct daemon_remote* rc, SSL* ssl, char* cmd,
 		do_forward(ssl, worker, skipwhite(p+7));
 		return;
 	} else if(cmdcmp(p, "flush_stats", 11)) {
-		/* must always distribute this cmd */
-		if(rc) distribute_cmd(rc, ssl, cmd);
+		/* not distributed, the counters of all threads are reset
+		 * from here */
 		do_flush_stats(ssl, worker);
 		return;
 	} else if(cmdcmp(p, "flush_requestlist", 17)) {
@@ -0,0 +1,271 @@
+/*
+ * daemon/rrl.c - response rate limiting for the unbound daemon.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the response rate limit (RRL) table.
+ */
+#include "config.h"
+#include "daemon/rrl.h"
+#include "util/config_file.h"
+#include "util/log.h"
+#include "util/net_help.h"
+#include "util/netevent.h"
+#include "util/data/dname.h"
+#include "util/storage/keyhash.h"
+#include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
+#include "sldns/rrdef.h"
+
+/** the max rate, so that the tokens of a bucket fit in 32 bits */
+#define RRL_MAX_RATE 1000000
+
+/** response classes, that are part of the key of the bucket */
+enum rrl_class {
+	/** answers and nodata, per query name and type */
+	rrl_class_answer = 1,
+	/** NXDOMAIN, per domain */
+	rrl_class_nxdomain,
+	/** errors, per rcode */
+	rrl_class_error
+};
+
+struct rrl_table*
+rrl_create(struct config_file* cfg)
+{
+	struct rrl_table* rrl = (struct rrl_table*)calloc(1, sizeof(*rrl));
+	size_t i, num;
+	if(!rrl)
+		return NULL;
+	rrl->rate = cfg->rrl_ratelimit;
+	if(rrl->rate > RRL_MAX_RATE)
+		rrl->rate = RRL_MAX_RATE;
+	rrl->slip = cfg->rrl_slip;
+	rrl->size = cfg->rrl_size;
+	rrl->num_stripes = cfg->rrl_slabs;
+	num = cfg->rrl_size / sizeof(struct rrl_entry) / RRL_SET_SIZE;
+	rrl->num_sets = num / rrl->num_stripes;
+	if(rrl->num_sets == 0)
+		rrl->num_sets = 1;
+	rrl->stripes = (struct rrl_stripe*)calloc(rrl->num_stripes,
+		sizeof(struct rrl_stripe));
+	if(!rrl->stripes) {
+		free(rrl);
+		return NULL;
+	}
+	for(i=0; i<rrl->num_stripes; i++) {
+		struct rrl_stripe* st = &rrl->stripes[i];
+		st->entries = (struct rrl_entry*)calloc(rrl->num_sets*
+			RRL_SET_SIZE, sizeof(struct rrl_entry));
+		if(!st->entries) {
+			rrl_delete(rrl);
+			return NULL;
+		}
+		lock_quick_init(&st->lock);
+		lock_protect(&st->lock, st->entries, rrl->num_sets*
+			RRL_SET_SIZE*sizeof(struct rrl_entry));
+	}
+	return rrl;
+}
+
+void
+rrl_delete(struct rrl_table* rrl)
+{
+	size_t i;
+	if(!rrl)
+		return;
+	for(i=0; i<rrl->num_stripes; i++) {
+		if(!rrl->stripes[i].entries)
+			continue;
+		lock_quick_destroy(&rrl->stripes[i].lock);
+		free(rrl->stripes[i].entries);
+	}
+	free(rrl->stripes);
+	free(rrl);
+}
+
+struct rrl_table*
+rrl_adjust(struct rrl_table* rrl, struct config_file* cfg)
+{
+	if(cfg->rrl_ratelimit == 0) {
+		rrl_delete(rrl);
+		return NULL;
+	}
+	if(rrl && rrl->size == cfg->rrl_size &&
+		rrl->num_stripes == cfg->rrl_slabs) {
+		rrl->rate = cfg->rrl_ratelimit;
+		if(rrl->rate > RRL_MAX_RATE)
+			rrl->rate = RRL_MAX_RATE;
+		rrl->slip = cfg->rrl_slip;
+		return rrl;
+	}
+	rrl_delete(rrl);
+	if(!(rrl = rrl_create(cfg)))
+		fatal_exit("malloc failure updating config settings");
+	return rrl;
+}
+
+/** length of the query name in the question of the packet, with the
+ * type and class after it, or 0 if there is no proper question */
+static size_t
+rrl_qname_len(sldns_buffer* pkt)
+{
+	uint8_t* p = sldns_buffer_begin(pkt);
+	size_t pos = LDNS_HEADER_SIZE, len = 0;
+	if(sldns_buffer_limit(pkt) < LDNS_HEADER_SIZE || LDNS_QDCOUNT(p) != 1)
+		return 0;
+	while(pos < sldns_buffer_limit(pkt)) {
+		uint8_t lab = p[pos];
+		if((lab & 0xc0))
+			return 0;
+		len += lab+1;
+		pos += lab+1;
+		if(len > LDNS_MAX_DOMAINLEN)
+			return 0;
+		if(lab == 0)
+			return (pos+4 <= sldns_buffer_limit(pkt))?len:0;
+	}
+	return 0;
+}
+
+/** hash the client network and the response class into the key */
+static uint32_t
+rrl_hash(struct comm_reply* repinfo, sldns_buffer* pkt)
+{
+	struct keyhash_state s;
+	uint8_t* p = sldns_buffer_begin(pkt);
+	size_t qlen = rrl_qname_len(pkt);
+	uint8_t cls, rcode = 0;
+	uint32_t h;
+	keyhash_init(&s);
+	if(addr_is_ip6(&repinfo->addr, repinfo->addrlen)) {
+		struct sockaddr_in6* sa = (struct sockaddr_in6*)&repinfo->addr;
+		keyhash_update(&s, &sa->sin6_family, sizeof(sa->sin6_family));
+		keyhash_update(&s, &sa->sin6_addr, RRL_PREFIX6/8);
+	} else {
+		struct sockaddr_in* sa = (struct sockaddr_in*)&repinfo->addr;
+		keyhash_update(&s, &sa->sin_family, sizeof(sa->sin_family));
+		keyhash_update(&s, &sa->sin_addr, RRL_PREFIX4/8);
+	}
+	if(sldns_buffer_limit(pkt) >= LDNS_HEADER_SIZE)
+		rcode = (uint8_t)LDNS_RCODE_WIRE(p);
+	if(qlen && rcode == LDNS_RCODE_NOERROR) {
+		uint8_t* qname = p+LDNS_HEADER_SIZE;
+		cls = rrl_class_answer;
+		keyhash_update(&s, &cls, sizeof(cls));
+		dname_query_hash_update(&s, qname);
+		keyhash_update(&s, qname+qlen, 2);
+	} else if(qlen && rcode == LDNS_RCODE_NXDOMAIN) {
+		uint8_t* zone = p+LDNS_HEADER_SIZE;
+		/* random names below a domain count for the domain */
+		if(dname_count_labels(zone) > 3)
+			zone += *zone + 1;
+		cls = rrl_class_nxdomain;
+		keyhash_update(&s, &cls, sizeof(cls));
+		dname_query_hash_update(&s, zone);
+	} else {
+		cls = rrl_class_error;
+		keyhash_update(&s, &cls, sizeof(cls));
+		keyhash_update(&s, &rcode, sizeof(rcode));
+	}
+	h = keyhash_final(&s);
+	/* 0 marks an unused entry */
+	return h?h:1;
+}
+
+enum rrl_result
+rrl_check(struct rrl_table* rrl, struct comm_reply* repinfo,
+	sldns_buffer* pkt, uint32_t now)
+{
+	uint32_t h = rrl_hash(repinfo, pkt);
+	struct rrl_stripe* st = &rrl->stripes[h & (rrl->num_stripes-1)];
+	struct rrl_entry* set, *e = NULL, *old;
+	uint64_t max = (uint64_t)rrl->rate*RRL_TOKEN, tokens;
+	enum rrl_result r = rrl_pass;
+	int i;
+	set = &st->entries[((h/rrl->num_stripes)%rrl->num_sets)*RRL_SET_SIZE];
+	lock_quick_lock(&st->lock);
+	old = &set[0];
+	for(i=0; i<RRL_SET_SIZE; i++) {
+		if(set[i].tag == h) {
+			e = &set[i];
+			break;
+		}
+		/* an unused entry, or else the least recently used one */
+		if(old->tag != 0 && (set[i].tag == 0 ||
+			now - set[i].stamp > now - old->stamp))
+			old = &set[i];
+	}
+	if(!e) {
+		/* a new bucket starts full, minus this response */
+		old->tag = h;
+		old->stamp = now;
+		old->tokens = (uint32_t)(max - RRL_TOKEN);
+		old->slip = 0;
+		lock_quick_unlock(&st->lock);
+		return rrl_pass;
+	}
+	tokens = (uint64_t)e->tokens + (uint64_t)(now - e->stamp)*rrl->rate;
+	if(tokens > max)
+		tokens = max;
+	e->stamp = now;
+	if(tokens >= RRL_TOKEN) {
+		tokens -= RRL_TOKEN;
+	} else {
+		e->slip++;
+		if(rrl->slip && e->slip % (uint32_t)rrl->slip == 0)
+			r = rrl_slip;
+		else	r = rrl_drop;
+	}
+	e->tokens = (uint32_t)tokens;
+	lock_quick_unlock(&st->lock);
+	return r;
+}
+
+void
+rrl_truncate(sldns_buffer* pkt)
+{
+	uint8_t* p = sldns_buffer_begin(pkt);
+	size_t qlen = rrl_qname_len(pkt);
+	if(sldns_buffer_limit(pkt) < LDNS_HEADER_SIZE)
+		return;
+	sldns_buffer_set_limit(pkt, LDNS_HEADER_SIZE + (qlen?qlen+4:0));
+	sldns_buffer_write_u16_at(pkt, 4, (uint16_t)(qlen?1:0));
+	sldns_buffer_write_u16_at(pkt, 6, 0); /* ancount */
+	sldns_buffer_write_u16_at(pkt, 8, 0); /* nscount */
+	sldns_buffer_write_u16_at(pkt, 10, 0); /* arcount */
+	LDNS_TC_SET(p);
+}
@@ -0,0 +1,161 @@
+/*
+ * daemon/rrl.h - response rate limiting for the unbound daemon.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the response rate limit (RRL) table. It limits the
+ * number of identical responses that are sent over UDP to a client
+ * network, so that the server is not useful for reflection attacks with
+ * spoofed source addresses. A limited response is dropped, or sometimes
+ * truncated, so that a real client can retry over TCP.
+ *
+ * The rates are token buckets, kept in a fixed size table that is split
+ * into lock stripes. Every stripe is an array of small sets of entries,
+ * a new entry replaces the least recently used one in its set.
+ */
+
+#ifndef DAEMON_RRL_H
+#define DAEMON_RRL_H
+#include "util/locks.h"
+struct config_file;
+struct comm_reply;
+struct sldns_buffer;
+
+/** prefix length of the IPv4 client network for the rate limit */
+#define RRL_PREFIX4 24
+/** prefix length of the IPv6 client network for the rate limit */
+#define RRL_PREFIX6 56
+/** number of entries in a set, the entries of a set share a cache line */
+#define RRL_SET_SIZE 4
+/** the cost of a response in tokens, the tokens are in 1/1000ths */
+#define RRL_TOKEN 1000
+
+/**
+ * An entry in the rate limit table, a token bucket for a client network
+ * and response.
+ */
+struct rrl_entry {
+	/** the hash of the client network and response, 0 if unused */
+	uint32_t tag;
+	/** the time of the last update, in msec, wraps around */
+	uint32_t stamp;
+	/** the tokens in the bucket, in 1/1000ths of a response */
+	uint32_t tokens;
+	/** number of limited responses, to select the ones that slip */
+	uint32_t slip;
+};
+
+/**
+ * A lock stripe of the table, with the sets that hash to it.
+ */
+struct rrl_stripe {
+	/** lock on the entries of this stripe */
+	lock_quick_type lock;
+	/** the entries, num_sets*RRL_SET_SIZE of them */
+	struct rrl_entry* entries;
+};
+
+/**
+ * The response rate limit table, shared by the threads.
+ */
+struct rrl_table {
+	/** the responses per second that are allowed */
+	int rate;
+	/** every nth limited response is truncated, 0 for none */
+	int slip;
+	/** the configured memory size, to see if it changed on reload */
+	size_t size;
+	/** number of stripes, a power of 2 */
+	size_t num_stripes;
+	/** number of sets in a stripe */
+	size_t num_sets;
+	/** the stripes */
+	struct rrl_stripe* stripes;
+};
+
+/** result of the rate limit check of a response */
+enum rrl_result {
+	/** the response can be sent */
+	rrl_pass = 0,
+	/** the response is over the limit, send it truncated */
+	rrl_slip,
+	/** the response is over the limit, drop it */
+	rrl_drop
+};
+
+/**
+ * Create the rate limit table.
+ * @param cfg: config with the rate, slip, size and stripes.
+ * @return new table or NULL on failure (out of memory).
+ */
+struct rrl_table* rrl_create(struct config_file* cfg);
+
+/**
+ * Delete the rate limit table.
+ * @param rrl: the table to delete, or NULL.
+ */
+void rrl_delete(struct rrl_table* rrl);
+
+/**
+ * Apply the config after a reload, the table is kept if its size did
+ * not change, the rate and slip are updated.
+ * @param rrl: the table or NULL.
+ * @param cfg: the config.
+ * @return the table, NULL if the rate limit is off, the old table is
+ *	deleted if it is not used. Exits on out of memory.
+ */
+struct rrl_table* rrl_adjust(struct rrl_table* rrl, struct config_file* cfg);
+
+/**
+ * Check a response that is going to be sent over UDP.
+ * @param rrl: the table.
+ * @param repinfo: the reply info, with the client address.
+ * @param pkt: the response packet, the question section is used for the
+ *	response name.
+ * @param now: the time in msec.
+ * @return pass, slip or drop.
+ */
+enum rrl_result rrl_check(struct rrl_table* rrl, struct comm_reply* repinfo,
+	struct sldns_buffer* pkt, uint32_t now);
+
+/**
+ * Turn the response into a truncated reply, with the header and question
+ * only, and the TC flag set.
+ * @param pkt: the response packet.
+ */
+void rrl_truncate(struct sldns_buffer* pkt);
+
+#endif /* DAEMON_RRL_H */
@@ -52,7 +52,6 @@
 #include "services/outside_network.h"
 #include "services/listen_dnsport.h"
 #include "util/config_file.h"
-#include "util/tube.h"
 #include "util/timehist.h"
 #include "util/net_help.h"
 #include "validator/validator.h"
@@ -75,27 +74,71 @@ timeval_add(struct timeval* d, const struct timeval* add)
 #endif
 }
 
+/** subtract timers and the values do not overflow or become negative */
+static void
+timeval_subtract(struct timeval* d, const struct timeval* end,
+	const struct timeval* start)
+{
+#ifndef S_SPLINT_S
+	time_t end_usec = end->tv_usec;
+	d->tv_sec = end->tv_sec - start->tv_sec;
+	if(end_usec < start->tv_usec) {
+		end_usec += 1000000;
+		d->tv_sec--;
+	}
+	d->tv_usec = end_usec - start->tv_usec;
+#endif
+}
+
+/** compare of time values, true if x is smaller than y */
+static int
+timeval_smaller(const struct timeval* x, const struct timeval* y)
+{
+#ifndef S_SPLINT_S
+	if(x->tv_sec < y->tv_sec)
+		return 1;
+	else if(x->tv_sec == y->tv_sec) {
+		if(x->tv_usec < y->tv_usec)
+			return 1;
+		else	return 0;
+	}
+	else	return 0;
+#endif
+}
+
 void server_stats_init(struct server_stats* stats, struct config_file* cfg)
 {
 	memset(stats, 0, sizeof(*stats));
 	stats->extended = cfg->stat_extended;
 }
 
+/** up the max query list size, it starts again after a reset of the
+ * statistics by the thread that reads them */
+static void
+stats_max_query_list(struct server_stats* stats, struct worker* worker)
+{
+	size_t num = ub_load_relaxed(&worker->stats_base_num);
+	if(num != worker->stats_max_num) {
+		worker->stats_max_num = num;
+		stats->max_query_list_size = 0;
+	}
+	if(worker->env.mesh->all->count > stats->max_query_list_size)
+		stats->max_query_list_size = worker->env.mesh->all->count;
+}
+
 void server_stats_querymiss(struct server_stats* stats, struct worker* worker)
 {
 	stats->num_queries_missed_cache++;
-	stats->sum_query_list_size += worker->env.mesh->all.count;
-	if(worker->env.mesh->all.count > stats->max_query_list_size)
-		stats->max_query_list_size = worker->env.mesh->all.count;
+	stats->sum_query_list_size += worker->env.mesh->all->count;
+	stats_max_query_list(stats, worker);
 }
 
 void server_stats_prefetch(struct server_stats* stats, struct worker* worker)
 {
 	stats->num_queries_prefetch++;
 	/* changes the query list size so account that, like a querymiss */
-	stats->sum_query_list_size += worker->env.mesh->all.count;
-	if(worker->env.mesh->all.count > stats->max_query_list_size)
-		stats->max_query_list_size = worker->env.mesh->all.count;
+	stats->sum_query_list_size += worker->env.mesh->all->count;
+	stats_max_query_list(stats, worker);
 }
 
 void server_stats_log(struct server_stats* stats, struct worker* worker,
@@ -139,33 +182,246 @@ get_rrset_bogus(struct worker* worker)
 	return r;
 }
 
-void
-server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
+/** read a counter that the worker writes in another thread */
+#define STATS_LOAD(x) ub_load_relaxed(&(x))
+
+/** read the array of n counters from src into dest */
+static void
+stats_load_array(size_t* dest, size_t* src, int n)
 {
 	int i;
-	struct listen_list* lp;
+	for(i=0; i<n; i++)
+		dest[i] = STATS_LOAD(src[i]);
+}
+
+/** read the counters of the server_stats of a worker into d */
+static void
+stats_read_svr(struct server_stats* d, struct server_stats* w)
+{
+	memset(d, 0, sizeof(*d));
+	d->num_queries = STATS_LOAD(w->num_queries);
+	d->num_queries_ip_ratelimited = STATS_LOAD(
+		w->num_queries_ip_ratelimited);
+	d->rrl_dropped = STATS_LOAD(w->rrl_dropped);
+	d->rrl_slipped = STATS_LOAD(w->rrl_slipped);
+	d->num_queries_missed_cache = STATS_LOAD(w->num_queries_missed_cache);
+	d->num_queries_prefetch = STATS_LOAD(w->num_queries_prefetch);
+	d->num_hedge_sent = STATS_LOAD(w->num_hedge_sent);
+	d->num_hedge_won = STATS_LOAD(w->num_hedge_won);
+	d->sum_query_list_size = STATS_LOAD(w->sum_query_list_size);
+	d->max_query_list_size = STATS_LOAD(w->max_query_list_size);
+	/* set from the config, when the worker clears */
+	d->extended = STATS_LOAD(w->extended);
+	stats_load_array(d->qtype, w->qtype, STATS_QTYPE_NUM);
+	d->qtype_big = STATS_LOAD(w->qtype_big);
+	stats_load_array(d->qclass, w->qclass, STATS_QCLASS_NUM);
+	d->qclass_big = STATS_LOAD(w->qclass_big);
+	stats_load_array(d->qopcode, w->qopcode, STATS_OPCODE_NUM);
+	d->qtcp = STATS_LOAD(w->qtcp);
+	d->qipv6 = STATS_LOAD(w->qipv6);
+	d->qbit_QR = STATS_LOAD(w->qbit_QR);
+	d->qbit_AA = STATS_LOAD(w->qbit_AA);
+	d->qbit_TC = STATS_LOAD(w->qbit_TC);
+	d->qbit_RD = STATS_LOAD(w->qbit_RD);
+	d->qbit_RA = STATS_LOAD(w->qbit_RA);
+	d->qbit_Z = STATS_LOAD(w->qbit_Z);
+	d->qbit_AD = STATS_LOAD(w->qbit_AD);
+	d->qbit_CD = STATS_LOAD(w->qbit_CD);
+	d->qEDNS = STATS_LOAD(w->qEDNS);
+	d->qEDNS_DO = STATS_LOAD(w->qEDNS_DO);
+	stats_load_array(d->ans_rcode, w->ans_rcode, STATS_RCODE_NUM);
+	d->ans_rcode_nodata = STATS_LOAD(w->ans_rcode_nodata);
+	d->ans_secure = STATS_LOAD(w->ans_secure);
+	d->ans_bogus = STATS_LOAD(w->ans_bogus);
+	d->unwanted_queries = STATS_LOAD(w->unwanted_queries);
+	d->zero_ttl_responses = STATS_LOAD(w->zero_ttl_responses);
+}
+
+/** read the counters of the worker into s. The worker may be running in
+ * another thread, its counters are read with relaxed atomic loads, so
+ * every value is read whole but the block is not one atomic snapshot,
+ * stats_read_gen checks that the worker did not clear them meanwhile. */
+static void
+stats_read(struct worker* worker, struct stats_info* s)
+{
+	struct mesh_area* mesh = worker->env.mesh;
+	size_t a[16];
+	int i;
 
-	s->svr = worker->stats;
-	s->mesh_num_states = worker->env.mesh->all.count;
-	s->mesh_num_reply_states = worker->env.mesh->num_reply_states;
-	s->mesh_jostled = worker->env.mesh->stats_jostled;
-	s->mesh_dropped = worker->env.mesh->stats_dropped;
-	s->mesh_replies_sent = worker->env.mesh->replies_sent;
-	s->mesh_replies_sum_wait = worker->env.mesh->replies_sum_wait;
-	s->mesh_time_median = timehist_quartile(worker->env.mesh->histogram,
-		0.50);
+	stats_read_svr(&s->svr, &worker->stats);
+	/* the maximum of a reset that the worker has not seen yet is not
+	 * set yet, no query has been added to the list since the reset */
+	if(worker->stats_base_set && STATS_LOAD(worker->stats_max_num) !=
+		worker->stats_base_num)
+		s->svr.max_query_list_size = 0;
+	s->mesh_num_states = STATS_LOAD(mesh->all->count);
+	s->mesh_num_reply_states = STATS_LOAD(mesh->num_reply_states);
+	s->mesh_jostled = STATS_LOAD(mesh->stats_jostled);
+	s->mesh_dropped = STATS_LOAD(mesh->stats_dropped);
+	s->mesh_adm_client = STATS_LOAD(mesh->stats_adm_client);
+	s->mesh_adm_zone = STATS_LOAD(mesh->stats_adm_zone);
+	s->mesh_adm_evicted = STATS_LOAD(mesh->stats_adm_evicted);
+	s->mesh_adm_prefetch = STATS_LOAD(mesh->stats_adm_prefetch);
+	s->mesh_replies_sent = STATS_LOAD(mesh->replies_sent);
+	s->mesh_replies_sum_wait.tv_sec = STATS_LOAD(
+		mesh->replies_sum_wait.tv_sec);
+	s->mesh_replies_sum_wait.tv_usec = STATS_LOAD(
+		mesh->replies_sum_wait.tv_usec);
+	s->mesh_time_median = 0;
 
 	/* add in the values from the mesh */
-	s->svr.ans_secure += worker->env.mesh->ans_secure;
-	s->svr.ans_bogus += worker->env.mesh->ans_bogus;
-	s->svr.ans_rcode_nodata += worker->env.mesh->ans_nodata;
+	s->svr.ans_secure += STATS_LOAD(mesh->ans_secure);
+	s->svr.ans_bogus += STATS_LOAD(mesh->ans_bogus);
+	s->svr.ans_rcode_nodata += STATS_LOAD(mesh->ans_nodata);
+	s->svr.num_hedge_sent += STATS_LOAD(mesh->num_hedge_sent);
+	s->svr.num_hedge_won += STATS_LOAD(mesh->num_hedge_won);
+	stats_load_array(a, mesh->ans_rcode, 16);
 	for(i=0; i<16; i++)
-		s->svr.ans_rcode[i] += worker->env.mesh->ans_rcode[i];
-	timehist_export(worker->env.mesh->histogram, s->svr.hist, 
-		NUM_BUCKETS_HIST);
+		s->svr.ans_rcode[i] += a[i];
+	timehist_export(mesh->histogram, s->svr.hist, NUM_BUCKETS_HIST);
 	/* values from outside network */
-	s->svr.unwanted_replies = worker->back->unwanted_replies;
-	s->svr.qtcp_outgoing = worker->back->num_tcp_outgoing;
+	s->svr.unwanted_replies = STATS_LOAD(worker->back->unwanted_replies);
+	s->svr.num_udppool_opened = STATS_LOAD(
+		worker->back->num_udppool_opened);
+	s->svr.num_udppool_rotated = STATS_LOAD(
+		worker->back->num_udppool_rotated);
+	s->svr.qtcp_outgoing = STATS_LOAD(worker->back->num_tcp_outgoing);
+}
+
+/** subtract counter, if the counter went down, because the worker has
+ * cleared it, the base is stale and the counter is used as is */
+#define STATS_SUB(x, b) ((x) = ((x) >= (b))?(x)-(b):(x))
+
+/** subtract the base values from the counters in s, the gauges (like
+ * the cache counts and the number of mesh states) are not changed */
+static void
+stats_subtract(struct stats_info* s, struct stats_info* b)
+{
+	int i;
+	STATS_SUB(s->svr.num_queries, b->svr.num_queries);
+	STATS_SUB(s->svr.num_queries_ip_ratelimited,
+		b->svr.num_queries_ip_ratelimited);
+	STATS_SUB(s->svr.rrl_dropped, b->svr.rrl_dropped);
+	STATS_SUB(s->svr.rrl_slipped, b->svr.rrl_slipped);
+	STATS_SUB(s->svr.num_queries_missed_cache,
+		b->svr.num_queries_missed_cache);
+	STATS_SUB(s->svr.num_queries_prefetch, b->svr.num_queries_prefetch);
+	STATS_SUB(s->svr.num_hedge_sent, b->svr.num_hedge_sent);
+	STATS_SUB(s->svr.num_hedge_won, b->svr.num_hedge_won);
+	STATS_SUB(s->svr.num_udppool_opened, b->svr.num_udppool_opened);
+	STATS_SUB(s->svr.num_udppool_rotated, b->svr.num_udppool_rotated);
+	STATS_SUB(s->svr.sum_query_list_size, b->svr.sum_query_list_size);
+	STATS_SUB(s->svr.qtype_big, b->svr.qtype_big);
+	STATS_SUB(s->svr.qclass_big, b->svr.qclass_big);
+	STATS_SUB(s->svr.qtcp, b->svr.qtcp);
+	STATS_SUB(s->svr.qtcp_outgoing, b->svr.qtcp_outgoing);
+	STATS_SUB(s->svr.qipv6, b->svr.qipv6);
+	STATS_SUB(s->svr.qbit_QR, b->svr.qbit_QR);
+	STATS_SUB(s->svr.qbit_AA, b->svr.qbit_AA);
+	STATS_SUB(s->svr.qbit_TC, b->svr.qbit_TC);
+	STATS_SUB(s->svr.qbit_RD, b->svr.qbit_RD);
+	STATS_SUB(s->svr.qbit_RA, b->svr.qbit_RA);
+	STATS_SUB(s->svr.qbit_Z, b->svr.qbit_Z);
+	STATS_SUB(s->svr.qbit_AD, b->svr.qbit_AD);
+	STATS_SUB(s->svr.qbit_CD, b->svr.qbit_CD);
+	STATS_SUB(s->svr.qEDNS, b->svr.qEDNS);
+	STATS_SUB(s->svr.qEDNS_DO, b->svr.qEDNS_DO);
+	STATS_SUB(s->svr.ans_rcode_nodata, b->svr.ans_rcode_nodata);
+	STATS_SUB(s->svr.ans_secure, b->svr.ans_secure);
+	STATS_SUB(s->svr.ans_bogus, b->svr.ans_bogus);
+	STATS_SUB(s->svr.unwanted_replies, b->svr.unwanted_replies);
+	STATS_SUB(s->svr.unwanted_queries, b->svr.unwanted_queries);
+	STATS_SUB(s->svr.zero_ttl_responses, b->svr.zero_ttl_responses);
+	for(i=0; i<STATS_QTYPE_NUM; i++)
+		STATS_SUB(s->svr.qtype[i], b->svr.qtype[i]);
+	for(i=0; i<STATS_QCLASS_NUM; i++)
+		STATS_SUB(s->svr.qclass[i], b->svr.qclass[i]);
+	for(i=0; i<STATS_OPCODE_NUM; i++)
+		STATS_SUB(s->svr.qopcode[i], b->svr.qopcode[i]);
+	for(i=0; i<STATS_RCODE_NUM; i++)
+		STATS_SUB(s->svr.ans_rcode[i], b->svr.ans_rcode[i]);
+	for(i=0; i<NUM_BUCKETS_HIST; i++)
+		STATS_SUB(s->svr.hist[i], b->svr.hist[i]);
+	STATS_SUB(s->mesh_jostled, b->mesh_jostled);
+	STATS_SUB(s->mesh_dropped, b->mesh_dropped);
+	STATS_SUB(s->mesh_adm_client, b->mesh_adm_client);
+	STATS_SUB(s->mesh_adm_zone, b->mesh_adm_zone);
+	STATS_SUB(s->mesh_adm_evicted, b->mesh_adm_evicted);
+	STATS_SUB(s->mesh_adm_prefetch, b->mesh_adm_prefetch);
+	STATS_SUB(s->mesh_replies_sent, b->mesh_replies_sent);
+	if(!timeval_smaller(&s->mesh_replies_sum_wait,
+		&b->mesh_replies_sum_wait))
+		timeval_subtract(&s->mesh_replies_sum_wait,
+			&s->mesh_replies_sum_wait, &b->mesh_replies_sum_wait);
+}
+
+/** median of the histogram counts in hist, that has the buckets of the
+ * mesh histogram of the worker */
+static double
+stats_hist_median(struct worker* worker, size_t* hist)
+{
+	struct th_buck buckets[NUM_BUCKETS_HIST];
+	struct timehist th;
+	struct timehist* mh = worker->env.mesh->histogram;
+	size_t i;
+	th.num = (mh->num < NUM_BUCKETS_HIST)?mh->num:NUM_BUCKETS_HIST;
+	th.buckets = buckets;
+	/* the bucket bounds do not change after the setup */
+	for(i=0; i<th.num; i++)
+		buckets[i] = mh->buckets[i];
+	timehist_import(&th, hist, th.num);
+	return timehist_quartile(&th, 0.50);
+}
+
+/** read the worker counters, and retry if the worker cleared its
+ * counters during the read.
+ * @param worker: worker to read.
+ * @param s: counters are returned here.
+ * @return the clear generation of the worker that the values are from. */
+static size_t
+stats_read_gen(struct worker* worker, struct stats_info* s)
+{
+	size_t gen;
+	int tries = 0;
+	do {
+		gen = ub_load_acquire(&worker->stats_clear_gen);
+		stats_read(worker, s);
+		/* odd while the worker is clearing its counters */
+	} while(((gen&1) || gen != worker->stats_clear_gen) &&
+		++tries < STATS_READ_RETRY);
+	return gen;
+}
+
+/** set the reset point of the statistics of the worker to cur */
+static void
+stats_set_base(struct worker* worker, struct stats_info* cur, size_t gen)
+{
+	worker->stats_base = *cur;
+	worker->stats_base_gen = gen;
+	worker->stats_base_set = 1;
+	/* the worker starts the maximum again when it sees the new number,
+	 * the counters of the worker are not written by this thread */
+	ub_store_release(&worker->stats_base_num,
+		worker->stats_base_num+1);
+}
+
+void
+server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
+{
+	struct stats_info cur;
+	struct listen_list* lp;
+	size_t gen;
+
+	if(!worker->env.mesh) {
+		/* the thread is starting up, and has no counters yet */
+		memset(s, 0, sizeof(*s));
+		return;
+	}
+	gen = stats_read_gen(worker, &cur);
+	*s = cur;
+	if(worker->stats_base_set && worker->stats_base_gen == gen)
+		stats_subtract(s, &worker->stats_base);
+	s->mesh_time_median = stats_hist_median(worker, s->svr.hist);
 
 	/* get and reset validator rrset bogus number */
 	s->svr.rrset_bogus = get_rrset_bogus(worker);
@@ -173,7 +429,8 @@ server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 	/* get cache sizes */
 	s->svr.msg_cache_count = count_slabhash_entries(worker->env.msg_cache);
 	s->svr.rrset_cache_count = count_slabhash_entries(&worker->env.rrset_cache->table);
-	s->svr.infra_cache_count = count_slabhash_entries(worker->env.infra_cache->hosts);
+	s->svr.infra_cache_count = count_slabhash_entries(worker->env.infra_cache->hosts)
+		+ count_slabhash_entries(worker->env.infra_cache->lame);
 	if(worker->env.key_cache)
 		s->svr.key_cache_count = count_slabhash_entries(worker->env.key_cache->slab);
 	else	s->svr.key_cache_count = 0;
@@ -186,51 +443,32 @@ server_stats_compile(struct worker* worker, struct stats_info* s, int reset)
 	}
 
 	if(reset && !worker->env.cfg->stat_cumulative) {
-		worker_stats_clear(worker);
+		stats_set_base(worker, &cur, gen);
 	}
 }
 
-void server_stats_obtain(struct worker* worker, struct worker* who,
-	struct stats_info* s, int reset)
+void server_stats_flush(struct worker* worker)
 {
-	uint8_t *reply = NULL;
-	uint32_t len = 0;
-	if(worker == who) {
-		/* just fill it in */
-		server_stats_compile(worker, s, reset);
+	struct stats_info cur;
+	size_t gen;
+	if(!worker->env.mesh)
 		return;
-	}
-	/* communicate over tube */
-	verbose(VERB_ALGO, "write stats cmd");
-	if(reset)
-		worker_send_cmd(who, worker_cmd_stats);
-	else 	worker_send_cmd(who, worker_cmd_stats_noreset);
-	verbose(VERB_ALGO, "wait for stats reply");
-	if(!tube_read_msg(worker->cmd, &reply, &len, 0))
-		fatal_exit("failed to read stats over cmd channel");
-	if(len != (uint32_t)sizeof(*s))
-		fatal_exit("stats on cmd channel wrong length %d %d",
-			(int)len, (int)sizeof(*s));
-	memcpy(s, reply, (size_t)len);
-	free(reply);
-}
-
-void server_stats_reply(struct worker* worker, int reset)
-{
-	struct stats_info s;
-	server_stats_compile(worker, &s, reset);
-	verbose(VERB_ALGO, "write stats replymsg");
-	if(!tube_write_msg(worker->daemon->workers[0]->cmd, 
-		(uint8_t*)&s, sizeof(s), 0))
-		fatal_exit("could not write stat values over cmd channel");
+	gen = stats_read_gen(worker, &cur);
+	stats_set_base(worker, &cur, gen);
 }
 
 void server_stats_add(struct stats_info* total, struct stats_info* a)
 {
 	total->svr.num_queries += a->svr.num_queries;
 	total->svr.num_queries_ip_ratelimited += a->svr.num_queries_ip_ratelimited;
+	total->svr.rrl_dropped += a->svr.rrl_dropped;
+	total->svr.rrl_slipped += a->svr.rrl_slipped;
 	total->svr.num_queries_missed_cache += a->svr.num_queries_missed_cache;
 	total->svr.num_queries_prefetch += a->svr.num_queries_prefetch;
+	total->svr.num_hedge_sent += a->svr.num_hedge_sent;
+	total->svr.num_hedge_won += a->svr.num_hedge_won;
+	total->svr.num_udppool_opened += a->svr.num_udppool_opened;
+	total->svr.num_udppool_rotated += a->svr.num_udppool_rotated;
 	total->svr.sum_query_list_size += a->svr.sum_query_list_size;
 	/* the max size reached is upped to higher of both */
 	if(a->svr.max_query_list_size > total->svr.max_query_list_size)
@@ -277,6 +515,10 @@ void server_stats_add(struct stats_info* total, struct stats_info* a)
 	total->mesh_num_reply_states += a->mesh_num_reply_states;
 	total->mesh_jostled += a->mesh_jostled;
 	total->mesh_dropped += a->mesh_dropped;
+	total->mesh_adm_client += a->mesh_adm_client;
+	total->mesh_adm_zone += a->mesh_adm_zone;
+	total->mesh_adm_evicted += a->mesh_adm_evicted;
+	total->mesh_adm_prefetch += a->mesh_adm_prefetch;
 	total->mesh_replies_sent += a->mesh_replies_sent;
 	timeval_add(&total->mesh_replies_sum_wait, &a->mesh_replies_sum_wait);
 	/* the medians are averaged together, this is not as accurate as
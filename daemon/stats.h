@@ -58,6 +58,11 @@ struct sldns_buffer;
 #define STATS_RCODE_NUM 16
 /** number of opcodes in stats */
 #define STATS_OPCODE_NUM 16
+/** size of a cache line, the per thread counters are padded to it */
+#define STATS_CACHE_LINE 64
+/** number of times a read of the counters is tried again, when the worker
+ * clears its counters during the read */
+#define STATS_READ_RETRY 4
 
 /** per worker statistics */
 struct server_stats {
@@ -65,10 +70,22 @@ struct server_stats {
 	size_t num_queries;
 	/** number of queries that have been dropped/ratelimited by ip. */
 	size_t num_queries_ip_ratelimited;
+	/** number of replies dropped by the response rate limit */
+	size_t rrl_dropped;
+	/** number of replies truncated by the response rate limit */
+	size_t rrl_slipped;
 	/** number of queries that had a cache-miss. */
 	size_t num_queries_missed_cache;
 	/** number of prefetch queries - cachehits with prefetch */
 	size_t num_queries_prefetch;
+	/** number of hedged queries sent to another server */
+	size_t num_hedge_sent;
+	/** number of hedged queries that were answered first */
+	size_t num_hedge_won;
+	/** number of sockets opened for the outgoing UDP pool */
+	size_t num_udppool_opened;
+	/** number of outgoing UDP pool sockets rotated to a new port */
+	size_t num_udppool_rotated;
 
 	/**
 	 * Sum of the querylistsize of the worker for 
@@ -152,8 +169,8 @@ struct server_stats {
 };
 
 /** 
- * Statistics to send over the control pipe when asked
- * This struct is made to be memcpied, sent in binary.
+ * Statistics of a thread, as compiled from its counters when asked.
+ * This struct is made to be memcpied, it is copied into shared memory.
  */
 struct stats_info {
 	/** the thread stats */
@@ -167,6 +184,14 @@ struct stats_info {
 	size_t mesh_jostled;
 	/** mesh stats: number of incoming queries dropped */
 	size_t mesh_dropped;
+	/** mesh stats: queries dropped because of the client quota */
+	size_t mesh_adm_client;
+	/** mesh stats: queries dropped because of the zone quota */
+	size_t mesh_adm_zone;
+	/** mesh stats: reply states evicted for a less busy client */
+	size_t mesh_adm_evicted;
+	/** mesh stats: prefetches dropped because the list was full */
+	size_t mesh_adm_prefetch;
 	/** mesh stats: replies sent */
 	size_t mesh_replies_sent;
 	/** mesh stats: sum of waiting times for the replies */
@@ -193,19 +218,14 @@ void server_stats_log(struct server_stats* stats, struct worker* worker,
 	int threadnum);
 
 /**
- * Obtain the stats info for a given thread. Uses pipe to communicate.
- * @param worker: the worker that is executing (the first worker).
- * @param who: on who to get the statistics info.
- * @param s: the stats block to fill in.
- * @param reset: if stats can be reset.
- */
-void server_stats_obtain(struct worker* worker, struct worker* who,
-	struct stats_info* s, int reset);
-
-/**
- * Compile stats into structure for this thread worker.
- * Also clears the statistics counters (if that is set by config file).
- * @param worker: the worker to compile stats for, also the executing worker.
+ * Compile stats into structure for a thread worker.
+ * The counters of the worker are read directly, this can be called from
+ * another thread than the one that runs the worker, and the worker does
+ * not need to do anything for it.
+ * Also resets the statistics (if that is set by config file), by storing
+ * the current values as the point that the next read starts from.
+ * Resets are done by one thread only, the remote control (first) thread.
+ * @param worker: the worker to compile stats for.
  * @param s: stats block.
  * @param reset: if true, depending on config stats are reset.
  * 	if false, statistics are not reset.
@@ -214,12 +234,12 @@ void server_stats_compile(struct worker* worker, struct stats_info* s,
 	int reset);
 
 /**
- * Send stats over comm tube in reply to query cmd
- * @param worker: this worker.
- * @param reset: if true, depending on config stats are reset.
- * 	if false, statistics are not reset.
+ * Reset the statistics of the worker to zero, regardless of the config.
+ * Like the reset of server_stats_compile, this does not need the worker
+ * to do anything, and is done from the remote control thread.
+ * @param worker: the worker whose statistics are reset.
  */
-void server_stats_reply(struct worker* worker, int reset);
+void server_stats_flush(struct worker* worker);
 
 /**
  * Addup stat blocks.
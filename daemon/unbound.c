@@ -268,6 +268,15 @@ apply_settings(struct daemon* daemon, struct config_file* cfg,
 	if (cfg->use_systemd && cfg->do_daemonize) {
 		log_warn("use-systemd and do-daemonize should not be enabled at the same time");
 	}
+	/* queries get the source ports of the pool, a small pool makes
+	 * spoofed answers easier to get right */
+	if(cfg->outgoing_udp_pool > 0 && (size_t)cfg->outgoing_udp_pool*8 <
+		(size_t)cfg->outgoing_num_ports) {
+		log_warn("outgoing-udp-pool: %d is less than an eighth of "
+			"outgoing-range: %d, the source ports of the queries "
+			"have less randomness", cfg->outgoing_udp_pool,
+			cfg->outgoing_num_ports);
+	}
 
 	log_ident_set_fromdefault(cfg, log_default_identity);
 }
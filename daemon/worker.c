@@ -46,7 +46,9 @@
 #include "daemon/worker.h"
 #include "daemon/daemon.h"
 #include "daemon/remote.h"
+#include "daemon/metrics.h"
 #include "daemon/acl_list.h"
+#include "daemon/rrl.h"
 #include "util/netevent.h"
 #include "util/config_file.h"
 #include "util/module.h"
@@ -65,6 +67,7 @@
 #include "util/data/dname.h"
 #include "util/fptr_wlist.h"
 #include "util/tube.h"
+#include "util/querylog.h"
 #include "iterator/iter_fwd.h"
 #include "iterator/iter_hints.h"
 #include "validator/autotrust.h"
@@ -84,8 +87,6 @@
 #include "winrc/win_svc.h"
 #endif
 
-/** Size of an UDP datagram */
-#define NORMAL_UDP_SIZE	512 /* bytes */
 /** ratelimit for error responses */
 #define ERROR_RATELIMIT 100 /* qps */
 
@@ -272,60 +273,6 @@ worker_err_ratelimit(struct worker* worker, int err)
 	return err;
 }
 
-/** check request sanity.
- * @param pkt: the wire packet to examine for sanity.
- * @param worker: parameters for checking.
- * @return error code, 0 OK, or -1 discard.
-*/
-static int 
-worker_check_request(sldns_buffer* pkt, struct worker* worker)
-{
-	if(sldns_buffer_limit(pkt) < LDNS_HEADER_SIZE) {
-		verbose(VERB_QUERY, "request too short, discarded");
-		return -1;
-	}
-	if(sldns_buffer_limit(pkt) > NORMAL_UDP_SIZE && 
-		worker->daemon->cfg->harden_large_queries) {
-		verbose(VERB_QUERY, "request too large, discarded");
-		return -1;
-	}
-	if(LDNS_QR_WIRE(sldns_buffer_begin(pkt))) {
-		verbose(VERB_QUERY, "request has QR bit on, discarded");
-		return -1;
-	}
-	if(LDNS_TC_WIRE(sldns_buffer_begin(pkt))) {
-		LDNS_TC_CLR(sldns_buffer_begin(pkt));
-		verbose(VERB_QUERY, "request bad, has TC bit on");
-		return worker_err_ratelimit(worker, LDNS_RCODE_FORMERR);
-	}
-	if(LDNS_OPCODE_WIRE(sldns_buffer_begin(pkt)) != LDNS_PACKET_QUERY) {
-		verbose(VERB_QUERY, "request unknown opcode %d", 
-			LDNS_OPCODE_WIRE(sldns_buffer_begin(pkt)));
-		return worker_err_ratelimit(worker, LDNS_RCODE_NOTIMPL);
-	}
-	if(LDNS_QDCOUNT(sldns_buffer_begin(pkt)) != 1) {
-		verbose(VERB_QUERY, "request wrong nr qd=%d", 
-			LDNS_QDCOUNT(sldns_buffer_begin(pkt)));
-		return worker_err_ratelimit(worker, LDNS_RCODE_FORMERR);
-	}
-	if(LDNS_ANCOUNT(sldns_buffer_begin(pkt)) != 0) {
-		verbose(VERB_QUERY, "request wrong nr an=%d", 
-			LDNS_ANCOUNT(sldns_buffer_begin(pkt)));
-		return worker_err_ratelimit(worker, LDNS_RCODE_FORMERR);
-	}
-	if(LDNS_NSCOUNT(sldns_buffer_begin(pkt)) != 0) {
-		verbose(VERB_QUERY, "request wrong nr ns=%d", 
-			LDNS_NSCOUNT(sldns_buffer_begin(pkt)));
-		return worker_err_ratelimit(worker, LDNS_RCODE_FORMERR);
-	}
-	if(LDNS_ARCOUNT(sldns_buffer_begin(pkt)) > 1) {
-		verbose(VERB_QUERY, "request wrong nr ar=%d", 
-			LDNS_ARCOUNT(sldns_buffer_begin(pkt)));
-		return worker_err_ratelimit(worker, LDNS_RCODE_FORMERR);
-	}
-	return 0;
-}
-
 void 
 worker_handle_control_cmd(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
 	size_t len, int error, void* arg)
@@ -349,14 +296,6 @@ worker_handle_control_cmd(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
 		verbose(VERB_ALGO, "got control cmd quit");
 		comm_base_exit(worker->base);
 		break;
-	case worker_cmd_stats:
-		verbose(VERB_ALGO, "got control cmd stats");
-		server_stats_reply(worker, 1);
-		break;
-	case worker_cmd_stats_noreset:
-		verbose(VERB_ALGO, "got control cmd stats_noreset");
-		server_stats_reply(worker, 0);
-		break;
 	case worker_cmd_remote:
 		verbose(VERB_ALGO, "got control cmd remote");
 		daemon_remote_exec(worker);
@@ -621,6 +560,36 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 	return 1;
 }
 
+/**
+ * Check the response rate limit for a reply over UDP.
+ * @param worker: the worker.
+ * @param repinfo: reply info, the reply is in its commpoint buffer.
+ * @return false if the reply must be dropped. The reply may have been
+ *	changed into a truncated reply.
+ */
+static int
+worker_rrl_allow(struct worker* worker, struct comm_reply* repinfo)
+{
+	struct rrl_table* rrl = worker->daemon->rrl;
+	uint32_t now;
+	if(!rrl || repinfo->c->type != comm_udp)
+		return 1;
+	now = (uint32_t)(worker->env.now_tv->tv_sec*1000 +
+		worker->env.now_tv->tv_usec/1000);
+	switch(rrl_check(rrl, repinfo, repinfo->c->buffer, now)) {
+	case rrl_slip:
+		rrl_truncate(repinfo->c->buffer);
+		worker->stats.rrl_slipped++;
+		return 1;
+	case rrl_drop:
+		worker->stats.rrl_dropped++;
+		return 0;
+	case rrl_pass:
+	default:
+		return 1;
+	}
+}
+
 /** Reply to client and perform prefetch to keep cache up to date */
 static void
 reply_and_prefetch(struct worker* worker, struct query_info* qinfo, 
@@ -628,7 +597,9 @@ reply_and_prefetch(struct worker* worker, struct query_info* qinfo,
 {
 	/* first send answer to client to keep its latency 
 	 * as small as a cachereply */
-	comm_point_send_reply(repinfo);
+	if(worker_rrl_allow(worker, repinfo))
+		comm_point_send_reply(repinfo);
+	else	comm_point_drop_reply(repinfo);
 	server_stats_prefetch(&worker->stats, worker);
 	
 	/* create the prefetch in the mesh as a normal lookup without
@@ -738,6 +709,8 @@ deny_refuse(struct comm_point* c, enum acl_access acl,
 	enum acl_access deny, enum acl_access refuse,
 	struct worker* worker, struct comm_reply* repinfo)
 {
+	enum query_decode_status qs;
+	int rcode = 0;
 	if(acl == deny) {
 		comm_point_drop_reply(repinfo);
 		if(worker->stats.extended)
@@ -749,7 +722,10 @@ deny_refuse(struct comm_point* c, enum acl_access acl,
 		log_buf(VERB_ALGO, "refuse", c->buffer);
 		if(worker->stats.extended)
 			worker->stats.unwanted_queries++;
-		if(worker_check_request(c->buffer, worker) == -1) {
+		qs = query_info_decode_header(c->buffer,
+			worker->daemon->cfg->harden_large_queries, &rcode);
+		if(qs == query_decode_drop || (qs == query_decode_header &&
+			worker_err_ratelimit(worker, rcode) == -1)) {
 			comm_point_drop_reply(repinfo);
 			return 0; /* discard this */
 		}
@@ -778,7 +754,8 @@ static int
 deny_refuse_non_local(struct comm_point* c, enum acl_access acl,
 	struct worker* worker, struct comm_reply* repinfo)
 {
-	return deny_refuse(c, acl, acl_deny_non_local, acl_refuse_non_local, worker, repinfo);
+	return deny_refuse(c, acl, acl_deny_non_local, acl_refuse_non_local,
+		worker, repinfo);
 }
 
 int 
@@ -787,12 +764,14 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 {
 	struct worker* worker = (struct worker*)arg;
 	int ret;
-	hashvalue_type h;
+	hashvalue_type h = 0;
 	struct lruhash_entry* e;
 	struct query_info qinfo;
 	struct edns_data edns;
 	enum acl_access acl;
 	struct acl_addr* acladdr;
+	enum query_decode_status qs;
+	int rcode = 0;
 	int rc = 0;
 
 	if(error != NETEVENT_NOERROR) {
@@ -814,10 +793,16 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 			goto send_reply;
 		return ret;
 	}
-	if((ret=worker_check_request(c->buffer, worker)) != 0) {
+	/* decode the header, query and EDNS in one go, the errors are
+	 * handled in the order of the checks below */
+	qs = query_info_decode(c->buffer,
+		worker->daemon->cfg->harden_large_queries, &qinfo, &h, &edns,
+		worker->scratchpad, &rcode);
+	if(qs == query_decode_drop || qs == query_decode_header) {
 		verbose(VERB_ALGO, "worker check request: bad query.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
-		if(ret != -1) {
+		if(qs == query_decode_header &&
+			(ret=worker_err_ratelimit(worker, rcode)) != -1) {
 			LDNS_QR_SET(sldns_buffer_begin(c->buffer));
 			LDNS_RCODE_SET(sldns_buffer_begin(c->buffer), ret);
 			return 1;
@@ -843,13 +828,14 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 				  addrbuf);
 		} else {
 			worker->stats.num_queries_ip_ratelimited++;
+			regional_free_all(worker->scratchpad);
 			comm_point_drop_reply(repinfo);
 			return 0;
 		}
 	}
 
 	/* see if query is in the cache */
-	if(!query_info_parse(&qinfo, c->buffer)) {
+	if(qs == query_decode_question) {
 		verbose(VERB_ALGO, "worker parse request: formerror.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
 		if(worker_err_ratelimit(worker, LDNS_RCODE_FORMERR) == -1) {
@@ -863,7 +849,10 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		server_stats_insrcode(&worker->stats, c->buffer);
 		goto send_reply;
 	}
-	if(worker->env.cfg->log_queries) {
+	if(worker->env.cfg->log_queries && worker->env.qlog) {
+		qlog_query(worker->env.qlog, worker->env.now_tv,
+			&repinfo->addr, repinfo->addrlen, &qinfo);
+	} else if(worker->env.cfg->log_queries) {
 		char ip[128];
 		addr_to_str(&repinfo->addr, repinfo->addrlen, ip, sizeof(ip));
 		log_nametypeclass(0, ip, qinfo.qname, qinfo.qtype, qinfo.qclass);
@@ -872,6 +861,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		qinfo.qtype == LDNS_RR_TYPE_IXFR) {
 		verbose(VERB_ALGO, "worker request: refused zone transfer.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
+		regional_free_all(worker->scratchpad);
 		sldns_buffer_rewind(c->buffer);
 		LDNS_QR_SET(sldns_buffer_begin(c->buffer));
 		LDNS_RCODE_SET(sldns_buffer_begin(c->buffer), 
@@ -890,6 +880,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		(qinfo.qtype >= 128 && qinfo.qtype <= 248)) {
 		verbose(VERB_ALGO, "worker request: formerror for meta-type.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
+		regional_free_all(worker->scratchpad);
 		if(worker_err_ratelimit(worker, LDNS_RCODE_FORMERR) == -1) {
 			comm_point_drop_reply(repinfo);
 			return 0;
@@ -904,15 +895,15 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		}
 		goto send_reply;
 	}
-	if((ret=parse_edns_from_pkt(c->buffer, &edns, worker->scratchpad)) != 0) {
+	if(qs == query_decode_edns) {
 		struct edns_data reply_edns;
 		verbose(VERB_ALGO, "worker parse edns: formerror.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
 		memset(&reply_edns, 0, sizeof(reply_edns));
 		reply_edns.edns_present = 1;
 		reply_edns.udp_size = EDNS_ADVERTISED_SIZE;
-		LDNS_RCODE_SET(sldns_buffer_begin(c->buffer), ret);
-		error_encode(c->buffer, ret, &qinfo,
+		LDNS_RCODE_SET(sldns_buffer_begin(c->buffer), rcode);
+		error_encode(c->buffer, rcode, &qinfo,
 			*(uint16_t*)(void *)sldns_buffer_begin(c->buffer),
 			sldns_buffer_read_u16_at(c->buffer, 2), &reply_edns);
 		regional_free_all(worker->scratchpad);
@@ -1034,10 +1025,12 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		}
 		qinfo.qname = d->rr_data[0] + 2;
 		qinfo.qname_len = d->rr_len[0] - 2;
+		h = query_info_hash(&qinfo,
+			sldns_buffer_read_u16_at(c->buffer, 2));
 	}
 
 	if(!edns_bypass_cache_stage(edns.opt_list, &worker->env)) {
-		h = query_info_hash(&qinfo, sldns_buffer_read_u16_at(c->buffer, 2));
+		/* the hash from the decoder, or of the local alias */
 		if((e=slabhash_lookup(worker->env.msg_cache, h, &qinfo, 0))) {
 			/* answer from cache - we have acquired a readlock on it */
 			if(answer_from_cache(worker, &qinfo, 
@@ -1101,6 +1094,10 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 	return 0;
 
 send_reply:
+	if(!worker_rrl_allow(worker, repinfo)) {
+		comm_point_drop_reply(repinfo);
+		return 0;
+	}
 	rc = 1;
 send_reply_rc:
 #ifdef USE_DNSTAP
@@ -1111,8 +1108,12 @@ send_reply_rc:
 	if(worker->env.cfg->log_replies)
 	{
 		struct timeval tv = {0, 0};
-		log_reply_info(0, &qinfo, &repinfo->addr, repinfo->addrlen,
-			tv, 1, c->buffer);
+		if(worker->env.qlog)
+			qlog_reply(worker->env.qlog, worker->env.now_tv,
+				&repinfo->addr, repinfo->addrlen, &qinfo, tv,
+				1, c->buffer);
+		else	log_reply_info(0, &qinfo, &repinfo->addr,
+				repinfo->addrlen, tv, 1, c->buffer);
 	}
 	return rc;
 }
@@ -1286,6 +1287,12 @@ worker_init(struct worker* worker, struct config_file *cfg,
 			worker_delete(worker);
 			return 0;
 		}
+		if(worker->daemon->metrics_ports && !(worker->daemon->metrics =
+			daemon_metrics_create(worker,
+			worker->daemon->metrics_ports))) {
+			worker_delete(worker);
+			return 0;
+		}
 #ifdef UB_ON_WINDOWS
 		wsvc_setup_worker(worker);
 #endif /* UB_ON_WINDOWS */
@@ -1310,7 +1317,8 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		cfg->unwanted_threshold, cfg->outgoing_tcp_mss,
 		&worker_alloc_cleanup, worker,
 		cfg->do_udp, worker->daemon->connect_sslctx, cfg->delay_close,
-		dtenv);
+		cfg->outgoing_udp_pool, cfg->outgoing_udp_pool_rotate,
+		cfg->outgoing_udp_pool_uses, dtenv);
 	if(!worker->back) {
 		log_err("could not create outgoing sockets");
 		worker_delete(worker);
@@ -1342,17 +1350,23 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	alloc_init(&worker->alloc, &worker->daemon->superalloc, 
 		worker->thread_num);
 	alloc_set_id_cleanup(&worker->alloc, &worker_alloc_cleanup, worker);
+	/* cache entries deleted by this thread go to its free lists */
+	alloc_set_thread(&worker->alloc);
 	worker->env = *worker->daemon->env;
 	comm_base_timept(worker->base, &worker->env.now, &worker->env.now_tv);
 	if(worker->thread_num == 0)
 		log_set_time(worker->env.now);
 	worker->env.worker = worker;
 	worker->env.send_query = &worker_send_query;
+	worker->env.hedge_query = &worker_hedge_query;
 	worker->env.alloc = &worker->alloc;
 	worker->env.rnd = worker->rndstate;
 	worker->env.scratch = worker->scratchpad;
 	worker->env.mesh = mesh_create(&worker->daemon->mods, &worker->env);
+	worker->env.qlog = qlog_get_ring(worker->daemon->qlog,
+		worker->thread_num);
 	worker->env.detach_subs = &mesh_detach_subs;
+	worker->env.cancel_subs = &mesh_cancel_subs;
 	worker->env.attach_sub = &mesh_attach_sub;
 	worker->env.kill_sub = &mesh_state_delete;
 	worker->env.detect_cycle = &mesh_detect_cycle;
@@ -1454,6 +1468,7 @@ worker_send_query(struct query_info* qinfo, uint16_t flags, int dnssec,
 	if(!e) 
 		return NULL;
 	e->qstate = q;
+	e->hedge_timer = NULL;
 	e->qsent = outnet_serviced_query(worker->back, qinfo, flags, dnssec,
 		want_dnssec, nocaps, q->env->cfg->tcp_upstream,
 		ssl_upstream, addr, addrlen, zone, zonelen, q,
@@ -1464,6 +1479,36 @@ worker_send_query(struct query_info* qinfo, uint16_t flags, int dnssec,
 	return e;
 }
 
+int
+worker_hedge_query(struct outbound_entry* e, int ms)
+{
+	struct worker* worker = e->qstate->env->worker;
+	struct timeval tv;
+	if(!e->hedge_timer) {
+		e->hedge_timer = comm_timer_create_coarse(worker->base,
+			worker_hedge_timer_cb, e);
+		if(!e->hedge_timer)
+			return 0;
+	}
+#ifndef S_SPLINT_S
+	tv.tv_sec = ms/1000;
+	tv.tv_usec = (ms%1000)*1000;
+#endif
+	comm_timer_set(e->hedge_timer, &tv);
+	return 1;
+}
+
+void
+worker_hedge_timer_cb(void* arg)
+{
+	struct outbound_entry* e = (struct outbound_entry*)arg;
+	struct worker* worker = e->qstate->env->worker;
+	comm_timer_delete(e->hedge_timer);
+	e->hedge_timer = NULL;
+	mesh_report_hedge(worker->env.mesh, e);
+	worker_mem_report(worker, NULL);
+}
+
 void 
 worker_alloc_cleanup(void* arg)
 {
@@ -1474,26 +1519,36 @@ worker_alloc_cleanup(void* arg)
 
 void worker_stats_clear(struct worker* worker)
 {
+	/* odd while clearing, for the readers in other threads */
+	worker->stats_clear_gen++;
 	server_stats_init(&worker->stats, worker->env.cfg);
 	mesh_stats_clear(worker->env.mesh);
 	worker->back->unwanted_replies = 0;
+	worker->back->num_udppool_opened = 0;
+	worker->back->num_udppool_rotated = 0;
 	worker->back->num_tcp_outgoing = 0;
+	/* even again, after the cleared counters */
+	ub_store_release(&worker->stats_clear_gen, worker->stats_clear_gen+1);
 }
 
 void worker_start_accept(void* arg)
 {
 	struct worker* worker = (struct worker*)arg;
 	listen_start_accept(worker->front);
-	if(worker->thread_num == 0)
+	if(worker->thread_num == 0) {
 		daemon_remote_start_accept(worker->daemon->rc);
+		daemon_metrics_start_accept(worker->daemon->metrics);
+	}
 }
 
 void worker_stop_accept(void* arg)
 {
 	struct worker* worker = (struct worker*)arg;
 	listen_stop_accept(worker->front);
-	if(worker->thread_num == 0)
+	if(worker->thread_num == 0) {
 		daemon_remote_stop_accept(worker->daemon->rc);
+		daemon_metrics_stop_accept(worker->daemon->metrics);
+	}
 }
 
 /* --- fake callbacks for fptr_wlist to work --- */
@@ -1509,6 +1564,18 @@ struct outbound_entry* libworker_send_query(
 	return 0;
 }
 
+int libworker_hedge_query(struct outbound_entry* ATTR_UNUSED(e),
+	int ATTR_UNUSED(ms))
+{
+	log_assert(0);
+	return 0;
+}
+
+void libworker_hedge_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 int libworker_handle_reply(struct comm_point* ATTR_UNUSED(c), 
 	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
         struct comm_reply* ATTR_UNUSED(reply_info))
@@ -67,10 +67,6 @@ struct query_info;
 enum worker_commands {
 	/** make the worker quit */
 	worker_cmd_quit,
-	/** obtain statistics */
-	worker_cmd_stats,
-	/** obtain statistics without statsclear */
-	worker_cmd_stats_noreset,
 	/** execute remote control command */
 	worker_cmd_remote
 };
@@ -115,8 +111,34 @@ struct worker {
 	int need_to_exit;
 	/** allocation cache for this thread */
 	struct alloc_cache alloc;
-	/** per thread statistics */
+	/** padding so that the statistics counters do not share a cache
+	 * line with the fields before them */
+	uint8_t stats_pad[STATS_CACHE_LINE];
+	/** per thread statistics, written only by this thread. The
+	 * statistics are read by the other threads directly from here */
 	struct server_stats stats;
+	/** incremented before and after this thread clears its statistics,
+	 * odd while clearing, the readers use it to see if the counters
+	 * have been cleared. */
+	volatile size_t stats_clear_gen;
+	/** the stats_base_num of the reset that the max_query_list_size in
+	 * stats belongs to, the thread starts the maximum again when the
+	 * statistics have been reset by another thread */
+	size_t stats_max_num;
+	/** padding so that the fields after the counters, that other
+	 * threads write, do not share a cache line with them */
+	uint8_t stats_pad_end[STATS_CACHE_LINE];
+	/** the counter values at the last reset of the statistics, these
+	 * are subtracted from the counters. Written only by the thread that
+	 * resets the statistics, the remote control thread */
+	struct stats_info stats_base;
+	/** the stats_clear_gen of the counters in stats_base */
+	size_t stats_base_gen;
+	/** if stats_base has been set */
+	int stats_base_set;
+	/** number of times stats_base has been set, this thread reads it
+	 * to start the maximum request list size again */
+	size_t stats_base_num;
 	/** thread scratch regional */
 	struct regional* scratchpad;
 
@@ -171,6 +193,8 @@ void worker_send_cmd(struct worker* worker, enum worker_commands cmd);
 
 /**
  * Init worker stats - includes server_stats_init, outside network and mesh.
+ * Called by the thread of the worker itself, other threads reset the
+ * statistics with server_stats_flush.
  * @param worker: the worker to init
  */
 void worker_stats_clear(struct worker* worker);
@@ -700,9 +700,10 @@ dns64_adjust_a(int id, struct module_qstate* super, struct module_qstate* qstate
 	/*
 	 * Build the actual reply.
 	 */
-	cp = construct_reply_info_base(super->region, rep->flags, rep->qdcount,
-		rep->ttl, rep->prefetch_ttl, rep->an_numrrsets, rep->ns_numrrsets,
-		rep->ar_numrrsets, rep->rrset_count, rep->security);
+	cp = construct_reply_info_base(super->region, NULL, rep->flags,
+		rep->qdcount, rep->ttl, rep->prefetch_ttl, rep->an_numrrsets,
+		rep->ns_numrrsets, rep->ar_numrrsets, rep->rrset_count,
+		rep->security);
 	if(!cp)
 		return;
 
@@ -0,0 +1,154 @@
+/*
+ * dynlibmod/dynlib_plugin.h - interface for compiled plugin modules.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the interface between the dynlib module and the
+ * plugins it loads. A plugin is a shared object that defines the symbol
+ * DYNLIB_PLUGIN_SYMBOL, a const struct dynlib_plugin, with its hooks.
+ *
+ * The hooks are called with the structures of the daemon itself, the
+ * module_qstate with its query_info, the reply_info and edns_data of the
+ * replies, nothing is copied or converted for the plugin. That makes the
+ * plugin depend on the layout of these structures, and the plugin has to
+ * be compiled with the headers of the same version of unbound. The
+ * DYNLIB_ABI_VERSION is changed when these structures, or the hooks,
+ * change, and plugins with another version are not loaded.
+ *
+ * The daemon does not export its functions to the plugin, it gets the
+ * functions it may call in the dynlib_api at init time.
+ *
+ * The hooks are called by all the threads, at the same time. The data
+ * that the init hook returns is shared by the threads, and the plugin
+ * has to lock it if it changes it after init.
+ */
+
+#ifndef DYNLIBMOD_DYNLIB_PLUGIN_H
+#define DYNLIBMOD_DYNLIB_PLUGIN_H
+#include "util/log.h"
+#include "util/module.h"
+
+/** version of the plugin interface, and the structures it uses */
+#define DYNLIB_ABI_VERSION 1
+/** name of the symbol, a struct dynlib_plugin, that the plugin defines */
+#define DYNLIB_PLUGIN_SYMBOL "dynlib_plugin"
+
+/**
+ * Functions of the daemon that the plugin can call.
+ */
+struct dynlib_api {
+	/** log a message at the given verbosity level */
+	void (*verbose)(enum verbosity_value level, const char* format, ...)
+		ATTR_FORMAT(printf, 2, 3);
+	/** log an error */
+	void (*log_err)(const char* format, ...) ATTR_FORMAT(printf, 1, 2);
+	/** log a domain name with a type and class, at verbosity level */
+	void (*log_nametypeclass)(enum verbosity_value level, const char* str,
+		uint8_t* name, uint16_t type, uint16_t dclass);
+	/** allocate from a region, like the query region, NULL on failure */
+	void* (*regional_alloc)(struct regional* r, size_t size);
+	/** copy data into a region, NULL on failure */
+	void* (*regional_alloc_init)(struct regional* r, const void* init,
+		size_t size);
+	/** compare domain names, case insensitive, like query_dname_compare */
+	int (*dname_compare)(uint8_t* d1, uint8_t* d2);
+	/** true if name d1 is equal to or below d2 (case insensitive) */
+	int (*dname_subdomain)(uint8_t* d1, uint8_t* d2);
+	/** add an EDNS option to a list, with the data copied into region */
+	int (*edns_opt_append)(struct edns_data* edns, struct regional* region,
+		uint16_t code, size_t len, uint8_t* data);
+	/** add an EDNS option to the list, with the data copied into region */
+	int (*edns_opt_list_append)(struct edns_option** list, uint16_t code,
+		size_t len, uint8_t* data, struct regional* region);
+};
+
+/**
+ * The plugin. The plugin defines it as
+ * const struct dynlib_plugin dynlib_plugin = { DYNLIB_ABI_VERSION, ... };
+ * The hooks that the plugin does not need are NULL. The data argument of
+ * the hooks is the data that init stored.
+ */
+struct dynlib_plugin {
+	/** DYNLIB_ABI_VERSION of the headers the plugin was compiled with */
+	int abi_version;
+	/** name of the plugin, for logging */
+	const char* name;
+
+	/**
+	 * Initialise the plugin, called when the module is set up, before
+	 * the threads start, the inplace callbacks are registered after it.
+	 * @param env: module environment, with the config.
+	 * @param id: module id.
+	 * @param api: functions that the plugin can call, it stays valid
+	 *	until deinit.
+	 * @param data: the plugin can store its global data here.
+	 * @return false on failure, the daemon does not start.
+	 */
+	int (*init)(struct module_env* env, int id,
+		const struct dynlib_api* api, void** data);
+	/** Delete the plugin, and its data, at exit or reload */
+	void (*deinit)(struct module_env* env, int id, void* data);
+
+	/**
+	 * Handle a query event, like the operate of a module. It sets
+	 * qstate->ext_state[id]. If NULL, the module passes the query on to
+	 * the next module, and the reply back, unchanged.
+	 */
+	void (*operate)(struct module_qstate* qstate, enum module_ev event,
+		int id, struct outbound_entry* outbound, void* data);
+	/** a subquery is done, like the inform_super of a module */
+	void (*inform_super)(struct module_qstate* qstate, int id,
+		struct module_qstate* super, void* data);
+	/** clear the per query state, qstate->minfo[id], of the plugin */
+	void (*clear)(struct module_qstate* qstate, int id, void* data);
+	/** memory in use by the plugin, in bytes */
+	size_t (*get_mem)(struct module_env* env, int id, void* data);
+
+	/** called before a resolved reply is sent to the client, with
+	 * data as the last argument, see inplace_cb_reply_func_type. */
+	inplace_cb_reply_func_type* reply;
+	/** called before a reply from the cache is sent */
+	inplace_cb_reply_func_type* reply_cache;
+	/** called before a reply from local data is sent */
+	inplace_cb_reply_func_type* reply_local;
+	/** called before a SERVFAIL reply is sent */
+	inplace_cb_reply_func_type* reply_servfail;
+	/** called before a query is sent to an upstream server, with data
+	 * as the last argument, see inplace_cb_query_func_type. */
+	inplace_cb_query_func_type* query;
+};
+
+#endif /* DYNLIBMOD_DYNLIB_PLUGIN_H */
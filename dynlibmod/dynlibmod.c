@@ -0,0 +1,292 @@
+/*
+ * dynlibmod/dynlibmod.c - module that loads a compiled plugin.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a module that loads a plugin, a shared object,
+ * with dlopen, and calls its hooks for the queries and replies.
+ */
+
+#include "config.h"
+#ifdef USE_DYNLIBMOD
+#include "dynlibmod/dynlibmod.h"
+#include "util/log.h"
+#include "util/net_help.h"
+#include "util/regional.h"
+#include "util/config_file.h"
+#include "util/data/dname.h"
+#include "util/data/msgreply.h"
+#include <dlfcn.h>
+
+/** the functions of the daemon for the plugin */
+static const struct dynlib_api dynlib_api = {
+	&verbose,
+	&log_err,
+	&log_nametypeclass,
+	&regional_alloc,
+	&regional_alloc_init,
+	&query_dname_compare,
+	&dname_subdomain_c,
+	&edns_opt_append,
+	&edns_opt_list_append
+};
+
+/** load the plugin from the shared object, false on failure */
+static int
+dynlibmod_load(struct dynlibmod_env* de, const char* fname)
+{
+	const struct dynlib_plugin* p;
+	de->handle = dlopen(fname, RTLD_NOW|RTLD_LOCAL);
+	if(!de->handle) {
+		log_err("dynlib: could not load %s: %s", fname, dlerror());
+		return 0;
+	}
+	p = (const struct dynlib_plugin*)dlsym(de->handle,
+		DYNLIB_PLUGIN_SYMBOL);
+	if(!p) {
+		log_err("dynlib: %s has no symbol %s: %s", fname,
+			DYNLIB_PLUGIN_SYMBOL, dlerror());
+		return 0;
+	}
+	if(p->abi_version != DYNLIB_ABI_VERSION) {
+		log_err("dynlib: %s has ABI version %d, but this unbound has "
+			"ABI version %d, recompile the plugin with the headers "
+			"of this version", fname, p->abi_version,
+			DYNLIB_ABI_VERSION);
+		return 0;
+	}
+	de->plugin = p;
+	return 1;
+}
+
+/** register the inplace callbacks for the hooks of the plugin */
+static int
+dynlibmod_register_cbs(struct module_env* env, struct dynlibmod_env* de)
+{
+	const struct dynlib_plugin* p = de->plugin;
+	if(p->reply && !inplace_cb_reply_register(&dynlib_inplace_cb_reply,
+		de, env))
+		return 0;
+	if(p->reply_cache && !inplace_cb_reply_cache_register(
+		&dynlib_inplace_cb_reply_cache, de, env))
+		return 0;
+	if(p->reply_local && !inplace_cb_reply_local_register(
+		&dynlib_inplace_cb_reply_local, de, env))
+		return 0;
+	if(p->reply_servfail && !inplace_cb_reply_servfail_register(
+		&dynlib_inplace_cb_reply_servfail, de, env))
+		return 0;
+	if(p->query && !inplace_cb_query_register(&dynlib_inplace_cb_query,
+		de, env))
+		return 0;
+	return 1;
+}
+
+int
+dynlibmod_init(struct module_env* env, int id)
+{
+	struct dynlibmod_env* de = (struct dynlibmod_env*)calloc(1,
+		sizeof(struct dynlibmod_env));
+	if(!de) {
+		log_err("malloc failure");
+		return 0;
+	}
+	env->modinfo[id] = (void*)de;
+	if(!env->cfg->dynlib_file) {
+		log_err("dynlib: no dynlib-file: configured");
+		return 0;
+	}
+	if(!dynlibmod_load(de, env->cfg->dynlib_file))
+		return 0;
+	if(de->plugin->init) {
+		if(!(*de->plugin->init)(env, id, &dynlib_api, &de->data)) {
+			log_err("dynlib: could not init plugin %s",
+				de->plugin->name?de->plugin->name:"");
+			de->plugin = NULL;
+			return 0;
+		}
+	}
+	if(!dynlibmod_register_cbs(env, de)) {
+		log_err("dynlib: could not register callbacks");
+		return 0;
+	}
+	verbose(VERB_OPS, "dynlib: loaded plugin %s from %s",
+		de->plugin->name?de->plugin->name:"", env->cfg->dynlib_file);
+	return 1;
+}
+
+void
+dynlibmod_deinit(struct module_env* env, int id)
+{
+	struct dynlibmod_env* de;
+	int i;
+	if(!env || !env->modinfo[id])
+		return;
+	de = (struct dynlibmod_env*)env->modinfo[id];
+	/* the callbacks point to the plugin, remove them before it is gone */
+	for(i=0; i<inplace_cb_types_total; i++)
+		inplace_cb_delete_arg(env, (enum inplace_cb_list_type)i, de);
+	if(de->plugin && de->plugin->deinit)
+		(*de->plugin->deinit)(env, id, de->data);
+	if(de->handle)
+		dlclose(de->handle);
+	free(de);
+	env->modinfo[id] = NULL;
+}
+
+void
+dynlibmod_operate(struct module_qstate* qstate, enum module_ev event,
+	int id, struct outbound_entry* outbound)
+{
+	struct dynlibmod_env* de = (struct dynlibmod_env*)
+		qstate->env->modinfo[id];
+	if(de->plugin->operate) {
+		(*de->plugin->operate)(qstate, event, id, outbound, de->data);
+		return;
+	}
+	/* no operate hook, pass the query and the reply on */
+	if(event == module_event_new || event == module_event_pass) {
+		qstate->ext_state[id] = module_wait_module;
+	} else if(event == module_event_moddone) {
+		qstate->ext_state[id] = module_finished;
+	} else {
+		qstate->ext_state[id] = module_error;
+	}
+}
+
+void
+dynlibmod_inform_super(struct module_qstate* qstate, int id,
+	struct module_qstate* super)
+{
+	struct dynlibmod_env* de = (struct dynlibmod_env*)
+		qstate->env->modinfo[id];
+	if(de->plugin->inform_super)
+		(*de->plugin->inform_super)(qstate, id, super, de->data);
+}
+
+void
+dynlibmod_clear(struct module_qstate* qstate, int id)
+{
+	struct dynlibmod_env* de;
+	if(!qstate)
+		return;
+	de = (struct dynlibmod_env*)qstate->env->modinfo[id];
+	if(de && de->plugin && de->plugin->clear)
+		(*de->plugin->clear)(qstate, id, de->data);
+	qstate->minfo[id] = NULL;
+}
+
+size_t
+dynlibmod_get_mem(struct module_env* env, int id)
+{
+	struct dynlibmod_env* de = (struct dynlibmod_env*)env->modinfo[id];
+	if(!de)
+		return 0;
+	if(de->plugin && de->plugin->get_mem)
+		return sizeof(*de) + (*de->plugin->get_mem)(env, id, de->data);
+	return sizeof(*de);
+}
+
+int
+dynlib_inplace_cb_reply(struct query_info* qinfo,
+	struct module_qstate* qstate, struct reply_info* rep, int rcode,
+	struct edns_data* edns, struct edns_option** opt_list_out,
+	struct regional* region, void* cb_arg)
+{
+	struct dynlibmod_env* de = (struct dynlibmod_env*)cb_arg;
+	return (*de->plugin->reply)(qinfo, qstate, rep, rcode, edns,
+		opt_list_out, region, de->data);
+}
+
+int
+dynlib_inplace_cb_reply_cache(struct query_info* qinfo,
+	struct module_qstate* qstate, struct reply_info* rep, int rcode,
+	struct edns_data* edns, struct edns_option** opt_list_out,
+	struct regional* region, void* cb_arg)
+{
+	struct dynlibmod_env* de = (struct dynlibmod_env*)cb_arg;
+	return (*de->plugin->reply_cache)(qinfo, qstate, rep, rcode, edns,
+		opt_list_out, region, de->data);
+}
+
+int
+dynlib_inplace_cb_reply_local(struct query_info* qinfo,
+	struct module_qstate* qstate, struct reply_info* rep, int rcode,
+	struct edns_data* edns, struct edns_option** opt_list_out,
+	struct regional* region, void* cb_arg)
+{
+	struct dynlibmod_env* de = (struct dynlibmod_env*)cb_arg;
+	return (*de->plugin->reply_local)(qinfo, qstate, rep, rcode, edns,
+		opt_list_out, region, de->data);
+}
+
+int
+dynlib_inplace_cb_reply_servfail(struct query_info* qinfo,
+	struct module_qstate* qstate, struct reply_info* rep, int rcode,
+	struct edns_data* edns, struct edns_option** opt_list_out,
+	struct regional* region, void* cb_arg)
+{
+	struct dynlibmod_env* de = (struct dynlibmod_env*)cb_arg;
+	return (*de->plugin->reply_servfail)(qinfo, qstate, rep, rcode, edns,
+		opt_list_out, region, de->data);
+}
+
+int
+dynlib_inplace_cb_query(struct query_info* qinfo, uint16_t flags,
+	struct module_qstate* qstate, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint8_t* zone, size_t zonelen,
+	struct regional* region, void* cb_arg)
+{
+	struct dynlibmod_env* de = (struct dynlibmod_env*)cb_arg;
+	return (*de->plugin->query)(qinfo, flags, qstate, addr, addrlen,
+		zone, zonelen, region, de->data);
+}
+
+/**
+ * The dynlib function block 
+ */
+static struct module_func_block dynlibmod_block = {
+	"dynlib",
+	&dynlibmod_init, &dynlibmod_deinit, &dynlibmod_operate,
+	&dynlibmod_inform_super, &dynlibmod_clear, &dynlibmod_get_mem
+};
+
+struct module_func_block*
+dynlibmod_get_funcblock(void)
+{
+	return &dynlibmod_block;
+}
+#endif /* USE_DYNLIBMOD */
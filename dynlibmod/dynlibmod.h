@@ -0,0 +1,109 @@
+/*
+ * dynlibmod/dynlibmod.h - module that loads a compiled plugin.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a module that loads a plugin, a shared object
+ * with the hooks of dynlibmod/dynlib_plugin.h, and calls it for the
+ * queries and replies. The plugin is native code that works on the
+ * structures of the daemon, and all threads call it at the same time.
+ */
+
+#ifndef DYNLIBMOD_DYNLIBMOD_H
+#define DYNLIBMOD_DYNLIBMOD_H
+#include "util/module.h"
+#include "dynlibmod/dynlib_plugin.h"
+
+/**
+ * The global state of the dynlib module, for the loaded plugin.
+ */
+struct dynlibmod_env {
+	/** the handle of the shared object */
+	void* handle;
+	/** the plugin, in the shared object */
+	const struct dynlib_plugin* plugin;
+	/** the data that the plugin stored at init */
+	void* data;
+};
+
+/** Init the dynlib module, loads the plugin */
+int dynlibmod_init(struct module_env* env, int id);
+/** Deinit the dynlib module, and unload the plugin */
+void dynlibmod_deinit(struct module_env* env, int id);
+/** Operate on an event on a query (in qstate). */
+void dynlibmod_operate(struct module_qstate* qstate, enum module_ev event,
+	int id, struct outbound_entry* outbound);
+/** Subordinate query done, inform this super request of its conclusion */
+void dynlibmod_inform_super(struct module_qstate* qstate, int id,
+	struct module_qstate* super);
+/** clear the dynlib query-specific contents out of qstate */
+void dynlibmod_clear(struct module_qstate* qstate, int id);
+/** return memory estimate for dynlib module */
+size_t dynlibmod_get_mem(struct module_env* env, int id);
+
+/** inplace reply callback, it calls the reply hook of the plugin */
+int dynlib_inplace_cb_reply(struct query_info* qinfo,
+	struct module_qstate* qstate, struct reply_info* rep, int rcode,
+	struct edns_data* edns, struct edns_option** opt_list_out,
+	struct regional* region, void* cb_arg);
+/** inplace reply callback, it calls the reply_cache hook of the plugin */
+int dynlib_inplace_cb_reply_cache(struct query_info* qinfo,
+	struct module_qstate* qstate, struct reply_info* rep, int rcode,
+	struct edns_data* edns, struct edns_option** opt_list_out,
+	struct regional* region, void* cb_arg);
+/** inplace reply callback, it calls the reply_local hook of the plugin */
+int dynlib_inplace_cb_reply_local(struct query_info* qinfo,
+	struct module_qstate* qstate, struct reply_info* rep, int rcode,
+	struct edns_data* edns, struct edns_option** opt_list_out,
+	struct regional* region, void* cb_arg);
+/** inplace reply callback, it calls the reply_servfail hook of the plugin */
+int dynlib_inplace_cb_reply_servfail(struct query_info* qinfo,
+	struct module_qstate* qstate, struct reply_info* rep, int rcode,
+	struct edns_data* edns, struct edns_option** opt_list_out,
+	struct regional* region, void* cb_arg);
+/** inplace query callback, it calls the query hook of the plugin */
+int dynlib_inplace_cb_query(struct query_info* qinfo, uint16_t flags,
+	struct module_qstate* qstate, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint8_t* zone, size_t zonelen,
+	struct regional* region, void* cb_arg);
+
+/**
+ * Get the function block with pointers to the dynlib functions
+ * @return the function block for "dynlib".
+ */
+struct module_func_block* dynlibmod_get_funcblock(void);
+
+#endif /* DYNLIBMOD_DYNLIBMOD_H */
@@ -0,0 +1,187 @@
+/*
+ * dynlibmod/examples/filter.c - example plugin for the dynlib module.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * An example plugin for the dynlib module. It refuses queries for names
+ * in a list of blocked domains, and logs the replies that are sent.
+ *
+ * Compile it, in the build directory, with make dynlib_filter.so, or
+ * with the headers of the unbound source and the config.h of the build:
+ *	cc -fPIC -shared -I. -I<srcdir> -o filter.so filter.c
+ * and use it with:
+ *	server:	module-config: "dynlib validator iterator"
+ *	dynlib:	dynlib-file: "/path/to/filter.so"
+ */
+
+#include "config.h"
+#include "dynlibmod/dynlib_plugin.h"
+#include "util/data/msgreply.h"
+#include "sldns/pkthdr.h"
+#include "sldns/rrdef.h"
+
+/** the domains that are blocked, in wire format */
+static uint8_t* blocked[] = {
+	(uint8_t*)"\003ads\007example\003com\000",
+	(uint8_t*)"\007tracker\007example\003net\000",
+	(uint8_t*)"\007invalid\000",
+	NULL
+};
+
+/** the global data of the plugin */
+struct filter_data {
+	/** the functions of the daemon */
+	const struct dynlib_api* api;
+};
+
+/** true if the name is in one of the blocked domains */
+static int
+filter_blocked(struct filter_data* fd, uint8_t* qname)
+{
+	int i;
+	for(i=0; blocked[i]; i++) {
+		if(fd->api->dname_subdomain(qname, blocked[i]))
+			return 1;
+	}
+	return 0;
+}
+
+/** init the plugin */
+static int
+filter_init(struct module_env* env, int id, const struct dynlib_api* api,
+	void** data)
+{
+	struct filter_data* fd = (struct filter_data*)calloc(1, sizeof(*fd));
+	(void)env;
+	if(!fd) {
+		api->log_err("filter: out of memory");
+		return 0;
+	}
+	fd->api = api;
+	*data = fd;
+	api->verbose(VERB_OPS, "filter: plugin init as module %d", id);
+	return 1;
+}
+
+/** delete the plugin */
+static void
+filter_deinit(struct module_env* env, int id, void* data)
+{
+	(void)env;
+	(void)id;
+	free(data);
+}
+
+/** refuse the blocked queries, pass the others on */
+static void
+filter_operate(struct module_qstate* qstate, enum module_ev event, int id,
+	struct outbound_entry* outbound, void* data)
+{
+	struct filter_data* fd = (struct filter_data*)data;
+	(void)outbound;
+	if(event == module_event_new || event == module_event_pass) {
+		if(filter_blocked(fd, qstate->qinfo.qname)) {
+			fd->api->log_nametypeclass(VERB_QUERY,
+				"filter: refused", qstate->qinfo.qname,
+				qstate->qinfo.qtype, qstate->qinfo.qclass);
+			qstate->return_rcode = LDNS_RCODE_REFUSED;
+			qstate->return_msg = NULL;
+			qstate->ext_state[id] = module_finished;
+			return;
+		}
+		qstate->ext_state[id] = module_wait_module;
+		return;
+	}
+	if(event == module_event_moddone) {
+		qstate->ext_state[id] = module_finished;
+		return;
+	}
+	qstate->ext_state[id] = module_error;
+}
+
+/** the plugin keeps no per query state */
+static void
+filter_clear(struct module_qstate* qstate, int id, void* data)
+{
+	(void)data;
+	qstate->minfo[id] = NULL;
+}
+
+/** memory in use */
+static size_t
+filter_get_mem(struct module_env* env, int id, void* data)
+{
+	(void)env;
+	(void)id;
+	(void)data;
+	return sizeof(struct filter_data);
+}
+
+/** log the resolved replies, the reply is read where it is */
+static int
+filter_reply(struct query_info* qinfo, struct module_qstate* qstate,
+	struct reply_info* rep, int rcode, struct edns_data* edns,
+	struct edns_option** opt_list_out, struct regional* region,
+	void* data)
+{
+	struct filter_data* fd = (struct filter_data*)data;
+	(void)qstate;
+	(void)edns;
+	(void)opt_list_out;
+	(void)region;
+	fd->api->verbose(VERB_ALGO, "filter: reply rcode %d with %d answer "
+		"rrsets", rcode, rep?(int)rep->an_numrrsets:0);
+	fd->api->log_nametypeclass(VERB_ALGO, "filter: reply for",
+		qinfo->qname, qinfo->qtype, qinfo->qclass);
+	return 1;
+}
+
+/** the plugin, for the dynlib module */
+const struct dynlib_plugin dynlib_plugin = {
+	DYNLIB_ABI_VERSION,
+	"filter",
+	&filter_init,
+	&filter_deinit,
+	&filter_operate,
+	NULL, /* inform_super */
+	&filter_clear,
+	&filter_get_mem,
+	&filter_reply,
+	NULL, /* reply_cache */
+	NULL, /* reply_local */
+	NULL, /* reply_servfail */
+	NULL /* query */
+};
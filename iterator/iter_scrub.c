@@ -563,7 +563,8 @@ store_rrset(sldns_buffer* pkt, struct msg_parse* msg, struct module_env* env,
 	if(!k)
 		return;
 	k->entry.data = NULL;
-	if(!parse_copy_decompress_rrset(pkt, msg, rrset, NULL, k)) {
+	if(!parse_copy_decompress_rrset(pkt, msg, rrset, env->alloc, NULL,
+		k)) {
 		alloc_special_release(env->alloc, k);
 		return;
 	}
@@ -175,6 +175,8 @@ iter_apply_cfg(struct iter_env* iter_env, struct config_file* cfg)
 	}
 	iter_env->supports_ipv6 = cfg->do_ip6;
 	iter_env->supports_ipv4 = cfg->do_ip4;
+	iter_env->hedge_percentile = cfg->hedge_percentile;
+	iter_env->hedge_budget = cfg->hedge_budget;
 	return 1;
 }
 
@@ -468,6 +470,39 @@ iter_server_selection(struct iter_env* iter_env,
 	return a;
 }
 
+struct delegpt_addr*
+iter_hedge_selection(struct iter_env* iter_env, struct module_env* env,
+	struct delegpt* dp, uint8_t* name, size_t namelen, uint16_t qtype,
+	struct delegpt_addr* exclude, struct sock_list* blacklist)
+{
+	int best_rtt = 0;
+	struct delegpt_addr* a, *prev, *best = NULL, *bestprev = NULL;
+	if(!iter_fill_rtt(iter_env, env, name, namelen, qtype, *env->now, dp,
+		&best_rtt, blacklist))
+		return NULL;
+	prev = NULL;
+	for(a = dp->result_list; a; prev = a, a = a->next_result) {
+		if(a->sel_rtt == -1 || a->sel_rtt >= USEFUL_SERVER_TOP_TIMEOUT)
+			continue;
+		if(sockaddr_cmp(&a->addr, a->addrlen, &exclude->addr,
+			exclude->addrlen) == 0)
+			continue;
+		if(!best || a->sel_rtt < best->sel_rtt) {
+			best = a;
+			bestprev = prev;
+		}
+	}
+	if(!best)
+		return NULL;
+	if(++best->attempts < OUTBOUND_MSG_RETRY)
+		return best;
+	/* remove it from the delegation point result list */
+	if(bestprev)
+		bestprev->next_result = best->next_result;
+	else	dp->result_list = best->next_result;
+	return best;
+}
+
 struct dns_msg* 
 dns_alloc_msg(sldns_buffer* pkt, struct msg_parse* msg, 
 	struct regional* region)
@@ -53,6 +53,7 @@
 #include "validator/val_neg.h"
 #include "services/cache/dns.h"
 #include "services/cache/infra.h"
+#include "services/mesh.h"
 #include "util/module.h"
 #include "util/netevent.h"
 #include "util/net_help.h"
@@ -147,6 +148,8 @@ iter_new(struct module_qstate* qstate, int id)
 	/* Start with the (current) qname. */
 	iq->qchase = qstate->qinfo;
 	outbound_list_init(&iq->outlist);
+	iq->hedge_target = NULL;
+	iq->hedge_outq = NULL;
 	iq->minimise_count = 0;
 	iq->minimise_timeout_count = 0;
 	if (qstate->env->cfg->qname_minimisation)
@@ -1767,6 +1770,73 @@ processDSNSFind(struct module_qstate* qstate, struct iter_qstate* iq, int id)
 	return 0;
 }
 	
+/**
+ * Send the query to the target with the env send_query function.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ * @param target: the server to send it to.
+ * @return the outbound entry, or NULL on failure.
+ */
+static struct outbound_entry*
+iter_send_to_target(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie, struct delegpt_addr* target)
+{
+	fptr_ok(fptr_whitelist_modenv_send_query(qstate->env->send_query));
+	return (*qstate->env->send_query)(&iq->qinfo_out,
+		iq->chase_flags | (iq->chase_to_rd?BIT_RD:0), 
+		/* unset CD if to forwarder(RD set) and not dnssec retry
+		 * (blacklist nonempty) and no trust-anchors are configured
+		 * above the qname or on the first attempt when dnssec is on */
+		EDNS_DO| ((iq->chase_to_rd||(iq->chase_flags&BIT_RD)!=0)&&
+		!qstate->blacklist&&(!iter_indicates_dnssec_fwd(qstate->env,
+		&iq->qinfo_out)||target->attempts==1)?0:BIT_CD), 
+		iq->dnssec_expected, iq->caps_fallback || is_caps_whitelisted(
+		ie, iq), &target->addr, target->addrlen,
+		iq->dp->name, iq->dp->namelen,
+		(iq->dp->ssl_upstream || qstate->env->cfg->ssl_upstream), qstate);
+}
+
+/**
+ * Start the hedge timer for a query that was sent to a target. The timer
+ * runs for the configured percentile of the roundtrip times of the target.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ * @param outq: the query that was sent.
+ * @param target: the server it was sent to.
+ */
+static void
+hedge_start(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie, struct outbound_entry* outq,
+	struct delegpt_addr* target)
+{
+	struct mesh_area* mesh = qstate->env->mesh;
+	int ms;
+	iq->hedge_target = NULL;
+	iq->hedge_outq = NULL;
+	if(!ie->hedge_percentile || !qstate->env->hedge_query)
+		return;
+	/* count the query for the hedge budget */
+	if(++mesh->hedge_window_queries >= HEDGE_WINDOW) {
+		mesh->hedge_window_queries /= 2;
+		mesh->hedge_window_hedges /= 2;
+	}
+	/* the 0x20 fallback compares replies from every server in turn */
+	if(iq->caps_fallback)
+		return;
+	ms = infra_get_rtt_percentile(qstate->env->infra_cache,
+		&target->addr, target->addrlen, ie->hedge_percentile,
+		*qstate->env->now);
+	if(ms < 0)
+		return;
+	fptr_ok(fptr_whitelist_modenv_hedge_query(qstate->env->hedge_query));
+	if(!(*qstate->env->hedge_query)(outq, ms))
+		return;
+	verbose(VERB_ALGO, "hedge timer %d msec", ms);
+	iq->hedge_target = target;
+}
+
 /** 
  * This is the request event state where the request will be sent to one of
  * its current query targets. This state also handles issuing target lookup
@@ -1841,6 +1911,10 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	if(iq->depth < ie->max_dependency_depth
 		&& iq->sent_count < TARGET_FETCH_STOP) {
 		tf_policy = ie->target_fetch_policy[iq->depth];
+		/* look up all targets at once, the first address that
+		 * arrives is used */
+		if(qstate->env->cfg->target_fetch_parallel)
+			tf_policy = -1;
 	}
 
 	/* if in 0x20 fallback get as many targets as possible */
@@ -2107,19 +2181,7 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 			iq->dnssec_expected?"expected": "not expected",
 			iq->dnssec_lame_query?" but lame_query anyway": "");
 	}
-	fptr_ok(fptr_whitelist_modenv_send_query(qstate->env->send_query));
-	outq = (*qstate->env->send_query)(&iq->qinfo_out,
-		iq->chase_flags | (iq->chase_to_rd?BIT_RD:0), 
-		/* unset CD if to forwarder(RD set) and not dnssec retry
-		 * (blacklist nonempty) and no trust-anchors are configured
-		 * above the qname or on the first attempt when dnssec is on */
-		EDNS_DO| ((iq->chase_to_rd||(iq->chase_flags&BIT_RD)!=0)&&
-		!qstate->blacklist&&(!iter_indicates_dnssec_fwd(qstate->env,
-		&iq->qinfo_out)||target->attempts==1)?0:BIT_CD), 
-		iq->dnssec_expected, iq->caps_fallback || is_caps_whitelisted(
-		ie, iq), &target->addr, target->addrlen,
-		iq->dp->name, iq->dp->namelen,
-		(iq->dp->ssl_upstream || qstate->env->cfg->ssl_upstream), qstate);
+	outq = iter_send_to_target(qstate, iq, ie, target);
 	if(!outq) {
 		log_addr(VERB_DETAIL, "error sending query to auth server", 
 			&target->addr, target->addrlen);
@@ -2132,6 +2194,7 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	iq->num_current_queries++;
 	iq->sent_count++;
 	qstate->ext_state[id] = module_wait_reply;
+	hedge_start(qstate, iq, ie, outq, target);
 
 	return 0;
 }
@@ -2149,6 +2212,26 @@ find_NS(struct reply_info* rep, size_t from, size_t to)
 }
 
 
+/**
+ * Stop waiting for the target queries (and other subqueries) of this query.
+ * With target-fetch-parallel, the lookups that nobody else waits for are
+ * cancelled, they were started for this delegation point only. Otherwise
+ * they are detached, and run to completion to fill the cache.
+ * @param qstate: query state.
+ */
+static void
+stop_target_queries(struct module_qstate* qstate)
+{
+	if(qstate->env->cfg->target_fetch_parallel) {
+		fptr_ok(fptr_whitelist_modenv_cancel_subs(
+			qstate->env->cancel_subs));
+		(*qstate->env->cancel_subs)(qstate);
+		return;
+	}
+	fptr_ok(fptr_whitelist_modenv_detach_subs(qstate->env->detach_subs));
+	(*qstate->env->detach_subs)(qstate);
+}
+
 /** 
  * Process the query response. All queries end up at this state first. This
  * process generally consists of analyzing the response and routing the
@@ -2268,9 +2351,7 @@ processQueryResponse(struct module_qstate* qstate, struct iter_qstate* iq,
 		/* close down outstanding requests to be discarded */
 		outbound_list_clear(&iq->outlist);
 		iq->num_current_queries = 0;
-		fptr_ok(fptr_whitelist_modenv_detach_subs(
-			qstate->env->detach_subs));
-		(*qstate->env->detach_subs)(qstate);
+		stop_target_queries(qstate);
 		iq->num_target_queries = 0;
 		if(qstate->reply)
 			sock_list_insert(&qstate->reply_origin, 
@@ -2396,6 +2477,9 @@ processQueryResponse(struct module_qstate* qstate, struct iter_qstate* iq,
 		 * along, indicating dnssec is expected for next zone */
 		iq->dnssec_expected = iter_indicates_dnssec(qstate->env, 
 			iq->dp, iq->response, iq->qchase.qclass);
+		/* done with the target lookups for the old delegation point,
+		 * before the subqueries below are attached */
+		stop_target_queries(qstate);
 		/* if dnssec, validating then also fetch the key for the DS */
 		if(iq->dnssec_expected && qstate->env->cfg->prefetch_key &&
 			!(qstate->query_flags&BIT_CD))
@@ -2476,9 +2560,7 @@ processQueryResponse(struct module_qstate* qstate, struct iter_qstate* iq,
 		 */
 		outbound_list_clear(&iq->outlist);
 		iq->num_current_queries = 0;
-		fptr_ok(fptr_whitelist_modenv_detach_subs(
-			qstate->env->detach_subs));
-		(*qstate->env->detach_subs)(qstate);
+		stop_target_queries(qstate);
 		iq->num_target_queries = 0;
 		if(qstate->reply)
 			sock_list_insert(&qstate->reply_origin, 
@@ -3091,6 +3173,95 @@ process_request(struct module_qstate* qstate, struct iter_qstate* iq,
 	iter_handle(qstate, iq, ie, id);
 }
 
+/**
+ * The hedge timer for the outstanding query expired. Send the query
+ * to another server as well, if the hedge budget allows it.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ * @param id: module id.
+ */
+static void
+process_hedge(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie, int id)
+{
+	struct mesh_area* mesh = qstate->env->mesh;
+	struct delegpt_addr* target;
+	struct outbound_entry* outq;
+
+	verbose(VERB_ALGO, "process_hedge: hedge timer expired");
+	if(qstate->ext_state[id] != module_wait_reply || !iq->dp ||
+		iq->num_current_queries != 1 || iq->hedge_outq ||
+		!iq->hedge_target || iq->caps_fallback)
+		return;
+	if(mesh->hedge_window_hedges*100 >= mesh->hedge_window_queries*
+		(size_t)ie->hedge_budget) {
+		verbose(VERB_ALGO, "hedge budget exceeded");
+		return;
+	}
+	delegpt_add_unused_targets(iq->dp);
+	target = iter_hedge_selection(ie, qstate->env, iq->dp, iq->dp->name,
+		iq->dp->namelen, iq->qchase.qtype, iq->hedge_target,
+		qstate->blacklist);
+	if(!target) {
+		verbose(VERB_ALGO, "no other server for hedged query");
+		return;
+	}
+	if(!(iq->chase_flags & BIT_RD) && !iq->ratelimit_ok &&
+		!infra_ratelimit_inc(qstate->env->infra_cache, iq->dp->name,
+		iq->dp->namelen, *qstate->env->now)) {
+		verbose(VERB_ALGO, "hedged query exceeded ratelimits");
+		return;
+	}
+	if(verbosity >= VERB_QUERY) {
+		log_query_info(VERB_QUERY, "sending hedged query:",
+			&iq->qinfo_out);
+		log_name_addr(VERB_QUERY, "sending to target:", iq->dp->name, 
+			&target->addr, target->addrlen);
+	}
+	outq = iter_send_to_target(qstate, iq, ie, target);
+	if(!outq) {
+		log_addr(VERB_DETAIL, "error sending hedged query to auth "
+			"server", &target->addr, target->addrlen);
+		if(!(iq->chase_flags & BIT_RD) && !iq->ratelimit_ok)
+		    infra_ratelimit_dec(qstate->env->infra_cache, iq->dp->name,
+			iq->dp->namelen, *qstate->env->now);
+		return;
+	}
+	outbound_list_insert(&iq->outlist, outq);
+	iq->num_current_queries++;
+	iq->sent_count++;
+	iq->hedge_outq = outq;
+	mesh->num_hedge_sent++;
+	mesh->hedge_window_hedges++;
+}
+
+/**
+ * A reply arrived while a hedged query is outstanding. The other
+ * queries are no longer needed and are cancelled.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param outbound: the entry for the reply.
+ */
+static void
+hedge_finish(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct outbound_entry* outbound)
+{
+	struct outbound_entry* e, *n;
+	if(outbound == iq->hedge_outq) {
+		verbose(VERB_ALGO, "hedged query answered first");
+		qstate->env->mesh->num_hedge_won++;
+	}
+	for(e = iq->outlist.first; e; e = n) {
+		n = e->next;
+		if(e == outbound)
+			continue;
+		outbound_list_remove(&iq->outlist, e);
+		iq->num_current_queries--;
+	}
+	iq->hedge_outq = NULL;
+}
+
 /** process authoritative server reply */
 static void
 process_response(struct module_qstate* qstate, struct iter_qstate* iq, 
@@ -3104,6 +3275,13 @@ process_response(struct module_qstate* qstate, struct iter_qstate* iq,
 	verbose(VERB_ALGO, "process_response: new external response event");
 	iq->response = NULL;
 	iq->state = QUERY_RESP_STATE;
+	if(iq->hedge_outq) {
+		if(event == module_event_reply ||
+			event == module_event_capsfail)
+			hedge_finish(qstate, iq, outbound);
+		else if(outbound == iq->hedge_outq)
+			iq->hedge_outq = NULL; /* the first is still waiting */
+	}
 	if(event == module_event_noreply || event == module_event_error) {
 		if(event == module_event_noreply && iq->sent_count >= 3 &&
 			qstate->env->cfg->use_caps_bits_for_id &&
@@ -3283,6 +3461,10 @@ iter_operate(struct module_qstate* qstate, enum module_ev event, int id,
 		iter_handle(qstate, iq, ie, id);
 		return;
 	}
+	if(iq && outbound && event == module_event_hedge) {
+		process_hedge(qstate, iq, ie, id);
+		return;
+	}
 	if(iq && outbound) {
 		process_response(qstate, iq, ie, id, outbound, event);
 		return;
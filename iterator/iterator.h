@@ -46,6 +46,7 @@
 #include "util/data/msgreply.h"
 #include "util/module.h"
 struct delegpt;
+struct delegpt_addr;
 struct iter_hints;
 struct iter_forwards;
 struct iter_donotq;
@@ -97,6 +98,9 @@ struct rbtree_type;
 #define RTT_BAND 400
 /** Start value for blacklisting a host, 2*USEFUL_SERVER_TOP_TIMEOUT in sec */
 #define INFRA_BACKOFF_INITIAL 240
+/** number of upstream queries in the window that the hedge budget is
+ * computed over, the counts are halved when it is reached */
+#define HEDGE_WINDOW 1024
 
 /**
  * Global state for the iterator. 
@@ -132,6 +136,13 @@ struct iter_env {
 
 	/** ip6.arpa dname in wireformat, used for qname-minimisation */
 	uint8_t* ip6arpa_dname;
+
+	/** percentile of the server roundtrip time after which a hedged
+	 * query is sent to another server, 0 is disabled */
+	int hedge_percentile;
+
+	/** max percentage of upstream queries that may be hedged queries */
+	int hedge_budget;
 };
 
 /**
@@ -366,6 +377,13 @@ struct iter_qstate {
 	/** list of pending queries to authoritative servers. */
 	struct outbound_list outlist;
 
+	/** the target the last query was sent to, while the hedge timer
+	 * for it runs; the hedged query is sent elsewhere */
+	struct delegpt_addr* hedge_target;
+
+	/** the hedged query that is outstanding, or NULL */
+	struct outbound_entry* hedge_outq;
+
 	/** QNAME minimisation state, RFC7816 */
 	enum minimisation_state minimisation_state;
 
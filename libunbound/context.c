@@ -49,6 +49,7 @@
 #include "services/cache/infra.h"
 #include "util/data/msgreply.h"
 #include "util/storage/slabhash.h"
+#include "util/tube.h"
 #include "sldns/sbuffer.h"
 
 int 
@@ -68,17 +69,17 @@ context_finalize(struct ub_ctx* ctx)
 		return UB_NOMEM;
 	if(!local_zones_apply_cfg(ctx->local_zones, cfg))
 		return UB_INITFAIL;
-	if(!ctx->env->msg_cache ||
-	   cfg->msg_cache_size != slabhash_get_size(ctx->env->msg_cache) || 
-	   cfg->msg_cache_slabs != ctx->env->msg_cache->size) {
-		slabhash_delete(ctx->env->msg_cache);
+	if(!ctx->env->msg_cache) {
 		ctx->env->msg_cache = slabhash_create(cfg->msg_cache_slabs,
 			HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size,
 			msgreply_sizefunc, query_info_compare,
-			query_entry_delete, reply_info_delete, NULL);
+			query_entry_delete, reply_info_delete,
+			&ctx->superalloc);
 		if(!ctx->env->msg_cache)
 			return UB_NOMEM;
-	}
+	} else if(!slabhash_adjust(ctx->env->msg_cache, cfg->msg_cache_slabs,
+		cfg->msg_cache_size))
+		return UB_NOMEM;
 	ctx->env->rrset_cache = rrset_cache_adjust(ctx->env->rrset_cache,
 		ctx->env->cfg, ctx->env->alloc);
 	if(!ctx->env->rrset_cache)
@@ -207,8 +208,16 @@ context_release_alloc(struct ub_ctx* ctx, struct alloc_cache* alloc,
 	}
 }
 
-uint8_t* 
-context_serialize_new_query(struct ctx_query* q, uint32_t* len)
+/** length of a serialized new query */
+static size_t
+new_query_len(struct ctx_query* q)
+{
+	return sizeof(uint32_t)*4 + strlen(q->res->qname) + 1/*end of string*/;
+}
+
+/** write a new query, into space of new_query_len */
+static void
+new_query_write(uint8_t* p, struct ctx_query* q)
 {
 	/* format for new query is
 	 * 	o uint32 cmd
@@ -217,16 +226,22 @@ context_serialize_new_query(struct ctx_query* q, uint32_t* len)
 	 * 	o uint32 class
 	 * 	o rest queryname (string)
 	 */
-	uint8_t* p;
 	size_t slen = strlen(q->res->qname) + 1/*end of string*/;
-	*len = sizeof(uint32_t)*4 + slen;
-	p = (uint8_t*)malloc(*len);
-	if(!p) return NULL;
 	sldns_write_uint32(p, UB_LIBCMD_NEWQUERY);
 	sldns_write_uint32(p+sizeof(uint32_t), (uint32_t)q->querynum);
 	sldns_write_uint32(p+2*sizeof(uint32_t), (uint32_t)q->res->qtype);
 	sldns_write_uint32(p+3*sizeof(uint32_t), (uint32_t)q->res->qclass);
 	memmove(p+4*sizeof(uint32_t), q->res->qname, slen);
+}
+
+uint8_t* 
+context_serialize_new_query(struct ctx_query* q, uint32_t* len)
+{
+	uint8_t* p;
+	*len = (uint32_t)new_query_len(q);
+	p = (uint8_t*)malloc(*len);
+	if(!p) return NULL;
+	new_query_write(p, q);
 	return p;
 }
 
@@ -281,9 +296,18 @@ context_lookup_new_query(struct ub_ctx* ctx, uint8_t* p, uint32_t len)
 	return q;
 }
 
-uint8_t* 
-context_serialize_answer(struct ctx_query* q, int err, sldns_buffer* pkt,
-	uint32_t* len)
+/** length of a serialized answer */
+static size_t
+answer_len(struct ctx_query* q, sldns_buffer* pkt)
+{
+	size_t pkt_len = pkt?sldns_buffer_remaining(pkt):0;
+	size_t wlen = (pkt&&q->res->why_bogus)?strlen(q->res->why_bogus)+1:0;
+	return sizeof(uint32_t)*5 + pkt_len + wlen;
+}
+
+/** write an answer, into space of answer_len */
+static void
+answer_write(uint8_t* p, struct ctx_query* q, int err, sldns_buffer* pkt)
 {
 	/* answer format
 	 * 	o uint32 cmd
@@ -297,10 +321,6 @@ context_serialize_answer(struct ctx_query* q, int err, sldns_buffer* pkt,
 	 */
 	size_t pkt_len = pkt?sldns_buffer_remaining(pkt):0;
 	size_t wlen = (pkt&&q->res->why_bogus)?strlen(q->res->why_bogus)+1:0;
-	uint8_t* p;
-	*len = sizeof(uint32_t)*5 + pkt_len + wlen;
-	p = (uint8_t*)malloc(*len);
-	if(!p) return NULL;
 	sldns_write_uint32(p, UB_LIBCMD_ANSWER);
 	sldns_write_uint32(p+sizeof(uint32_t), (uint32_t)q->querynum);
 	sldns_write_uint32(p+2*sizeof(uint32_t), (uint32_t)err);
@@ -311,6 +331,17 @@ context_serialize_answer(struct ctx_query* q, int err, sldns_buffer* pkt,
 	if(pkt_len > 0)
 		memmove(p+5*sizeof(uint32_t)+wlen, 
 			sldns_buffer_begin(pkt), pkt_len);
+}
+
+uint8_t* 
+context_serialize_answer(struct ctx_query* q, int err, sldns_buffer* pkt,
+	uint32_t* len)
+{
+	uint8_t* p;
+	*len = (uint32_t)answer_len(q, pkt);
+	p = (uint8_t*)malloc(*len);
+	if(!p) return NULL;
+	answer_write(p, q, err, pkt);
 	return p;
 }
 
@@ -392,6 +423,119 @@ context_serialize_quit(uint32_t* len)
 	return p;
 }
 
+void
+context_batch_start(sldns_buffer* buf, enum ub_ctx_cmd cmd)
+{
+	sldns_buffer_clear(buf);
+	sldns_buffer_write_u32(buf, (uint32_t)cmd);
+	sldns_buffer_write_u32(buf, 0);
+}
+
+/** make space for an entry in the batch, returns pointer to the entry */
+static uint8_t*
+batch_add_entry(sldns_buffer* buf, size_t len)
+{
+	uint8_t* p;
+	if(len > 0xffffffff - sizeof(uint32_t) - sldns_buffer_position(buf))
+		return NULL;
+	if(!sldns_buffer_reserve(buf, sizeof(uint32_t) + len))
+		return NULL;
+	sldns_buffer_write_u32(buf, (uint32_t)len);
+	p = sldns_buffer_current(buf);
+	sldns_buffer_skip(buf, (ssize_t)len);
+	sldns_buffer_write_u32_at(buf, sizeof(uint32_t),
+		sldns_buffer_read_u32_at(buf, sizeof(uint32_t))+1);
+	return p;
+}
+
+int
+context_batch_add_query(sldns_buffer* buf, struct ctx_query* q)
+{
+	uint8_t* p = batch_add_entry(buf, new_query_len(q));
+	if(!p) return 0;
+	new_query_write(p, q);
+	return 1;
+}
+
+int
+context_batch_add_answer(sldns_buffer* buf, struct ctx_query* q, int err,
+	sldns_buffer* pkt)
+{
+	uint8_t* p = batch_add_entry(buf, answer_len(q, pkt));
+	if(!p) return 0;
+	answer_write(p, q, err, pkt);
+	return 1;
+}
+
+uint32_t
+context_batch_count(uint8_t* p, uint32_t len)
+{
+	if((size_t)len < 2*sizeof(uint32_t))
+		return 0;
+	return sldns_read_uint32(p+sizeof(uint32_t));
+}
+
+int
+context_batch_next(uint8_t* p, uint32_t len, uint32_t* pos,
+	uint8_t** entry, uint32_t* entry_len)
+{
+	uint32_t elen;
+	if(*pos == 0)
+		*pos = 2*sizeof(uint32_t); /* skip cmd and count */
+	if(*pos > len || len - *pos < sizeof(uint32_t))
+		return 0;
+	elen = sldns_read_uint32(p+*pos);
+	if(elen > len - *pos - sizeof(uint32_t))
+		return 0;
+	*entry = p + *pos + sizeof(uint32_t);
+	*entry_len = elen;
+	*pos += sizeof(uint32_t) + elen;
+	return 1;
+}
+
+void
+context_result_push(struct ub_ctx* ctx, struct ctx_query* q, int err)
+{
+	q->result_err = err;
+	q->next_result = NULL;
+	lock_basic_lock(&ctx->rrlist_lock);
+	if(ctx->rr_last)
+		ctx->rr_last->next_result = q;
+	else	ctx->rr_list = q;
+	ctx->rr_last = q;
+	if(!ctx->rr_signalled) {
+		/* written with the lock held, so it is not mixed with writes
+		 * from other threads.  There is only one of these on the
+		 * pipe at a time, so the write does not block for long. */
+		uint8_t cmd[sizeof(uint32_t)];
+		sldns_write_uint32(cmd, UB_LIBCMD_RESULTS);
+		ctx->rr_signalled = 1;
+		if(!tube_write_msg(ctx->rr_pipe, cmd, (uint32_t)sizeof(cmd), 0))
+			log_err("libunbound: could not signal result");
+	}
+	lock_basic_unlock(&ctx->rrlist_lock);
+}
+
+struct ctx_query*
+context_result_take(struct ub_ctx* ctx)
+{
+	struct ctx_query* list;
+	lock_basic_lock(&ctx->rrlist_lock);
+	list = ctx->rr_list;
+	ctx->rr_list = NULL;
+	ctx->rr_last = NULL;
+	lock_basic_unlock(&ctx->rrlist_lock);
+	return list;
+}
+
+void
+context_result_signal_clear(struct ub_ctx* ctx)
+{
+	lock_basic_lock(&ctx->rrlist_lock);
+	ctx->rr_signalled = 0;
+	lock_basic_unlock(&ctx->rrlist_lock);
+}
+
 enum ub_ctx_cmd context_serial_getcmd(uint8_t* p, uint32_t len)
 {
 	uint32_t v;
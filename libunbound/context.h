@@ -68,6 +68,23 @@ struct ub_ctx {
 	lock_basic_type rrpipe_lock;
 	/** the result read pipe */
 	struct tube* rr_pipe;
+	/** mutex on the result list, and on the writes of the bg threads
+	 * to the result pipe.  It is held for a couple of pointer updates,
+	 * the threads add results and the reader takes the whole list. */
+	lock_basic_type rrlist_lock;
+	/** results from the bg worker threads.  The threads fill in the
+	 * ub_result of the query, and put the query in this list, that
+	 * hands them to the application without serialization.
+	 * A UB_LIBCMD_RESULTS message on the rr_pipe signals that the list
+	 * has results, so that ub_fd and ub_wait work with the pipe. */
+	struct ctx_query* rr_list;
+	/** last in the result list */
+	struct ctx_query* rr_last;
+	/** if a UB_LIBCMD_RESULTS message is on the pipe, not read yet */
+	int rr_signalled;
+	/** buffer to serialize batches of new queries in, protected by
+	 * the qqpipe_lock, it is reused for every batch. NULL until used. */
+	struct sldns_buffer* qq_batch;
 
 	/* --- shared data --- */
 	/** mutex for access to env.cfg, finalized and dothread */
@@ -85,6 +102,16 @@ struct ub_ctx {
 	pid_t bg_pid;
 	/** tid of bg worker thread */
 	ub_thread_type bg_tid;
+	/** number of bg worker threads, from num-threads, 0 if forked */
+	int bg_num;
+	/** query pipes of the bg worker threads, array of bg_num, the
+	 * first is the qq_pipe, new queries are spread over the pipes.
+	 * protected by the qqpipe_lock. */
+	struct tube** bg_pipes;
+	/** tids of the bg worker threads, array of bg_num */
+	ub_thread_type* bg_tids;
+	/** the bg worker that gets the next query */
+	int bg_next;
 
 	/** do threading (instead of forking) for async resolution */
 	int dothread;
@@ -165,6 +192,11 @@ struct ctx_query {
 	/** result structure, also contains original query, type, class.
 	 * malloced ptr ready to hand to the client. */
 	struct ub_result* res;
+
+	/** next in the result list of the context, for bg threads */
+	struct ctx_query* next_result;
+	/** error code for the callback, for the result list */
+	int result_err;
 };
 
 /**
@@ -212,9 +244,27 @@ enum ub_ctx_cmd {
 	/** Cancel query, sent to bg worker */
 	UB_LIBCMD_CANCEL,
 	/** Query result, originates from bg worker */
-	UB_LIBCMD_ANSWER
+	UB_LIBCMD_ANSWER,
+	/** Batch of new queries, sent to bg worker */
+	UB_LIBCMD_NEWQUERY_BATCH,
+	/** Batch of query results, originates from bg worker */
+	UB_LIBCMD_ANSWER_BATCH,
+	/** There are results in the result list, from bg worker threads */
+	UB_LIBCMD_RESULTS
 };
 
+/**
+ * Batch messages look like this:
+ *	o uint32 command code.
+ *	o uint32 number of entries.
+ *	o per entry, uint32 length and then the entry, in the format of
+ *	  the single command (new query or answer), with its command code.
+ * The max number of entries in a batch, larger batches are split up.
+ */
+#define UB_LIBCMD_BATCH_MAX 256
+/** initial size of the buffer for a batch, it grows if needed */
+#define UB_LIBCMD_BATCH_BUFSIZE 16384
+
 /** 
  * finalize a context.
  * @param ctx: context to finalize. creates shared data.
@@ -300,6 +350,76 @@ uint8_t* context_serialize_cancel(struct ctx_query* q, uint32_t* len);
  */
 uint8_t* context_serialize_quit(uint32_t* len);
 
+/**
+ * Start a batch message in the buffer, with no entries.
+ * @param buf: buffer, it is cleared.
+ * @param cmd: command code, UB_LIBCMD_NEWQUERY_BATCH or ANSWER_BATCH.
+ */
+void context_batch_start(struct sldns_buffer* buf, enum ub_ctx_cmd cmd);
+
+/**
+ * Add a new query to a batch, like context_serialize_new_query.
+ * @param buf: buffer with the batch, it grows if needed.
+ * @param q: context query
+ * @return false on mem error, the batch is unchanged.
+ */
+int context_batch_add_query(struct sldns_buffer* buf, struct ctx_query* q);
+
+/**
+ * Add an answer to a batch, like context_serialize_answer.
+ * @param buf: buffer with the batch, it grows if needed.
+ * @param q: context query
+ * @param err: error code to pass to client.
+ * @param pkt: the packet to add, can be NULL.
+ * @return false on mem error, the batch is unchanged.
+ */
+int context_batch_add_answer(struct sldns_buffer* buf, struct ctx_query* q,
+	int err, struct sldns_buffer* pkt);
+
+/**
+ * Number of entries in a batch message.
+ * @param p: buffer serialized.
+ * @param len: length of buffer.
+ * @return number of entries, 0 on error.
+ */
+uint32_t context_batch_count(uint8_t* p, uint32_t len);
+
+/**
+ * Get the next entry from a batch message.
+ * @param p: buffer serialized.
+ * @param len: length of buffer.
+ * @param pos: position in the buffer, start with 0, it is advanced.
+ * @param entry: returns the entry, a single command.
+ * @param entry_len: returns the length of the entry.
+ * @return false if there are no more entries (or the rest is malformed).
+ */
+int context_batch_next(uint8_t* p, uint32_t len, uint32_t* pos,
+	uint8_t** entry, uint32_t* entry_len);
+
+/**
+ * Add a result to the result list of the context, for the bg worker
+ * threads, and signal the application over the result pipe if needed.
+ * @param ctx: context
+ * @param q: the query, with its result filled in.  It is still in the
+ *	query tree, the reader takes it out.
+ * @param err: error code for the callback, if nonzero there is no result.
+ */
+void context_result_push(struct ub_ctx* ctx, struct ctx_query* q, int err);
+
+/**
+ * Take all the results from the result list of the context.
+ * @param ctx: context
+ * @return list of queries, linked with next_result, or NULL if empty.
+ */
+struct ctx_query* context_result_take(struct ub_ctx* ctx);
+
+/**
+ * The UB_LIBCMD_RESULTS signal has been read from the result pipe,
+ * new results have to signal again.
+ * @param ctx: context
+ */
+void context_result_signal_clear(struct ub_ctx* ctx);
+
 /**
  * Obtain command code from serialized buffer
  * @param p: buffer serialized.
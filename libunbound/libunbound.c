@@ -57,6 +57,8 @@
 #include "util/random.h"
 #include "util/net_help.h"
 #include "util/tube.h"
+#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/ub_event.h"
 #include "services/modstack.h"
 #include "services/localzone.h"
@@ -114,8 +116,26 @@ static struct ub_ctx* ub_ctx_create_nopipe(void)
 		return NULL;
 	}
 	seed = 0;
+	if(1) {
+		/* the hash keys are shared by all contexts, set them once,
+		 * before any worker of this context can hash with them.
+		 * Contexts created at the same time in different threads
+		 * may clash, that is like wiping the (still empty) cache */
+		static int done_raninit = 0;
+		if(!done_raninit) {
+			uint8_t hashkey[KEYHASH_KEYSIZE];
+			size_t i;
+			done_raninit = 1;
+			hash_set_raninit((uint32_t)ub_random(ctx->seed_rnd));
+			for(i=0; i<sizeof(hashkey); i++)
+				hashkey[i] = (uint8_t)ub_random_max(
+					ctx->seed_rnd, 256);
+			keyhash_set_key(hashkey);
+		}
+	}
 	lock_basic_init(&ctx->qqpipe_lock);
 	lock_basic_init(&ctx->rrpipe_lock);
+	lock_basic_init(&ctx->rrlist_lock);
 	lock_basic_init(&ctx->cfglock);
 	ctx->env = (struct module_env*)calloc(1, sizeof(*ctx->env));
 	if(!ctx->env) {
@@ -230,10 +250,14 @@ static void ub_stop_bg(struct ub_ctx* ctx)
 		uint8_t* msg;
 		uint32_t len;
 		uint32_t cmd = UB_LIBCMD_QUIT;
+		int i;
 		lock_basic_unlock(&ctx->cfglock);
 		lock_basic_lock(&ctx->qqpipe_lock);
 		(void)tube_write_msg(ctx->qq_pipe, (uint8_t*)&cmd, 
 			(uint32_t)sizeof(cmd), 0);
+		for(i=1; i<ctx->bg_num; i++)
+			(void)tube_write_msg(ctx->bg_pipes[i], (uint8_t*)&cmd,
+				(uint32_t)sizeof(cmd), 0);
 		lock_basic_unlock(&ctx->qqpipe_lock);
 		lock_basic_lock(&ctx->rrpipe_lock);
 		while(tube_read_msg(ctx->rr_pipe, &msg, &len, 0)) {
@@ -251,7 +275,8 @@ static void ub_stop_bg(struct ub_ctx* ctx)
 		lock_basic_lock(&ctx->cfglock);
 		if(ctx->dothread) {
 			lock_basic_unlock(&ctx->cfglock);
-			ub_thread_join(ctx->bg_tid);
+			for(i=0; i<ctx->bg_num; i++)
+				ub_thread_join(ctx->bg_tids[i]);
 		} else {
 			lock_basic_unlock(&ctx->cfglock);
 #ifndef UB_ON_WINDOWS
@@ -271,7 +296,7 @@ void
 ub_ctx_delete(struct ub_ctx* ctx)
 {
 	struct alloc_cache* a, *na;
-	int do_stop = 1;
+	int do_stop = 1, i;
 	if(!ctx) return;
 
 	/* see if bg thread is created and if threads have been killed */
@@ -302,8 +327,14 @@ ub_ctx_delete(struct ub_ctx* ctx)
 	lock_basic_destroy(&ctx->qqpipe_lock);
 	lock_basic_destroy(&ctx->rrpipe_lock);
 	lock_basic_destroy(&ctx->cfglock);
+	lock_basic_destroy(&ctx->rrlist_lock);
 	tube_delete(ctx->qq_pipe);
 	tube_delete(ctx->rr_pipe);
+	for(i=1; i<ctx->bg_num; i++)
+		tube_delete(ctx->bg_pipes[i]);
+	free(ctx->bg_pipes);
+	free(ctx->bg_tids);
+	sldns_buffer_free(ctx->qq_batch);
 	if(ctx->env) {
 		slabhash_delete(ctx->env->msg_cache);
 		rrset_cache_delete(ctx->env->rrset_cache);
@@ -487,8 +518,15 @@ ub_ctx_async(struct ub_ctx* ctx, int dothread)
 int 
 ub_poll(struct ub_ctx* ctx)
 {
+	int r;
 	/* no need to hold lock while testing for readability. */
-	return tube_poll(ctx->rr_pipe);
+	if(tube_poll(ctx->rr_pipe))
+		return 1;
+	/* the signal for the result list may have been read already */
+	lock_basic_lock(&ctx->rrlist_lock);
+	r = (ctx->rr_list != NULL);
+	lock_basic_unlock(&ctx->rrlist_lock);
+	return r;
 }
 
 int 
@@ -562,6 +600,56 @@ process_answer_detail(struct ub_ctx* ctx, uint8_t* msg, uint32_t len,
 	return 1;
 }
 
+/** an answer that is ready for the callback */
+struct ub_completion {
+	/** callback, or NULL if there is none */
+	ub_callback_type cb;
+	/** the callback user arg */
+	void* cbarg;
+	/** error code */
+	int err;
+	/** the result */
+	struct ub_result* res;
+};
+
+/** process a batch of answers from bg worker, the callbacks to do are
+ * returned in the list, that has space for UB_LIBCMD_BATCH_MAX entries */
+static int
+process_answer_batch(struct ub_ctx* ctx, uint8_t* msg, uint32_t len,
+	struct ub_completion* list, size_t* num)
+{
+	uint32_t pos = 0, elen;
+	uint8_t* e;
+	int r;
+	*num = 0;
+	if(context_serial_getcmd(msg, len) != UB_LIBCMD_ANSWER_BATCH ||
+		context_batch_count(msg, len) > UB_LIBCMD_BATCH_MAX) {
+		log_err("error: bad data from bg worker %d",
+			(int)context_serial_getcmd(msg, len));
+		return 0;
+	}
+	while(*num < UB_LIBCMD_BATCH_MAX &&
+		context_batch_next(msg, len, &pos, &e, &elen)) {
+		struct ub_completion* c = &list[*num];
+		r = process_answer_detail(ctx, e, elen, &c->cb, &c->cbarg,
+			&c->err, &c->res);
+		if(r == 0)
+			return 0;
+		if(r == 2)
+			(*num)++;
+	}
+	return 1;
+}
+
+/** do the callbacks for a list of answers, without locks held */
+static void
+deliver_answers(struct ub_completion* list, size_t num)
+{
+	size_t i;
+	for(i=0; i<num; i++)
+		(*list[i].cb)(list[i].cbarg, list[i].err, list[i].res);
+}
+
 /** process answer from bg worker */
 static int
 process_answer(struct ub_ctx* ctx, uint8_t* msg, uint32_t len)
@@ -572,6 +660,14 @@ process_answer(struct ub_ctx* ctx, uint8_t* msg, uint32_t len)
 	struct ub_result* res;
 	int r;
 
+	if(context_serial_getcmd(msg, len) == UB_LIBCMD_ANSWER_BATCH) {
+		struct ub_completion list[UB_LIBCMD_BATCH_MAX];
+		size_t num;
+		r = process_answer_batch(ctx, msg, len, list, &num);
+		/* the answers that were processed are delivered */
+		deliver_answers(list, num);
+		return r;
+	}
 	r = process_answer_detail(ctx, msg, len, &cb, &cbarg, &err, &res);
 
 	/* no locks held while calling callback, so that library is
@@ -582,21 +678,88 @@ process_answer(struct ub_ctx* ctx, uint8_t* msg, uint32_t len)
 	return r;
 }
 
+/** take the results from the bg threads out of the query tree, the
+ * rrpipe_lock is held, so that num_async is correct for ub_wait */
+static void
+process_result_list(struct ub_ctx* ctx, struct ctx_query* list)
+{
+	struct ctx_query* q;
+	lock_basic_lock(&ctx->cfglock);
+	for(q = list; q; q = q->next_result) {
+		(void)rbtree_delete(&ctx->queries, q->node.key);
+		ctx->num_async--;
+		if(q->cancelled)
+			q->cb = NULL;
+	}
+	lock_basic_unlock(&ctx->cfglock);
+}
+
+/** do the callbacks for the results from the bg threads, no locks held */
+static void
+deliver_result_list(struct ctx_query* list)
+{
+	struct ctx_query* q, *next;
+	struct ub_result* res;
+	for(q = list; q; q = next) {
+		next = q->next_result;
+		if(q->cb) {
+			res = NULL;
+			if(!q->result_err) {
+				res = q->res;
+				q->res = NULL;
+			}
+			(*q->cb)(q->cb_arg, q->result_err, res);
+		}
+		context_query_delete(q);
+	}
+}
+
+/** read the next results, the result list of the bg threads or a message
+ * from the pipe, with the rrpipe_lock held.  Returns 2 for a result list,
+ * that is taken out of the query tree, 1 for a message, 0 if the pipe is
+ * closed, -1 if there is nothing to read. */
+static int
+read_result(struct ub_ctx* ctx, struct ctx_query** list, uint8_t** msg,
+	uint32_t* len)
+{
+	int r;
+	while(1) {
+		if((*list = context_result_take(ctx)) != NULL) {
+			process_result_list(ctx, *list);
+			return 2;
+		}
+		r = tube_read_msg(ctx->rr_pipe, msg, len, 1);
+		if(r != 1 || context_serial_getcmd(*msg, *len) !=
+			UB_LIBCMD_RESULTS)
+			return r;
+		/* the signal for the list, look in the list again, results
+		 * that are added from now on signal again */
+		free(*msg);
+		*msg = NULL;
+		context_result_signal_clear(ctx);
+	}
+}
+
 int 
 ub_process(struct ub_ctx* ctx)
 {
 	int r;
 	uint8_t* msg;
 	uint32_t len;
+	struct ctx_query* list;
 	while(1) {
 		msg = NULL;
 		lock_basic_lock(&ctx->rrpipe_lock);
-		r = tube_read_msg(ctx->rr_pipe, &msg, &len, 1);
+		r = read_result(ctx, &list, &msg, &len);
 		lock_basic_unlock(&ctx->rrpipe_lock);
 		if(r == 0)
 			return UB_PIPE;
 		else if(r == -1)
 			break;
+		else if(r == 2) {
+			deliver_result_list(list);
+			continue;
+		}
 		if(!process_answer(ctx, msg, len)) {
 			free(msg);
 			return UB_PIPE;
@@ -616,6 +779,7 @@ ub_wait(struct ub_ctx* ctx)
 	int r;
 	uint8_t* msg;
 	uint32_t len;
+	struct ctx_query* list;
 	/* this is basically the same loop as _process(), but with changes.
 	 * holds the rrpipe lock and waits with tube_wait */
 	while(1) {
@@ -634,28 +798,41 @@ ub_wait(struct ub_ctx* ctx)
 		 * 	o possibly decrementing num_async
 		 * do callback without lock
 		 */
-		r = tube_wait(ctx->rr_pipe);
-		if(r) {
-			r = tube_read_msg(ctx->rr_pipe, &msg, &len, 1);
-			if(r == 0) {
-				lock_basic_unlock(&ctx->rrpipe_lock);
-				return UB_PIPE;
-			}
-			if(r == -1) {
-				lock_basic_unlock(&ctx->rrpipe_lock);
-				continue;
-			}
-			r = process_answer_detail(ctx, msg, len, 
-				&cb, &cbarg, &err, &res);
+		r = read_result(ctx, &list, &msg, &len);
+		if(r == 2) {
+			lock_basic_unlock(&ctx->rrpipe_lock);
+			deliver_result_list(list);
+			continue;
+		}
+		if(r == -1) {
+			/* nothing to read, wait until the pipe is readable */
+			(void)tube_wait(ctx->rr_pipe);
+			lock_basic_unlock(&ctx->rrpipe_lock);
+			continue;
+		}
+		if(r == 0) {
+			lock_basic_unlock(&ctx->rrpipe_lock);
+			return UB_PIPE;
+		}
+		if(context_serial_getcmd(msg, len) == UB_LIBCMD_ANSWER_BATCH) {
+			struct ub_completion list[UB_LIBCMD_BATCH_MAX];
+			size_t num;
+			r = process_answer_batch(ctx, msg, len, list, &num);
 			lock_basic_unlock(&ctx->rrpipe_lock);
 			free(msg);
+			deliver_answers(list, num);
 			if(r == 0)
 				return UB_PIPE;
-			if(r == 2)
-				(*cb)(cbarg, err, res);
-		} else {
-			lock_basic_unlock(&ctx->rrpipe_lock);
+			continue;
 		}
+		r = process_answer_detail(ctx, msg, len, 
+			&cb, &cbarg, &err, &res);
+		lock_basic_unlock(&ctx->rrpipe_lock);
+		free(msg);
+		if(r == 0)
+			return UB_PIPE;
+		if(r == 2)
+			(*cb)(cbarg, err, res);
 	}
 	return UB_NOERROR;
 }
@@ -747,16 +924,22 @@ ub_resolve_event(struct ub_ctx* ctx, const char* name, int rrtype,
 }
 
 
-int 
-ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype, 
-	int rrclass, void* mydata, ub_callback_type callback, int* async_id)
+/** the query pipe of the bg worker for the next query, the queries are
+ * spread over the bg threads.  qqpipe_lock is held. */
+static struct tube*
+ub_next_pipe(struct ub_ctx* ctx)
 {
-	struct ctx_query* q;
-	uint8_t* msg = NULL;
-	uint32_t len = 0;
+	if(ctx->bg_num < 2)
+		return ctx->qq_pipe;
+	if(++ctx->bg_next >= ctx->bg_num)
+		ctx->bg_next = 0;
+	return ctx->bg_pipes[ctx->bg_next];
+}
 
-	if(async_id)
-		*async_id = 0;
+/** finalize the context and start the bg worker, if not done already */
+static int
+ub_start_bg(struct ub_ctx* ctx)
+{
 	lock_basic_lock(&ctx->cfglock);
 	if(!ctx->finalized) {
 		int r = context_finalize(ctx);
@@ -779,6 +962,22 @@ ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype,
 	} else {
 		lock_basic_unlock(&ctx->cfglock);
 	}
+	return UB_NOERROR;
+}
+
+int 
+ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype, 
+	int rrclass, void* mydata, ub_callback_type callback, int* async_id)
+{
+	struct ctx_query* q;
+	uint8_t* msg = NULL;
+	uint32_t len = 0;
+	int r;
+
+	if(async_id)
+		*async_id = 0;
+	if((r=ub_start_bg(ctx)) != UB_NOERROR)
+		return r;
 
 	/* create new ctx_query and attempt to add to the list */
 	q = context_new(ctx, name, rrtype, rrclass, callback, mydata);
@@ -800,7 +999,7 @@ ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype,
 	lock_basic_unlock(&ctx->cfglock);
 	
 	lock_basic_lock(&ctx->qqpipe_lock);
-	if(!tube_write_msg(ctx->qq_pipe, msg, len, 0)) {
+	if(!tube_write_msg(ub_next_pipe(ctx), msg, len, 0)) {
 		lock_basic_unlock(&ctx->qqpipe_lock);
 		free(msg);
 		return UB_PIPE;
@@ -810,6 +1009,98 @@ ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype,
 	return UB_NOERROR;
 }
 
+/** write the batch of new queries to the bg worker, qqpipe locked */
+static int
+ub_send_batch(struct ub_ctx* ctx)
+{
+	if(!tube_write_msg(ub_next_pipe(ctx), sldns_buffer_begin(ctx->qq_batch),
+		(uint32_t)sldns_buffer_position(ctx->qq_batch), 0))
+		return 0;
+	context_batch_start(ctx->qq_batch, UB_LIBCMD_NEWQUERY_BATCH);
+	return 1;
+}
+
+/** remove the queries that could not be sent to the bg worker, they have
+ * not been started and their async_id is set to 0 again */
+static void
+ub_batch_unsent(struct ub_ctx* ctx, struct ub_query* queries, int num)
+{
+	struct ctx_query* q;
+	int i;
+	lock_basic_lock(&ctx->cfglock);
+	for(i=0; i<num; i++) {
+		q = (struct ctx_query*)rbtree_search(&ctx->queries,
+			&queries[i].async_id);
+		if(q) {
+			(void)rbtree_delete(&ctx->queries, q->node.key);
+			ctx->num_async--;
+			context_query_delete(q);
+		}
+		queries[i].async_id = 0;
+	}
+	lock_basic_unlock(&ctx->cfglock);
+}
+
+int 
+ub_resolve_async_batch(struct ub_ctx* ctx, struct ub_query* queries,
+	int num, ub_callback_type callback)
+{
+	struct ctx_query* q;
+	int i, n = 0, r;
+
+	for(i=0; i<num; i++)
+		queries[i].async_id = 0;
+	if((r=ub_start_bg(ctx)) != UB_NOERROR)
+		return r;
+
+	/* the queries are serialized in the shared batch buffer, and
+	 * sent to the background worker UB_LIBCMD_BATCH_MAX at a time */
+	lock_basic_lock(&ctx->qqpipe_lock);
+	if(!ctx->qq_batch) {
+		ctx->qq_batch = sldns_buffer_new(UB_LIBCMD_BATCH_BUFSIZE);
+		if(!ctx->qq_batch) {
+			lock_basic_unlock(&ctx->qqpipe_lock);
+			return UB_NOMEM;
+		}
+	}
+	context_batch_start(ctx->qq_batch, UB_LIBCMD_NEWQUERY_BATCH);
+	for(i=0; i<num; i++) {
+		q = context_new(ctx, queries[i].name, queries[i].rrtype,
+			queries[i].rrclass, callback, queries[i].mydata);
+		if(!q) {
+			r = UB_NOMEM;
+			break;
+		}
+		lock_basic_lock(&ctx->cfglock);
+		if(!context_batch_add_query(ctx->qq_batch, q)) {
+			(void)rbtree_delete(&ctx->queries, q->node.key);
+			ctx->num_async--;
+			context_query_delete(q);
+			lock_basic_unlock(&ctx->cfglock);
+			r = UB_NOMEM;
+			break;
+		}
+		queries[i].async_id = q->querynum;
+		lock_basic_unlock(&ctx->cfglock);
+		if(++n == UB_LIBCMD_BATCH_MAX) {
+			if(!ub_send_batch(ctx)) {
+				ub_batch_unsent(ctx, queries+i+1-n, n);
+				lock_basic_unlock(&ctx->qqpipe_lock);
+				return UB_PIPE;
+			}
+			n = 0;
+		}
+	}
+	/* also on error, send the queries that have been started */
+	if(n > 0 && !ub_send_batch(ctx)) {
+		ub_batch_unsent(ctx, queries+i-n, n);
+		lock_basic_unlock(&ctx->qqpipe_lock);
+		return UB_PIPE;
+	}
+	lock_basic_unlock(&ctx->qqpipe_lock);
+	return r;
+}
+
 int 
 ub_cancel(struct ub_ctx* ctx, int async_id)
 {
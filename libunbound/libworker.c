@@ -75,6 +75,9 @@
 
 /** handle new query command for bg worker */
 static void handle_newq(struct libworker* w, uint8_t* buf, uint32_t len);
+/** handle batch of new queries for bg worker */
+static void handle_newq_batch(struct libworker* w, uint8_t* buf,
+	uint32_t len);
 
 /** delete libworker env */
 static void
@@ -96,6 +99,7 @@ libworker_delete_env(struct libworker* w)
 	SSL_CTX_free(w->sslctx);
 #endif
 	outside_network_delete(w->back);
+	sldns_buffer_free(w->answer_buf);
 }
 
 /** delete libworker struct */
@@ -129,6 +133,7 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct ub_event_base* eb)
 	if(!w) return NULL;
 	w->is_bg = is_bg;
 	w->ctx = ctx;
+	w->qq_pipe = ctx->qq_pipe;
 	w->env = (struct module_env*)malloc(sizeof(*w->env));
 	if(!w->env) {
 		free(w);
@@ -192,19 +197,6 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct ub_event_base* eb)
 	if(!w->is_bg || w->is_bg_thread) {
 		lock_basic_unlock(&ctx->cfglock);
 	}
-	if(1) {
-		/* primitive lockout for threading: if it overwrites another
-		 * thread it is like wiping the cache (which is likely empty
-		 * at the start) */
-		/* note we are holding the ctx lock in normal threaded
-		 * cases so that is solved properly, it is only for many ctx
-		 * in different threads that this may clash */
-		static int done_raninit = 0;
-		if(!done_raninit) {
-			done_raninit = 1;
-			hash_set_raninit((uint32_t)ub_random(w->env->rnd));
-		}
-	}
 	seed = 0;
 
 	if(eb)
@@ -234,7 +226,8 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct ub_event_base* eb)
 		ports, numports, cfg->unwanted_threshold,
 		cfg->outgoing_tcp_mss,
 		&libworker_alloc_cleanup, w, cfg->do_udp, w->sslctx,
-		cfg->delay_close, NULL);
+		cfg->delay_close, cfg->outgoing_udp_pool,
+		cfg->outgoing_udp_pool_rotate, cfg->outgoing_udp_pool_uses, NULL);
 	if(!w->is_bg || w->is_bg_thread) {
 		lock_basic_unlock(&ctx->cfglock);
 	}
@@ -249,7 +242,9 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct ub_event_base* eb)
 		return NULL;
 	}
 	w->env->send_query = &libworker_send_query;
+	w->env->hedge_query = &libworker_hedge_query;
 	w->env->detach_subs = &mesh_detach_subs;
+	w->env->cancel_subs = &mesh_cancel_subs;
 	w->env->attach_sub = &mesh_attach_sub;
 	w->env->kill_sub = &mesh_state_delete;
 	w->env->detect_cycle = &mesh_detect_cycle;
@@ -291,6 +286,7 @@ libworker_do_cmd(struct libworker* w, uint8_t* msg, uint32_t len)
 	switch(context_serial_getcmd(msg, len)) {
 		default:
 		case UB_LIBCMD_ANSWER:
+		case UB_LIBCMD_ANSWER_BATCH:
 			log_err("unknown command for bg worker %d", 
 				(int)context_serial_getcmd(msg, len));
 			/* and fall through to quit */
@@ -301,6 +297,9 @@ libworker_do_cmd(struct libworker* w, uint8_t* msg, uint32_t len)
 		case UB_LIBCMD_NEWQUERY:
 			handle_newq(w, msg, len);
 			break;
+		case UB_LIBCMD_NEWQUERY_BATCH:
+			handle_newq_batch(w, msg, len);
+			break;
 		case UB_LIBCMD_CANCEL:
 			handle_cancel(w, msg, len);
 			break;
@@ -329,6 +328,7 @@ libworker_dobg(void* arg)
 {
 	/* setup */
 	uint32_t m;
+	int is_thread;
 	struct libworker* w = (struct libworker*)arg;
 	struct ub_ctx* ctx;
 	if(!w) {
@@ -344,12 +344,13 @@ libworker_dobg(void* arg)
 	tube_close_write(ctx->qq_pipe);
 	tube_close_read(ctx->rr_pipe);
 #endif
-	if(!tube_setup_bg_listen(ctx->qq_pipe, w->base, 
+	if(!tube_setup_bg_listen(w->qq_pipe, w->base, 
 		libworker_handle_control_cmd, w)) {
 		log_err("libunbound bg worker init failed, no bglisten");
 		return NULL;
 	}
-	if(!tube_setup_bg_write(ctx->rr_pipe, w->base)) {
+	/* threads put their results in the result list of the context */
+	if(!w->is_bg_thread && !tube_setup_bg_write(ctx->rr_pipe, w->base)) {
 		log_err("libunbound bg worker init failed, no bgwrite");
 		return NULL;
 	}
@@ -359,11 +360,18 @@ libworker_dobg(void* arg)
 
 	/* cleanup */
 	m = UB_LIBCMD_QUIT;
-	tube_remove_bg_listen(w->ctx->qq_pipe);
-	tube_remove_bg_write(w->ctx->rr_pipe);
+	is_thread = w->is_bg_thread;
+	tube_remove_bg_listen(w->qq_pipe);
+	if(!is_thread)
+		tube_remove_bg_write(w->ctx->rr_pipe);
 	libworker_delete(w);
+	/* the threads write to the pipe with the result list lock */
+	if(is_thread)
+		lock_basic_lock(&ctx->rrlist_lock);
 	(void)tube_write_msg(ctx->rr_pipe, (uint8_t*)&m, 
 		(uint32_t)sizeof(m), 0);
+	if(is_thread)
+		lock_basic_unlock(&ctx->rrlist_lock);
 #ifdef THREADS_DISABLED
 	/* close pipes from forked process before exit */
 	tube_close_read(ctx->qq_pipe);
@@ -372,20 +380,70 @@ libworker_dobg(void* arg)
 	return NULL;
 }
 
+/** start the bg worker threads, every thread has its own query pipe */
+static int
+libworker_bg_threads(struct ub_ctx* ctx, int num)
+{
+	struct libworker* w;
+	struct tube** pipes;
+	ub_thread_type* tids;
+	int i, j;
+	pipes = (struct tube**)calloc((size_t)num, sizeof(*pipes));
+	tids = (ub_thread_type*)calloc((size_t)num, sizeof(*tids));
+	if(!pipes || !tids) {
+		free(pipes);
+		free(tids);
+		return UB_NOMEM;
+	}
+	pipes[0] = ctx->qq_pipe;
+	for(i=1; i<num; i++) {
+		if(!(pipes[i] = tube_create())) {
+			log_err("libunbound: could not create pipe for "
+				"thread %d, using %d threads", i, i);
+			num = i;
+			break;
+		}
+	}
+	for(i=0; i<num; i++) {
+		w = libworker_setup(ctx, 1, NULL);
+		if(!w) {
+			log_err("libunbound: out of memory for thread %d", i);
+			for(j=(i==0?1:i); j<num; j++)
+				tube_delete(pipes[j]);
+			num = i;
+			break;
+		}
+		w->is_bg_thread = 1;
+		w->qq_pipe = pipes[i];
+#ifdef ENABLE_LOCK_CHECKS
+		w->thread_num = 1+i; /* for nicer DEBUG checklocks */
+#endif
+		ub_thread_create(&tids[i], libworker_dobg, w);
+	}
+	if(num == 0) {
+		free(pipes);
+		free(tids);
+		return UB_NOMEM;
+	}
+	ctx->bg_tid = tids[0];
+	lock_basic_lock(&ctx->qqpipe_lock);
+	ctx->bg_pipes = pipes;
+	ctx->bg_tids = tids;
+	ctx->bg_num = num;
+	ctx->bg_next = 0;
+	lock_basic_unlock(&ctx->qqpipe_lock);
+	return UB_NOERROR;
+}
+
 int libworker_bg(struct ub_ctx* ctx)
 {
 	struct libworker* w;
 	/* fork or threadcreate */
 	lock_basic_lock(&ctx->cfglock);
 	if(ctx->dothread) {
+		int num = ctx->env->cfg->num_threads;
 		lock_basic_unlock(&ctx->cfglock);
-		w = libworker_setup(ctx, 1, NULL);
-		if(!w) return UB_NOMEM;
-		w->is_bg_thread = 1;
-#ifdef ENABLE_LOCK_CHECKS
-		w->thread_num = 1; /* for nicer DEBUG checklocks */
-#endif
-		ub_thread_create(&ctx->bg_tid, libworker_dobg, w);
+		return libworker_bg_threads(ctx, num<1?1:num);
 	} else {
 		lock_basic_unlock(&ctx->cfglock);
 #ifndef HAVE_FORK
@@ -701,6 +759,43 @@ int libworker_attach_mesh(struct ub_ctx* ctx, struct ctx_query* q,
 	return UB_NOERROR;
 }
 
+/** serialize an answer, or add it to the answer batch, in that case
+ * NULL is returned and len is 0 */
+static uint8_t*
+serialize_bg_answer(struct libworker* w, struct ctx_query* q, int err,
+	sldns_buffer* pkt, uint32_t* len)
+{
+	*len = 0;
+	if(w->answer_batch && context_batch_add_answer(w->answer_buf, q,
+		err, pkt))
+		return NULL;
+	return context_serialize_answer(q, err, pkt, len);
+}
+
+/** add result for a bg worker thread, the ub_result is filled in here,
+ * and the query is handed to the application in the result list */
+static void
+add_bg_thread_result(struct libworker* w, struct ctx_query* q,
+	sldns_buffer* pkt, int err, char* reason)
+{
+	if(reason)
+		q->res->why_bogus = strdup(reason);
+	if(pkt) {
+		q->msg_len = sldns_buffer_remaining(pkt);
+		q->msg = memdup(sldns_buffer_begin(pkt), q->msg_len);
+		if(!q->msg) {
+			err = UB_NOMEM;
+		} else {
+			libworker_enter_result(q->res, pkt, w->env->scratch,
+				q->msg_security);
+			q->res->answer_packet = q->msg;
+			q->res->answer_len = (int)q->msg_len;
+			q->msg = NULL;
+		}
+	}
+	context_result_push(w->ctx, q, err);
+}
+
 /** add result to the bg worker result queue */
 static void
 add_bg_result(struct libworker* w, struct ctx_query* q, sldns_buffer* pkt, 
@@ -709,31 +804,21 @@ add_bg_result(struct libworker* w, struct ctx_query* q, sldns_buffer* pkt,
 	uint8_t* msg = NULL;
 	uint32_t len = 0;
 
-	/* serialize and delete unneeded q */
 	if(w->is_bg_thread) {
-		lock_basic_lock(&w->ctx->cfglock);
-		if(reason)
-			q->res->why_bogus = strdup(reason);
-		if(pkt) {
-			q->msg_len = sldns_buffer_remaining(pkt);
-			q->msg = memdup(sldns_buffer_begin(pkt), q->msg_len);
-			if(!q->msg)
-				msg = context_serialize_answer(q, UB_NOMEM, 
-				NULL, &len);
-			else	msg = context_serialize_answer(q, err, 
-				NULL, &len);
-		} else msg = context_serialize_answer(q, err, NULL, &len);
-		lock_basic_unlock(&w->ctx->cfglock);
-	} else {
-		if(reason)
-			q->res->why_bogus = strdup(reason);
-		msg = context_serialize_answer(q, err, pkt, &len);
-		(void)rbtree_delete(&w->ctx->queries, q->node.key);
-		w->ctx->num_async--;
-		context_query_delete(q);
+		add_bg_thread_result(w, q, pkt, err, reason);
+		return;
 	}
+	/* serialize and delete unneeded q */
+	if(reason)
+		q->res->why_bogus = strdup(reason);
+	msg = serialize_bg_answer(w, q, err, pkt, &len);
+	(void)rbtree_delete(&w->ctx->queries, q->node.key);
+	w->ctx->num_async--;
+	context_query_delete(q);
 
 	if(!msg) {
+		if(len == 0 && w->answer_batch)
+			return; /* it is in the batch */
 		log_err("out of memory for async answer");
 		return;
 	}
@@ -772,26 +857,13 @@ libworker_bg_done_cb(void* arg, int rcode, sldns_buffer* buf, enum sec_status s,
 }
 
 
-/** handle new query command for bg worker */
+/** start a new query for the bg worker */
 static void
-handle_newq(struct libworker* w, uint8_t* buf, uint32_t len)
+start_bg_query(struct libworker* w, struct ctx_query* q)
 {
 	uint16_t qflags, qid;
 	struct query_info qinfo;
 	struct edns_data edns;
-	struct ctx_query* q;
-	if(w->is_bg_thread) {
-		lock_basic_lock(&w->ctx->cfglock);
-		q = context_lookup_new_query(w->ctx, buf, len);
-		lock_basic_unlock(&w->ctx->cfglock);
-	} else {
-		q = context_deserialize_new_query(w->ctx, buf, len);
-	}
-	free(buf);
-	if(!q) {
-		log_err("failed to deserialize newq");
-		return;
-	}
 	if(!setup_qinfo_edns(w, q, &qinfo, &edns)) {
 		add_bg_result(w, q, NULL, UB_SYNTAX, NULL);
 		return;
@@ -819,6 +891,74 @@ handle_newq(struct libworker* w, uint8_t* buf, uint32_t len)
 	free(qinfo.qname);
 }
 
+/** lookup or deserialize a new query for the bg worker */
+static struct ctx_query*
+bg_new_query(struct libworker* w, uint8_t* buf, uint32_t len)
+{
+	struct ctx_query* q;
+	if(w->is_bg_thread) {
+		lock_basic_lock(&w->ctx->cfglock);
+		q = context_lookup_new_query(w->ctx, buf, len);
+		lock_basic_unlock(&w->ctx->cfglock);
+	} else {
+		q = context_deserialize_new_query(w->ctx, buf, len);
+	}
+	return q;
+}
+
+/** handle new query command for bg worker */
+static void
+handle_newq(struct libworker* w, uint8_t* buf, uint32_t len)
+{
+	struct ctx_query* q = bg_new_query(w, buf, len);
+	free(buf);
+	if(!q) {
+		log_err("failed to deserialize newq");
+		return;
+	}
+	start_bg_query(w, q);
+}
+
+/** handle batch of new queries for bg worker, the answers that are
+ * available right away (from cache or local data) are sent back in
+ * one answer batch message */
+static void
+handle_newq_batch(struct libworker* w, uint8_t* buf, uint32_t len)
+{
+	uint32_t pos = 0, elen;
+	uint8_t* e, *msg;
+	struct ctx_query* q;
+	/* the threads hand over results without serialization */
+	if(!w->answer_buf && !w->is_bg_thread)
+		w->answer_buf = sldns_buffer_new(UB_LIBCMD_BATCH_BUFSIZE);
+	if(w->answer_buf) {
+		context_batch_start(w->answer_buf, UB_LIBCMD_ANSWER_BATCH);
+		w->answer_batch = 1;
+	}
+	while(context_batch_next(buf, len, &pos, &e, &elen)) {
+		if(context_serial_getcmd(e, elen) != UB_LIBCMD_NEWQUERY ||
+			!(q = bg_new_query(w, e, elen))) {
+			log_err("failed to deserialize newq in batch");
+			continue;
+		}
+		start_bg_query(w, q);
+	}
+	free(buf);
+	if(!w->answer_batch)
+		return;
+	w->answer_batch = 0;
+	if(context_batch_count(sldns_buffer_begin(w->answer_buf),
+		(uint32_t)sldns_buffer_position(w->answer_buf)) == 0)
+		return;
+	msg = memdup(sldns_buffer_begin(w->answer_buf),
+		sldns_buffer_position(w->answer_buf));
+	if(!msg || !tube_queue_item(w->ctx->rr_pipe, msg,
+		(uint32_t)sldns_buffer_position(w->answer_buf))) {
+		log_err("out of memory for async answer");
+		return;
+	}
+}
+
 void libworker_alloc_cleanup(void* arg)
 {
 	struct libworker* w = (struct libworker*)arg;
@@ -837,6 +977,7 @@ struct outbound_entry* libworker_send_query(struct query_info* qinfo,
 	if(!e)
 		return NULL;
 	e->qstate = q;
+	e->hedge_timer = NULL;
 	e->qsent = outnet_serviced_query(w->back, qinfo, flags, dnssec,
 		want_dnssec, nocaps, q->env->cfg->tcp_upstream, ssl_upstream,
 		addr, addrlen, zone, zonelen, q, libworker_handle_service_reply,
@@ -847,6 +988,35 @@ struct outbound_entry* libworker_send_query(struct query_info* qinfo,
 	return e;
 }
 
+int
+libworker_hedge_query(struct outbound_entry* e, int ms)
+{
+	struct libworker* w = (struct libworker*)e->qstate->env->worker;
+	struct timeval tv;
+	if(!e->hedge_timer) {
+		e->hedge_timer = comm_timer_create_coarse(w->base,
+			libworker_hedge_timer_cb, e);
+		if(!e->hedge_timer)
+			return 0;
+	}
+#ifndef S_SPLINT_S
+	tv.tv_sec = ms/1000;
+	tv.tv_usec = (ms%1000)*1000;
+#endif
+	comm_timer_set(e->hedge_timer, &tv);
+	return 1;
+}
+
+void
+libworker_hedge_timer_cb(void* arg)
+{
+	struct outbound_entry* e = (struct outbound_entry*)arg;
+	struct libworker* w = (struct libworker*)e->qstate->env->worker;
+	comm_timer_delete(e->hedge_timer);
+	e->hedge_timer = NULL;
+	mesh_report_hedge(w->env->mesh, e);
+}
+
 int 
 libworker_handle_reply(struct comm_point* c, void* arg, int error,
         struct comm_reply* reply_info)
@@ -950,6 +1120,22 @@ int remote_control_callback(struct comm_point* ATTR_UNUSED(c),
 	return 0;
 }
 
+int metrics_accept_callback(struct comm_point* ATTR_UNUSED(c), 
+	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
+        struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	log_assert(0);
+	return 0;
+}
+
+int metrics_conn_callback(struct comm_point* ATTR_UNUSED(c), 
+	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
+        struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	log_assert(0);
+	return 0;
+}
+
 void worker_sighandler(int ATTR_UNUSED(sig), void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
@@ -966,6 +1152,18 @@ struct outbound_entry* worker_send_query(struct query_info* ATTR_UNUSED(qinfo),
 	return 0;
 }
 
+int worker_hedge_query(struct outbound_entry* ATTR_UNUSED(e),
+	int ATTR_UNUSED(ms))
+{
+	log_assert(0);
+	return 0;
+}
+
+void worker_hedge_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void 
 worker_alloc_cleanup(void* ATTR_UNUSED(arg))
 {
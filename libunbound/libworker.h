@@ -75,6 +75,8 @@ struct libworker {
 	int is_bg;
 	/** is this a bg worker that is threaded (not forked)? */
 	int is_bg_thread;
+	/** for a bg worker, the pipe it reads new queries from */
+	struct tube* qq_pipe;
 
 	/** copy of the module environment with worker local entries. */
 	struct module_env* env;
@@ -86,10 +88,16 @@ struct libworker {
 	struct ub_randstate* rndstate;
 	/** sslcontext for SSL wrapped DNS over TCP queries */
 	void* sslctx;
+	/** buffer for batches of answers, reused, NULL until used. */
+	struct sldns_buffer* answer_buf;
+	/** if true, answers are added to the answer_buf batch, this is
+	 * done for the answers that are available immediately for a
+	 * batch of new queries, they are sent back in one message. */
+	int answer_batch;
 };
 
 /**
- * Create a background worker
+ * Create a background worker, or with threads, num-threads of them.
  * @param ctx: is updated with pid/tid of the background worker.
  *	a new allocation cache is obtained from ctx. It contains the
  *	threadnumber and unique id for further (shared) cache insertions.
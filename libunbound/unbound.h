@@ -225,6 +225,23 @@ struct ub_result {
  */
 typedef void (*ub_callback_type)(void*, int, struct ub_result*);
 
+/**
+ * A query for the batch interface, ub_resolve_async_batch.
+ */
+struct ub_query {
+	/** the domain name in text format (a string) */
+	const char* name;
+	/** type of RR in host order, 1 is A */
+	int rrtype;
+	/** class of RR in host order, 1 is IN */
+	int rrclass;
+	/** your data, passed on to the callback function */
+	void* mydata;
+	/** returned, the identifier of the query, it can be used to cancel
+	 * the query.  It is 0 if the query has not been started. */
+	int async_id;
+};
+
 /**
  * Create a resolving and validation context.
  * The information from /etc/resolv.conf and /etc/hosts is not utilised by
@@ -429,6 +446,9 @@ int ub_ctx_debuglevel(struct ub_ctx* ctx, int d);
  * @param ctx: context.
  * @param dothread: if true, enables threading and a call to resolve_async() 
  *	creates a thread to handle work in the background.
+ *	With ub_ctx_set_option(ctx, "num-threads:", "4"), four threads
+ *	are created, that share the cache, and the queries are spread
+ *	over them.
  *	If false, a process is forked to handle work in the background.
  *	Changes to this setting after async() calls have been made have 
  *	no effect (delete and re-create the context to change).
@@ -521,6 +541,28 @@ int ub_resolve(struct ub_ctx* ctx, const char* name, int rrtype,
 int ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype, 
 	int rrclass, void* mydata, ub_callback_type callback, int* async_id);
 
+/**
+ * Perform resolution and validation of a number of names, asynchronously.
+ * This works like ub_resolve_async for every query, but the queries are
+ * handed to the background worker in batches, and the answers that are
+ * available right away (from cache or local data) are returned in one
+ * batch as well, that saves work when many names are looked up.
+ * The callbacks are called for the queries like for ub_resolve_async.
+ * @param ctx: context.
+ *	If no thread or process has been created yet to perform the
+ *	work in the background, it is created now.
+ *	The context is finalized, and can no longer accept config changes.
+ * @param queries: array of queries. The async_id of every query is set,
+ *	to the id of the query, or 0 if the query has not been started.
+ * @param num: number of queries in the array.
+ * @param callback: this is called on completion of the resolution,
+ *	for every query, with the mydata from that query.
+ * @return 0 if OK, else error.  On error, the queries that have an
+ *	async_id are outstanding, the others have not been started.
+ */
+int ub_resolve_async_batch(struct ub_ctx* ctx, struct ub_query* queries,
+	int num, ub_callback_type callback);
+
 /**
  * Cancel an async query in progress.
  * Its callback will not be called.
@@ -50,6 +50,7 @@ struct module_qstate;
 struct tube;
 struct edns_option;
 struct query_info;
+struct outbound_entry;
 
 /**
  * Worker service routine to send serviced queries to authoritative servers.
@@ -72,6 +73,17 @@ struct outbound_entry* libworker_send_query(struct query_info* qinfo,
 	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* zone,
 	size_t zonelen, int ssl_upstream, struct module_qstate* q);
 
+/**
+ * Worker service routine to start the hedge timer of an outbound query.
+ * @param e: the outbound entry.
+ * @param ms: timeout in msec.
+ * @return false on failure (malloc).
+ */
+int libworker_hedge_query(struct outbound_entry* e, int ms);
+
+/** hedge timer callback handler, arg is the outbound entry */
+void libworker_hedge_timer_cb(void* arg);
+
 /** process incoming replies from the network */
 int libworker_handle_reply(struct comm_point* c, void* arg, int error,
         struct comm_reply* reply_info);
@@ -124,6 +136,17 @@ struct outbound_entry* worker_send_query(struct query_info* qinfo,
 	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* zone,
 	size_t zonelen, int ssl_upstream, struct module_qstate* q);
 
+/**
+ * Worker service routine to start the hedge timer of an outbound query.
+ * @param e: the outbound entry.
+ * @param ms: timeout in msec.
+ * @return false on failure (malloc).
+ */
+int worker_hedge_query(struct outbound_entry* e, int ms);
+
+/** hedge timer callback handler, arg is the outbound entry */
+void worker_hedge_timer_cb(void* arg);
+
 /** 
  * process control messages from the main thread. Frees the control 
  * command message.
@@ -169,6 +192,12 @@ int remote_accept_callback(struct comm_point*, void*, int, struct comm_reply*);
 /** handle remote control data callbacks */
 int remote_control_callback(struct comm_point*, void*, int, struct comm_reply*);
 
+/** handle metrics endpoint accept callbacks */
+int metrics_accept_callback(struct comm_point*, void*, int, struct comm_reply*);
+
+/** handle metrics endpoint connection callbacks */
+int metrics_conn_callback(struct comm_point*, void*, int, struct comm_reply*);
+
 /** routine to printout option values over SSL */
 void  remote_get_opt_ssl(char* line, void* arg);
 
@@ -1013,6 +1013,7 @@ enum module_ext_state {
 %rename ("MODULE_EVENT_CAPSFAIL") "module_event_capsfail";
 %rename ("MODULE_EVENT_MODDONE") "module_event_moddone";
 %rename ("MODULE_EVENT_ERROR") "module_event_error";
+%rename ("MODULE_EVENT_HEDGE") "module_event_hedge";
 
 enum module_ev {
    module_event_new = 0,
@@ -1021,7 +1022,8 @@ enum module_ev {
    module_event_noreply,
    module_event_capsfail,
    module_event_moddone,
-   module_event_error
+   module_event_error,
+   module_event_hedge
 };
 
 enum sec_status {
@@ -47,6 +47,7 @@
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
 #include "util/module.h"
+#include "util/alloc.h"
 #include "util/net_help.h"
 #include "util/regional.h"
 #include "util/config_file.h"
@@ -104,12 +105,77 @@ store_rrsets(struct module_env* env, struct reply_info* rep, time_t now,
         }
 }
 
+/**
+ * Store an rrset from a message in a region in the rrset cache. The cache
+ * is checked first, and the rrset is only copied (once, into its malloced
+ * cache representation) if the cache does not already hold a superior or
+ * equal copy of it.
+ * @param env: module environment with caches.
+ * @param rrset: the rrset in the region, it is not changed. If the cache
+ *	is superior and the rdata is equal, and region is not NULL, this is
+ *	replaced with a region copy of the cached rrset.
+ * @param ref: the reference to the rrset in the cache is returned here.
+ * @param now: current time.
+ * @param leeway: during prefetch how much leeway to update TTLs.
+ * @param pside: if from parentside discovered NS.
+ * @param region: for the copy of the cached rrset, or NULL.
+ * @return false on malloc failure.
+ */
+static int
+store_rrset(struct module_env* env, struct ub_packed_rrset_key** rrset,
+	struct rrset_ref* ref, time_t now, time_t leeway, int pside,
+	struct regional* region)
+{
+	struct ub_packed_rrset_key* k = *rrset;
+	/* no leeway for typeNS */
+	time_t timenow = now + ((ntohs(k->rk.type)==LDNS_RR_TYPE_NS &&
+		!pside)?0:leeway);
+	int r = rrset_cache_check_update(env->rrset_cache, k, ref, timenow);
+	if(r == 0) {
+		/* the copy in the cache, with absolute TTLs */
+		ref->key = packed_rrset_copy_alloc(k, env->alloc, now);
+		if(!ref->key)
+			return 0;
+		ref->id = ref->key->id;
+		r = rrset_cache_update(env->rrset_cache, ref, env->alloc,
+			timenow);
+	}
+	if(r == 2 && region) {
+		struct ub_packed_rrset_key* ck;
+		lock_rw_rdlock(&ref->key->entry.lock);
+		/* if deleted rrset, do not copy it */
+		if(ref->key->id == 0)
+			ck = NULL;
+		else	ck = packed_rrset_copy_region(ref->key, region, now);
+		lock_rw_unlock(&ref->key->entry.lock);
+		if(ck) {
+			/* use cached copy if memory allows */
+			*rrset = ck;
+		}
+	}
+	return 1;
+}
+
+/** store a reply_info, with references to the cached rrsets, in the
+ * message cache, the reply_info is then owned by the cache. */
+static void
+store_msg_entry(struct module_env* env, struct query_info* qinfo,
+	hashvalue_type hash, struct reply_info* rep)
+{
+	struct msgreply_entry* e;
+	reply_info_sortref(rep);
+	if(!(e = query_info_entrysetup(qinfo, rep, hash, env->alloc))) {
+		log_err("store_msg: malloc failed");
+		return;
+	}
+	slabhash_insert(env->msg_cache, hash, &e->entry, rep, env->alloc);
+}
+
 void 
 dns_cache_store_msg(struct module_env* env, struct query_info* qinfo,
 	hashvalue_type hash, struct reply_info* rep, time_t leeway, int pside,
 	struct reply_info* qrep, struct regional* region)
 {
-	struct msgreply_entry* e;
 	time_t ttl = rep->ttl;
 	size_t i;
 
@@ -127,17 +193,12 @@ dns_cache_store_msg(struct module_env* env, struct query_info* qinfo,
 		/* we do not store the message, but we did store the RRs,
 		 * which could be useful for delegation information */
 		verbose(VERB_ALGO, "TTL 0: dropped msg from cache");
-		free(rep);
+		alloc_sized_release(env->alloc, rep);
 		return;
 	}
 
 	/* store msg in the cache */
-	reply_info_sortref(rep);
-	if(!(e = query_info_entrysetup(qinfo, rep, hash))) {
-		log_err("store_msg: malloc failed");
-		return;
-	}
-	slabhash_insert(env->msg_cache, hash, &e->entry, rep, env->alloc);
+	store_msg_entry(env, qinfo, hash, rep);
 }
 
 /** find closest NS or DNAME and returns the rrset (locked) */
@@ -835,42 +896,59 @@ dns_cache_store(struct module_env* env, struct query_info* msgqinf,
         struct reply_info* msgrep, int is_referral, time_t leeway, int pside,
 	struct regional* region, uint16_t flags)
 {
-	struct reply_info* rep = NULL;
-	/* alloc, malloc properly (not in region, like msg is) */
-	rep = reply_info_copy(msgrep, env->alloc, NULL);
-	if(!rep)
-		return 0;
+	struct reply_info* rep;
+	struct rrset_ref ref;
+	size_t i;
 	/* ttl must be relative ;i.e. 0..86400 not  time(0)+86400. 
 	 * the env->now is added to message and RRsets in this routine. */
 	/* the leeway is used to invalidate other rrsets earlier */
 
 	if(is_referral) {
 		/* store rrsets */
-		struct rrset_ref ref;
-		size_t i;
-		for(i=0; i<rep->rrset_count; i++) {
-			packed_rrset_ttl_add((struct packed_rrset_data*)
-				rep->rrsets[i]->entry.data, *env->now);
-			ref.key = rep->rrsets[i];
-			ref.id = rep->rrsets[i]->id;
-			/*ignore ret: it was in the cache, ref updated */
-			/* no leeway for typeNS */
-			(void)rrset_cache_update(env->rrset_cache, &ref, 
-				env->alloc, *env->now + 
-				((ntohs(ref.key->rk.type)==LDNS_RR_TYPE_NS
-				 && !pside) ? 0:leeway));
+		for(i=0; i<msgrep->rrset_count; i++) {
+			/*ignore ref: it is not stored in a message */
+			if(!store_rrset(env, &msgrep->rrsets[i], &ref,
+				*env->now, leeway, pside, NULL))
+				return 0;
 		}
-		free(rep);
 		return 1;
 	} else {
 		/* store msg, and rrsets */
 		struct query_info qinf;
 		hashvalue_type h;
 
+		/* alloc, malloc properly (not in region, like msg is), the
+		 * rrsets are references to the rrset cache, and are only
+		 * copied when they are stored there */
+		rep = construct_reply_info_base(NULL, env->alloc,
+			msgrep->flags, msgrep->qdcount, msgrep->ttl,
+			msgrep->prefetch_ttl, msgrep->an_numrrsets,
+			msgrep->ns_numrrsets, msgrep->ar_numrrsets,
+			msgrep->rrset_count, msgrep->security);
+		if(!rep)
+			return 0;
+		for(i=0; i<rep->rrset_count; i++) {
+			if(!store_rrset(env, &msgrep->rrsets[i], &rep->ref[i],
+				*env->now, leeway, pside, region)) {
+				alloc_sized_release(env->alloc, rep);
+				return 0;
+			}
+			rep->rrsets[i] = rep->ref[i].key;
+		}
+		if(rep->ttl == 0) {
+			/* we do not store the message, but we did store the
+			 * RRs, which could be useful for delegation info */
+			verbose(VERB_ALGO, "TTL 0: dropped msg from cache");
+			alloc_sized_release(env->alloc, rep);
+			return 1;
+		}
+		rep->ttl += *env->now;
+		rep->prefetch_ttl += *env->now;
+
 		qinf = *msgqinf;
 		qinf.qname = memdup(msgqinf->qname, msgqinf->qname_len);
 		if(!qinf.qname) {
-			reply_info_parsedelete(rep, env->alloc);
+			alloc_sized_release(env->alloc, rep);
 			return 0;
 		}
 		/* fixup flags to be sensible for a reply based on the cache */
@@ -879,8 +957,7 @@ dns_cache_store(struct module_env* env, struct query_info* msgqinf,
 		rep->flags |= (BIT_RA | BIT_QR);
 		rep->flags &= ~(BIT_AA | BIT_CD);
 		h = query_info_hash(&qinf, flags);
-		dns_cache_store_msg(env, &qinf, h, rep, leeway, pside, msgrep,
-			region);
+		store_msg_entry(env, &qinf, h, rep);
 		/* qname is used inside query_info_entrysetup, and set to 
 		 * NULL. If it has not been used, free it. free(0) is safe. */
 		free(qinf.qname);
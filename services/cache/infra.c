@@ -43,7 +43,7 @@
 #include "sldns/str2wire.h"
 #include "services/cache/infra.h"
 #include "util/storage/slabhash.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/data/dname.h"
 #include "util/log.h"
 #include "util/net_help.h"
@@ -69,7 +69,7 @@ size_t
 infra_sizefunc(void* k, void* ATTR_UNUSED(d))
 {
 	struct infra_key* key = (struct infra_key*)k;
-	return sizeof(*key) + sizeof(struct infra_data) + key->namelen
+	return sizeof(*key) + sizeof(struct infra_data)
 		+ lock_get_mem(&key->entry.lock);
 }
 
@@ -78,6 +78,39 @@ infra_compfunc(void* key1, void* key2)
 {
 	struct infra_key* k1 = (struct infra_key*)key1;
 	struct infra_key* k2 = (struct infra_key*)key2;
+	return sockaddr_cmp(&k1->addr, k1->addrlen, &k2->addr, k2->addrlen);
+}
+
+void 
+infra_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
+{
+	struct infra_key* key = (struct infra_key*)k;
+	if(!key)
+		return;
+	lock_rw_destroy(&key->entry.lock);
+	free(key);
+}
+
+void 
+infra_deldatafunc(void* d, void* ATTR_UNUSED(arg))
+{
+	struct infra_data* data = (struct infra_data*)d;
+	free(data);
+}
+
+size_t 
+infra_lame_sizefunc(void* k, void* ATTR_UNUSED(d))
+{
+	struct infra_lame_key* key = (struct infra_lame_key*)k;
+	return sizeof(*key) + sizeof(struct infra_lame_data) + key->namelen
+		+ lock_get_mem(&key->entry.lock);
+}
+
+int 
+infra_lame_compfunc(void* key1, void* key2)
+{
+	struct infra_lame_key* k1 = (struct infra_lame_key*)key1;
+	struct infra_lame_key* k2 = (struct infra_lame_key*)key2;
 	int r = sockaddr_cmp(&k1->addr, k1->addrlen, &k2->addr, k2->addrlen);
 	if(r != 0)
 		return r;
@@ -90,9 +123,9 @@ infra_compfunc(void* key1, void* key2)
 }
 
 void 
-infra_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
+infra_lame_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
 {
-	struct infra_key* key = (struct infra_key*)k;
+	struct infra_lame_key* key = (struct infra_lame_key*)k;
 	if(!key)
 		return;
 	lock_rw_destroy(&key->entry.lock);
@@ -101,9 +134,9 @@ infra_delkeyfunc(void* k, void* ATTR_UNUSED(arg))
 }
 
 void 
-infra_deldatafunc(void* d, void* ATTR_UNUSED(arg))
+infra_lame_deldatafunc(void* d, void* ATTR_UNUSED(arg))
 {
-	struct infra_data* data = (struct infra_data*)d;
+	struct infra_lame_data* data = (struct infra_lame_data*)d;
 	free(data);
 }
 
@@ -221,7 +254,12 @@ infra_create(struct config_file* cfg)
 	struct infra_cache* infra = (struct infra_cache*)calloc(1, 
 		sizeof(struct infra_cache));
 	size_t maxmem = cfg->infra_cache_numhosts * (sizeof(struct infra_key)+
-		sizeof(struct infra_data)+INFRA_BYTES_NAME);
+		sizeof(struct infra_data));
+	size_t lamemem = cfg->infra_cache_numhosts / INFRA_LAME_DIVISOR *
+		(sizeof(struct infra_lame_key)+sizeof(struct infra_lame_data)+
+		INFRA_BYTES_NAME);
+	if(!infra)
+		return NULL;
 	infra->hosts = slabhash_create(cfg->infra_cache_slabs,
 		INFRA_HOST_STARTSIZE, maxmem, &infra_sizefunc, &infra_compfunc,
 		&infra_delkeyfunc, &infra_deldatafunc, NULL);
@@ -229,6 +267,15 @@ infra_create(struct config_file* cfg)
 		free(infra);
 		return NULL;
 	}
+	infra->lame = slabhash_create(cfg->infra_cache_slabs,
+		INFRA_HOST_STARTSIZE, lamemem, &infra_lame_sizefunc,
+		&infra_lame_compfunc, &infra_lame_delkeyfunc,
+		&infra_lame_deldatafunc, NULL);
+	if(!infra->lame) {
+		slabhash_delete(infra->hosts);
+		free(infra);
+		return NULL;
+	}
 	infra->host_ttl = cfg->host_ttl;
 	name_tree_init(&infra->domain_limits);
 	infra_dp_ratelimit = cfg->ratelimit;
@@ -274,6 +321,7 @@ infra_delete(struct infra_cache* infra)
 	if(!infra)
 		return;
 	slabhash_delete(infra->hosts);
+	slabhash_delete(infra->lame);
 	slabhash_delete(infra->domain_rates);
 	traverse_postorder(&infra->domain_limits, domain_limit_free, NULL);
 	slabhash_delete(infra->client_ip_rates);
@@ -288,63 +336,92 @@ infra_adjust(struct infra_cache* infra, struct config_file* cfg)
 		return infra_create(cfg);
 	infra->host_ttl = cfg->host_ttl;
 	maxmem = cfg->infra_cache_numhosts * (sizeof(struct infra_key)+
-		sizeof(struct infra_data)+INFRA_BYTES_NAME);
+		sizeof(struct infra_data));
 	if(maxmem != slabhash_get_size(infra->hosts) ||
-		cfg->infra_cache_slabs != infra->hosts->size) {
+		cfg->infra_cache_slabs != slabhash_array(infra->hosts)->size) {
 		infra_delete(infra);
 		infra = infra_create(cfg);
 	}
 	return infra;
 }
 
-/** calculate the hash value for a host key
+/** absorb a host key into the hash
  *  set use_port to a non-0 number to use the port in
  *  the hash calculation; 0 to ignore the port.*/
-static hashvalue_type
-hash_addr(struct sockaddr_storage* addr, socklen_t addrlen,
-  int use_port)
+static void
+hash_addr_update(struct keyhash_state* s, struct sockaddr_storage* addr,
+	socklen_t addrlen, int use_port)
 {
-	hashvalue_type h = 0xab;
 	/* select the pieces to hash, some OS have changing data inside */
 	if(addr_is_ip6(addr, addrlen)) {
 		struct sockaddr_in6* in6 = (struct sockaddr_in6*)addr;
-		h = hashlittle(&in6->sin6_family, sizeof(in6->sin6_family), h);
+		keyhash_update(s, &in6->sin6_family, sizeof(in6->sin6_family));
 		if(use_port){
-			h = hashlittle(&in6->sin6_port, sizeof(in6->sin6_port), h);
+			keyhash_update(s, &in6->sin6_port,
+				sizeof(in6->sin6_port));
 		}
-		h = hashlittle(&in6->sin6_addr, INET6_SIZE, h);
+		keyhash_update(s, &in6->sin6_addr, INET6_SIZE);
 	} else {
 		struct sockaddr_in* in = (struct sockaddr_in*)addr;
-		h = hashlittle(&in->sin_family, sizeof(in->sin_family), h);
+		keyhash_update(s, &in->sin_family, sizeof(in->sin_family));
 		if(use_port){
-			h = hashlittle(&in->sin_port, sizeof(in->sin_port), h);
+			keyhash_update(s, &in->sin_port, sizeof(in->sin_port));
 		}
-		h = hashlittle(&in->sin_addr, INET_SIZE, h);
+		keyhash_update(s, &in->sin_addr, INET_SIZE);
 	}
-	return h;
 }
 
-/** calculate infra hash for a key */
+/** calculate the hash value for a host key
+ *  set use_port to a non-0 number to use the port in
+ *  the hash calculation; 0 to ignore the port.*/
 static hashvalue_type
-hash_infra(struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name)
+hash_addr(struct sockaddr_storage* addr, socklen_t addrlen,
+  int use_port)
 {
-	return dname_query_hash(name, hash_addr(addr, addrlen, 1));
+	struct keyhash_state s;
+	keyhash_init(&s);
+	hash_addr_update(&s, addr, addrlen, use_port);
+	return keyhash_final(&s);
+}
+
+/** calculate lameness hash for a key */
+static hashvalue_type
+hash_infra_lame(struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name)
+{
+	struct keyhash_state s;
+	keyhash_init(&s);
+	hash_addr_update(&s, addr, addrlen, 1);
+	dname_query_hash_update(&s, name);
+	return keyhash_final(&s);
 }
 
 /** lookup version that does not check host ttl (you check it) */
 struct lruhash_entry* 
 infra_lookup_nottl(struct infra_cache* infra, struct sockaddr_storage* addr,
-	socklen_t addrlen, uint8_t* name, size_t namelen, int wr)
+	socklen_t addrlen, int wr)
 {
 	struct infra_key k;
 	k.addrlen = addrlen;
 	memcpy(&k.addr, addr, addrlen);
+	k.entry.hash = hash_addr(addr, addrlen, 1);
+	k.entry.key = (void*)&k;
+	k.entry.data = NULL;
+	return slabhash_lookup(infra->hosts, k.entry.hash, &k, wr);
+}
+
+struct lruhash_entry* 
+infra_lookup_lame(struct infra_cache* infra, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint8_t* name, size_t namelen, int wr)
+{
+	struct infra_lame_key k;
+	k.addrlen = addrlen;
+	memcpy(&k.addr, addr, addrlen);
 	k.namelen = namelen;
 	k.zonename = name;
-	k.entry.hash = hash_infra(addr, addrlen, name);
+	k.entry.hash = hash_infra_lame(addr, addrlen, name);
 	k.entry.key = (void*)&k;
 	k.entry.data = NULL;
-	return slabhash_lookup(infra->hosts, k.entry.hash, &k, wr);
+	return slabhash_lookup(infra->lame, k.entry.hash, &k, wr);
 }
 
 /** init the data elements */
@@ -355,13 +432,10 @@ data_entry_init(struct infra_cache* infra, struct lruhash_entry* e,
 	struct infra_data* data = (struct infra_data*)e->data;
 	data->ttl = timenow + infra->host_ttl;
 	rtt_init(&data->rtt);
+	rtt_hist_init(&data->hist);
 	data->edns_version = 0;
 	data->edns_lame_known = 0;
 	data->probedelay = 0;
-	data->isdnsseclame = 0;
-	data->rec_lame = 0;
-	data->lame_type_A = 0;
-	data->lame_other = 0;
 	data->timeout_A = 0;
 	data->timeout_AAAA = 0;
 	data->timeout_other = 0;
@@ -372,14 +446,12 @@ data_entry_init(struct infra_cache* infra, struct lruhash_entry* e,
  * @param infra: infra structure with config parameters.
  * @param addr: host address.
  * @param addrlen: length of addr.
- * @param name: name of zone
- * @param namelen: length of name.
  * @param tm: time now.
  * @return: the new entry or NULL on malloc failure.
  */
 static struct lruhash_entry*
 new_entry(struct infra_cache* infra, struct sockaddr_storage* addr, 
-	socklen_t addrlen, uint8_t* name, size_t namelen, time_t tm)
+	socklen_t addrlen, time_t tm)
 {
 	struct infra_data* data;
 	struct infra_key* key = (struct infra_key*)malloc(sizeof(*key));
@@ -390,6 +462,53 @@ new_entry(struct infra_cache* infra, struct sockaddr_storage* addr,
 		free(key);
 		return NULL;
 	}
+	lock_rw_init(&key->entry.lock);
+	key->entry.hash = hash_addr(addr, addrlen, 1);
+	key->entry.key = (void*)key;
+	key->entry.data = (void*)data;
+	key->addrlen = addrlen;
+	memcpy(&key->addr, addr, addrlen);
+	data_entry_init(infra, &key->entry, tm);
+	return &key->entry;
+}
+
+/** init the lameness data elements */
+static void
+lame_entry_init(struct infra_cache* infra, struct lruhash_entry* e, 
+	time_t timenow)
+{
+	struct infra_lame_data* data = (struct infra_lame_data*)e->data;
+	data->ttl = timenow + infra->host_ttl;
+	data->isdnsseclame = 0;
+	data->rec_lame = 0;
+	data->lame_type_A = 0;
+	data->lame_other = 0;
+}
+
+/** 
+ * Create and init a new lameness entry for a host and zone
+ * @param infra: infra structure with config parameters.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param name: name of zone
+ * @param namelen: length of name.
+ * @param tm: time now.
+ * @return: the new entry or NULL on malloc failure.
+ */
+static struct lruhash_entry*
+new_lame_entry(struct infra_cache* infra, struct sockaddr_storage* addr, 
+	socklen_t addrlen, uint8_t* name, size_t namelen, time_t tm)
+{
+	struct infra_lame_data* data;
+	struct infra_lame_key* key = (struct infra_lame_key*)malloc(
+		sizeof(*key));
+	if(!key)
+		return NULL;
+	data = (struct infra_lame_data*)malloc(sizeof(*data));
+	if(!data) {
+		free(key);
+		return NULL;
+	}
 	key->zonename = memdup(name, namelen);
 	if(!key->zonename) {
 		free(key);
@@ -398,22 +517,21 @@ new_entry(struct infra_cache* infra, struct sockaddr_storage* addr,
 	}
 	key->namelen = namelen;
 	lock_rw_init(&key->entry.lock);
-	key->entry.hash = hash_infra(addr, addrlen, name);
+	key->entry.hash = hash_infra_lame(addr, addrlen, name);
 	key->entry.key = (void*)key;
 	key->entry.data = (void*)data;
 	key->addrlen = addrlen;
 	memcpy(&key->addr, addr, addrlen);
-	data_entry_init(infra, &key->entry, tm);
+	lame_entry_init(infra, &key->entry, tm);
 	return &key->entry;
 }
 
 int 
 infra_host(struct infra_cache* infra, struct sockaddr_storage* addr,
-        socklen_t addrlen, uint8_t* nm, size_t nmlen, time_t timenow,
-	int* edns_vs, uint8_t* edns_lame_known, int* to)
+        socklen_t addrlen, time_t timenow, int* edns_vs,
+	uint8_t* edns_lame_known, int* to)
 {
-	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
-		nm, nmlen, 0);
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen, 0);
 	struct infra_data* data;
 	int wr = 0;
 	if(e && ((struct infra_data*)e->data)->ttl < timenow) {
@@ -423,11 +541,10 @@ infra_host(struct infra_cache* infra, struct sockaddr_storage* addr,
 		uint8_t tAAAA = ((struct infra_data*)e->data)->timeout_AAAA;
 		uint8_t tother = ((struct infra_data*)e->data)->timeout_other;
 		lock_rw_unlock(&e->lock);
-		e = infra_lookup_nottl(infra, addr, addrlen, nm, nmlen, 1);
+		e = infra_lookup_nottl(infra, addr, addrlen, 1);
 		if(e) {
 			/* if its still there we have a writelock, init */
 			/* re-initialise */
-			/* do not touch lameness, it may be valid still */
 			data_entry_init(infra, e, timenow);
 			wr = 1;
 			/* TOP_TIMEOUT remains on reuse */
@@ -442,7 +559,7 @@ infra_host(struct infra_cache* infra, struct sockaddr_storage* addr,
 	}
 	if(!e) {
 		/* insert new entry */
-		if(!(e = new_entry(infra, addr, addrlen, nm, nmlen, timenow)))
+		if(!(e = new_entry(infra, addr, addrlen, timenow)))
 			return 0;
 		data = (struct infra_data*)e->data;
 		*edns_vs = data->edns_version;
@@ -460,7 +577,7 @@ infra_host(struct infra_cache* infra, struct sockaddr_storage* addr,
 		/* delay other queries, this is the probe query */
 		if(!wr) {
 			lock_rw_unlock(&e->lock);
-			e = infra_lookup_nottl(infra, addr,addrlen,nm,nmlen, 1);
+			e = infra_lookup_nottl(infra, addr, addrlen, 1);
 			if(!e) { /* flushed from cache real fast, no use to
 				allocate just for the probedelay */
 				return 1;
@@ -481,23 +598,24 @@ infra_set_lame(struct infra_cache* infra, struct sockaddr_storage* addr,
 	socklen_t addrlen, uint8_t* nm, size_t nmlen, time_t timenow,
 	int dnsseclame, int reclame, uint16_t qtype)
 {
-	struct infra_data* data;
+	struct infra_lame_data* data;
 	struct lruhash_entry* e;
 	int needtoinsert = 0;
-	e = infra_lookup_nottl(infra, addr, addrlen, nm, nmlen, 1);
+	e = infra_lookup_lame(infra, addr, addrlen, nm, nmlen, 1);
 	if(!e) {
 		/* insert it */
-		if(!(e = new_entry(infra, addr, addrlen, nm, nmlen, timenow))) {
+		if(!(e = new_lame_entry(infra, addr, addrlen, nm, nmlen,
+			timenow))) {
 			log_err("set_lame: malloc failure");
 			return 0;
 		}
 		needtoinsert = 1;
-	} else if( ((struct infra_data*)e->data)->ttl < timenow) {
+	} else if( ((struct infra_lame_data*)e->data)->ttl < timenow) {
 		/* expired, reuse existing entry */
-		data_entry_init(infra, e, timenow);
+		lame_entry_init(infra, e, timenow);
 	}
 	/* got an entry, now set the zone lame */
-	data = (struct infra_data*)e->data;
+	data = (struct infra_lame_data*)e->data;
 	/* merge data (if any) */
 	if(dnsseclame)
 		data->isdnsseclame = 1;
@@ -509,18 +627,16 @@ infra_set_lame(struct infra_cache* infra, struct sockaddr_storage* addr,
 		data->lame_other = 1;
 	/* done */
 	if(needtoinsert)
-		slabhash_insert(infra->hosts, e->hash, e, e->data, NULL);
+		slabhash_insert(infra->lame, e->hash, e, e->data, NULL);
 	else 	{ lock_rw_unlock(&e->lock); }
 	return 1;
 }
 
 void 
 infra_update_tcp_works(struct infra_cache* infra,
-        struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* nm,
-	size_t nmlen)
+        struct sockaddr_storage* addr, socklen_t addrlen)
 {
-	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
-		nm, nmlen, 1);
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen, 1);
 	struct infra_data* data;
 	if(!e)
 		return; /* doesn't exist */
@@ -534,16 +650,15 @@ infra_update_tcp_works(struct infra_cache* infra,
 
 int 
 infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
-	socklen_t addrlen, uint8_t* nm, size_t nmlen, int qtype,
-	int roundtrip, int orig_rtt, time_t timenow)
+	socklen_t addrlen, int qtype, int roundtrip, int orig_rtt,
+	time_t timenow)
 {
-	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
-		nm, nmlen, 1);
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen, 1);
 	struct infra_data* data;
 	int needtoinsert = 0;
 	int rto = 1;
 	if(!e) {
-		if(!(e = new_entry(infra, addr, addrlen, nm, nmlen, timenow)))
+		if(!(e = new_entry(infra, addr, addrlen, timenow)))
 			return 0;
 		needtoinsert = 1;
 	} else if(((struct infra_data*)e->data)->ttl < timenow) {
@@ -570,6 +685,7 @@ infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 		if(rtt_unclamped(&data->rtt) >= USEFUL_SERVER_TOP_TIMEOUT)
 			rtt_init(&data->rtt);
 		rtt_update(&data->rtt, roundtrip);
+		rtt_hist_add(&data->hist, roundtrip);
 		data->probedelay = 0;
 		if(qtype == LDNS_RR_TYPE_A)
 			data->timeout_A = 0;
@@ -587,12 +703,11 @@ infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
 }
 
 long long infra_get_host_rto(struct infra_cache* infra,
-        struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* nm,
-	size_t nmlen, struct rtt_info* rtt, int* delay, time_t timenow,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	struct rtt_info* rtt, int* delay, time_t timenow,
 	int* tA, int* tAAAA, int* tother)
 {
-	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
-		nm, nmlen, 0);
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen, 0);
 	struct infra_data* data;
 	long long ttl = -2;
 	if(!e) return -1;
@@ -611,17 +726,35 @@ long long infra_get_host_rto(struct infra_cache* infra,
 	return ttl;
 }
 
+int
+infra_get_rtt_percentile(struct infra_cache* infra,
+	struct sockaddr_storage* addr, socklen_t addrlen, int pct,
+	time_t timenow)
+{
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen, 0);
+	struct infra_data* data;
+	int ms = -1;
+	if(!e) return -1;
+	data = (struct infra_data*)e->data;
+	if(data->ttl >= timenow) {
+		ms = rtt_hist_percentile(&data->hist, pct);
+		/* a percentile beyond the timeout is of no use */
+		if(ms >= data->rtt.rto)
+			ms = -1;
+	}
+	lock_rw_unlock(&e->lock);
+	return ms;
+}
+
 int 
 infra_edns_update(struct infra_cache* infra, struct sockaddr_storage* addr,
-	socklen_t addrlen, uint8_t* nm, size_t nmlen, int edns_version,
-	time_t timenow)
+	socklen_t addrlen, int edns_version, time_t timenow)
 {
-	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
-		nm, nmlen, 1);
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen, 1);
 	struct infra_data* data;
 	int needtoinsert = 0;
 	if(!e) {
-		if(!(e = new_entry(infra, addr, addrlen, nm, nmlen, timenow)))
+		if(!(e = new_entry(infra, addr, addrlen, timenow)))
 			return 0;
 		needtoinsert = 1;
 	} else if(((struct infra_data*)e->data)->ttl < timenow) {
@@ -649,77 +782,72 @@ infra_get_lame_rtt(struct infra_cache* infra,
 	int* lame, int* dnsseclame, int* reclame, int* rtt, time_t timenow)
 {
 	struct infra_data* host;
-	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
-		name, namelen, 0);
-	if(!e) 
-		return 0;
-	host = (struct infra_data*)e->data;
-	*rtt = rtt_unclamped(&host->rtt);
-	if(host->rtt.rto >= PROBE_MAXRTO && timenow < host->probedelay
-		&& rtt_notimeout(&host->rtt)*4 <= host->rtt.rto) {
-		/* single probe for this domain, and we are not probing */
-		/* unless the query type allows a probe to happen */
-		if(qtype == LDNS_RR_TYPE_A) {
-			if(host->timeout_A >= TIMEOUT_COUNT_MAX)
-				*rtt = USEFUL_SERVER_TOP_TIMEOUT;
-			else	*rtt = USEFUL_SERVER_TOP_TIMEOUT-1000;
-		} else if(qtype == LDNS_RR_TYPE_AAAA) {
-			if(host->timeout_AAAA >= TIMEOUT_COUNT_MAX)
-				*rtt = USEFUL_SERVER_TOP_TIMEOUT;
-			else	*rtt = USEFUL_SERVER_TOP_TIMEOUT-1000;
+	struct infra_lame_data* zl;
+	int found = 0;
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen, 0);
+	*lame = 0;
+	*dnsseclame = 0;
+	*reclame = 0;
+	if(e) {
+		host = (struct infra_data*)e->data;
+		if(timenow > host->ttl) {
+			/* expired entry */
+			/* see if this can be a re-probe of an unresponsive
+			 * server */
+			/* minus 1000 because that is outside of the RTTBAND,
+			 * so blacklisted servers stay blacklisted if this is
+			 * chosen */
+			if(host->rtt.rto >= USEFUL_SERVER_TOP_TIMEOUT) {
+				lock_rw_unlock(&e->lock);
+				*rtt = USEFUL_SERVER_TOP_TIMEOUT-1000;
+				return 1;
+			}
+			lock_rw_unlock(&e->lock);
 		} else {
-			if(host->timeout_other >= TIMEOUT_COUNT_MAX)
-				*rtt = USEFUL_SERVER_TOP_TIMEOUT;
-			else	*rtt = USEFUL_SERVER_TOP_TIMEOUT-1000;
-		}
-	}
-	if(timenow > host->ttl) {
-		/* expired entry */
-		/* see if this can be a re-probe of an unresponsive server */
-		/* minus 1000 because that is outside of the RTTBAND, so
-		 * blacklisted servers stay blacklisted if this is chosen */
-		if(host->rtt.rto >= USEFUL_SERVER_TOP_TIMEOUT) {
+			found = 1;
+			*rtt = rtt_unclamped(&host->rtt);
+			if(host->rtt.rto >= PROBE_MAXRTO &&
+				timenow < host->probedelay &&
+				rtt_notimeout(&host->rtt)*4 <= host->rtt.rto) {
+				/* single probe for this domain, and we are not
+				 * probing, unless the query type allows a
+				 * probe to happen */
+				uint8_t t;
+				if(qtype == LDNS_RR_TYPE_A)
+					t = host->timeout_A;
+				else if(qtype == LDNS_RR_TYPE_AAAA)
+					t = host->timeout_AAAA;
+				else	t = host->timeout_other;
+				if(t >= TIMEOUT_COUNT_MAX)
+					*rtt = USEFUL_SERVER_TOP_TIMEOUT;
+				else	*rtt = USEFUL_SERVER_TOP_TIMEOUT-1000;
+			}
 			lock_rw_unlock(&e->lock);
-			*rtt = USEFUL_SERVER_TOP_TIMEOUT-1000;
-			*lame = 0;
-			*dnsseclame = 0;
-			*reclame = 0;
-			return 1;
 		}
+	}
+	/* the lameness of the server for this zone */
+	e = infra_lookup_lame(infra, addr, addrlen, name, namelen, 0);
+	if(!e)
+		return found;
+	zl = (struct infra_lame_data*)e->data;
+	if(timenow > zl->ttl) {
 		lock_rw_unlock(&e->lock);
-		return 0;
+		return found;
 	}
+	if(!found)
+		*rtt = UNKNOWN_SERVER_NICENESS;
 	/* check lameness first */
-	if(host->lame_type_A && qtype == LDNS_RR_TYPE_A) {
-		lock_rw_unlock(&e->lock);
+	if(zl->lame_type_A && qtype == LDNS_RR_TYPE_A) {
 		*lame = 1;
-		*dnsseclame = 0;
-		*reclame = 0;
-		return 1;
-	} else if(host->lame_other && qtype != LDNS_RR_TYPE_A) {
-		lock_rw_unlock(&e->lock);
+	} else if(zl->lame_other && qtype != LDNS_RR_TYPE_A) {
 		*lame = 1;
-		*dnsseclame = 0;
-		*reclame = 0;
-		return 1;
-	} else if(host->isdnsseclame) {
-		lock_rw_unlock(&e->lock);
-		*lame = 0;
+	} else if(zl->isdnsseclame) {
 		*dnsseclame = 1;
-		*reclame = 0;
-		return 1;
-	} else if(host->rec_lame) {
-		lock_rw_unlock(&e->lock);
-		*lame = 0;
-		*dnsseclame = 0;
+	} else if(zl->rec_lame) {
 		*reclame = 1;
-		return 1;
 	}
-	/* no lameness for this type of query */
+	/* else no lameness for this type of query */
 	lock_rw_unlock(&e->lock);
-	*lame = 0;
-	*dnsseclame = 0;
-	*reclame = 0;
 	return 1;
 }
 
@@ -955,7 +1083,8 @@ int infra_ratelimit_exceeded(struct infra_cache* infra, uint8_t* name,
 size_t 
 infra_get_mem(struct infra_cache* infra)
 {
-	size_t s = sizeof(*infra) + slabhash_get_mem(infra->hosts);
+	size_t s = sizeof(*infra) + slabhash_get_mem(infra->hosts)
+		+ slabhash_get_mem(infra->lame);
 	if(infra->domain_rates) s += slabhash_get_mem(infra->domain_rates);
 	if(infra->client_ip_rates) s += slabhash_get_mem(infra->client_ip_rates);
 	/* ignore domain_limits because walk through tree is big */
@@ -37,6 +37,10 @@
  * \file
  *
  * This file contains the infrastructure cache, as well as rate limiting.
+ * The host information, roundtrip times and EDNS support, is kept per
+ * server address, and shared by all the zones that the server serves.
+ * Lameness is kept per server address and zone, in a separate table
+ * that only has entries for servers that have been found lame.
  * Note that there are two sorts of rate-limiting here:
  *  - Pre-cache, per-query rate limiting (query ratelimits)
  *  - Post-cache, per-domain name rate limiting (infra-ratelimits)
@@ -53,24 +57,19 @@ struct slabhash;
 struct config_file;
 
 /**
- * Host information kept for every server, per zone.
+ * Host information kept for every server address.
  */
 struct infra_key {
 	/** the host address. */
 	struct sockaddr_storage addr;
 	/** length of addr. */
 	socklen_t addrlen;
-	/** zone name in wireformat */
-	uint8_t* zonename;
-	/** length of zonename */
-	size_t namelen;
 	/** hash table entry, data of type infra_data. */
 	struct lruhash_entry entry;
 };
 
 /**
  * Host information encompasses host capabilities and retransmission timeouts.
- * And lameness information (notAuthoritative, noEDNS, Recursive)
  */
 struct infra_data {
 	/** TTL value for this entry. absolute time. */
@@ -80,6 +79,8 @@ struct infra_data {
 	time_t probedelay;
 	/** round trip times for timeout calculation */
 	struct rtt_info rtt;
+	/** histogram of round trip times, for percentiles */
+	struct rtt_hist hist;
 
 	/** edns version that the host supports, -1 means no EDNS */
 	int edns_version;
@@ -88,8 +89,38 @@ struct infra_data {
 	 * and cause a timeout */
 	uint8_t edns_lame_known;
 
-	/** is the host lame (does not serve the zone authoritatively),
-	 * or is the host dnssec lame (does not serve DNSSEC data) */
+	/** timeouts counter for type A */
+	uint8_t timeout_A;
+	/** timeouts counter for type AAAA */
+	uint8_t timeout_AAAA;
+	/** timeouts counter for others */
+	uint8_t timeout_other;
+};
+
+/**
+ * Lameness information kept for a server, per zone.
+ */
+struct infra_lame_key {
+	/** the host address. */
+	struct sockaddr_storage addr;
+	/** length of addr. */
+	socklen_t addrlen;
+	/** zone name in wireformat */
+	uint8_t* zonename;
+	/** length of zonename */
+	size_t namelen;
+	/** hash table entry, data of type infra_lame_data. */
+	struct lruhash_entry entry;
+};
+
+/**
+ * Lameness information (notAuthoritative, noDNSSEC, Recursive) of a
+ * server for a zone.
+ */
+struct infra_lame_data {
+	/** TTL value for this entry. absolute time. */
+	time_t ttl;
+	/** is the host dnssec lame (does not serve DNSSEC data) */
 	uint8_t isdnsseclame;
 	/** is the host recursion lame (not AA, but RA) */
 	uint8_t rec_lame;
@@ -97,21 +128,16 @@ struct infra_data {
 	uint8_t lame_type_A;
 	/** the host is lame (not authoritative) for other query types */
 	uint8_t lame_other;
-
-	/** timeouts counter for type A */
-	uint8_t timeout_A;
-	/** timeouts counter for type AAAA */
-	uint8_t timeout_AAAA;
-	/** timeouts counter for others */
-	uint8_t timeout_other;
 };
 
 /**
  * Infra cache 
  */
 struct infra_cache {
-	/** The hash table with hosts */
+	/** The hash table with hosts, per address */
 	struct slabhash* hosts;
+	/** The hash table with lameness, per address and zone */
+	struct slabhash* lame;
 	/** TTL value for host information, in seconds */
 	int host_ttl;
 	/** hash table with query rates per name: rate_key, rate_data */
@@ -186,8 +212,11 @@ struct rate_data {
 
 /** infra host cache default hash lookup size */
 #define INFRA_HOST_STARTSIZE 32
-/** bytes per zonename reserved in the hostcache, dnamelen(zonename.com.) */
+/** bytes per zonename reserved in the lame cache, dnamelen(zonename.com.) */
 #define INFRA_BYTES_NAME 14
+/** the lame cache has room for numhosts divided by this, because few
+ * servers are lame, and the total stays close to numhosts entries */
+#define INFRA_LAME_DIVISOR 4
 
 /**
  * Create infra cache.
@@ -218,26 +247,35 @@ struct infra_cache* infra_adjust(struct infra_cache* infra,
  * @param infra: infrastructure cache.
  * @param addr: host address.
  * @param addrlen: length of addr.
+ * @param wr: if true, writelock, else readlock.
+ * @return the entry, could be expired (this is not checked) or NULL.
+ */
+struct lruhash_entry* infra_lookup_nottl(struct infra_cache* infra,
+	struct sockaddr_storage* addr, socklen_t addrlen, int wr);
+
+/**
+ * Find the lameness of a host for a zone.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
  * @param name: domain name of zone.
  * @param namelen: length of domain name.
  * @param wr: if true, writelock, else readlock.
  * @return the entry, could be expired (this is not checked) or NULL.
  */
-struct lruhash_entry* infra_lookup_nottl(struct infra_cache* infra,
+struct lruhash_entry* infra_lookup_lame(struct infra_cache* infra,
 	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
 	size_t namelen, int wr);
 
 /**
  * Find host information to send a packet. Creates new entry if not found.
- * Lameness is empty. EDNS is 0 (try with first), and rtt is returned for 
- * the first message to it.
+ * EDNS is 0 (try with first), and rtt is returned for the first message
+ * to it.
  * Use this to send a packet only, because it also locks out others when
  * probing is restricted.
  * @param infra: infrastructure cache.
  * @param addr: host address.
  * @param addrlen: length of addr.
- * @param name: domain name of zone.
- * @param namelen: length of domain name.
  * @param timenow: what time it is now.
  * @param edns_vs: edns version it supports, is returned.
  * @param edns_lame_known: if EDNS lame (EDNS is dropped in transit) has
@@ -246,8 +284,8 @@ struct lruhash_entry* infra_lookup_nottl(struct infra_cache* infra,
  * @return: 0 on error.
  */
 int infra_host(struct infra_cache* infra, struct sockaddr_storage* addr, 
-	socklen_t addrlen, uint8_t* name, size_t namelen,
-	time_t timenow, int* edns_vs, uint8_t* edns_lame_known, int* to);
+	socklen_t addrlen, time_t timenow, int* edns_vs,
+	uint8_t* edns_lame_known, int* to);
 
 /**
  * Set a host to be lame for the given zone.
@@ -274,8 +312,6 @@ int infra_set_lame(struct infra_cache* infra,
  * @param infra: infrastructure cache.
  * @param addr: host address.
  * @param addrlen: length of addr.
- * @param name: zone name
- * @param namelen: zone name length
  * @param qtype: query type.
  * @param roundtrip: estimate of roundtrip time in milliseconds or -1 for 
  * 	timeout.
@@ -285,28 +321,23 @@ int infra_set_lame(struct infra_cache* infra,
  * @return: 0 on error. new rto otherwise.
  */
 int infra_rtt_update(struct infra_cache* infra, struct sockaddr_storage* addr,
-	socklen_t addrlen, uint8_t* name, size_t namelen, int qtype,
-	int roundtrip, int orig_rtt, time_t timenow);
+	socklen_t addrlen, int qtype, int roundtrip, int orig_rtt,
+	time_t timenow);
 
 /**
  * Update information for the host, store that a TCP transaction works.
  * @param infra: infrastructure cache.
  * @param addr: host address.
  * @param addrlen: length of addr.
- * @param name: name of zone
- * @param namelen: length of name
  */
 void infra_update_tcp_works(struct infra_cache* infra,
-        struct sockaddr_storage* addr, socklen_t addrlen,
-	uint8_t* name, size_t namelen);
+        struct sockaddr_storage* addr, socklen_t addrlen);
 
 /**
  * Update edns information for the host.
  * @param infra: infrastructure cache.
  * @param addr: host address.
  * @param addrlen: length of addr.
- * @param name: name of zone
- * @param namelen: length of name
  * @param edns_version: the version that it publishes.
  * 	If it is known to support EDNS then no-EDNS is not stored over it.
  * @param timenow: what time it is now.
@@ -314,7 +345,7 @@ void infra_update_tcp_works(struct infra_cache* infra,
  */
 int infra_edns_update(struct infra_cache* infra,
         struct sockaddr_storage* addr, socklen_t addrlen,
-	uint8_t* name, size_t namelen, int edns_version, time_t timenow);
+	int edns_version, time_t timenow);
 
 /**
  * Get Lameness information and average RTT if host is in the cache.
@@ -330,7 +361,8 @@ int infra_edns_update(struct infra_cache* infra,
  *	is dnssec-lame.
  * @param reclame: if function returns true, this is if it is recursion lame.
  * @param rtt: if function returns true, this returns avg rtt of the server.
- * 	The rtt value is unclamped and reflects recent timeouts.
+ * 	The rtt value is unclamped and reflects recent timeouts.  If only
+ * 	the lameness is known, it is UNKNOWN_SERVER_NICENESS.
  * @param timenow: what time it is now.
  * @return if found in cache, or false if not (or TTL bad).
  */
@@ -344,8 +376,6 @@ int infra_get_lame_rtt(struct infra_cache* infra,
  * @param infra: infra cache.
  * @param addr: host address.
  * @param addrlen: length of addr.
- * @param name: zone name
- * @param namelen: zone name length
  * @param rtt: the rtt_info is copied into here (caller alloced return struct).
  * @param delay: probe delay (if any).
  * @param timenow: what time it is now.
@@ -356,10 +386,25 @@ int infra_get_lame_rtt(struct infra_cache* infra,
  *	TTL -2: found but expired.
  */
 long long infra_get_host_rto(struct infra_cache* infra,
-        struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* name,
-	size_t namelen, struct rtt_info* rtt, int* delay, time_t timenow,
+        struct sockaddr_storage* addr, socklen_t addrlen,
+	struct rtt_info* rtt, int* delay, time_t timenow,
 	int* tA, int* tAAAA, int* tother);
 
+/**
+ * Get a percentile of the observed roundtrip times of the server.
+ * Used to decide when to send a hedged query to another server.
+ * @param infra: infrastructure cache.
+ * @param addr: host address.
+ * @param addrlen: length of addr.
+ * @param pct: the percentile, 1..99.
+ * @param timenow: what time it is now.
+ * @return the percentile in msec, or -1 if the host is not in the cache,
+ *	has too few samples, or the percentile is not below its timeout.
+ */
+int infra_get_rtt_percentile(struct infra_cache* infra,
+	struct sockaddr_storage* addr, socklen_t addrlen, int pct,
+	time_t timenow);
+
 /**
  * Increment the query rate counter for a delegation point.
  * @param infra: infra cache.
@@ -422,8 +467,8 @@ int infra_ip_ratelimit_inc(struct infra_cache* infra,
  */
 size_t infra_get_mem(struct infra_cache* infra);
 
-/** calculate size for the hashtable, does not count size of lameness,
- * so the hashtable is a fixed number of items */
+/** calculate size for the hashtable, the hashtable is a fixed number
+ * of items */
 size_t infra_sizefunc(void* k, void* d);
 
 /** compare two addresses, returns -1, 0, or +1 */
@@ -432,9 +477,21 @@ int infra_compfunc(void* key1, void* key2);
 /** delete key, and destroy the lock */
 void infra_delkeyfunc(void* k, void* arg);
 
-/** delete data and destroy the lameness hashtable */
+/** delete data */
 void infra_deldatafunc(void* d, void* arg);
 
+/** calculate size for the lameness hashtable */
+size_t infra_lame_sizefunc(void* k, void* d);
+
+/** compare two addresses and zone names, returns -1, 0, or +1 */
+int infra_lame_compfunc(void* key1, void* key2);
+
+/** delete lameness key, and destroy the lock */
+void infra_lame_delkeyfunc(void* k, void* arg);
+
+/** delete lameness data */
+void infra_lame_deldatafunc(void* d, void* arg);
+
 /** calculate size for the hashtable */
 size_t rate_sizefunc(void* k, void* d);
 
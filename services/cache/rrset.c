@@ -80,11 +80,14 @@ void rrset_cache_delete(struct rrset_cache* r)
 struct rrset_cache* rrset_cache_adjust(struct rrset_cache *r, 
 	struct config_file* cfg, struct alloc_cache* alloc)
 {
-	if(!r || !cfg || cfg->rrset_cache_slabs != r->table.size ||
-		cfg->rrset_cache_size != slabhash_get_size(&r->table))
+	if(!r || !cfg)
 	{
 		rrset_cache_delete(r);
 		r = rrset_cache_create(cfg, alloc);
+	} else if(!slabhash_adjust(&r->table, cfg->rrset_cache_slabs,
+		cfg->rrset_cache_size)) {
+		rrset_cache_delete(r);
+		r = NULL;
 	}
 	return r;
 }
@@ -93,8 +96,11 @@ void
 rrset_cache_touch(struct rrset_cache* r, struct ub_packed_rrset_key* key,
         hashvalue_type hash, rrset_id_type id)
 {
-	struct lruhash* table = slabhash_gettable(&r->table, hash);
+	struct lruhash* table;
 	/* 
+	 * During a rehash the entry can be in the other slab array, and
+	 * the LRU touch is skipped, it is only a hint.
+	 *
 	 * This leads to locking problems, deadlocks, if the caller is 
 	 * holding any other rrset lock.
 	 * Because a lookup through the hashtable does:
@@ -104,7 +110,8 @@ rrset_cache_touch(struct rrset_cache* r, struct ub_packed_rrset_key* key,
 	 * And if two threads do this, it results in deadlock.
 	 * So, the caller must not hold entrylock.
 	 */
-	lock_quick_lock(&table->lock);
+	if(!(table = slabhash_locktable(&r->table, hash, &key->entry)))
+		return;
 	/* we have locked the hash table, the item can still be deleted.
 	 * because it could already have been reclaimed, but not yet set id=0.
 	 * This is because some lruhash routines have lazy deletion.
@@ -237,6 +244,29 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 	return 0;
 }
 
+int
+rrset_cache_check_update(struct rrset_cache* r,
+	struct ub_packed_rrset_key* k, struct rrset_ref* ref, time_t timenow)
+{
+	struct lruhash_entry* e;
+	int equal;
+	if(!(e=slabhash_lookup(&r->table, k->entry.hash, k, 0)))
+		return 0;
+	equal = rrsetdata_equal((struct packed_rrset_data*)k->entry.data,
+		(struct packed_rrset_data*)e->data);
+	/* the type NS check is not passed, it only changes the TTLs of
+	 * the new rrset when it is inserted, that is done in the update */
+	if(need_to_update_rrset(k->entry.data, e->data, timenow, equal, 0)) {
+		lock_rw_unlock(&e->lock);
+		return 0;
+	}
+	ref->key = (struct ub_packed_rrset_key*)e->key;
+	ref->id = ref->key->id;
+	lock_rw_unlock(&e->lock);
+	if(equal) return 2;
+	return 1;
+}
+
 struct ub_packed_rrset_key* 
 rrset_cache_lookup(struct rrset_cache* r, uint8_t* qname, size_t qnamelen, 
 	uint16_t qtype, uint16_t qclass, uint32_t flags, time_t timenow,
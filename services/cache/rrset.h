@@ -75,7 +75,9 @@ void rrset_cache_delete(struct rrset_cache* r);
 
 /**
  * Adjust settings of the cache to settings from the config file.
- * May purge the cache. May recreate the cache.
+ * The cache contents are kept, if it shrinks the least recently used
+ * entries are deleted.  A change in the number of slabs rehashes the
+ * entries into the new slab array.
  * There may be no threading or use by other threads.
  * @param r: rrset cache to adjust (like realloc).
  * @param cfg: config settings or NULL for defaults.
@@ -133,6 +135,26 @@ void rrset_cache_touch(struct rrset_cache* r, struct ub_packed_rrset_key* key,
 int rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref, 
 	struct alloc_cache* alloc, time_t timenow);
 
+/**
+ * Check if rrset_cache_update would keep the cached rrset, before the
+ * rrset is copied for insertion. Used to store rrsets from a message in
+ * a region, so that an rrset that is not going to be inserted is not
+ * allocated and copied first.
+ * @param r: the rrset cache.
+ * @param k: the rrset to check, it is not changed. Its entry.hash must
+ *	be set, the TTLs in it are relative.
+ * @param ref: if the cached rrset is superior, the reference to that
+ *	rrset is returned here.
+ * @param timenow: current time (to see if ttl in cache is expired).
+ * @return:
+ * 	0: not in the cache or the cache is not superior, the rrset has to
+ * 	   be copied and passed to rrset_cache_update.
+ * 	1: reference set, item in cache is superior.
+ * 	2: reference set, item in cache is superior, and the rdata is equal.
+ */
+int rrset_cache_check_update(struct rrset_cache* r,
+	struct ub_packed_rrset_key* k, struct rrset_ref* ref, time_t timenow);
+
 /**
  * Lookup rrset. You obtain read/write lock. You must unlock before lookup
  * anything of else.
@@ -59,6 +59,9 @@
 #include "sldns/wire2str.h"
 #include "services/localzone.h"
 #include "util/data/dname.h"
+#include "util/storage/keyhash.h"
+#include "util/storage/hashindex.h"
+#include "util/querylog.h"
 
 /** subtract timers and the values do not overflow or become negative */
 static void
@@ -184,15 +187,45 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 	mesh->mods = *stack;
 	mesh->env = env;
 	rbtree_init(&mesh->run, &mesh_state_compare);
-	rbtree_init(&mesh->all, &mesh_state_compare);
+	mesh->all = hashindex_create(&mesh_state_compare);
+	if(!mesh->all) {
+		timehist_delete(mesh->histogram);
+		sldns_buffer_free(mesh->qbuf_bak);
+		free(mesh);
+		log_err("mesh area alloc: out of memory");
+		return NULL;
+	}
 	mesh->num_reply_addrs = 0;
 	mesh->num_reply_states = 0;
 	mesh->num_detached_states = 0;
 	mesh->num_forever_states = 0;
 	mesh->stats_jostled = 0;
 	mesh->stats_dropped = 0;
+	mesh->num_hedge_sent = 0;
+	mesh->num_hedge_won = 0;
+	mesh->hedge_window_queries = 0;
+	mesh->hedge_window_hedges = 0;
 	mesh->max_reply_states = env->cfg->num_queries_per_thread;
 	mesh->max_forever_states = (mesh->max_reply_states+1)/2;
+	mesh->adm_client_quota = env->cfg->mesh_client_quota;
+	mesh->adm_zone_quota = env->cfg->mesh_zone_quota;
+	mesh->adm_prefetch_reserve = env->cfg->mesh_prefetch_reserve;
+	if(mesh->adm_client_quota || mesh->adm_zone_quota) {
+		mesh->adm_client_count = (size_t*)calloc(MESH_ADM_BUCKETS,
+			sizeof(size_t));
+		mesh->adm_zone_count = (size_t*)calloc(MESH_ADM_BUCKETS,
+			sizeof(size_t));
+		if(!mesh->adm_client_count || !mesh->adm_zone_count) {
+			free(mesh->adm_client_count);
+			free(mesh->adm_zone_count);
+			hashindex_delete(mesh->all);
+			timehist_delete(mesh->histogram);
+			sldns_buffer_free(mesh->qbuf_bak);
+			free(mesh);
+			log_err("mesh area alloc: out of memory");
+			return NULL;
+		}
+	}
 #ifndef S_SPLINT_S
 	mesh->jostle_max.tv_sec = (time_t)(env->cfg->jostle_time / 1000);
 	mesh->jostle_max.tv_usec = (time_t)((env->cfg->jostle_time % 1000)
@@ -203,15 +236,15 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 
 /** help mesh delete delete mesh states */
 static void
-mesh_delete_helper(rbnode_type* n)
+mesh_delete_helper(struct hashindex_node* n)
 {
 	struct mesh_state* mstate = (struct mesh_state*)n->key;
 	/* perform a full delete, not only 'cleanup' routine,
 	 * because other callbacks expect a clean state in the mesh.
 	 * For 're-entrant' calls */
 	mesh_state_delete(&mstate->s);
-	/* but because these delete the items from the tree, postorder
-	 * traversal and rbtree rebalancing do not work together */
+	/* but because these delete the items from the index, and other
+	 * items from the run tree, a traversal does not work */
 }
 
 void 
@@ -220,10 +253,13 @@ mesh_delete(struct mesh_area* mesh)
 	if(!mesh)
 		return;
 	/* free all query states */
-	while(mesh->all.count)
-		mesh_delete_helper(mesh->all.root);
+	while(mesh->all->count)
+		mesh_delete_helper(hashindex_first(mesh->all));
+	hashindex_delete(mesh->all);
 	timehist_delete(mesh->histogram);
 	sldns_buffer_free(mesh->qbuf_bak);
+	free(mesh->adm_client_count);
+	free(mesh->adm_zone_count);
 	free(mesh);
 }
 
@@ -231,12 +267,12 @@ void
 mesh_delete_all(struct mesh_area* mesh)
 {
 	/* free all query states */
-	while(mesh->all.count)
-		mesh_delete_helper(mesh->all.root);
+	while(mesh->all->count)
+		mesh_delete_helper(hashindex_first(mesh->all));
 	mesh->stats_dropped += mesh->num_reply_addrs;
 	/* clear mesh area references */
 	rbtree_init(&mesh->run, &mesh_state_compare);
-	rbtree_init(&mesh->all, &mesh_state_compare);
+	hashindex_clear(mesh->all);
 	mesh->num_reply_addrs = 0;
 	mesh->num_reply_states = 0;
 	mesh->num_detached_states = 0;
@@ -245,13 +281,159 @@ mesh_delete_all(struct mesh_area* mesh)
 	mesh->forever_last = NULL;
 	mesh->jostle_first = NULL;
 	mesh->jostle_last = NULL;
+	if(mesh->adm_client_count) {
+		memset(mesh->adm_client_count, 0,
+			sizeof(size_t)*MESH_ADM_BUCKETS);
+		memset(mesh->adm_zone_count, 0,
+			sizeof(size_t)*MESH_ADM_BUCKETS);
+	}
+}
+
+/** hash bucket of the client network, for the admission counters */
+static uint16_t
+mesh_adm_client_bucket(struct comm_reply* rep)
+{
+	uint8_t key[1+16];
+	size_t len;
+	if(addr_is_ip6(&rep->addr, rep->addrlen)) {
+		struct sockaddr_in6* sa = (struct sockaddr_in6*)&rep->addr;
+		key[0] = 6;
+		memmove(key+1, &sa->sin6_addr, MESH_ADM_PREFIX6/8);
+		len = 1+MESH_ADM_PREFIX6/8;
+	} else {
+		struct sockaddr_in* sa = (struct sockaddr_in*)&rep->addr;
+		key[0] = 4;
+		memmove(key+1, &sa->sin_addr, MESH_ADM_PREFIX4/8);
+		len = 1+MESH_ADM_PREFIX4/8;
+	}
+	return (uint16_t)(keyhash(key, len, 0) & (MESH_ADM_BUCKETS-1));
+}
+
+/** hash bucket of the zone of the query, for the admission counters */
+static uint16_t
+mesh_adm_zone_bucket(struct query_info* qinfo)
+{
+	uint8_t* zone = qinfo->qname;
+	/* random subdomain floods change the first label, count the name
+	 * as its parent, but keep names like example.com. whole */
+	if(dname_count_labels(zone) > 3)
+		zone += *zone + 1;
+	return (uint16_t)(dname_query_hash(zone, 0) & (MESH_ADM_BUCKETS-1));
+}
+
+/**
+ * See if the admission quotas allow a new reply state. The quotas are
+ * only used when the request list is more than half full.
+ * @param mesh: mesh area.
+ * @param client: client network bucket of the query.
+ * @param zone: zone bucket of the query.
+ * @return false if the query must be dropped, it is counted in the stats.
+ */
+static int
+mesh_adm_allow(struct mesh_area* mesh, uint16_t client, uint16_t zone)
+{
+	if(mesh->num_reply_states < mesh->max_reply_states/2)
+		return 1;
+	if(mesh->adm_client_quota &&
+		mesh->adm_client_count[client] >= mesh->adm_client_quota) {
+		mesh->stats_adm_client++;
+		return 0;
+	}
+	if(mesh->adm_zone_quota &&
+		mesh->adm_zone_count[zone] >= mesh->adm_zone_quota) {
+		mesh->stats_adm_zone++;
+		return 0;
+	}
+	return 1;
 }
 
-int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
+/** count a new reply state in the admission counters */
+static void
+mesh_adm_count(struct mesh_area* mesh, struct mesh_state* m,
+	uint16_t client, uint16_t zone)
+{
+	m->adm_client = client;
+	m->adm_zone = zone;
+	m->adm_counted = 1;
+	mesh->adm_client_count[client]++;
+	mesh->adm_zone_count[zone]++;
+}
+
+/** remove a reply state from the admission counters */
+static void
+mesh_adm_uncount(struct mesh_area* mesh, struct mesh_state* m)
+{
+	log_assert(mesh->adm_client_count[m->adm_client] > 0);
+	log_assert(mesh->adm_zone_count[m->adm_zone] > 0);
+	mesh->adm_client_count[m->adm_client]--;
+	mesh->adm_zone_count[m->adm_zone]--;
+	m->adm_counted = 0;
+}
+
+/** remove a reply state to make space for a new one, the supers are
+ * notified of failure, and the query buffer is preserved */
+static void
+mesh_make_space_delete(struct mesh_area* mesh, struct mesh_state* m,
+	sldns_buffer* qbuf)
+{
+	/* backup the query */
+	if(qbuf) sldns_buffer_copy(mesh->qbuf_bak, qbuf);
+	/* notify supers */
+	if(m->super_set.count > 0) {
+		verbose(VERB_ALGO, "notify supers of failure");
+		m->s.return_msg = NULL;
+		m->s.return_rcode = LDNS_RCODE_SERVFAIL;
+		mesh_walk_supers(mesh, m);
+	}
+	mesh_state_delete(&m->s);
+	/* restore the query - note that the qinfo ptr to
+	 * the querybuffer is then correct again. */
+	if(qbuf) sldns_buffer_copy(qbuf, mesh->qbuf_bak);
+}
+
+/**
+ * Fair eviction, remove the oldest state in the jostle list of the client
+ * network with the most reply states, if it has more than the client of
+ * the new query would have with the new query.
+ * @param mesh: mesh area.
+ * @param qbuf: query buffer to preserve, or NULL.
+ * @param weight: number of reply states of the new client, with the new
+ *	one, or 1 for a prefetch.
+ * @return false if nothing was evicted.
+ */
+static int
+mesh_adm_evict(struct mesh_area* mesh, sldns_buffer* qbuf, size_t weight)
+{
+	struct mesh_state* m, *victim = NULL;
+	size_t most = weight, n = 0;
+	for(m = mesh->jostle_first; m && n < MESH_ADM_EVICT_SCAN;
+		m = m->next, n++) {
+		if(m->adm_counted && m->reply_list &&
+			mesh->adm_client_count[m->adm_client] > most) {
+			most = mesh->adm_client_count[m->adm_client];
+			victim = m;
+		}
+	}
+	if(!victim)
+		return 0;
+	log_nametypeclass(VERB_ALGO, "query evicted to make space for a "
+		"less busy client", victim->s.qinfo.qname,
+		victim->s.qinfo.qtype, victim->s.qinfo.qclass);
+	mesh->stats_adm_evicted ++;
+	mesh_make_space_delete(mesh, victim, qbuf);
+	return 1;
+}
+
+int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf,
+	int prefetch, uint16_t client)
 {
 	struct mesh_state* m = mesh->jostle_first;
+	size_t max = mesh->max_reply_states;
+	/* new client queries leave the reserve to prefetches */
+	if(!prefetch && mesh->adm_prefetch_reserve < max)
+		max -= mesh->adm_prefetch_reserve;
 	/* free space is available */
-	if(mesh->num_reply_states < mesh->max_reply_states)
+	if(mesh->num_reply_states < max)
 		return 1;
 	/* try to kick out a jostle-list item */
 	if(m && m->reply_list && m->list_select == mesh_jostle_list) {
@@ -265,23 +447,15 @@ int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
 				"make space for a new one",
 				m->s.qinfo.qname, m->s.qinfo.qtype,
 				m->s.qinfo.qclass);
-			/* backup the query */
-			if(qbuf) sldns_buffer_copy(mesh->qbuf_bak, qbuf);
-			/* notify supers */
-			if(m->super_set.count > 0) {
-				verbose(VERB_ALGO, "notify supers of failure");
-				m->s.return_msg = NULL;
-				m->s.return_rcode = LDNS_RCODE_SERVFAIL;
-				mesh_walk_supers(mesh, m);
-			}
 			mesh->stats_jostled ++;
-			mesh_state_delete(&m->s);
-			/* restore the query - note that the qinfo ptr to
-			 * the querybuffer is then correct again. */
-			if(qbuf) sldns_buffer_copy(qbuf, mesh->qbuf_bak);
+			mesh_make_space_delete(mesh, m, qbuf);
 			return 1;
 		}
 	}
+	/* replace a query of the busiest client */
+	if(mesh->adm_client_count && mesh_adm_evict(mesh, qbuf,
+		prefetch?1:mesh->adm_client_count[client]+1))
+		return 1;
 	/* no space for new item */
 	return 0;
 }
@@ -295,11 +469,23 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 	int was_detached = 0;
 	int was_noreply = 0;
 	int added = 0;
+	uint16_t adm_client = 0, adm_zone = 0;
 	if(!unique)
 		s = mesh_area_find(mesh, qinfo, qflags&(BIT_RD|BIT_CD), 0, 0);
+	if(mesh->adm_client_count) {
+		adm_client = mesh_adm_client_bucket(rep);
+		adm_zone = mesh_adm_zone_bucket(qinfo);
+	}
 	/* does this create a new reply state? */
 	if(!s || s->list_select == mesh_no_list) {
-		if(!mesh_make_new_space(mesh, rep->c->buffer)) {
+		if(mesh->adm_client_count && !mesh_adm_allow(mesh, adm_client,
+			adm_zone)) {
+			verbose(VERB_ALGO, "Too many queries from the client "
+				"or for the zone. dropping incoming query.");
+			comm_point_drop_reply(rep);
+			return;
+		}
+		if(!mesh_make_new_space(mesh, rep->c->buffer, 0, adm_client)) {
 			verbose(VERB_ALGO, "Too many queries. dropping "
 				"incoming query.");
 			comm_point_drop_reply(rep);
@@ -321,7 +507,7 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 	/* see if it already exists, if not, create one */
 	if(!s) {
 #ifdef UNBOUND_DEBUG
-		struct rbnode_type* n;
+		struct hashindex_node* n;
 #endif
 		s = mesh_state_create(mesh->env, qinfo, qflags&(BIT_RD|BIT_CD), 0, 0);
 		if(!s) {
@@ -357,7 +543,7 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 #else
 		(void)
 #endif
-		rbtree_insert(&mesh->all, &s->node);
+		hashindex_insert(mesh->all, &s->node);
 		log_assert(n != NULL);
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
@@ -387,6 +573,8 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 	}
 	if(was_noreply) {
 		mesh->num_reply_states ++;
+		if(mesh->adm_client_count)
+			mesh_adm_count(mesh, s, adm_client, adm_zone);
 	}
 	mesh->num_reply_addrs++;
 	if(s->list_select == mesh_no_list) {
@@ -423,7 +611,7 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 	/* see if it already exists, if not, create one */
 	if(!s) {
 #ifdef UNBOUND_DEBUG
-		struct rbnode_type* n;
+		struct hashindex_node* n;
 #endif
 		s = mesh_state_create(mesh->env, qinfo, qflags&(BIT_RD|BIT_CD), 0, 0);
 		if(!s) {
@@ -443,7 +631,7 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 #else
 		(void)
 #endif
-		rbtree_insert(&mesh->all, &s->node);
+		hashindex_insert(mesh->all, &s->node);
 		log_assert(n != NULL);
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
@@ -479,7 +667,7 @@ void mesh_new_prefetch(struct mesh_area* mesh, struct query_info* qinfo,
 	struct mesh_state* s = mesh_area_find(mesh, qinfo, qflags&(BIT_RD|BIT_CD),
 		0, 0);
 #ifdef UNBOUND_DEBUG
-	struct rbnode_type* n;
+	struct hashindex_node* n;
 #endif
 	/* already exists, and for a different purpose perhaps.
 	 * if mesh_no_list, keep it that way. */
@@ -491,9 +679,10 @@ void mesh_new_prefetch(struct mesh_area* mesh, struct query_info* qinfo,
 			s->s.prefetch_leeway = leeway;
 		return;
 	}
-	if(!mesh_make_new_space(mesh, NULL)) {
+	if(!mesh_make_new_space(mesh, NULL, 1, 0)) {
 		verbose(VERB_ALGO, "Too many queries. dropped prefetch.");
 		mesh->stats_dropped ++;
+		mesh->stats_adm_prefetch ++;
 		return;
 	}
 
@@ -507,7 +696,7 @@ void mesh_new_prefetch(struct mesh_area* mesh, struct query_info* qinfo,
 #else
 	(void)
 #endif
-	rbtree_insert(&mesh->all, &s->node);
+	hashindex_insert(mesh->all, &s->node);
 	log_assert(n != NULL);
 	/* set detached (it is now) */
 	mesh->num_detached_states++;
@@ -544,6 +733,12 @@ void mesh_report_reply(struct mesh_area* mesh, struct outbound_entry* e,
 	mesh_run(mesh, e->qstate->mesh_info, event, e);
 }
 
+void mesh_report_hedge(struct mesh_area* mesh, struct outbound_entry* e)
+{
+	e->qstate->reply = NULL;
+	mesh_run(mesh, e->qstate->mesh_info, module_event_hedge, e);
+}
+
 struct mesh_state* 
 mesh_state_create(struct module_env* env, struct query_info* qinfo, 
 	uint16_t qflags, int prime, int valrec)
@@ -560,7 +755,6 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 		return NULL;
 	}
 	memset(mstate, 0, sizeof(*mstate));
-	mstate->node = *RBTREE_NULL;
 	mstate->run_node = *RBTREE_NULL;
 	mstate->node.key = mstate;
 	mstate->run_node.key = mstate;
@@ -584,6 +778,8 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 	}
 	/* remove all weird bits from qflags */
 	mstate->s.query_flags = (qflags & (BIT_RD|BIT_CD));
+	mstate->node.hash = query_info_hash(&mstate->s.qinfo,
+		mstate->s.query_flags);
 	mstate->s.is_priming = prime;
 	mstate->s.is_valrec = valrec;
 	mstate->s.reply = NULL;
@@ -684,13 +880,15 @@ mesh_state_delete(struct module_qstate* qstate)
 		log_assert(mesh->num_reply_states > 0);
 		mesh->num_reply_states--;
 	}
+	if(mstate->adm_counted)
+		mesh_adm_uncount(mesh, mstate);
 	ref.node.key = &ref;
 	ref.s = mstate;
 	RBTREE_FOR(super, struct mesh_state_ref*, &mstate->super_set) {
 		(void)rbtree_delete(&super->s->sub_set, &ref);
 	}
 	(void)rbtree_delete(&mesh->run, mstate);
-	(void)rbtree_delete(&mesh->all, mstate);
+	(void)hashindex_remove(mesh->all, &mstate->node);
 	mesh_state_cleanup(mstate);
 }
 
@@ -745,12 +943,38 @@ void mesh_detach_subs(struct module_qstate* qstate)
 			&& ref->s->super_set.count == 0) {
 			mesh->num_detached_states++;
 			log_assert(mesh->num_detached_states + 
-				mesh->num_reply_states <= mesh->all.count);
+				mesh->num_reply_states <= mesh->all->count);
 		}
 	}
 	rbtree_init(&qstate->mesh_info->sub_set, &mesh_state_ref_compare);
 }
 
+void mesh_cancel_subs(struct module_qstate* qstate)
+{
+	struct mesh_area* mesh = qstate->env->mesh;
+	struct mesh_state_ref* ref, lookup;
+	struct mesh_state* sub;
+	rbnode_type* n;
+	lookup.node.key = &lookup;
+	lookup.s = qstate->mesh_info;
+	/* deletion of a sub can change the sub_set, pick first every time */
+	while((n = rbtree_first(&qstate->mesh_info->sub_set)) != RBTREE_NULL) {
+		ref = (struct mesh_state_ref*)n;
+		sub = ref->s;
+		(void)rbtree_delete(&qstate->mesh_info->sub_set, ref);
+		(void)rbtree_delete(&sub->super_set, &lookup);
+		if(sub->reply_list || sub->cb_list || sub->super_set.count != 0)
+			continue;
+		/* nobody waits for it anymore; it is detached and deleted */
+		mesh->num_detached_states++;
+		log_assert(mesh->num_detached_states + 
+			mesh->num_reply_states <= mesh->all->count);
+		log_query_info(VERB_ALGO, "cancel subquery", &sub->s.qinfo);
+		mesh_state_delete(&sub->s);
+	}
+	rbtree_init(&qstate->mesh_info->sub_set, &mesh_state_ref_compare);
+}
+
 int mesh_attach_sub(struct module_qstate* qstate, struct query_info* qinfo,
         uint16_t qflags, int prime, int valrec, struct module_qstate** newq)
 {
@@ -765,6 +989,7 @@ int mesh_attach_sub(struct module_qstate* qstate, struct query_info* qinfo,
 	if(!sub) {
 #ifdef UNBOUND_DEBUG
 		struct rbnode_type* n;
+		struct hashindex_node* hn;
 #endif
 		/* create a new one */
 		sub = mesh_state_create(qstate->env, qinfo, qflags, prime, valrec);
@@ -773,12 +998,12 @@ int mesh_attach_sub(struct module_qstate* qstate, struct query_info* qinfo,
 			return 0;
 		}
 #ifdef UNBOUND_DEBUG
-		n =
+		hn =
 #else
 		(void)
 #endif
-		rbtree_insert(&mesh->all, &sub->node);
-		log_assert(n != NULL);
+		hashindex_insert(mesh->all, &sub->node);
+		log_assert(hn != NULL);
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
 		/* set new query state to run */
@@ -1020,7 +1245,11 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 			m->s.env->mesh->ans_nodata++;
 	}
 	/* Log reply sent */
-	if(m->s.env->cfg->log_replies) {
+	if(m->s.env->cfg->log_replies && m->s.env->qlog) {
+		qlog_reply(m->s.env->qlog, m->s.env->now_tv,
+			&r->query_reply.addr, r->query_reply.addrlen,
+			&m->s.qinfo, duration, 0, r->query_reply.c->buffer);
+	} else if(m->s.env->cfg->log_replies) {
 		log_reply_info(0, &m->s.qinfo, &r->query_reply.addr,
 			r->query_reply.addrlen, duration, 0,
 			r->query_reply.c->buffer);
@@ -1075,7 +1304,10 @@ struct mesh_state* mesh_area_find(struct mesh_area* mesh,
 	 * desire aggregation).*/
 	key.unique = NULL;
 	
-	result = (struct mesh_state*)rbtree_search(&mesh->all, &key);
+	/* the states that differ only in the flags, or priming or
+	 * validation recursion, have the same hash value */
+	result = (struct mesh_state*)hashindex_search(mesh->all, &key,
+		query_info_hash(qinfo, qflags));
 	return result;
 }
 
@@ -1300,7 +1532,7 @@ mesh_log_list(struct mesh_area* mesh)
 	char buf[30];
 	struct mesh_state* m;
 	int num = 0;
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
+	HASHINDEX_FOR(m, struct mesh_state*, mesh->all) {
 		snprintf(buf, sizeof(buf), "%d%s%s%s%s%s%s mod%d %s%s", 
 			num++, (m->s.is_priming)?"p":"",  /* prime */
 			(m->s.is_valrec)?"v":"",  /* prime */
@@ -1321,7 +1553,7 @@ mesh_stats(struct mesh_area* mesh, const char* str)
 	verbose(VERB_DETAIL, "%s %u recursion states (%u with reply, "
 		"%u detached), %u waiting replies, %u recursion replies "
 		"sent, %d replies dropped, %d states jostled out", 
-		str, (unsigned)mesh->all.count, 
+		str, (unsigned)mesh->all->count, 
 		(unsigned)mesh->num_reply_states,
 		(unsigned)mesh->num_detached_states,
 		(unsigned)mesh->num_reply_addrs,
@@ -1350,11 +1582,17 @@ mesh_stats_clear(struct mesh_area* mesh)
 	mesh->replies_sum_wait.tv_usec = 0;
 	mesh->stats_jostled = 0;
 	mesh->stats_dropped = 0;
+	mesh->stats_adm_client = 0;
+	mesh->stats_adm_zone = 0;
+	mesh->stats_adm_evicted = 0;
+	mesh->stats_adm_prefetch = 0;
 	timehist_clear(mesh->histogram);
 	mesh->ans_secure = 0;
 	mesh->ans_bogus = 0;
 	memset(&mesh->ans_rcode[0], 0, sizeof(size_t)*16);
 	mesh->ans_nodata = 0;
+	mesh->num_hedge_sent = 0;
+	mesh->num_hedge_won = 0;
 }
 
 size_t 
@@ -1363,8 +1601,9 @@ mesh_get_mem(struct mesh_area* mesh)
 	struct mesh_state* m;
 	size_t s = sizeof(*mesh) + sizeof(struct timehist) +
 		sizeof(struct th_buck)*mesh->histogram->num +
-		sizeof(sldns_buffer) + sldns_buffer_capacity(mesh->qbuf_bak);
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
+		sizeof(sldns_buffer) + sldns_buffer_capacity(mesh->qbuf_bak) +
+		hashindex_get_mem(mesh->all);
+	HASHINDEX_FOR(m, struct mesh_state*, mesh->all) {
 		/* all, including m itself allocated in qstate region */
 		s += regional_get_mem(m->s.region);
 	}
@@ -47,6 +47,7 @@
 #define SERVICES_MESH_H
 
 #include "util/rbtree.h"
+#include "util/storage/hashindex.h"
 #include "util/netevent.h"
 #include "util/data/msgparse.h"
 #include "util/module.h"
@@ -73,6 +74,18 @@ struct timehist;
  */
 #define MESH_MAX_SUBSUB 1024
 
+/**
+ * Number of hash buckets for the admission control counters, a power
+ * of 2. Clients (or zones) that hash into the same bucket share a quota.
+ */
+#define MESH_ADM_BUCKETS 4096
+/** prefix length of the IPv4 client network for admission control */
+#define MESH_ADM_PREFIX4 24
+/** prefix length of the IPv6 client network for admission control */
+#define MESH_ADM_PREFIX6 56
+/** max number of jostle list states examined for a fair eviction */
+#define MESH_ADM_EVICT_SCAN 64
+
 /** 
  * Mesh of query states
  */
@@ -84,8 +97,9 @@ struct mesh_area {
 
 	/** set of runnable queries (mesh_state.run_node) */
 	rbtree_type run;
-	/** rbtree of all current queries (mesh_state.node)*/
-	rbtree_type all;
+	/** hash index of all current queries (mesh_state.node), not
+	 * ordered, the hash is query_info_hash of the qinfo and flags */
+	struct hashindex* all;
 
 	/** count of the total number of mesh_reply entries */
 	size_t num_reply_addrs;
@@ -109,6 +123,14 @@ struct mesh_area {
 	size_t stats_jostled;
 	/** stats, cumulative number of incoming client msgs dropped */
 	size_t stats_dropped;
+	/** stats, client msgs dropped because of the client quota */
+	size_t stats_adm_client;
+	/** stats, client msgs dropped because of the zone quota */
+	size_t stats_adm_zone;
+	/** stats, reply states evicted for a less busy client or prefetch */
+	size_t stats_adm_evicted;
+	/** stats, prefetches dropped because the list was full */
+	size_t stats_adm_prefetch;
 	/** number of replies sent */
 	size_t replies_sent;
 	/** sum of waiting times for the replies */
@@ -123,6 +145,14 @@ struct mesh_area {
 	size_t ans_rcode[16];
 	/** (extended stats) rcode nodata in replies */
 	size_t ans_nodata;
+	/** stats, number of hedged queries sent upstream */
+	size_t num_hedge_sent;
+	/** stats, number of hedged queries answered before the original */
+	size_t num_hedge_won;
+	/** upstream queries counted in the hedge budget window */
+	size_t hedge_window_queries;
+	/** hedged queries counted in the hedge budget window */
+	size_t hedge_window_hedges;
 
 	/** backup of query if other operations recurse and need the
 	 * network buffers */
@@ -141,6 +171,18 @@ struct mesh_area {
 	struct mesh_state* jostle_last;
 	/** timeout for jostling. if age is lower, it does not get jostled. */
 	struct timeval jostle_max;
+
+	/** admission control, max reply states per client network, or 0 */
+	size_t adm_client_quota;
+	/** admission control, max reply states per zone, or 0 */
+	size_t adm_zone_quota;
+	/** number of reply states that new client queries cannot use */
+	size_t adm_prefetch_reserve;
+	/** number of reply states per client network hash bucket, array of
+	 * MESH_ADM_BUCKETS, NULL if there are no admission quotas */
+	size_t* adm_client_count;
+	/** number of reply states per zone hash bucket, or NULL */
+	size_t* adm_zone_count;
 };
 
 /**
@@ -153,8 +195,8 @@ struct mesh_area {
  * region. All parts (rbtree nodes etc) are also allocated in the region.
  */
 struct mesh_state {
-	/** node in mesh_area all tree, key is this struct. Must be first. */
-	rbnode_type node;
+	/** node in mesh_area all index, key is this struct. Must be first. */
+	struct hashindex_node node;
 	/** node in mesh_area runnable tree, key is this struct */
 	rbnode_type run_node;
 	/** the query state. Note that the qinfo and query_flags 
@@ -182,9 +224,15 @@ struct mesh_state {
 		mesh_jostle_list } list_select;
 	/** pointer to this state for uniqueness or NULL */
 	struct mesh_state* unique;
+	/** admission counter bucket of the client that made the reply state */
+	uint16_t adm_client;
+	/** admission counter bucket of the zone of the query */
+	uint16_t adm_zone;
 
 	/** true if replies have been sent out (at end for alignment) */
 	uint8_t replies_sent;
+	/** true if the state is counted in the admission counters */
+	uint8_t adm_counted;
 };
 
 /**
@@ -327,6 +375,14 @@ void mesh_new_prefetch(struct mesh_area* mesh, struct query_info* qinfo,
 void mesh_report_reply(struct mesh_area* mesh, struct outbound_entry* e,
 	struct comm_reply* reply, int what);
 
+/**
+ * The hedge timer for an outstanding query expired.  The query state
+ * is run with the hedge event, and may send the query to another server.
+ * @param mesh: the query mesh.
+ * @param e: outbound entry, with query state to run.
+ */
+void mesh_report_hedge(struct mesh_area* mesh, struct outbound_entry* e);
+
 /* ------------------- Functions for module environment --------------- */
 
 /**
@@ -338,6 +394,16 @@ void mesh_report_reply(struct mesh_area* mesh, struct outbound_entry* e,
  */
 void mesh_detach_subs(struct module_qstate* qstate);
 
+/**
+ * Cancel-subqueries.
+ * Remove all sub-query references from this query state, and delete
+ * the sub-queries that no other query state or client is waiting for.
+ * Their outstanding network queries are stopped.
+ * Updates stat items in mesh_area structure.
+ * @param qstate: used to find mesh state.
+ */
+void mesh_cancel_subs(struct module_qstate* qstate);
+
 /**
  * Attach subquery.
  * Creates it if it does not exist already.
@@ -572,9 +638,14 @@ int mesh_state_ref_compare(const void* ap, const void* bp);
  *    udp query is sent - on error callback - callback sends SERVFAIL reply
  *    over the same network channel, and shared UDP buffer is overwritten.
  *    You can pass NULL if there is no buffer that must be backed up.
+ * @param prefetch: if true, the space is for a prefetch, that can use
+ *    the prefetch reserve of the list.
+ * @param client: admission counter bucket of the client of the new query,
+ *    used for the fair eviction, not used for prefetches.
  * @return false if no space is available.
  */
-int mesh_make_new_space(struct mesh_area* mesh, struct sldns_buffer* qbuf);
+int mesh_make_new_space(struct mesh_area* mesh, struct sldns_buffer* qbuf,
+	int prefetch, uint16_t client);
 
 /**
  * Insert mesh state into a double linked list.  Inserted at end.
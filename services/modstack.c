@@ -53,6 +53,9 @@
 #ifdef USE_CACHEDB
 #include "cachedb/cachedb.h"
 #endif
+#ifdef USE_DYNLIBMOD
+#include "dynlibmod/dynlibmod.h"
+#endif
 
 /** count number of modules (words) in the string */
 static int
@@ -126,6 +129,9 @@ module_list_avail(void)
 #endif
 #ifdef USE_CACHEDB
 		"cachedb",
+#endif
+#ifdef USE_DYNLIBMOD
+		"dynlib",
 #endif
 		"validator", 
 		"iterator", 
@@ -147,6 +153,9 @@ module_funcs_avail(void)
 #endif
 #ifdef USE_CACHEDB
 		&cachedb_get_funcblock,
+#endif
+#ifdef USE_DYNLIBMOD
+		&dynlibmod_get_funcblock,
 #endif
 		&val_get_funcblock, 
 		&iter_get_funcblock, 
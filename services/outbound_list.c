@@ -43,6 +43,7 @@
 #include <sys/time.h>
 #include "services/outbound_list.h"
 #include "services/outside_network.h"
+#include "util/netevent.h"
 
 void 
 outbound_list_init(struct outbound_list* list)
@@ -58,6 +59,7 @@ outbound_list_clear(struct outbound_list* list)
 	while(p) {
 		np = p->next;
 		outnet_serviced_query_stop(p->qsent, p);
+		comm_timer_delete(p->hedge_timer);
 		/* in region, no free needed */
 		p = np;
 	}
@@ -80,6 +82,8 @@ outbound_list_remove(struct outbound_list* list, struct outbound_entry* e)
 	if(!e)
 		return;
 	outnet_serviced_query_stop(e->qsent, e);
+	comm_timer_delete(e->hedge_timer);
+	e->hedge_timer = NULL;
 	if(e->next)
 		e->next->prev = e->prev;
 	if(e->prev)
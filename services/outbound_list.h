@@ -44,6 +44,7 @@
 struct outbound_entry;
 struct serviced_query;
 struct module_qstate;
+struct comm_timer;
 
 /**
  * The outbound list. This structure is part of the module specific query
@@ -67,6 +68,8 @@ struct outbound_entry {
 	struct serviced_query* qsent;
 	/** the module query state that sent it */
 	struct module_qstate* qstate;
+	/** hedge timer for the query, or NULL */
+	struct comm_timer* hedge_timer;
 };
 
 /**
@@ -77,7 +80,7 @@ void outbound_list_init(struct outbound_list* list);
 
 /**
  * Clear the user owner outbound list structure.
- * Deletes serviced queries.
+ * Deletes serviced queries and hedge timers.
  * @param list: the list structure. It is cleared, but the list struct itself
  * 	is callers responsability to delete.
  */
@@ -85,7 +88,7 @@ void outbound_list_clear(struct outbound_list* list);
 
 /**
  * Insert new entry into the list. Caller must allocate the entry with malloc.
- * qstate and qsent are set by caller.
+ * qstate, qsent and hedge_timer are set by caller.
  * @param list: the list to add to.
  * @param e: entry to add, it is only half initialised at call start, fully
  *	initialised at call end.
@@ -95,7 +98,7 @@ void outbound_list_insert(struct outbound_list* list,
 
 /**
  * Remove an entry from the list, and deletes it. 
- * Deletes serviced query in the entry.
+ * Deletes serviced query and hedge timer in the entry.
  * @param list: the list to remove from.
  * @param e: the entry to remove.
  */
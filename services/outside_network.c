@@ -52,6 +52,7 @@
 #include "util/data/msgreply.h"
 #include "util/data/msgencode.h"
 #include "util/data/dname.h"
+#include "util/storage/keyhash.h"
 #include "util/netevent.h"
 #include "util/log.h"
 #include "util/net_help.h"
@@ -84,6 +85,9 @@ static int randomize_and_send_udp(struct pending* pend, sldns_buffer* packet,
 /** remove waiting tcp from the outnet waiting list */
 static void waiting_list_remove(struct outside_network* outnet,
 	struct waiting_tcp* w);
+/** open sockets for the UDP pool of the interface, until it is full */
+static void udp_pool_fill(struct outside_network* outnet,
+	struct port_if* pif);
 
 int 
 pending_cmp(const void* key1, const void* key2)
@@ -127,6 +131,50 @@ serviced_cmp(const void* key1, const void* key2)
 	return sockaddr_cmp(&q1->addr, q1->addrlen, &q2->addr, q2->addrlen);
 }
 
+/** absorb the parts of the address that sockaddr_cmp looks at into the
+ * hash, the family, port and address, not the padding */
+static void
+outnet_hash_addr(struct keyhash_state* s, struct sockaddr_storage* addr,
+	socklen_t addrlen)
+{
+	if(addr_is_ip6(addr, addrlen)) {
+		struct sockaddr_in6* in6 = (struct sockaddr_in6*)addr;
+		keyhash_update(s, &in6->sin6_family, sizeof(in6->sin6_family));
+		keyhash_update(s, &in6->sin6_port, sizeof(in6->sin6_port));
+		keyhash_update(s, &in6->sin6_addr, INET6_SIZE);
+	} else {
+		struct sockaddr_in* in = (struct sockaddr_in*)addr;
+		keyhash_update(s, &in->sin_family, sizeof(in->sin_family));
+		keyhash_update(s, &in->sin_port, sizeof(in->sin_port));
+		keyhash_update(s, &in->sin_addr, INET_SIZE);
+	}
+}
+
+hashvalue_type
+pending_hash(struct pending* p)
+{
+	struct keyhash_state s;
+	uint16_t id = (uint16_t)p->id;
+	keyhash_init(&s);
+	keyhash_update(&s, &id, sizeof(id));
+	outnet_hash_addr(&s, &p->addr, p->addrlen);
+	return keyhash_final(&s);
+}
+
+hashvalue_type
+serviced_hash(struct serviced_query* sq)
+{
+	struct keyhash_state s;
+	uint8_t d = (uint8_t)sq->dnssec;
+	keyhash_init(&s);
+	keyhash_update(&s, sq->qbuf, 10);
+	keyhash_update(&s, sq->qbuf+sq->qbuflen-4, 4);
+	keyhash_update(&s, &d, sizeof(d));
+	dname_query_hash_update(&s, sq->qbuf+10);
+	outnet_hash_addr(&s, &sq->addr, sq->addrlen);
+	return keyhash_final(&s);
+}
+
 /** delete waiting_tcp entry. Does not unlink from waiting list. 
  * @param w: to delete.
  */
@@ -389,6 +437,45 @@ outnet_tcp_cb(struct comm_point* c, void* arg, int error,
 	return 0;
 }
 
+/** close the port of pc, and put pc in the unused list */
+static void
+portcomm_close(struct outside_network* outnet, struct port_comm* pc)
+{
+	struct port_if* pif = pc->pif;
+	int hand = pif->inuse - pif->draining;
+	verbose(VERB_ALGO, "close of port %d", pc->number);
+	comm_point_close(pc->cp);
+	log_assert(pif->inuse > 0);
+	pif->avail_ports[pif->avail_total - pif->inuse] = pc->number;
+	if(pc->index < hand) {
+		/* fill the hole with the last of the first part of the
+		 * array, and that with the last of the draining part */
+		hand--;
+		pif->out[pc->index] = pif->out[hand];
+		pif->out[pc->index]->index = pc->index;
+		if(pif->draining) {
+			pif->out[hand] = pif->out[pif->inuse-1];
+			pif->out[hand]->index = hand;
+		}
+	} else {
+		pif->draining--;
+		pif->out[pc->index] = pif->out[pif->inuse-1];
+		pif->out[pc->index]->index = pc->index;
+	}
+	pif->inuse--;
+	pc->next = outnet->unused_fds;
+	outnet->unused_fds = pc;
+}
+
+/** see if the UDP pool socket is due to be rotated to a new port, by
+ * time or by the number of queries sent from it */
+static int
+udp_pool_expired(struct outside_network* outnet, struct port_comm* pc)
+{
+	return (outnet->udp_pool_rotate && *outnet->now_secs >= pc->expire)
+		|| (outnet->udp_pool_uses && pc->uses >= outnet->udp_pool_uses);
+}
+
 /** lower use count on pc, see if it can be closed */
 static void
 portcomm_loweruse(struct outside_network* outnet, struct port_comm* pc)
@@ -398,17 +485,18 @@ portcomm_loweruse(struct outside_network* outnet, struct port_comm* pc)
 	if(pc->num_outstanding > 0) {
 		return;
 	}
-	/* close it and replace in unused list */
-	verbose(VERB_ALGO, "close of port %d", pc->number);
-	comm_point_close(pc->cp);
 	pif = pc->pif;
-	log_assert(pif->inuse > 0);
-	pif->avail_ports[pif->avail_total - pif->inuse] = pc->number;
-	pif->inuse--;
-	pif->out[pc->index] = pif->out[pif->inuse];
-	pif->out[pc->index]->index = pc->index;
-	pc->next = outnet->unused_fds;
-	outnet->unused_fds = pc;
+	if(pc->index < pif->inuse - pif->draining && pif->pool) {
+		/* the pool socket stays open, unless it is time for it
+		 * to move to a new port */
+		if(!udp_pool_expired(outnet, pc))
+			return;
+		outnet->num_udppool_rotated++;
+	}
+	/* close it and replace in unused list */
+	portcomm_close(outnet, pc);
+	if(pif->pool)
+		udp_pool_fill(outnet, pif);
 }
 
 /** try to send waiting UDP queries */
@@ -470,7 +558,8 @@ outnet_udp_cb(struct comm_point* c, void* arg, int error,
 
 	/* find it, see if this thing is a valid query response */
 	verbose(VERB_ALGO, "lookup size is %d entries", (int)outnet->pending->count);
-	p = (struct pending*)rbtree_search(outnet->pending, &key);
+	p = (struct pending*)hashindex_search(outnet->pending, &key,
+		pending_hash(&key));
 	if(!p) {
 		verbose(VERB_QUERY, "received unwanted or unsolicited udp reply dropped.");
 		log_buf(VERB_ALGO, "dropped message", c->buffer);
@@ -510,8 +599,8 @@ outnet_udp_cb(struct comm_point* c, void* arg, int error,
 	}
 	comm_timer_disable(p->timer);
 	verbose(VERB_ALGO, "outnet handle udp reply");
-	/* delete from tree first in case callback creates a retry */
-	(void)rbtree_delete(outnet->pending, p->node.key);
+	/* delete from index first in case callback creates a retry */
+	(void)hashindex_remove(outnet->pending, &p->node);
 	if(p->cb) {
 		fptr_ok(fptr_whitelist_pending_udp(p->cb));
 		(void)(*p->cb)(p->pc->cp, p->cb_arg, NETEVENT_NOERROR, reply_info);
@@ -633,6 +722,36 @@ static int setup_if(struct port_if* pif, const char* addrstr,
 	return 1;
 }
 
+/** setup the UDP pools of the interfaces, and open their sockets */
+static void
+setup_udp_pool(struct outside_network* outnet, int udp_pool,
+	int udp_pool_rotate, int udp_pool_uses, size_t num_ports)
+{
+	int i, num_if = outnet->num_ip4 + outnet->num_ip6;
+	/* leave half of the commpoints for the replacements of the
+	 * rotated sockets that are draining */
+	int max = (num_if == 0)?0:(int)(num_ports/2/(size_t)num_if);
+	if(udp_pool > max) {
+		verbose(VERB_OPS, "outgoing-udp-pool %d is more than half "
+			"of the outgoing-range per interface, using %d",
+			udp_pool, max);
+		udp_pool = max;
+	}
+	if(udp_pool == 0)
+		return;
+	outnet->udp_pool = udp_pool;
+	outnet->udp_pool_rotate = udp_pool_rotate;
+	outnet->udp_pool_uses = udp_pool_uses;
+	for(i=0; i<outnet->num_ip4; i++) {
+		outnet->ip4_ifs[i].pool = udp_pool;
+		udp_pool_fill(outnet, &outnet->ip4_ifs[i]);
+	}
+	for(i=0; i<outnet->num_ip6; i++) {
+		outnet->ip6_ifs[i].pool = udp_pool;
+		udp_pool_fill(outnet, &outnet->ip6_ifs[i]);
+	}
+}
+
 struct outside_network* 
 outside_network_create(struct comm_base *base, size_t bufsize, 
 	size_t num_ports, char** ifs, int num_ifs, int do_ip4, 
@@ -640,7 +759,8 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 	struct ub_randstate* rnd, int use_caps_for_id, int* availports, 
 	int numavailports, size_t unwanted_threshold, int tcp_mss,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
-	void* sslctx, int delayclose, struct dt_env* dtenv)
+	void* sslctx, int delayclose, int udp_pool, int udp_pool_rotate,
+	int udp_pool_uses, struct dt_env* dtenv)
 {
 	struct outside_network* outnet = (struct outside_network*)
 		calloc(1, sizeof(struct outside_network));
@@ -703,8 +823,8 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 		}
 	}
 	if(	!(outnet->udp_buff = sldns_buffer_new(bufsize)) ||
-		!(outnet->pending = rbtree_create(pending_cmp)) ||
-		!(outnet->serviced = rbtree_create(serviced_cmp)) ||
+		!(outnet->pending = hashindex_create(pending_cmp)) ||
+		!(outnet->serviced = hashindex_create(serviced_cmp)) ||
 		!create_pending_tcp(outnet, bufsize)) {
 		log_err("malloc failed");
 		outside_network_delete(outnet);
@@ -770,12 +890,15 @@ outside_network_create(struct comm_base *base, size_t bufsize,
 			}
 		}
 	}
+	if(udp_pool > 0 && do_udp)
+		setup_udp_pool(outnet, udp_pool, udp_pool_rotate,
+			udp_pool_uses, num_ports);
 	return outnet;
 }
 
 /** helper pending delete */
 static void
-pending_node_del(rbnode_type* node, void* arg)
+pending_node_del(struct hashindex_node* node, void* arg)
 {
 	struct pending* pend = (struct pending*)node;
 	struct outside_network* outnet = (struct outside_network*)arg;
@@ -784,7 +907,7 @@ pending_node_del(rbnode_type* node, void* arg)
 
 /** helper serviced delete */
 static void
-serviced_node_del(rbnode_type* node, void* ATTR_UNUSED(arg))
+serviced_node_del(struct hashindex_node* node, void* ATTR_UNUSED(arg))
 {
 	struct serviced_query* sq = (struct serviced_query*)node;
 	struct service_callback* p = sq->cblist, *np;
@@ -816,13 +939,13 @@ outside_network_delete(struct outside_network* outnet)
 	outnet->want_to_quit = 1;
 	/* check every element, since we can be called on malloc error */
 	if(outnet->pending) {
-		/* free pending elements, but do no unlink from tree. */
-		traverse_postorder(outnet->pending, pending_node_del, NULL);
-		free(outnet->pending);
+		/* free pending elements, but do no unlink from index. */
+		hashindex_traverse(outnet->pending, pending_node_del, NULL);
+		hashindex_delete(outnet->pending);
 	}
 	if(outnet->serviced) {
-		traverse_postorder(outnet->serviced, serviced_node_del, NULL);
-		free(outnet->serviced);
+		hashindex_traverse(outnet->serviced, serviced_node_del, NULL);
+		hashindex_delete(outnet->serviced);
 	}
 	if(outnet->udp_buff)
 		sldns_buffer_free(outnet->udp_buff);
@@ -916,7 +1039,7 @@ pending_delete(struct outside_network* outnet, struct pending* p)
 		}
 	}
 	if(outnet) {
-		(void)rbtree_delete(outnet->pending, p->node.key);
+		(void)hashindex_remove(outnet->pending, &p->node);
 	}
 	if(p->timer)
 		comm_timer_delete(p->timer);
@@ -977,6 +1100,133 @@ udp_sockport(struct sockaddr_storage* addr, socklen_t addrlen, int pfxlen,
 	return fd;
 }
 
+/**
+ * Open a socket on a random port for the UDP pool of the interface.
+ * It is put at the end of the pool part of the out array.
+ * @param outnet: the outside network, with the unused commpoints.
+ * @param pif: the interface.
+ * @return the commpoint, or NULL if there is no unused commpoint or
+ * 	no port could be opened.
+ */
+static struct port_comm*
+udp_pool_open(struct outside_network* outnet, struct port_if* pif)
+{
+	int my_port, fd, portno, inuse, hand, tries = 0;
+	struct port_comm* pc;
+	if(!outnet->unused_fds || pif->inuse >= pif->maxout ||
+		pif->inuse >= pif->avail_total)
+		return NULL;
+	while(1) {
+		my_port = ub_random_max(outnet->rnd,
+			pif->avail_total - pif->inuse);
+		portno = pif->avail_ports[my_port];
+		fd = udp_sockport(&pif->addr, pif->addrlen, pif->pfxlen,
+			portno, &inuse, outnet->rnd);
+		if(fd != -1)
+			break;
+		if(!inuse) {
+			/* nonrecoverable error making socket */
+			return NULL;
+		}
+		verbose(VERB_QUERY, "port %d in use, trying another", portno);
+		tries++;
+		if(tries == MAX_PORT_RETRY) {
+			log_err("failed to find an open port for the udp pool");
+			return NULL;
+		}
+	}
+	verbose(VERB_ALGO, "opened UDP pool port=%d", portno);
+	pc = outnet->unused_fds;
+	outnet->unused_fds = pc->next;
+	pc->next = NULL;
+	pc->number = portno;
+	pc->pif = pif;
+	pc->num_outstanding = 0;
+	pc->uses = 0;
+	/* spread the rotations, at between half and the whole interval */
+	pc->expire = *outnet->now_secs + outnet->udp_pool_rotate -
+		ub_random_max(outnet->rnd, outnet->udp_pool_rotate/2+1);
+	comm_point_start_listening(pc->cp, fd, -1);
+
+	/* grab port in interface, after the pool part of the array */
+	pif->avail_ports[my_port] =
+		pif->avail_ports[pif->avail_total-pif->inuse-1];
+	hand = pif->inuse - pif->draining;
+	if(pif->draining) {
+		pif->out[pif->inuse] = pif->out[hand];
+		pif->out[pif->inuse]->index = pif->inuse;
+	}
+	pif->out[hand] = pc;
+	pc->index = hand;
+	pif->inuse++;
+	outnet->num_udppool_opened++;
+	return pc;
+}
+
+static void
+udp_pool_fill(struct outside_network* outnet, struct port_if* pif)
+{
+	while(pif->inuse - pif->draining < pif->pool) {
+		if(!udp_pool_open(outnet, pif))
+			return;
+	}
+}
+
+/** rotate the socket out of the UDP pool, it is closed now, or it is
+ * draining until its outstanding queries are done */
+static void
+udp_pool_retire(struct outside_network* outnet, struct port_comm* pc)
+{
+	struct port_if* pif = pc->pif;
+	int last = pif->inuse - pif->draining - 1;
+	outnet->num_udppool_rotated++;
+	if(pc->num_outstanding == 0) {
+		portcomm_close(outnet, pc);
+		return;
+	}
+	verbose(VERB_ALGO, "UDP pool port %d is draining", pc->number);
+	pif->out[pc->index] = pif->out[last];
+	pif->out[pc->index]->index = pc->index;
+	pif->out[last] = pc;
+	pc->index = last;
+	pif->draining++;
+}
+
+/** select a random socket from the UDP pool of the interface */
+static int
+udp_pool_select(struct outside_network* outnet, struct pending* pend,
+	struct port_if* pif)
+{
+	struct port_comm* pc, *repl;
+	int hand;
+	udp_pool_fill(outnet, pif);
+	hand = pif->inuse - pif->draining;
+	if(hand == 0) {
+		log_err("no UDP pool sockets, drop msg");
+		return 0;
+	}
+	pc = pif->out[ub_random_max(outnet->rnd, hand)];
+	if(udp_pool_expired(outnet, pc)) {
+		/* move to a new port. If no replacement can be opened now,
+		 * the old socket is used until one can be. */
+		if((repl = udp_pool_open(outnet, pif)) != NULL) {
+			udp_pool_retire(outnet, pc);
+			pc = repl;
+		}
+	}
+	verbose(VERB_ALGO, "using UDP pool port=%d", pc->number);
+	pend->pc = pc;
+	pc->num_outstanding++;
+	pc->uses++;
+	/* after a number of queries the socket moves to a new port, so
+	 * that the source ports are not only a few that can be learned.
+	 * It drains while this query is outstanding. If no replacement
+	 * can be opened now, it is tried again when the socket is used. */
+	if(udp_pool_expired(outnet, pc) && udp_pool_open(outnet, pif) != NULL)
+		udp_pool_retire(outnet, pc);
+	return 1;
+}
+
 /** Select random ID */
 static int
 select_id(struct outside_network* outnet, struct pending* pend,
@@ -986,12 +1236,14 @@ select_id(struct outside_network* outnet, struct pending* pend,
 	pend->id = ((unsigned)ub_random(outnet->rnd)>>8) & 0xffff;
 	LDNS_ID_SET(sldns_buffer_begin(packet), pend->id);
 
-	/* insert in tree */
+	/* insert in index */
 	pend->node.key = pend;
-	while(!rbtree_insert(outnet->pending, &pend->node)) {
+	pend->node.hash = pending_hash(pend);
+	while(!hashindex_insert(outnet->pending, &pend->node)) {
 		/* change ID to avoid collision */
 		pend->id = ((unsigned)ub_random(outnet->rnd)>>8) & 0xffff;
 		LDNS_ID_SET(sldns_buffer_begin(packet), pend->id);
+		pend->node.hash = pending_hash(pend);
 		id_tries++;
 		if(id_tries == MAX_ID_RETRY) {
 			pend->id=99999; /* non existant ID */
@@ -1016,6 +1268,12 @@ select_ifport(struct outside_network* outnet, struct pending* pend,
 			"outgoing interfaces of that family");
 		return 0;
 	}
+	if(outnet->udp_pool) {
+		if(!udp_pool_select(outnet, pend,
+			&ifs[ub_random_max(outnet->rnd, num_if)]))
+			return 0;
+		return 1;
+	}
 	log_assert(outnet->unused_fds);
 	tries = 0;
 	while(1) {
@@ -1135,14 +1393,14 @@ pending_udp_query(struct serviced_query* sq, struct sldns_buffer* packet,
 	pend->cb = cb;
 	pend->cb_arg = cb_arg;
 	pend->node.key = pend;
-	pend->timer = comm_timer_create(sq->outnet->base, pending_udp_timer_cb,
-		pend);
+	pend->timer = comm_timer_create_coarse(sq->outnet->base,
+		pending_udp_timer_cb, pend);
 	if(!pend->timer) {
 		free(pend);
 		return NULL;
 	}
 
-	if(sq->outnet->unused_fds == NULL) {
+	if(sq->outnet->unused_fds == NULL && !sq->outnet->udp_pool) {
 		/* no unused fd, cannot create a new port (randomly) */
 		verbose(VERB_ALGO, "no fds available, udp query waiting");
 		pend->timeout = timeout;
@@ -1209,7 +1467,8 @@ pending_tcp_query(struct serviced_query* sq, sldns_buffer* packet,
 	if(!w) {
 		return NULL;
 	}
-	if(!(w->timer = comm_timer_create(sq->outnet->base, outnet_tcptimer, w))) {
+	if(!(w->timer = comm_timer_create_coarse(sq->outnet->base,
+		outnet_tcptimer, w))) {
 		free(w);
 		return NULL;
 	}
@@ -1274,7 +1533,7 @@ serviced_gen_query(sldns_buffer* buff, uint8_t* qname, size_t qnamelen,
 	sldns_buffer_flip(buff);
 }
 
-/** lookup serviced query in serviced query rbtree */
+/** lookup serviced query in serviced query hash index */
 static struct serviced_query*
 lookup_serviced(struct outside_network* outnet, sldns_buffer* buff, int dnssec,
 	struct sockaddr_storage* addr, socklen_t addrlen,
@@ -1289,7 +1548,8 @@ lookup_serviced(struct outside_network* outnet, sldns_buffer* buff, int dnssec,
 	key.addrlen = addrlen;
 	key.outnet = outnet;
 	key.opt_list = opt_list;
-	return (struct serviced_query*)rbtree_search(outnet->serviced, &key);
+	return (struct serviced_query*)hashindex_search(outnet->serviced, &key,
+		serviced_hash(&key));
 }
 
 /** Create new serviced entry */
@@ -1301,7 +1561,7 @@ serviced_create(struct outside_network* outnet, sldns_buffer* buff, int dnssec,
 {
 	struct serviced_query* sq = (struct serviced_query*)malloc(sizeof(*sq));
 #ifdef UNBOUND_DEBUG
-	rbnode_type* ins;
+	struct hashindex_node* ins;
 #endif
 	if(!sq) 
 		return NULL;
@@ -1343,12 +1603,13 @@ serviced_create(struct outside_network* outnet, sldns_buffer* buff, int dnssec,
 	sq->status = serviced_initial;
 	sq->retry = 0;
 	sq->to_be_deleted = 0;
+	sq->node.hash = serviced_hash(sq);
 #ifdef UNBOUND_DEBUG
 	ins = 
 #else
 	(void)
 #endif
-	rbtree_insert(outnet->serviced, &sq->node);
+	hashindex_insert(outnet->serviced, &sq->node);
 	log_assert(ins != NULL); /* must not be already present */
 	return sq;
 }
@@ -1403,7 +1664,7 @@ serviced_delete(struct serviced_query* sq)
 			}
 		}
 	}
-	/* does not delete from tree, caller has to do that */
+	/* does not delete from index, caller has to do that */
 	serviced_node_del(&sq->node, NULL);
 }
 
@@ -1502,8 +1763,8 @@ serviced_udp_send(struct serviced_query* sq, sldns_buffer* buff)
 	uint8_t edns_lame_known;
 	time_t now = *sq->outnet->now_secs;
 
-	if(!infra_host(sq->outnet->infra, &sq->addr, sq->addrlen, sq->zone,
-		sq->zonelen, now, &vs, &edns_lame_known, &rtt))
+	if(!infra_host(sq->outnet->infra, &sq->addr, sq->addrlen, now,
+		&vs, &edns_lame_known, &rtt))
 		return 0;
 	sq->last_rtt = rtt;
 	verbose(VERB_ALGO, "EDNS lookup known=%d vs=%d", edns_lame_known, vs);
@@ -1587,14 +1848,14 @@ serviced_callbacks(struct serviced_query* sq, int error, struct comm_point* c,
 	uint8_t *backup_p = NULL;
 	size_t backlen = 0;
 #ifdef UNBOUND_DEBUG
-	rbnode_type* rem =
+	struct hashindex_node* rem =
 #else
 	(void)
 #endif
-	/* remove from tree, and schedule for deletion, so that callbacks
+	/* remove from index, and schedule for deletion, so that callbacks
 	 * can safely deregister themselves and even create new serviced
 	 * queries that are identical to this one. */
-	rbtree_delete(sq->outnet->serviced, sq);
+	hashindex_remove(sq->outnet->serviced, &sq->node);
 	log_assert(rem); /* should have been present */
 	sq->to_be_deleted = 1; 
 	verbose(VERB_ALGO, "svcd callbacks start");
@@ -1680,7 +1941,7 @@ serviced_tcp_callback(struct comm_point* c, void* arg, int error,
 			&sq->addr, sq->addrlen);
 	if(error==NETEVENT_NOERROR)
 		infra_update_tcp_works(sq->outnet->infra, &sq->addr,
-			sq->addrlen, sq->zone, sq->zonelen);
+			sq->addrlen);
 #ifdef USE_DNSTAP
 	if(error==NETEVENT_NOERROR && sq->outnet->dtenv &&
 	   (sq->outnet->dtenv->log_resolver_response_messages ||
@@ -1709,8 +1970,7 @@ serviced_tcp_callback(struct comm_point* c, void* arg, int error,
 		/* only store noEDNS in cache if domain is noDNSSEC */
 		if(!sq->want_dnssec)
 		  if(!infra_edns_update(sq->outnet->infra, &sq->addr, 
-			sq->addrlen, sq->zone, sq->zonelen, -1,
-			*sq->outnet->now_secs))
+			sq->addrlen, -1, *sq->outnet->now_secs))
 			log_err("Out of memory caching no edns for host");
 		sq->status = serviced_query_TCP;
 	}
@@ -1728,8 +1988,8 @@ serviced_tcp_callback(struct comm_point* c, void* arg, int error,
 		 * huge due to system-hibernated and we woke up */
 		if(roundtime < TCP_AUTH_QUERY_TIMEOUT*1000) {
 		    if(!infra_rtt_update(sq->outnet->infra, &sq->addr,
-			sq->addrlen, sq->zone, sq->zonelen, sq->qtype,
-			roundtime, sq->last_rtt, (time_t)now.tv_sec))
+			sq->addrlen, sq->qtype, roundtime, sq->last_rtt,
+			(time_t)now.tv_sec))
 			log_err("out of memory noting rtt.");
 		}
 	    }
@@ -1769,9 +2029,8 @@ serviced_tcp_send(struct serviced_query* sq, sldns_buffer* buff)
 {
 	int vs, rtt;
 	uint8_t edns_lame_known;
-	if(!infra_host(sq->outnet->infra, &sq->addr, sq->addrlen, sq->zone,
-		sq->zonelen, *sq->outnet->now_secs, &vs, &edns_lame_known,
-		&rtt))
+	if(!infra_host(sq->outnet->infra, &sq->addr, sq->addrlen,
+		*sq->outnet->now_secs, &vs, &edns_lame_known, &rtt))
 		return 0;
 	if(vs != -1)
 		sq->status = serviced_query_TCP_EDNS;
@@ -1855,8 +2114,7 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 		}
 		sq->retry++;
 		if(!(rto=infra_rtt_update(outnet->infra, &sq->addr, sq->addrlen,
-			sq->zone, sq->zonelen, sq->qtype, -1, sq->last_rtt,
-			(time_t)now.tv_sec)))
+			sq->qtype, -1, sq->last_rtt, (time_t)now.tv_sec)))
 			log_err("out of memory in UDP exponential backoff");
 		if(sq->retry < OUTBOUND_UDP_RETRY) {
 			log_name_addr(VERB_ALGO, "retry query", sq->qbuf+10,
@@ -1910,7 +2168,7 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 		/* only store noEDNS in cache if domain is noDNSSEC */
 		if(!sq->want_dnssec)
 		  if(!infra_edns_update(outnet->infra, &sq->addr, sq->addrlen,
-			sq->zone, sq->zonelen, -1, (time_t)now.tv_sec)) {
+			-1, (time_t)now.tv_sec)) {
 			log_err("Out of memory caching no edns for host");
 		  }
 		sq->status = serviced_query_UDP;
@@ -1920,7 +2178,7 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 		log_addr(VERB_ALGO, "serviced query: EDNS works for",
 			&sq->addr, sq->addrlen);
 		if(!infra_edns_update(outnet->infra, &sq->addr, sq->addrlen, 
-			sq->zone, sq->zonelen, 0, (time_t)now.tv_sec)) {
+			0, (time_t)now.tv_sec)) {
 			log_err("Out of memory caching edns works");
 		}
 		sq->edns_lame_known = 1;
@@ -1937,7 +2195,7 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 		  log_addr(VERB_ALGO, "serviced query: EDNS fails for",
 			&sq->addr, sq->addrlen);
 		  if(!infra_edns_update(outnet->infra, &sq->addr, sq->addrlen,
-			sq->zone, sq->zonelen, -1, (time_t)now.tv_sec)) {
+			-1, (time_t)now.tv_sec)) {
 			log_err("Out of memory caching no edns for host");
 		  }
 		} else {
@@ -1959,8 +2217,7 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 		 * above this value gives trouble with server selection */
 		if(roundtime < 60000) {
 		    if(!infra_rtt_update(outnet->infra, &sq->addr, sq->addrlen, 
-			sq->zone, sq->zonelen, sq->qtype, roundtime,
-			sq->last_rtt, (time_t)now.tv_sec))
+			sq->qtype, roundtime, sq->last_rtt, (time_t)now.tv_sec))
 			log_err("out of memory noting rtt.");
 		}
 	    }
@@ -2019,7 +2276,7 @@ outnet_serviced_query(struct outside_network* outnet,
 		/* perform first network action */
 		if(outnet->do_udp && !(tcp_upstream || ssl_upstream)) {
 			if(!serviced_udp_send(sq, buff)) {
-				(void)rbtree_delete(outnet->serviced, sq);
+				(void)hashindex_remove(outnet->serviced, &sq->node);
 				free(sq->qbuf);
 				free(sq->zone);
 				free(sq);
@@ -2028,7 +2285,7 @@ outnet_serviced_query(struct outside_network* outnet,
 			}
 		} else {
 			if(!serviced_tcp_send(sq, buff)) {
-				(void)rbtree_delete(outnet->serviced, sq);
+				(void)hashindex_remove(outnet->serviced, &sq->node);
 				free(sq->qbuf);
 				free(sq->zone);
 				free(sq);
@@ -2068,7 +2325,7 @@ void outnet_serviced_query_stop(struct serviced_query* sq, void* cb_arg)
 	callback_list_remove(sq, cb_arg);
 	/* if callbacks() routine scheduled deletion, let it do that */
 	if(!sq->cblist && !sq->to_be_deleted) {
-		(void)rbtree_delete(sq->outnet->serviced, sq);
+		(void)hashindex_remove(sq->outnet->serviced, &sq->node);
 		serviced_delete(sq); 
 	}
 }
@@ -2140,12 +2397,12 @@ size_t outnet_get_mem(struct outside_network* outnet)
 	}
 	for(w=outnet->tcp_wait_first; w; w = w->next_waiting)
 		s += waiting_tcp_get_mem(w);
-	s += sizeof(*outnet->pending);
+	s += hashindex_get_mem(outnet->pending);
 	s += (sizeof(struct pending) + comm_timer_get_mem(NULL)) * 
 		outnet->pending->count;
-	s += sizeof(*outnet->serviced);
+	s += hashindex_get_mem(outnet->serviced);
 	s += outnet->svcd_overhead;
-	RBTREE_FOR(sq, struct serviced_query*, outnet->serviced) {
+	HASHINDEX_FOR(sq, struct serviced_query*, outnet->serviced) {
 		s += sizeof(*sq) + sq->qbuflen;
 		for(sb = sq->cblist; sb; sb = sb->next)
 			s += sizeof(*sb);
@@ -44,6 +44,7 @@
 #define OUTSIDE_NETWORK_H
 
 #include "util/rbtree.h"
+#include "util/storage/hashindex.h"
 #include "util/netevent.h"
 #include "dnstap/dnstap_config.h"
 struct pending;
@@ -106,6 +107,20 @@ struct outside_network {
 	int delayclose;
 	/** timeout for delayclose */
 	struct timeval delay_tv;
+	/** number of sockets in the UDP pool of an interface, if 0, a
+	 * socket is opened for a query and closed when it is done */
+	int udp_pool;
+	/** seconds after which a UDP pool socket is rotated to a new
+	 * port, if 0, they are not rotated */
+	int udp_pool_rotate;
+	/** number of queries after which a UDP pool socket is rotated to
+	 * a new port, if 0, they are not rotated for it */
+	int udp_pool_uses;
+	/** number of UDP pool sockets opened (for statistics) */
+	size_t num_udppool_opened;
+	/** number of UDP pool sockets rotated to a new port (for
+	 * statistics) */
+	size_t num_udppool_rotated;
 
 	/** array of outgoing IP4 interfaces */
 	struct port_if* ip4_ifs;
@@ -122,10 +137,10 @@ struct outside_network {
 	/** last pending udp query in list */
 	struct pending* udp_wait_last;
 
-	/** pending udp answers. sorted by id, addr */
-	rbtree_type* pending;
-	/** serviced queries, sorted by qbuf, addr, dnssec */
-	rbtree_type* serviced;
+	/** pending udp answers. hashed on id, addr */
+	struct hashindex* pending;
+	/** serviced queries, hashed on qbuf, addr, dnssec */
+	struct hashindex* serviced;
 	/** host cache, pointer but not owned by outnet. */
 	struct infra_cache* infra;
 	/** where to get random numbers */
@@ -185,6 +200,14 @@ struct port_if {
 	int maxout;
 	/** number of commpoints (and thus also ports) in use */
 	int inuse;
+	/** number of sockets in the UDP pool, 0 if no pool. The pool
+	 * sockets are at the start of the out array, queries are sent
+	 * from a random one of them. */
+	int pool;
+	/** number of commpoints at the end of the out array that are
+	 * rotated out of the pool, they get no new queries and are closed
+	 * when their outstanding queries are done. */
+	int draining;
 };
 
 /**
@@ -201,6 +224,10 @@ struct port_comm {
 	int index;
 	/** number of outstanding queries on this port */
 	int num_outstanding;
+	/** for a UDP pool socket, the time when it is rotated */
+	time_t expire;
+	/** for a UDP pool socket, the number of queries sent from it */
+	int uses;
 	/** UDP commpoint, fd=-1 if not in use */
 	struct comm_point* cp;
 };
@@ -209,11 +236,11 @@ struct port_comm {
  * A query that has an answer pending for it.
  */
 struct pending {
-	/** redblacktree entry, key is the pending struct(id, addr). */
-	rbnode_type node;
+	/** hash index entry, key is the pending struct(id, addr). */
+	struct hashindex_node node;
 	/** the ID for the query. int so that a value out of range can
 	 * be used to signify a pending that is for certain not present in
-	 * the rbtree. (and for which deletion is safe). */
+	 * the hash index. (and for which deletion is safe). */
 	unsigned int id;
 	/** remote address. */
 	struct sockaddr_storage addr;
@@ -316,8 +343,8 @@ struct service_callback {
  * receive a callback.
  */
 struct serviced_query {
-	/** The rbtree node, key is this record */
-	rbnode_type node;
+	/** The hash index node, key is this record */
+	struct hashindex_node node;
 	/** The query that needs to be answered. Starts with flags u16,
 	 * then qdcount, ..., including qname, qtype, qclass. Does not include
 	 * EDNS record. */
@@ -409,6 +436,12 @@ struct serviced_query {
  * @param sslctx: context to create outgoing connections with (if enabled).
  * @param delayclose: if not 0, udp sockets are delayed before timeout closure.
  * 	msec to wait on timeouted udp sockets.
+ * @param udp_pool: if not 0, number of UDP sockets per outgoing interface
+ * 	that are kept open, queries are sent from them.
+ * @param udp_pool_rotate: seconds after which a UDP pool socket is
+ * 	replaced by one on a new random port, 0 for never.
+ * @param udp_pool_uses: number of queries after which a UDP pool socket
+ * 	is replaced by one on a new random port, 0 for never.
  * @param dtenv: environment to send dnstap events with (if enabled).
  * @return: the new structure (with no pending answers) or NULL on error.
  */
@@ -418,7 +451,8 @@ struct outside_network* outside_network_create(struct comm_base* base,
 	struct ub_randstate* rnd, int use_caps_for_id, int* availports, 
 	int numavailports, size_t unwanted_threshold, int tcp_mss,
 	void (*unwanted_action)(void*), void* unwanted_param, int do_udp,
-	void* sslctx, int delayclose, struct dt_env *dtenv);
+	void* sslctx, int delayclose, int udp_pool, int udp_pool_rotate,
+	int udp_pool_uses, struct dt_env *dtenv);
 
 /**
  * Delete outside_network structure.
@@ -465,7 +499,8 @@ struct waiting_tcp* pending_tcp_query(struct serviced_query* sq,
 /**
  * Delete pending answer.
  * @param outnet: outside network the pending query is part of.
- *    Internal feature: if outnet is NULL, p is not unlinked from rbtree.
+ *    Internal feature: if outnet is NULL, p is not unlinked from the
+ *    hash index.
  * @param p: deleted
  */
 void pending_delete(struct outside_network* outnet, struct pending* p);
@@ -473,7 +508,7 @@ void pending_delete(struct outside_network* outnet, struct pending* p);
 /**
  * Perform a serviced query to the authoritative servers.
  * Duplicate efforts are detected, and EDNS, TCP and UDP retry is performed.
- * @param outnet: outside network, with rbtree of serviced queries.
+ * @param outnet: outside network, with the serviced queries.
  * @param qinfo: query info.
  * @param flags: flags u16 (host format), includes opcode, CD bit.
  * @param dnssec: if set, DO bit is set in EDNS queries.
@@ -558,10 +593,18 @@ int serviced_udp_callback(struct comm_point* c, void* arg, int error,
 int serviced_tcp_callback(struct comm_point* c, void* arg, int error,
         struct comm_reply* rep);
 
-/** compare function of pending rbtree */
+/** compare function of pending hash index */
 int pending_cmp(const void* key1, const void* key2);
 
-/** compare function of serviced query rbtree */
+/** compare function of serviced query hash index */
 int serviced_cmp(const void* key1, const void* key2);
 
+/** hash value of a pending query, of the id and address, equal for the
+ * keys that pending_cmp finds equal */
+hashvalue_type pending_hash(struct pending* p);
+
+/** hash value of a serviced query, of the qbuf, dnssec and address, the
+ * qname without case, equal for the keys that serviced_cmp finds equal */
+hashvalue_type serviced_hash(struct serviced_query* sq);
+
 #endif /* OUTSIDE_NETWORK_H */
@@ -69,6 +69,9 @@
 #ifdef WITH_PYTHONMODULE
 #include "pythonmod/pythonmod.h"
 #endif
+#ifdef USE_DYNLIBMOD
+#include "dynlibmod/dynlibmod.h"
+#endif
 
 /** Give checkconf usage, and exit (1). */
 static void
@@ -333,7 +336,7 @@ morechecks(struct config_file* cfg, const char* fname)
 
 	if(cfg->verbosity < 0)
 		fatal_exit("verbosity value < 0");
-	if(cfg->num_threads <= 0 || cfg->num_threads > 10000)
+	if(cfg->num_threads <= 0 || cfg->num_threads > CFG_MAX_THREADS)
 		fatal_exit("num_threads value weird");
 	if(!cfg->do_ip4 && !cfg->do_ip6)
 		fatal_exit("ip4 and ip6 are both disabled, pointless");
@@ -391,6 +394,15 @@ morechecks(struct config_file* cfg, const char* fname)
 				fatal_exit("logfile directory does not exist");
 			free(ad);
 		}
+		if(cfg->log_binary_file && cfg->log_binary_file[0]) {
+			char* ad = fname_after_chroot(cfg->log_binary_file,
+				cfg, 1);
+			char* bd = basedir(ad);
+			if(bd && !is_dir(bd))
+				fatal_exit("log-binary-file directory does not "
+					"exist");
+			free(ad);
+		}
 	}
 
 	check_chroot_filelist("file with root-hints", 
@@ -435,6 +447,16 @@ morechecks(struct config_file* cfg, const char* fname)
 		&& strcmp(cfg->module_conf, "cachedb python iterator") != 0
 		&& strcmp(cfg->module_conf, "validator cachedb python iterator") != 0
 		&& strcmp(cfg->module_conf, "validator python cachedb iterator") != 0
+#endif
+#ifdef USE_DYNLIBMOD
+		&& strcmp(cfg->module_conf, "dynlib iterator") != 0
+		&& strcmp(cfg->module_conf, "dynlib validator iterator") != 0
+		&& strcmp(cfg->module_conf, "validator dynlib iterator") != 0
+		&& strcmp(cfg->module_conf, "dns64 dynlib iterator") != 0
+		&& strcmp(cfg->module_conf, "dns64 dynlib validator iterator") != 0
+		&& strcmp(cfg->module_conf, "dns64 validator dynlib iterator") != 0
+		&& strcmp(cfg->module_conf, "dynlib dns64 iterator") != 0
+		&& strcmp(cfg->module_conf, "dynlib dns64 validator iterator") != 0
 #endif
 		) {
 		fatal_exit("module conf '%s' is not known to work",
@@ -519,6 +541,10 @@ checkconf(const char* cfgfile, const char* opt, int final)
 #ifdef WITH_PYTHONMODULE
 	if(strstr(cfg->module_conf, "python"))
 		check_mod(cfg, pythonmod_get_funcblock());
+#endif
+#ifdef USE_DYNLIBMOD
+	if(strstr(cfg->module_conf, "dynlib"))
+		check_mod(cfg, dynlibmod_get_funcblock());
 #endif
 	check_fwd(cfg);
 	check_hints(cfg);
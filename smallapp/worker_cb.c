@@ -94,6 +94,22 @@ int remote_control_callback(struct comm_point* ATTR_UNUSED(c),
 	return 0;
 }
 
+int metrics_accept_callback(struct comm_point* ATTR_UNUSED(c), 
+	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
+        struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	log_assert(0);
+	return 0;
+}
+
+int metrics_conn_callback(struct comm_point* ATTR_UNUSED(c), 
+	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
+        struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	log_assert(0);
+	return 0;
+}
+
 void worker_sighandler(int ATTR_UNUSED(sig), void* ATTR_UNUSED(arg))
 {
 	log_assert(0);
@@ -125,6 +141,18 @@ wsvc_cron_cb(void* ATTR_UNUSED(arg))
 }
 #endif /* UB_ON_WINDOWS */
 
+int worker_hedge_query(struct outbound_entry* ATTR_UNUSED(e),
+	int ATTR_UNUSED(ms))
+{
+	log_assert(0);
+	return 0;
+}
+
+void worker_hedge_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 void 
 worker_alloc_cleanup(void* ATTR_UNUSED(arg))
 {
@@ -143,6 +171,18 @@ struct outbound_entry* libworker_send_query(
 	return 0;
 }
 
+int libworker_hedge_query(struct outbound_entry* ATTR_UNUSED(e),
+	int ATTR_UNUSED(ms))
+{
+	log_assert(0);
+	return 0;
+}
+
+void libworker_hedge_timer_cb(void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 int libworker_handle_reply(struct comm_point* ATTR_UNUSED(c), 
 	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
         struct comm_reply* ATTR_UNUSED(reply_info))
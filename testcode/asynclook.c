@@ -49,6 +49,14 @@
 #include "util/locks.h"
 #include "util/log.h"
 #include "sldns/rrdef.h"
+#include <sys/time.h>
+#include <signal.h>
+#ifdef HAVE_SYS_WAIT_H
+#include <sys/wait.h>
+#endif
+#ifdef HAVE_SYS_RESOURCE_H
+#include <sys/resource.h>
+#endif
 #ifdef UNBOUND_ALLOC_LITE
 #undef malloc
 #undef calloc
@@ -90,13 +98,17 @@ static void usage(char* argv[])
 	printf("usage: %s [options] name ...\n", argv[0]);
 	printf("names are looked up at the same time, asynchronously.\n");
 	printf("	-b : use blocking requests\n");
+	printf("	-B num : benchmark, num lookups of the names, per query\n"
+	       "	         and batched\n");
 	printf("	-c : cancel the requests\n");
 	printf("	-d : enable debug output\n");
 	printf("	-f addr : use addr, forward to that server\n");
+	printf("	-F : test a batch that cannot be sent to the background\n");
 	printf("	-h : this help message\n");
 	printf("	-H fname : read hosts from fname\n");
 	printf("	-r fname : read resolv.conf from fname\n");
 	printf("	-t : use a resolver thread instead of forking a process\n");
+	printf("	-T num : use num resolver threads\n");
 	printf("	-x : perform extended threaded test\n");
 	exit(1);
 }
@@ -378,6 +390,199 @@ ext_test(struct ub_ctx* ctx, int argc, char** argv)
 	return 0;
 }
 
+/** number of answers received in the benchmark */
+static int bench_done = 0;
+
+/** benchmark result callback, this function is ub_callback_type */
+static void
+bench_callback(void* ATTR_UNUSED(mydata), int err, struct ub_result* result)
+{
+	checkerr("bench_callback", err);
+	bench_done++;
+	ub_resolve_free(result);
+}
+
+/** the time now, in usec */
+static double
+now_usec(void)
+{
+	struct timeval tv;
+	if(gettimeofday(&tv, NULL) < 0) {
+		printf("gettimeofday: %s\n", strerror(errno));
+		exit(1);
+	}
+	return (double)tv.tv_sec*1000000. + (double)tv.tv_usec;
+}
+
+/** the cpu time used by the process, all threads, in usec */
+static double
+cpu_usec(void)
+{
+#ifdef HAVE_SYS_RESOURCE_H
+	struct rusage ru;
+	if(getrusage(RUSAGE_SELF, &ru) < 0)
+		return 0;
+	return (double)(ru.ru_utime.tv_sec + ru.ru_stime.tv_sec)*1000000. +
+		(double)(ru.ru_utime.tv_usec + ru.ru_stime.tv_usec);
+#else
+	return 0;
+#endif
+}
+
+/** print benchmark result */
+static void
+bench_print(const char* desc, int count, double start, double cpu)
+{
+	double t = now_usec() - start;
+	cpu = cpu_usec() - cpu;
+	if(bench_done != count) {
+		printf("%s: error %d answers for %d queries\n", desc,
+			bench_done, count);
+		exit(1);
+	}
+	printf("%-10s %d queries in %.3f sec, %.0f queries/sec, "
+		"cpu %.2f usec/query\n", desc, count, t/1000000.,
+		(double)count*1000000./t, cpu/(double)count);
+}
+
+/** perform the benchmark, the names are looked up per query with
+ * ub_resolve_async and then with ub_resolve_async_batch.  The cache is
+ * warmed first, so that the time spent is that of the library. */
+static int
+bench_test(struct ub_ctx* ctx, int argc, char** argv, int count)
+{
+	struct ub_query* qs;
+	double start, cpu;
+	int i, r;
+	if(argc < 1) {
+		printf("benchmark needs names to look up\n");
+		return 1;
+	}
+	qs = (struct ub_query*)calloc((size_t)count, sizeof(*qs));
+	if(!qs) {
+		printf("out of memory\n");
+		return 1;
+	}
+	for(i=0; i<count; i++) {
+		qs[i].name = argv[i%argc];
+		qs[i].rrtype = LDNS_RR_TYPE_A;
+		qs[i].rrclass = LDNS_RR_CLASS_IN;
+	}
+	/* warm up the cache */
+	for(i=0; i<argc; i++) {
+		r = ub_resolve_async(ctx, argv[i], LDNS_RR_TYPE_A,
+			LDNS_RR_CLASS_IN, NULL, bench_callback, NULL);
+		checkerr("ub_resolve_async", r);
+	}
+	checkerr("ub_wait", ub_wait(ctx));
+
+	bench_done = 0;
+	start = now_usec();
+	cpu = cpu_usec();
+	for(i=0; i<count; i++) {
+		r = ub_resolve_async(ctx, qs[i].name, qs[i].rrtype,
+			qs[i].rrclass, NULL, bench_callback, &qs[i].async_id);
+		checkerr("ub_resolve_async", r);
+	}
+	checkerr("ub_wait", ub_wait(ctx));
+	bench_print("per query", count, start, cpu);
+
+	bench_done = 0;
+	start = now_usec();
+	cpu = cpu_usec();
+	r = ub_resolve_async_batch(ctx, qs, count, bench_callback);
+	checkerr("ub_resolve_async_batch", r);
+	checkerr("ub_wait", ub_wait(ctx));
+	bench_print("batched", count, start, cpu);
+
+	free(qs);
+	ub_ctx_delete(ctx);
+	checklock_stop();
+	return 0;
+}
+
+/** callback for queries that should not be answered */
+static void
+fail_callback(void* ATTR_UNUSED(mydata), int ATTR_UNUSED(err),
+	struct ub_result* ATTR_UNUSED(result))
+{
+	printf("error: callback for a query that was not started\n");
+	exit(1);
+}
+
+/** send a batch of num queries to the dead background process, and check
+ * that it fails and that none of the queries remain */
+static void
+batch_fail_one(struct ub_ctx* ctx, struct ub_query* qs, int num,
+	const char* name)
+{
+	int i, r;
+	for(i=0; i<num; i++) {
+		qs[i].name = name;
+		qs[i].rrtype = LDNS_RR_TYPE_A;
+		qs[i].rrclass = LDNS_RR_CLASS_IN;
+		qs[i].async_id = -1;
+	}
+	r = ub_resolve_async_batch(ctx, qs, num, fail_callback);
+	if(r != UB_PIPE) {
+		printf("error: batch of %d returned %s\n", num, ub_strerror(r));
+		exit(1);
+	}
+	for(i=0; i<num; i++) {
+		if(qs[i].async_id != 0) {
+			printf("error: query %d of %d has id %d\n", i, num,
+				qs[i].async_id);
+			exit(1);
+		}
+	}
+	/* only the query that started the background process is left */
+	lock_basic_lock(&ctx->cfglock);
+	if(ctx->num_async != 1 || ctx->queries.count != 1) {
+		printf("error: batch of %d left %d queries\n", num,
+			(int)ctx->queries.count);
+		exit(1);
+	}
+	lock_basic_unlock(&ctx->cfglock);
+	printf("batch of %d: %s, no queries left\n", num, ub_strerror(r));
+}
+
+/** test the failure of ub_resolve_async_batch, the background process is
+ * killed, so that the queries cannot be written to it */
+static int
+batch_fail_test(struct ub_ctx* ctx, int argc, char** argv)
+{
+	struct ub_query qs[UB_LIBCMD_BATCH_MAX+10];
+	int r;
+	if(argc != 1) {
+		printf("batch failure test needs a name to look up\n");
+		return 1;
+	}
+#if defined(HAVE_FORK) && !defined(UB_ON_WINDOWS)
+	(void)signal(SIGPIPE, SIG_IGN);
+	r = ub_resolve_async(ctx, argv[0], LDNS_RR_TYPE_A, LDNS_RR_CLASS_IN,
+		NULL, fail_callback, NULL);
+	checkerr("ub_resolve_async", r);
+	if(ctx->dothread) {
+		printf("batch failure test needs a background process\n");
+		return 1;
+	}
+	(void)kill(ctx->bg_pid, SIGKILL);
+	(void)waitpid(ctx->bg_pid, NULL, 0);
+	/* the last, partial, batch fails */
+	batch_fail_one(ctx, qs, 10, argv[0]);
+	/* a full batch fails, the rest is not started */
+	batch_fail_one(ctx, qs, UB_LIBCMD_BATCH_MAX+10, argv[0]);
+	/* the started query is not answered, and deleted with the context */
+	ub_ctx_delete(ctx);
+	checklock_stop();
+	return 0;
+#else
+	(void)ctx; (void)argv; (void)r;
+	printf("batch failure test needs fork\n");
+	return 1;
+#endif
+}
+
 /** getopt global, in case header files fail to declare it. */
 extern int optind;
 /** getopt global, in case header files fail to declare it. */
@@ -389,7 +594,7 @@ int main(int argc, char** argv)
 	int c;
 	struct ub_ctx* ctx;
 	struct lookinfo* lookups;
-	int i, r, cancel=0, blocking=0, ext=0;
+	int i, r, cancel=0, blocking=0, ext=0, bench=0, batchfail=0;
 
 	/* init log now because solaris thr_key_create() is not threadsafe */
 	log_init(0,0,0);
@@ -407,7 +612,7 @@ int main(int argc, char** argv)
 	if(argc == 1) {
 		usage(argv);
 	}
-	while( (c=getopt(argc, argv, "bcdf:hH:r:tx")) != -1) {
+	while( (c=getopt(argc, argv, "bB:cdf:FhH:r:tT:x")) != -1) {
 		switch(c) {
 			case 'd':
 				r = ub_ctx_debuglevel(ctx, 3);
@@ -417,12 +622,23 @@ int main(int argc, char** argv)
 				r = ub_ctx_async(ctx, 1);
 				checkerr("ub_ctx_async", r);
 				break;
+			case 'T':
+				r = ub_ctx_async(ctx, 1);
+				checkerr("ub_ctx_async", r);
+				r = ub_ctx_set_option(ctx, "num-threads:", optarg);
+				checkerr("ub_ctx_set_option", r);
+				break;
 			case 'c':
 				cancel = 1;
 				break;
 			case 'b':
 				blocking = 1;
 				break;
+			case 'B':
+				bench = atoi(optarg);
+				if(bench < 1)
+					usage(argv);
+				break;
 			case 'r':
 				r = ub_ctx_resolvconf(ctx, optarg);
 				if(r != 0) {
@@ -447,6 +663,9 @@ int main(int argc, char** argv)
 				r = ub_ctx_set_fwd(ctx, optarg);
 				checkerr("ub_ctx_set_fwd", r);
 				break;
+			case 'F':
+				batchfail = 1;
+				break;
 			case 'x':
 				ext = 1;
 				break;
@@ -461,6 +680,10 @@ int main(int argc, char** argv)
 
 	if(ext)
 		return ext_test(ctx, argc, argv);
+	if(bench)
+		return bench_test(ctx, argc, argv, bench);
+	if(batchfail)
+		return batch_fail_test(ctx, argc, argv);
 
 	/* allocate array for results. */
 	lookups = (struct lookinfo*)calloc((size_t)argc, 
@@ -0,0 +1,80 @@
+/*
+ * testcode/benchutil.c - timing helpers for the benchmark programs.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * Helper routines that the benchmark programs in testcode share.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include <sys/time.h>
+
+double
+bench_now_usec(void)
+{
+	struct timeval tv;
+	if(gettimeofday(&tv, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return (double)tv.tv_sec*1000000. + (double)tv.tv_usec;
+}
+
+void
+bench_print_time(const char* what, double start, int count)
+{
+	double t = (bench_now_usec() - start)*1000./(double)count;
+	printf("%-28s %7.1f nsec/call %10.0f calls/sec\n", what, t,
+		1000000000./t);
+}
+
+uint64_t
+bench_cycles(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	return (uint64_t)__builtin_ia32_rdtsc();
+#else
+	return 0;
+#endif
+}
+
+/** random state, the run is the same every time */
+static unsigned int bench_rnd_state = 1;
+
+int
+bench_random(int max)
+{
+	bench_rnd_state = bench_rnd_state*1103515245 + 12345;
+	return (int)((bench_rnd_state>>8) % (unsigned)max);
+}
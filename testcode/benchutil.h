@@ -0,0 +1,73 @@
+/*
+ * testcode/benchutil.h - timing helpers for the benchmark programs.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * Helper routines that the benchmark programs in testcode share, to take
+ * the time and print the time per call, and a random number generator
+ * that gives the same sequence on every run.
+ */
+
+#ifndef TESTCODE_BENCHUTIL_H
+#define TESTCODE_BENCHUTIL_H
+
+/**
+ * Get the time now.
+ * @return the wall clock time in usec.
+ */
+double bench_now_usec(void);
+
+/**
+ * Print the time per call since start, and the calls per second.
+ * @param what: description, printed in front.
+ * @param start: start time from bench_now_usec.
+ * @param count: the number of calls that were timed.
+ */
+void bench_print_time(const char* what, double start, int count);
+
+/**
+ * Read the cpu cycle counter, to time a single call.
+ * @return the cycle count, or 0 if the platform has no counter.
+ */
+uint64_t bench_cycles(void);
+
+/**
+ * Random number, from a fixed seed, so that the runs are the same.
+ * @param max: the upper bound.
+ * @return number from 0 to max-1.
+ */
+int bench_random(int max);
+
+#endif /* TESTCODE_BENCHUTIL_H */
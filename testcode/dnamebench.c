@@ -0,0 +1,177 @@
+/*
+ * testcode/dnamebench.c - microbenchmark of the domain name functions.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program times the case folding, compare and hash functions for
+ * domain names, for every level of vector instructions that is available.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include "util/data/dname.h"
+#include "util/storage/lookup3.h"
+#include "sldns/sbuffer.h"
+#include "sldns/str2wire.h"
+
+/** the names that are used, from short to long */
+static const char* bench_names[] = {
+	"com.",
+	"www.example.com.",
+	"WwW.ExAmPlE.CoM.",
+	"a.b.c.d.e.f.g.h.i.j.k.l.m.n.o.p.q.r.s.t.u.v.w.x.y.z.example.org.",
+	"0.1.2.3.4.5.6.7.8.9.a.b.c.d.e.f.0.1.2.3.4.5.6.7.8.9.a.b.c.d.e.f."
+		"ip6.arpa.",
+	"a-rather-long-label-with-lots-of-text-in-it-to-fill-63-characte."
+		"another-long-label.Mixed-Case-Label.example.net.",
+	NULL
+};
+
+/** number of names */
+#define BENCH_MAX 16
+
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	dnamebench [count]\n");
+	printf("times the domain name functions, count times per name.\n");
+	exit(1);
+}
+
+/** print the result of a timed run */
+static void
+report(const char* func, int level, double start, int count, int num,
+	unsigned int sum)
+{
+	double ns = (bench_now_usec() - start)*1000. /
+		((double)count*(double)num);
+	printf("%-22s %-5s %8.2f nsec/call (%x)\n", func,
+		(level==DNAME_SIMD_AVX2?"avx2":(level==DNAME_SIMD_SSE2?
+		"sse2":"none")), ns, sum);
+}
+
+/** time the functions at a vector level */
+static void
+bench_level(int level, uint8_t** d1, uint8_t** d2, int* labs, int num,
+	int count)
+{
+	uint8_t tmp[LDNS_MAX_DOMAINLEN+1];
+	unsigned int sum = 0;
+	double start;
+	int i, j, m;
+
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		for(j=0; j<num; j++)
+			sum += (unsigned int)query_dname_compare(d1[j], d2[j]);
+	report("query_dname_compare", level, start, count, num, sum);
+
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		for(j=0; j<num; j++)
+			sum += (unsigned int)dname_lab_cmp(d1[j], labs[j],
+				d2[j], labs[j], &m);
+	report("dname_lab_cmp", level, start, count, num, sum);
+
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		for(j=0; j<num; j++)
+			sum += (unsigned int)dname_canonical_compare(d1[j],
+				d2[j]);
+	report("dname_canonical_compare", level, start, count, num, sum);
+
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		for(j=0; j<num; j++)
+			sum += dname_query_hash(d2[j], 0);
+	report("dname_query_hash", level, start, count, num, sum);
+
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		for(j=0; j<num; j++) {
+			memmove(tmp, d2[j], LDNS_MAX_DOMAINLEN+1);
+			query_dname_tolower(tmp);
+			sum += tmp[1];
+		}
+	report("query_dname_tolower", level, start, count, num, sum);
+
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		for(j=0; j<num; j++)
+			sum += (unsigned int)dname_count_labels(d1[j]);
+	report("dname_count_labels", level, start, count, num, sum);
+}
+
+/** main program for dnamebench */
+int main(int argc, char* argv[])
+{
+	uint8_t* d1[BENCH_MAX], *d2[BENCH_MAX];
+	int labs[BENCH_MAX];
+	int num, count = 1000000, level, max;
+	size_t len;
+	log_init(NULL, 0, NULL);
+	if(argc > 2)
+		usage();
+	if(argc == 2 && (count = atoi(argv[1])) <= 0)
+		usage();
+
+	/* the compared names are equal, apart from case, as after a hash
+	 * table lookup; that is the common, and the slowest, case */
+	for(num=0; bench_names[num]; num++) {
+		len = LDNS_MAX_DOMAINLEN+1;
+		d1[num] = (uint8_t*)calloc(1, len);
+		d2[num] = (uint8_t*)calloc(1, len);
+		if(!d1[num] || !d2[num])
+			fatal_exit("out of memory");
+		if(sldns_str2wire_dname_buf(bench_names[num], d1[num], &len))
+			fatal_exit("bad name %s", bench_names[num]);
+		memmove(d2[num], d1[num], len);
+		query_dname_tolower(d1[num]);
+		labs[num] = dname_count_labels(d1[num]);
+	}
+
+	max = dname_simd_select(-1);
+	printf("%d names, %d times each\n", num, count);
+	for(level = DNAME_SIMD_NONE; level <= max; level++) {
+		dname_simd_select(level);
+		bench_level(level, d1, d2, labs, num, count);
+	}
+	for(num--; num >= 0; num--) {
+		free(d1[num]);
+		free(d2[num]);
+	}
+	return 0;
+}
@@ -0,0 +1,60 @@
+/*
+ * testcode/dynlib_badabi.c - plugin for the dynlib module with a wrong ABI.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+/**
+ * \file
+ *
+ * A plugin for the dynlib module with another ABI version than this
+ * unbound, the unit test checks that it is refused when it is loaded.
+ */
+
+#include "config.h"
+#include "dynlibmod/dynlib_plugin.h"
+
+/** the plugin, it has no hooks, because it is never called */
+const struct dynlib_plugin dynlib_plugin = {
+	DYNLIB_ABI_VERSION+1,
+	"badabi",
+	NULL, /* init */
+	NULL, /* deinit */
+	NULL, /* operate */
+	NULL, /* inform_super */
+	NULL, /* clear */
+	NULL, /* get_mem */
+	NULL, /* reply */
+	NULL, /* reply_cache */
+	NULL, /* reply_local */
+	NULL, /* reply_servfail */
+	NULL /* query */
+};
@@ -0,0 +1,153 @@
+/*
+ * testcode/dynlibbench.c - benchmark of the dynlib module plugin calls.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program loads a plugin with the dynlib module, like the daemon
+ * does, and times the calls of its hooks: operate for a query that is
+ * passed on and for a query that is refused by the example filter
+ * plugin, and the inplace callback for a reply. That is the cost that
+ * the plugin adds to a query, the plugin works on the query state and
+ * the reply where they are, without conversion.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include "util/regional.h"
+#include "util/module.h"
+#include "util/config_file.h"
+#include "util/net_help.h"
+#include "util/data/msgreply.h"
+#ifdef USE_DYNLIBMOD
+#include "dynlibmod/dynlibmod.h"
+#endif
+#include "sldns/rrdef.h"
+
+#ifdef USE_DYNLIBMOD
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	dynlibbench plugin.so [count]\n");
+	printf("times the calls to the plugin hooks, count times.\n");
+	printf("the plugin is, for example, the dynlib_filter.so example.\n");
+	exit(1);
+}
+
+/** time operate for a query name, it returns the ext_state */
+static enum module_ext_state
+bench_operate(const char* what, struct module_qstate* qstate,
+	uint8_t* qname, size_t qname_len, int count)
+{
+	double start;
+	int i;
+	qstate->qinfo.qname = qname;
+	qstate->qinfo.qname_len = qname_len;
+	start = bench_now_usec();
+	for(i=0; i<count; i++) {
+		dynlibmod_operate(qstate, module_event_new, 0, NULL);
+		dynlibmod_clear(qstate, 0);
+	}
+	bench_print_time(what, start, count);
+	return qstate->ext_state[0];
+}
+
+/** time the inplace callbacks for a reply */
+static void
+bench_reply(struct module_env* env, struct module_qstate* qstate, int count)
+{
+	struct reply_info rep;
+	struct edns_data edns;
+	double start;
+	int i;
+	memset(&rep, 0, sizeof(rep));
+	memset(&edns, 0, sizeof(edns));
+	edns.edns_present = 1;
+	edns.udp_size = EDNS_ADVERTISED_SIZE;
+	start = bench_now_usec();
+	for(i=0; i<count; i++) {
+		(void)inplace_cb_reply_call(env, &qstate->qinfo, qstate, &rep,
+			LDNS_RCODE_NOERROR, &edns, qstate->region);
+	}
+	bench_print_time("inplace reply callback", start, count);
+}
+#endif /* USE_DYNLIBMOD */
+
+/** main program for dynlibbench */
+int main(int argc, char* argv[])
+{
+#ifdef USE_DYNLIBMOD
+	struct module_env env;
+	struct module_qstate qstate;
+	struct config_file* cfg;
+	int count = 10000000;
+	log_init(NULL, 0, NULL);
+	if(argc < 2 || argc > 3)
+		usage();
+	if(argc == 3 && (count = atoi(argv[2])) < 1)
+		usage();
+	memset(&env, 0, sizeof(env));
+	memset(&qstate, 0, sizeof(qstate));
+	if(!(cfg = config_create()) || !(cfg->dynlib_file = strdup(argv[1]))
+		|| !(qstate.region = regional_create()))
+		fatal_exit("out of memory");
+	env.cfg = cfg;
+	if(!dynlibmod_init(&env, 0))
+		fatal_exit("could not load plugin %s", argv[1]);
+	qstate.env = &env;
+	qstate.qinfo.qtype = LDNS_RR_TYPE_A;
+	qstate.qinfo.qclass = LDNS_RR_CLASS_IN;
+	printf("calls to the %s plugin, %d times each\n",
+		((struct dynlibmod_env*)env.modinfo[0])->plugin->name, count);
+	if(bench_operate("operate, query passed", &qstate,
+		(uint8_t*)"\003www\007example\003com\000", 17, count)
+		!= module_wait_module)
+		printf("the plugin did not pass the query\n");
+	if(bench_operate("operate, query refused", &qstate,
+		(uint8_t*)"\003www\003ads\007example\003com\000", 21, count)
+		!= module_finished)
+		printf("the plugin did not refuse the query\n");
+	bench_reply(&env, &qstate, count);
+	dynlibmod_deinit(&env, 0);
+	regional_destroy(qstate.region);
+	config_delete(cfg);
+#else
+	(void)argc;
+	(void)argv;
+	printf("dynlibbench: the dynlib module is not compiled in, "
+		"configure with --enable-dynlibmod\n");
+#endif /* USE_DYNLIBMOD */
+	return 0;
+}
@@ -0,0 +1,248 @@
+/*
+ * testcode/encodebench.c - benchmark of the reply encoder.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program times the encoding of replies from the cache into wire
+ * format, for a typical small answer, a referral with glue, and a large
+ * DNSSEC signed answer with many names in it. Most of the encode time
+ * for the larger replies is spent on domain name compression.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include "util/alloc.h"
+#include "util/regional.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgencode.h"
+#include "util/data/msgparse.h"
+#include "util/net_help.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
+#include "sldns/str2wire.h"
+
+/** a fake signature, base64 of 129 bytes */
+#define BENCH_SIG "abcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcd" \
+	"abcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcd" \
+	"abcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcdabcd"
+
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	encodebench [count]\n");
+	printf("times the encoding of replies, count times per reply.\n");
+	exit(1);
+}
+
+/** append an RR in text format to the packet, and count it in the
+ * header at the count offset */
+static void
+add_rr(sldns_buffer* pkt, size_t countpos, const char* str)
+{
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	size_t len = sizeof(rr), dname_len = 0;
+	if(sldns_str2wire_rr_buf(str, rr, &len, &dname_len, 3600, NULL, 0,
+		NULL, 0) != 0)
+		fatal_exit("bad rr %s", str);
+	if(sldns_buffer_remaining(pkt) < len)
+		fatal_exit("packet too large");
+	sldns_buffer_write(pkt, rr, len);
+	sldns_buffer_write_u16_at(pkt, countpos,
+		sldns_buffer_read_u16_at(pkt, countpos)+1);
+}
+
+/** append an RR and its RRSIG, the RR has the owner name first */
+static void
+add_signed(sldns_buffer* pkt, size_t countpos, const char* owner,
+	const char* type, const char* rdata)
+{
+	char str[1024];
+	snprintf(str, sizeof(str), "%s IN %s %s", owner, type, rdata);
+	add_rr(pkt, countpos, str);
+	snprintf(str, sizeof(str), "%s IN RRSIG %s 8 2 3600 20300101000000 "
+		"20170101000000 12345 example.com. %s", owner, type, BENCH_SIG);
+	add_rr(pkt, countpos, str);
+}
+
+/** start a reply packet, with the query */
+static void
+start_pkt(sldns_buffer* pkt, const char* qname, uint16_t qtype)
+{
+	uint8_t dname[LDNS_MAX_DOMAINLEN+1];
+	size_t len = sizeof(dname);
+	if(sldns_str2wire_dname_buf(qname, dname, &len) != 0)
+		fatal_exit("bad name %s", qname);
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, 0); /* id */
+	sldns_buffer_write_u16(pkt, BIT_QR|BIT_AA);
+	sldns_buffer_write_u16(pkt, 1);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write(pkt, dname, len);
+	sldns_buffer_write_u16(pkt, qtype);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+}
+
+/** a typical answer, with the nameservers and their addresses */
+static void
+make_typical(sldns_buffer* pkt)
+{
+	start_pkt(pkt, "www.example.com.", LDNS_RR_TYPE_A);
+	add_rr(pkt, 6, "www.example.com. IN A 192.0.2.1");
+	add_rr(pkt, 8, "example.com. IN NS ns1.example.com.");
+	add_rr(pkt, 8, "example.com. IN NS ns2.example.com.");
+	add_rr(pkt, 10, "ns1.example.com. IN A 192.0.2.53");
+	add_rr(pkt, 10, "ns2.example.com. IN A 198.51.100.53");
+	add_rr(pkt, 10, "ns1.example.com. IN AAAA 2001:db8::53");
+	add_rr(pkt, 10, "ns2.example.com. IN AAAA 2001:db8:1::53");
+}
+
+/** a referral from the root, with 13 nameservers and glue */
+static void
+make_referral(sldns_buffer* pkt)
+{
+	char str[256];
+	int i;
+	start_pkt(pkt, "www.example.com.", LDNS_RR_TYPE_A);
+	for(i=0; i<13; i++) {
+		snprintf(str, sizeof(str), "com. IN NS %c.gtld-servers.net.",
+			'a'+i);
+		add_rr(pkt, 8, str);
+	}
+	for(i=0; i<13; i++) {
+		snprintf(str, sizeof(str), "%c.gtld-servers.net. IN A "
+			"192.0.2.%d", 'a'+i, i+1);
+		add_rr(pkt, 10, str);
+		snprintf(str, sizeof(str), "%c.gtld-servers.net. IN AAAA "
+			"2001:db8::%d", 'a'+i, i+1);
+		add_rr(pkt, 10, str);
+	}
+}
+
+/** a large signed answer, MX and NS heavy, with the addresses */
+static void
+make_large(sldns_buffer* pkt)
+{
+	char name[128], rdata[128];
+	int i;
+	start_pkt(pkt, "example.com.", LDNS_RR_TYPE_MX);
+	for(i=0; i<20; i++) {
+		snprintf(rdata, sizeof(rdata), "%d mail%d.example.com.",
+			10+i, i);
+		add_signed(pkt, 6, "example.com.", "MX", rdata);
+	}
+	for(i=0; i<8; i++) {
+		snprintf(rdata, sizeof(rdata), "ns%d.example.com.", i);
+		add_signed(pkt, 8, "example.com.", "NS", rdata);
+	}
+	for(i=0; i<20; i++) {
+		snprintf(name, sizeof(name), "mail%d.example.com.", i);
+		snprintf(rdata, sizeof(rdata), "192.0.2.%d", i+1);
+		add_signed(pkt, 10, name, "A", rdata);
+	}
+	for(i=0; i<8; i++) {
+		snprintf(name, sizeof(name), "ns%d.example.com.", i);
+		snprintf(rdata, sizeof(rdata), "198.51.100.%d", i+1);
+		add_signed(pkt, 10, name, "A", rdata);
+	}
+}
+
+/** parse the packet and time its encoding */
+static void
+bench_reply(const char* what, sldns_buffer* pkt, int count)
+{
+	struct alloc_cache alloc;
+	struct regional* region = regional_create();
+	sldns_buffer* out = sldns_buffer_new(65535);
+	struct query_info qinfo;
+	struct reply_info* rep;
+	struct edns_data edns;
+	double start, t;
+	int i;
+	if(!region || !out)
+		fatal_exit("out of memory");
+	alloc_init(&alloc, NULL, 0);
+	sldns_buffer_flip(pkt);
+	if(reply_info_parse(pkt, &alloc, &qinfo, &rep, region, &edns) != 0)
+		fatal_exit("cannot parse %s reply", what);
+	/* warm up, and check that it fits */
+	if(!reply_info_encode(&qinfo, rep, 0, BIT_QR|BIT_AA, out, 0, region,
+		65535, 1))
+		fatal_exit("cannot encode %s reply", what);
+	if(LDNS_TC_WIRE(sldns_buffer_begin(out)))
+		fatal_exit("%s reply is truncated", what);
+	start = bench_now_usec();
+	for(i=0; i<count; i++) {
+		(void)reply_info_encode(&qinfo, rep, 0, BIT_QR|BIT_AA, out, 0,
+			region, 65535, 1);
+		regional_free_all(region);
+	}
+	t = (bench_now_usec() - start)*1000./(double)count;
+	printf("%-10s %3d rrsets %5d bytes (from %5d) encode %9.1f nsec "
+		"%8.0f replies/sec\n", what, (int)rep->rrset_count,
+		(int)sldns_buffer_limit(out), (int)sldns_buffer_limit(pkt),
+		t, 1000000000./t);
+	reply_info_parsedelete(rep, &alloc);
+	query_info_clear(&qinfo);
+	alloc_clear(&alloc);
+	regional_destroy(region);
+	sldns_buffer_free(out);
+}
+
+/** main program for encodebench */
+int main(int argc, char* argv[])
+{
+	sldns_buffer* pkt = sldns_buffer_new(65535);
+	int count = 100000;
+	log_init(NULL, 0, NULL);
+	if(argc > 2)
+		usage();
+	if(argc == 2 && (count = atoi(argv[1])) < 1)
+		usage();
+	if(!pkt)
+		fatal_exit("out of memory");
+	printf("encode of replies, %d times each\n", count);
+	make_typical(pkt);
+	bench_reply("typical", pkt, count);
+	make_referral(pkt);
+	bench_reply("referral", pkt, count);
+	make_large(pkt);
+	bench_reply("large", pkt, count);
+	sldns_buffer_free(pkt);
+	return 0;
+}
@@ -199,6 +199,33 @@ pending_matches_current(struct replay_runtime* runtime,
 	return 0;
 }
 
+/**
+ * See if the answer from the entry is held back, because the entry has
+ * an ADJUST sleep=N and N seconds of fake time have not yet passed since
+ * the query was sent.  This models upstream latency in replays.
+ * @param runtime: runtime.
+ * @param entry: the matched entry.
+ * @param pend: the outgoing query.
+ * @return true if the answer should not be given yet.
+ */
+static int
+pending_is_delayed(struct replay_runtime* runtime, struct entry* entry,
+	struct fake_pending* pend)
+{
+	struct timeval due;
+	if(entry->sleeptime == 0)
+		return 0;
+	due = pend->sent_tv;
+	due.tv_sec += (time_t)entry->sleeptime;
+	if(runtime->now_tv.tv_sec > due.tv_sec ||
+		(runtime->now_tv.tv_sec == due.tv_sec &&
+		runtime->now_tv.tv_usec >= due.tv_usec))
+		return 0;
+	log_info("testbound: answer of entry line %d delayed until %d.%6.6d",
+		entry->lineno, (int)due.tv_sec, (int)due.tv_usec);
+	return 1;
+}
+
 /**
  * Find the range that matches this pending message.
  * @param runtime: runtime with current moment, and range list.
@@ -217,7 +244,8 @@ pending_find_match(struct replay_runtime* runtime, struct entry** entry,
 		  (p->addrlen == 0 || sockaddr_cmp(&p->addr, p->addrlen,
 		  	&pend->addr, pend->addrlen) == 0) &&
 		  (*entry = find_match(p->match, pend->pkt, pend->pkt_len,
-		 	 pend->transport))) {
+		 	 pend->transport)) && !pending_is_delayed(runtime,
+			 *entry, pend)) {
 			log_info("matched query time %d in range [%d, %d] "
 				"with entry line %d", timenow, 
 				p->start_step, p->end_step, (*entry)->lineno);
@@ -399,6 +427,7 @@ fake_front_query(struct replay_runtime* runtime, struct replay_moment *todo)
 	else	repinfo.c->type = comm_udp;
 	fill_buffer_with_reply(repinfo.c->buffer, todo->match, NULL, 0);
 	log_info("testbound: incoming QUERY");
+	runtime->query_tv = runtime->now_tv;
 	log_pkt("query pkt", todo->match->reply_list->reply_pkt,
 		todo->match->reply_list->reply_len);
 	/* call the callback for incoming queries */
@@ -550,23 +579,19 @@ autotrust_check(struct replay_runtime* runtime, struct replay_moment* mom)
 	log_info("autotrust %s is OK", mom->autotrust_id);
 }
 
-/** Store RTT in infra cache */
+/** Store RTT in infra cache, the rtt is kept per address, the zone is
+ * only printed */
 static void
 do_infra_rtt(struct replay_runtime* runtime)
 {
 	struct replay_moment* now = runtime->now;
 	int rto;
-	size_t dplen = 0;
-	uint8_t* dp = sldns_str2wire_dname(now->variable, &dplen);
-	if(!dp) fatal_exit("cannot parse %s", now->variable);
 	rto = infra_rtt_update(runtime->infra, &now->addr, now->addrlen,
-		dp, dplen, LDNS_RR_TYPE_A, atoi(now->string),
-		-1, runtime->now_secs);
+		LDNS_RR_TYPE_A, atoi(now->string), -1, runtime->now_secs);
 	log_addr(0, "INFRA_RTT for", &now->addr, now->addrlen);
 	log_info("INFRA_RTT(%s roundtrip %d): rto of %d", now->variable,
 		atoi(now->string), rto);
 	if(rto == 0) fatal_exit("infra_rtt_update failed");
-	free(dp);
 }
 
 /** perform exponential backoff on the timeout */
@@ -578,12 +603,12 @@ expon_timeout_backoff(struct replay_runtime* runtime)
 	uint8_t edns_lame_known;
 	int last_rtt, rto;
 	if(!p) return; /* no pending packet to backoff */
-	if(!infra_host(runtime->infra, &p->addr, p->addrlen, p->zone,
-		p->zonelen, runtime->now_secs, &vs, &edns_lame_known, &rtt))
+	if(!infra_host(runtime->infra, &p->addr, p->addrlen,
+		runtime->now_secs, &vs, &edns_lame_known, &rtt))
 		return;
 	last_rtt = rtt;
-	rto = infra_rtt_update(runtime->infra, &p->addr, p->addrlen, p->zone,
-		p->zonelen, p->qtype, -1, last_rtt, runtime->now_secs);
+	rto = infra_rtt_update(runtime->infra, &p->addr, p->addrlen,
+		p->qtype, -1, last_rtt, runtime->now_secs);
 	log_info("infra_rtt_update returned rto %d", rto);
 }
 
@@ -863,7 +888,16 @@ comm_point_send_reply(struct comm_reply* repinfo)
 	struct replay_answer* ans = (struct replay_answer*)calloc(1,
 		sizeof(struct replay_answer));
 	struct replay_runtime* runtime = (struct replay_runtime*)repinfo->c->ev;
+	struct timeval lat;
 	log_info("testbound: comm_point_send_reply fake");
+	lat.tv_sec = runtime->now_tv.tv_sec - runtime->query_tv.tv_sec;
+	lat.tv_usec = runtime->now_tv.tv_usec - runtime->query_tv.tv_usec;
+	if(lat.tv_usec < 0) {
+		lat.tv_sec--;
+		lat.tv_usec += 1000000;
+	}
+	log_info("testbound: reply latency %d.%6.6d sec", (int)lat.tv_sec,
+		(int)lat.tv_usec);
 	/* dump it into the todo list */
 	log_assert(ans);
 	memcpy(&ans->repinfo, repinfo, sizeof(struct comm_reply));
@@ -903,7 +937,9 @@ outside_network_create(struct comm_base* base, size_t bufsize,
 	int ATTR_UNUSED(outgoing_tcp_mss),
 	void (*unwanted_action)(void*), void* ATTR_UNUSED(unwanted_param),
 	int ATTR_UNUSED(do_udp), void* ATTR_UNUSED(sslctx),
-	int ATTR_UNUSED(delayclose), struct dt_env* ATTR_UNUSED(dtenv))
+	int ATTR_UNUSED(delayclose), int ATTR_UNUSED(udp_pool),
+	int ATTR_UNUSED(udp_pool_rotate), int ATTR_UNUSED(udp_pool_uses),
+	struct dt_env* ATTR_UNUSED(dtenv))
 {
 	struct replay_runtime* runtime = (struct replay_runtime*)base;
 	struct outside_network* outnet =  calloc(1, 
@@ -959,6 +995,7 @@ pending_udp_query(struct serviced_query* sq, sldns_buffer* packet,
 	pend->zone = NULL;
 	pend->serviced = 0;
 	pend->runtime = runtime;
+	pend->sent_tv = runtime->now_tv;
 	pend->pkt_len = sldns_buffer_limit(packet);
 	pend->pkt = memdup(sldns_buffer_begin(packet), pend->pkt_len);
 	if(!pend->pkt) fatal_exit("out of memory");
@@ -1008,6 +1045,7 @@ pending_tcp_query(struct serviced_query* sq, sldns_buffer* packet,
 	pend->pkt = NULL;
 	pend->zone = NULL;
 	pend->runtime = runtime;
+	pend->sent_tv = runtime->now_tv;
 	pend->serviced = 0;
 	pend->pkt_len = sldns_buffer_limit(packet);
 	pend->pkt = memdup(sldns_buffer_begin(packet), pend->pkt_len);
@@ -1094,6 +1132,7 @@ struct serviced_query* outnet_serviced_query(struct outside_network* outnet,
 	pend->transport = transport_udp; /* pretend UDP */
 	pend->pkt = NULL;
 	pend->runtime = runtime;
+	pend->sent_tv = runtime->now_tv;
 	pend->serviced = 1;
 	pend->pkt_len = sldns_buffer_limit(pend->buffer);
 	pend->pkt = memdup(sldns_buffer_begin(pend->buffer), pend->pkt_len);
@@ -1298,6 +1337,12 @@ void comm_base_handle_slow_accept(int ATTR_UNUSED(fd),
 	log_assert(0);
 }
 
+void comm_base_wheel_callback(int ATTR_UNUSED(fd), 
+	short ATTR_UNUSED(event), void* ATTR_UNUSED(arg))
+{
+	log_assert(0);
+}
+
 int serviced_udp_callback(struct comm_point* ATTR_UNUSED(c), 
 	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
         struct comm_reply* ATTR_UNUSED(reply_info))
@@ -1341,6 +1386,13 @@ struct comm_timer* comm_timer_create(struct comm_base* base,
 	return (struct comm_timer*)t;
 }
 
+struct comm_timer* comm_timer_create_coarse(struct comm_base* base, 
+	void (*cb)(void*), void* cb_arg)
+{
+	/* the fake timers already run in fake time */
+	return comm_timer_create(base, cb, cb_arg);
+}
+
 void comm_timer_disable(struct comm_timer* timer)
 {
 	struct fake_timer* t = (struct fake_timer*)timer;
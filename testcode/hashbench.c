@@ -0,0 +1,280 @@
+/*
+ * testcode/hashbench.c - benchmark of the cache hash functions.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program compares the lookup3 hash with the keyed hash that is used
+ * for the cache tables, for speed and for the spread of the hash values
+ * over the bins of a hash table.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include "util/data/dname.h"
+#include "util/data/packed_rrset.h"
+#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
+#include "sldns/rrdef.h"
+#include "sldns/str2wire.h"
+#include <ctype.h>
+
+/** number of bits in the bin number for the spread test */
+#define BENCH_BINBITS 12
+
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	hashbench [count]\n");
+	printf("times the hash functions, count times per length, and\n");
+	printf("tests the spread of count/100 names over %d bins.\n",
+		1<<BENCH_BINBITS);
+	exit(1);
+}
+
+/** the dname hash before the keyed hash, with lookup3 label by label */
+static uint32_t
+lookup3_dname_hash(uint8_t* dname, uint32_t h)
+{
+	uint8_t labuf[LDNS_MAX_LABELLEN+1];
+	uint8_t lablen;
+	int i;
+	while((lablen = *dname++) != 0) {
+		labuf[0] = lablen;
+		i=0;
+		while(lablen--)
+			labuf[++i] = (uint8_t)tolower((unsigned char)*dname++);
+		h = hashlittle(labuf, (size_t)labuf[0] + 1, h);
+	}
+	return h;
+}
+
+/** time the hash of a block of data */
+static void
+bench_len(size_t len, int count)
+{
+	uint8_t data[256];
+	uint32_t sum = 0;
+	double start, t1, t2;
+	int i;
+	for(i=0; i<(int)sizeof(data); i++)
+		data[i] = (uint8_t)(i*7);
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		sum = hashlittle(data, len, sum);
+	t1 = (bench_now_usec() - start)*1000./(double)count;
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		sum = keyhash(data, len, sum);
+	t2 = (bench_now_usec() - start)*1000./(double)count;
+	printf("%4d bytes  lookup3 %7.2f nsec %7.1f MB/s  keyhash %7.2f nsec "
+		"%7.1f MB/s (%x)\n", (int)len, t1, (double)len*1000./t1, t2,
+		(double)len*1000./t2, (unsigned)sum);
+}
+
+/** the rrset key hash before the keyed hash */
+static uint32_t
+lookup3_rrset_hash(struct packed_rrset_key* key)
+{
+	uint16_t t = ntohs(key->type);
+	uint32_t h = 0xab;
+	h = lookup3_dname_hash(key->dname, h);
+	h = hashlittle(&t, sizeof(t), h);
+	h = hashlittle(&key->rrset_class, sizeof(uint16_t), h);
+	h = hashlittle(&key->flags, sizeof(uint32_t), h);
+	return h;
+}
+
+/** time the dname hash and the rrset key hash of a name */
+static void
+bench_dname(const char* str, int count)
+{
+	uint8_t dname[LDNS_MAX_DOMAINLEN+1];
+	size_t len = sizeof(dname);
+	struct packed_rrset_key key;
+	uint32_t sum = 0;
+	double start, t1, t2, t3, t4;
+	int i;
+	if(sldns_str2wire_dname_buf(str, dname, &len))
+		fatal_exit("bad name %s", str);
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		sum += lookup3_dname_hash(dname, (uint32_t)i);
+	t1 = (bench_now_usec() - start)*1000./(double)count;
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		sum += dname_query_hash(dname, (hashvalue_type)i);
+	t2 = (bench_now_usec() - start)*1000./(double)count;
+
+	memset(&key, 0, sizeof(key));
+	key.dname = dname;
+	key.dname_len = len;
+	key.type = htons(LDNS_RR_TYPE_A);
+	key.rrset_class = htons(LDNS_RR_CLASS_IN);
+	start = bench_now_usec();
+	for(i=0; i<count; i++) {
+		key.flags = (uint32_t)i&1;
+		sum += lookup3_rrset_hash(&key);
+	}
+	t3 = (bench_now_usec() - start)*1000./(double)count;
+	start = bench_now_usec();
+	for(i=0; i<count; i++) {
+		key.flags = (uint32_t)i&1;
+		sum += rrset_key_hash(&key);
+	}
+	t4 = (bench_now_usec() - start)*1000./(double)count;
+	printf("%-32s dname lookup3 %7.2f keyhash %7.2f, rrset lookup3 "
+		"%7.2f keyhash %7.2f nsec (%x)\n", str, t1, t2, t3, t4,
+		(unsigned)sum);
+}
+
+/** print the spread of the hash values over the bins; the bins are
+ * selected with the low bits, like lruhash, and the slabs with the high
+ * bits, like slabhash */
+static void
+report_spread(const char* what, uint32_t* hashes, int num)
+{
+	int nbins = 1<<BENCH_BINBITS, i, maxlow = 0, maxhigh = 0;
+	int* low = (int*)calloc((size_t)nbins, sizeof(int));
+	int* high = (int*)calloc((size_t)nbins, sizeof(int));
+	double expect = (double)num/(double)nbins, chilow = 0, chihigh = 0;
+	if(!low || !high)
+		fatal_exit("out of memory");
+	for(i=0; i<num; i++) {
+		low[hashes[i] & (uint32_t)(nbins-1)]++;
+		high[hashes[i] >> (32-BENCH_BINBITS)]++;
+	}
+	for(i=0; i<nbins; i++) {
+		chilow += ((double)low[i]-expect)*((double)low[i]-expect)/
+			expect;
+		chihigh += ((double)high[i]-expect)*((double)high[i]-expect)/
+			expect;
+		if(low[i] > maxlow) maxlow = low[i];
+		if(high[i] > maxhigh) maxhigh = high[i];
+	}
+	/* for a uniform hash, chi2/bins is close to 1 */
+	printf("%-28s low bits chi2/bins %6.3f max %3d, high bits chi2/bins "
+		"%6.3f max %3d (expect %.1f)\n", what, chilow/(double)nbins,
+		maxlow, chihigh/(double)nbins, maxhigh, expect);
+	free(low);
+	free(high);
+}
+
+/** test the spread of a set of names */
+static void
+spread_names(const char* fmt, int num)
+{
+	uint32_t* h1 = (uint32_t*)calloc((size_t)num, sizeof(uint32_t));
+	uint32_t* h2 = (uint32_t*)calloc((size_t)num, sizeof(uint32_t));
+	uint8_t dname[LDNS_MAX_DOMAINLEN+1];
+	char str[256], what[64];
+	size_t len;
+	int i;
+	if(!h1 || !h2)
+		fatal_exit("out of memory");
+	for(i=0; i<num; i++) {
+		snprintf(str, sizeof(str), fmt, i);
+		len = sizeof(dname);
+		if(sldns_str2wire_dname_buf(str, dname, &len))
+			fatal_exit("bad name %s", str);
+		h1[i] = lookup3_dname_hash(dname, 0xab);
+		h2[i] = dname_query_hash(dname, 0xab);
+	}
+	snprintf(what, sizeof(what), "lookup3 %s", fmt);
+	report_spread(what, h1, num);
+	snprintf(what, sizeof(what), "keyhash %s", fmt);
+	report_spread(what, h2, num);
+	free(h1);
+	free(h2);
+}
+
+/** test the spread of IPv4 addresses in one /16 */
+static void
+spread_addrs(int num)
+{
+	uint32_t* h1 = (uint32_t*)calloc((size_t)num, sizeof(uint32_t));
+	uint32_t* h2 = (uint32_t*)calloc((size_t)num, sizeof(uint32_t));
+	uint8_t a[4];
+	int i;
+	if(!h1 || !h2)
+		fatal_exit("out of memory");
+	for(i=0; i<num; i++) {
+		a[0] = 10;
+		a[1] = (uint8_t)(i>>16);
+		a[2] = (uint8_t)(i>>8);
+		a[3] = (uint8_t)i;
+		h1[i] = hashlittle(a, sizeof(a), 0xab);
+		h2[i] = keyhash(a, sizeof(a), 0xab);
+	}
+	report_spread("lookup3 10.x.y.z", h1, num);
+	report_spread("keyhash 10.x.y.z", h2, num);
+	free(h1);
+	free(h2);
+}
+
+/** main program for hashbench */
+int main(int argc, char* argv[])
+{
+	static const size_t lens[] = { 4, 8, 16, 32, 64, 128, 255, 0 };
+	static const char* names[] = { "com.", "www.example.com.",
+		"a.b.c.d.e.f.g.h.example.org.",
+		"a-rather-long-label.example.net.", NULL };
+	uint8_t key[KEYHASH_KEYSIZE];
+	int count = 10000000, i;
+	log_init(NULL, 0, NULL);
+	if(argc > 2)
+		usage();
+	if(argc == 2 && (count = atoi(argv[1])) < 100)
+		usage();
+	/* a random key, like the server does at startup */
+	srandom((unsigned)time(NULL) ^ (unsigned)getpid());
+	for(i=0; i<KEYHASH_KEYSIZE; i++)
+		key[i] = (uint8_t)random();
+	keyhash_set_key(key);
+
+	printf("speed, %d times per length\n", count);
+	for(i=0; lens[i]; i++)
+		bench_len(lens[i], count);
+	for(i=0; names[i]; i++)
+		bench_dname(names[i], count);
+
+	printf("spread of %d keys over %d bins\n", count/100,
+		1<<BENCH_BINBITS);
+	spread_names("host%d.example.com.", count/100);
+	spread_names("%x.ip6.arpa.", count/100);
+	spread_names("a%d.", count/100);
+	spread_addrs(count/100);
+	return 0;
+}
@@ -0,0 +1,223 @@
+/*
+ * testcode/indexbench.c - time the lookups of mesh states and replies.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program times the lookups that the resolver does for every reply
+ * with a number of queries in flight.  For an upstream reply it finds
+ * the pending query by id and address, removes it and inserts the next
+ * query.  For a client query it finds the mesh state, as
+ * mesh_area_find does.  With the hash index the time per reply should
+ * stay about the same when the number of queries in flight grows.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include "util/storage/hashindex.h"
+#include "util/data/msgreply.h"
+#include "util/net_help.h"
+#include "services/outside_network.h"
+#include "services/mesh.h"
+#include "sldns/rrdef.h"
+
+/** number of upstream servers */
+#define NUM_SERVERS 1000
+
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	indexbench [-n inflight] [-q replies]\n");
+	printf("times the lookups of pending replies and mesh states.\n");
+	printf("-n	number of queries in flight, default 10000.\n");
+	printf("-q	number of replies, default 1000000.\n");
+	exit(1);
+}
+
+/** give the pending a new id and server, as for the next query */
+static void
+pending_next(struct pending* p, struct sockaddr_storage* servers,
+	socklen_t* lens)
+{
+	int s = bench_random(NUM_SERVERS);
+	p->id = (unsigned)bench_random(0x10000);
+	memcpy(&p->addr, &servers[s], lens[s]);
+	p->addrlen = lens[s];
+	p->node.key = p;
+	p->node.hash = pending_hash(p);
+}
+
+/** lookup key for the reply to p, as outnet_udp_cb makes it */
+static void
+reply_key(struct pending* key, struct pending* p)
+{
+	key->id = p->id;
+	memcpy(&key->addr, &p->addr, p->addrlen);
+	key->addrlen = p->addrlen;
+}
+
+/** time the replies to pending queries, returns nsec per reply */
+static double
+bench_pending(struct pending* p, int n, int numq,
+	struct sockaddr_storage* servers, socklen_t* lens)
+{
+	struct hashindex* h = hashindex_create(pending_cmp);
+	struct pending key;
+	double start, end;
+	int i;
+	if(!h)
+		fatal_exit("out of memory");
+	for(i=0; i<n; i++) {
+		do {
+			pending_next(&p[i], servers, lens);
+		} while(!hashindex_insert(h, &p[i].node));
+	}
+	start = bench_now_usec();
+	for(i=0; i<numq; i++) {
+		int r = bench_random(n);
+		reply_key(&key, &p[r]);
+		if(hashindex_search(h, &key, pending_hash(&key)) !=
+			&p[r].node)
+			fatal_exit("pending not found");
+		(void)hashindex_remove(h, &p[r].node);
+		do {
+			pending_next(&p[r], servers, lens);
+		} while(!hashindex_insert(h, &p[r].node));
+	}
+	end = bench_now_usec();
+	hashindex_delete(h);
+	return (end-start)*1000./(double)numq;
+}
+
+/** set the query of the mesh state, number i */
+static void
+mesh_state_init(struct mesh_state* m, uint8_t* name, int i)
+{
+	size_t len = (size_t)snprintf((char*)name+1, 30, "q%d", i);
+	name[0] = (uint8_t)len;
+	memcpy(name+len+1, "\007example\003com", 13);
+	m->node.key = m;
+	m->s.qinfo.qname = name;
+	m->s.qinfo.qname_len = len+14;
+	m->s.qinfo.qtype = (i%4 == 0)?LDNS_RR_TYPE_AAAA:LDNS_RR_TYPE_A;
+	m->s.qinfo.qclass = LDNS_RR_CLASS_IN;
+	m->s.query_flags = BIT_RD;
+	m->node.hash = query_info_hash(&m->s.qinfo, m->s.query_flags);
+}
+
+/** time the lookups of mesh states, returns nsec per lookup */
+static double
+bench_mesh(struct mesh_state* m, int n, int numq)
+{
+	struct hashindex* h = hashindex_create(mesh_state_compare);
+	struct mesh_state key;
+	double start, end;
+	int i;
+	if(!h)
+		fatal_exit("out of memory");
+	for(i=0; i<n; i++)
+		(void)hashindex_insert(h, &m[i].node);
+	memset(&key, 0, sizeof(key));
+	start = bench_now_usec();
+	for(i=0; i<numq; i++) {
+		int r = bench_random(n);
+		/* the key refers to the query, as in mesh_area_find */
+		key.s.qinfo = m[r].s.qinfo;
+		key.s.query_flags = m[r].s.query_flags;
+		if(hashindex_search(h, &key, query_info_hash(&key.s.qinfo,
+			key.s.query_flags)) != &m[r].node)
+			fatal_exit("mesh state not found");
+	}
+	end = bench_now_usec();
+	hashindex_delete(h);
+	return (end-start)*1000./(double)numq;
+}
+
+/** getopt global, in case header files fail to declare it. */
+extern int optind;
+/** getopt global, in case header files fail to declare it. */
+extern char* optarg;
+
+/** main program for indexbench */
+int main(int argc, char* argv[])
+{
+	struct sockaddr_storage servers[NUM_SERVERS];
+	socklen_t lens[NUM_SERVERS];
+	struct pending* p;
+	struct mesh_state* m;
+	uint8_t* names;
+	int n = 10000, numq = 1000000, i, c;
+	log_init(NULL, 0, NULL);
+	while((c = getopt(argc, argv, "n:q:h")) != -1) {
+		switch(c) {
+		case 'n':
+			n = atoi(optarg);
+			break;
+		case 'q':
+			numq = atoi(optarg);
+			break;
+		case 'h':
+		case '?':
+		default:
+			usage();
+		}
+	}
+	if(optind != argc || n < 1 || n > 1000000 || numq < 1)
+		usage();
+	for(i=0; i<NUM_SERVERS; i++) {
+		char a[32];
+		if(i%4 == 0)
+			snprintf(a, sizeof(a), "2001:db8::%x", i);
+		else	snprintf(a, sizeof(a), "10.0.%d.%d", i>>8, i&0xff);
+		if(!ipstrtoaddr(a, UNBOUND_DNS_PORT, &servers[i], &lens[i]))
+			fatal_exit("bad address %s", a);
+	}
+	p = (struct pending*)calloc((size_t)n, sizeof(*p));
+	m = (struct mesh_state*)calloc((size_t)n, sizeof(*m));
+	names = (uint8_t*)calloc((size_t)n, 64);
+	if(!p || !m || !names)
+		fatal_exit("out of memory");
+	for(i=0; i<n; i++)
+		mesh_state_init(&m[i], names+(size_t)i*64, i);
+
+	printf("%d queries in flight, %d replies\n", n, numq);
+	printf("upstream reply, find, remove, insert next: %6.1f nsec\n",
+		bench_pending(p, n, numq, servers, lens));
+	printf("mesh state lookup: %6.1f nsec\n", bench_mesh(m, n, numq));
+	free(p);
+	free(m);
+	free(names);
+	return 0;
+}
@@ -0,0 +1,274 @@
+/*
+ * testcode/infrabench.c - replay a resolver workload on the infra cache.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program replays a synthetic resolver workload on the infra cache.
+ * Hosting providers have a few nameservers that serve many zones each,
+ * and the other zones have nameservers of their own.  The queries pick
+ * a zone with a skewed popularity and one of the nameservers of the
+ * zone, and use the timeout from the infra cache.  A server that is
+ * slower than the timeout, or that loses the packet, is a timeout.  The
+ * program prints the number of entries, the memory use, the timeouts
+ * and the EDNS probes that were needed.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include "util/config_file.h"
+#include "util/net_help.h"
+#include "util/storage/slabhash.h"
+#include "services/cache/infra.h"
+#include "sldns/rrdef.h"
+
+/** number of hosting providers */
+#define NUM_PROV 10
+/** number of nameservers of a provider */
+#define PROV_NS 4
+/** number of nameservers of a zone that is not at a provider */
+#define OWN_NS 2
+
+/** a nameserver */
+struct bench_ns {
+	/** the address */
+	struct sockaddr_storage addr;
+	/** length of addr */
+	socklen_t addrlen;
+	/** the roundtrip time, in msec */
+	int rtt;
+	/** the loss, in percent */
+	int loss;
+};
+
+/** a zone */
+struct bench_zone {
+	/** the zone name */
+	uint8_t name[32];
+	/** length of name */
+	size_t namelen;
+	/** the nameservers */
+	struct bench_ns* ns[PROV_NS];
+	/** number of nameservers */
+	int num;
+	/** if the last nameserver does not serve the zone */
+	int lame;
+};
+
+/** the counters of the replay */
+struct bench_stats {
+	/** queries sent */
+	size_t queries;
+	/** queries that timed out */
+	size_t timeouts;
+	/** timeouts because the timeout was below the server rtt */
+	size_t early;
+	/** EDNS probes, queries to a server with unknown EDNS status */
+	size_t probes;
+	/** queries that were not sent because the server was lame */
+	size_t lame;
+};
+
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	infrabench [-n numhosts] [-z zones] [-q queries]\n");
+	printf("replays a resolver workload on the infra cache.\n");
+	printf("-n	infra-cache-numhosts, default 10000.\n");
+	printf("-z	number of zones, default 100000.\n");
+	printf("-q	number of queries, default 2000000.\n");
+	exit(1);
+}
+
+/** init a nameserver with number i */
+static void
+ns_init(struct bench_ns* ns, int i)
+{
+	char a[32];
+	snprintf(a, sizeof(a), "10.%d.%d.%d", (i>>16)&0xff, (i>>8)&0xff,
+		i&0xff);
+	if(!ipstrtoaddr(a, UNBOUND_DNS_PORT, &ns->addr, &ns->addrlen))
+		fatal_exit("bad address %s", a);
+	/* mostly close servers, and some far away */
+	ns->rtt = 20 + bench_random(100);
+	if(bench_random(10) == 0)
+		ns->rtt = 300 + bench_random(300);
+	ns->loss = (bench_random(20) == 0)?20:1;
+}
+
+/** send a query to a server of the zone */
+static void
+query(struct infra_cache* infra, struct bench_zone* z, time_t now,
+	struct bench_stats* st)
+{
+	struct bench_ns* ns = z->ns[bench_random(z->num)];
+	int edns_vs, to, lame, dnsseclame, reclame, rtt;
+	uint8_t edns_lame_known;
+	uint16_t qtype = (bench_random(4) == 0)?LDNS_RR_TYPE_AAAA:LDNS_RR_TYPE_A;
+	if(infra_get_lame_rtt(infra, &ns->addr, ns->addrlen, z->name,
+		z->namelen, qtype, &lame, &dnsseclame, &reclame, &rtt, now)
+		&& lame) {
+		st->lame++;
+		return;
+	}
+	if(!infra_host(infra, &ns->addr, ns->addrlen, now, &edns_vs,
+		&edns_lame_known, &to))
+		fatal_exit("out of memory");
+	st->queries++;
+	if(!edns_lame_known)
+		st->probes++;
+	if(ns->rtt > to || bench_random(100) < ns->loss) {
+		if(ns->rtt > to)
+			st->early++;
+		st->timeouts++;
+		(void)infra_rtt_update(infra, &ns->addr, ns->addrlen, qtype,
+			-1, to, now);
+		return;
+	}
+	(void)infra_rtt_update(infra, &ns->addr, ns->addrlen, qtype,
+		ns->rtt + bench_random(10), to, now);
+	if(!edns_lame_known)
+		(void)infra_edns_update(infra, &ns->addr, ns->addrlen, 0, now);
+	/* some of the servers of a zone do not serve it */
+	if(z->lame && ns == z->ns[z->num-1])
+		(void)infra_set_lame(infra, &ns->addr, ns->addrlen, z->name,
+			z->namelen, now, 0, 0, qtype);
+}
+
+/** count the entries in a hash table */
+static size_t
+count(struct slabhash* h)
+{
+	if(!h)
+		return 0;
+	return count_slabhash_entries(h);
+}
+
+/** getopt global, in case header files fail to declare it. */
+extern int optind;
+/** getopt global, in case header files fail to declare it. */
+extern char* optarg;
+
+/** main program for infrabench */
+int main(int argc, char* argv[])
+{
+	struct config_file* cfg;
+	struct infra_cache* infra;
+	struct bench_ns* servers;
+	struct bench_zone* zones;
+	struct bench_stats st;
+	int numzones = 100000, numq = 2000000, numhosts = 10000;
+	int i, j, k, c, numns;
+	time_t now = 1000000;
+	log_init(NULL, 0, NULL);
+	while((c = getopt(argc, argv, "n:q:z:h")) != -1) {
+		switch(c) {
+		case 'n':
+			numhosts = atoi(optarg);
+			break;
+		case 'q':
+			numq = atoi(optarg);
+			break;
+		case 'z':
+			numzones = atoi(optarg);
+			break;
+		case 'h':
+		case '?':
+		default:
+			usage();
+		}
+	}
+	if(optind != argc || numhosts < 1 || numzones < NUM_PROV*2 ||
+		numq < 1)
+		usage();
+	if(!(cfg = config_create()))
+		fatal_exit("out of memory");
+	cfg->infra_cache_numhosts = (size_t)numhosts;
+
+	/* half of the zones is at a provider, the others have their own
+	 * nameservers */
+	numns = NUM_PROV*PROV_NS + (numzones/2)*OWN_NS;
+	servers = (struct bench_ns*)calloc((size_t)numns, sizeof(*servers));
+	zones = (struct bench_zone*)calloc((size_t)numzones, sizeof(*zones));
+	if(!servers || !zones)
+		fatal_exit("out of memory");
+	for(i=0; i<numns; i++)
+		ns_init(&servers[i], i+1);
+	for(i=0, k=NUM_PROV*PROV_NS; i<numzones; i++) {
+		struct bench_zone* z = &zones[i];
+		z->namelen = (size_t)snprintf((char*)z->name+1,
+			sizeof(z->name)-2, "zone%d", i);
+		z->name[0] = (uint8_t)z->namelen;
+		memcpy(z->name+z->namelen+1, "\003com", 5);
+		z->namelen += 6;
+		z->lame = (i%10 == 3);
+		if(i%2 == 0) {
+			int p = bench_random(NUM_PROV);
+			z->num = PROV_NS;
+			for(j=0; j<PROV_NS; j++)
+				z->ns[j] = &servers[p*PROV_NS+j];
+		} else {
+			z->num = OWN_NS;
+			for(j=0; j<OWN_NS; j++)
+				z->ns[j] = &servers[k++];
+		}
+	}
+
+	if(!(infra = infra_create(cfg)))
+		fatal_exit("out of memory");
+	memset(&st, 0, sizeof(st));
+	for(i=0; i<numq; i++) {
+		/* a skewed popularity, most queries go to a few zones */
+		int r = bench_random(numzones);
+		int z = (bench_random(2) == 0)?bench_random(r+1):r;
+		query(infra, &zones[z], now, &st);
+		if(i%1000 == 999)
+			now++;
+	}
+	printf("numhosts %d, %d zones, %d nameservers, %d queries, "
+		"%d sec\n", numhosts, numzones, numns, numq, numq/1000);
+	printf("hosts %u, lame %u entries, memory %u bytes\n",
+		(unsigned)count(infra->hosts), (unsigned)count(infra->lame),
+		(unsigned)infra_get_mem(infra));
+	printf("sent %u, timeouts %u (%u below the rtt), edns probes %u, "
+		"lame skipped %u\n", (unsigned)st.queries,
+		(unsigned)st.timeouts, (unsigned)st.early,
+		(unsigned)st.probes, (unsigned)st.lame);
+	infra_delete(infra);
+	config_delete(cfg);
+	free(servers);
+	free(zones);
+	return 0;
+}
@@ -0,0 +1,198 @@
+/*
+ * testcode/nsec3bench.c - benchmark of the NSEC3 hash cache.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program times the NSEC3 hashes that the validator calculates for
+ * NXDOMAIN replies from an NSEC3 signed zone, with and without the shared
+ * cache of NSEC3 hashes. For every query the closest encloser, the next
+ * closer name and the wildcard are hashed, with a fresh per-query hash
+ * tree, like the validator does. The query names are random, so the next
+ * closer hash is new, or drawn from a small set of names that repeat.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include "util/alloc.h"
+#include "util/regional.h"
+#include "util/rbtree.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/data/packed_rrset.h"
+#include "util/net_help.h"
+#include "util/storage/slabhash.h"
+#include "validator/val_nsec3.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
+#include "sldns/str2wire.h"
+
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	nsec3bench [count] [iterations]\n");
+	printf("times the NSEC3 hashes for count NXDOMAIN replies, with the\n");
+	printf("given number of NSEC3 iterations (default 10).\n");
+	exit(1);
+}
+
+/** make a reply with an NSEC3 record in it, with iter iterations */
+static void
+make_nsec3(sldns_buffer* pkt, int iter)
+{
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	size_t len = sizeof(rr), dname_len = 0;
+	char str[512];
+	snprintf(str, sizeof(str), "0p9mhaveqvm6t7vbl5lop2u3t2rp3tom.example. "
+		"IN NSEC3 1 0 %d aabbccdd 2t7b4g4vsa5smi47k61mv5bv1a22bojr "
+		"A RRSIG", iter);
+	if(sldns_str2wire_rr_buf(str, rr, &len, &dname_len, 3600, NULL, 0,
+		NULL, 0) != 0)
+		fatal_exit("bad rr %s", str);
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, 0); /* id */
+	sldns_buffer_write_u16(pkt, BIT_QR|BIT_AA);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 1);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write(pkt, rr, len);
+	sldns_buffer_flip(pkt);
+}
+
+/** hash a name for the query */
+static void
+hash_one(rbtree_type* ct, struct slabhash* hcache, struct regional* region,
+	sldns_buffer* buf, struct ub_packed_rrset_key* nsec3, uint8_t* nm,
+	size_t len)
+{
+	struct nsec3_cached_hash* hash = NULL;
+	uint8_t* dname = regional_alloc_init(region, nm, len);
+	if(!dname)
+		fatal_exit("out of memory");
+	if(nsec3_hash_name(ct, hcache, region, buf, nsec3, 0, dname, len,
+		&hash) != 1)
+		fatal_exit("could not hash name");
+}
+
+/** time count NXDOMAIN queries, the names from a pool of size names,
+ * or unique if size is 0 */
+static void
+bench_queries(const char* what, struct slabhash* hcache,
+	struct ub_packed_rrset_key* nsec3, int count, int size)
+{
+	struct regional* region = regional_create();
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	/* the closest encloser, and the wildcard below it, the size of
+	 * the strings includes the terminating zero of the literal */
+	uint8_t ce[] = "\007example\000";
+	uint8_t wc[] = "\001*\007example\000";
+	uint8_t qname[] = "\010xxxxxxxx\007example\000";
+	rbtree_type ct;
+	double start, t;
+	int i;
+	if(!region || !buf)
+		fatal_exit("out of memory");
+	start = bench_now_usec();
+	for(i=0; i<count; i++) {
+		char lab[16];
+		snprintf(lab, sizeof(lab), "%8.8x", (unsigned)(size?i%size:i));
+		memmove(qname+1, lab, 8);
+		rbtree_init(&ct, &nsec3_hash_cmp);
+		hash_one(&ct, hcache, region, buf, nsec3, ce, sizeof(ce)-1);
+		hash_one(&ct, hcache, region, buf, nsec3, qname,
+			sizeof(qname)-1);
+		hash_one(&ct, hcache, region, buf, nsec3, wc, sizeof(wc)-1);
+		regional_free_all(region);
+	}
+	t = (bench_now_usec() - start)*1000./(double)count;
+	printf("%-22s %9.1f nsec/query %8.0f queries/sec\n", what, t,
+		1000000000./t);
+	regional_destroy(region);
+	sldns_buffer_free(buf);
+}
+
+/** run the benchmarks for the query mix, without and with the cache */
+static void
+bench_mix(const char* what, struct ub_packed_rrset_key* nsec3, int count,
+	int size)
+{
+	char name[64];
+	struct slabhash* hcache = nsec3_hcache_create(4, 4*1024*1024);
+	if(!hcache)
+		fatal_exit("out of memory");
+	snprintf(name, sizeof(name), "%s, no cache", what);
+	bench_queries(name, NULL, nsec3, count, size);
+	snprintf(name, sizeof(name), "%s, shared", what);
+	bench_queries(name, hcache, nsec3, count, size);
+	slabhash_delete(hcache);
+}
+
+/** main program for nsec3bench */
+int main(int argc, char* argv[])
+{
+	sldns_buffer* pkt = sldns_buffer_new(65535);
+	struct alloc_cache alloc;
+	struct regional* region = regional_create();
+	struct query_info qinfo;
+	struct reply_info* rep;
+	struct edns_data edns;
+	int count = 100000, iter = 10;
+	log_init(NULL, 0, NULL);
+	if(argc > 3)
+		usage();
+	if(argc >= 2 && (count = atoi(argv[1])) < 1)
+		usage();
+	if(argc == 3 && (iter = atoi(argv[2])) < 0)
+		usage();
+	if(!pkt || !region)
+		fatal_exit("out of memory");
+	alloc_init(&alloc, NULL, 0);
+	make_nsec3(pkt, iter);
+	if(reply_info_parse(pkt, &alloc, &qinfo, &rep, region, &edns) != 0 ||
+		rep->rrset_count != 1)
+		fatal_exit("cannot parse NSEC3 reply");
+	printf("NSEC3 hashes for NXDOMAIN, %d queries, %d iterations\n",
+		count, iter);
+	bench_mix("unique names", rep->rrsets[0], count, 0);
+	bench_mix("1000 names", rep->rrsets[0], count, 1000);
+	reply_info_parsedelete(rep, &alloc);
+	query_info_clear(&qinfo);
+	alloc_clear(&alloc);
+	regional_destroy(region);
+	sldns_buffer_free(pkt);
+	return 0;
+}
@@ -0,0 +1,127 @@
+/*
+ * testcode/qlogdump.c - print the binary query log file.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program prints the records in a log-binary-file as the log lines
+ * of log-queries and log-replies, with the time of the record.
+ */
+#include "config.h"
+#include "util/log.h"
+#include "util/querylog.h"
+#include "sldns/sbuffer.h"
+
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	qlogdump [-a] file\n");
+	printf("prints the records in the binary query log file.\n");
+	printf("-a	print the time in ascii, not in seconds.\n");
+	exit(1);
+}
+
+/** print the records in the file, return number of records */
+static size_t
+dump_file(const char* fname)
+{
+	uint8_t buf[65536];
+	size_t len = 0, pos = 0, reclen, n = 0;
+	struct qlog_record rec;
+	time_t t = 0;
+	FILE* f = fopen(fname, "rb");
+	if(!f)
+		fatal_exit("could not open %s: %s", fname, strerror(errno));
+	len = fread(buf, 1, sizeof(buf), f);
+	if(len < 8 || memcmp(buf, QLOG_FILE_MAGIC, 4) != 0)
+		fatal_exit("%s is not a query log file", fname);
+	if(sldns_read_uint32(buf+4) != QLOG_FILE_VERSION)
+		fatal_exit("%s has version %u, not %u", fname,
+			(unsigned)sldns_read_uint32(buf+4),
+			(unsigned)QLOG_FILE_VERSION);
+	pos = 8;
+	log_set_time(&t);
+	while(1) {
+		if((reclen = qlog_record_unpack(buf+pos, len-pos, &rec)) != 0) {
+			t = (time_t)rec.sec;
+			qlog_record_log(&rec);
+			pos += reclen;
+			n++;
+			continue;
+		}
+		/* move the rest to the front and read more */
+		memmove(buf, buf+pos, len-pos);
+		len -= pos;
+		pos = 0;
+		reclen = fread(buf+len, 1, sizeof(buf)-len, f);
+		if(reclen == 0)
+			break;
+		len += reclen;
+	}
+	if(len != 0)
+		log_err("%s: %u bytes at the end are not a record", fname,
+			(unsigned)len);
+	fclose(f);
+	log_set_time(NULL);
+	return n;
+}
+
+/** getopt global, in case header files fail to declare it. */
+extern int optind;
+
+/** main program for qlogdump */
+int main(int argc, char* argv[])
+{
+	int c;
+	log_init(NULL, 0, NULL);
+	log_ident_set("qlogdump");
+	while((c = getopt(argc, argv, "ah")) != -1) {
+		switch(c) {
+		case 'a':
+			log_set_time_asc(1);
+			break;
+		case 'h':
+		case '?':
+		default:
+			usage();
+		}
+	}
+	argc -= optind;
+	argv += optind;
+	if(argc != 1)
+		usage();
+	(void)dump_file(argv[0]);
+	return 0;
+}
@@ -0,0 +1,193 @@
+/*
+ * testcode/querybench.c - benchmark of the client query decoder.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program times the decode of client queries, the header checks,
+ * the query info, the EDNS record and the hash for the message cache
+ * lookup. It compares query_info_decode with the separate calls that
+ * the worker made before, for a query without EDNS, a query with EDNS
+ * and the DO bit, and a long name with an EDNS cookie option.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include "util/regional.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/net_help.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
+#include "sldns/str2wire.h"
+
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	querybench [count]\n");
+	printf("times the decode of queries, count times per query.\n");
+	exit(1);
+}
+
+/** make a query packet, with an OPT record if edns is true, and an
+ * option of optlen bytes */
+static void
+make_query(sldns_buffer* pkt, const char* qname, uint16_t qtype, int edns,
+	uint16_t bits, size_t optlen)
+{
+	uint8_t dname[LDNS_MAX_DOMAINLEN+1];
+	size_t len = sizeof(dname), i;
+	if(sldns_str2wire_dname_buf(qname, dname, &len) != 0)
+		fatal_exit("bad name %s", qname);
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, 0x1234); /* id */
+	sldns_buffer_write_u16(pkt, BIT_RD);
+	sldns_buffer_write_u16(pkt, 1);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, edns?1:0);
+	sldns_buffer_write(pkt, dname, len);
+	sldns_buffer_write_u16(pkt, qtype);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	if(edns) {
+		sldns_buffer_write_u8(pkt, 0);
+		sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_OPT);
+		sldns_buffer_write_u16(pkt, 4096);
+		sldns_buffer_write_u16(pkt, 0);
+		sldns_buffer_write_u16(pkt, bits);
+		sldns_buffer_write_u16(pkt, (uint16_t)(optlen?optlen+4:0));
+		if(optlen) {
+			sldns_buffer_write_u16(pkt, 10); /* cookie */
+			sldns_buffer_write_u16(pkt, (uint16_t)optlen);
+			for(i=0; i<optlen; i++)
+				sldns_buffer_write_u8(pkt, (uint8_t)i);
+		}
+	}
+	sldns_buffer_flip(pkt);
+}
+
+/** decode like the worker did, with the separate calls */
+static int
+decode_separate(sldns_buffer* pkt, struct query_info* qinfo,
+	hashvalue_type* h, struct edns_data* edns, struct regional* region)
+{
+	uint8_t* q = sldns_buffer_begin(pkt);
+	sldns_buffer_rewind(pkt);
+	if(sldns_buffer_limit(pkt) < LDNS_HEADER_SIZE || LDNS_QR_WIRE(q) ||
+		LDNS_TC_WIRE(q) || LDNS_OPCODE_WIRE(q) != LDNS_PACKET_QUERY ||
+		LDNS_QDCOUNT(q) != 1 || LDNS_ANCOUNT(q) != 0 ||
+		LDNS_NSCOUNT(q) != 0 || LDNS_ARCOUNT(q) > 1)
+		return 0;
+	if(!query_info_parse(qinfo, pkt))
+		return 0;
+	if(parse_edns_from_pkt(pkt, edns, region) != 0)
+		return 0;
+	*h = query_info_hash(qinfo, sldns_buffer_read_u16_at(pkt, 2));
+	return 1;
+}
+
+/** decode with query_info_decode */
+static int
+decode_fused(sldns_buffer* pkt, struct query_info* qinfo,
+	hashvalue_type* h, struct edns_data* edns, struct regional* region)
+{
+	int rcode;
+	return query_info_decode(pkt, 1, qinfo, h, edns, region, &rcode)
+		== query_decode_ok;
+}
+
+/** time the decode of the query */
+static void
+bench_query(const char* what, sldns_buffer* pkt, int count)
+{
+	struct regional* region = regional_create();
+	struct query_info qinfo;
+	struct edns_data edns;
+	hashvalue_type h1 = 0, h2 = 0;
+	double start, t[2];
+	uint64_t cstart, c[2];
+	int i, m, n;
+	if(!region)
+		fatal_exit("out of memory");
+	if(!decode_separate(pkt, &qinfo, &h1, &edns, region) ||
+		!decode_fused(pkt, &qinfo, &h2, &edns, region) || h1 != h2)
+		fatal_exit("cannot decode %s query", what);
+	for(m=0; m<2; m++) {
+		start = bench_now_usec();
+		cstart = bench_cycles();
+		for(i=0, n=0; i<count; i++) {
+			if(m == 0)
+				n += decode_separate(pkt, &qinfo, &h1, &edns,
+					region);
+			else	n += decode_fused(pkt, &qinfo, &h1, &edns,
+					region);
+			regional_free_all(region);
+		}
+		c[m] = bench_cycles() - cstart;
+		t[m] = (bench_now_usec() - start)*1000./(double)count;
+		if(n != count)
+			fatal_exit("decode of %s query failed", what);
+	}
+	printf("%-10s %4d bytes  separate %6.1f nsec %6.0f cycles  "
+		"decode %6.1f nsec %6.0f cycles\n", what,
+		(int)sldns_buffer_limit(pkt), t[0],
+		(double)c[0]/(double)count, t[1], (double)c[1]/(double)count);
+	regional_destroy(region);
+}
+
+/** main program for querybench */
+int main(int argc, char* argv[])
+{
+	sldns_buffer* pkt = sldns_buffer_new(65535);
+	int count = 1000000;
+	log_init(NULL, 0, NULL);
+	if(argc > 2)
+		usage();
+	if(argc == 2 && (count = atoi(argv[1])) < 1)
+		usage();
+	if(!pkt)
+		fatal_exit("out of memory");
+	printf("decode of queries, %d times each\n", count);
+	make_query(pkt, "www.example.com.", LDNS_RR_TYPE_A, 0, 0, 0);
+	bench_query("plain", pkt, count);
+	make_query(pkt, "www.Example.COM.", LDNS_RR_TYPE_AAAA, 1, 0x8000, 0);
+	bench_query("edns", pkt, count);
+	make_query(pkt, "a-rather-long-label-for-a-host.in-a-subdomain.of."
+		"example-with-a-long-name.com.", LDNS_RR_TYPE_A, 1, 0x8000, 8);
+	bench_query("long", pkt, count);
+	sldns_buffer_free(pkt);
+	return 0;
+}
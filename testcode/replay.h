@@ -291,6 +291,8 @@ struct replay_runtime {
 	time_t now_secs;
 	/** the current time in microseconds */
 	struct timeval now_tv;
+	/** time of the last incoming client query, to log reply latency */
+	struct timeval query_tv;
 
 	/** signal handler callback */
 	void (*sig_cb)(int, void*);
@@ -330,6 +332,9 @@ struct fake_pending {
 	void* cb_arg;
 	/** original timeout in seconds from 'then' */
 	int timeout;
+	/** time the query was sent, answers with a sleep= are held back
+	 * until that much (fake) time has passed since then */
+	struct timeval sent_tv;
 
 	/** next in pending list */
 	struct fake_pending* next;
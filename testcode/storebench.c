@@ -0,0 +1,338 @@
+/*
+ * testcode/storebench.c - benchmark of storing upstream replies in the cache.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program times the store of upstream replies in the message and
+ * rrset caches, like the iterator does for every cache miss. The replies
+ * are parsed into a region beforehand, every reply has a new query name.
+ * Most of the rrsets in a reply, the NS rrset and the glue, are often
+ * already in the cache, so the workloads are an answer from a zone that
+ * is in the cache, a referral that is in the cache, and an answer from
+ * a new zone.
+ *
+ * It counts the rrsets that are copied into the cache (every copy gets a
+ * new rrset id), the bytes of those copies and, with glibc, the calls to
+ * malloc. Copies that are thrown away again are not in the cache, they
+ * are counted with the size of the rrsets that kept their cached copy.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include "util/alloc.h"
+#include "util/regional.h"
+#include "util/config_file.h"
+#include "util/module.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/data/packed_rrset.h"
+#include "util/net_help.h"
+#include "util/storage/slabhash.h"
+#include "services/cache/dns.h"
+#include "services/cache/rrset.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+#include "sldns/pkthdr.h"
+#include "sldns/str2wire.h"
+
+#ifdef __GLIBC__
+/** number of malloc calls */
+static size_t num_malloc = 0;
+extern void* __libc_malloc(size_t size);
+extern void* __libc_calloc(size_t nmemb, size_t size);
+extern void* __libc_realloc(void* ptr, size_t size);
+/** malloc that counts the calls */
+void* malloc(size_t size)
+{
+	num_malloc++;
+	return __libc_malloc(size);
+}
+/** calloc that counts the calls */
+void* calloc(size_t nmemb, size_t size)
+{
+	num_malloc++;
+	return __libc_calloc(nmemb, size);
+}
+/** realloc that counts the calls */
+void* realloc(void* ptr, size_t size)
+{
+	num_malloc++;
+	return __libc_realloc(ptr, size);
+}
+#endif /* __GLIBC__ */
+
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	storebench [count]\n");
+	printf("times the store of count replies in the cache, per reply.\n");
+	exit(1);
+}
+
+/** append an RR in text format to the packet, and count it in the
+ * header at the count offset */
+static void
+add_rr(sldns_buffer* pkt, size_t countpos, const char* str)
+{
+	uint8_t rr[LDNS_RR_BUF_SIZE];
+	size_t len = sizeof(rr), dname_len = 0;
+	if(sldns_str2wire_rr_buf(str, rr, &len, &dname_len, 3600, NULL, 0,
+		NULL, 0) != 0)
+		fatal_exit("bad rr %s", str);
+	if(sldns_buffer_remaining(pkt) < len)
+		fatal_exit("packet too large");
+	sldns_buffer_write(pkt, rr, len);
+	sldns_buffer_write_u16_at(pkt, countpos,
+		sldns_buffer_read_u16_at(pkt, countpos)+1);
+}
+
+/** start a reply packet, with the query */
+static void
+start_pkt(sldns_buffer* pkt, const char* qname, uint16_t qtype, uint16_t fl)
+{
+	uint8_t dname[LDNS_MAX_DOMAINLEN+1];
+	size_t len = sizeof(dname);
+	if(sldns_str2wire_dname_buf(qname, dname, &len) != 0)
+		fatal_exit("bad name %s", qname);
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, 0); /* id */
+	sldns_buffer_write_u16(pkt, fl);
+	sldns_buffer_write_u16(pkt, 1);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write(pkt, dname, len);
+	sldns_buffer_write_u16(pkt, qtype);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+}
+
+/** an answer, with the nameservers of the zone and their addresses */
+static void
+make_answer(sldns_buffer* pkt, int i, const char* zone)
+{
+	char qname[256], str[512];
+	snprintf(qname, sizeof(qname), "www%d.%s", i, zone);
+	start_pkt(pkt, qname, LDNS_RR_TYPE_A, BIT_QR|BIT_AA);
+	snprintf(str, sizeof(str), "%s IN A 192.0.2.%d", qname, i%250+1);
+	add_rr(pkt, 6, str);
+	snprintf(str, sizeof(str), "%s IN NS ns1.%s", zone, zone);
+	add_rr(pkt, 8, str);
+	snprintf(str, sizeof(str), "%s IN NS ns2.%s", zone, zone);
+	add_rr(pkt, 8, str);
+	snprintf(str, sizeof(str), "ns1.%s IN A 192.0.2.53", zone);
+	add_rr(pkt, 10, str);
+	snprintf(str, sizeof(str), "ns2.%s IN A 198.51.100.53", zone);
+	add_rr(pkt, 10, str);
+	snprintf(str, sizeof(str), "ns1.%s IN AAAA 2001:db8::53", zone);
+	add_rr(pkt, 10, str);
+	snprintf(str, sizeof(str), "ns2.%s IN AAAA 2001:db8:1::53", zone);
+	add_rr(pkt, 10, str);
+}
+
+/** an answer from a zone that is in the cache */
+static void
+make_cached_zone(sldns_buffer* pkt, int i)
+{
+	make_answer(pkt, i, "example.com.");
+}
+
+/** an answer from a new zone, every rrset in it is new */
+static void
+make_new_zone(sldns_buffer* pkt, int i)
+{
+	char zone[64];
+	snprintf(zone, sizeof(zone), "example%d.com.", i);
+	make_answer(pkt, i, zone);
+}
+
+/** a referral from the root, with 13 nameservers and glue */
+static void
+make_referral(sldns_buffer* pkt, int i)
+{
+	char qname[256], str[256];
+	int j;
+	snprintf(qname, sizeof(qname), "www.example%d.com.", i);
+	start_pkt(pkt, qname, LDNS_RR_TYPE_A, BIT_QR);
+	for(j=0; j<13; j++) {
+		snprintf(str, sizeof(str), "com. IN NS %c.gtld-servers.net.",
+			'a'+j);
+		add_rr(pkt, 8, str);
+	}
+	for(j=0; j<13; j++) {
+		snprintf(str, sizeof(str), "%c.gtld-servers.net. IN A "
+			"192.0.2.%d", 'a'+j, j+1);
+		add_rr(pkt, 10, str);
+		snprintf(str, sizeof(str), "%c.gtld-servers.net. IN AAAA "
+			"2001:db8::%d", 'a'+j, j+1);
+		add_rr(pkt, 10, str);
+	}
+}
+
+/** the id of the rrset in the cache, or 0 if not in the cache */
+static rrset_id_type
+cached_id(struct module_env* env, struct ub_packed_rrset_key* k)
+{
+	struct ub_packed_rrset_key* c = rrset_cache_lookup(env->rrset_cache,
+		k->rk.dname, k->rk.dname_len, ntohs(k->rk.type),
+		ntohs(k->rk.rrset_class), k->rk.flags, *env->now, 0);
+	rrset_id_type id;
+	if(!c)
+		return 0;
+	id = c->id;
+	lock_rw_unlock(&c->entry.lock);
+	return id;
+}
+
+/** parse the replies and time the store of them in the cache */
+static void
+bench_store(const char* what, void (*make)(sldns_buffer*, int), int referral,
+	int count)
+{
+	struct config_file* cfg = config_create();
+	struct alloc_cache alloc;
+	struct msg_parse* msg;
+	struct regional* region = regional_create();
+	sldns_buffer* pkt = sldns_buffer_new(65535);
+	struct query_info* qinfo;
+	struct reply_info** rep;
+	struct ub_packed_rrset_key** orig;
+	struct edns_data edns;
+	struct module_env env;
+	time_t now = 1000;
+	size_t copies = 0, bytes = 0, rrsets = 0, mallocs = 0, i;
+	double t = 0;
+	int n;
+	if(!cfg || !region || !pkt)
+		fatal_exit("out of memory");
+	cfg->msg_cache_size = 64*1024*1024;
+	cfg->rrset_cache_size = 128*1024*1024;
+	alloc_init(&alloc, NULL, 0);
+	memset(&env, 0, sizeof(env));
+	env.alloc = &alloc;
+	env.now = &now;
+	env.rrset_cache = rrset_cache_create(cfg, &alloc);
+	env.msg_cache = slabhash_create(cfg->msg_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size,
+		msgreply_sizefunc, query_info_compare, query_entry_delete,
+		reply_info_delete, &alloc);
+	qinfo = (struct query_info*)calloc((size_t)count+1, sizeof(*qinfo));
+	rep = (struct reply_info**)calloc((size_t)count+1, sizeof(*rep));
+	if(!env.rrset_cache || !env.msg_cache || !qinfo || !rep)
+		fatal_exit("out of memory");
+	/* reply 0 warms up the cache */
+	for(n=0; n<=count; n++) {
+		make(pkt, n);
+		sldns_buffer_flip(pkt);
+		/* like dns_alloc_msg, the reply is in the region */
+		if(!(msg = regional_alloc_zero(region, sizeof(*msg))))
+			fatal_exit("out of memory");
+		if(parse_packet(pkt, msg, region) != 0 ||
+			parse_extract_edns(msg, &edns, region) != 0 ||
+			!parse_create_msg(pkt, msg, NULL, &qinfo[n], &rep[n],
+			region))
+			fatal_exit("cannot parse %s reply", what);
+	}
+	orig = (struct ub_packed_rrset_key**)malloc(rep[0]->rrset_count *
+		sizeof(*orig));
+	if(!orig)
+		fatal_exit("out of memory");
+	for(n=0; n<=count; n++) {
+		struct reply_info* r = rep[n];
+		rrset_id_type id_before = alloc.next_id;
+		size_t m = 0, new_num = 0, new_bytes = 0, old_bytes = 0, c;
+		double s;
+		memmove(orig, r->rrsets, r->rrset_count*sizeof(*orig));
+#ifdef __GLIBC__
+		m = num_malloc;
+#endif
+		s = bench_now_usec();
+		if(!dns_cache_store(&env, &qinfo[n], r, referral, 0, 0, region,
+			0))
+			fatal_exit("cannot store %s reply", what);
+		s = bench_now_usec() - s;
+#ifdef __GLIBC__
+		m = num_malloc - m;
+#endif
+		c = (size_t)(alloc.next_id - id_before);
+		/* see which rrsets in the cache are new copies */
+		for(i=0; i<r->rrset_count; i++) {
+			struct ub_packed_rrset_key* k = orig[i];
+			size_t sz = k->rk.dname_len + packed_rrset_sizeof(
+				(struct packed_rrset_data*)k->entry.data);
+			if(cached_id(&env, k) >= id_before) {
+				new_num++;
+				new_bytes += sz;
+			} else	old_bytes += sz;
+		}
+		if(n == 0)
+			continue;
+		t += s;
+		copies += c;
+		bytes += new_bytes + (c > new_num ? old_bytes : 0);
+		rrsets += r->rrset_count;
+		mallocs += m;
+	}
+	t = t*1000./(double)count;
+	printf("%-10s %3d rrsets, copied %5.1f rrsets %6.0f bytes, "
+		"%5.1f mallocs, store %8.1f nsec\n", what,
+		(int)(rrsets/count), (double)copies/(double)count,
+		(double)bytes/(double)count, (double)mallocs/(double)count, t);
+	free(orig);
+	free(qinfo);
+	free(rep);
+	slabhash_delete(env.msg_cache);
+	rrset_cache_delete(env.rrset_cache);
+	alloc_clear(&alloc);
+	regional_destroy(region);
+	sldns_buffer_free(pkt);
+	config_delete(cfg);
+}
+
+/** main program for storebench */
+int main(int argc, char* argv[])
+{
+	int count = 10000;
+	log_init(NULL, 0, NULL);
+	if(argc > 2)
+		usage();
+	if(argc == 2 && (count = atoi(argv[1])) < 1)
+		usage();
+	printf("store of replies in the cache, %d replies each\n", count);
+	bench_store("cached", make_cached_zone, 0, count);
+	bench_store("referral", make_referral, 1, count);
+	bench_store("new zone", make_new_zone, 0, count);
+	return 0;
+}
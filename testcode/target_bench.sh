@@ -0,0 +1,34 @@
+#!/usr/bin/env bash
+# Benchmark of the cold cache lookup time through nameservers without glue.
+# Replays testdata/iter_target_bench.rpl with target-fetch-parallel no and
+# yes, and prints the reply latency (in fake time) that testbound logs.
+# Run from the build directory, after make testbound.
+# usage: testcode/target_bench.sh [number of runs] [rpl file]
+RUNS=${1:-20}
+RPL=${2:-testdata/iter_target_bench.rpl}
+TESTBOUND=./testbound
+if test ! -x $TESTBOUND; then
+	echo "$TESTBOUND not found, run make testbound first"
+	exit 1
+fi
+if test ! -f "$RPL"; then
+	echo "$RPL not found"
+	exit 1
+fi
+TMP=${TMPDIR:-/tmp}/target_bench.$$.rpl
+trap "rm -f $TMP" EXIT
+
+for mode in no yes; do
+	sed -e "s/target-fetch-parallel: .*/target-fetch-parallel: $mode/" \
+		< "$RPL" > $TMP
+	i=0
+	while test $i -lt $RUNS; do
+		if ! $TESTBOUND -p $TMP 2>&1 | grep "reply latency"; then
+			echo "testbound failed for target-fetch-parallel: $mode" >&2
+			exit 1
+		fi
+		i=`expr $i + 1`
+	done | sed -e 's/.*reply latency \([0-9.]*\) sec.*/\1/' | \
+	awk -v mode=$mode '{ s+=$1; if(n==0||$1<min)min=$1; if($1>max)max=$1; n++ }
+		END { if(n>0) printf("target-fetch-parallel: %s\truns %d\tavg %.3f\tmin %.3f\tmax %.3f sec\n", mode, n, s/n, min, max) }'
+done
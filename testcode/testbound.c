@@ -46,6 +46,7 @@
 #include "testcode/replay.h"
 #include "testcode/fake_event.h"
 #include "daemon/remote.h"
+#include "daemon/metrics.h"
 #include "util/config_file.h"
 #include "sldns/keyraw.h"
 #include <ctype.h>
@@ -413,6 +414,50 @@ int remote_control_callback(struct comm_point* ATTR_UNUSED(c),
 	return 0;
 }
 
+int metrics_accept_callback(struct comm_point* ATTR_UNUSED(c), 
+	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
+        struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	log_assert(0);
+	return 0;
+}
+
+int metrics_conn_callback(struct comm_point* ATTR_UNUSED(c), 
+	void* ATTR_UNUSED(arg), int ATTR_UNUSED(error),
+        struct comm_reply* ATTR_UNUSED(repinfo))
+{
+	log_assert(0);
+	return 0;
+}
+
+/* fake metrics endpoint */
+struct listen_port* daemon_metrics_open_ports(struct config_file*
+	ATTR_UNUSED(cfg))
+{
+	return NULL;
+}
+
+struct daemon_metrics* daemon_metrics_create(struct worker* ATTR_UNUSED(worker),
+	struct listen_port* ATTR_UNUSED(ports))
+{
+	return NULL;
+}
+
+void daemon_metrics_delete(struct daemon_metrics* ATTR_UNUSED(dm))
+{
+	/* nothing */
+}
+
+void daemon_metrics_start_accept(struct daemon_metrics* ATTR_UNUSED(dm))
+{
+	/* nothing */
+}
+
+void daemon_metrics_stop_accept(struct daemon_metrics* ATTR_UNUSED(dm))
+{
+	/* nothing */
+}
+
 void remote_get_opt_ssl(char* ATTR_UNUSED(str), void* ATTR_UNUSED(arg))
 {
         log_assert(0);
@@ -0,0 +1,123 @@
+/*
+ * testcode/timerbench.c - benchmark of the event timers.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program times setting and disabling many timers on a comm base,
+ * like for the outstanding queries to upstream servers, that mostly get
+ * an answer before their timeout. It compares the event timers with the
+ * coarse timers in the timing wheel.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include "util/netevent.h"
+#include "util/timewheel.h"
+
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	timerbench [number of timers] [rounds]\n");
+	printf("times set and disable of the timers, for every round.\n");
+	exit(1);
+}
+
+/** timer callback, the timers do not fire during the benchmark */
+static void
+bench_timer_cb(void* ATTR_UNUSED(arg))
+{
+}
+
+/** set timers with spread out timeouts, and disable them, count times */
+static void
+bench_timers(const char* what, int coarse, int num, int rounds)
+{
+	struct comm_base* base = comm_base_create(0);
+	struct comm_timer** t = (struct comm_timer**)calloc((size_t)num,
+		sizeof(*t));
+	struct timeval tv;
+	double start, tset = 0, tdis = 0;
+	int i, r;
+	if(!base || !t)
+		fatal_exit("out of memory");
+	for(i=0; i<num; i++) {
+		if(coarse)
+			t[i] = comm_timer_create_coarse(base, bench_timer_cb,
+				NULL);
+		else	t[i] = comm_timer_create(base, bench_timer_cb, NULL);
+		if(!t[i])
+			fatal_exit("out of memory");
+	}
+	for(r=0; r<rounds; r++) {
+		start = bench_now_usec();
+		for(i=0; i<num; i++) {
+			/* timeouts like those of upstream queries, 376 msec
+			 * and more */
+			tv.tv_sec = 1 + (i%7);
+			tv.tv_usec = 376000 + (i%1000)*97;
+			comm_timer_set(t[i], &tv);
+		}
+		tset += bench_now_usec() - start;
+		start = bench_now_usec();
+		for(i=0; i<num; i++)
+			comm_timer_disable(t[i]);
+		tdis += bench_now_usec() - start;
+	}
+	printf("%-8s %7d timers set %7.1f nsec disable %7.1f nsec\n", what,
+		num, tset*1000./((double)num*rounds),
+		tdis*1000./((double)num*rounds));
+	for(i=0; i<num; i++)
+		comm_timer_delete(t[i]);
+	free(t);
+	comm_base_delete(base);
+}
+
+/** main program for timerbench */
+int main(int argc, char* argv[])
+{
+	int num = 100000, rounds = 10;
+	log_init(NULL, 0, NULL);
+	if(argc > 3)
+		usage();
+	if(argc >= 2 && (num = atoi(argv[1])) < 1)
+		usage();
+	if(argc == 3 && (rounds = atoi(argv[2])) < 1)
+		usage();
+	printf("set and disable of timers, %d rounds\n", rounds);
+	bench_timers("event", 0, num, rounds);
+	bench_timers("coarse", 1, num, rounds);
+	return 0;
+}
@@ -42,8 +42,10 @@
 #include "util/log.h"
 #include "testcode/unitmain.h"
 #include "util/data/dname.h"
+#include "util/net_help.h"
 #include "sldns/sbuffer.h"
 #include "sldns/str2wire.h"
+#include <ctype.h>
 
 /** put dname into buffer */
 static sldns_buffer*
@@ -803,6 +805,184 @@ dname_test_pdtl(sldns_buffer* loopbuf, sldns_buffer* boundbuf)
 	pkt_dname_tolower(boundbuf, sldns_buffer_at(boundbuf, 12));
 }
 
+/** state of the name generator, fixed for reproducible tests */
+static unsigned int simd_rnd = 12345;
+
+/** next random number from the name generator (xorshift) */
+static unsigned int
+simd_random(unsigned int max)
+{
+	simd_rnd ^= simd_rnd << 13;
+	simd_rnd ^= simd_rnd >> 17;
+	simd_rnd ^= simd_rnd << 5;
+	return simd_rnd % max;
+}
+
+/** make random name in buf (size 256), with mixed case, returns length */
+static size_t
+simd_random_name(uint8_t* buf)
+{
+	static const char chars[] = "abcdefghijklmnopqrstuvwxyz"
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-_@[`{";
+	size_t len = 0;
+	int lablen, i;
+	int labs = (int)simd_random(8);
+	while(labs--) {
+		/* short labels mostly, sometimes up to the maximum */
+		if(simd_random(4) == 0)
+			lablen = 1+(int)simd_random(LDNS_MAX_LABELLEN);
+		else	lablen = 1+(int)simd_random(16);
+		if(len + lablen + 2 > LDNS_MAX_DOMAINLEN)
+			break;
+		buf[len++] = (uint8_t)lablen;
+		for(i=0; i<lablen; i++) {
+			if(simd_random(16) == 0)
+				buf[len++] = (uint8_t)(1+simd_random(255));
+			else	buf[len++] = (uint8_t)chars[simd_random(
+					sizeof(chars)-1)];
+		}
+	}
+	buf[len++] = 0;
+	return len;
+}
+
+/** make a second name from the first: other case, perhaps changed */
+static size_t
+simd_similar_name(uint8_t* buf, uint8_t* d, size_t len)
+{
+	size_t i;
+	int labs = dname_count_labels(d)-1;
+	memmove(buf, d, len);
+	/* flip case of letters, the label lengths are no letters */
+	for(i=0; i<len; i++) {
+		if(isalpha(buf[i]) && simd_random(2) == 0)
+			buf[i] ^= 0x20;
+	}
+	switch(simd_random(4)) {
+	case 0: /* change a byte in one of the labels */
+		if(labs > 0) {
+			int k = (int)simd_random((unsigned int)labs);
+			i = 0;
+			while(k--)
+				i += buf[i]+1;
+			buf[i+1+simd_random(buf[i])] =
+				(uint8_t)(1+simd_random(255));
+		}
+		break;
+	case 1: /* remove the last label */
+		if(labs > 0) {
+			i = 0;
+			while(buf[i+buf[i]+1] != 0)
+				i += buf[i]+1;
+			buf[i] = 0;
+			len = i+1;
+		}
+		break;
+	case 2: /* different name */
+		len = simd_random_name(buf);
+		break;
+	default: /* only case differs */
+		break;
+	}
+	return len;
+}
+
+/** reference lowercase compare, label by label */
+static int
+simd_ref_compare(uint8_t* d1, uint8_t* d2)
+{
+	uint8_t lab1 = *d1++, lab2 = *d2++;
+	while(lab1 != 0 || lab2 != 0) {
+		if(lab1 != lab2)
+			return (lab1 < lab2)?-1:1;
+		while(lab1--) {
+			if(tolower(*d1) != tolower(*d2))
+				return (tolower(*d1) < tolower(*d2))?-1:1;
+			d1++;
+			d2++;
+		}
+		lab1 = *d1++;
+		lab2 = *d2++;
+	}
+	return 0;
+}
+
+/** check the name functions at one vector level against the scalar
+ * results, for the pair of names */
+static void
+simd_check_pair(int level, uint8_t* d1, size_t len1, uint8_t* d2,
+	size_t len2, sldns_buffer* buff)
+{
+	uint8_t* l1, *l2, *p1, *p2;
+	uint8_t low[LDNS_MAX_DOMAINLEN+1];
+	int cmp, labcmp, canon, m, mref;
+	hashvalue_type h;
+	size_t i;
+
+	/* scalar results */
+	dname_simd_select(DNAME_SIMD_NONE);
+	cmp = query_dname_compare(d1, d2);
+	unit_assert(cmp == simd_ref_compare(d1, d2));
+	labcmp = dname_lab_cmp(d1, dname_count_labels(d1), d2,
+		dname_count_labels(d2), &mref);
+	canon = dname_canonical_compare(d1, d2);
+	h = dname_query_hash(d1, 0xab);
+	memmove(low, d1, len1);
+	for(i=0; i<len1; i+=d1[i]+1) {
+		size_t j;
+		for(j=1; j<=d1[i]; j++)
+			low[i+j] = (uint8_t)tolower(low[i+j]);
+	}
+
+	/* exact size copies, so that reads past the end are detected */
+	l1 = memdup(d1, len1);
+	l2 = memdup(d2, len2);
+	unit_assert(l1 && l2);
+	unit_assert(dname_simd_select(level) == level);
+	unit_assert(query_dname_compare(l1, l2) == cmp);
+	unit_assert(dname_lab_cmp(l1, dname_count_labels(l1), l2,
+		dname_count_labels(l2), &m) == labcmp);
+	unit_assert(m == mref);
+	unit_assert(dname_canonical_compare(l1, l2) == canon);
+	unit_assert(dname_query_hash(l1, 0xab) == h);
+	query_dname_tolower(l1);
+	unit_assert(memcmp(l1, low, len1) == 0);
+	unit_assert(query_dname_compare(l1, d1) == 0);
+
+	/* in a packet, the same results */
+	sldns_buffer_clear(buff);
+	sldns_buffer_write(buff, d1, len1);
+	sldns_buffer_write(buff, d2, len2);
+	sldns_buffer_flip(buff);
+	p1 = sldns_buffer_begin(buff);
+	p2 = sldns_buffer_at(buff, len1);
+	unit_assert(dname_pkt_compare(buff, p1, p2) == cmp);
+	unit_assert(dname_pkt_hash(buff, p1, 0xab) == h);
+	free(l1);
+	free(l2);
+}
+
+/** test the vector versions of the name functions give the same results */
+static void
+dname_test_simd(sldns_buffer* buff)
+{
+	uint8_t d1[LDNS_MAX_DOMAINLEN+1], d2[LDNS_MAX_DOMAINLEN+1];
+	size_t len1, len2;
+	int level, max, i;
+	unit_show_func("util/data/dname.c", "dname_simd_select");
+	max = dname_simd_select(-1);
+	unit_assert(dname_simd_select(DNAME_SIMD_NONE) == DNAME_SIMD_NONE);
+	for(i=0; i<2000; i++) {
+		len1 = simd_random_name(d1);
+		len2 = simd_similar_name(d2, d1, len1);
+		for(level = DNAME_SIMD_NONE; level <= max; level++) {
+			simd_check_pair(level, d1, len1, d2, len2, buff);
+			simd_check_pair(level, d2, len2, d1, len1, buff);
+		}
+	}
+	dname_simd_select(-1);
+}
+
 /** setup looped dname and out-of-bounds dname ptr */
 static void
 dname_setup_bufs(sldns_buffer* loopbuf, sldns_buffer* boundbuf)
@@ -855,6 +1035,7 @@ void dname_test(void)
 	dname_test_canoncmp();
 	dname_test_topdomain();
 	dname_test_valid();
+	dname_test_simd(buff);
 	sldns_buffer_free(buff);
 	sldns_buffer_free(loopbuf);
 	sldns_buffer_free(boundbuf);
@@ -108,6 +108,149 @@ alloc_test(void) {
 	alloc_clear(&major);
 }
 
+/** size class of a block of 100 bytes, 128 with the header */
+#define ALLOC_TEST_CLASS 7
+/** number of big blocks for the chunk test, 8 chunks full */
+#define ALLOC_BIG_TEST (8*ALLOC_CHUNK_SIZE/ALLOC_SIZED_MAX+8)
+/** test the size class allocator for cache memory */
+static void
+alloc_sized_test(void) {
+	struct alloc_cache major, minor1, minor2;
+	uint8_t* b[200], **big;
+	size_t i, s, prev = 0;
+
+	unit_show_feature("alloc_sized_obtain");
+	/* size classes fit, and grow with the size */
+	for(s=1; s<ALLOC_SIZED_MAX*2; s+=(s<1024?1:97)) {
+		size_t c = alloc_sized_size(s);
+		unit_assert(c >= s + ALLOC_SIZED_HDR);
+		unit_assert(c >= prev);
+		/* waste is at most a quarter, above the 16 byte steps */
+		if(s > 128)
+			unit_assert(c - s - ALLOC_SIZED_HDR <= (s+ALLOC_SIZED_HDR)/4);
+		prev = c;
+	}
+#if !defined(UNBOUND_ALLOC_LITE) && !defined(UNBOUND_ALLOC_STATS)
+	unit_assert(alloc_sized_size(1) == 32);
+	unit_assert(alloc_sized_size(112) == 128);
+	unit_assert(alloc_sized_size(113) == 160);
+	unit_assert(alloc_sized_size(ALLOC_SIZED_MAX-ALLOC_SIZED_HDR) ==
+		ALLOC_SIZED_MAX);
+	unit_assert(alloc_sized_size(ALLOC_SIZED_MAX) ==
+		ALLOC_SIZED_MAX+ALLOC_SIZED_HDR);
+#endif
+
+	alloc_init(&major, NULL, 0);
+	alloc_init(&minor1, &major, 0);
+	alloc_init(&minor2, &major, 1);
+
+	/* blocks keep their contents, and do not overlap */
+	for(i=0; i<200; i++) {
+		s = (i<100)?10+i*3:100;
+		b[i] = (uint8_t*)alloc_sized_obtain(&minor1, s);
+		unit_assert(b[i]);
+		unit_assert(((size_t)b[i] & 0x7) == 0);
+		memset(b[i], (int)i, s);
+	}
+	for(i=0; i<200; i++) {
+		size_t j;
+		s = (i<100)?10+i*3:100;
+		for(j=0; j<s; j++)
+			unit_assert(b[i][j] == (uint8_t)i);
+	}
+#if !defined(UNBOUND_ALLOC_LITE) && !defined(UNBOUND_ALLOC_STATS)
+	unit_assert(alloc_sized_total(&major) == ALLOC_CHUNK_SIZE);
+#endif
+	/* released by another thread; the overflow goes to the super */
+	for(i=0; i<200; i++)
+		alloc_sized_release(&minor2, b[i]);
+#if !defined(UNBOUND_ALLOC_LITE) && !defined(UNBOUND_ALLOC_STATS)
+	for(i=0, s=0; i<ALLOC_SIZED_CLASSES; i++) {
+		unit_assert(minor2.num_sized_free[i] <= 64);
+		s += major.num_sized_free[i];
+	}
+	unit_assert(s > 0);
+	/* reused, not carved again */
+	b[0] = (uint8_t*)alloc_sized_obtain(&minor1, 100);
+	b[1] = (uint8_t*)alloc_sized_obtain(&minor2, 100);
+	unit_assert(b[0] && b[1] && b[0] != b[1]);
+	unit_assert(alloc_sized_total(&major) == ALLOC_CHUNK_SIZE);
+	alloc_sized_release(&minor1, b[0]);
+	alloc_sized_release(&minor1, b[1]);
+
+	/* releases to the super go to the free lists of the thread */
+	alloc_set_thread(&minor2);
+	b[0] = (uint8_t*)alloc_sized_obtain(&minor1, 100);
+	unit_assert(b[0]);
+	s = minor2.num_sized_free[ALLOC_TEST_CLASS];
+	prev = major.num_sized_free[ALLOC_TEST_CLASS];
+	alloc_sized_release(&major, b[0]);
+	unit_assert(minor2.num_sized_free[ALLOC_TEST_CLASS] == s+1);
+	unit_assert(major.num_sized_free[ALLOC_TEST_CLASS] == prev);
+
+	/* chunks that are entirely free are returned to the system */
+	big = (uint8_t**)calloc(ALLOC_BIG_TEST, sizeof(*big));
+	unit_assert(big);
+	for(i=0; i<ALLOC_BIG_TEST; i++) {
+		big[i] = (uint8_t*)alloc_sized_obtain(&minor1,
+			ALLOC_SIZED_MAX-ALLOC_SIZED_HDR);
+		unit_assert(big[i]);
+	}
+	s = alloc_sized_total(&major);
+	unit_assert(s >= 8*ALLOC_CHUNK_SIZE);
+	for(i=0; i<ALLOC_BIG_TEST; i++)
+		alloc_sized_release(&minor1, big[i]);
+	unit_assert(alloc_sized_total(&major) <= s - 4*ALLOC_CHUNK_SIZE);
+	/* and chunks are carved again */
+	for(i=0; i<ALLOC_BIG_TEST; i++) {
+		big[i] = (uint8_t*)alloc_sized_obtain(&minor1,
+			ALLOC_SIZED_MAX-ALLOC_SIZED_HDR);
+		unit_assert(big[i]);
+		memset(big[i], 0x33, ALLOC_SIZED_MAX-ALLOC_SIZED_HDR);
+	}
+	for(i=0; i<ALLOC_BIG_TEST; i++)
+		alloc_sized_release(&minor2, big[i]);
+	free(big);
+#endif
+
+	/* big blocks are malloced, and counted */
+	b[0] = (uint8_t*)alloc_sized_obtain(&minor1, ALLOC_SIZED_MAX*3);
+	unit_assert(b[0]);
+	memset(b[0], 0x55, ALLOC_SIZED_MAX*3);
+	s = alloc_sized_total(&major);
+	alloc_sized_release(&minor2, b[0]);
+	unit_assert(alloc_sized_total(&major) == s -
+		(ALLOC_SIZED_MAX*3+ALLOC_SIZED_HDR));
+	/* blocks without an alloc are malloced */
+	b[0] = (uint8_t*)alloc_sized_obtain(NULL, 50);
+	unit_assert(b[0]);
+	alloc_sized_release(NULL, b[0]);
+	/* the super can be used directly, with its lock held */
+	lock_quick_lock(&major.lock);
+	b[0] = (uint8_t*)alloc_sized_obtain(&major, 5000);
+	lock_quick_unlock(&major.lock);
+	unit_assert(b[0]);
+	alloc_sized_release(&minor1, b[0]);
+
+	unit_assert(alloc_get_mem(&minor1) >= sizeof(minor1));
+	b[0] = (uint8_t*)alloc_sized_obtain(&minor1, 100);
+	unit_assert(b[0]);
+	alloc_clear(&minor1);
+	alloc_clear(&minor2);
+	for(i=0; i<ALLOC_SIZED_CLASSES; i++)
+		unit_assert(minor1.num_sized_free[i] == 0 &&
+			minor2.num_sized_free[i] == 0);
+	/* the thread alloc is unset when it is cleared */
+	prev = major.num_sized_free[ALLOC_TEST_CLASS];
+	alloc_sized_release(&major, b[0]);
+#if !defined(UNBOUND_ALLOC_LITE) && !defined(UNBOUND_ALLOC_STATS)
+	unit_assert(major.num_sized_free[ALLOC_TEST_CLASS] == prev+1);
+#endif
+	unit_assert(minor2.num_sized_free[ALLOC_TEST_CLASS] == 0);
+	alloc_clear(&major);
+	unit_assert(major.sized_total == 0 && major.chunks == NULL);
+}
+
 #include "util/net_help.h"
 /** test net code */
 static void 
@@ -428,17 +571,58 @@ rtt_test(void)
 	}
 }
 
+/** test RTT histogram code */
+static void
+rtt_hist_test(void)
+{
+	struct rtt_hist h;
+	int i, p50, p90;
+	unit_show_func("util/rtt.c", "rtt_hist_percentile");
+	rtt_hist_init(&h);
+	unit_assert( rtt_hist_percentile(&h, 50) == -1 );
+	for(i=0; i<RTT_HIST_MIN_SAMPLES-1; i++)
+		rtt_hist_add(&h, 20);
+	/* too few samples */
+	unit_assert( rtt_hist_percentile(&h, 50) == -1 );
+	rtt_hist_add(&h, 20);
+	p50 = rtt_hist_percentile(&h, 50);
+	unit_assert( p50 >= 16 && p50 <= 32 );
+	unit_assert( rtt_hist_percentile(&h, 0) == -1 );
+	unit_assert( rtt_hist_percentile(&h, 100) == -1 );
+
+	/* 80 fast, 20 slow answers */
+	rtt_hist_init(&h);
+	for(i=0; i<80; i++)
+		rtt_hist_add(&h, 10);
+	for(i=0; i<20; i++)
+		rtt_hist_add(&h, 300);
+	p50 = rtt_hist_percentile(&h, 50);
+	p90 = rtt_hist_percentile(&h, 90);
+	unit_assert( p50 >= 8 && p50 <= 16 );
+	unit_assert( p90 >= 256 && p90 <= 512 );
+	unit_assert( rtt_hist_percentile(&h, 80) <= 16 );
+
+	/* old samples decay, the percentile follows the new behaviour */
+	for(i=0; i<RTT_HIST_DECAY*4; i++)
+		rtt_hist_add(&h, 1000);
+	unit_assert( h.total <= RTT_HIST_DECAY );
+	p50 = rtt_hist_percentile(&h, 50);
+	unit_assert( p50 >= 512 && p50 <= 1024 );
+	/* huge values go into the last bucket */
+	rtt_hist_add(&h, RTT_MAX_TIMEOUT*10);
+	unit_assert( h.count[RTT_HIST_BUCKETS-1] == 1 );
+}
+
 #include "services/cache/infra.h"
 #include "util/config_file.h"
 
 /* lookup and get key and data structs easily */
 static struct infra_data* infra_lookup_host(struct infra_cache* infra,
-	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* zone,
-	size_t zonelen, int wr, time_t now, struct infra_key** k)
+	struct sockaddr_storage* addr, socklen_t addrlen, int wr,
+	time_t now, struct infra_key** k)
 {
 	struct infra_data* d;
-	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen,
-		zone, zonelen, wr);
+	struct lruhash_entry* e = infra_lookup_nottl(infra, addr, addrlen, wr);
 	if(!e) return NULL;
 	d = (struct infra_data*)e->data;
 	if(d->ttl < now) {
@@ -449,6 +633,24 @@ static struct infra_data* infra_lookup_host(struct infra_cache* infra,
 	return d;
 }
 
+/* lookup and get the lameness key and data structs easily */
+static struct infra_lame_data* infra_lookup_zone(struct infra_cache* infra,
+	struct sockaddr_storage* addr, socklen_t addrlen, uint8_t* zone,
+	size_t zonelen, int wr, time_t now, struct infra_lame_key** k)
+{
+	struct infra_lame_data* d;
+	struct lruhash_entry* e = infra_lookup_lame(infra, addr, addrlen,
+		zone, zonelen, wr);
+	if(!e) return NULL;
+	d = (struct infra_lame_data*)e->data;
+	if(d->ttl < now) {
+		lock_rw_unlock(&e->lock);
+		return NULL;
+	}
+	*k = (struct infra_lame_key*)e->key;
+	return d;
+}
+
 /** test host cache */
 static void
 infra_test(void)
@@ -457,71 +659,98 @@ infra_test(void)
 	socklen_t onelen;
 	uint8_t* zone = (uint8_t*)"\007example\003com\000";
 	size_t zonelen = 13;
+	uint8_t* zone2 = (uint8_t*)"\007example\003net\000";
+	size_t zone2len = 13;
 	struct infra_cache* slab;
 	struct config_file* cfg = config_create();
 	time_t now = 0;
 	uint8_t edns_lame;
-	int vs, to;
+	int vs, to, lame, dlame, rlame, rtt;
 	struct infra_key* k;
 	struct infra_data* d;
+	struct infra_lame_key* lk;
+	struct infra_lame_data* ld;
 	int init = 376;
 
 	unit_show_feature("infra cache");
 	unit_assert(ipstrtoaddr("127.0.0.1", 53, &one, &onelen));
 
 	slab = infra_create(cfg);
-	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, now,
+	unit_assert( infra_host(slab, &one, onelen, now,
 		&vs, &edns_lame, &to) );
 	unit_assert( vs == 0 && to == init && edns_lame == 0 );
 
-	unit_assert( infra_rtt_update(slab, &one, onelen, zone, zonelen, LDNS_RR_TYPE_A, -1, init, now) );
-	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, 
+	unit_assert( infra_rtt_update(slab, &one, onelen, LDNS_RR_TYPE_A, -1, init, now) );
+	unit_assert( infra_host(slab, &one, onelen, 
 			now, &vs, &edns_lame, &to) );
 	unit_assert( vs == 0 && to == init*2 && edns_lame == 0 );
 
-	unit_assert( infra_edns_update(slab, &one, onelen, zone, zonelen, -1, now) );
-	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, 
+	unit_assert( infra_edns_update(slab, &one, onelen, -1, now) );
+	unit_assert( infra_host(slab, &one, onelen, 
 			now, &vs, &edns_lame, &to) );
 	unit_assert( vs == -1 && to == init*2  && edns_lame == 1);
 
+	/* the rtt is the same for every zone of the server */
+	unit_assert( infra_get_lame_rtt(slab, &one, onelen, zone2, zone2len,
+		LDNS_RR_TYPE_A, &lame, &dlame, &rlame, &rtt, now) );
+	unit_assert( !lame && !dlame && !rlame && rtt == init*2 );
+
 	now += cfg->host_ttl + 10;
-	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, 
+	unit_assert( infra_host(slab, &one, onelen, 
 			now, &vs, &edns_lame, &to) );
 	unit_assert( vs == 0 && to == init && edns_lame == 0 );
 	
 	unit_assert( infra_set_lame(slab, &one, onelen,
 		zone, zonelen,  now, 0, 0, LDNS_RR_TYPE_A) );
-	unit_assert( (d=infra_lookup_host(slab, &one, onelen, zone, zonelen, 0, now, &k)) );
+	unit_assert( (d=infra_lookup_host(slab, &one, onelen, 0, now, &k)) );
 	unit_assert( d->ttl == now+cfg->host_ttl );
 	unit_assert( d->edns_version == 0 );
-	unit_assert(!d->isdnsseclame && !d->rec_lame && d->lame_type_A &&
-		!d->lame_other);
 	lock_rw_unlock(&k->entry.lock);
+	unit_assert( (ld=infra_lookup_zone(slab, &one, onelen, zone, zonelen,
+		0, now, &lk)) );
+	unit_assert( ld->ttl == now+cfg->host_ttl );
+	unit_assert(!ld->isdnsseclame && !ld->rec_lame && ld->lame_type_A &&
+		!ld->lame_other);
+	lock_rw_unlock(&lk->entry.lock);
+	/* the lameness is only for that zone */
+	unit_assert( !infra_lookup_zone(slab, &one, onelen, zone2, zone2len,
+		0, now, &lk) );
+	unit_assert( infra_get_lame_rtt(slab, &one, onelen, zone, zonelen,
+		LDNS_RR_TYPE_A, &lame, &dlame, &rlame, &rtt, now) );
+	unit_assert( lame && !dlame && !rlame );
+	unit_assert( infra_get_lame_rtt(slab, &one, onelen, zone2, zone2len,
+		LDNS_RR_TYPE_A, &lame, &dlame, &rlame, &rtt, now) );
+	unit_assert( !lame && !dlame && !rlame );
 
 	/* test merge of data */
 	unit_assert( infra_set_lame(slab, &one, onelen,
 		zone, zonelen,  now, 0, 0, LDNS_RR_TYPE_AAAA) );
-	unit_assert( (d=infra_lookup_host(slab, &one, onelen, zone, zonelen, 0, now, &k)) );
-	unit_assert(!d->isdnsseclame && !d->rec_lame && d->lame_type_A &&
-		d->lame_other);
-	lock_rw_unlock(&k->entry.lock);
+	unit_assert( (ld=infra_lookup_zone(slab, &one, onelen, zone, zonelen,
+		0, now, &lk)) );
+	unit_assert(!ld->isdnsseclame && !ld->rec_lame && ld->lame_type_A &&
+		ld->lame_other);
+	lock_rw_unlock(&lk->entry.lock);
 
 	/* test that noEDNS cannot overwrite known-yesEDNS */
 	now += cfg->host_ttl + 10;
-	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, 
+	unit_assert( infra_host(slab, &one, onelen, 
 			now, &vs, &edns_lame, &to) );
 	unit_assert( vs == 0 && to == init && edns_lame == 0 );
 
-	unit_assert( infra_edns_update(slab, &one, onelen, zone, zonelen, 0, now) );
-	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, 
+	unit_assert( infra_edns_update(slab, &one, onelen, 0, now) );
+	unit_assert( infra_host(slab, &one, onelen, 
 			now, &vs, &edns_lame, &to) );
 	unit_assert( vs == 0 && to == init && edns_lame == 1 );
 
-	unit_assert( infra_edns_update(slab, &one, onelen, zone, zonelen, -1, now) );
-	unit_assert( infra_host(slab, &one, onelen, zone, zonelen, 
+	unit_assert( infra_edns_update(slab, &one, onelen, -1, now) );
+	unit_assert( infra_host(slab, &one, onelen, 
 			now, &vs, &edns_lame, &to) );
 	unit_assert( vs == 0 && to == init && edns_lame == 1 );
 
+	/* the lameness has expired too */
+	unit_assert( !infra_lookup_zone(slab, &one, onelen, zone, zonelen,
+		0, now, &lk) );
+
 	infra_delete(slab);
 	config_delete(cfg);
 }
@@ -558,11 +787,698 @@ rnd_test(void)
 	ub_randfree(r);
 }
 
+#include "util/storage/keyhash.h"
+/** test the keyed hash */
+static void
+keyhash_test(void)
+{
+	/* reference vectors, key 00..0f and message 00..len-1 */
+	static const struct {
+		size_t len;
+		uint64_t h24, h13;
+	} vec[] = {
+		{ 0, (uint64_t)0x726fdb47dd0e0e31ULL,
+			(uint64_t)0xabac0158050fc4dcULL },
+		{ 1, (uint64_t)0x74f839c593dc67fdULL,
+			(uint64_t)0xc9f49bf37d57ca93ULL },
+		{ 7, (uint64_t)0xab0200f58b01d137ULL, 0 },
+		{ 8, (uint64_t)0x93f5f5799a932462ULL,
+			(uint64_t)0x369095118d299a8eULL },
+		{ 15, (uint64_t)0xa129ca6149be45e5ULL,
+			(uint64_t)0xd320d86d2a519956ULL },
+		{ 63, (uint64_t)0x958a324ceb064572ULL,
+			(uint64_t)0x9d199062b7bbb3a8ULL }
+	};
+	uint8_t key[KEYHASH_KEYSIZE], other[KEYHASH_KEYSIZE];
+	uint8_t data[256];
+	struct keyhash_state s;
+	uint64_t h;
+	uint32_t h1, h2;
+	size_t i, j, len, part;
+	unit_show_feature("keyhash");
+	for(i=0; i<sizeof(key); i++) {
+		key[i] = (uint8_t)i;
+		other[i] = (uint8_t)(0xa5 ^ i);
+	}
+	for(i=0; i<sizeof(data); i++)
+		data[i] = (uint8_t)i;
+	for(i=0; i<sizeof(vec)/sizeof(vec[0]); i++) {
+		unit_assert(siphash(key, data, vec[i].len, 2, 4) ==
+			vec[i].h24);
+		if(vec[i].h13)
+			unit_assert(siphash(key, data, vec[i].len,
+				KEYHASH_CROUNDS, KEYHASH_DROUNDS) == vec[i].h13);
+	}
+
+	/* the incremental hash is the same for every split of the data */
+	keyhash_set_key(key);
+	for(len=0; len<sizeof(data); len+=7) {
+		h = siphash(key, data, len, KEYHASH_CROUNDS,
+			KEYHASH_DROUNDS);
+		h1 = (uint32_t)(h ^ (h >> 32));
+		for(part=1; part<=17; part++) {
+			keyhash_init(&s);
+			for(j=0; j<len; j+=part)
+				keyhash_update(&s, data+j,
+					(j+part<=len)?part:len-j);
+			unit_assert(keyhash_final(&s) == h1);
+		}
+		/* the chained version hashes the initial value first */
+		keyhash_init(&s);
+		h2 = 0x1234;
+		keyhash_update(&s, &h2, sizeof(h2));
+		keyhash_update(&s, data, len);
+		unit_assert(keyhash(data, len, 0x1234) == keyhash_final(&s));
+	}
+
+	/* a different key gives different results */
+	h1 = keyhash(data, 20, 0);
+	keyhash_set_key(other);
+	h2 = keyhash(data, 20, 0);
+	unit_assert(h1 != h2);
+	/* put back the default key */
+	keyhash_set_key(key);
+	unit_assert(keyhash(data, 20, 0) == h1);
+}
+
+#include "util/timewheel.h"
+/** count the entries in a list and check their expiry */
+static int
+timewheel_list_check(struct timewheel_entry* list, uint64_t now)
+{
+	struct timewheel_entry* e;
+	int n = 0;
+	for(e = list->next; e != list; e = e->next) {
+		/* not early, and at most a tick late, plus the time between
+		 * the checks, that is less than a tick */
+		unit_assert(*(uint64_t*)e->data <= now);
+		unit_assert(*(uint64_t*)e->data + 2*TIMEWHEEL_TICK > now);
+		n++;
+	}
+	return n;
+}
+
+/** test the timing wheel */
+static void
+timewheel_test(void)
+{
+	struct timewheel* w;
+	struct timewheel_entry e[200], list;
+	uint64_t when[200], now = 1000, next;
+	int i, n = 0;
+	unit_show_feature("timewheel");
+	w = timewheel_create(now);
+	unit_assert(w);
+	unit_assert(!timewheel_next(w, &next));
+	/* timeouts from 0 to several rotations away */
+	for(i=0; i<200; i++) {
+		when[i] = now + (uint64_t)i*i*(uint64_t)i/97 + (uint64_t)i;
+		e[i].data = &when[i];
+		timewheel_add(w, &e[i], when[i]);
+	}
+	unit_assert(when[199] - now > TIMEWHEEL_SLOTS*TIMEWHEEL_TICK*5);
+	/* removed entries do not expire */
+	timewheel_remove(&e[50]);
+	timewheel_remove(&e[50]);
+	timewheel_remove(&e[150]);
+	unit_assert(timewheel_next(w, &next));
+	unit_assert(next >= now && next <= now + TIMEWHEEL_TICK);
+	timewheel_list_init(&list);
+	while(now < when[199] + TIMEWHEEL_TICK) {
+		now += 5;
+		timewheel_expire(w, now, &list);
+		n += timewheel_list_check(&list, now);
+		timewheel_list_init(&list);
+		if(timewheel_next(w, &next))
+			unit_assert(next > now);
+	}
+	unit_assert(n == 198);
+	unit_assert(!timewheel_next(w, &next));
+
+	/* a large time jump expires everything, also later rotations */
+	timewheel_add(w, &e[0], now + 100);
+	timewheel_add(w, &e[1], now + 100000);
+	now += 200000;
+	timewheel_expire(w, now, &list);
+	unit_assert(list.next == &e[0] && e[0].next == &e[1]);
+	unit_assert(e[1].next == &list);
+	timewheel_list_init(&list);
+
+	/* if the clock goes back, entries are not lost, and keep the
+	 * timeout that they had left, also the ones rotations away */
+	timewheel_add(w, &e[2], now + 100);
+	timewheel_add(w, &e[3], now + 100000);
+	now -= 5000;
+	timewheel_expire(w, now, &list);
+	unit_assert(list.next == &list);
+	timewheel_expire(w, now + 90, &list);
+	unit_assert(list.next == &list);
+	timewheel_expire(w, now + 100 + TIMEWHEEL_TICK, &list);
+	unit_assert(list.next == &e[2] && e[2].next == &list);
+	timewheel_list_init(&list);
+	timewheel_expire(w, now + 99000, &list);
+	unit_assert(list.next == &list);
+	unit_assert(timewheel_next(w, &next));
+	timewheel_expire(w, now + 100000 + TIMEWHEEL_TICK, &list);
+	unit_assert(list.next == &e[3] && e[3].next == &list);
+	unit_assert(!timewheel_next(w, &next));
+	timewheel_delete(w);
+}
+
+#include "util/storage/hashindex.h"
+#include "services/outside_network.h"
+/** test the hash index, with pending replies as the elements */
+static void
+hashindex_test(void)
+{
+	struct hashindex* h;
+	struct pending* p, dup, key;
+	struct hashindex_node* n;
+	int i, num = 0;
+	unit_show_feature("hashindex");
+	h = hashindex_create(pending_cmp);
+	p = (struct pending*)calloc(1000, sizeof(*p));
+	unit_assert(h && p);
+	unit_assert(hashindex_first(h) == NULL);
+	for(i=0; i<1000; i++) {
+		p[i].id = (unsigned)i;
+		unit_assert(ipstrtoaddr("192.0.2.1", 53, &p[i].addr,
+			&p[i].addrlen));
+		p[i].node.key = &p[i];
+		p[i].node.hash = pending_hash(&p[i]);
+		unit_assert(hashindex_insert(h, &p[i].node) == &p[i].node);
+	}
+	unit_assert(h->count == 1000 && h->size >= 1000);
+	/* an equal key is not inserted */
+	dup = p[5];
+	unit_assert(hashindex_insert(h, &dup.node) == NULL);
+	unit_assert(hashindex_remove(h, &dup.node) == NULL);
+	/* find them, also with a different address */
+	key = p[0];
+	for(i=0; i<1000; i++) {
+		key.id = (unsigned)i;
+		unit_assert(hashindex_search(h, &key, pending_hash(&key)) ==
+			&p[i].node);
+	}
+	key.id = 1000;
+	unit_assert(!hashindex_search(h, &key, pending_hash(&key)));
+	unit_assert(ipstrtoaddr("192.0.2.2", 53, &key.addr, &key.addrlen));
+	key.id = 10;
+	unit_assert(!hashindex_search(h, &key, pending_hash(&key)));
+	/* every node is visited once */
+	HASHINDEX_FOR(n, struct hashindex_node*, h) {
+		unit_assert(((struct pending*)n)->id < 1000);
+		num++;
+	}
+	unit_assert(num == 1000);
+	/* remove most of them, the index shrinks */
+	for(i=0; i<1000; i++) {
+		if(i%10 == 0)
+			continue;
+		unit_assert(hashindex_remove(h, &p[i].node) == &p[i].node);
+		unit_assert(hashindex_remove(h, &p[i].node) == NULL);
+	}
+	unit_assert(h->count == 100 && h->size < 1000);
+	for(i=0; i<1000; i++)
+		unit_assert(hashindex_search(h, &p[i], p[i].node.hash) ==
+			(i%10 == 0?&p[i].node:NULL));
+	/* nodes with the same hash value are told apart by the compare */
+	p[1].node.hash = p[2].node.hash = p[0].node.hash;
+	unit_assert(hashindex_insert(h, &p[1].node) == &p[1].node);
+	unit_assert(hashindex_insert(h, &p[2].node) == &p[2].node);
+	unit_assert(hashindex_search(h, &p[1], p[0].node.hash) == &p[1].node);
+	unit_assert(hashindex_search(h, &p[2], p[0].node.hash) == &p[2].node);
+	unit_assert(hashindex_remove(h, &p[1].node) == &p[1].node);
+	unit_assert(hashindex_search(h, &p[0], p[0].node.hash) == &p[0].node);
+	unit_assert(hashindex_search(h, &p[2], p[0].node.hash) == &p[2].node);
+	hashindex_clear(h);
+	unit_assert(h->count == 0 && hashindex_first(h) == NULL);
+	hashindex_delete(h);
+	free(p);
+}
+
+#include "util/netevent.h"
+#include "util/config_file.h"
+#include "util/random.h"
+#include "sldns/sbuffer.h"
+/** send a query to the server of sq from the UDP pool */
+static struct pending*
+udp_pool_send(struct serviced_query* sq, sldns_buffer* pkt)
+{
+	struct pending* p;
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u32(pkt, 0);
+	sldns_buffer_write_u32(pkt, 0);
+	sldns_buffer_write_u32(pkt, 0);
+	sldns_buffer_flip(pkt);
+	p = pending_udp_query(sq, pkt, 10000, NULL, NULL);
+	unit_assert(p && p->pc);
+	return p;
+}
+
+/** test the UDP pool: sockets are acquired at the start, kept open when
+ * a query is released, and retired to a new port after a number of uses */
+static void
+udp_pool_test(void)
+{
+	struct comm_base* base;
+	struct ub_randstate* rnd;
+	struct config_file* cfg;
+	struct outside_network* outnet;
+	struct serviced_query sq;
+	struct pending* p[8];
+	struct port_if* pif;
+	struct port_comm* pc;
+	sldns_buffer* pkt;
+	char* ifs[] = {"127.0.0.1"};
+	int* ports = NULL;
+	int numports, i, j;
+	unit_show_feature("udp pool");
+	base = comm_base_create(0);
+	rnd = ub_initstate(1, NULL);
+	cfg = config_create();
+	pkt = sldns_buffer_new(512);
+	unit_assert(base && rnd && cfg && pkt);
+	numports = cfg_condense_ports(cfg, &ports);
+	unit_assert(numports > 0);
+	/* a pool of 2 sockets, that move to a new port after 3 queries */
+	outnet = outside_network_create(base, 512, 16, ifs, 1, 1, 0, 0, NULL,
+		rnd, 0, ports, numports, 0, 0, NULL, NULL, 1, NULL, 0, 2, 0, 3,
+		NULL);
+	unit_assert(outnet);
+	pif = &outnet->ip4_ifs[0];
+
+	/* acquire: the pool sockets are open before the first query */
+	unit_assert(pif->pool == 2 && pif->inuse == 2 && pif->draining == 0);
+	unit_assert(outnet->num_udppool_opened == 2);
+	memset(&sq, 0, sizeof(sq));
+	sq.outnet = outnet;
+	unit_assert(ipstrtoaddr("127.0.0.1", 53, &sq.addr, &sq.addrlen));
+	p[0] = udp_pool_send(&sq, pkt);
+	pc = p[0]->pc;
+	unit_assert(pc->index < 2 && pc->num_outstanding == 1 &&
+		pc->uses == 1);
+	unit_assert(pif->inuse == 2 && outnet->num_udppool_opened == 2);
+
+	/* release: the socket stays open in the pool */
+	pending_udp_timer_cb(p[0]);
+	unit_assert(pc->num_outstanding == 0 && pc->index < 2);
+	unit_assert(pif->inuse == 2 && pif->draining == 0);
+
+	/* retire: a socket that is used 3 times moves to a new port, the
+	 * old port drains while its queries are outstanding */
+	for(i=0; i<8; i++) {
+		p[i] = udp_pool_send(&sq, pkt);
+		if(outnet->num_udppool_rotated != 0)
+			break;
+	}
+	unit_assert(i < 8);
+	pc = p[i]->pc;
+	unit_assert(pc->uses == 3 && pc->num_outstanding > 0);
+	unit_assert(pif->draining == 1 && pif->inuse == 3);
+	unit_assert(pc->index == 2 && pif->out[2] == pc);
+	unit_assert(outnet->num_udppool_opened == 3);
+	unit_assert(pif->out[0]->number != pc->number &&
+		pif->out[1]->number != pc->number);
+	/* the retired socket gets no new queries */
+	p[i+1] = udp_pool_send(&sq, pkt);
+	unit_assert(p[i+1]->pc != pc);
+	for(j=0; j<=i+1; j++)
+		pending_udp_timer_cb(p[j]);
+	unit_assert(pif->draining == 0 && pif->inuse == 2);
+	unit_assert(pif->out[0]->num_outstanding == 0 &&
+		pif->out[1]->num_outstanding == 0);
+
+	/* with one use, every query is sent from a new port */
+	outnet->udp_pool_uses = 1;
+	p[0] = udp_pool_send(&sq, pkt);
+	p[1] = udp_pool_send(&sq, pkt);
+	unit_assert(p[0]->pc != p[1]->pc &&
+		p[0]->pc->number != p[1]->pc->number);
+	unit_assert(pif->draining == 2 && pif->inuse == 4);
+	pending_udp_timer_cb(p[0]);
+	pending_udp_timer_cb(p[1]);
+	unit_assert(pif->draining == 0 && pif->inuse == 2);
+
+	outside_network_delete(outnet);
+	comm_base_delete(base);
+	config_delete(cfg);
+	ub_randfree(rnd);
+	sldns_buffer_free(pkt);
+	free(ports);
+}
+
+#include "util/querylog.h"
+#include "util/config_file.h"
+#include "util/data/msgreply.h"
+#include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
+/** number of records that the query log test puts in the ring */
+#define QLOG_TEST_NUM 100000
+
+/** make a query for the query log test */
+static void
+qlog_test_query(struct query_info* qinfo, struct sockaddr_storage* addr,
+	socklen_t* addrlen, const char* ip)
+{
+	memset(qinfo, 0, sizeof(*qinfo));
+	qinfo->qname = (uint8_t*)"\003www\007example\003com";
+	qinfo->qname_len = 17;
+	qinfo->qtype = LDNS_RR_TYPE_AAAA;
+	qinfo->qclass = LDNS_RR_CLASS_IN;
+	unit_assert(ipstrtoaddr(ip, 53, addr, addrlen));
+}
+
+/** the worker side of the query log test, it puts queries in the ring,
+ * with a sequence number in the time */
+static void*
+qlog_test_thr(void* arg)
+{
+	struct qlog_ring* r = (struct qlog_ring*)arg;
+	struct query_info qinfo;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct timeval tv;
+	int i;
+	qlog_test_query(&qinfo, &addr, &addrlen, "192.0.2.1");
+	for(i=0; i<QLOG_TEST_NUM; i++) {
+		tv.tv_sec = i;
+		tv.tv_usec = 0;
+		qlog_query(r, &tv, &addr, addrlen, &qinfo);
+	}
+	return NULL;
+}
+
+/** the state of the reader in the query log test */
+struct qlog_test_read {
+	/** number of records read */
+	size_t n;
+	/** sequence number of the last record */
+	long last;
+};
+
+/** check a record that is taken out of the ring */
+static void
+qlog_test_func(uint8_t* buf, size_t len, void* arg)
+{
+	struct qlog_test_read* rd = (struct qlog_test_read*)arg;
+	struct qlog_record rec;
+	unit_assert(qlog_record_unpack(buf, len, &rec) == len);
+	unit_assert(rec.kind == qlog_kind_query && rec.family == 4);
+	unit_assert(rec.qname_len == 17 && rec.qtype == LDNS_RR_TYPE_AAAA);
+	unit_assert(memcmp(rec.qname, "\003www\007example\003com", 17) == 0);
+	/* in order, and none twice */
+	unit_assert((long)rec.sec > rd->last);
+	rd->last = (long)rec.sec;
+	rd->n++;
+}
+
+/** test the asynchronous query log */
+static void
+querylog_test(void)
+{
+	struct config_file* cfg = config_create();
+	struct query_info qinfo;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct qlog_record rec, rec2;
+	struct qlog_test_read rd;
+	struct qlog* q;
+	struct timeval tv = {1500000000, 123456}, dur = {1, 500};
+	uint8_t buf[QLOG_SLOT_SIZE*4], pkt[12];
+	sldns_buffer rmsg;
+	ub_thread_type thr;
+	char fname[128];
+	size_t len, pos;
+	FILE* f;
+	unit_show_feature("querylog");
+	unit_assert(cfg);
+
+	/* pack and unpack a reply */
+	qlog_test_query(&qinfo, &addr, &addrlen, "2001:db8::1");
+	memset(pkt, 0, sizeof(pkt));
+	pkt[3] = LDNS_RCODE_NXDOMAIN;
+	sldns_buffer_init_frm_data(&rmsg, pkt, sizeof(pkt));
+	cfg->log_async_size = 4;
+	q = qlog_create(cfg, 1);
+	if(!qlog_supported()) {
+		unit_assert(q == NULL);
+		config_delete(cfg);
+		return;
+	}
+	unit_assert(q && q->rings[0].num == 4);
+	qlog_reply(qlog_get_ring(q, 0), &tv, &addr, addrlen, &qinfo, dur, 1,
+		&rmsg);
+	unit_assert(qlog_get_ring(q, 1) == NULL);
+	len = sldns_read_uint16(q->rings[0].slots);
+	unit_assert(len == QLOG_RECORD_FIXED+16+1+17);
+	unit_assert(qlog_record_unpack(q->rings[0].slots+2, len, &rec) == len);
+	unit_assert(rec.kind == qlog_kind_reply && rec.family == 6);
+	unit_assert(rec.rcode == LDNS_RCODE_NXDOMAIN && rec.port == 53);
+	unit_assert(rec.flags == QLOG_FLAG_CACHED && rec.pktlen == 12);
+	unit_assert(rec.sec == 1500000000 && rec.usec == 123456);
+	unit_assert(rec.duration == 1000500);
+	unit_assert(memcmp(rec.addr, &((struct sockaddr_in6*)&addr)->
+		sin6_addr, 16) == 0);
+	/* truncated and malformed records are refused */
+	for(pos=0; pos<len; pos++)
+		unit_assert(qlog_record_unpack(q->rings[0].slots+2, pos,
+			&rec2) == 0);
+	memmove(buf, q->rings[0].slots+2, len);
+	buf[3] = 5;
+	unit_assert(qlog_record_unpack(buf, len, &rec2) == 0);
+	buf[3] = 6;
+	buf[len-1] = 1; /* the name does not end in the root label */
+	unit_assert(qlog_record_unpack(buf, len, &rec2) == 0);
+	/* a formerr reply has no query */
+	pkt[3] = LDNS_RCODE_FORMERR;
+	qlog_reply(qlog_get_ring(q, 0), &tv, &addr, addrlen, &qinfo, dur, 0,
+		&rmsg);
+	len = sldns_read_uint16(q->rings[0].slots+QLOG_SLOT_SIZE);
+	unit_assert(qlog_record_unpack(q->rings[0].slots+QLOG_SLOT_SIZE+2,
+		len, &rec2) == len);
+	unit_assert(rec2.rcode == LDNS_RCODE_FORMERR && rec2.qname_len == 0);
+	/* a full ring drops records */
+	qlog_query(qlog_get_ring(q, 0), &tv, &addr, addrlen, &qinfo);
+	qlog_query(qlog_get_ring(q, 0), &tv, &addr, addrlen, &qinfo);
+	qlog_query(qlog_get_ring(q, 0), &tv, &addr, addrlen, &qinfo);
+	unit_assert(q->rings[0].head == 4 && q->rings[0].dropped == 1);
+	qlog_delete(q);
+
+	/* a worker thread fills a small ring while it is read */
+	cfg->log_async_size = 100; /* rounded up to 128 */
+	q = qlog_create(cfg, 1);
+	unit_assert(q && q->rings[0].num == 128);
+	memset(&rd, 0, sizeof(rd));
+	rd.last = -1;
+	ub_thread_create(&thr, qlog_test_thr, qlog_get_ring(q, 0));
+	while(rd.n + q->rings[0].dropped < QLOG_TEST_NUM)
+		(void)qlog_ring_drain(qlog_get_ring(q, 0), qlog_test_func,
+			&rd);
+	ub_thread_join(thr);
+	(void)qlog_ring_drain(qlog_get_ring(q, 0), qlog_test_func, &rd);
+	unit_assert(rd.n > 0);
+	unit_assert(rd.n + q->rings[0].dropped == QLOG_TEST_NUM);
+	unit_assert(q->rings[0].head == rd.n);
+	qlog_delete(q);
+
+	/* the log thread writes the binary file */
+	snprintf(fname, sizeof(fname), "/tmp/unbound.unittest.qlog.%u",
+		(unsigned)getpid());
+	unlink(fname);
+	cfg->log_binary_file = strdup(fname);
+	unit_assert(cfg->log_binary_file);
+	q = qlog_create(cfg, 2);
+	unit_assert(q);
+	qlog_start(q);
+	qlog_query(qlog_get_ring(q, 0), &tv, &addr, addrlen, &qinfo);
+	qlog_query(qlog_get_ring(q, 1), &tv, &addr, addrlen, &qinfo);
+	qlog_delete(q);
+	f = fopen(fname, "rb");
+	unit_assert(f);
+	len = fread(buf, 1, sizeof(buf), f);
+	fclose(f);
+	unlink(fname);
+	unit_assert(len > 8 && memcmp(buf, QLOG_FILE_MAGIC, 4) == 0);
+	unit_assert(sldns_read_uint32(buf+4) == QLOG_FILE_VERSION);
+	for(pos=8; pos<len; pos+=rec2.qname_len+QLOG_RECORD_FIXED+16+1) {
+		unit_assert(qlog_record_unpack(buf+pos, len-pos, &rec2));
+		unit_assert(rec2.kind == qlog_kind_query);
+		unit_assert(rec2.qname_len == rec.qname_len && memcmp(
+			rec2.qname, rec.qname, rec.qname_len) == 0);
+	}
+	unit_assert(pos == len && len == 8+2*(QLOG_RECORD_FIXED+16+1+17));
+	config_delete(cfg);
+}
+
+#include "daemon/metrics.h"
+#include "daemon/stats.h"
+#include "util/timehist.h"
+
+/** check that every line of the metrics text is a comment, a sample of
+ * unbound, or the end marker */
+static void
+metrics_lines_check(char* txt)
+{
+	char* p = txt, *e;
+	while((e = strchr(p, '\n')) != NULL) {
+		unit_assert(strncmp(p, "# TYPE unbound_", 15) == 0 ||
+			strncmp(p, "# HELP unbound_", 15) == 0 ||
+			strncmp(p, "unbound_", 8) == 0 ||
+			(strncmp(p, "# EOF\n", 6) == 0 && e[1] == 0));
+		p = e+1;
+	}
+	unit_assert(*p == 0);
+}
+
+/** test the text of the metrics endpoint */
+static void
+metrics_test(void)
+{
+	struct daemon_metrics dm;
+	struct stats_info stats[3];
+	size_t thread_free[2] = {100, 200};
+	sldns_buffer* b = sldns_buffer_new(METRICS_BUF_SIZE);
+	char* txt;
+	unit_show_feature("metrics_print");
+	unit_assert(b);
+	memset(&dm, 0, sizeof(dm));
+	memset(stats, 0, sizeof(stats));
+	dm.num = 2;
+	dm.stats = stats;
+	dm.thread_free = thread_free;
+	dm.hist = timehist_setup();
+	unit_assert(dm.hist);
+	dm.mem_rrset = 1000;
+	dm.mem_msg = 2000;
+	dm.mem_alloc = 3000;
+	dm.mem_iter = 40;
+	dm.mem_val = 50;
+	dm.up.tv_sec = 12;
+	dm.up.tv_usec = 500000;
+	stats[0].svr.num_queries = 5;
+	stats[0].svr.num_queries_missed_cache = 1;
+	stats[0].svr.hist[0] = 1;
+	stats[0].svr.hist[2] = 2;
+	stats[1].svr.num_queries = 7;
+	stats[1].svr.hist[2] = 4;
+	stats[2].svr.num_queries = 12;
+	stats[2].svr.qtype[LDNS_RR_TYPE_A] = 3;
+	stats[2].svr.ans_rcode[LDNS_RCODE_NXDOMAIN] = 6;
+	stats[2].mesh_replies_sum_wait.tv_sec = 1;
+	stats[2].mesh_replies_sum_wait.tv_usec = 250000;
+
+	/* without the extended statistics */
+	unit_assert(metrics_print_text(&dm, b));
+	unit_assert(sldns_buffer_available(b, 1));
+	sldns_buffer_write_u8(b, 0);
+	txt = (char*)sldns_buffer_begin(b);
+	metrics_lines_check(txt);
+	unit_assert(strstr(txt, "# TYPE unbound_queries counter\n"
+		"# HELP unbound_queries Queries received from clients.\n"
+		"unbound_queries_total{thread=\"0\"} 5\n"
+		"unbound_queries_total{thread=\"1\"} 7\n"));
+	unit_assert(strstr(txt, "unbound_memory_thread_free_bytes"
+		"{thread=\"1\"} 200\n"));
+	unit_assert(strstr(txt, "unbound_memory_cache_bytes{cache=\"rrset\"} "
+		"1000\nunbound_memory_cache_bytes{cache=\"message\"} 2000\n"
+		"unbound_memory_cache_bytes{cache=\"alloc\"} 3000\n"));
+	unit_assert(strstr(txt, "unbound_memory_module_bytes"
+		"{module=\"validator\"} 50\n"));
+	/* the histogram buckets are cumulative over the threads */
+	unit_assert(strstr(txt, "# TYPE unbound_response_time_seconds "
+		"histogram\n"));
+	unit_assert(strstr(txt, "unbound_response_time_seconds_bucket"
+		"{le=\"0.000001\"} 1\nunbound_response_time_seconds_bucket"
+		"{le=\"0.000002\"} 1\nunbound_response_time_seconds_bucket"
+		"{le=\"0.000004\"} 7\n"));
+	unit_assert(strstr(txt, "unbound_response_time_seconds_bucket"
+		"{le=\"+Inf\"} 7\nunbound_response_time_seconds_count 7\n"
+		"unbound_response_time_seconds_sum 1.25\n"));
+	unit_assert(strstr(txt, "unbound_time_up_seconds 12.5\n# EOF\n"));
+	unit_assert(!strstr(txt, "unbound_query_types"));
+
+	/* with the extended statistics */
+	dm.extended = 1;
+	sldns_buffer_clear(b);
+	unit_assert(metrics_print_text(&dm, b));
+	unit_assert(sldns_buffer_available(b, 1));
+	sldns_buffer_write_u8(b, 0);
+	txt = (char*)sldns_buffer_begin(b);
+	metrics_lines_check(txt);
+	unit_assert(strstr(txt, "unbound_query_types_total{type=\"A\"} 3\n"
+		"unbound_query_types_total{type=\"other\"} 0\n"));
+	unit_assert(strstr(txt, "unbound_answer_rcodes_total"
+		"{rcode=\"NXDOMAIN\"} 6\n"));
+	unit_assert(strstr(txt, "unbound_answer_rcodes_total"
+		"{rcode=\"REFUSED\"} 0\n"));
+
+	timehist_delete(dm.hist);
+	sldns_buffer_free(b);
+}
+
 void unit_show_func(const char* file, const char* func)
 {
 	printf("test %s:%s\n", file, func);
 }
 
+#ifdef USE_DYNLIBMOD
+#include "dynlibmod/dynlibmod.h"
+#include "util/module.h"
+/** test the dynlib module with the example plugin and a plugin with
+ * another ABI version, they are built with unittest in this directory */
+static void
+dynlib_test(void)
+{
+	struct module_env env;
+	struct module_qstate qstate;
+	struct config_file* cfg;
+	uint8_t blocked[] = "\003www\003ads\007example\003com";
+	uint8_t passed[] = "\003www\007example\003com";
+	unit_show_feature("dynlib module");
+	memset(&env, 0, sizeof(env));
+	unit_assert( (cfg = config_create()) );
+	env.cfg = cfg;
+
+	/* a plugin with another ABI version is refused */
+	unit_assert( (cfg->dynlib_file = strdup("./dynlib_badabi.so")) );
+	unit_assert(!dynlibmod_init(&env, 0));
+	dynlibmod_deinit(&env, 0);
+	unit_assert(env.modinfo[0] == NULL);
+
+	/* the example plugin refuses the queries for blocked names */
+	free(cfg->dynlib_file);
+	unit_assert( (cfg->dynlib_file = strdup("./dynlib_filter.so")) );
+	unit_assert(dynlibmod_init(&env, 0));
+	unit_assert(env.inplace_cb_lists[inplace_cb_reply] != NULL);
+	memset(&qstate, 0, sizeof(qstate));
+	qstate.env = &env;
+	qstate.qinfo.qname = blocked;
+	qstate.qinfo.qname_len = sizeof(blocked);
+	qstate.qinfo.qtype = LDNS_RR_TYPE_A;
+	qstate.qinfo.qclass = LDNS_RR_CLASS_IN;
+	dynlibmod_operate(&qstate, module_event_new, 0, NULL);
+	unit_assert(qstate.ext_state[0] == module_finished);
+	unit_assert(qstate.return_rcode == LDNS_RCODE_REFUSED);
+	/* and passes the others on */
+	qstate.qinfo.qname = passed;
+	qstate.qinfo.qname_len = sizeof(passed);
+	qstate.return_rcode = LDNS_RCODE_NOERROR;
+	dynlibmod_operate(&qstate, module_event_new, 0, NULL);
+	unit_assert(qstate.ext_state[0] == module_wait_module);
+	unit_assert(qstate.return_rcode == LDNS_RCODE_NOERROR);
+	dynlibmod_operate(&qstate, module_event_moddone, 0, NULL);
+	unit_assert(qstate.ext_state[0] == module_finished);
+	dynlibmod_clear(&qstate, 0);
+
+	/* the callbacks into the plugin are removed when it is unloaded */
+	dynlibmod_deinit(&env, 0);
+	unit_assert(env.modinfo[0] == NULL);
+	unit_assert(env.inplace_cb_lists[inplace_cb_reply] == NULL);
+	config_delete(cfg);
+}
+#endif /* USE_DYNLIBMOD */
+
 void unit_show_feature(const char* feature)
 {
 	printf("test %s functions\n", feature);
@@ -604,20 +1520,31 @@ main(int argc, char* argv[])
 	checklock_start();
 	neg_test();
 	rnd_test();
+	keyhash_test();
+	timewheel_test();
+	hashindex_test();
+	udp_pool_test();
+	querylog_test();
+	metrics_test();
 	verify_test();
 	net_test();
 	config_memsize_test();
 	config_tag_test();
 	dname_test();
 	rtt_test();
+	rtt_hist_test();
 	anchors_test();
 	alloc_test();
+	alloc_sized_test();
 	regional_test();
 	lruhash_test();
 	slabhash_test();
 	infra_test();
 	ldns_test();
 	msgparse_test();
+#ifdef USE_DYNLIBMOD
+	dynlib_test();
+#endif
 	checklock_stop();
 	printf("%d checks ok.\n", testcount);
 #ifdef HAVE_SSL
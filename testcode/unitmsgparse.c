@@ -495,6 +495,190 @@ testfromdrillfile(sldns_buffer* pkt, struct alloc_cache* alloc,
 	fclose(in);
 }
 
+/** the header checks that the worker did before query_info_decode,
+ * returns -1 to drop, 0 for ok, or the rcode */
+static int
+ref_check_request(sldns_buffer* pkt, int harden_large)
+{
+	uint8_t* q = sldns_buffer_begin(pkt);
+	if(sldns_buffer_limit(pkt) < LDNS_HEADER_SIZE)
+		return -1;
+	if(sldns_buffer_limit(pkt) > 512 && harden_large)
+		return -1;
+	if(LDNS_QR_WIRE(q))
+		return -1;
+	if(LDNS_TC_WIRE(q)) {
+		LDNS_TC_CLR(q);
+		return LDNS_RCODE_FORMERR;
+	}
+	if(LDNS_OPCODE_WIRE(q) != LDNS_PACKET_QUERY)
+		return LDNS_RCODE_NOTIMPL;
+	if(LDNS_QDCOUNT(q) != 1 || LDNS_ANCOUNT(q) != 0 ||
+		LDNS_NSCOUNT(q) != 0 || LDNS_ARCOUNT(q) > 1)
+		return LDNS_RCODE_FORMERR;
+	return 0;
+}
+
+/** make a random query, mostly valid, with random damage */
+static void
+random_query(sldns_buffer* pkt)
+{
+	int i, j, labs = random()%5, len;
+	uint16_t flags = (uint16_t)(random() & 0xffff);
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, (uint16_t)random());
+	/* mostly a plain query, sometimes random flags */
+	if(random()%4 != 0)
+		flags &= ~(BIT_QR|BIT_TC|0x7800);
+	sldns_buffer_write_u16(pkt, flags);
+	sldns_buffer_write_u16(pkt, random()%8?1:random()%3);
+	sldns_buffer_write_u16(pkt, random()%16?0:1);
+	sldns_buffer_write_u16(pkt, random()%16?0:1);
+	sldns_buffer_write_u16(pkt, random()%2?random()%3:1);
+	for(i=0; i<labs; i++) {
+		len = random()%20==0?64+random()%192:1+random()%12;
+		if(random()%10 == 0)
+			len = 63; /* for names that are too long */
+		sldns_buffer_write_u8(pkt, (uint8_t)len);
+		for(j=0; j<len && sldns_buffer_remaining(pkt) > 0; j++)
+			sldns_buffer_write_u8(pkt, (uint8_t)("abcXYZ-09"
+				"\377"[random()%10]));
+		if(sldns_buffer_position(pkt) > 400)
+			break;
+	}
+	sldns_buffer_write_u8(pkt, 0);
+	sldns_buffer_write_u16(pkt, random()%4==0?LDNS_RR_TYPE_AAAA:
+		(uint16_t)(random()%300));
+	sldns_buffer_write_u16(pkt, random()%8?LDNS_RR_CLASS_IN:
+		(uint16_t)random());
+	if(random()%3 != 0) {
+		/* an OPT record, sometimes with a bad owner or type */
+		int opts = random()%3;
+		sldns_buffer_write_u8(pkt, 0);
+		if(random()%16 == 0)
+			sldns_buffer_write_u16(pkt, 0xc00c);
+		sldns_buffer_write_u16(pkt, random()%16?LDNS_RR_TYPE_OPT:
+			LDNS_RR_TYPE_A);
+		sldns_buffer_write_u16(pkt, (uint16_t)random());
+		sldns_buffer_write_u32(pkt, (uint32_t)random());
+		sldns_buffer_write_u16(pkt, (uint16_t)(opts*8 +
+			(random()%8?0:random()%5)));
+		for(i=0; i<opts; i++) {
+			sldns_buffer_write_u16(pkt, (uint16_t)(random()%16));
+			sldns_buffer_write_u16(pkt, 4);
+			sldns_buffer_write_u32(pkt, (uint32_t)random());
+		}
+	}
+	/* damage it */
+	if(random()%4 == 0 && sldns_buffer_position(pkt) > 0) {
+		size_t pos = (size_t)random()%sldns_buffer_position(pkt);
+		sldns_buffer_write_u8_at(pkt, pos, (uint8_t)random());
+	}
+	if(random()%4 == 0)
+		sldns_buffer_set_position(pkt, (size_t)random()%
+			(sldns_buffer_position(pkt)+1));
+	sldns_buffer_flip(pkt);
+}
+
+/** see that the edns options are the same */
+static int
+edns_opts_equal(struct edns_option* a, struct edns_option* b)
+{
+	while(a && b) {
+		if(a->opt_code != b->opt_code || a->opt_len != b->opt_len ||
+			memcmp(a->opt_data, b->opt_data, a->opt_len) != 0)
+			return 0;
+		a = a->next;
+		b = b->next;
+	}
+	return a == NULL && b == NULL;
+}
+
+/** test query_info_decode and query_info_decode_header against the
+ * separate parse functions, for random queries */
+static void
+query_decode_test(void)
+{
+	sldns_buffer* pkt = sldns_buffer_new(65535);
+	sldns_buffer* ref = sldns_buffer_new(65535);
+	sldns_buffer* hdr = sldns_buffer_new(65535);
+	struct regional* region = regional_create();
+	struct query_info qinfo, rqinfo;
+	struct edns_data edns, redns;
+	hashvalue_type h = 0;
+	enum query_decode_status qs, hs;
+	int i, rcode, hrcode, rret, harden, num_ok = 0;
+	unit_assert(pkt && ref && hdr && region);
+	for(i=0; i<100000; i++) {
+		random_query(pkt);
+		sldns_buffer_clear(ref);
+		sldns_buffer_write(ref, sldns_buffer_begin(pkt),
+			sldns_buffer_limit(pkt));
+		sldns_buffer_flip(ref);
+		sldns_buffer_clear(hdr);
+		sldns_buffer_write(hdr, sldns_buffer_begin(pkt),
+			sldns_buffer_limit(pkt));
+		sldns_buffer_flip(hdr);
+		harden = random()%2;
+		rcode = 0;
+		hrcode = 0;
+		qs = query_info_decode(pkt, harden, &qinfo, &h, &edns, region,
+			&rcode);
+		hs = query_info_decode_header(hdr, harden, &hrcode);
+		rret = ref_check_request(ref, harden);
+		/* the TC flag is cleared the same way */
+		unit_assert(sldns_buffer_limit(ref) < 4 || memcmp(
+			sldns_buffer_begin(pkt), sldns_buffer_begin(ref), 4)
+			== 0);
+		if(rret == -1) {
+			unit_assert(qs == query_decode_drop &&
+				hs == query_decode_drop);
+			continue;
+		}
+		if(rret != 0) {
+			unit_assert(qs == query_decode_header && rcode == rret);
+			unit_assert(hs == query_decode_header &&
+				hrcode == rret);
+			continue;
+		}
+		unit_assert(hs == query_decode_ok);
+		if(!query_info_parse(&rqinfo, ref)) {
+			unit_assert(qs == query_decode_question);
+			continue;
+		}
+		unit_assert(qs == query_decode_ok || qs == query_decode_edns);
+		unit_assert(qinfo.qname_len == rqinfo.qname_len &&
+			qinfo.qtype == rqinfo.qtype &&
+			qinfo.qclass == rqinfo.qclass &&
+			qinfo.qname - sldns_buffer_begin(pkt) ==
+			rqinfo.qname - sldns_buffer_begin(ref));
+		unit_assert(h == query_info_hash(&rqinfo,
+			sldns_buffer_read_u16_at(ref, 2)));
+		rret = parse_edns_from_pkt(ref, &redns, region);
+		unit_assert(sldns_buffer_position(pkt) ==
+			sldns_buffer_position(ref));
+		if(rret != 0) {
+			unit_assert(qs == query_decode_edns && rcode == rret);
+			continue;
+		}
+		unit_assert(qs == query_decode_ok);
+		unit_assert(edns.edns_present == redns.edns_present &&
+			edns.udp_size == redns.udp_size &&
+			edns.ext_rcode == redns.ext_rcode &&
+			edns.edns_version == redns.edns_version &&
+			edns.bits == redns.bits &&
+			edns_opts_equal(edns.opt_list, redns.opt_list));
+		num_ok++;
+		regional_free_all(region);
+	}
+	/* the random queries are often valid */
+	unit_assert(num_ok > 10000);
+	regional_destroy(region);
+	sldns_buffer_free(pkt);
+	sldns_buffer_free(ref);
+	sldns_buffer_free(hdr);
+}
+
 void msgparse_test(void)
 {
 	time_t origttl = MAX_NEG_TTL;
@@ -533,6 +717,8 @@ void msgparse_test(void)
 	check_nosameness = 0;
 	check_rrsigs = 0;
 
+	query_decode_test();
+
 	/* cleanup */
 	alloc_clear(&alloc);
 	alloc_clear(&super_a);
@@ -186,9 +186,16 @@ check_lru_table(struct lruhash* table)
 static void
 check_table(struct slabhash* table)
 {
+	struct slab_array* a = slabhash_array(table);
+	/* a rehash in another thread sets it to NULL when it is done */
+	struct slab_array* old = ub_load_acquire(&a->old);
 	size_t i;
-	for(i=0; i<table->size; i++)
-		check_lru_table(table->array[i]);
+	for(i=0; i<a->size; i++)
+		check_lru_table(a->array[i]);
+	if(old) {
+		for(i=0; i<old->size; i++)
+			check_lru_table(old->array[i]);
+	}
 }
 
 /** test adding a random element (unlimited range) */
@@ -336,6 +343,68 @@ test_thr_main(void* arg)
 	return NULL;
 }
 
+/** test changing the size and number of slabs of a table */
+static void
+test_resize_table(struct slabhash* table)
+{
+	int i;
+	size_t n;
+	testdata_type* ref[HASHTESTMAX];
+	testkey_type* k;
+	struct lruhash_entry* e;
+	memset(ref, 0, sizeof(ref));
+	for(i=0; i<HASHTESTMAX; i++) {
+		testdata_type* d = newdata(i);
+		k = newkey(i);
+		k->entry.data = d;
+		slabhash_insert(table, myhash(i), &k->entry, d, NULL);
+		ref[i] = d;
+	}
+	n = count_slabhash_entries(table);
+	unit_assert(n == HASHTESTMAX);
+
+	/* more slabs, entries are kept */
+	unit_assert(slabhash_rehash(table, 8));
+	unit_assert(slabhash_array(table)->size == 8);
+	unit_assert(count_slabhash_entries(table) == n);
+	unit_assert(slabhash_get_size(table) == 10400/8*8);
+	check_table(table);
+	for(i=0; i<HASHTESTMAX; i++) {
+		k = newkey(i);
+		e = slabhash_lookup(table, myhash(i), k, 0);
+		unit_assert(e && e->data == ref[i]);
+		lock_rw_unlock(&e->lock);
+		delkey(k);
+	}
+	/* the tables of the replaced array are empty and closed */
+	unit_assert(table->retired && table->retired->size == 4);
+	for(i=0; i<4; i++) {
+		unit_assert(table->retired->array[i]->closed);
+		unit_assert(table->retired->array[i]->num == 0);
+	}
+
+	/* fewer slabs */
+	unit_assert(slabhash_rehash(table, 2));
+	unit_assert(slabhash_array(table)->size == 2);
+	unit_assert(count_slabhash_entries(table) == n);
+	check_table(table);
+
+	/* shrink: the least recently used entries are removed */
+	slabhash_update_space_max(table, 2*4*test_slabhash_sizefunc(NULL,
+		NULL));
+	unit_assert(slabhash_get_size(table) == 2*4*test_slabhash_sizefunc(
+		NULL, NULL));
+	unit_assert(count_slabhash_entries(table) <= 8);
+	check_table(table);
+
+	/* grow again, only the limit changes */
+	unit_assert(slabhash_adjust(table, 4, 10400));
+	unit_assert(slabhash_array(table)->size == 4);
+	unit_assert(slabhash_get_size(table) == 10400);
+	unit_assert(count_slabhash_entries(table) <= 8);
+	check_table(table);
+}
+
 /** test hash table access by multiple threads */
 static void
 test_threaded_table(struct slabhash* table)
@@ -356,6 +425,35 @@ test_threaded_table(struct slabhash* table)
 	if(0) slabhash_status(table, "hashtest", 1);
 }
 
+/** test changing the number of slabs while other threads use the table */
+static void
+test_threaded_rehash(struct slabhash* table)
+{
+	int numth = 10;
+	struct slab_test_thr t[100];
+	size_t slabs[] = {8, 2, 16, 1, 4};
+	int i, j;
+
+	for(i=1; i<numth; i++) {
+		t[i].num = i;
+		t[i].table = table;
+		ub_thread_create(&t[i].id, test_thr_main, &t[i]);
+	}
+	for(j=0; j<5; j++) {
+		for(i=0; i<(int)(sizeof(slabs)/sizeof(slabs[0])); i++) {
+			unit_assert(slabhash_rehash(table, slabs[i]));
+			unit_assert(slabhash_array(table)->size == slabs[i]);
+			check_table(table);
+		}
+	}
+	for(i=1; i<numth; i++) {
+		ub_thread_join(t[i].id);
+	}
+	unit_assert(slabhash_array(table)->old == NULL);
+	check_table(table);
+	if(0) slabhash_status(table, "hashtest", 1);
+}
+
 void slabhash_test(void)
 {
 	/* start very very small array, so it can do lots of table_grow() */
@@ -373,4 +471,14 @@ void slabhash_test(void)
 		test_slabhash_delkey, test_slabhash_deldata, NULL);
 	test_threaded_table(table);
 	slabhash_delete(table);
+	table = slabhash_create(4, 2, 10400, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	test_resize_table(table);
+	slabhash_delete(table);
+	table = slabhash_create(4, 2, 10400, 
+		test_slabhash_sizefunc, test_slabhash_compfunc, 
+		test_slabhash_delkey, test_slabhash_deldata, NULL);
+	test_threaded_rehash(table);
+	slabhash_delete(table);
 }
@@ -46,6 +46,7 @@
 #include "validator/val_nsec.h"
 #include "validator/val_nsec3.h"
 #include "validator/validator.h"
+#include "validator/val_kcache.h"
 #include "testcode/testpkts.h"
 #include "util/data/msgreply.h"
 #include "util/data/msgparse.h"
@@ -56,6 +57,7 @@
 #include "util/net_help.h"
 #include "util/module.h"
 #include "util/config_file.h"
+#include "util/storage/slabhash.h"
 #include "sldns/sbuffer.h"
 #include "sldns/keyraw.h"
 #include "sldns/str2wire.h"
@@ -64,6 +66,9 @@
 /** verbose signature test */
 static int vsig = 0;
 
+/** key cache used for the verification, or NULL */
+static struct key_cache* test_kcache = NULL;
+
 /** entry to packet buffer with wireformat */
 static void
 entry_to_buf(struct entry* e, sldns_buffer* pkt)
@@ -309,6 +314,7 @@ verifytest_file(const char* fname, const char* at_date)
 	env.scratch_buffer = buf;
 	env.now = &now;
 	ve.date_override = cfg_convert_timeval(at_date);
+	ve.kcache = test_kcache;
 	unit_assert(region && buf);
 	dnskey = extract_keys(list, &alloc, region, buf);
 	if(vsig) log_nametypeclass(VERB_QUERY, "test dnskey",
@@ -326,6 +332,36 @@ verifytest_file(const char* fname, const char* at_date)
 	sldns_buffer_free(buf);
 }
 
+/** verify with the cache of parsed public keys, the files are verified
+ * twice, so that the second time the keys come from the cache */
+static void
+verifytest_kcache(void)
+{
+	struct config_file* cfg = config_create();
+	size_t mem;
+	unit_assert(cfg);
+	test_kcache = key_cache_create(cfg);
+	unit_assert(test_kcache);
+	mem = key_cache_get_mem(test_kcache);
+	verifytest_file("testdata/test_signatures.1", "20070818005004");
+	verifytest_file("testdata/test_signatures.1", "20070818005004");
+	verifytest_file("testdata/test_sigs.revoked", "20080414005004");
+	verifytest_file("testdata/test_sigs.revoked", "20080414005004");
+#ifdef USE_ECDSA
+	if(dnskey_algo_id_is_supported(LDNS_ECDSAP256SHA256)) {
+		verifytest_file("testdata/test_sigs.ecdsa_p256",
+			"20100908100439");
+		verifytest_file("testdata/test_sigs.ecdsa_p256",
+			"20100908100439");
+	}
+#endif
+	if(test_kcache->pkeys)
+		unit_assert(key_cache_get_mem(test_kcache) > mem);
+	key_cache_delete(test_kcache);
+	test_kcache = NULL;
+	config_delete(cfg);
+}
+
 /** verify DS matches DNSKEY from a file */
 static void
 dstest_file(const char* fname)
@@ -413,8 +449,8 @@ nsectest(void)
 /** Test hash algo - NSEC3 hash it and compare result */
 static void
 nsec3_hash_test_entry(struct entry* e, rbtree_type* ct,
-	struct alloc_cache* alloc, struct regional* region, 
-	sldns_buffer* buf)
+	struct slabhash* hcache, struct alloc_cache* alloc,
+	struct regional* region, sldns_buffer* buf)
 {
 	struct query_info qinfo;
 	struct reply_info* rep = NULL;
@@ -436,7 +472,7 @@ nsec3_hash_test_entry(struct entry* e, rbtree_type* ct,
 	/* check test is OK */
 	unit_assert(nsec3 && answer && qname);
 
-	ret = nsec3_hash_name(ct, region, buf, nsec3, 0, qname,
+	ret = nsec3_hash_name(ct, hcache, region, buf, nsec3, 0, qname,
 		qinfo.qname_len, &hash);
 	if(ret != 1) {
 		printf("Bad nsec3_hash_name retcode %d\n", ret);
@@ -454,9 +490,10 @@ nsec3_hash_test_entry(struct entry* e, rbtree_type* ct,
 }
 
 
-/** Read file to test NSEC3 hash algo */
+/** Read file to test NSEC3 hash algo, with the shared hash cache if
+ * it is not NULL */
 static void
-nsec3_hash_test(const char* fname)
+nsec3_hash_test(const char* fname, struct slabhash* hcache)
 {
 	/* 
 	 * The list contains a list of ldns-testpkts entries.
@@ -483,7 +520,7 @@ nsec3_hash_test(const char* fname)
 
 	/* ready to go! */
 	for(e = list; e; e = e->next) {
-		nsec3_hash_test_entry(e, &ct, &alloc, region, buf);
+		nsec3_hash_test_entry(e, &ct, hcache, &alloc, region, buf);
 	}
 
 	delete_entry(list);
@@ -492,6 +529,25 @@ nsec3_hash_test(const char* fname)
 	sldns_buffer_free(buf);
 }
 
+/** Test NSEC3 hashes with the shared hash cache, the second time the
+ * hashes come from the cache */
+static void
+nsec3_hash_test_shared(const char* fname)
+{
+	struct slabhash* hcache;
+	size_t used;
+	nsec3_hash_test(fname, NULL);
+	hcache = nsec3_hcache_create(1, 1024*1024);
+	unit_assert(hcache);
+	used = slabhash_get_mem(hcache);
+	nsec3_hash_test(fname, hcache);
+	unit_assert(slabhash_get_mem(hcache) > used);
+	used = slabhash_get_mem(hcache);
+	nsec3_hash_test(fname, hcache);
+	unit_assert(slabhash_get_mem(hcache) == used);
+	slabhash_delete(hcache);
+}
+
 void 
 verify_test(void)
 {
@@ -530,6 +586,7 @@ verify_test(void)
 	dstest_file("testdata/test_ds.sha384");
 #endif
 	dstest_file("testdata/test_ds.sha1");
+	verifytest_kcache();
 	nsectest();
-	nsec3_hash_test("testdata/test_nsec3_hash.1");
+	nsec3_hash_test_shared("testdata/test_nsec3_hash.1");
 }
@@ -0,0 +1,207 @@
+/*
+ * testcode/verifybench.c - benchmark of the signature verification.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ *
+ * This program times the verification of the signatures in the test files
+ * of the verification unit test, with and without the cache of parsed
+ * public keys. Without it, the key object for the crypto library is made
+ * from the DNSKEY data for every signature.
+ */
+#include "config.h"
+#include "testcode/benchutil.h"
+#include "util/log.h"
+#include "util/alloc.h"
+#include "util/regional.h"
+#include "util/module.h"
+#include "util/config_file.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "validator/validator.h"
+#include "validator/val_kcache.h"
+#include "validator/val_sigcrypt.h"
+#include "testcode/testpkts.h"
+#include "sldns/sbuffer.h"
+#include "sldns/rrdef.h"
+
+/** print usage and exit */
+static void
+usage(void)
+{
+	printf("usage:	verifybench [count]\n");
+	printf("times the signature verification of the test files, "
+		"count times.\n");
+	printf("run from the source directory, it reads testdata/.\n");
+	exit(1);
+}
+
+/** parse the reply of the entry */
+static struct reply_info*
+entry_parse(struct entry* e, struct alloc_cache* alloc,
+	struct regional* region, sldns_buffer* pkt)
+{
+	struct reply_info* rep = NULL;
+	struct query_info qinfo;
+	struct edns_data edns;
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write(pkt, e->reply_list->reply_pkt,
+		e->reply_list->reply_len);
+	sldns_buffer_flip(pkt);
+	if(reply_info_parse(pkt, alloc, &qinfo, &rep, region, &edns) != 0)
+		fatal_exit("cannot parse test entry");
+	query_info_clear(&qinfo);
+	return rep;
+}
+
+/** verify all the signed rrsets in the list, return the number done */
+static int
+verify_list(struct module_env* env, struct val_env* ve,
+	struct reply_info** reps, int num, struct ub_packed_rrset_key* dnskey,
+	uint8_t* sigalg)
+{
+	char* reason = NULL;
+	int i, n = 0;
+	size_t j;
+	for(i=0; i<num; i++) {
+		for(j=0; j<reps[i]->rrset_count; j++) {
+			if(((struct packed_rrset_data*)reps[i]->rrsets[j]->
+				entry.data)->rrsig_count == 0)
+				continue;
+			(void)dnskeyset_verify_rrset(env, ve, reps[i]->rrsets[j],
+				dnskey, sigalg, &reason);
+			regional_free_all(env->scratch);
+			n++;
+		}
+	}
+	return n;
+}
+
+/** time the verification of the file */
+static void
+bench_file(const char* fname, const char* at_date, int count)
+{
+	struct entry* list = read_datafile(fname, 1), *e;
+	struct regional* region = regional_create();
+	struct regional* scratch = regional_create();
+	sldns_buffer* buf = sldns_buffer_new(65535);
+	struct config_file* cfg = config_create();
+	struct alloc_cache alloc;
+	struct module_env env;
+	struct val_env ve;
+	struct reply_info* reps[64], *keyrep;
+	struct ub_packed_rrset_key* dnskey = NULL;
+	uint8_t sigalg[ALGO_NEEDS_MAX+1];
+	time_t now = time(NULL);
+	double start, tplain, tcache;
+	int i, num = 0, n = 0;
+	size_t j;
+	if(!list || !region || !scratch || !buf || !cfg)
+		fatal_exit("cannot read %s or out of memory", fname);
+	alloc_init(&alloc, NULL, 1);
+	memset(&env, 0, sizeof(env));
+	memset(&ve, 0, sizeof(ve));
+	env.scratch = scratch;
+	env.scratch_buffer = buf;
+	env.now = &now;
+	ve.date_override = cfg_convert_timeval(at_date);
+	/* the first entry has the DNSKEY set */
+	keyrep = entry_parse(list, &alloc, region, buf);
+	for(j=0; j<keyrep->an_numrrsets; j++)
+		if(ntohs(keyrep->rrsets[j]->rk.type) == LDNS_RR_TYPE_DNSKEY)
+			dnskey = keyrep->rrsets[j];
+	if(!dnskey)
+		fatal_exit("no DNSKEY in %s", fname);
+	/* the algorithms of the keys */
+	sigalg[0] = 0;
+	for(j=0; j<((struct packed_rrset_data*)dnskey->entry.data)->count;
+		j++) {
+		int a = dnskey_get_algo(dnskey, j), k = 0;
+		while(sigalg[k] && sigalg[k] != a)
+			k++;
+		if(!sigalg[k]) {
+			sigalg[k] = (uint8_t)a;
+			sigalg[k+1] = 0;
+		}
+	}
+	for(e = list->next; e && num < 64; e = e->next)
+		reps[num++] = entry_parse(e, &alloc, region, buf);
+
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		n = verify_list(&env, &ve, reps, num, dnskey, sigalg);
+	tplain = (bench_now_usec() - start)*1000./((double)count*n);
+
+	ve.kcache = key_cache_create(cfg);
+	if(!ve.kcache)
+		fatal_exit("out of memory");
+	if(!ve.kcache->pkeys)
+		printf("the parsed public keys are not cached for this "
+			"crypto library\n");
+	start = bench_now_usec();
+	for(i=0; i<count; i++)
+		n = verify_list(&env, &ve, reps, num, dnskey, sigalg);
+	tcache = (bench_now_usec() - start)*1000./((double)count*n);
+
+	printf("%-34s %3d sigs  verify %9.1f nsec  with key cache "
+		"%9.1f nsec  %5.2fx\n", fname, n, tplain, tcache,
+		tplain/tcache);
+	key_cache_delete(ve.kcache);
+	for(i=0; i<num; i++)
+		reply_info_parsedelete(reps[i], &alloc);
+	reply_info_parsedelete(keyrep, &alloc);
+	delete_entry(list);
+	config_delete(cfg);
+	alloc_clear(&alloc);
+	regional_destroy(region);
+	regional_destroy(scratch);
+	sldns_buffer_free(buf);
+}
+
+/** main program for verifybench */
+int main(int argc, char* argv[])
+{
+	int count = 1000;
+	log_init(NULL, 0, NULL);
+	if(argc > 2)
+		usage();
+	if(argc == 2 && (count = atoi(argv[1])) < 1)
+		usage();
+	printf("verify of signatures, %d times each\n", count);
+	bench_file("testdata/test_signatures.1", "20070818005004", count);
+	bench_file("testdata/test_sigs.rsasha256", "20070829144150", count);
+	bench_file("testdata/test_sigs.ecdsa_p256", "20100908100439", count);
+	bench_file("testdata/test_sigs.ecdsa_p384", "20100908100439", count);
+	return 0;
+}
@@ -44,12 +44,63 @@
 #include "util/regional.h"
 #include "util/data/packed_rrset.h"
 #include "util/fptr_wlist.h"
+#ifndef USE_WINSOCK
+#include <sys/mman.h>
+#endif
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
 
 /** custom size of cached regional blocks */
 #define ALLOC_REG_SIZE	16384
 /** number of bits for ID part of uint64, rest for number of threads. */
 #define THRNUM_SHIFT	48	/* for 65k threads, 2^48 rrsets per thr. */
 
+/** size class of blocks that are malloced, and counted in the total */
+#define ALLOC_SIZED_LARGE 0xffff
+/** size class of blocks that are malloced, without alloc to count them */
+#define ALLOC_SIZED_HEAP 0xfffe
+/** check value in the header of cache memory blocks */
+#define ALLOC_SIZED_CHECK 0x5a1b0c4dU
+/** bytes of cache memory blocks per size class kept by a thread */
+#define ALLOC_SIZED_MAG_BYTES 32768
+
+/** header in front of a cache memory block */
+struct alloc_sized_block {
+	/** next in the free list, or for a malloced block, its size */
+	union {
+		/** next block in the free list, when the block is free */
+		struct alloc_sized_block* next;
+		/** size of the malloced block */
+		size_t size;
+	} u;
+	/** size class of the block */
+	uint32_t cls;
+	/** check value, to catch blocks from elsewhere */
+	uint32_t check;
+};
+
+/** a chunk that blocks are carved from, this is at its start */
+struct alloc_chunk {
+	/** next chunk in the list */
+	struct alloc_chunk* next;
+	/** number of blocks carved from the chunk */
+	size_t carved;
+	/** number of its blocks in the free lists of the super, counted
+	 * when the free chunks are looked for */
+	size_t free;
+	/** if the chunk is mmapped, otherwise it is malloced */
+	int mapped;
+};
+/** space at the start of a chunk for its header, blocks are carved
+ * after it */
+#define ALLOC_CHUNK_HDR 32
+
+/** the thread alloc of the calling thread, see alloc_set_thread */
+static ub_thread_key_type alloc_thread_key;
+/** if the thread alloc key has been created */
+static int alloc_key_created = 0;
+
 /** setup new special type */
 static void
 alloc_setup_special(alloc_special_type* t)
@@ -121,9 +172,473 @@ alloc_init(struct alloc_cache* alloc, struct alloc_cache* super,
 	if(alloc->super)
 		prealloc_blocks(alloc, alloc->max_reg_blocks);
 	if(!alloc->super) {
+		alloc->sized_trim = ALLOC_CHUNK_TRIM;
 		lock_quick_init(&alloc->lock);
 		lock_protect(&alloc->lock, alloc, sizeof(*alloc));
+		if(!alloc_key_created) {
+			alloc_key_created = 1;
+			ub_thread_key_create(&alloc_thread_key, NULL);
+		}
+	}
+}
+
+void
+alloc_set_thread(struct alloc_cache* alloc)
+{
+	log_assert(alloc->super && alloc_key_created);
+	ub_thread_key_set(alloc_thread_key, alloc);
+}
+
+/** size class for a block of size bytes, including the header */
+static int
+sized_class(size_t size)
+{
+	size_t p = 128;
+	int c = 8;
+	/* steps of 16 up to 128, then four classes per power of two */
+	if(size <= 128)
+		return (int)((size+15)/16) - 1;
+	while(size > p*2) {
+		p *= 2;
+		c += 4;
+	}
+	return c + (int)((size - p - 1) / (p/4));
+}
+
+/** size of the blocks in a size class, including the header */
+static size_t
+sized_class_size(int c)
+{
+	size_t p;
+	if(c < 8)
+		return (size_t)(c+1)*16;
+	p = (size_t)128 << ((c-8)/4);
+	return p + (size_t)((c-8)%4 + 1)*(p/4);
+}
+
+/** number of blocks of a class that a thread keeps */
+static size_t
+sized_mag_max(int c)
+{
+	size_t n = ALLOC_SIZED_MAG_BYTES / sized_class_size(c);
+	if(n < 4) return 4;
+	if(n > 64) return 64;
+	return n;
+}
+
+/** get a chunk of memory from the system, with huge pages if possible */
+static struct alloc_chunk*
+chunk_create(void)
+{
+	struct alloc_chunk* ch;
+#if !defined(USE_WINSOCK) && defined(MAP_ANONYMOUS)
+	uint8_t* p, *a;
+#ifdef MAP_HUGETLB
+	/* once there are no more reserved huge pages, stop trying */
+	static int nohugetlb = 0;
+	if(!nohugetlb) {
+		p = (uint8_t*)mmap(NULL, ALLOC_CHUNK_SIZE, PROT_READ|PROT_WRITE,
+			MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+		if(p != (uint8_t*)MAP_FAILED) {
+			ch = (struct alloc_chunk*)p;
+			ch->mapped = 1;
+			return ch;
+		}
+		nohugetlb = 1;
+	}
+#endif /* MAP_HUGETLB */
+	/* map twice the size, and trim it so that the chunk is aligned,
+	 * and can be backed by a transparent huge page */
+	p = (uint8_t*)mmap(NULL, ALLOC_CHUNK_SIZE*2, PROT_READ|PROT_WRITE,
+		MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+	if(p != (uint8_t*)MAP_FAILED) {
+		a = (uint8_t*)(((size_t)p + ALLOC_CHUNK_SIZE - 1) &
+			~((size_t)ALLOC_CHUNK_SIZE - 1));
+		if(a > p)
+			(void)munmap(p, (size_t)(a - p));
+		if(a + ALLOC_CHUNK_SIZE < p + ALLOC_CHUNK_SIZE*2)
+			(void)munmap(a + ALLOC_CHUNK_SIZE, (size_t)(
+				(p + ALLOC_CHUNK_SIZE*2) - (a + ALLOC_CHUNK_SIZE)));
+#ifdef MADV_HUGEPAGE
+		(void)madvise(a, ALLOC_CHUNK_SIZE, MADV_HUGEPAGE);
+#endif
+		ch = (struct alloc_chunk*)a;
+		ch->mapped = 1;
+		return ch;
+	}
+#endif /* mmap */
+	ch = (struct alloc_chunk*)malloc(ALLOC_CHUNK_SIZE);
+	if(!ch)
+		return NULL;
+	ch->mapped = 0;
+	return ch;
+}
+
+/** return a chunk to the system */
+static void
+chunk_delete(struct alloc_chunk* ch)
+{
+#if !defined(USE_WINSOCK) && defined(MAP_ANONYMOUS)
+	if(ch->mapped) {
+		(void)munmap(ch, ALLOC_CHUNK_SIZE);
+		return;
+	}
+#endif
+	free(ch);
+}
+
+/** carve up to num blocks of a class into the free list of the super,
+ * which is locked. returns false if out of memory. */
+static int
+sized_carve(struct alloc_cache* sup, int c, size_t num)
+{
+	size_t sz = sized_class_size(c), i;
+	struct alloc_sized_block* b;
+	for(i=0; i<num; i++) {
+		if(sup->chunk_cur + sz > sup->chunk_end) {
+			struct alloc_chunk* ch;
+			if(i > 0)
+				return 1; /* got some, the rest next time */
+			/* the remainder of the old chunk is left unused */
+			if(!(ch = chunk_create()))
+				return 0;
+			ch->next = sup->chunks;
+			ch->carved = 0;
+			sup->chunks = ch;
+			sup->chunk_cur = (uint8_t*)ch + ALLOC_CHUNK_HDR;
+			sup->chunk_end = (uint8_t*)ch + ALLOC_CHUNK_SIZE;
+			sup->sized_total += ALLOC_CHUNK_SIZE;
+		}
+		b = (struct alloc_sized_block*)sup->chunk_cur;
+		sup->chunk_cur += sz;
+		sup->chunks->carved++;
+		b->u.next = sup->sized_free[c];
+		sup->sized_free[c] = b;
+		sup->num_sized_free[c]++;
+	}
+	return 1;
+}
+
+/** move up to num blocks from the free list of one alloc to another */
+static void
+sized_move(struct alloc_cache* from, struct alloc_cache* to, int c,
+	size_t num)
+{
+	struct alloc_sized_block* b;
+	while(num-- && (b = from->sized_free[c])) {
+		from->sized_free[c] = b->u.next;
+		from->num_sized_free[c]--;
+		b->u.next = to->sized_free[c];
+		to->sized_free[c] = b;
+		to->num_sized_free[c]++;
+	}
+}
+
+/** bytes in the free lists of an alloc */
+static size_t
+sized_free_bytes(struct alloc_cache* alloc)
+{
+	size_t s = 0;
+	int c;
+	for(c=0; c<ALLOC_SIZED_CLASSES; c++)
+		s += alloc->num_sized_free[c] * sized_class_size(c);
+	return s;
+}
+
+/** compare chunk pointers, for qsort */
+static int
+chunk_cmp(const void* x, const void* y)
+{
+	size_t a = (size_t)*(struct alloc_chunk* const*)x;
+	size_t b = (size_t)*(struct alloc_chunk* const*)y;
+	if(a < b) return -1;
+	if(a > b) return 1;
+	return 0;
+}
+
+/** find the chunk that a block is in, in the array sorted by address */
+static struct alloc_chunk*
+chunk_find(struct alloc_chunk** arr, size_t num, void* p)
+{
+	size_t lo = 0, hi = num, mid;
+	while(lo < hi) {
+		mid = lo + (hi-lo)/2;
+		if((size_t)p < (size_t)arr[mid])
+			hi = mid;
+		else if((size_t)p >= (size_t)arr[mid] + ALLOC_CHUNK_SIZE)
+			lo = mid+1;
+		else	return arr[mid];
+	}
+	return NULL;
+}
+
+/** see if a free block is in a chunk that is entirely free */
+static int
+sized_in_free_chunk(struct alloc_chunk** arr, size_t num, void* p)
+{
+	struct alloc_chunk* ch = chunk_find(arr, num, p);
+	return ch && ch->free == ch->carved;
+}
+
+/**
+ * Take the chunks that are entirely free out of the super, and the blocks
+ * in them out of its free lists.  The super is locked, the chunks are
+ * returned to delete after it is unlocked.  The current chunk is kept.
+ * Walks the free lists, so it is only done when the free lists of the
+ * super have grown by ALLOC_CHUNK_TRIM since the last time.
+ */
+static struct alloc_chunk*
+sized_trim(struct alloc_cache* sup)
+{
+	struct alloc_chunk** arr, *ch, **prevp, *list = NULL;
+	struct alloc_sized_block* b, **bp;
+	size_t num = 0, i;
+	int c;
+	for(ch = sup->chunks; ch; ch = ch->next)
+		num++;
+	if(num > 1 && (arr = (struct alloc_chunk**)malloc(num*sizeof(*arr)))) {
+		i = 0;
+		for(ch = sup->chunks; ch; ch = ch->next) {
+			ch->free = 0;
+			arr[i++] = ch;
+		}
+		/* so the current chunk is not free */
+		sup->chunks->free = (size_t)-1;
+		qsort(arr, num, sizeof(*arr), chunk_cmp);
+		for(c=0; c<ALLOC_SIZED_CLASSES; c++) {
+			for(b = sup->sized_free[c]; b; b = b->u.next) {
+				if((ch = chunk_find(arr, num, b)) &&
+					ch != sup->chunks)
+					ch->free++;
+			}
+		}
+		for(c=0; c<ALLOC_SIZED_CLASSES; c++) {
+			bp = &sup->sized_free[c];
+			while((b = *bp) != NULL) {
+				if(sized_in_free_chunk(arr, num, b)) {
+					*bp = b->u.next;
+					sup->num_sized_free[c]--;
+				} else	bp = &b->u.next;
+			}
+		}
+		free(arr);
+		prevp = &sup->chunks->next;
+		while((ch = *prevp) != NULL) {
+			if(ch->free == ch->carved) {
+				*prevp = ch->next;
+				ch->next = list;
+				list = ch;
+				sup->sized_total -= ALLOC_CHUNK_SIZE;
+			} else	prevp = &ch->next;
+		}
+	}
+	/* the blocks that are left are in use, try again when this much
+	 * more is free */
+	sup->sized_trim = sized_free_bytes(sup) + ALLOC_CHUNK_TRIM;
+	return list;
+}
+
+/** after blocks went into the free lists of the super, that is locked,
+ * see if chunks can be returned. returns the chunks to delete. */
+static struct alloc_chunk*
+sized_check_trim(struct alloc_cache* sup)
+{
+	if(sized_free_bytes(sup) < sup->sized_trim)
+		return NULL;
+	return sized_trim(sup);
+}
+
+/** return chunks to the system */
+static void
+chunk_delete_list(struct alloc_chunk* list)
+{
+	struct alloc_chunk* ch;
+	while(list) {
+		ch = list;
+		list = ch->next;
+		chunk_delete(ch);
+	}
+}
+
+/** fill the thread free list of a class from the super, false if
+ * out of memory */
+static int
+sized_refill(struct alloc_cache* alloc, int c)
+{
+	struct alloc_cache* sup = alloc->super;
+	size_t num = sized_mag_max(c)/2, f;
+	lock_quick_lock(&sup->lock);
+	if(sup->num_sized_free[c] < num)
+		(void)sized_carve(sup, c, num - sup->num_sized_free[c]);
+	sized_move(sup, alloc, c, num);
+	/* the free blocks are used again, so less is left over */
+	if((f = sized_free_bytes(sup)) + ALLOC_CHUNK_TRIM < sup->sized_trim)
+		sup->sized_trim = f + ALLOC_CHUNK_TRIM;
+	lock_quick_unlock(&sup->lock);
+	return alloc->sized_free[c] != NULL;
+}
+
+/** malloc a block that is too big for the size classes */
+static void*
+sized_large(struct alloc_cache* alloc, size_t size)
+{
+	struct alloc_sized_block* b = (struct alloc_sized_block*)malloc(
+		size + ALLOC_SIZED_HDR);
+	struct alloc_cache* sup;
+	if(!b)
+		return NULL;
+	b->u.size = size + ALLOC_SIZED_HDR;
+	b->check = ALLOC_SIZED_CHECK;
+	if(!alloc) {
+		b->cls = ALLOC_SIZED_HEAP;
+		return (uint8_t*)b + ALLOC_SIZED_HDR;
+	}
+	b->cls = ALLOC_SIZED_LARGE;
+	if(!(sup = alloc->super)) {
+		/* like alloc_special_obtain, the caller locks the super */
+		alloc->sized_total += b->u.size;
+		return (uint8_t*)b + ALLOC_SIZED_HDR;
+	}
+	lock_quick_lock(&sup->lock);
+	sup->sized_total += b->u.size;
+	lock_quick_unlock(&sup->lock);
+	return (uint8_t*)b + ALLOC_SIZED_HDR;
+}
+
+void*
+alloc_sized_obtain(struct alloc_cache* alloc, size_t size)
+{
+	struct alloc_sized_block* b;
+	int c;
+#if defined(UNBOUND_ALLOC_LITE) || defined(UNBOUND_ALLOC_STATS)
+	/* malloc every block, for the memory debug checks */
+	return sized_large(alloc, size);
+#endif
+	if(!alloc || size > ALLOC_SIZED_MAX - ALLOC_SIZED_HDR)
+		return sized_large(alloc, size);
+	/* if alloc is the super, the caller holds its lock, the changes
+	 * below are checked by lock_protect with checklocks */
+	c = sized_class(size + ALLOC_SIZED_HDR);
+	if(!alloc->sized_free[c]) {
+		if(alloc->super) {
+			if(!sized_refill(alloc, c))
+				return NULL;
+		} else if(!sized_carve(alloc, c, 1))
+			return NULL;
+	}
+	b = alloc->sized_free[c];
+	alloc->sized_free[c] = b->u.next;
+	alloc->num_sized_free[c]--;
+	b->cls = (uint32_t)c;
+	b->check = ALLOC_SIZED_CHECK;
+	return (uint8_t*)b + ALLOC_SIZED_HDR;
+}
+
+void
+alloc_sized_release(struct alloc_cache* alloc, void* mem)
+{
+	struct alloc_sized_block* b;
+	struct alloc_chunk* list;
+	int c;
+	if(!mem)
+		return;
+	b = (struct alloc_sized_block*)((uint8_t*)mem - ALLOC_SIZED_HDR);
+	log_assert(b->check == ALLOC_SIZED_CHECK);
+	b->check = 0;
+	if(b->cls == ALLOC_SIZED_HEAP) {
+		free(b);
+		return;
+	}
+	log_assert(alloc);
+	if(b->cls == ALLOC_SIZED_LARGE) {
+		struct alloc_cache* sup = alloc->super?alloc->super:alloc;
+		lock_quick_lock(&sup->lock);
+		sup->sized_total -= b->u.size;
+		lock_quick_unlock(&sup->lock);
+		free(b);
+		return;
+	}
+	c = (int)b->cls;
+	log_assert(c < ALLOC_SIZED_CLASSES);
+	if(!alloc->super) {
+		/* put it in the free lists of the thread, if it set them */
+		struct alloc_cache* t = (struct alloc_cache*)ub_thread_key_get(
+			alloc_thread_key);
+		if(t && t->super == alloc)
+			alloc = t;
+	}
+	if(!alloc->super)
+		lock_quick_lock(&alloc->lock);
+	b->u.next = alloc->sized_free[c];
+	alloc->sized_free[c] = b;
+	alloc->num_sized_free[c]++;
+	if(!alloc->super) {
+		list = sized_check_trim(alloc);
+		lock_quick_unlock(&alloc->lock);
+		chunk_delete_list(list);
+	} else if(alloc->num_sized_free[c] > sized_mag_max(c)) {
+		/* give half back, 1 lock per mag/2 releases */
+		lock_quick_lock(&alloc->super->lock);
+		sized_move(alloc, alloc->super, c, sized_mag_max(c)/2);
+		list = sized_check_trim(alloc->super);
+		lock_quick_unlock(&alloc->super->lock);
+		chunk_delete_list(list);
+	}
+}
+
+size_t
+alloc_sized_size(size_t size)
+{
+#if defined(UNBOUND_ALLOC_LITE) || defined(UNBOUND_ALLOC_STATS)
+	return size + ALLOC_SIZED_HDR;
+#else
+	if(size > ALLOC_SIZED_MAX - ALLOC_SIZED_HDR)
+		return size + ALLOC_SIZED_HDR;
+	return sized_class_size(sized_class(size + ALLOC_SIZED_HDR));
+#endif
+}
+
+size_t
+alloc_sized_total(struct alloc_cache* alloc)
+{
+	size_t s;
+	lock_quick_lock(&alloc->lock);
+	s = alloc->sized_total;
+	lock_quick_unlock(&alloc->lock);
+	return s;
+}
+
+/** give the cache memory blocks to the super, or for the super, free
+ * the chunks */
+static void
+sized_clear(struct alloc_cache* alloc)
+{
+	int c;
+	if(alloc->super) {
+		if(alloc_key_created && ub_thread_key_get(alloc_thread_key) ==
+			alloc)
+			ub_thread_key_set(alloc_thread_key, NULL);
+		lock_quick_lock(&alloc->super->lock);
+		for(c=0; c<ALLOC_SIZED_CLASSES; c++)
+			sized_move(alloc, alloc->super, c,
+				alloc->num_sized_free[c]);
+		lock_quick_unlock(&alloc->super->lock);
+		return;
+	}
+	/* the cache entries have been deleted, blocks in use by others
+	 * would have to be released first */
+	while(alloc->chunks) {
+		struct alloc_chunk* ch = alloc->chunks;
+		alloc->chunks = ch->next;
+		chunk_delete(ch);
 	}
+	for(c=0; c<ALLOC_SIZED_CLASSES; c++) {
+		alloc->sized_free[c] = NULL;
+		alloc->num_sized_free[c] = 0;
+	}
+	alloc->chunk_cur = NULL;
+	alloc->chunk_end = NULL;
+	alloc->sized_total = 0;
 }
 
 void 
@@ -167,6 +682,7 @@ alloc_clear(struct alloc_cache* alloc)
 	}
 	alloc->reg_list = NULL;
 	alloc->num_reg_blocks = 0;
+	sized_clear(alloc);
 }
 
 uint64_t
@@ -281,14 +797,21 @@ alloc_special_release(struct alloc_cache* alloc, alloc_special_type* mem)
 void 
 alloc_stats(struct alloc_cache* alloc)
 {
-	log_info("%salloc: %d in cache, %d blocks.", alloc->super?"":"sup",
-		(int)alloc->num_quar, (int)alloc->num_reg_blocks);
+	size_t n = 0;
+	int c;
+	for(c=0; c<ALLOC_SIZED_CLASSES; c++)
+		n += alloc->num_sized_free[c];
+	log_info("%salloc: %d in cache, %d blocks, %d free sized blocks, "
+		"%u chunk bytes.", alloc->super?"":"sup", (int)alloc->num_quar,
+		(int)alloc->num_reg_blocks, (int)n,
+		(unsigned)alloc->sized_total);
 }
 
 size_t alloc_get_mem(struct alloc_cache* alloc)
 {
 	alloc_special_type* p;
 	size_t s = sizeof(*alloc);
+	int c;
 	if(!alloc->super) { 
 		lock_quick_lock(&alloc->lock); /* superalloc needs locking */
 	}
@@ -297,12 +820,26 @@ size_t alloc_get_mem(struct alloc_cache* alloc)
 		s += lock_get_mem(&p->entry.lock);
 	}
 	s += alloc->num_reg_blocks * ALLOC_REG_SIZE;
+	for(c=0; c<ALLOC_SIZED_CLASSES; c++)
+		s += alloc->num_sized_free[c] * sized_class_size(c);
 	if(!alloc->super) {
+		/* the part of the chunk that is not carved up yet */
+		s += (size_t)(alloc->chunk_end - alloc->chunk_cur);
 		lock_quick_unlock(&alloc->lock);
 	}
 	return s;
 }
 
+size_t alloc_get_free_mem(struct alloc_cache* alloc)
+{
+	size_t s = sizeof(alloc_special_type) * alloc->num_quar;
+	int c;
+	s += alloc->num_reg_blocks * ALLOC_REG_SIZE;
+	for(c=0; c<ALLOC_SIZED_CLASSES; c++)
+		s += alloc->num_sized_free[c] * sized_class_size(c);
+	return s;
+}
+
 struct regional* 
 alloc_reg_obtain(struct alloc_cache* alloc)
 {
@@ -42,6 +42,9 @@
  *	o Avoid locking costs of getting global lock to call malloc().
  *	o The packed rrset type needs to be kept on special freelists,
  *	  so that they are reused for other packet rrset allocations.
+ *	o The memory of cache entries (rrset data, reply info) comes from
+ *	  size classes, carved from big (huge page) chunks, so that churn
+ *	  in the cache does not fragment the heap.
  *
  */
 
@@ -51,6 +54,8 @@
 #include "util/locks.h"
 struct ub_packed_rrset_key;
 struct regional;
+struct alloc_sized_block;
+struct alloc_chunk;
 
 /** The special type, packed rrset. Not allowed to be used for other memory */
 typedef struct ub_packed_rrset_key alloc_special_type;
@@ -65,6 +70,21 @@ typedef struct ub_packed_rrset_key alloc_special_type;
 /** how many blocks to cache locally. */
 #define ALLOC_SPECIAL_MAX 10
 
+/** number of size classes for cache memory blocks */
+#define ALLOC_SIZED_CLASSES 36
+/** largest block (including its header) served from the size classes,
+ * bigger blocks are malloced */
+#define ALLOC_SIZED_MAX 16384
+/** size of the header in front of every cache memory block */
+#define ALLOC_SIZED_HDR 16
+/** size of the chunks that the size classes are carved from, the size
+ * of a huge page */
+#define ALLOC_CHUNK_SIZE (2*1024*1024)
+/** free cache memory in the super, above the amount that could not be
+ * returned the last time, at which it returns the chunks that are
+ * entirely free to the system */
+#define ALLOC_CHUNK_TRIM (4*ALLOC_CHUNK_SIZE)
+
 /**
  * Structure that provides allocation. Use one per thread.
  * The one on top has a NULL super pointer.
@@ -95,6 +115,24 @@ struct alloc_cache {
 	size_t num_reg_blocks;
 	/** linked list of regional blocks, using regional->next */
 	struct regional* reg_list;
+
+	/** free lists of cache memory blocks, per size class. For a thread
+	 * these are its magazines, for the super it is the global depot */
+	struct alloc_sized_block* sized_free[ALLOC_SIZED_CLASSES];
+	/** number of blocks in each of the free lists */
+	size_t num_sized_free[ALLOC_SIZED_CLASSES];
+	/** list of chunks that blocks are carved from (super only) */
+	struct alloc_chunk* chunks;
+	/** start of the unused part of the current chunk (super only) */
+	uint8_t* chunk_cur;
+	/** end of the current chunk (super only) */
+	uint8_t* chunk_end;
+	/** bytes of cache memory from the system, in chunks and in big
+	 * malloced blocks (super only) */
+	size_t sized_total;
+	/** free bytes in the super free lists at which the free chunks are
+	 * returned to the system (super only) */
+	size_t sized_trim;
 };
 
 /**
@@ -131,6 +169,56 @@ alloc_special_type* alloc_special_obtain(struct alloc_cache* alloc);
  */
 void alloc_special_release(struct alloc_cache* alloc, alloc_special_type* mem);
 
+/**
+ * Get a block of cache memory, for the data of a cache entry.
+ * The block comes from a size class, these are cached per thread.
+ * Like alloc_special_obtain, if alloc is the super, the caller must hold
+ * the lock of the super.  The super is lock_protected, so lock checking
+ * builds catch a caller that does not.
+ * @param alloc: where to alloc it. If NULL, the block is malloced.
+ * @param size: size of the block in bytes.
+ * @return: memory block, not zeroed, or NULL on alloc failure.
+ */
+void* alloc_sized_obtain(struct alloc_cache* alloc, size_t size);
+
+/**
+ * Return a block of cache memory back to the pool.
+ * Like alloc_special_release, it locks the super itself when it needs it,
+ * so the caller must not hold the lock of the super.  If the alloc is the
+ * super, and the thread has set its alloc with alloc_set_thread, the
+ * block goes to the free lists of the thread, that give the blocks back
+ * in batches.  Chunks that are entirely free are returned to the system
+ * when the super collects many free blocks.
+ * @param alloc: where to put it, the thread allocator or the super.
+ * @param mem: block from alloc_sized_obtain, or NULL.
+ */
+void alloc_sized_release(struct alloc_cache* alloc, void* mem);
+
+/**
+ * Set the thread alloc of the calling thread, for the cache memory blocks
+ * that the thread releases to the super, for example when a cache entry
+ * is deleted with the super as the callback argument of the cache.
+ * alloc_clear of the thread alloc unsets it.
+ * @param alloc: the thread alloc, it has a super.
+ */
+void alloc_set_thread(struct alloc_cache* alloc);
+
+/**
+ * Memory that is used for a block from alloc_sized_obtain, the size of
+ * its size class (including the header). Used by the cache size functions.
+ * @param size: the size that is requested.
+ * @return size in bytes.
+ */
+size_t alloc_sized_size(size_t size);
+
+/**
+ * Get the number of bytes of cache memory that the allocator obtained
+ * from the system, used and free, in chunks and in malloced blocks.
+ * @param alloc: the super alloc.
+ * @return size in bytes.
+ */
+size_t alloc_sized_total(struct alloc_cache* alloc);
+
 /**
  * Set ID number of special type to a fresh new ID number.
  * In case of ID number overflow, the rrset cache has to be cleared.
@@ -140,12 +228,23 @@ void alloc_special_release(struct alloc_cache* alloc, alloc_special_type* mem);
 uint64_t alloc_get_id(struct alloc_cache* alloc);
 
 /**
- * Get memory size of alloc cache, alloc structure including special types.
+ * Get memory size of alloc cache, alloc structure including special types,
+ * and the free cache memory blocks (and the unused chunk part).
  * @param alloc: on what alloc.
  * @return size in bytes.
  */
 size_t alloc_get_mem(struct alloc_cache* alloc);
 
+/**
+ * Get the memory size of the free cache memory blocks and regions of a
+ * thread alloc cache. This only reads the counters, it does not walk the
+ * lists or lock, so it can be called from another thread than the one
+ * that owns the cache, and the value is then approximate.
+ * @param alloc: on what alloc.
+ * @return size in bytes.
+ */
+size_t alloc_get_free_mem(struct alloc_cache* alloc);
+
 /**
  * Print debug information (statistics).
  * @param alloc: on what alloc.
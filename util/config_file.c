@@ -91,6 +91,9 @@ config_create(void)
 	cfg->stat_interval = 0;
 	cfg->stat_cumulative = 0;
 	cfg->stat_extended = 0;
+	cfg->metrics_enable = 0;
+	cfg->metrics_ifs = NULL;
+	cfg->metrics_port = UNBOUND_METRICS_PORT;
 	cfg->num_threads = 1;
 	cfg->port = UNBOUND_DNS_PORT;
 	cfg->do_ip4 = 1;
@@ -109,6 +112,9 @@ config_create(void)
 	cfg->log_time_ascii = 0;
 	cfg->log_queries = 0;
 	cfg->log_replies = 0;
+	cfg->log_async = 0;
+	cfg->log_async_size = 4096;
+	cfg->log_binary_file = NULL;
 #ifndef USE_WINSOCK
 #  ifdef USE_MINI_EVENT
 	/* select max 1024 sockets */
@@ -132,6 +138,9 @@ config_create(void)
 	cfg->msg_cache_size = 4 * 1024 * 1024;
 	cfg->msg_cache_slabs = 4;
 	cfg->jostle_time = 200;
+	cfg->mesh_client_quota = 0;
+	cfg->mesh_zone_quota = 0;
+	cfg->mesh_prefetch_reserve = 0;
 	cfg->rrset_cache_size = 4 * 1024 * 1024;
 	cfg->rrset_cache_slabs = 4;
 	cfg->host_ttl = 900;
@@ -144,7 +153,12 @@ config_create(void)
 	cfg->infra_cache_slabs = 4;
 	cfg->infra_cache_numhosts = 10000;
 	cfg->infra_cache_min_rtt = 50;
+	cfg->hedge_percentile = 0;
+	cfg->hedge_budget = 5;
 	cfg->delay_close = 0;
+	cfg->outgoing_udp_pool = 0;
+	cfg->outgoing_udp_pool_rotate = 60;
+	cfg->outgoing_udp_pool_uses = 16;
 	if(!(cfg->outgoing_avail_ports = (int*)calloc(65536, sizeof(int))))
 		goto error_exit;
 	init_outgoing_availports(cfg->outgoing_avail_ports, 65536);
@@ -156,6 +170,7 @@ config_create(void)
 	if(!(cfg->logfile = strdup(""))) goto error_exit;
 	if(!(cfg->pidfile = strdup(PIDFILE))) goto error_exit;
 	if(!(cfg->target_fetch_policy = strdup("3 2 1 0 0"))) goto error_exit;
+	cfg->target_fetch_parallel = 0;
 	cfg->donotqueryaddrs = NULL;
 	cfg->donotquery_localhost = 1;
 	cfg->root_hints = NULL;
@@ -214,6 +229,7 @@ config_create(void)
 	cfg->key_cache_size = 4 * 1024 * 1024;
 	cfg->key_cache_slabs = 4;
 	cfg->neg_cache_size = 1 * 1024 * 1024;
+	cfg->nsec3_hash_cache_size = 1 * 1024 * 1024;
 	cfg->local_zones = NULL;
 	cfg->local_zones_nodefault = NULL;
 	cfg->local_data = NULL;
@@ -221,6 +237,7 @@ config_create(void)
 	cfg->unblock_lan_zones = 0;
 	cfg->insecure_lan_zones = 0;
 	cfg->python_script = NULL;
+	cfg->dynlib_file = NULL;
 	cfg->remote_control_enable = 0;
 	cfg->control_ifs = NULL;
 	cfg->control_port = UNBOUND_CONTROL_PORT;
@@ -255,6 +272,10 @@ config_create(void)
 	cfg->ratelimit_below_domain = NULL;
 	cfg->ip_ratelimit_factor = 10;
 	cfg->ratelimit_factor = 10;
+	cfg->rrl_ratelimit = 0;
+	cfg->rrl_slip = 2;
+	cfg->rrl_size = 16*1024*1024;
+	cfg->rrl_slabs = 64;
 	cfg->qname_minimisation = 0;
 	cfg->qname_minimisation_strict = 0;
 	cfg->shm_enable 	= 1;
@@ -285,6 +306,7 @@ struct config_file* config_create_forlib(void)
 	cfg->key_cache_size = 1024*1024;
 	cfg->key_cache_slabs = 1;
 	cfg->neg_cache_size = 100 * 1024;
+	cfg->nsec3_hash_cache_size = 100 * 1024;
 	cfg->donotquery_localhost = 0; /* allow, so that you can ask a
 		forward nameserver running on localhost */
 	cfg->val_log_level = 2; /* to fill why_bogus with */
@@ -345,9 +367,11 @@ int config_set_option(struct config_file* cfg, const char* opt,
 		else if(atoi(val) == 0)
 			return 0;
 		else cfg->stat_interval = atoi(val);
-	} else if(strcmp(opt, "num_threads:") == 0) {
-		/* not supported, library must have 1 thread in bgworker */
-		return 0;
+	} else if(strcmp(opt, "num-threads:") == 0) {
+		/* for the library, the number of bg worker threads */
+		if(atoi(val) < 1 || atoi(val) > CFG_MAX_THREADS)
+			return 0;
+		cfg->num_threads = atoi(val);
 	} else if(strcmp(opt, "outgoing-port-permit:") == 0) {
 		return cfg_mark_ports(val, 1, 
 			cfg->outgoing_avail_ports, 65536);
@@ -382,6 +406,9 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_STR("log-identity:", log_identity)
 	else S_YNO("extended-statistics:", stat_extended)
 	else S_YNO("statistics-cumulative:", stat_cumulative)
+	else S_YNO("metrics-enable:", metrics_enable)
+	else S_STRLIST("metrics-interface:", metrics_ifs)
+	else S_NUMBER_NONZERO("metrics-port:", metrics_port)
 	else S_YNO("do-ip4:", do_ip4)
 	else S_YNO("do-ip6:", do_ip6)
 	else S_YNO("do-udp:", do_udp)
@@ -406,6 +433,9 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_POW2("msg-cache-slabs:", msg_cache_slabs)
 	else S_SIZET_NONZERO("num-queries-per-thread:",num_queries_per_thread)
 	else S_SIZET_OR_ZERO("jostle-timeout:", jostle_time)
+	else S_SIZET_OR_ZERO("mesh-client-quota:", mesh_client_quota)
+	else S_SIZET_OR_ZERO("mesh-zone-quota:", mesh_zone_quota)
+	else S_SIZET_OR_ZERO("mesh-prefetch-reserve:", mesh_prefetch_reserve)
 	else S_MEMSIZE("so-rcvbuf:", so_rcvbuf)
 	else S_MEMSIZE("so-sndbuf:", so_sndbuf)
 	else S_YNO("so-reuseport:", so_reuseport)
@@ -425,10 +455,23 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	    IS_NUMBER_OR_ZERO; cfg->infra_cache_min_rtt = atoi(val);
 	    RTT_MIN_TIMEOUT=cfg->infra_cache_min_rtt;
 	}
+	else if(strcmp(opt, "hedge-percentile:") == 0) {
+	    IS_NUMBER_OR_ZERO; if(atoi(val) > 99) return 0;
+	    cfg->hedge_percentile = atoi(val);
+	}
+	else if(strcmp(opt, "hedge-budget:") == 0) {
+	    IS_NUMBER_OR_ZERO; if(atoi(val) > 100) return 0;
+	    cfg->hedge_budget = atoi(val);
+	}
 	else S_NUMBER_OR_ZERO("infra-host-ttl:", host_ttl)
 	else S_POW2("infra-cache-slabs:", infra_cache_slabs)
 	else S_SIZET_NONZERO("infra-cache-numhosts:", infra_cache_numhosts)
 	else S_NUMBER_OR_ZERO("delay-close:", delay_close)
+	else S_NUMBER_OR_ZERO("outgoing-udp-pool:", outgoing_udp_pool)
+	else S_NUMBER_OR_ZERO("outgoing-udp-pool-rotate:",
+		outgoing_udp_pool_rotate)
+	else S_NUMBER_OR_ZERO("outgoing-udp-pool-uses:",
+		outgoing_udp_pool_uses)
 	else S_STR("chroot:", chrootdir)
 	else S_STR("username:", username)
 	else S_STR("directory:", directory)
@@ -439,6 +482,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_STR("version:", version)
 	else S_STRLIST("root-hints:", root_hints)
 	else S_STR("target-fetch-policy:", target_fetch_policy)
+	else S_YNO("target-fetch-parallel:", target_fetch_parallel)
 	else S_YNO("harden-glue:", harden_glue)
 	else S_YNO("harden-short-bufsize:", harden_short_bufsize)
 	else S_YNO("harden-large-queries:", harden_large_queries)
@@ -466,6 +510,9 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("val-log-squelch:", val_log_squelch)
 	else S_YNO("log-queries:", log_queries)
 	else S_YNO("log-replies:", log_replies)
+	else S_YNO("log-async:", log_async)
+	else S_SIZET_NONZERO("log-async-size:", log_async_size)
+	else S_STR("log-binary-file:", log_binary_file)
 	else S_YNO("val-permissive-mode:", val_permissive_mode)
 	else S_YNO("ignore-cd-flag:", ignore_cd)
 	else S_YNO("serve-expired:", serve_expired)
@@ -479,6 +526,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_MEMSIZE("key-cache-size:", key_cache_size)
 	else S_POW2("key-cache-slabs:", key_cache_slabs)
 	else S_MEMSIZE("neg-cache-size:", neg_cache_size)
+	else S_MEMSIZE("nsec3-hash-cache-size:", nsec3_hash_cache_size)
 	else S_YNO("minimal-responses:", minimal_responses)
 	else S_YNO("rrset-roundrobin:", rrset_roundrobin)
 	else S_STRLIST("local-data:", local_data)
@@ -493,6 +541,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_STR("control-cert-file:", control_cert_file)
 	else S_STR("module-config:", module_conf)
 	else S_STR("python-script:", python_script)
+	else S_STR("dynlib-file:", dynlib_file)
 	else S_YNO("disable-dnssec-lame-check:", disable_dnssec_lame_check)
 	else if(strcmp(opt, "ip-ratelimit:") == 0) {
 	    IS_NUMBER_OR_ZERO; cfg->ip_ratelimit = atoi(val);
@@ -508,6 +557,10 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_POW2("ratelimit-slabs:", ratelimit_slabs)
 	else S_NUMBER_OR_ZERO("ip-ratelimit-factor:", ip_ratelimit_factor)
 	else S_NUMBER_OR_ZERO("ratelimit-factor:", ratelimit_factor)
+	else S_NUMBER_OR_ZERO("rrl-ratelimit:", rrl_ratelimit)
+	else S_NUMBER_OR_ZERO("rrl-slip:", rrl_slip)
+	else S_MEMSIZE("rrl-size:", rrl_size)
+	else S_POW2("rrl-slabs:", rrl_slabs)
 	else S_YNO("qname-minimisation:", qname_minimisation)
 	else S_YNO("qname-minimisation-strict:", qname_minimisation_strict)
 	else if(strcmp(opt, "define-tag:") ==0) {
@@ -699,6 +752,9 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "statistics-interval", stat_interval)
 	else O_YNO(opt, "statistics-cumulative", stat_cumulative)
 	else O_YNO(opt, "extended-statistics", stat_extended)
+	else O_YNO(opt, "metrics-enable", metrics_enable)
+	else O_DEC(opt, "metrics-port", metrics_port)
+	else O_LST(opt, "metrics-interface", metrics_ifs)
 	else O_YNO(opt, "use-syslog", use_syslog)
 	else O_STR(opt, "log-identity", log_identity)
 	else O_YNO(opt, "log-time-ascii", log_time_ascii)
@@ -716,6 +772,9 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "msg-cache-slabs", msg_cache_slabs)
 	else O_DEC(opt, "num-queries-per-thread", num_queries_per_thread)
 	else O_UNS(opt, "jostle-timeout", jostle_time)
+	else O_UNS(opt, "mesh-client-quota", mesh_client_quota)
+	else O_UNS(opt, "mesh-zone-quota", mesh_zone_quota)
+	else O_UNS(opt, "mesh-prefetch-reserve", mesh_prefetch_reserve)
 	else O_MEM(opt, "so-rcvbuf", so_rcvbuf)
 	else O_MEM(opt, "so-sndbuf", so_sndbuf)
 	else O_YNO(opt, "so-reuseport", so_reuseport)
@@ -731,8 +790,13 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "infra-host-ttl", host_ttl)
 	else O_DEC(opt, "infra-cache-slabs", infra_cache_slabs)
 	else O_DEC(opt, "infra-cache-min-rtt", infra_cache_min_rtt)
+	else O_DEC(opt, "hedge-percentile", hedge_percentile)
+	else O_DEC(opt, "hedge-budget", hedge_budget)
 	else O_MEM(opt, "infra-cache-numhosts", infra_cache_numhosts)
 	else O_UNS(opt, "delay-close", delay_close)
+	else O_DEC(opt, "outgoing-udp-pool", outgoing_udp_pool)
+	else O_DEC(opt, "outgoing-udp-pool-rotate", outgoing_udp_pool_rotate)
+	else O_DEC(opt, "outgoing-udp-pool-uses", outgoing_udp_pool_uses)
 	else O_YNO(opt, "do-ip4", do_ip4)
 	else O_YNO(opt, "do-ip6", do_ip6)
 	else O_YNO(opt, "do-udp", do_udp)
@@ -752,12 +816,16 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_STR(opt, "logfile", logfile)
 	else O_YNO(opt, "log-queries", log_queries)
 	else O_YNO(opt, "log-replies", log_replies)
+	else O_YNO(opt, "log-async", log_async)
+	else O_DEC(opt, "log-async-size", log_async_size)
+	else O_STR(opt, "log-binary-file", log_binary_file)
 	else O_STR(opt, "pidfile", pidfile)
 	else O_YNO(opt, "hide-identity", hide_identity)
 	else O_YNO(opt, "hide-version", hide_version)
 	else O_STR(opt, "identity", identity)
 	else O_STR(opt, "version", version)
 	else O_STR(opt, "target-fetch-policy", target_fetch_policy)
+	else O_YNO(opt, "target-fetch-parallel", target_fetch_parallel)
 	else O_YNO(opt, "harden-short-bufsize", harden_short_bufsize)
 	else O_YNO(opt, "harden-large-queries", harden_large_queries)
 	else O_YNO(opt, "harden-glue", harden_glue)
@@ -785,6 +853,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_MEM(opt, "key-cache-size", key_cache_size)
 	else O_DEC(opt, "key-cache-slabs", key_cache_slabs)
 	else O_MEM(opt, "neg-cache-size", neg_cache_size)
+	else O_MEM(opt, "nsec3-hash-cache-size", nsec3_hash_cache_size)
 	else O_YNO(opt, "control-enable", remote_control_enable)
 	else O_DEC(opt, "control-port", control_port)
 	else O_STR(opt, "server-key-file", server_key_file)
@@ -810,6 +879,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "insecure-lan-zones", insecure_lan_zones)
 	else O_DEC(opt, "max-udp-size", max_udp_size)
 	else O_STR(opt, "python-script", python_script)
+	else O_STR(opt, "dynlib-file", dynlib_file)
 	else O_YNO(opt, "disable-dnssec-lame-check", disable_dnssec_lame_check)
 	else O_DEC(opt, "ip-ratelimit", ip_ratelimit)
 	else O_DEC(opt, "ratelimit", ratelimit)
@@ -821,6 +891,10 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_LS2(opt, "ratelimit-below-domain", ratelimit_below_domain)
 	else O_DEC(opt, "ip-ratelimit-factor", ip_ratelimit_factor)
 	else O_DEC(opt, "ratelimit-factor", ratelimit_factor)
+	else O_DEC(opt, "rrl-ratelimit", rrl_ratelimit)
+	else O_DEC(opt, "rrl-slip", rrl_slip)
+	else O_MEM(opt, "rrl-size", rrl_size)
+	else O_DEC(opt, "rrl-slabs", rrl_slabs)
 	else O_DEC(opt, "val-sig-skew-min", val_sig_skew_min)
 	else O_DEC(opt, "val-sig-skew-max", val_sig_skew_max)
 	else O_YNO(opt, "qname-minimisation", qname_minimisation)
@@ -1078,6 +1152,7 @@ config_delete(struct config_file* cfg)
 	free(cfg->ssl_service_key);
 	free(cfg->ssl_service_pem);
 	free(cfg->log_identity);
+	free(cfg->log_binary_file);
 	config_del_strarray(cfg->ifs, cfg->num_ifs);
 	config_del_strarray(cfg->out_ifs, cfg->num_out_ifs);
 	config_delstubs(cfg->stubs);
@@ -1111,10 +1186,12 @@ config_delete(struct config_file* cfg)
 	config_deltrplstrlist(cfg->acl_tag_actions);
 	config_deltrplstrlist(cfg->acl_tag_datas);
 	config_delstrlist(cfg->control_ifs);
+	config_delstrlist(cfg->metrics_ifs);
 	free(cfg->server_key_file);
 	free(cfg->server_cert_file);
 	free(cfg->control_key_file);
 	free(cfg->control_cert_file);
+	free(cfg->dynlib_file);
 	free(cfg->dns64_prefix);
 	free(cfg->dnstap_socket_path);
 	free(cfg->dnstap_identity);
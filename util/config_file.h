@@ -52,6 +52,9 @@ struct sock_list;
 struct ub_packed_rrset_key;
 struct regional;
 
+/** the largest num-threads value, for the daemon and for the library */
+#define CFG_MAX_THREADS 10000
+
 /**
  * The configuration options.
  * Strings are malloced.
@@ -66,6 +69,12 @@ struct config_file {
 	int stat_cumulative;
 	/** if true, the statistics are kept in greater detail */
 	int stat_extended;
+	/** if the metrics (OpenMetrics over HTTP) endpoint is enabled */
+	int metrics_enable;
+	/** the interfaces the metrics endpoint binds to */
+	struct config_strlist* metrics_ifs;
+	/** port number for the metrics endpoint */
+	int metrics_port;
 
 	/** number of threads to create */
 	int num_threads;
@@ -119,6 +128,12 @@ struct config_file {
 	size_t num_queries_per_thread;
 	/** number of msec to wait before items can be jostled out */
 	size_t jostle_time;
+	/** max reply states per client subnet in a thread, 0 is no quota */
+	size_t mesh_client_quota;
+	/** max reply states per zone in a thread, 0 is no quota */
+	size_t mesh_zone_quota;
+	/** reply states that only prefetches can use */
+	size_t mesh_prefetch_reserve;
 	/** size of the rrset cache */
 	size_t rrset_cache_size;
 	/** slabs in the rrset cache */
@@ -131,11 +146,24 @@ struct config_file {
 	size_t infra_cache_numhosts;
 	/** min value for infra cache rtt */
 	int infra_cache_min_rtt;
+	/** rtt percentile after which a hedged query is sent, 0 is off */
+	int hedge_percentile;
+	/** max percentage of upstream queries that are hedged queries */
+	int hedge_budget;
 	/** delay close of udp-timeouted ports, if 0 no delayclose. in msec */
 	int delay_close;
+	/** number of UDP sockets per outgoing interface kept open, 0 off */
+	int outgoing_udp_pool;
+	/** seconds after which a UDP pool socket moves to a new port */
+	int outgoing_udp_pool_rotate;
+	/** queries after which a UDP pool socket moves to a new port */
+	int outgoing_udp_pool_uses;
 
 	/** the target fetch policy for the iterator */
 	char* target_fetch_policy;
+	/** fetch A and AAAA of all missing targets at once, use the first
+	 * address that arrives and cancel the other lookups */
+	int target_fetch_parallel;
 
 	/** automatic interface for incoming messages. Uses ipv6 remapping,
 	 * and recvmsg/sendmsg ancillary data to detect interfaces, boolean */
@@ -231,6 +259,12 @@ struct config_file {
 	int log_queries;
 	/** log replies with one line per reply */
 	int log_replies;
+	/** log queries and replies from a log thread, not the workers */
+	int log_async;
+	/** number of records in the asynchronous log ring per thread */
+	size_t log_async_size;
+	/** file for the binary query and reply log, or NULL */
+	char* log_binary_file;
 	/** log identity to report */
 	char* log_identity;
 
@@ -298,6 +332,8 @@ struct config_file {
 	size_t key_cache_slabs;
 	/** size of the neg cache */
 	size_t neg_cache_size;
+	/** size of the NSEC3 hash cache, 0 to disable */
+	size_t nsec3_hash_cache_size;
 
 	/** local zones config */
 	struct config_str2list* local_zones;
@@ -345,6 +381,8 @@ struct config_file {
 
 	/** Python script file */
 	char* python_script;
+	/** the plugin file for the dynlib module */
+	char* dynlib_file;
 
 	/** Use systemd socket activation. */
 	int use_systemd;
@@ -404,6 +442,14 @@ struct config_file {
 	size_t ip_ratelimit_size;
 	/** ip_ratelimit factor, 0 blocks all, 10 allows 1/10 of traffic */
 	int ip_ratelimit_factor;
+	/** response rate limit per client network and response, 0 is off */
+	int rrl_ratelimit;
+	/** every nth rate limited response is truncated, 0 drops all */
+	int rrl_slip;
+	/** memory size in bytes for the response rate limit table */
+	size_t rrl_size;
+	/** number of lock stripes of the response rate limit table */
+	size_t rrl_slabs;
 
 	/** ratelimit for domains. 0 is off, otherwise qps (unless overridden) */
 	int ratelimit;
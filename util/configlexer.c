@@ -378,8 +378,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 203
-#define YY_END_OF_BUFFER 204
+#define YY_NUM_RULES 225
+#define YY_END_OF_BUFFER 226
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -387,228 +387,252 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[1997] =
+static yyconst flex_int16_t yy_accept[2213] =
     {   0,
-        1,    1,  185,  185,  189,  189,  193,  193,  197,  197,
-        1,    1,  204,  201,    1,  183,  183,  202,    2,  202,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      185,  186,  186,  187,  202,  189,  190,  190,  191,  202,
-      196,  193,  194,  194,  195,  202,  197,  198,  198,  199,
-      202,  200,  184,    2,  188,  202,  200,  201,    0,    1,
-        2,    2,    2,    2,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  185,    0,
-      189,    0,  196,    0,  193,  197,    0,  200,    0,    2,
-        2,  200,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-
-      201,  201,  201,  201,  201,  201,  201,  201,  200,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  200,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,   77,  201,  201,  201,  201,  201,  201,    8,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,   88,  200,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  200,  201,  201,  201,  201,  201,   37,  201,
-
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  159,
-      201,   14,   15,  201,   18,   17,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  145,  201,  201,  201,  201,  201,  201,  201,
-      201,    3,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-
-      201,  201,  201,  201,  201,  200,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  192,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,   40,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,   41,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-
-      201,  201,  201,   20,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,   96,  201,  192,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  112,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-       95,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-
-      201,  201,  201,   75,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,   25,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,   38,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,   39,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-
-       28,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  174,  201,  201,  201,  201,
-      201,  201,  201,   32,  201,   33,  201,  201,  201,   78,
-      201,   79,  201,  201,   76,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,    7,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  152,  201,  201,  201,
-      201,   98,  201,  201,  201,  201,  201,  201,  201,  201,
-
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,   29,  201,  201,  201,
-      201,  201,  201,  201,  128,  201,  127,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,   16,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,   42,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,   81,   80,  201,  201,  201,
-      201,  201,  201,  201,  201,  122,  201,  201,  201,  201,
-      201,  201,  201,  201,   89,  201,  201,  201,  201,  201,
-
-      201,  201,  201,  201,  201,  201,  201,  201,  201,   60,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,   64,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,   36,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  125,
-      126,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-        6,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-
-      201,  201,  201,  201,  201,  201,   26,  201,  201,  201,
-      201,  201,  201,  201,  201,  118,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  138,  201,  119,  201,  201,
-      150,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,   27,  201,  201,  201,  201,   84,  201,   85,  201,
-       83,  201,  201,  201,  201,  201,  201,  201,   94,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      173,  201,  201,  120,  201,  201,  201,  201,  201,  123,
-      201,  149,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,   74,  201,  201,  201,  201,
-
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,   34,  201,  201,   22,  201,  201,  201,  201,   19,
-      201,  103,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,   49,   51,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  160,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,   86,  201,  201,  201,  201,  201,  201,  201,   93,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,   97,  201,  201,  201,  201,  201,  201,  201,  201,
-
-      201,  201,  201,  201,  201,  144,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  111,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      107,  201,  113,  201,  201,  201,  201,  201,   92,  201,
-      201,   70,  201,  136,  201,  201,  201,  201,  201,  151,
-      201,  201,  201,  201,  201,  201,  201,  165,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      110,  201,  201,  201,  201,  201,   52,   53,  201,  201,
-      201,  201,  201,   35,   59,  114,  201,  129,  201,  153,
-      124,  201,  201,   45,  201,  116,  201,  201,  201,  201,
-
-      201,    9,  201,  201,  201,   73,  201,  201,  201,  201,
-      178,  201,  135,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,   99,  164,  201,  201,  201,  201,
-      201,  201,  201,  201,  146,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  115,  201,  201,   44,   46,  201,
-      201,  201,  201,  201,  201,  201,   72,  201,  201,  201,
-      201,  176,  201,  201,  201,  201,  140,   23,   24,  201,
-
-      201,  201,  201,  201,  201,  201,  201,   69,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      142,  139,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,   43,  201,  201,  201,  201,  201,  201,  201,  201,
-       13,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,   12,  201,  201,   21,  201,  201,
-      201,  182,  201,   47,  201,  148,  141,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  106,
-      105,  201,  201,  201,  201,  143,  137,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-
-      201,  201,  201,  201,  201,  201,  201,   54,  201,  201,
-      201,  177,  201,  201,  147,  201,  201,  201,  201,  201,
-      201,  201,  201,   48,  201,  201,   82,  201,  100,  102,
-      130,  201,  201,  201,  104,  201,  201,  154,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  161,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  131,  201,  201,  175,  201,  201,   30,  201,
-      201,  201,  201,    4,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  157,  201,  201,  201,  201,
-      201,  201,  201,  201,  163,  201,  201,  134,  201,  201,
-
-      201,  201,  201,  201,  201,  201,   57,  201,   31,  181,
-      158,  201,   11,  201,  201,  201,  201,  201,  201,  132,
-       61,  201,  201,  201,  109,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  162,   90,  201,   87,  201,
-      201,  201,   63,   67,   62,  201,   55,  201,   10,  201,
-      201,  201,  179,  201,  201,  108,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,   68,
-       66,  201,   56,  201,  121,  201,  201,  133,  201,  201,
-      201,  201,  101,   50,  201,  201,  201,  201,  201,  201,
-      201,   91,   65,   58,  201,  180,  201,  201,  201,  156,
-
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,   71,
-      201,  155,  172,  201,  201,  201,  201,  201,  201,    5,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  117,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      168,  201,  201,  201,  201,  201,  201,  201,  201,  201,
-      201,  201,  201,  201,  166,  201,  169,  170,  201,  201,
-      201,  201,  201,  167,  171,    0
-
+        1,    1,  207,  207,  211,  211,  215,  215,  219,  219,
+        1,    1,  226,  223,    1,  205,  205,  224,    2,  224,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      207,  208,  208,  209,  224,  211,  212,  212,  213,  224,
+      218,  215,  216,  216,  217,  224,  219,  220,  220,  221,
+      224,  222,  206,    2,  210,  224,  222,  223,    0,    1,
+        2,    2,    2,    2,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  207,    0,  207,  211,    0,  211,  218,
+        0,  215,  218,  219,    0,  219,  222,    0,    2,    2,
+      222,  222,    2,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,    2,  222,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  222,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,   86,  223,  223,  223,  223,  223,  223,  223,
+        8,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,   97,
+      222,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  222,  223,  223,
+      223,  223,  223,   37,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  177,  223,   14,   15,  223,   18,
+       17,  223,  223,  163,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  161,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,    3,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  222,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  223,  214,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,   40,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,   41,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,   20,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  105,  223,  214,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      121,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  104,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,   84,
+      223,  223,  223,  223,  223,  223,  223,  223,  203,  223,
+
+      202,  223,  223,  223,  223,  223,  223,  223,  223,   25,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,   38,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,   39,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,   28,  223,  223,  223,  223,  223,  223,
+
+      223,  223,  223,  223,  137,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  192,
+      223,  223,  223,  204,  223,  223,  223,  223,  223,   32,
+      223,   33,  223,  223,  223,   87,  223,   88,  223,  223,
+       85,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,    7,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  170,  223,  223,  223,  223,  107,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,   29,  223,  223,  223,  223,
+      223,  223,  223,  141,  223,  140,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,   16,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,   42,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,   90,   89,  223,  223,  223,
+
+      223,  223,  223,  223,  223,  132,  223,  223,  223,  223,
+      223,  223,  223,  223,   98,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,   65,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  162,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,   73,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,   36,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  135,  136,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+
+      223,  223,    6,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+       26,  223,  223,  223,  223,  223,  223,  223,  223,  128,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  154,
+      223,  129,  223,  223,  168,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,   27,  223,  223,  223,  223,
+       93,  223,   94,  223,   92,  223,  223,  223,  223,  223,
+      223,   59,  223,  223,  103,  223,  223,  223,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  191,  223,  223,  130,
+      223,  223,  223,  223,  223,  223,  223,  133,  223,  167,
+      223,  223,  223,  223,  223,  150,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,   83,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,   34,  223,
+      223,   22,  223,  223,  223,  223,   19,  223,  112,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,   49,   51,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  178,  223,  223,  223,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  223,  223,   95,  223,
+      223,  223,  223,  223,  223,  223,  223,  102,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  106,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  160,  223,  223,  223,  223,  223,  223,  223,
+      201,  223,  223,  223,  120,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  116,  223,
+      122,  223,  223,  223,  223,  223,  101,  223,  223,   79,
+
+      223,  152,  223,  223,  223,  223,  223,  169,  223,  223,
+      223,  223,  223,  223,  223,  183,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  119,
+      223,  223,  223,  223,  223,   52,   53,  223,  223,  223,
+      223,  223,   35,   61,  123,  223,  142,  223,  171,  138,
+      223,  134,  223,  223,  223,  148,  223,  223,  223,   45,
+      223,  125,  223,  223,  223,  223,  223,  223,    9,  223,
+      223,  223,  223,   82,  223,  223,  223,  223,  196,  223,
+      151,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  108,  182,  223,  223,  223,  223,  223,
+      223,  223,  223,  164,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  124,  223,  139,  223,  223,   63,
+      223,  223,   44,   46,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,   81,  223,  223,  223,  223,  194,  223,
+      223,  223,  223,  156,   23,   24,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,   78,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  158,  155,
+
+      223,  223,  223,  223,  223,  223,  223,  223,  223,   43,
+      223,  223,  223,  223,  223,  223,  223,  223,   58,   13,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,   12,  223,  223,
+       21,  223,  223,  223,  223,  200,  223,   47,  223,  166,
+      157,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  115,  114,  223,  223,  223,  223,
+      159,  153,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,   54,  223,  223,  223,  195,  223,  223,   62,
+
+      223,  149,  165,  223,  223,  223,  223,  223,  223,   66,
+      223,  223,  223,  223,   48,  223,  223,   91,  223,  223,
+      109,  111,  143,  223,  223,  223,  113,  223,  223,  172,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      179,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  144,  223,  223,  193,  223,  223,
+      223,  223,   30,  223,  223,  223,  223,  223,  223,    4,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  175,  223,  223,  223,  223,  223,  223,  223,
+      223,  181,  223,  223,  147,  223,  223,  223,  223,  223,
+
+      223,  223,  223,   57,  223,   31,  199,  176,  223,  223,
+      223,   11,  223,  223,  223,  223,  223,  223,  223,  223,
+      145,  223,   69,  223,  223,  223,  118,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  180,   99,  223,
+       96,  223,  223,  223,   72,   76,   71,  223,   55,  223,
+      223,  223,   10,  223,  223,  223,  223,  223,  197,  223,
+      223,  223,  117,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,   77,   75,  223,   56,
+       64,  126,  223,  223,  223,  131,  223,  223,  146,   70,
+      223,  223,  223,  223,  110,   50,  223,  223,  223,  223,
+
+      223,  223,  223,  100,   74,   60,  223,   68,  223,  198,
+      223,  223,  223,  174,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,   67,  223,   80,  223,  173,  190,  223,
+      223,  223,  223,  223,  223,    5,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  127,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  186,  223,  223,  223,
+      223,  223,  223,  223,  223,  223,  223,  223,  223,  223,
+
+      184,  223,  187,  188,  223,  223,  223,  223,  223,  185,
+      189,    0
     } ;
 
 static yyconst YY_CHAR yy_ec[256] =
@@ -645,1342 +669,1220 @@ static yyconst YY_CHAR yy_ec[256] =
 
 static yyconst YY_CHAR yy_meta[40] =
     {   0,
-        1,    2,    3,    4,    5,    1,    6,    1,    1,    1,
-        1,    7,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_uint16_t yy_base[2011] =
+static yyconst flex_uint16_t yy_base[2213] =
     {   0,
-        0,    0,   37,   40,   44,   51,   63,   75,   56,   68,
-       87,  108, 2518, 2290,   50, 3939, 3939, 3939,  129,   94,
-       70,  104,  130,   90,  109,  106,  127,  111,   84,  122,
-      146,  148,   50,  170,  136,  158,  152,  180,  168,  191,
-     2135, 3939, 3939, 3939,   70, 1956, 3939, 3939, 3939,   42,
-     1771, 1568, 3939, 3939, 3939,  210, 1370, 3939, 3939, 3939,
-      141, 1190, 3939,  214, 3939,  218,  140, 1132,  224,  167,
-        0,  235,    0,    0,   92,  162,  164,  174,  193,  217,
-      230,  219,  103,  178,  233,  225,  220,  221,  241,  243,
-      244,  189,  249,  247,  256,  245,  252,  255,  254,  260,
-
-      265,  268,  138,  272,  270,  271,  276,  280,  281,  287,
-      273,  285,  282,  288,  289,  290,  295,  303,  300,  305,
-      297,  307,  308,  314,  317,  318,  310,  319,  596,  329,
-      458,  122,  403,  342,  373,  327,  347,  222,  351,  355,
-        0,  332,  348,  356,  350,  352,  354,  357,  341,  358,
-      368,  359,  370,  379,  377,  398,  380,  366,  378,  382,
-       49,  384,  386,  311,  389,  393,  376,  390,  396,  409,
-      400,  406,  416,  413,  426,  428,  424,  417,  430,  431,
-      439,  440,  392,  437,  441,  442,  443,  444,  445,  446,
-      451,  448,  452,  455,  454,  461,  469,  457,  465,  468,
-
-      478,  470,  471,  481,  490,  491,  492,  474,  484,  487,
-      493,  500,  498,  504,  502,  505,  507,  510,  488,  509,
-      514,  519,  525,  526,  528,  515,  524,  530,  532,  534,
-      540,  537,  546,  544,  542,  553,  538,  549,  550,  552,
-      554,  556,  557,  560,  561,  562,  566,  568,  574,  570,
-      576,  572,  577,  578,  582,  585,  591,  601,  602,  587,
-      583,  603,  606,  609,  611,  613,  610,  617,  618,  619,
-      626,  620,  623,  624,  631,  632,  633,  641,  638,  634,
-      637,  635,  644,  646,  652,  667,  656,  654,  673,  659,
-      674,  660,  664,  690,  676,  677,  687,  689,  688,  696,
-
-      678,  692,  695,  705,  701,  706,  710,  712,  713,  714,
-      719,  716,  720,  721,  722,  723,  726,  727,  734,  738,
-      741,  749,  731,  745,  743,  753,  746,  661,  754,  715,
-      755,  762,  760,  761,  763,  765,  767,  769,  770,  772,
-      775,  780, 3939,  783,  776,  778,  785,  787,  788, 3939,
-      790,  789,  791,  798,  792,  799,  795,  811,  817,  802,
-      813,  814,  815,  816,  820,  819,  839,  822,  825,  827,
-      828,  826,  831,  848,  832,  852,  841,  850,  846,  854,
-      837,  863,  860,  864,  866,  870, 3939,  867,  877,  874,
-      875,  878,  879,  885,  880,  894,  888,  895,  882,  896,
-
-      899,  890,  908,  904,  911,  913,  919,  916,  921,  923,
-      905,  922,  924,  925,  933,  930,  931,  932,  940,  937,
-      939,  938,  944,  947,  945,  949,  951,  955,  964,  957,
-      958,  967,  960,  968,  970,  972,  974,  975,  976,  982,
-      978,  980,  987,  989,  981,  992, 1000,  996, 1002, 1004,
-      998, 1010, 1008, 1011, 1017, 1013, 1015, 1014, 1028, 1029,
-     1016, 1030, 1020, 1025, 1026, 1034, 1036, 1037, 1041, 1039,
-     1042, 1044, 1052, 1048, 1049, 1050, 1058, 1053, 1055, 1063,
-     1065, 1069, 1066, 1070, 1071, 1072, 1076, 1074, 1080, 1085,
-     1083, 1086, 1088, 1096, 1098, 1089, 1100, 1103, 3939, 1111,
-
-     1104, 1113, 1107, 1090, 1120, 1114, 1105, 1091, 1125, 3939,
-     1118, 3939, 3939, 1121, 3939, 3939, 1126, 1136, 1127, 1128,
-     1145, 1148, 1141, 1139, 1143, 1151, 1159, 1156, 1161, 1164,
-     1169, 1171, 1172, 1173, 1180, 1153, 1174, 1177, 1181, 1183,
-     1184, 1186, 1188, 1187, 1192, 1189, 1196, 1203, 1211, 1207,
-     1208, 1209, 1212, 1213, 1216, 1215, 1199, 1224, 1219, 1225,
-     1232, 1226, 3939, 1229, 1230, 1234, 1235, 1240, 1236, 1242,
-     1243, 3939, 1244, 1247, 1248, 1250, 1253, 1256, 1255, 1257,
-     1259, 1260, 1258, 1262, 1268, 1272, 1281, 1263, 1271, 1289,
-     1291, 1288, 1287, 1290, 1293, 1273, 1295, 1304, 1297, 1301,
-
-     1303, 1312, 1305, 1309, 1311, 1314, 1315, 1317, 1318, 1320,
-     1322, 1323, 1345, 1326, 1324, 1331, 1332, 1334, 1340, 1342,
-     1335, 1339, 1358, 1352, 1359, 1360, 1363, 1351, 1368, 1369,
-     1376, 1379, 1383, 1373, 1381, 1380, 1387, 1392, 1390, 1333,
-     1396, 1388, 1398, 1400, 3939, 1406, 1405, 1403, 1411, 1417,
-     1413, 1414, 1416, 1419, 1415, 1420, 1421, 1427, 1423, 1430,
-     1426, 1436, 1438, 1439, 3939, 1435, 1437, 1441, 1448, 1452,
-     1458, 1442, 1449, 1464, 1460, 3939, 1461, 1467, 1468, 1471,
-     1465, 1470, 1476, 1475, 1478, 1480, 1482, 1483, 1484, 1486,
-     1487, 1493, 1497, 1485, 1500, 1502, 1504, 1506, 1507, 1508,
-
-     1514, 1510, 1511, 3939, 1512, 1517, 1513, 1519, 1528, 1534,
-     1526, 1532, 1536, 1533, 1539, 1538, 1544, 1542, 1545, 1543,
-     1546, 3939, 1547,  186, 1549, 1555, 1548, 1556, 1564, 1567,
-     1569, 1561, 1565, 1573, 1576, 1558, 1580, 1581, 1582, 1584,
-     1585, 1586, 1588, 1589, 1592, 1590, 1598, 1597, 1600, 1602,
-     1606, 1607, 1608, 1613, 1610, 3939, 1617, 1614, 1616, 1619,
-     1622, 1625, 1624, 1626, 1628, 1630, 1633, 1635, 1634, 1642,
-     3939, 1646, 1643, 1644, 1640, 1653, 1647, 1666, 1655, 1656,
-     1662, 1663, 1667, 1668, 1676, 1672, 1678, 1679, 1681, 1682,
-     1684, 1689, 1690, 1691, 1692, 1699, 1701, 1697, 1700, 1711,
-
-     1706, 1714, 1708, 3939, 1709, 1703, 1715, 1717, 1735, 1722,
-     1721, 1716, 1723, 1732, 1728, 1738, 1743, 1739, 1745, 3939,
-     1747, 1748, 1749, 1752, 1755, 1757, 1759, 1758, 1761, 1762,
-     1765, 1766, 1767, 1776, 1769, 1778, 1773, 1781, 3939, 1788,
-     1790, 1786, 1797, 1789, 1793, 1795, 1800, 1796, 1801, 1802,
-     1808, 1804, 1807, 1805, 1810, 1813, 1809, 1811, 1815, 1826,
-     1820, 1822, 1830, 3939, 1823, 1839, 1832, 1840, 1844, 1837,
-     1852, 1849, 1843, 1850, 1855, 1856, 1857, 1858, 1859, 1860,
-     1865, 1861, 1863, 1868, 1870, 1871, 1872, 1873, 1877, 1887,
-     1888, 1889, 1890, 1893, 1894, 1895, 1901, 1902, 1866, 1903,
-
-     3939, 1908, 1909, 1910, 1911, 1912, 1914, 1916, 1923, 1925,
-     1921, 1926, 1927, 1930, 1931, 1932, 1933, 1942, 1934, 1936,
-     1940, 1943, 1938, 1944, 1948, 1960, 1947, 1954, 1968, 1964,
-     1970, 1958, 1972, 1973, 1976, 3939, 1977, 1980, 1983, 1985,
-     1975, 1984, 1992, 3939, 1990, 3939, 1991, 1998, 2005, 3939,
-     2002, 3939, 2007, 1994, 3939, 2009, 2013, 2003, 2011, 2015,
-     2016, 2017, 2020, 2022, 2023, 2024, 2027, 2028, 2030, 2031,
-     2033, 3939, 2041, 2035, 2037, 2044, 2042, 2046, 2048, 2052,
-     2054, 2055, 2058, 2064, 2056, 2065, 3939, 2067, 2070, 2071,
-     2072, 3939, 1669, 2079, 2073, 2062, 2083, 2092, 2088, 2075,
-
-     2091, 2077, 2094, 2100, 2098, 2103, 2104, 2105, 2111, 2107,
-     2113, 2109, 2110, 2117, 2114, 2118, 2120, 2122, 2124, 2127,
-     2128, 2131, 2129, 2130, 2133, 2134, 3939, 2144, 2137, 2146,
-     2145, 2152, 2153, 2148, 3939, 2154, 3939, 2156, 2167, 2171,
-     2158, 2163, 2172, 2173, 2175, 2177, 2176, 2183, 2180, 2184,
-     2187, 2190, 2191, 2193, 2195, 3939, 2192, 2196, 2197, 2199,
-     2201, 2206, 2212, 2216, 2202, 3939, 2223, 2203, 2219, 2231,
-     2229, 2222, 2237, 2230, 2236, 3939, 3939, 2233, 2238, 2234,
-     2240, 2241, 2249, 2248, 2250, 3939, 2254, 2251, 2255, 2256,
-     2257, 2265, 2263, 2266, 3939, 2267, 2274, 2269, 2277, 2275,
-
-     2276, 2278, 2285, 2279, 2281, 2286, 2294, 2295, 2301, 3939,
-     2302, 2296, 2304, 2306, 2308, 2310, 2309, 2311, 2312, 2314,
-     2315, 2316, 2325, 2327, 2320, 2328, 2329, 2333, 2330, 2338,
-     2334, 2340, 2342, 2348, 2351, 3939, 2357, 2344, 2358, 2345,
-     2360, 2363, 2361, 2365, 2366, 2367, 2373, 2369, 3939, 2376,
-     2374, 2372, 2381, 2382, 2390, 2383, 2385, 2394, 2397, 3939,
-     3939, 2392, 2399, 2400, 2402, 2404, 2405, 2410, 2406, 2412,
-     3939, 2414, 2421, 2417, 2418, 2427, 2429, 2434, 2430, 2436,
-     2420, 2423, 2426, 2441, 2439, 2443, 2446, 2448, 2449, 2450,
-     2451, 2452, 2453, 2460, 2456, 2471, 2454, 2464, 2461, 2479,
-
-     2477, 2485, 2487, 2466, 2483, 2491, 3939, 2488, 2489, 2490,
-     2473, 2499, 2496, 2506, 2497, 3939, 2504, 2510, 2513, 2515,
-     2503, 2516, 2519, 2520, 2508, 3939, 2525, 3939, 2528, 2521,
-     3939, 2527, 2535, 2529, 2532, 2536, 2537, 2538, 2540, 2548,
-     2544, 3939, 2550, 2546, 2552, 2557, 3939, 2560, 3939, 2547,
-     3939, 2553, 2555, 2570, 2567, 2571, 2573, 2577, 3939, 2574,
-     2578, 2579, 2582, 2583, 2585, 2587, 2588, 2586, 2590, 2589,
-     3939, 2593, 2594, 3939, 2596, 2607, 2592, 2606, 2615, 3939,
-     2616, 3939, 2603, 2619, 2602, 2621, 2627, 2630, 2631, 2620,
-     2623, 2637, 2634, 2633, 2640, 3939, 2641, 2642, 2645, 2649,
-
-     2647, 2651, 2657, 2653, 2659, 2654, 2655, 2663, 2669, 2670,
-     2672, 3939, 2673, 2675, 3939, 2674, 2676, 2677, 2681, 3939,
-     2682, 3939, 2683, 2685, 2686, 2690, 2692, 2693, 2704, 2694,
-     2701, 2707, 2706, 2715, 2708, 2698, 3939, 3939, 2721, 2717,
-     2723, 2724, 2727, 2728, 2734, 2730, 2732, 3939, 2733, 2736,
-     2737, 2738, 2740, 2743, 2747, 2749, 2750, 2742, 2751, 2744,
-     2752, 3939, 2755, 2759, 2762, 2764, 2766, 2765, 2767, 3939,
-     2769, 2772, 2776, 2778, 2780, 2784, 2791, 2795, 2781, 2797,
-     2798, 2800, 2802, 2804, 2806, 2807, 2814, 2811, 2816, 2818,
-     2808, 3939, 2819, 2821, 2822, 2831, 2825, 2773, 2832, 2833,
-
-     2837, 2823, 2838, 2828, 2840, 3939, 2844, 2845, 2846, 2848,
-     2851, 2854, 2856, 2857, 2858, 2860, 3939, 2862, 2865, 2863,
-     2866, 2871, 2867, 2875, 2876, 2877, 2878, 2881, 2889, 2890,
-     3939, 2882, 3939, 2896, 2897, 2904, 2900, 2893, 3939, 2903,
-     2907, 3939, 2908, 3939, 2911, 2912, 2906, 2910, 2924, 3939,
-     2928, 2919, 2929, 2925, 2921, 2931, 2938, 3939, 2932, 2940,
-     2942, 2944, 2934, 2945, 2946, 2947, 2948, 2952, 2958, 2955,
-     3939, 2956, 2959, 2967, 2963, 2973, 3939, 3939, 2966, 2969,
-     2974, 2976, 2978, 3939, 3939, 3939, 2982, 3939, 2983, 3939,
-     3939, 2984, 2986, 3939, 2988, 3939, 2995, 2991, 2993, 2994,
-
-     2998, 3939, 2996, 2999, 3005, 3939, 2997, 3012, 3000, 3008,
-     3939, 3014, 3939, 3017, 3019, 3010, 3020, 3027, 3029, 3031,
-     3032, 3033, 3034, 3036, 3037, 3038, 3040, 3039, 3042, 3043,
-     3046, 3047, 3053, 3054, 3055, 3056, 3061, 3058, 3060, 3063,
-     3074, 3065, 3081, 3083, 3939, 3939, 3071, 3075, 3073, 3077,
-     3085, 3086, 3087, 3088, 3939, 3099, 3092, 3090, 3096, 3100,
-     3102, 3104, 3107, 3109, 3111, 3117, 3113, 3114, 3116, 3119,
-     3118, 3121, 3125, 3132, 3939, 3127, 3126, 3939, 3939, 3133,
-     3137, 3143, 3139, 3144, 3147, 3148, 3939, 3149, 3151, 3157,
-     3150, 3939, 3159, 3160, 3166, 3168, 3939, 3939, 3939, 3169,
-
-     3161, 3171, 3172, 3173, 3175, 3174, 3177, 3939, 3176, 3182,
-     3189, 3186, 3196, 3198, 3192, 3200, 3207, 3203, 3210, 3212,
-     3939, 3939, 3204, 3218, 3215, 3216, 3214, 3220, 3222, 3224,
-     3225, 3939, 3228, 3227, 3188, 3226, 3233, 3234, 3240, 3236,
-     3939, 3238, 3244, 3246, 3248, 3249, 3250, 3251, 3253, 3254,
-     3256, 3262, 3255, 3267, 3939, 3269, 3258, 3939, 3270, 3275,
-     3276, 3939, 3279, 3939, 3282, 3939, 3939, 3277, 3283, 3286,
-     3287, 3293, 3295, 3299, 3288, 3296, 3305, 3302, 3303, 3939,
-     3939, 3309, 3311, 3312, 3319, 3939, 3939, 3315, 3313, 3316,
-     3317, 3322, 3323, 3325, 3326, 3328, 3327, 3332, 3338, 3340,
-
-     3343, 3344, 3347, 3329, 3348, 3350, 3351, 3939, 3353, 3358,
-     3354, 3939, 3363, 3360, 3939, 3356, 3369, 3373, 3366, 3364,
-     3381, 3378, 3383, 3939, 3384, 3382, 3939, 3385, 3939, 3939,
-     3939, 3390, 3386, 3388, 3939, 3396, 3398, 3939, 3404, 3400,
-     3405, 3411, 3407, 3408, 3412, 3419, 3415, 3417, 3939, 3418,
-     3420, 3422, 3423, 3427, 3424, 3426, 3429, 3438, 3434, 3432,
-     3444, 3441, 3939, 3450, 3452, 3939, 3454, 3456, 3939, 3463,
-     3445, 3447, 3455, 3939, 3466, 3457, 3459, 3469, 3473, 3464,
-     3475, 3476, 3478, 3479, 3484, 3939, 3480, 3486, 3488, 3489,
-     3490, 3498, 3495, 3500, 3939, 3502, 3497, 3939, 3504, 3505,
-
-     3507, 3514, 3518, 3523, 3525, 3515, 3939, 3527, 3939, 3939,
-     3939, 3528, 3939, 3531, 3532, 3533, 3534, 3536, 3537, 3939,
-     3939, 3539, 3541, 3544, 3939, 3538, 3545, 3550, 3548, 3551,
-     3552, 3556, 3557, 3561, 3562, 3939, 3939, 3563, 3939, 3569,
-     3577, 3580, 3939, 3939, 3939, 3579, 3939, 3581, 3939, 3587,
-     3571, 3588, 3939, 3591, 3592, 3939, 3593, 3564, 3594, 3597,
-     3599, 3600, 3601, 3603, 3604, 3608, 3609, 3610, 3616, 3939,
-     3939, 3620, 3939, 3622, 3939, 3623, 3628, 3939, 3554, 3630,
-     3624, 3634, 3939, 3939, 3508, 3617, 3635, 3636, 3637, 3640,
-     3638, 3939, 3939, 3939, 3642, 3939, 3643, 3644, 3646, 3939,
-
-     3648, 3650, 3651, 3653, 3652, 3655, 3657, 3661, 3666, 3667,
-     3674, 3678, 3679, 3682, 3669, 3675, 3688, 3685, 3692, 3939,
-     3686, 3939, 3939, 3689, 3698, 3700, 3696, 3702, 3697, 3939,
-     3703, 3704, 3705, 3706, 3707, 3709, 3720, 3711, 3712, 3722,
-     3724, 3728, 3721, 3736, 3735, 3732, 3737, 3738, 3746, 3742,
-     3745, 3939, 3743, 3744, 3747, 3749, 3750, 3754, 3752, 3764,
-     3767, 3755, 3769, 3753, 3774, 3770, 3775, 3778, 3779, 3780,
-     3939, 3781, 3783, 3785, 3787, 3789, 3791, 3792, 3793, 3796,
-     3798, 3801, 3803, 3807, 3939, 3808, 3939, 3939, 3812, 3809,
-     3815, 3819, 3821, 3939, 3939, 3939, 3847, 3854, 3861, 3868,
-
-     3875,   94, 3882, 3889, 3896, 3903, 3910, 3917, 3924, 3931
+        1,    0,   41,    0,   81,    0,  121,    0,  161,    0,
+      201,    0, 3166,  241,  281, 3166, 3166, 3166,  284,  324,
+      348,  352,  349,  351,  355,  367,  373,  215,  226,  217,
+      377,  378,  212,  376,  221,  397,  385,  370,  343,  402,
+      429, 3166, 3166, 3166,  469,  509, 3166, 3166, 3166,  549,
+      589,  406, 3166, 3166, 3166,  629,  669, 3166, 3166, 3166,
+      709,  749, 3166,  789, 3166,  829,  226,    0,    0,    0,
+      869,    0,    0,  909,    0,  266,  310,  339,  403,  347,
+      352,  402,  391,  362,  394,  941,  406,  407,  439,  488,
+      482,  485,  535,  574,  574,  566,  936,  586,  564,  932,
+
+      736,  595,  640,  647,  695,  731,  727,  734,  774,  806,
+      839,  881,  934,  922,  936,  923,  943,  926,  934,  933,
+      939,  931,  955,  940,  952,  941,  944,  940,  960,  958,
+      952,  947,  961,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  993,
+        0,  964,    0,  963,  974,  955,  963,  953,  959,  955,
+     1011, 1026,  971,  976,  983, 1024, 1019,  978, 1012, 1006,
+     1021, 1024, 1025, 1028, 1027, 1030, 1022, 1022, 1026, 1024,
+     1038, 1040, 1045, 1027, 1033, 1055, 1051, 1058, 1059, 1047,
+     1038, 1048, 1037, 1064, 1055, 1066, 1067, 1071, 1060, 1055,
+
+     1063, 1051, 1066, 1067, 1066, 1062, 1072, 1063, 1059, 1085,
+     1076, 1060, 1065, 1090, 1066, 1085, 1081, 1095, 1072, 1080,
+     1092, 1099, 1100, 1094, 1074,    0, 1086, 1080, 1092, 1106,
+     1097, 1108, 1089, 1088, 1093, 1100, 1101, 1107, 1109, 1111,
+     1117, 1114, 1115, 1103, 1105, 1118, 1119, 1115, 1116, 1132,
+     1114, 1134, 1129, 1126, 1127, 1138, 1114, 1117, 1115, 1124,
+     1137, 1136, 1122, 1137, 1124, 1142, 1126, 1133, 1151, 1144,
+     1136, 1148, 1142, 1131, 1158, 1145, 1142, 1144, 1156, 1161,
+     1158, 1166, 1147, 1148, 1161, 1162, 1173, 1169, 1174, 1161,
+     1172, 1166, 1159, 1185, 1163, 1163, 1179, 1182, 1172, 1172,
+
+     1180, 1195, 1187, 1181, 1175, 1181, 1183, 1195, 1185, 1201,
+     1185, 1192, 1210, 1185, 1199, 1192, 1190, 1216, 1217, 1199,
+     1206, 1217, 1208, 1229, 1205, 1214, 1213, 1233, 1234, 1225,
+     1234, 1213, 1218, 1219, 1222, 1235, 1236, 1239, 1238, 1240,
+     1231, 1251, 1238, 1239, 1246, 1248, 1244, 1259, 1260, 1250,
+     1253, 1254, 1241, 1261, 1258, 1259, 1264, 1271, 1248, 1259,
+     1265, 1249, 1268, 1265, 1263, 1272, 1274, 1275, 1279, 1277,
+     1262, 1283, 3166, 1284, 1291, 1266, 1280, 1280, 1271, 1280,
+     3166, 1275, 1274, 1282, 1302, 1289, 1294, 1294, 1302, 1295,
+     1310, 1311, 1313, 1288, 1306, 1307, 1307, 1297, 1295, 1315,
+
+     1295, 1298, 1302, 1325, 1316, 1304, 1324, 1325, 1326, 1313,
+     1320, 1318, 1317, 1315, 1333, 1330, 1321, 1327, 1337, 3166,
+     1340, 1350, 1334, 1335, 1336, 1340, 1352, 1343, 1361, 1345,
+     1355, 1344, 1356, 1359, 1347, 1369, 1352, 1368, 1370, 1375,
+     1372, 1373, 1378, 1379, 1354, 1371, 1358, 1375, 1385, 1379,
+     1378, 1378, 1364, 1390, 1381, 1382, 1385, 1371, 1389, 1373,
+     1387, 1389, 1384, 1404, 1391, 1398, 1398, 1378, 1390, 1400,
+     1401, 1402, 1395, 1404, 1394, 1399, 1394, 1398, 1395, 1403,
+     1421, 1411, 1416, 1417, 1413, 1417, 1405, 1411, 1431, 1422,
+     1433, 1426, 1425, 1436, 1419, 1420, 1439, 1427, 1417, 1418,
+
+     1438, 1437, 1436, 1447, 1443, 1424, 1447, 1432, 1433, 1433,
+     1433, 1450, 1447, 1442, 1440, 1440, 1445, 1466, 1443, 1444,
+     1463, 1461, 1462, 1462, 1452, 1450, 1457, 1464, 1467, 1467,
+     1470, 1471, 1460, 1472, 1471, 1467, 1473, 1478, 1481, 1481,
+     1482, 1486, 1479, 3166, 1494, 1470, 1487, 1488, 1475, 1499,
+     1488, 1479, 1480, 1497, 3166, 1484, 3166, 3166, 1493, 3166,
+     3166, 1492, 1498, 3166, 1505, 1508, 1512, 1519, 1516, 1494,
+     1516, 1517, 1506, 1500, 1523, 1528, 1522, 1529, 1517, 1532,
+     1531, 1534, 1533, 1537, 1528, 1522, 1523, 1525, 1537, 1545,
+     1532, 1534, 1548, 1536, 1533, 1540, 1548, 1555, 1560, 1547,
+
+     1552, 1544, 1564, 1565, 1558, 1556, 1555, 1556, 1564, 1548,
+     1562, 1561, 1550, 1571, 1562, 1564, 1578, 1555, 3166, 1566,
+     1567, 1574, 1564, 1574, 1575, 1579, 1580, 1582, 1569, 1570,
+     1584, 3166, 1565, 1583, 1568, 1570, 1571, 1572, 1588, 1594,
+     1581, 1581, 1592, 1590, 1590, 1599, 1607, 1587, 1594, 1614,
+     1615, 1607, 1593, 1601, 1609, 1594, 1615, 1622, 1615, 1601,
+     1607, 1627, 1603, 1625, 1608, 1628, 1613, 1625, 1611, 1607,
+     1618, 1613, 1631, 1634, 1633, 1623, 1624, 1637, 1628, 1639,
+     1631, 1632, 1644, 1635, 1646, 1648, 1640, 1634, 1642, 1648,
+     1652, 1664, 1661, 1661, 1651, 1659, 1651, 1654, 1667, 1665,
+
+     1666, 1668, 1655, 1661, 1657, 1678, 1674, 3166, 1684, 1678,
+     1663, 1670, 1689, 1680, 1667, 1679, 1680, 1681, 1682, 1673,
+     1688, 1674, 1681, 1693, 1680, 1679, 1691, 1692, 1707, 3166,
+     1684, 1699, 1699, 1701, 1702, 1690, 1694, 1705, 1707, 1708,
+     1695, 1706, 1715, 1722, 1706, 3166, 1704, 1726, 1722, 1719,
+     1710, 1707, 1713, 1709, 1718, 1732, 1713, 1734, 1731, 1732,
+     1720, 1732, 1733, 1733, 1724, 1735, 1743, 1734, 1726, 1742,
+     1728, 1728, 1728, 1736, 1755, 1746, 1747, 3166, 1736, 1752,
+     1753, 1745, 1763, 1764, 1745, 1756, 1763, 1744, 1751, 1754,
+     1771, 1750, 1760, 1751, 1752, 3166, 1753,    0, 1759, 1759,
+
+     1755, 1781, 1783, 1774, 1775, 1767, 1768, 1779, 1770, 1767,
+     1780, 1773, 1770, 1791, 1777, 1774, 1787, 1774, 1794, 1791,
+     1790, 1784, 1797, 1783, 1793, 1798, 1785, 1793, 1801, 1788,
+     3166, 1804, 1800, 1795, 1792, 1797, 1806, 1803, 1797, 1798,
+     1800, 1814, 1806, 1815, 1821, 1805, 1817, 3166, 1832, 1814,
+     1821, 1810, 1826, 1820, 1838, 1815, 1822, 1825, 1839, 1828,
+     1833, 1848, 1843, 1840, 1851, 1842, 1839, 1844, 1846, 1851,
+     1844, 1840, 1850, 1861, 1843, 1844, 1844, 1855, 1847, 1844,
+     1868, 1869, 1857, 1861, 1864, 1860, 1869, 1874, 1873, 3166,
+     1869, 1862, 1861, 1873, 1888, 1871, 1867, 1879, 3166, 1890,
+
+     3166, 1882, 1877, 1883, 1875, 1869, 1896, 1881, 1898, 3166,
+     1895, 1895, 1882, 1903, 1883, 1905, 1900, 1901, 1908, 1888,
+     1904, 1902, 1906, 1911, 1895, 1908, 1909, 1904, 3166, 1923,
+     1924, 1915, 1926, 1914, 1905, 1914, 1928, 1908, 1909, 1910,
+     1936, 1918, 1914, 1923, 1918, 1936, 1919, 1915, 1923, 1937,
+     1945, 1922, 1941, 3166, 1928, 1953, 1940, 1942, 1949, 1939,
+     1959, 1960, 1945, 1939, 1940, 1942, 1956, 1957, 1945, 1945,
+     1963, 1950, 1950, 1958, 1957, 1958, 1959, 1956, 1971, 1970,
+     1973, 1961, 1975, 1976, 1973, 1968, 1978, 1979, 1981, 1992,
+     1993, 1988, 1989, 3166, 1992, 1988, 1984, 1976, 1990, 1982,
+
+     1978, 2003, 2004, 1982, 3166, 2009, 1985, 1987, 1988, 1989,
+     1983, 1990, 1991, 1995, 2012, 1994, 1998, 1998, 2012, 2024,
+     2001, 2002, 2027, 2004, 2005, 2011, 2005, 2012, 2027, 2028,
+     2026, 2020, 2034, 2029, 2031, 2032, 2028, 2025, 2037, 3166,
+     2020, 2042, 2029, 3166, 2039, 2042, 2029, 2028, 2054, 3166,
+     2032, 3166, 2046, 2051, 2058, 3166, 2055, 3166, 2056, 2058,
+     3166, 2055, 2058, 2045, 2046, 2048, 2058, 2049, 2066, 2062,
+     2047, 2067, 2068, 2059, 2068, 2054, 2070, 3166, 2077, 2059,
+     2064, 2078, 2075, 2062, 2063, 2075, 2065, 2084, 2082, 2093,
+     2069, 2096, 3166, 2078, 2094, 2075, 2089, 3166, 2090, 2096,
+
+     2086, 2079, 2097, 2106, 2097, 2096, 2101, 2082, 2106, 2111,
+     2116, 2111, 2095, 2097, 2097, 2123, 2114, 2125, 2126, 2117,
+     2124, 2119, 2107, 2106, 2107, 2114, 2109, 2116, 2119, 2120,
+     2139, 2115, 2116, 2123, 2124, 3166, 2140, 2120, 2136, 2137,
+     2136, 2135, 2139, 3166, 2133, 3166, 2141, 2148, 2131, 2158,
+     2159, 2156, 2155, 2166, 2159, 2142, 2162, 2160, 2146, 2151,
+     2159, 2150, 2161, 2162, 2169, 2179, 2176, 2156, 2164, 2160,
+     2165, 2164, 2165, 2170, 3166, 2158, 2166, 2184, 2170, 2178,
+     2183, 2188, 2181, 2173, 3166, 2183, 2199, 2177, 2191, 2202,
+     2192, 2179, 2205, 2188, 2199, 3166, 3166, 2185, 2197, 2193,
+
+     2189, 2190, 2215, 2195, 2194, 3166, 2214, 2194, 2211, 2212,
+     2213, 2214, 2211, 2212, 3166, 2207, 2224, 2210, 2218, 2214,
+     2215, 2209, 2234, 2221, 2216, 2230, 2238, 2235, 2240, 3166,
+     2235, 2232, 2243, 2231, 2239, 2236, 2234, 2232, 2243, 2240,
+     2230, 2236, 2253, 2258, 2259, 3166, 2236, 2236, 2258, 2238,
+     2260, 2239, 2262, 2259, 2269, 2262, 3166, 2271, 2249, 2273,
+     2270, 2250, 2251, 2273, 2274, 2279, 2265, 2261, 2262, 2288,
+     2265, 3166, 2291, 2273, 2267, 2290, 2292, 2291, 2273, 2274,
+     2294, 2271, 2289, 2300, 3166, 3166, 2291, 2302, 2303, 2295,
+     2289, 2293, 2288, 2308, 2293, 2302, 2301, 2285, 2312, 2288,
+
+     2314, 2315, 3166, 2314, 2326, 2302, 2316, 2329, 2330, 2331,
+     2328, 2323, 2320, 2310, 2313, 2321, 2331, 2317, 2310, 2336,
+     2323, 2319, 2321, 2326, 2338, 2339, 2335, 2347, 2336, 2349,
+     2328, 2336, 2331, 2359, 2356, 2361, 2362, 2332, 2347, 2366,
+     3166, 2350, 2359, 2352, 2353, 2371, 2345, 2373, 2357, 3166,
+     2367, 2370, 2373, 2374, 2354, 2369, 2371, 2371, 2370, 3166,
+     2375, 3166, 2378, 2370, 3166, 2371, 2385, 2365, 2377, 2369,
+     2369, 2385, 2385, 2396, 2378, 3166, 2392, 2376, 2386, 2387,
+     3166, 2398, 3166, 2399, 3166, 2384, 2386, 2406, 2407, 2402,
+     2404, 3166, 2398, 2409, 3166, 2410, 2390, 2410, 2403, 2392,
+
+     2402, 2404, 2406, 2393, 2405, 2415, 3166, 2402, 2403, 3166,
+     2420, 2424, 2409, 2423, 2422, 2425, 2419, 3166, 2423, 3166,
+     2412, 2440, 2416, 2432, 2432, 3166, 2425, 2441, 2415, 2437,
+     2441, 2439, 2442, 2441, 2429, 2428, 2454, 2445, 2446, 2436,
+     2445, 3166, 2435, 2441, 2457, 2456, 2443, 2440, 2467, 2458,
+     2462, 2453, 2467, 2458, 2466, 2470, 2462, 2460, 3166, 2468,
+     2469, 3166, 2462, 2456, 2459, 2462, 3166, 2473, 3166, 2474,
+     2466, 2467, 2474, 2485, 2476, 2487, 2468, 2484, 2484, 2477,
+     2496, 2485, 2474, 3166, 3166, 2497, 2488, 2499, 2498, 2488,
+     2483, 2507, 2499, 2506, 3166, 2481, 2502, 2503, 2494, 2505,
+
+     2493, 2496, 2514, 2510, 2500, 2511, 2512, 2499, 3166, 2500,
+     2497, 2498, 2504, 2506, 2512, 2507, 2517, 3166, 2531, 2532,
+     2519, 2520, 2523, 2536, 2540, 2541, 2526, 2529, 2542, 2535,
+     2546, 2547, 2549, 2530, 2551, 2533, 2553, 2554, 2549, 2556,
+     2541, 2539, 2557, 2560, 2559, 2542, 3166, 2557, 2564, 2545,
+     2566, 2558, 2549, 2562, 2566, 2569, 2572, 2553, 2558, 2559,
+     2556, 2577, 3166, 2578, 2555, 2564, 2577, 2583, 2564, 2585,
+     3166, 2560, 2586, 2587, 3166, 2577, 2585, 2586, 2579, 2572,
+     2589, 2590, 2598, 2588, 2591, 2587, 2607, 2599, 3166, 2584,
+     3166, 2596, 2605, 2612, 2607, 2590, 3166, 2594, 2605, 3166,
+
+     2603, 3166, 2614, 2613, 2599, 2608, 2623, 3166, 2624, 2610,
+     2624, 2614, 2613, 2609, 2628, 3166, 2626, 2628, 2633, 2628,
+     2614, 2615, 2622, 2633, 2618, 2634, 2645, 2635, 2637, 3166,
+     2638, 2639, 2650, 2651, 2645, 3166, 3166, 2634, 2648, 2647,
+     2625, 2651, 3166, 3166, 3166, 2656, 3166, 2657, 3166, 3166,
+     2658, 3166, 2638, 2655, 2662, 3166, 2659, 2658, 2665, 3166,
+     2666, 3166, 2661, 2672, 2667, 2653, 2654, 2666, 3166, 2653,
+     2658, 2662, 2678, 3166, 2669, 2684, 2662, 2666, 3166, 2683,
+     3166, 2678, 2682, 2671, 2681, 2688, 2689, 2690, 2678, 2673,
+     2691, 2675, 2682, 2683, 2684, 2692, 2678, 2700, 2691, 2675,
+
+     2682, 2690, 2691, 2691, 2705, 2698, 2690, 2687, 2706, 2707,
+     2714, 2715, 2715, 3166, 3166, 2697, 2700, 2697, 2700, 2712,
+     2702, 2705, 2723, 3166, 2726, 2717, 2709, 2721, 2714, 2712,
+     2713, 2716, 2714, 2735, 2736, 2741, 2719, 2723, 2721, 2736,
+     2722, 2723, 2739, 2743, 3166, 2737, 3166, 2746, 2729, 3166,
+     2744, 2731, 3166, 3166, 2756, 2732, 2750, 2755, 2740, 2738,
+     2758, 2746, 2755, 3166, 2745, 2757, 2763, 2750, 3166, 2765,
+     2746, 2767, 2769, 3166, 3166, 3166, 2768, 2749, 2759, 2772,
+     2765, 2770, 2771, 2758, 2770, 3166, 2764, 2775, 2776, 2767,
+     2784, 2785, 2778, 2781, 2792, 2783, 2791, 2792, 3166, 3166,
+
+     2779, 2798, 2790, 2790, 2787, 2782, 2790, 2794, 2788, 3166,
+     2798, 2797, 2785, 2791, 2796, 2797, 2806, 2799, 3166, 3166,
+     2790, 2790, 2792, 2813, 2794, 2805, 2800, 2817, 2798, 2814,
+     2820, 2815, 2822, 2823, 2804, 2816, 2820, 3166, 2817, 2814,
+     3166, 2833, 2825, 2826, 2816, 3166, 2832, 3166, 2835, 3166,
+     3166, 2815, 2835, 2838, 2826, 2836, 2842, 2843, 2844, 2826,
+     2831, 2851, 2848, 2844, 3166, 3166, 2854, 2846, 2845, 2857,
+     3166, 3166, 2849, 2838, 2852, 2840, 2839, 2846, 2862, 2843,
+     2855, 2845, 2864, 2865, 2866, 2869, 2866, 2852, 2853, 2865,
+     2855, 2856, 3166, 2878, 2875, 2862, 3166, 2882, 2877, 3166,
+
+     2865, 3166, 3166, 2875, 2868, 2888, 2884, 2880, 2872, 3166,
+     2876, 2897, 2881, 2886, 3166, 2888, 2886, 3166, 2887, 2888,
+     3166, 3166, 3166, 2896, 2901, 2894, 3166, 2899, 2904, 3166,
+     2907, 2898, 2889, 2915, 2916, 2907, 2896, 2920, 2891, 2918,
+     3166, 2899, 2904, 2921, 2908, 2918, 2914, 2908, 2906, 2918,
+     2922, 2902, 2930, 2911, 3166, 2932, 2933, 3166, 2934, 2935,
+     2909, 2931, 3166, 2939, 2919, 2925, 2922, 2923, 2924, 3166,
+     2943, 2944, 2925, 2949, 2944, 2951, 2932, 2940, 2933, 2955,
+     2956, 2955, 3166, 2948, 2941, 2959, 2958, 2945, 2970, 2949,
+     2969, 3166, 2970, 2951, 3166, 2972, 2967, 2959, 2969, 2976,
+
+     2977, 2978, 2973, 3166, 2980, 3166, 3166, 3166, 2975, 2976,
+     2981, 3166, 2984, 2964, 2980, 2972, 2967, 2979, 2990, 2985,
+     3166, 2979, 3166, 2984, 2994, 2989, 3166, 2975, 2976, 2992,
+     2986, 2991, 2992, 2985, 2987, 2986, 3001, 3166, 3166, 2988,
+     3166, 3010, 3012, 3013, 3166, 3166, 3166, 3014, 3166, 3015,
+     3016, 3012, 3166, 3017, 3000, 3021, 3003, 3008, 3166, 3024,
+     3025, 3026, 3166, 3008, 3018, 3027, 3030, 3031, 3026, 3027,
+     3018, 3013, 3030, 3031, 3018, 3039, 3166, 3166, 3040, 3166,
+     3166, 3166, 3041, 3022, 3044, 3166, 3035, 3046, 3166, 3166,
+     3034, 3046, 3033, 3050, 3166, 3166, 3051, 3056, 3039, 3050,
+
+     3037, 3039, 3042, 3166, 3166, 3166, 3055, 3166, 3058, 3166,
+     3058, 3043, 3050, 3166, 3054, 3056, 3047, 3052, 3055, 3047,
+     3058, 3075, 3055, 3077, 3068, 3079, 3080, 3075, 3076, 3057,
+     3068, 3089, 3071, 3166, 3087, 3166, 3072, 3166, 3166, 3069,
+     3094, 3095, 3077, 3079, 3074, 3166, 3080, 3076, 3083, 3084,
+     3079, 3094, 3095, 3082, 3101, 3098, 3099, 3100, 3087, 3112,
+     3109, 3110, 3091, 3092, 3117, 3094, 3101, 3166, 3110, 3097,
+     3099, 3106, 3119, 3116, 3103, 3122, 3123, 3120, 3119, 3108,
+     3129, 3122, 3123, 3112, 3127, 3114, 3166, 3129, 3130, 3117,
+     3118, 3137, 3120, 3121, 3140, 3143, 3136, 3145, 3146, 3139,
+
+     3166, 3142, 3166, 3166, 3143, 3130, 3131, 3152, 3153, 3166,
+     3166, 3166
     } ;
 
-static yyconst flex_int16_t yy_def[2011] =
+static yyconst flex_int16_t yy_def[2213] =
     {   0,
-     1996,    1, 1997, 1997, 1998, 1998, 1999, 1999, 2000, 2000,
-     2001, 2001, 1996, 2002, 1996, 1996, 1996, 1996, 2003, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2004, 1996, 1996, 1996, 2004, 2005, 1996, 1996, 1996, 2005,
-     2006, 1996, 1996, 1996, 1996, 2006, 2007, 1996, 1996, 1996,
-     2007, 2008, 1996, 2009, 1996, 2008, 2008, 2002, 2002, 1996,
-     2010, 2003, 2010, 2003, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2004, 2004,
-     2005, 2005, 2006, 2006, 1996, 2007, 2007, 2008, 2008, 2009,
-     2009, 2008, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2008, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2008,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 1996,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 1996, 2008, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2008, 2002, 2002, 2002, 2002, 2002, 1996, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996,
-     2002, 1996, 1996, 2002, 1996, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2008, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 1996, 2002, 2008, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 1996, 2002, 1996, 2002, 2002, 2002, 1996,
-     2002, 1996, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002,
-     2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 1996, 2002, 1996, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 1996, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996,
-     1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 1996, 2002, 2002,
-     1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 1996, 2002, 2002, 2002, 2002, 1996, 2002, 1996, 2002,
-     1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     1996, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002, 1996,
-     2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 1996, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 1996,
-     2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 1996, 1996, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     1996, 2002, 1996, 2002, 2002, 2002, 2002, 2002, 1996, 2002,
-     2002, 1996, 2002, 1996, 2002, 2002, 2002, 2002, 2002, 1996,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     1996, 2002, 2002, 2002, 2002, 2002, 1996, 1996, 2002, 2002,
-     2002, 2002, 2002, 1996, 1996, 1996, 2002, 1996, 2002, 1996,
-     1996, 2002, 2002, 1996, 2002, 1996, 2002, 2002, 2002, 2002,
-
-     2002, 1996, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     1996, 2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 1996, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 1996, 2002, 2002, 1996, 1996, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002,
-     2002, 1996, 2002, 2002, 2002, 2002, 1996, 1996, 1996, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     1996, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 1996, 2002, 2002, 1996, 2002, 2002,
-     2002, 1996, 2002, 1996, 2002, 1996, 1996, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996,
-     1996, 2002, 2002, 2002, 2002, 1996, 1996, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002,
-     2002, 1996, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 1996, 2002, 2002, 1996, 2002, 1996, 1996,
-     1996, 2002, 2002, 2002, 1996, 2002, 2002, 1996, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 1996, 2002, 2002, 1996, 2002, 2002, 1996, 2002,
-     2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 1996, 2002, 2002, 1996, 2002, 2002,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 1996, 2002, 1996, 1996,
-     1996, 2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 1996,
-     1996, 2002, 2002, 2002, 1996, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 1996, 1996, 2002, 1996, 2002,
-     2002, 2002, 1996, 1996, 1996, 2002, 1996, 2002, 1996, 2002,
-     2002, 2002, 1996, 2002, 2002, 1996, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996,
-     1996, 2002, 1996, 2002, 1996, 2002, 2002, 1996, 2002, 2002,
-     2002, 2002, 1996, 1996, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 1996, 1996, 1996, 2002, 1996, 2002, 2002, 2002, 1996,
-
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 1996,
-     2002, 1996, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 1996,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     1996, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002, 2002,
-     2002, 2002, 2002, 2002, 1996, 2002, 1996, 1996, 2002, 2002,
-     2002, 2002, 2002, 1996, 1996,    0, 1996, 1996, 1996, 1996,
-
-     1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996
+     2212,    1, 2212,    3, 2212,    5, 2212,    7, 2212,    9,
+     2212,   11, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   28,
+       30,   29,   14,   30,   14,   30,   30,   14,   35,   29,
+     2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212,
+     2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212,
+     2212, 2212, 2212, 2212, 2212, 2212,   62,   14,   20,   15,
+     2212,   19,   71, 2212,   68,   75,   75,   75,   76,   75,
+       75,   75,   80,   75,   75,   75,   81,   87,   78,   75,
+       80,   91,   77,   93,   75,   88,   89,   75,   85,   95,
+
+       76,   75,   99,   96,   94,   75,   75,  106,   95,  107,
+       89,   92,  105,  112,  109,  111,   75,  116,  110,   75,
+       99,  114,   98,   75,  117,  122,   75,   75,   75,  109,
+      124,  126,  130,   41,   45,  134,   46,   50,  137,   51,
+       56,   52,  140,   57,   61,  144,   62,   66,   64, 2212,
+      147,  151,   72,  133,  123,  120,   75,   99,  156,  118,
+      160,  155,  154,  117,  155,  160,  161,  164,  131,  158,
+      163,  171,  172,  113,  108,  172,  104,  159,  178,  132,
+      176,  181,  180,  160,  127,  165,  168,  186,  186,  157,
+      180,  161,  128,  189,  182,  194,  196,  196,  175,  119,
+
+      200,  184,  201,  203,  190,  200,  195,  178,  202,  198,
+      207,  204,  191,  210,  209,  215,  199,  214,  170,  169,
+      187,  218,  218,  219,  173,  149,  151,  219,  205,  223,
+      211,  230,  208,  191,  177,  229,  236,  197,  216,  221,
+      240,  240,  242,  185,  233,  238,  246,  192,  248,  232,
+      235,  250,  243,  231,  254,  252,  215,  234,  193,  206,
+      253,  246,  258,  247,  263,  261,  265,  220,  256,  262,
+      268,  267,  249,  259,  269,  273,  260,  271,  270,  278,
+      270,  281,  257,  245,  276,  285,  280,  255,  266,  284,
+      288,  278,  257,  275,  267,  293,  291,  297,  251,  274,
+
+      286,  294,  297,  277,  296,  290,  299,  281,  307,  309,
+      306,  301,  302,  151,  312,  311,  305,  302,  318,  317,
+      316,  303,  321,  318,  320,  292,  309,  324,  328,  322,
+      330,  325,  329,  333,  327,  335,  336,  337,  338,  339,
+      335,  328,  312,  312,  330,  339,  344,  342,  348,  349,
+      346,  345,  332,  289,  352,  355,  354,  348,  315,  347,
+      351,  349,  355,  360,  326,  361,  334,  366,  357,  363,
+      362,  369, 2212,  372,  358,  371,  376,  364,  353,  365,
+     2212,  379,  379,  341,  375,  378,  370,  377,  374,  386,
+      385,  391,  391,  376,  366,  395,  387,  334,  359,  399,
+
+      383,  399,  398,  397,  368,  401,  389,  407,  407,  396,
+      380,  410,  402,  393,  397,  386,  413,  412,  418, 2212,
+      151,  391,  411,  423,  424,  388,  426,  423,  422,  428,
+      405,  418,  415,  431,  417,  429,  425,  427,  438,  429,
+      439,  441,  440,  443,  394,  433,  417,  395,  443,  403,
+      448,  446,  406,  449,  452,  455,  434,  424,  409,  458,
+      455,  461,  456,  454,  416,  434,  451,  408,  463,  462,
+      470,  471,  437,  471,  472,  430,  460,  432,  447,  476,
+      464,  419,  466,  483,  426,  474,  477,  469,  481,  486,
+      489,  484,  490,  491,  473,  495,  491,  465,  453,  499,
+
+      498,  492,  493,  497,  503,  479,  505,  487,  508,  506,
+      499,  451,  498,  478,  509,  510,  514,  497,  516,  519,
+      459,  512,  522,  503,  475,  520,  496,  527,  524,  528,
+      529,  531,  515,  530,  513,  488,  535,  151,  492,  522,
+      540,  537,  537, 2212,  518,  511,  540,  547,  533,  545,
+      485,  549,  552,  548, 2212,  517, 2212, 2212,  556, 2212,
+     2212,  543,  562, 2212,  563,  547,  521,  550,  567,  541,
+      532,  571,  552,  553,  539,  575,  534,  567,  556,  578,
+      572,  575,  581,  583,  548,  526,  546,  586,  551,  580,
+      579,  536,  590,  592,  573,  585,  583,  576,  568,  562,
+
+      597,  594,  599,  603,  582,  565,  589,  607,  593,  595,
+      601,  577,  588,  598,  600,  608,  604,  613, 2212,  615,
+      620,  605,  602,  611,  624,  584,  626,  609,  591,  629,
+      622, 2212,  570,  625,  633,  587,  636,  636,  621,  639,
+      610,  618,  639,  596,  623,  606,  614,  638,  645,  617,
+      650,  640,  642,  648,  634,  635,  628,  651,  622,  641,
+      660,  658,  648,  647,  660,  151,  629,  652,  653,  630,
+      649,  663,  659,  657,  668,  667,  676,  675,  676,  655,
+      671,  681,  678,  679,  684,  680,  682,  656,  687,  643,
+      646,  662,  664,  691,  644,  686,  689,  695,  674,  696,
+
+      700,  683,  665,  697,  669,  693,  702, 2212,  692,  659,
+      705,  661,  709,  700,  711,  690,  716,  717,  717,  715,
+      714,  672,  704,  710,  703,  722,  719,  727,  713, 2212,
+      720,  721,  691,  732,  734,  725,  684,  734,  738,  739,
+      731,  728,  699,  729,  712, 2212,  718,  744,  743,  724,
+      723,  726,  737,  752,  698,  706,  741,  756,  750,  759,
+      747,  740,  762,  733,  761,  764,  758,  742,  736,  759,
+      769,  757,  754,  745,  744,  763,  776, 2212,  771,  770,
+      780,  755,  775,  783,  753,  777,  767,  772,  751,  782,
+      790,  779,  768,  788,  794, 2212,  794,  151,  789,  785,
+
+      773,  784,  802,  786,  804,  799,  806,  805,  800,  797,
+      810,  809,  810,  787,  807,  792,  766,  801,  818,  808,
+      811,  815,  780,  816,  793,  820,  813,  790,  826,  827,
+     2212,  830,  825,  812,  830,  834,  821,  828,  835,  839,
+      824,  817,  836,  837,  823,  818,  833, 2212,  803,  822,
+      850,  846,  829,  838,  849,  839,  850,  857,  819,  858,
+      847,  849,  859,  853,  862,  864,  861,  864,  868,  863,
+      867,  857,  869,  862,  872,  875,  843,  873,  876,  841,
+      874,  881,  851,  878,  832,  880,  870,  887,  888, 2212,
+      885,  877,  880,  871,  882,  879,  856,  894, 2212,  898,
+
+     2212,  883,  896,  898,  893,  866,  900,  892,  907, 2212,
+      845,  884,  897,  909,  852,  914,  912,  917,  916,  915,
+      917,  902,  921,  887,  905,  925,  926,  860, 2212,  882,
+      930,  923,  931,  904,  913,  889,  919,  920,  938,  939,
+      933,  939,  939,  943,  925,  924,  943,  906,  945,  932,
+      937,  940,  950, 2212,  935,  951,  934,  922,  958,  903,
+      941,  961,  936,  955,  964,  949,  953,  967,  966,  947,
+      962,  969,  964,  944,  960,  975,  976,  973,  968,  927,
+      979,  972,  981,  983,  957,  977,  926,  987,  984,  961,
+      990,  946,  992, 2212,  951,  971,  985,  982,  989,  975,
+
+      978,  995, 1002, 1001, 2212,  991,  970, 1004, 1008, 1009,
+      965, 1007, 1012, 1013,  993, 1013,  998, 1010,  987, 1006,
+     1018, 1021, 1020, 1022, 1024, 1000,  988,  986, 1015, 1029,
+      996,  974,  995,  999, 1031, 1035,  997, 1036, 1025, 2212,
+     1016, 1033, 1038, 2212, 1034, 1035, 1017, 1041, 1023, 2212,
+     1047, 2212, 1045, 1029, 1049, 2212, 1042, 2212, 1057, 1059,
+     2212, 1030, 1054, 1028, 1064, 1026, 1053, 1064, 1059, 1046,
+     1048, 1063, 1072, 1073, 1070, 1025, 1067, 2212, 1069, 1051,
+     1066, 1072, 1077, 1071, 1084, 1037, 1085, 1087, 1083, 1055,
+     1087, 1090, 2212, 1081, 1079, 1076, 1096, 2212, 1097, 1082,
+
+     1032, 1091, 1097, 1092, 1089, 1086, 1105, 1065, 1062, 1095,
+     1104, 1100, 1080, 1096, 1102, 1111, 1107, 1116, 1118, 1117,
+     1110, 1120, 1113, 1115, 1124, 1094, 1125, 1126, 1101, 1129,
+     1118, 1127, 1132, 1128, 1134, 2212, 1121, 1133, 1122, 1139,
+     1140, 1129, 1141, 2212, 1140, 2212, 1106, 1097, 1108, 1137,
+     1150, 1109, 1139, 1131, 1152, 1135, 1088, 1153, 1138, 1143,
+     1147, 1114, 1161, 1161, 1155, 1154, 1151, 1159, 1130, 1123,
+     1134, 1160, 1172, 1129, 2212, 1149, 1170, 1112, 1173, 1164,
+     1158, 1178, 1180, 1177, 2212, 1180, 1166, 1184, 1181, 1187,
+     1148, 1168, 1190, 1169, 1186, 2212, 2212, 1162, 1198, 1194,
+
+     1188, 1198, 1193, 1179, 1201, 2212, 1167, 1192, 1208, 1189,
+     1210, 1211, 1186, 1213, 2212, 1214, 1207, 1171, 1218, 1174,
+     1220, 1202, 1203, 1221, 1205, 1191, 1217, 1165, 1227, 2212,
+     1212, 1213, 1229, 1224, 1231, 1232, 1234, 1216, 1235, 1236,
+     1208, 1238, 1233, 1223, 1244, 2212, 1222, 1241, 1243, 1248,
+     1249, 1245, 1251, 1209, 1244, 1228, 2212, 1255, 1225, 1258,
+     1253, 1250, 1262, 1261, 1264, 1260, 1247, 1262, 1268, 1266,
+     1269, 2212, 1270, 1218, 1252, 1264, 1276, 1265, 1271, 1279,
+     1278, 1277, 1236, 1276, 2212, 2212, 1283, 1284, 1288, 1289,
+     1242, 1237, 1259, 1288, 1291, 1295, 1287, 1282, 1281, 1298,
+
+     1299, 1301, 2212, 1239, 1270, 1279, 1296, 1305, 1308, 1309,
+     1294, 1304, 1297, 1306, 1247, 1292, 1256, 1293, 1300, 1301,
+     1295, 1314, 1315, 1321, 1324, 1325, 1313, 1311, 1302, 1328,
+     1275, 1274, 1322, 1310, 1330, 1335, 1334, 1319, 1316, 1337,
+     2212, 1339, 1325, 1342, 1344, 1340, 1280, 1346, 1344, 2212,
+     1317, 1320, 1335, 1353, 1333, 1326, 1312, 1356, 1327, 2212,
+     1357, 2212, 1351, 1349, 2212, 1364, 1354, 1355, 1359, 1318,
+     1323, 1343, 1361, 1348, 1332, 2212, 1366, 1370, 1369, 1379,
+     2212, 1367, 2212, 1382, 2212, 1324, 1375, 1374, 1388, 1352,
+     1390, 2212, 1380, 1382, 2212, 1394, 1368, 1390, 1393, 1331,
+
+     1366, 1401, 1402, 1338, 1386, 1371, 2212, 1397, 1408, 2212,
+     1373, 1391, 1378, 1411, 1396, 1414, 1403, 2212, 1399, 2212,
+     1400, 1388, 1409, 1416, 1358, 2212, 1387, 1394, 1404, 1424,
+     1412, 1430, 1363, 1432, 1413, 1423, 1422, 1434, 1438, 1384,
+     1440, 2212, 1371, 1427, 1428, 1398, 1405, 1436, 1437, 1438,
+     1431, 1417, 1445, 1452, 1451, 1453, 1419, 1452, 2212, 1450,
+     1460, 2212, 1439, 1448, 1435, 1440, 2212, 1425, 2212, 1468,
+     1447, 1471, 1457, 1456, 1473, 1474, 1443, 1477, 1461, 1463,
+     1476, 1441, 1464, 2212, 2212, 1476, 1475, 1486, 1446, 1458,
+     1465, 1449, 1479, 1488, 2212, 1472, 1493, 1497, 1471, 1497,
+
+     1491, 1466, 1494, 1478, 1499, 1500, 1506, 1477, 2212, 1508,
+     1498, 1511, 1510, 1513, 1490, 1514, 1515, 2212, 1503, 1519,
+     1480, 1521, 1521, 1489, 1519, 1525, 1505, 1523, 1524, 1517,
+     1526, 1531, 1532, 1513, 1533, 1501, 1535, 1537, 1506, 1538,
+     1527, 1536, 1529, 1540, 1543, 1534, 2212, 1539, 1544, 1546,
+     1549, 1482, 1542, 1553, 1520, 1545, 1551, 1550, 1541, 1559,
+     1558, 1557, 2212, 1562, 1511, 1560, 1504, 1562, 1561, 1568,
+     2212, 1507, 1545, 1573, 2212, 1517, 1548, 1577, 1528, 1516,
+     1577, 1581, 1573, 1574, 1584, 1522, 1586, 1567, 2212, 1564,
+     2212, 1585, 1573, 1587, 1593, 1590, 2212, 1566, 1592, 2212,
+
+     1576, 2212, 1555, 1582, 1590, 1601, 1570, 2212, 1607, 1586,
+     1593, 1606, 1610, 1569, 1611, 2212, 1588, 1603, 1609, 1604,
+     1605, 1621, 1613, 1617, 1622, 1620, 1594, 1554, 1626, 2212,
+     1629, 1629, 1627, 1633, 1634, 2212, 2212, 1623, 1615, 1618,
+     1572, 1639, 2212, 2212, 2212, 1619, 2212, 1646, 2212, 2212,
+     1646, 2212, 1625, 1632, 1651, 2212, 1640, 1654, 1655, 2212,
+     1659, 2212, 1658, 1633, 1642, 1631, 1666, 1663, 2212, 1614,
+     1598, 1612, 1661, 2212, 1599, 1664, 1648, 1671, 2212, 1673,
+     2212, 1668, 1635, 1638, 1682, 1680, 1686, 1687, 1672, 1677,
+     1665, 1690, 1689, 1693, 1694, 1685, 1653, 1688, 1675, 1641,
+
+     1697, 1701, 1702, 1684, 1691, 1699, 1692, 1667, 1696, 1709,
+     1698, 1711, 1705, 2212, 2212, 1701, 1707, 1708, 1716, 1706,
+     1719, 1717, 1713, 2212, 1712, 1720, 1722, 1727, 1678, 1727,
+     1730, 1666, 1670, 1725, 1734, 1676, 1731, 1729, 1733, 1710,
+     1721, 1741, 1740, 1683, 2212, 1726, 2212, 1723, 1739, 2212,
+     1743, 1749, 2212, 2212, 1736, 1742, 1756, 1735, 1738, 1737,
+     1758, 1695, 1762, 2212, 1759, 1763, 1761, 1702, 2212, 1767,
+     1752, 1770, 1772, 2212, 2212, 2212, 1748, 1718, 1768, 1777,
+     1746, 1751, 1782, 1771, 1784, 2212, 1765, 1783, 1788, 1787,
+     1773, 1791, 1728, 1789, 1755, 1794, 1792, 1797, 2212, 2212,
+
+     1779, 1795, 1766, 1796, 1781, 1790, 1785, 1804, 1762, 2212,
+     1757, 1808, 1760, 1801, 1805, 1815, 1780, 1816, 2212, 2212,
+     1784, 1756, 1821, 1798, 1823, 1818, 1806, 1824, 1825, 1803,
+     1828, 1812, 1831, 1833, 1829, 1807, 1832, 2212, 1826, 1814,
+     2212, 1834, 1830, 1843, 1827, 2212, 1817, 2212, 1834, 2212,
+     2212, 1822, 1847, 1849, 1809, 1811, 1854, 1857, 1858, 1813,
+     1844, 1802, 1859, 1843, 2212, 2212, 1863, 1864, 1868, 1862,
+     2212, 2212, 1837, 1860, 1873, 1860, 1852, 1861, 1863, 1835,
+     1836, 1880, 1853, 1883, 1884, 1885, 1875, 1877, 1888, 1839,
+     1888, 1891, 2212, 1879, 1856, 1876, 2212, 1894, 1887, 2212,
+
+     1896, 2212, 2212, 1890, 1901, 1898, 1864, 1904, 1905, 2212,
+     1845, 1906, 1840, 1908, 2212, 1914, 1855, 2212, 1917, 1919,
+     2212, 2212, 2212, 1899, 1885, 1916, 2212, 1924, 1925, 2212,
+     1906, 1926, 1892, 1870, 1934, 1928, 1905, 1934, 1920, 1931,
+     2212, 1882, 1911, 1940, 1913, 1907, 1932, 1886, 1942, 1881,
+     1936, 1889, 1944, 1949, 2212, 1953, 1956, 2212, 1957, 1959,
+     1952, 1951, 2212, 1959, 1933, 1943, 1954, 1967, 1967, 2212,
+     1925, 1971, 1960, 1964, 1962, 1974, 1969, 1919, 1965, 1976,
+     1980, 1971, 2212, 1978, 1979, 1981, 1975, 1977, 1938, 1937,
+     1980, 2212, 1991, 1988, 2212, 1993, 1987, 1972, 1997, 1996,
+
+     2000, 2001, 1999, 2212, 2002, 2212, 2212, 2212, 2003, 2009,
+     1982, 2212, 2005, 1985, 2010, 1998, 2014, 1947, 2013, 2015,
+     2212, 1984, 2212, 1950, 2019, 2020, 2212, 2017, 2028, 2026,
+     2022, 2024, 2032, 2033, 2033, 2034, 2030, 2212, 2212, 2029,
+     2212, 2025, 2042, 2043, 2212, 2212, 2212, 2043, 2212, 2048,
+     2050, 2044, 2212, 2011, 1994, 2051, 2033, 2016, 2212, 2056,
+     2060, 2061, 2212, 2057, 2018, 2054, 2061, 2067, 2037, 2069,
+     2062, 2036, 2069, 2073, 2055, 2068, 2212, 2212, 2076, 2212,
+     2212, 2212, 2079, 2040, 2083, 2212, 2065, 2085, 2212, 2212,
+     2031, 2066, 2071, 2088, 2212, 2212, 2094, 2097, 2058, 2074,
+
+     2075, 2064, 2034, 2212, 2212, 2212, 2100, 2212, 2097, 2212,
+     2052, 2084, 2099, 2212, 2113, 2115, 2101, 2102, 2103, 2070,
+     2093, 2094, 2112, 2122, 2087, 2124, 2126, 2107, 2128, 2120,
+     2121, 2098, 2113, 2212, 2127, 2212, 2131, 2212, 2212, 2117,
+     2132, 2141, 2133, 2116, 2140, 2212, 2143, 2145, 2144, 2149,
+     2148, 2129, 2152, 2151, 2092, 2153, 2156, 2157, 2154, 2142,
+     2135, 2161, 2159, 2163, 2160, 2164, 2150, 2212, 2158, 2166,
+     2170, 2167, 2155, 2169, 2171, 2173, 2176, 2174, 2162, 2175,
+     2161, 2179, 2182, 2180, 2178, 2184, 2212, 2185, 2188, 2186,
+     2190, 2177, 2191, 2193, 2192, 2181, 2183, 2196, 2198, 2197,
+
+     2212, 2189, 2212, 2212, 2202, 2194, 2206, 2199, 2208, 2212,
+     2212,    0
     } ;
 
-static yyconst flex_uint16_t yy_nxt[3979] =
+static yyconst flex_uint16_t yy_nxt[3206] =
     {   0,
-       14,   15,   16,   17,   18,   19,   18,   14,   14,   14,
-       14,   18,   20,   21,   14,   22,   23,   24,   25,   14,
-       26,   27,   28,   29,   30,   31,   32,   33,   34,   35,
-       36,   37,   38,   39,   40,   14,   14,   14,   14,   42,
-       43,   44,   42,   43,   44,  131,   47,   48,  131,   45,
-       49,   70,   45,   47,   48,   71,   50,   49,   58,   59,
-       60,   69,   69,   50,   52,   53,   54,   55,   61,   18,
-       58,   59,   60,  129,  129,   56,   52,   53,   54,   55,
-       61,   18,   69,  106,  234,   75,   76,   56,   15,   16,
-       17,   63,   64,   65,   68,   68,   69,   68,   68,   66,
-
-       68,   97,   69,   77,   69,   68,   86,  143,   67,   15,
-       16,   17,   63,   64,   65,   69,   69,   78,   69,   90,
-       66,   69,   88,   69,   79,  131,   87,   91,  131,   67,
-       73,   80,   73,   73,   69,   73,   89,  154,   96,   69,
-       73,   74,   69,   92,  136,  136,   93,   81,   69,   98,
-       69,   82,  139,   94,   83,   95,   84,   85,   69,   99,
-       69,  103,  112,  180,   69,  104,  142,  100,   70,  117,
-       69,  113,   71,  101,   69,  114,   69,  102,  144,  118,
-       69,  105,   69,  119,  120,  115,   69,  107,  116,  146,
-       69,  108,   69,  121,  124,  122,  145,  109,  139,  125,
-
-      110,   69,  147,   69,  126,   69,  164,  111,  127,  155,
-      123,  133,  128,  133,  133,   73,  133,   73,   73,  138,
-       73,  138,  138,  148,  138,   68,  141,   68,   68,   69,
-       68,   69,   69,   69,  139,   68,   73,   69,   73,   73,
-      156,   73,   69,  149,  160,   69,   73,   74,  150,  152,
-      153,  158,  159,   69,  151,   69,   69,   69,  157,   69,
-      163,   69,  166,  170,   69,  167,   69,   69,   69,  172,
-      174,  161,   69,  162,  175,  165,  171,   69,  168,  169,
-       69,  178,   69,   69,   69,   69,  177,  179,   69,  173,
-      176,  181,   69,   69,   69,  182,  185,   69,  190,   69,
-
-       69,   69,   69,  183,  187,  189,  184,   69,  188,   69,
-      196,  186,   69,  192,  191,   69,  193,   69,  198,   69,
-       69,  194,   69,   69,  197,  195,   69,  200,  203,   69,
-       69,   69,  129,  129,  205,  201,  208,  237,  199,  137,
-      207,  202,  206,  133,  139,  133,  133,  209,  133,  204,
-      136,  136,  138,   69,  138,  138,   73,  138,   73,   73,
-       69,   73,   69,  211,   69,  210,   69,  141,   69,   69,
-       69,   69,  213,  216,  135,  218,  220,  212,   69,  217,
-       69,  219,   69,  221,  215,  214,  222,  223,   69,   69,
-       69,   69,   69,  230,   69,  232,   69,  231,   69,  233,
-
-      235,   69,   69,  236,   69,   69,  241,  242,   69,  224,
-       69,  261,   69,  243,  225,  134,  238,  239,   69,  226,
-      240,   69,  244,  250,  227,   69,  251,  245,   69,   69,
-      228,  229,  248,  252,  249,  254,   69,  257,   69,  246,
-       69,  247,   69,   69,  253,  255,  259,  260,  258,   69,
-      256,   69,   69,   69,   69,   69,   69,   69,   69,  263,
-       69,  265,  262,   69,   69,  267,   69,   69,  269,   69,
-      132,  268,  272,   69,  264,  270,  276,   69,  266,  278,
-       69,   69,   69,   69,  271,  280,   69,  279,  273,  277,
-       69,  274,  275,   69,  283,  282,  139,  284,  286,   69,
-
-       69,  281,   69,   69,   69,   69,  287,  293,  290,  289,
-       69,  295,   69,  292,   69,  294,   69,   69,  291,   69,
-      285,   69,   69,  288,  301,  300,   69,   69,  302,  296,
-      299,   69,  303,  298,  304,  297,   69,   69,   69,  305,
-       69,  306,   69,  307,   69,  309,   69,  312,  310,   69,
-       69,  308,   69,  314,   69,  311,   69,  315,   69,  316,
-      317,   69,   69,  313,   69,   69,   69,  322,   69,   69,
-      318,  323,   69,   69,   69,  327,  325,  321,   69,  319,
-       69,  330,   69,  320,   69,  331,   69,  324,   69,   69,
-       69,  326,  329,  333,   69,   69,  328,   69,  337,   69,
-
-      332,  334,  335,   69,  336,  341,  342,  339,  130,  340,
-      347,  338,  343,   69,   69,   69,  345,  344,   69,  346,
-      350,   69,   69,   69,  348,   69,  352,  349,  351,   69,
-       69,   69,   69,  357,  354,   69,   69,  353,   69,  360,
-      359,  361,  355,   69,   69,   69,   69,   69,  367,   69,
-       69,  356,  358,   69,  366,  368,   69,  362,   69,  369,
-      363,  374,  372,  364,   69,  365,   69,  370,   69,  371,
-      373,  139,   69,   69,  428,  385,   69,  375,  376,   69,
-      386,  377,  378,  384,  387,   69,   69,  390,   69,   69,
-       69,  379,  388,  380,  381,  382,  391,  392,  383,   69,
-
-       69,   69,   69,  398,   69,  389,  396,   69,   69,  394,
-      399,  393,  402,   69,  395,  397,  400,   69,   69,  405,
-      406,  401,   69,  404,   69,   69,   69,   69,   69,  403,
-      411,   69,   69,   69,   69,   69,  412,  413,   69,   69,
-      430,  408,  409,   69,  407,  410,   69,  416,  418,  415,
-       69,  419,  414,   69,  420,   69,  422,   69,   69,  425,
-      417,   69,  421,  424,  423,   69,   69,   69,  431,  432,
-      426,  429,   69,   69,   69,   69,  433,   69,  427,   69,
-      435,   69,   69,  439,   69,  438,  436,   69,   69,  440,
-       69,  437,   69,  442,  434,   69,  443,   69,  445,   69,
-
-       69,   69,   69,   69,   69,  453,  446,   69,  441,  444,
-       69,   69,  448,  454,   69,  456,  455,  452,  457,  447,
-      449,  451,  450,   69,  458,   69,   69,   69,   69,   69,
-      462,   69,   69,  464,   69,  476,  460,   69,   69,   69,
-       69,  478,  463,   69,   69,  477,  461,  459,  465,   69,
-      466,   69,  467,   69,  473,  475,  474,  468,   69,  469,
-       69,  480,   69,  479,   69,  482,   69,  470,  483,  481,
-      471,  487,   69,  485,  484,   69,   69,  472,   69,  139,
-      488,  489,   69,  493,  494,  486,   69,   69,  492,   69,
-       69,   69,   69,  491,   69,  490,  499,   69,  495,  498,
-
-       69,  501,   69,  497,  500,  496,   69,   69,   69,  504,
-      503,   69,  502,  505,  506,  509,   69,   69,  507,  510,
-       69,  508,  512,   69,  513,   69,  514,  515,   69,  511,
-      517,   69,  516,   69,   69,   69,   69,   69,  518,  519,
-      522,  521,   69,   69,   69,   69,  523,  526,  524,   69,
-       69,   69,   69,  529,  527,  520,   69,   69,  530,   69,
-      533,   69,  531,   69,  525,  528,  535,   69,  536,   69,
-       69,  538,   69,  540,  532,  534,   69,  543,  539,   69,
-       69,  537,   69,  541,   69,  544,   69,   69,   69,  550,
-       69,  547,   69,   69,   69,  552,  551,  546,  545,   69,
-
-      549,   69,  553,  548,   69,  542,  554,  557,   69,  559,
-       69,  555,   69,  558,   69,  561,   69,  562,  556,  560,
-       69,  563,   69,   69,  566,   69,   69,   69,   69,   69,
-      568,  570,   69,  564,  567,  571,  565,   69,   69,  572,
-       69,   69,   69,  573,  575,  569,   69,  574,   69,   69,
-      576,   69,  580,   69,   69,  577,   69,  578,  581,  586,
-       69,   69,   69,  589,   69,   69,  579,   69,  582,  583,
-       69,  585,  592,  584,  590,   69,  591,   69,   69,  587,
-      588,   69,   69,   69,   69,  596,   69,  597,   69,  599,
-      598,  593,   69,  600,  595,   69,  594,   69,   69,  602,
-
-      139,   69,   69,   69,  601,  606,  603,  605,   69,  604,
-       69,  607,   69,  610,  608,   69,   69,   69,  613,   69,
-      617,  611,  609,   69,  612,   69,   69,  618,  621,  615,
-       69,  616,   69,   69,  619,  620,  614,   69,   69,   69,
-       69,  632,  622,  631,   69,  627,  623,  629,   69,  624,
-      628,   69,  633,   69,  630,   69,  625,   69,  641,  626,
-       69,  634,  635,   69,  636,   69,  644,  637,   69,  642,
-      645,   69,  638,   69,  647,  646,   69,  654,  639,  640,
-      643,   69,  649,   69,   69,   69,   69,  651,  650,   69,
-      652,  648,   69,   69,  653,   69,   69,  659,   69,   69,
-
-       69,   69,  139,  658,   69,  655,  664,  665,   69,  656,
-      666,   69,  657,  660,  661,   69,  663,  662,  667,   69,
-       69,   69,  668,   69,   69,   69,  669,   69,   69,  670,
-      675,   69,  671,  673,  674,  676,   69,   69,   69,  679,
-      677,   69,   69,  672,   69,  678,   69,   69,   69,  683,
-      681,  682,   69,  685,   69,   69,   69,  680,  688,   69,
-       69,  684,   69,  686,  691,   69,  689,   69,   69,   69,
-       69,   69,   69,  697,   69,   69,  696,  690,  687,  700,
-       69,  692,  693,   69,   69,   69,  701,  694,  695,  698,
-      703,  699,  704,   69,  702,  705,  707,  706,  708,   69,
-
-       69,   69,   69,   69,  709,   69,  714,   69,  715,   69,
-      713,  716,  717,   69,  711,   69,   69,   69,  710,  720,
-      722,   69,  712,   69,   69,  724,  139,   69,  719,   69,
-       69,  718,   69,  726,   69,   69,   69,  721,   69,  737,
-      738,  723,  725,   69,   69,   69,   69,   69,  729,  727,
-      741,   69,   69,  768,   69,  730,  728,   69,  739,  743,
-      731,  744,  732,   69,   69,  745,  733,  742,  734,  740,
-       69,   69,   69,  735,  746,   69,  748,  750,  736,  747,
-       69,   69,  137,  755,  752,   69,  749,  754,   69,  751,
-      756,   69,   69,   69,  753,   69,  757,  762,  763,   69,
-
-       69,  758,   69,  759,   69,  766,  764,  767,   69,  771,
-       69,  765,   69,  773,  760,   69,  772,   69,   69,  770,
-      774,  761,  769,   69,  777,   69,   69,   69,   69,   69,
-      778,   69,   69,   69,  775,   69,  776,  780,   69,   69,
-      781,  783,   69,  782,  785,  779,  791,   69,   69,   69,
-       69,   69,  784,   69,   69,  786,  787,  789,  788,  790,
-       69,   69,  799,  798,   69,  795,  792,  793,  794,  796,
-       69,  800,   69,   69,  803,  797,   69,   69,  804,   69,
-       69,  805,   69,   69,  806,  801,  807,   69,   69,  802,
-       69,  808,   69,  812,   69,   69,   69,   69,   69,   69,
-
-      815,  816,  809,  810,  817,   69,  821,  811,  820,   69,
-      814,  819,   69,  813,   69,  818,   69,  823,   69,   69,
-       69,  828,   69,   69,   69,   69,   69,  829,  830,   69,
-      822,   69,  832,  827,  824,  835,  833,  825,   69,  826,
-       69,  836,  831,  834,   69,   69,   69,  839,   69,  838,
-       69,   69,  843,  837,   69,   69,   69,   69,   69,   69,
-       69,   69,  842,  852,  840,  841,  845,   69,   69,  135,
-       69,  853,  844,   69,  846,  849,   69,   69,  848,   69,
-      851,   69,  850,  847,  854,   69,  855,  856,   69,  860,
-      858,  857,   69,   69,   69,  864,   69,   69,   69,  861,
-
-       69,   69,   69,  859,   69,  869,  867,  870,  862,   69,
-       69,  865,   69,  863,   69,  873,  866,  871,   69,   69,
-       69,  868,   69,  872,  876,   69,   69,  875,   69,   69,
-      878,   69,  874,  880,   69,  881,   69,   69,   69,  877,
-       69,  879,   69,  882,  885,   69,   69,   69,  886,  884,
-      883,  890,   69,  894,   69,   69,   69,  887,   69,   69,
-      889,  888,  891,  893,  896,   69,  892,   69,   69,  895,
-      898,  899,  897,  900,   69,   69,  905,  901,   69,   69,
-       69,   69,  903,  908,   69,  909,  902,  904,   69,  907,
-       69,   69,  906,   69,   69,  910,   69,  914,  912,  913,
-
-      911,   69,   69,   69,   69, 1113,  919,  916,  920,   69,
-      915,   69,   69,   69,  921,   69,  922,  917,   69,  928,
-       69,   69,  918,   69,  929,  931,   69,   69,   69,   69,
-      932,  930,  923,   69,   69,   69,  939,  924,  934,  925,
-       69,  926,  935,  927,   69,  933,  936,   69,  937,  940,
-       69,   69,  938,  941,  944,   69,  946,   69,  942,   69,
-       69,   69,  947,  950,   69,  948,  945,   69,  952,   69,
-       69,   69,  955,   69,   69,  943,  953,   69,   69,   69,
-      949,   69,  957,  134,  959,   69,  958,  951,   69,  960,
-       69,  954,  963,   69,  956,  965,  962,  966,   69,  961,
-
-       69,   69,   69,  967,  968,   69,  964,   69,   69,   69,
-      969,  972,   69,   69,   69,  976,   69,   69,  971,   69,
-       69,   69,   69,   69,  970,   69,  982,   69,  973,  980,
-      977,  987,   69,  974,   69,   69,  978,  975,   69,  979,
-      981,  983,   69,  986,   69,  985,  991,  989,  984,   69,
-      992,   69,   69,  993,  990,   69,   69,  988,  995,  997,
-      994,   69,   69,  996,   69,  998,  999,   69,   69,   69,
-       69,   69,   69,   69, 1003,   69, 1006,   69,   69, 1025,
-       69, 1000,   69,   69,   69,   69, 1002, 1009, 1004,   69,
-     1014, 1005, 1008, 1001, 1010, 1007, 1015, 1011, 1012,   69,
-
-       69,   69,   69, 1013, 1016,   69,   69,   69, 1023, 1024,
-     1018, 1020, 1022,   69,   69,   69, 1026, 1019, 1017, 1027,
-       69,   69,   69,   69,   69, 1028,   69, 1021,   69, 1031,
-     1034, 1029, 1036,   69, 1035,   69, 1037,   69,   69,   69,
-     1032, 1030,   69,   69,   69,   69,   69, 1033,   69, 1045,
-       69, 1044,   69, 1038,   69,   69,   69, 1039, 1040,   69,
-       69, 1041, 1054, 1043, 1050, 1046,   69, 1047,  132, 1042,
-       69, 1048,   69, 1053, 1049, 1052,   69, 1051, 1055, 1056,
-       69, 1057,   69, 1059,   69,   69, 1058,   69,   69,   69,
-     1062, 1066,   69, 1060, 1063,   69,   69,   69, 1061, 1071,
-
-     1067, 1068,   69,   69,   69, 1069,   69, 1064, 1073, 1065,
-       69, 1074, 1075, 1076,   69,   69, 1070,   69, 1077,   69,
-     1072,   69, 1078,   69, 1079,   69, 1080,   69,   69,   69,
-     1081, 1086,   69, 1084,   69,   69,   69, 1089, 1087,   69,
-       69, 1083,   69,   69, 1085,   69, 1092,   69, 1082,   69,
-     1094, 1091, 1095,   69,   69, 1088,   69, 1098,   69, 1099,
-       69, 1090, 1093, 1097,   69, 1096,   69,   69,   69, 1104,
-       69, 1106, 1108, 1102,   69, 1105,   69,   69, 1100,   69,
-     1101, 1110,   69,   69,   69,   69, 1103,   69, 1107,   69,
-     1112,   69, 1114, 1109, 1116,   69, 1122, 1115, 1117, 1120,
-
-       69, 1118, 1111,   69,   69, 1121,   69, 1126, 1123, 1125,
-       69, 1127,   69, 1119, 1124,   69,   69,   69, 1131,   69,
-     1133,   69,   69,   69, 1132,   69,   69, 1135, 1136,   69,
-       69, 1137,   69, 1128,   69, 1129,   69, 1130, 1144,   69,
-       69,   69,   69,   69, 1134,   69,   69,  130, 1138,   69,
-     1141, 1142, 1139, 1143, 1140, 1149,   69,   69,   69, 1147,
-       69, 1145, 1146, 1151,   69,   69,   69, 1148,   69, 1150,
-       69, 1153, 1152, 1162, 1154,   69, 1156, 1155, 1160,   69,
-     1163, 1157, 1161,   69,   69,   69, 1158,   69,   69,   69,
-     1170, 1171,   69, 1159, 1165,   69,   69, 1169, 1167,   69,
-
-     1164, 1168,   69,   69,   69,   69, 1166,   69,   69,   69,
-     1180,   69, 1173,   69,   69,   69, 1172, 1175,   69, 1177,
-     1174, 1176, 1182, 1183,   69, 1184, 1179, 1181,   69, 1178,
-     1189,   69, 1188, 1190,   69,   69, 1191, 1186, 1192, 1185,
-     1187,   69,   69,   69, 1195,   69,   69, 1193,   69,   69,
-       69, 1197,   69,   69, 1194, 1196, 1204, 1198, 1200, 1201,
-       69,   69,   69,   69, 1199, 1207,   69,   69,   69,   69,
-     1202, 1209, 1203, 1210, 1211,   69, 1205,   69,   69,   69,
-     1206,   69, 1212, 1208, 1213, 1216,   69,   69,   69,   69,
-       69,   69, 1222,   69, 1215, 1217, 1218,   69,   69, 1219,
-
-     1220, 1214,   69, 1223, 1225, 1226,   69,   69,   69, 1221,
-     1227, 1224, 1228,   69,   69, 1231,   69, 1230,   69, 1229,
-       69,   69,   69,   69,   69, 1233,   69,   69,   69, 1237,
-     1232, 1234,   69, 1235, 1243, 1238, 1242,   69, 1236,   69,
-       69,   69,   69, 1241, 1247,   69,   69, 1240, 1239, 1249,
-       69, 1251,   69, 1244,   69, 1253,   69,   69, 1252, 1245,
-       69, 1246, 1248,   69, 1255, 1257, 1254, 1250, 1261,   69,
-       69, 1259,   69,   69, 1256,   69, 1260,   69,   69,   69,
-     1268,   69, 1258, 1270,   69,   69,   69, 1271,   69, 1262,
-     1263, 1264, 1274,   69,   69,   69, 1265,   69, 1266, 1267,
-
-     1272, 1269,   69, 1276,   69, 1273,   69, 1279, 1280,   69,
-     1282,   69,   69, 1281,   69, 1277,   69,   69,   69, 1278,
-     1275, 1284,   69, 1287,   69, 1285,   69, 1283, 1291,   69,
-       69, 1290,   69,   69, 1294,   69, 1295, 1293,   69,   69,
-     1289,   69,   69, 1286, 1288, 1296,   69, 1297,   69, 1292,
-     1301,   69, 1299,   69, 1300,   69, 1302, 1298,   69, 1305,
-       69,   69,   69,   69,   69,   69,   69, 1309,   69, 1303,
-     1310, 1312,   69,   69, 1311, 1306,   69, 1308,   69, 1313,
-     1307, 1304, 1315,   69, 1314,   69, 1319, 1316, 1320,   69,
-     1317,   69, 1321, 1318, 1323,   69, 1322,   69, 1326,   69,
-
-       69,   69,   69,   69, 1324, 1328, 1331, 1325,   69,   69,
-     1330,   69, 1327, 1333, 1329,   69,   69, 1996,   69, 1335,
-       69, 1334,   69, 1336, 1337,   69, 1338,   69,   69, 1343,
-     1332,   69,   69,   69, 1340, 1339, 1341,   69, 1342,   69,
-       69,   69, 1344, 1345,   69, 1346, 1348,   69,   69,   69,
-       69, 1347,   69, 1350, 1353, 1355,   69, 1354,   69,   69,
-       69, 1349,   69, 1357,   69,   69, 1351,   69, 1352,   69,
-     1356, 1362,   69, 1360, 1358, 1363, 1359, 1366, 1361,   69,
-     1364, 1365,   69,   69, 1368,   69,   69, 1369, 1370,   69,
-       69,   69, 1373, 1371,   69,   69, 1367,   69,   69,   69,
-
-       69,   69,   69, 1374,   69,   69,   69, 1381,   69, 1376,
-     1372, 1377, 1378, 1385,   69,   69, 1375, 1380,   69,   69,
-     1382, 1386, 1387, 1388, 1379, 1383, 1384,   69,   69, 1391,
-     1392,   69,   69,   69, 1389,   69, 1996, 1390, 1394,   69,
-     1393, 1395,   69,   69, 1400,   69,   69, 1396, 1397,   69,
-     1398, 1401,   69,   69,   69, 1399, 1406,   69, 1402,   69,
-     1403,   69, 1407,   69, 1410,   69,   69,   69, 1405,   69,
-     1411,   69, 1404, 1412, 1408,   69, 1414, 1416, 1413, 1415,
-     1417,   69,   69, 1409,   69,   69,   69,   69,   69,   69,
-     1420, 1418, 1421,   69,   69,   69, 1419,   69,   69, 1422,
-
-     1426, 1427,   69, 1431,   69,   69,   69, 1424, 1423, 1425,
-       69, 1430, 1428,   69, 1432, 1433,   69, 1435,   69,   69,
-       69, 1996, 1438, 1429, 1436, 1434, 1439,   69, 1440,   69,
-     1441, 1437, 1442,   69, 1444,   69,   69, 1445, 1443,   69,
-       69, 1448,   69, 1450,   69,   69,   69, 1449,   69,   69,
-       69, 1446,   69, 1452,   69,   69,   69, 1455, 1447,   69,
-     1458,   69,   69,   69,   69, 1454, 1459,   69, 1461, 1460,
-     1451,   69, 1453, 1456,   69, 1457,   69,   69,   69,   69,
-     1471,   69, 1462, 1463,   69,   69, 1464, 1472,   69, 1469,
-       69, 1498,   69,   69, 1465, 1467,   69, 1476, 1466, 1468,
-
-     1470, 1473, 1477,   69, 1474, 1475, 1478,   69, 1479,   69,
-       69, 1481,   69, 1484,   69, 1485,   69, 1486,   69,   69,
-       69, 1482, 1480,   69, 1483, 1488,   69, 1490,   69, 1491,
-       69,   69, 1494,   69,   69,   69, 1493,   69, 1487, 1492,
-       69, 1489, 1496,   69,   69,   69, 1500, 1499, 1502,   69,
-       69, 1506,   69, 1495, 1503, 1497,   69,   69,   69, 1505,
-       69, 1501, 1511,   69, 1510, 1504,   69, 1513,   69,   69,
-       69, 1515,   69, 1509,   69,   69, 1507,   69,   69,   69,
-     1508, 1516, 1518,   69, 1522, 1512, 1517,   69,   69,   69,
-       69, 1520, 1523,   69,   69, 1514, 1528, 1996, 1525, 1526,
-
-     1519,   69,   69, 1524, 1521,   69, 1529, 1527,   69,   69,
-     1532, 1533,   69, 1534, 1530,   69,   69, 1531,   69,   69,
-       69, 1535,   69,   69,   69, 1536, 1541, 1537, 1539, 1542,
-     1538,   69, 1540,   69, 1544, 1545,   69,   69, 1543, 1546,
-       69,   69, 1548,   69,   69, 1547,   69, 1550, 1553, 1549,
-       69, 1552,   69, 1555,   69, 1554,   69,   69,   69,   69,
-       69, 1556, 1551, 1560,   69, 1563, 1557,   69,   69, 1562,
-       69,   69, 1559, 1564, 1567,   69, 1566, 1558,   69,   69,
-     1561,   69, 1571, 1568, 1565,   69,   69, 1569,   69, 1572,
-       69, 1574, 1570, 1575,   69,   69,   69, 1578,   69, 1579,
-
-       69, 1577, 1580,   69, 1581,   69,   69,   69,   69,   69,
-       69,   69,   69, 1576, 1573, 1584, 1587,   69, 1588, 1589,
-       69, 1582,   69, 1586,   69, 1592,   69, 1585, 1583,   69,
-     1590,   69,   69, 1594, 1593, 1591, 1595, 1596, 1597,   69,
-     1598,   69, 1599,   69,   69,   69,   69, 1602,   69,   69,
-       69,   69,   69, 1608,   69,   69, 1600, 1606,   69,   69,
-     1603, 1604, 1605, 1601, 1609,   69,   69,   69,   69, 1615,
-       69, 1607,   69,   69, 1996,   69, 1621,   69, 1612, 1611,
-     1619, 1614, 1616,   69, 1610,   69,   69,   69, 1617,   69,
-     1613, 1620, 1622,   69, 1618,   69, 1623,   69,   69,   69,
-
-       69, 1631,   69, 1624,   69, 1625, 1628, 1626,   69, 1627,
-     1632,   69,   69, 1633,   69, 1635,   69, 1630, 1629,   69,
-     1634,   69, 1641,   69, 1642,   69,   69, 1636,   69,   69,
-       69,   69, 1637,   69, 1638, 1639, 1646,   69,   69,   69,
-     1640, 1644, 1649, 1643,   69,   69, 1650, 1645, 1651,   69,
-     1647,   69, 1654, 1648, 1655,   69,   69, 1652, 1658,   69,
-       69,   69,   69,   69, 1659, 1653, 1656, 1661, 1662,   69,
-     1664,   69,   69,   69, 1657, 1663, 1660, 1666,   69, 1667,
-       69,   69, 1668,   69,   69,   69,   69,   69,   69,   69,
-     1672, 1665, 1673, 1671,   69, 1669, 1670, 1675,   69, 1677,
-
-       69,   69, 1996, 1676,   69, 1674, 1678, 1680,   69, 1681,
-       69, 1682,   69, 1679, 1684,   69,   69, 1683, 1699,   69,
-     1685, 1686,   69, 1687,   69, 1689,   69,   69,   69, 1688,
-       69, 1690,   69, 1691,   69, 1692,   69,   69,   69,   69,
-       69, 1695, 1694, 1697, 1698,   69,   69, 1693,   69, 1696,
-       69, 1700,   69, 1703, 1701, 1702,   69, 1704,   69, 1708,
-       69,   69,   69,   69, 1712,   69,   69,   69,   69, 1705,
-       69, 1710, 1714, 1715,   69, 1716, 1706, 1707, 1711,   69,
-     1709,   69,   69, 1719, 1717, 1713, 1720,   69,   69,   69,
-     1718,   69, 1723, 1724,   69,   69, 1726, 1727,   69,   69,
-
-       69, 1721, 1728, 1722, 1729,   69, 1730,   69,   69, 1725,
-     1731,   69, 1734, 1735,   69,   69, 1737,   69, 1732, 1736,
-     1738,   69, 1733,   69,   69,   69, 1741,   69,   69,   69,
-     1740,   69, 1742, 1745,   69,   69, 1749,   69,   69,   69,
-       69,   69, 1743, 1744,   69, 1753, 1739, 1746, 1751, 1748,
-       69, 1754,   69, 1755, 1747,   69,   69, 1750, 1752,   69,
-       69, 1757,   69,   69, 1763,   69,   69, 1759,   69, 1760,
-       69, 1756,   69, 1764, 1766,   69,   69, 1767,   69, 1758,
-     1769,   69, 1761, 1762, 1765,   69, 1768, 1771, 1773, 1770,
-       69, 1772, 1774,   69,   69,   69,   69,   69,   69, 1781,
-
-       69, 1996,   69, 1775, 1776, 1777, 1778, 1780,   69, 1782,
-       69, 1784,   69, 1783, 1785, 1786,   69,   69, 1789,   69,
-       69, 1787, 1779,   69,   69, 1791, 1793,   69, 1795,   69,
-       69,   69,   69, 1798,   69,   69,   69, 1788,   69,   69,
-     1790,   69, 1792, 1800,   69, 1801,   69, 1797, 1799, 1796,
-       69, 1805, 1794,   69, 1802, 1807,   69,   69, 1804,   69,
-     1803, 1809,   69, 1810,   69, 1811,   69,   69,   69,   69,
-     1806,   69, 1808, 1812, 1813,   69,   69, 1814,   69, 1817,
-     1820,   69, 1815, 1818, 1821,   69, 1816,   69,   69, 1825,
-       69,   69,   69, 1819, 1826, 1822,   69, 1827,   69, 1823,
-
-       69,   69,   69, 1830, 1828, 1833, 1831,   69, 1824,   69,
-       69, 1836,   69, 1837,   69, 1839,   69,   69, 1829,   69,
-       69, 1832, 1840, 1901, 1834, 1835,   69,   69, 1838, 1843,
-       69, 1842, 1846, 1841, 1844,   69, 1845,   69, 1847,   69,
-       69, 1848, 1849,   69,   69,   69,   69, 1853,   69,   69,
-       69,   69, 1856,   69, 1854, 1852,   69,   69, 1850, 1855,
-       69, 1857,   69,   69,   69, 1851,   69, 1860,   69,   69,
-     1858, 1862, 1861,   69,   69,   69,   69, 1859, 1897, 1868,
-     1870,   69, 1863,   69, 1864, 1881, 1865, 1866, 1871,   69,
-     1873,   69,   69,   69, 1867, 1869, 1872, 1874, 1875,   69,
-
-       69, 1876, 1878,   69,   69,   69,   69, 1882, 1883,   69,
-     1884,   69,   69,   69, 1877,   69,   69, 1885, 1996, 1879,
-       69,   69,   69, 1880, 1902, 1889, 1890, 1892,   69,   69,
-     1887, 1893,   69, 1894,   69,   69,   69, 1888, 1886, 1896,
-       69, 1891,   69, 1898, 1895, 1900,   69,   69,   69,   69,
-       69, 1899,   69, 1904,   69,   69,   69, 1908,   69, 1909,
-       69, 1903,   69,   69,   69,   69, 1907,   69, 1905,   69,
-     1906, 1912, 1911,   69, 1996, 1913, 1910, 1920,   69,   69,
-     1916,   69, 1914, 1915, 1918, 1922,   69,   69, 1921, 1923,
-       69,   69, 1917, 1919,   69, 1928, 1924,   69,   69, 1925,
-
-       69,   69, 1927, 1930,   69, 1933, 1926, 1934,   69,   69,
-       69, 1929,   69, 1931,   69,   69,   69,   69,   69,   69,
-     1932,   69, 1935,   69,   69, 1946, 1943, 1936, 1937, 1938,
-     1940, 1941,   69,   69,   69, 1939,   69, 1944, 1942, 1947,
-       69, 1948, 1945, 1951,   69, 1949, 1952,   69,   69,   69,
-       69, 1953, 1950, 1956,   69,   69,   69,   69,   69,   69,
-     1959,   69,   69, 1963,   69,   69,   69,   69, 1954, 1955,
-     1958, 1964, 1968, 1957, 1962, 1960,   69, 1966, 1961,   69,
-     1967,   69,   69, 1965, 1970, 1971,   69,   69, 1969, 1972,
-       69,   69,   69,   69, 1973,   69, 1975,   69, 1977,   69,
-
-     1978,   69, 1981,   69,   69,   69, 1984, 1985,   69, 1974,
-       69, 1976, 1987,   69, 1988,   69, 1979, 1986, 1980,   69,
-       69,   69, 1982, 1983,   69, 1990, 1989,   69, 1996, 1991,
-     1994,   69, 1995,   69, 1996, 1996, 1996, 1996, 1996, 1996,
-     1992, 1996, 1996, 1996, 1996, 1996, 1993,   41,   41,   41,
-       41,   41,   41,   41,   46,   46,   46,   46,   46,   46,
-       46,   51,   51,   51,   51,   51,   51,   51,   57,   57,
-       57,   57,   57,   57,   57,   62,   62,   62,   62,   62,
-       62,   62,   72,   72, 1996,   72,   72,   72,   72,  129,
-      129, 1996, 1996, 1996,  129,  129,  131,  131, 1996, 1996,
-
-      131, 1996,  131,  133, 1996, 1996, 1996, 1996, 1996,  133,
-      136,  136, 1996, 1996, 1996,  136,  136,  138, 1996, 1996,
-     1996, 1996, 1996,  138,  140,  140, 1996,  140,  140,  140,
-      140,   73,   73, 1996,   73,   73,   73,   73,   13, 1996,
-     1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996,
-     1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996,
-     1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996,
-     1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996
+       13,   14,   15,   16,   17,   18,   19,   18,   14,   14,
+       14,   14,   18,   20,   21,   14,   22,   23,   24,   25,
+       14,   26,   27,   28,   29,   30,   31,   32,   33,   34,
+       35,   36,   37,   38,   39,   40,   14,   14,   14,   14,
+       13,   41,   41,   42,   43,   44,   41,   41,   41,   41,
+       41,   41,   41,   45,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       13,   46,   46,   47,   48,   46,   46,   49,   46,   46,
+       46,   46,   46,   50,   46,   46,   46,   46,   46,   46,
+
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       13,   51,   52,   53,   54,   55,   51,   18,   51,   51,
+       51,   51,   51,   56,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       13,   57,   57,   58,   59,   60,   57,   57,   57,   57,
+       57,   57,   57,   61,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+
+       13,   62,   15,   16,   17,   63,   64,   65,   62,   62,
+       62,   62,   62,   66,   62,   62,   62,   62,   62,   62,
+       62,   62,   67,   62,   62,   62,   62,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       13,   68,   99,  100,  101,  111,   68,  117,   68,   68,
+       68,   68,  152,   69,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+       13,  154,   70,   13,   72,   73,   71,   73,   73,   72,
+       73,   72,   72,   72,   72,   73,   74,   72,   72,   72,
+
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   72,   72,   72,   72,   72,   72,   72,
+       72,   72,   72,   13,   75,   75,  155,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   76,   77,   79,   82,   88,   90,  129,
+       83,  156,   80,   84,  130,   85,   86,  159,  160,   81,
+       92,   78,   91,  126,   93,  127,   87,   89,   94,   95,
+      102,  107,   96,  112,  103,  108,  165,  113,  104,   97,
+
+      128,   98,  122,  114,  105,   13,  115,  142,  106,  109,
+      118,  110,  123,  116,  119,  131,  124,  125,  157,  132,
+      161,  163,  164,  133,  120,  166,  162,  121,   13,  134,
+      134,  158,  169,  170,  134,  134,  134,  134,  134,  134,
+      134,  135,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,  134,  134,
+      134,  134,  134,  134,  134,  134,  134,  134,   13,  136,
+      136,  171,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+      136,  136,  136,  136,  136,  136,  136,  136,  136,  136,
+
+      136,  136,  136,  136,  136,  136,  136,  136,   13,  137,
+      137,  172,  173,  137,  137,  174,  137,  137,  137,  137,
+      137,  138,  137,  137,  137,  137,  137,  137,  137,  137,
+      137,  137,  137,  137,  137,  137,  137,  137,  137,  137,
+      137,  137,  137,  137,  137,  137,  137,  137,   13,  139,
+      139,  175,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,  139,  139,
+      139,  139,  139,  139,  139,  139,  139,  139,   13,  140,
+      176,  177,  178,  183,  140,  184,  140,  140,  140,  140,
+
+      140,  141,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,  140,  140,
+      140,  140,  140,  140,  140,  140,  140,  140,   13,  143,
+      143,  189,  143,  143,  143,  143,  143,  143,  143,  143,
+      143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+      143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+      143,  143,  143,  143,  143,  143,  143,  143,   13,  144,
+      144,  190,  191,  192,  144,  144,  144,  144,  144,  144,
+      144,  145,  144,  144,  144,  144,  144,  144,  144,  144,
+      144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+
+      144,  144,  144,  144,  144,  144,  144,  144,   13,  146,
+      146,  193,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+      146,  146,  146,  146,  146,  146,  146,  146,   13,  147,
+      194,  187,  195,  196,  147,  188,  147,  147,  147,  147,
+      147,  148,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+      147,  147,  147,  147,  147,  147,  147,  147,   13,  149,
+       73,  197,   73,   73,  149,   73,  149,  149,  149,  149,
+
+      149,  150,  149,  149,  149,  149,  149,  149,  149,  149,
+      149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+      149,  149,  149,  149,  149,  149,  149,  149,   13,  151,
+      151,  198,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+      151,  151,  151,  151,  151,  151,  151,  151,   13,   73,
+       73,  199,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+       73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+
+       73,   73,   73,   73,   73,   73,   73,   73,   13,  153,
+      153,  200,  153,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+      153,  153,  153,  153,  153,  153,  153,  153,  167,  185,
+      201,  179,  202,  203,  180,  205,  206,  204,  207,  208,
+      209,  212,  213,  210,  214,  215,  168,  181,  182,  186,
+      211,  217,  218,  219,  220,  222,  223,  224,  225,  227,
+      228,  229,  230,  231,  232,  216,  233,  234,  238,  239,
+      240,  248,   13,  226,  226,  221,  226,  226,  226,  226,
+
+      226,  226,  226,  226,  226,  226,  226,  226,  226,  226,
+      226,  226,  226,  226,  226,  226,  226,  226,  226,  226,
+      226,  226,  226,  226,  226,  226,  226,  226,  226,  226,
+      226,  226,  235,  236,  241,  243,  249,  250,  251,  237,
+      244,  252,   68,   68,  254,  245,  255,  256,  257,  258,
+      259,  246,  247,  260,  261,  262,  242,  263,  264,  268,
+      253,  269,  270,  265,  271,  272,  274,  275,  276,  277,
+      278,  279,  280,  281,   68,  266,  273,  267,  283,  284,
+      285,  286,  282,  287,  288,   68,  290,  291,   68,  292,
+      293,  294,  295,  296,  297,  298,  299,  300,  301,  302,
+
+      303,  289,  304,  305,  306,  307,  308,  310,  311,  313,
+      314,  315,  316,  317,  318,  319,  320,   68,  321,  322,
+      323,   68,  325,  326,  327,  312,  328,  329,  330,  309,
+       68,  331,  332,  333,   68,  334,  335,  336,  324,  337,
+      338,  339,  340,  341,  342,  343,  344,  345,  346,  347,
+      348,  349,  350,  351,  352,  353,  354,  355,  356,  357,
+      358,  359,  360,  365,  366,  367,  368,  369,  370,  361,
+      371,  372,  373,  374,  375,  378,  376,  362,  363,  377,
+      364,   68,  379,  380,  381,   68,  382,  383,  384,  385,
+      386,  387,  388,  389,  390,  391,  392,  393,  395,  394,
+
+      396,  399,  400,  397,  401,  398,  402,  404,  405,  406,
+      407,  409,  417,  418,  403,  410,  411,  419,  421,  423,
+       68,  420,  424,  425,   68,  412,  408,  413,  414,  415,
+      422,  427,  416,  428,  429,  430,  431,  432,  433,  434,
+      435,   68,  437,  438,  439,  440,  441,  442,  443,  444,
+      445,   68,  426,   68,  447,  446,   68,  449,  450,  451,
+      453,   68,  436,  454,  455,  456,  457,   68,  459,  460,
+      448,  461,  452,  462,  463,  464,   68,  466,  467,  468,
+      469,  470,  471,   68,  465,  472,  473,  474,  475,  476,
+      479,   68,  480,  458,  481,  482,  483,  484,  485,  486,
+
+      487,  488,  477,  489,  490,  491,  493,  492,  494,  495,
+      496,  497,  478,   68,  498,  499,  500,  502,  503,  501,
+       68,  506,  507,   68,  509,  510,  511,  518,  512,  519,
+      520,  523,  521,  513,  508,  514,  524,  525,   68,  527,
+      528,  504,  522,  515,  529,  530,  516,  505,  531,  532,
+      533,  534,  535,  517,  536,  537,  538,  539,  540,   68,
+      543,  542,  526,  544,   68,  541,   68,  545,  546,  547,
+      548,  549,   68,  550,  551,  552,  554,  556,  553,  557,
+      555,  558,  559,  560,  561,  562,  563,  565,  566,  567,
+      564,  568,  569,  570,  572,  573,  574,  575,  576,   68,
+
+      578,  581,  582,  583,  584,  579,  585,  571,  577,  580,
+      586,  587,  588,  589,  590,  592,  593,  594,  595,   68,
+      597,  598,  599,  600,  601,  602,  603,  604,  605,  606,
+      596,  607,  608,  609,  610,  611,  591,  612,  613,  614,
+      615,  616,  617,  618,  620,  621,  622,  619,  623,  624,
+       68,  626,  628,  630,  631,  634,  625,  633,  632,  627,
+       68,  635,  636,  637,  638,  639,  640,  629,  641,  642,
+      643,  644,  645,  646,  647,  648,  649,  650,   68,  652,
+      653,  654,  655,  656,  657,  651,  658,  659,  660,   68,
+      661,  662,  663,  664,  665,  666,  667,  668,   68,  670,
+
+      672,  673,  674,  675,   68,  677,  678,  671,  679,  680,
+       68,  687,  676,  689,  682,  669,  690,  681,  683,   68,
+       68,  684,  688,  691,  692,  693,  694,  702,  685,  695,
+      696,  686,  697,  703,  704,  698,  705,  706,  707,  708,
+      699,  709,  710,   68,  711,  712,  700,  701,  713,  714,
+      715,  716,  717,  718,   68,  719,  720,  721,  722,  723,
+      724,  725,  726,  727,  728,  729,  730,  731,  732,  733,
+      734,  735,  736,  737,  738,  739,  740,  741,  742,  743,
+      744,  745,  746,  747,  748,  749,  750,  751,  752,  753,
+      754,  755,  756,  757,   68,  759,  760,   68,  764,  762,
+
+      765,  766,  767,   68,  769,  768,  761,  763,  758,  770,
+      771,  772,  773,  774,  775,   68,  776,  777,  778,  779,
+      780,  781,  782,  783,  784,  785,  787,  788,  789,  790,
+      791,  792,  793,  786,  794,  795,  796,   68,  797,  798,
+      799,  800,  801,  802,  803,  804,  805,  811,  806,  812,
+      813,   68,  807,  815,  808,  816,  817,  818,  819,  809,
+      820,  814,  821,  822,  810,  824,  825,  826,  827,  828,
+      829,  830,  831,  823,  832,  837,  838,  839,  840,  833,
+      841,  834,  842,   68,  844,  845,  843,  846,  847,  848,
+      849,  850,  835,  851,  852,  853,  854,  855,  856,  836,
+
+      857,  858,   68,  860,  861,  862,  863,  864,  865,  859,
+      866,  867,  868,  869,  870,  871,  872,  873,  874,  875,
+      878,  879,  880,  876,  881,  882,  883,  884,  885,  886,
+      877,  887,  888,  889,  893,  891,  894,  890,  892,  895,
+      896,  897,  898,  899,  900,  901,  902,   68,  904,  905,
+      906,  907,  908,  909,  910,  911,  912,  913,  914,  915,
+      916,  917,  918,  919,  920,  903,  921,  922,   68,  924,
+      925,  926,  927,  928,  929,  930,  923,  931,  932,  933,
+      934,  935,  936,   68,  938,  939,  940,  941,  942,  937,
+      943,  944,  945,  946,  947,   68,  948,  949,  950,  951,
+
+      952,  953,  954,  955,  956,  957,  958,  959,  960,  961,
+      962,   68,  963,  964,  965,  966,  967,  968,  969,  970,
+      971,  972,  973,  974,  975,  976,   68,  977,  978,   68,
+      980,  979,  981,  982,  983,   68,  984,  985,  986,  987,
+      988,  989,  990,  991,  992,  993,  995,   68,  996,  994,
+      997,   68,  998,  999, 1000, 1001, 1002, 1003, 1004,   68,
+     1007, 1008, 1005, 1009, 1010, 1011, 1012, 1013, 1014, 1015,
+     1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1006,
+     1025, 1026, 1032,   68, 1033, 1035, 1027,   68, 1028, 1036,
+     1029, 1037, 1030, 1031, 1038, 1039, 1034, 1041, 1042, 1040,
+
+     1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052,
+     1053,   68, 1054, 1055, 1056, 1057, 1058, 1059,   68, 1061,
+     1062, 1063, 1064, 1065, 1066, 1067, 1068,   68, 1069, 1070,
+     1071, 1072, 1073, 1074, 1060, 1075, 1076, 1077,   68, 1078,
+     1079, 1080,   68, 1082, 1083, 1081, 1085, 1086, 1087, 1088,
+     1084, 1089, 1090, 1091, 1092,   68, 1093, 1094, 1095, 1096,
+     1097, 1099, 1100, 1101, 1098, 1102, 1103,   68, 1105,   68,
+     1106,   68, 1108, 1109, 1110, 1111, 1104, 1112, 1107, 1113,
+     1114, 1115, 1116, 1117,   68, 1118, 1119, 1120, 1121, 1122,
+     1123, 1124, 1125, 1126, 1127, 1128, 1129,   68, 1131, 1132,
+
+     1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142,
+     1143, 1145, 1130, 1147, 1144, 1146, 1148, 1149, 1150, 1151,
+     1152, 1153, 1154, 1155, 1156, 1157, 1158,   68, 1159, 1160,
+     1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170,
+     1171,   68, 1173, 1172, 1174, 1175, 1176, 1177,   68, 1179,
+     1180, 1181, 1184, 1185, 1186, 1182, 1187, 1178, 1188, 1189,
+     1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1183, 2212,
+     1199, 1200, 1201,   68, 1203, 1204, 1205, 1206, 1207, 1208,
+     1209,   68, 1211, 1202, 1212, 1213, 1198, 1214, 1215, 1216,
+     1217, 1218, 1219,   68, 1220, 1221, 1222, 1223, 1224, 1225,
+
+     1226, 1227, 1210, 1228, 1229, 1230, 1231, 1232,   68, 1234,
+     1235, 1236, 1237, 1240, 1241, 1238,   68, 1242, 1243, 1244,
+       68, 1245, 1246, 1247, 1248, 1249, 1233, 1239, 1250, 1251,
+     1252, 1253, 1254,   68, 1256, 1257, 1258, 1259, 1260, 1261,
+     1262, 1263, 1264, 1265,   68, 1266, 1267, 1268, 1269, 1270,
+       68, 1272, 1273, 1274,   68, 1276, 1277, 1271,   68, 1278,
+     1280, 1255, 1282,   68, 1275, 1281, 1283, 1279, 1284, 1285,
+     1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+     1296, 1297, 1298, 1300, 1301, 1299, 1302, 1303, 1304, 1305,
+     1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315,
+
+     1316, 1317, 1319, 1321, 1322, 1320, 1323, 1324, 1325, 1326,
+     1327, 1328, 1329, 1330, 1331, 1318, 1333, 1334, 1335, 1336,
+     1332, 1337, 1338, 1339, 1340, 1341, 1342, 1343,   68, 1344,
+     1345, 1346, 1347,   68, 1349, 1350, 1351, 1352, 1353, 1354,
+     1355, 1356,   68,   68,   68, 1357, 1358, 1348, 1359, 1360,
+     1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370,
+     1371, 1372, 1374, 1375, 1376, 1377,   68, 1379, 1380, 1381,
+     1382, 1383, 1384, 1385, 1373, 1386, 1387, 1388, 1389, 1390,
+     1391, 1392, 1393,   68, 1395, 2212, 1397, 1396, 1394, 1398,
+     1399, 1400, 1378, 1402, 1403, 1404, 1401, 1405, 1406, 1408,
+
+     1409, 1410, 1407, 2212, 1412, 1413,   68, 1415, 1414, 1416,
+     1417, 1418, 1419, 1420, 2212, 1422, 1423, 1424, 1425, 1426,
+     1427, 1428, 1429, 1430,   68, 1431, 1432, 1433,   68,   68,
+     1411, 1435, 1421, 1436, 1437, 1438, 1439, 1440, 1441, 1442,
+     1443, 1444, 1445, 1434, 1446, 1447, 1448, 1449, 1450, 1451,
+     1452, 1453, 1454, 1455, 1456,   68, 1458, 1457, 1459, 1460,
+     1462, 1463, 1464, 1465, 1461,   68, 1466, 1467, 1468, 1470,
+     1471, 1472, 1469, 1473, 1474, 1475, 1476,   68, 1478, 1479,
+     1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489,
+     1477, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498,
+
+     1499, 1500, 1501, 1502, 1503, 1504, 1506, 1507, 1508, 1509,
+     2212, 1511, 1512, 1513,   68, 1515, 1505,   68, 1516, 1517,
+     1518, 2212, 1520, 1521, 1522, 1523, 1524, 1510, 1525, 1519,
+     1526, 1527, 1528, 1529, 1531, 1532, 1514, 1533, 1534, 1535,
+     1536, 1537, 1538, 1539, 1540, 1541, 1530, 1542, 1543, 1544,
+     1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554,
+     1555, 1556, 1557,   68, 1559, 1560, 1561, 1562, 1563, 1564,
+     1565, 1558, 1566,   68, 1567, 1568, 1569, 1570, 1571, 1572,
+     1574, 1575, 1573, 1576, 1577, 1578, 1579, 1580, 1581, 1582,
+     1583, 1584, 1585, 1586,   68, 1588, 1589, 1590, 1591, 1592,
+
+     1593, 1594, 1595, 1596, 1587, 1598, 1599, 1597, 1600, 1601,
+     1602, 1603, 1604, 1605, 1606,   68, 1607, 1608, 1609, 1610,
+       68, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619,   68,
+     1621, 1622, 1623,   68, 1624, 1625, 1627,   68, 1611, 1626,
+     1628, 1629, 1630, 2212, 1632,   68, 1633, 1631, 1634, 1635,
+     1620, 1636, 1637, 1638, 1639, 1640, 1641, 1643, 1644, 1642,
+     1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653, 1654,
+     1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664,
+     1665, 1666, 1667, 1669, 1670, 1671, 1672, 1673, 1674, 2212,
+     1676, 1677,   68, 1678, 1679, 1680, 1681, 1668, 1682, 1683,
+
+       68, 1685, 1686,   68, 1688, 1689, 1690, 1691, 1684, 1694,
+     1675, 1692, 1695, 1696, 1697, 1698, 1699, 1700, 1701, 1702,
+     1703, 1707, 1705, 1687, 1706, 1693, 1708, 1709, 1704, 1710,
+     1711, 1712, 1713,   68, 1714, 1715, 1716, 1717, 1718, 1719,
+     1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729,
+     1730, 1731, 1732, 1733, 1734,   68, 1736, 1737,   68, 1739,
+     1740, 1741, 1742, 1743, 1744,   68, 1735, 1745, 2212, 1747,
+     1748, 1738, 1749, 1750, 1751, 1752, 1753, 1754, 1755, 1756,
+     1757, 1758,   68, 1760, 1761, 1762, 1763, 1746, 1759, 1764,
+     1765, 1766, 1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774,
+
+     1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
+     1785, 1786, 1787, 1788, 1789, 1790,   68, 1792, 1793, 1794,
+     1795, 1796,   68, 1797, 1798, 1799, 1800, 1791, 1801, 1802,
+     1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812,
+     1813, 1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822,
+     1823,   68, 1824, 1825, 1826, 1827, 1828, 1829, 1830, 1831,
+     1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841,
+     1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850,   68,
+     1851, 1852,   68, 1853, 1854, 1855, 1856, 1857, 1858, 1859,
+     1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869,
+
+     1870,   68, 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878,
+     1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888,
+     1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898,
+     1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908,
+     1909, 1911,   68, 1913, 1910, 1914, 1915, 1916, 1917, 1918,
+     1919, 1920, 1912, 1921, 1922, 1923, 1924, 1925, 1926, 1927,
+     1928, 1929,   68, 1932, 1933, 1930, 1934, 1935, 1936, 1937,
+     1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947,
+       68, 1931,   68, 1949, 1950,   68, 1952, 1953, 1954, 1955,
+     1956, 1951, 1957, 1958, 1959, 1960, 1961, 1948, 1962, 1963,
+
+     1964, 1965, 1966, 1968, 1969, 1967, 1971, 1972, 1970, 1973,
+     1974, 1975,   68, 1977, 1978, 1979, 1980, 1981, 1983, 1984,
+     1982, 1985, 1986,   68, 1988, 1976, 1989, 1990, 1991, 1992,
+     1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002,
+     2003, 2004, 2005, 2006, 2007, 2008, 2212, 2010, 2011, 1987,
+     2012, 2013, 2014, 2015,   68, 2017, 2018,   68, 2016, 2020,
+     2021, 2022, 2023, 2024, 2025, 2026, 2027, 2212, 2029, 2009,
+     2019, 2028, 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037,
+     2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047,
+     2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057,
+
+     2058, 2059, 2060, 2061, 2062, 2063, 2064, 2065, 2066, 2067,
+     2068, 2069,   68, 2071,   68,   68, 2072, 2073, 2075, 2074,
+     2076, 2077, 2070, 2078, 2212, 2080, 2081, 2082, 2083, 2079,
+     2084, 2085, 2086, 2087, 2088, 2089, 2090, 2212, 2092, 2093,
+     2094, 2095, 2096, 2097,   68, 2099, 2100, 2101, 2102, 2103,
+     2104, 2105, 2106, 2091, 2107, 2108, 2109, 2110, 2111, 2112,
+     2113, 2114, 2212, 2116, 2098, 2117, 2115, 2118, 2119, 2120,
+     2121,   68, 2122, 2123, 2124, 2125, 2126, 2127, 2129,   68,
+       68, 2128, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137,
+     2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 2147,
+
+     2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157,
+     2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167,
+     2168, 2212, 2170, 2171, 2172, 2173, 2174, 2175, 2176, 2169,
+     2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186,
+     2187, 2188, 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196,
+     2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206,
+     2207, 2208, 2209, 2210, 2211, 2212, 2212, 2212, 2212, 2212,
+     2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212,
+     2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212,
+     2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212,
+
+     2212, 2212, 2212, 2212, 2212
     } ;
 
-static yyconst flex_int16_t yy_chk[3979] =
+static yyconst flex_int16_t yy_chk[3206] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
-        3,    3,    4,    4,    4,   50,    5,    5,   50,    3,
-        5,   15,    4,    6,    6,   15,    5,    6,    9,    9,
-        9,  161,   33,    6,    7,    7,    7,    7,    9,    7,
-       10,   10,   10,   45,   45,    7,    8,    8,    8,    8,
-       10,    8,   21,   33,  161,   21,   21,    8,   11,   11,
-       11,   11,   11,   11, 2002,   20,   29,   20,   20,   11,
-
-       20,   29,   24,   21,   75,   20,   24,   75,   11,   12,
-       12,   12,   12,   12,   12,   83,   22,   22,   26,   26,
-       12,   25,   25,   28,   22,  132,   24,   26,  132,   12,
-       19,   22,   19,   19,   30,   19,   25,   83,   28,   27,
-       19,   19,   23,   27,   61,   61,   27,   23,   35,   30,
-      103,   23,   67,   27,   23,   27,   23,   23,   31,   31,
-       32,   32,   35,  103,   37,   32,   67,   31,   70,   37,
-       36,   36,   70,   31,   76,   36,   77,   31,   76,   37,
-       39,   32,   34,   37,   37,   36,   78,   34,   36,   78,
-       84,   34,   38,   38,   39,   38,   77,   34,  724,   39,
-
-       34,   92,   78,   40,   40,   79,   92,   34,   40,   84,
-       38,   56,   40,   56,   56,   64,   56,   64,   64,   66,
-       64,   66,   66,   79,   66,   69,   64,   69,   69,   80,
-       69,   82,   87,   88,  138,   69,   72,   86,   72,   72,
-       85,   72,   81,   80,   88,   85,   72,   72,   81,   82,
-       82,   86,   87,   89,   81,   90,   91,   96,   85,   94,
-       91,   93,   94,   95,   97,   94,   99,   98,   95,   97,
-       98,   89,  100,   90,   98,   93,   96,  101,   94,   94,
-      102,  101,  105,  106,  104,  111,  100,  102,  107,   97,
-       99,  104,  108,  109,  113,  105,  108,  112,  112,  110,
-
-      114,  115,  116,  106,  110,  111,  107,  117,  110,  121,
-      118,  109,  119,  114,  113,  118,  115,  120,  120,  122,
-      123,  116,  127,  164,  119,  117,  124,  121,  124,  125,
-      126,  128,  130,  130,  125,  122,  128,  164,  120,  136,
-      127,  123,  126,  134,  142,  134,  134,  142,  134,  124,
-      137,  137,  139,  149,  139,  139,  140,  139,  140,  140,
-      143,  140,  145,  144,  146,  143,  147,  140,  144,  148,
-      150,  152,  146,  149,  135,  151,  152,  145,  158,  150,
-      151,  151,  153,  153,  148,  147,  154,  155,  167,  155,
-      159,  154,  157,  157,  160,  159,  162,  158,  163,  160,
-
-      162,  165,  168,  163,  183,  166,  167,  168,  169,  155,
-      156,  183,  171,  169,  156,  133,  165,  166,  172,  156,
-      166,  170,  170,  173,  156,  174,  174,  170,  173,  178,
-      156,  156,  171,  175,  172,  176,  177,  179,  175,  170,
-      176,  170,  179,  180,  175,  177,  181,  182,  180,  184,
-      178,  181,  182,  185,  186,  187,  188,  189,  190,  185,
-      192,  187,  184,  191,  193,  189,  195,  194,  191,  198,
-      131,  190,  194,  196,  186,  192,  197,  199,  188,  199,
-      200,  197,  202,  203,  193,  201,  208,  200,  195,  198,
-      201,  196,  196,  204,  204,  203,  209,  205,  206,  210,
-
-      219,  202,  205,  206,  207,  211,  207,  212,  209,  208,
-      213,  214,  212,  211,  215,  213,  214,  216,  210,  217,
-      205,  220,  218,  207,  220,  219,  221,  226,  221,  215,
-      218,  222,  222,  217,  223,  216,  227,  223,  224,  224,
-      225,  225,  228,  226,  229,  228,  230,  231,  229,  232,
-      237,  227,  231,  233,  235,  230,  234,  234,  233,  235,
-      236,  238,  239,  232,  240,  236,  241,  241,  242,  243,
-      237,  242,  244,  245,  246,  246,  244,  240,  247,  238,
-      248,  249,  250,  239,  252,  250,  249,  243,  251,  253,
-      254,  245,  248,  252,  255,  261,  247,  256,  253,  260,
-
-      251,  252,  252,  257,  252,  257,  257,  255,  129,  256,
-      261,  254,  258,  258,  259,  262,  260,  259,  263,  260,
-      264,  264,  267,  265,  262,  266,  266,  263,  265,  268,
-      269,  270,  272,  271,  268,  273,  274,  267,  271,  274,
-      273,  274,  269,  275,  276,  277,  280,  282,  278,  281,
-      279,  270,  272,  278,  277,  279,  283,  275,  284,  280,
-      276,  284,  282,  276,  285,  276,  288,  280,  287,  281,
-      283,  290,  292,  328,  328,  288,  293,  284,  285,  286,
-      289,  286,  286,  287,  289,  289,  291,  292,  295,  296,
-      301,  286,  290,  286,  286,  286,  293,  294,  286,  297,
-
-      299,  298,  294,  300,  302,  291,  298,  303,  300,  296,
-      301,  295,  304,  305,  297,  299,  302,  304,  306,  307,
-      307,  303,  307,  306,  308,  309,  310,  330,  312,  305,
-      312,  311,  313,  314,  315,  316,  313,  314,  317,  318,
-      330,  309,  310,  323,  308,  311,  319,  317,  318,  316,
-      320,  319,  315,  321,  320,  325,  322,  324,  327,  325,
-      317,  322,  321,  324,  323,  326,  329,  331,  331,  332,
-      326,  329,  333,  334,  332,  335,  333,  336,  327,  337,
-      335,  338,  339,  339,  340,  338,  336,  341,  345,  340,
-      346,  337,  342,  342,  334,  344,  344,  347,  346,  348,
-
-      349,  352,  351,  353,  355,  354,  347,  357,  341,  345,
-      354,  356,  349,  355,  360,  357,  356,  353,  358,  348,
-      351,  352,  351,  358,  359,  361,  362,  363,  364,  359,
-      362,  366,  365,  364,  368,  371,  360,  369,  372,  370,
-      371,  372,  363,  373,  375,  371,  361,  359,  365,  381,
-      366,  367,  367,  377,  368,  370,  369,  367,  379,  367,
-      374,  374,  378,  373,  376,  376,  380,  367,  377,  375,
-      367,  381,  383,  379,  378,  382,  384,  367,  385,  388,
-      382,  383,  386,  388,  389,  380,  390,  391,  386,  389,
-      392,  393,  395,  385,  399,  384,  394,  394,  390,  393,
-
-      397,  396,  402,  392,  395,  391,  396,  398,  400,  399,
-      398,  401,  397,  400,  401,  403,  404,  411,  402,  403,
-      403,  402,  405,  405,  406,  406,  407,  408,  408,  404,
-      410,  407,  409,  409,  412,  410,  413,  414,  411,  412,
-      415,  414,  416,  417,  418,  415,  416,  419,  417,  420,
-      422,  421,  419,  422,  420,  413,  423,  425,  422,  424,
-      424,  426,  422,  427,  418,  421,  426,  428,  427,  430,
-      431,  429,  433,  431,  423,  425,  429,  433,  430,  432,
-      434,  428,  435,  432,  436,  434,  437,  438,  439,  440,
-      441,  437,  442,  445,  440,  442,  441,  436,  435,  443,
-
-      439,  444,  443,  438,  446,  432,  444,  447,  448,  449,
-      451,  445,  447,  448,  449,  451,  450,  452,  446,  450,
-      453,  452,  452,  454,  455,  456,  458,  457,  461,  455,
-      457,  458,  463,  453,  456,  459,  454,  464,  465,  459,
-      459,  460,  462,  460,  462,  457,  466,  461,  467,  468,
-      463,  470,  467,  469,  471,  464,  472,  465,  468,  473,
-      474,  475,  476,  476,  473,  478,  466,  479,  469,  470,
-      477,  472,  479,  471,  477,  480,  478,  481,  483,  474,
-      475,  482,  484,  485,  486,  483,  488,  484,  487,  486,
-      485,  480,  489,  487,  482,  491,  481,  490,  492,  489,
-
-      493,  496,  504,  508,  488,  493,  490,  492,  494,  491,
-      495,  494,  497,  497,  495,  498,  501,  507,  500,  503,
-      504,  497,  496,  500,  498,  502,  506,  505,  508,  502,
-      511,  503,  505,  514,  506,  507,  501,  509,  517,  519,
-      520,  520,  509,  519,   68,  511,  509,  517,  518,  509,
-      514,  524,  521,  523,  518,  525,  509,  521,  523,  509,
-      522,  522,  522,  526,  522,  536,  526,  522,  528,  524,
-      527,  527,  522,  529,  529,  528,  530,  536,  522,  522,
-      525,  531,  531,  532,  533,  534,  537,  533,  532,  538,
-      534,  530,  535,  539,  535,  540,  541,  541,  542,  544,
-
-      543,  546,   62,  540,  545,  537,  546,  547,  547,  538,
-      548,  557,  539,  542,  543,  548,  545,  544,  549,  550,
-      551,  552,  550,  549,  553,  554,  551,  556,  555,  552,
-      557,  559,  553,  555,  556,  558,  558,  560,  562,  561,
-      559,  564,  565,  554,  561,  560,  566,  567,  569,  566,
-      564,  565,  568,  568,  570,  571,  573,  562,  571,  574,
-      575,  567,  576,  569,  574,  577,  571,  579,  578,  580,
-      583,  581,  582,  580,  584,  588,  579,  573,  570,  583,
-      585,  575,  576,  589,  586,  596,  584,  577,  578,  581,
-      586,  582,  587,  587,  585,  588,  590,  589,  591,  593,
-
-      592,  590,  594,  591,  592,  595,  596,  597,  597,  599,
-      595,  598,  599,  600,  594,  601,  598,  603,  593,  602,
-      604,  604,  594,  605,  602,  606,  606,  607,  601,  608,
-      609,  600,  610,  608,  611,  612,  615,  603,  614,  614,
-      615,  605,  607,  616,  617,  640,  618,  621,  611,  609,
-      618,  622,  619,  640,  620,  612,  610,  613,  616,  620,
-      613,  621,  613,  628,  624,  622,  613,  619,  613,  617,
-      623,  625,  626,  613,  623,  627,  625,  626,  613,  624,
-      629,  630,   57,  631,  628,  634,  625,  630,  631,  627,
-      632,  632,  636,  635,  629,  633,  633,  634,  635,  637,
-
-      642,  633,  639,  633,  638,  638,  636,  639,  641,  643,
-      643,  637,  644,  646,  633,  648,  644,  647,  646,  642,
-      647,  633,  641,  649,  650,  651,  652,  655,  653,  650,
-      651,  654,  656,  657,  648,  659,  649,  653,  661,  658,
-      654,  656,  660,  655,  658,  652,  664,  666,  662,  667,
-      663,  664,  657,  668,  672,  659,  660,  662,  661,  663,
-      669,  673,  673,  672,  670,  669,  666,  667,  668,  670,
-      671,  674,  675,  677,  678,  671,  674,  681,  678,  678,
-      679,  679,  682,  680,  679,  675,  680,  684,  683,  677,
-      685,  681,  686,  685,  687,  688,  689,  694,  690,  691,
-
-      688,  689,  682,  683,  690,  692,  694,  684,  693,  693,
-      687,  692,  695,  686,  696,  691,  697,  696,  698,  699,
-      700,  701,  702,  703,  705,  707,  701,  702,  703,  706,
-      695,  708,  706,  700,  697,  709,  707,  698,  711,  699,
-      709,  710,  705,  708,  712,  714,  710,  713,  713,  712,
-      716,  715,  717,  711,  718,  720,  717,  719,  721,  723,
-      727,  725,  716,  728,  714,  715,  719,  726,  728,   52,
-      736,  729,  718,  732,  720,  725,  729,  733,  723,  730,
-      727,  731,  726,  721,  730,  734,  731,  732,  735,  736,
-      734,  733,  737,  738,  739,  740,  740,  741,  742,  737,
-
-      743,  744,  746,  735,  745,  745,  743,  746,  738,  748,
-      747,  741,  749,  739,  750,  749,  742,  747,  751,  752,
-      753,  744,  755,  748,  752,  754,  758,  751,  759,  757,
-      754,  760,  750,  757,  761,  758,  763,  762,  764,  753,
-      765,  755,  766,  759,  762,  767,  769,  768,  763,  761,
-      760,  767,  775,  772,  770,  773,  774,  764,  772,  777,
-      766,  765,  768,  770,  774,  776,  769,  779,  780,  773,
-      776,  777,  775,  778,  781,  782,  782,  778,  778,  783,
-      784,  993,  780,  785,  786,  786,  779,  781,  785,  784,
-      787,  788,  783,  789,  790,  787,  791,  791,  789,  790,
-
-      788,  792,  793,  794,  795,  993,  796,  793,  797,  798,
-      792,  796,  799,  797,  798,  806,  799,  794,  801,  801,
-      803,  805,  795,  800,  802,  805,  802,  807,  812,  808,
-      806,  803,  800,  811,  810,  813,  812,  800,  808,  800,
-      815,  800,  809,  800,  814,  807,  809,  809,  810,  813,
-      816,  818,  811,  814,  817,  817,  819,  819,  815,  821,
-      822,  823,  821,  824,  824,  822,  818,  825,  826,  826,
-      828,  827,  829,  829,  830,  816,  827,  831,  832,  833,
-      823,  835,  831,   51,  833,  837,  832,  825,  834,  834,
-      836,  828,  837,  838,  830,  840,  836,  841,  842,  835,
-
-      840,  844,  841,  842,  843,  845,  838,  846,  848,  843,
-      844,  847,  847,  849,  850,  851,  852,  854,  846,  853,
-      851,  857,  855,  858,  845,  856,  856,  859,  848,  854,
-      852,  861,  861,  849,  862,  865,  852,  850,  860,  853,
-      855,  857,  863,  860,  867,  859,  866,  863,  858,  870,
-      866,  866,  868,  867,  865,  873,  869,  862,  869,  871,
-      868,  872,  874,  870,  871,  872,  873,  875,  876,  877,
-      878,  879,  880,  882,  877,  883,  880,  881,  899,  899,
-      884,  874,  885,  886,  887,  888,  876,  883,  878,  889,
-      888,  879,  882,  875,  884,  881,  889,  885,  886,  890,
-
-      891,  892,  893,  887,  890,  894,  895,  896,  897,  898,
-      892,  894,  896,  897,  898,  900,  900,  893,  891,  902,
-      902,  903,  904,  905,  906,  903,  907,  895,  908,  906,
-      909,  904,  910,  911,  909,  909,  910,  910,  912,  913,
-      907,  905,  914,  915,  916,  917,  919,  908,  920,  918,
-      923,  917,  921,  911,  918,  922,  924,  912,  913,  927,
-      925,  914,  927,  916,  923,  919,  928,  920,   46,  915,
-      932,  921,  926,  926,  922,  925,  930,  924,  928,  929,
-      929,  930,  931,  932,  933,  934,  931,  941,  935,  937,
-      935,  938,  938,  933,  935,  939,  942,  940,  934,  943,
-
-      939,  940,  945,  947,  943,  941,  954,  935,  947,  937,
-      948,  948,  949,  951,  951,  958,  942,  949,  953,  953,
-      945,  956,  954,  959,  956,  957,  957,  960,  961,  962,
-      958,  963,  963,  961,  964,  965,  966,  966,  964,  967,
-      968,  960,  969,  970,  962,  971,  969,  974,  959,  975,
-      971,  968,  973,  973,  977,  965,  976,  976,  978,  977,
-      979,  967,  970,  975,  980,  974,  981,  982,  985,  982,
-      983,  984,  986,  980,  996,  983,  984,  986,  978,  988,
-      979,  989,  989,  990,  991,  995,  981, 1000,  985, 1002,
-      991,  994,  994,  988,  996,  997, 1000,  995,  997,  998,
-
-      999,  997,  990, 1001,  998,  999, 1003, 1004, 1001, 1003,
-     1005, 1005, 1004,  997, 1002, 1006, 1007, 1008, 1009, 1010,
-     1011, 1012, 1013, 1009, 1010, 1011, 1015, 1013, 1014, 1014,
-     1016, 1015, 1017, 1006, 1018, 1007, 1019, 1008, 1022, 1020,
-     1021, 1023, 1024, 1022, 1012, 1025, 1026,   41, 1016, 1029,
-     1019, 1020, 1017, 1021, 1018, 1028, 1028, 1031, 1030, 1025,
-     1034, 1023, 1024, 1030, 1032, 1033, 1036, 1026, 1038, 1029,
-     1041, 1032, 1031, 1041, 1033, 1042, 1034, 1033, 1039, 1039,
-     1042, 1036, 1040, 1040, 1043, 1044, 1036, 1045, 1047, 1046,
-     1048, 1049, 1049, 1038, 1044, 1048, 1050, 1047, 1046, 1051,
-
-     1043, 1046, 1052, 1053, 1057, 1054, 1045, 1055, 1058, 1059,
-     1059, 1060, 1051, 1061, 1065, 1068, 1050, 1053, 1062, 1055,
-     1052, 1054, 1061, 1062, 1063, 1063, 1058, 1060, 1064, 1057,
-     1067, 1069, 1065, 1068, 1072, 1067, 1069, 1064, 1070, 1063,
-     1064, 1071, 1074, 1070, 1073, 1078, 1080, 1071, 1075, 1073,
-     1079, 1075, 1081, 1082, 1072, 1074, 1083, 1075, 1079, 1080,
-     1084, 1083, 1085, 1088, 1078, 1087, 1087, 1089, 1090, 1091,
-     1081, 1089, 1082, 1090, 1091, 1093, 1084, 1092, 1094, 1096,
-     1085, 1098, 1092, 1088, 1093, 1097, 1097, 1100, 1101, 1099,
-     1102, 1104, 1103, 1105, 1096, 1098, 1099, 1103, 1106, 1100,
-
-     1101, 1094,   14, 1104, 1106, 1107, 1107, 1108, 1112, 1102,
-     1108, 1105, 1109, 1109, 1111, 1113, 1113, 1112, 1114, 1111,
-     1115, 1117, 1116, 1118, 1119, 1115, 1120, 1121, 1122, 1119,
-     1114, 1116, 1125, 1117, 1124, 1120, 1123, 1123, 1118, 1124,
-     1126, 1127, 1129, 1122, 1128, 1128, 1131, 1121, 1120, 1130,
-     1130, 1132, 1132, 1125, 1133, 1134, 1138, 1140, 1133, 1126,
-     1134, 1127, 1129, 1135, 1137, 1139, 1135, 1131, 1143, 1137,
-     1139, 1141, 1141, 1143, 1138, 1142, 1142, 1144, 1145, 1146,
-     1147, 1148, 1140, 1150, 1152, 1147, 1151, 1150, 1150, 1144,
-     1144, 1144, 1153, 1153, 1154, 1156, 1144, 1157, 1145, 1146,
-
-     1151, 1148, 1155, 1155, 1162, 1152, 1158, 1158, 1159, 1159,
-     1163, 1163, 1164, 1162, 1165, 1156, 1166, 1167, 1169, 1157,
-     1154, 1165, 1168, 1168, 1170, 1166, 1172, 1164, 1173, 1174,
-     1175, 1172, 1181, 1173, 1176, 1182, 1177, 1175, 1183, 1176,
-     1170, 1177, 1179, 1167, 1169, 1178, 1178, 1179, 1180, 1174,
-     1183, 1185, 1181, 1184, 1182, 1186, 1184, 1180, 1187, 1187,
-     1188, 1189, 1190, 1191, 1192, 1193, 1197, 1191, 1195, 1185,
-     1192, 1194, 1194, 1199, 1193, 1188, 1198, 1190, 1204, 1195,
-     1189, 1186, 1196, 1196, 1195, 1211, 1200, 1197, 1201, 1201,
-     1198, 1200, 1202, 1199, 1203, 1205, 1202, 1202, 1206, 1203,
-
-     1208, 1209, 1210, 1206, 1204, 1209, 1212, 1205, 1213, 1215,
-     1211, 1212, 1208, 1214, 1210, 1221, 1217,   13, 1214, 1217,
-     1225, 1215, 1218, 1218, 1219, 1219, 1220, 1220, 1222, 1225,
-     1213, 1223, 1224, 1230, 1222, 1221, 1223, 1227, 1224, 1232,
-     1229, 1234, 1227, 1229, 1235, 1230, 1233, 1233, 1236, 1237,
-     1238, 1232, 1239, 1235, 1238, 1240, 1241, 1239, 1244, 1250,
-     1240, 1234, 1243, 1243, 1245, 1252, 1236, 1253, 1237, 1246,
-     1241, 1248, 1248, 1245, 1243, 1250, 1244, 1254, 1246, 1255,
-     1252, 1253, 1254, 1256, 1256, 1257, 1260, 1257, 1258, 1258,
-     1261, 1262, 1262, 1260, 1263, 1264, 1255, 1265, 1268, 1266,
-
-     1267, 1270, 1269, 1263, 1277, 1272, 1273, 1270, 1275, 1265,
-     1261, 1266, 1267, 1275, 1285, 1283, 1264, 1269, 1278, 1276,
-     1270, 1276, 1277, 1278, 1268, 1272, 1273, 1279, 1281, 1283,
-     1284, 1284, 1290, 1286, 1279, 1291,    0, 1281, 1286, 1287,
-     1285, 1287, 1288, 1289, 1292, 1294, 1293, 1288, 1289, 1292,
-     1290, 1293, 1295, 1297, 1298, 1291, 1299, 1299, 1294, 1301,
-     1295, 1300, 1300, 1302, 1303, 1304, 1306, 1307, 1298, 1303,
-     1304, 1305, 1297, 1305, 1301, 1308, 1307, 1308, 1306, 1307,
-     1309, 1309, 1310, 1302, 1311, 1313, 1316, 1314, 1317, 1318,
-     1313, 1310, 1314, 1319, 1321, 1323, 1311, 1324, 1325, 1316,
-
-     1321, 1323, 1326, 1327, 1327, 1328, 1330, 1318, 1317, 1319,
-     1336, 1326, 1324, 1331, 1328, 1329, 1329, 1331, 1333, 1332,
-     1335,    0, 1334, 1325, 1332, 1330, 1334, 1334, 1335, 1340,
-     1336, 1333, 1339, 1339, 1341, 1341, 1342, 1342, 1340, 1343,
-     1344, 1345, 1346, 1347, 1347, 1349, 1345, 1346, 1350, 1351,
-     1352, 1343, 1353, 1350, 1358, 1354, 1360, 1353, 1344, 1355,
-     1356, 1356, 1357, 1359, 1361, 1352, 1357, 1363, 1359, 1358,
-     1349, 1364, 1351, 1354, 1365, 1355, 1366, 1368, 1367, 1369,
-     1371, 1371, 1360, 1361, 1372, 1398, 1363, 1372, 1373, 1368,
-     1374, 1398, 1375, 1379, 1364, 1366, 1376, 1376, 1365, 1367,
-
-     1369, 1373, 1377, 1377, 1374, 1375, 1378, 1378, 1379, 1380,
-     1381, 1381, 1382, 1383, 1383, 1384, 1384, 1385, 1385, 1386,
-     1391, 1382, 1380, 1388, 1382, 1387, 1387, 1389, 1389, 1390,
-     1390, 1393, 1394, 1394, 1395, 1402, 1393, 1397, 1386, 1391,
-     1404, 1388, 1396, 1396, 1399, 1400, 1400, 1399, 1401, 1401,
-     1403, 1405, 1405, 1395, 1402, 1397, 1407, 1408, 1409, 1404,
-     1410, 1400, 1411, 1411, 1410, 1403, 1412, 1413, 1413, 1414,
-     1415, 1415, 1416, 1409, 1418, 1420, 1407, 1419, 1421, 1423,
-     1408, 1416, 1419, 1422, 1423, 1412, 1418, 1424, 1425, 1426,
-     1427, 1421, 1424, 1428, 1432, 1414, 1429,    0, 1426, 1427,
-
-     1420, 1429, 1430, 1425, 1422, 1438, 1430, 1428, 1434, 1435,
-     1435, 1436, 1437, 1437, 1432, 1440, 1436, 1434, 1447, 1441,
-     1443, 1437, 1448, 1445, 1446, 1438, 1445, 1438, 1441, 1446,
-     1440, 1452, 1443, 1455, 1448, 1449, 1449, 1454, 1447, 1451,
-     1451, 1453, 1453, 1456, 1459, 1452, 1463, 1455, 1459, 1454,
-     1457, 1457, 1460, 1461, 1461, 1460, 1462, 1464, 1465, 1466,
-     1467, 1462, 1456, 1466, 1468, 1469, 1463, 1470, 1472, 1468,
-     1469, 1473, 1465, 1470, 1474, 1475, 1473, 1464, 1479, 1474,
-     1467, 1480, 1480, 1475, 1472, 1476, 1481, 1476, 1482, 1481,
-     1483, 1483, 1479, 1487, 1487, 1489, 1492, 1493, 1493, 1495,
-
-     1495, 1492, 1497, 1498, 1498, 1499, 1500, 1497, 1503, 1507,
-     1501, 1504, 1509, 1489, 1482, 1501, 1505, 1505, 1507, 1508,
-     1510, 1499, 1516, 1504, 1508, 1512, 1512, 1503, 1500, 1514,
-     1509, 1515, 1517, 1515, 1514, 1510, 1516, 1517, 1518, 1518,
-     1519, 1519, 1520, 1520, 1521, 1522, 1523, 1523, 1524, 1525,
-     1526, 1528, 1527, 1529, 1529, 1530, 1521, 1527, 1531, 1532,
-     1524, 1525, 1526, 1522, 1530, 1533, 1534, 1535, 1536, 1536,
-     1538, 1528, 1539, 1537,    0, 1540, 1542, 1542, 1533, 1532,
-     1540, 1535, 1537, 1547, 1531, 1549, 1541, 1548, 1538, 1550,
-     1534, 1541, 1543, 1543, 1539, 1544, 1544, 1551, 1552, 1553,
-
-     1554, 1554, 1558, 1547, 1557, 1548, 1551, 1549, 1559, 1550,
-     1556, 1556, 1560, 1557, 1561, 1559, 1562, 1553, 1552, 1563,
-     1558, 1564, 1565, 1565, 1566, 1567, 1568, 1560, 1569, 1566,
-     1571, 1570, 1561, 1572, 1562, 1563, 1570, 1573, 1577, 1576,
-     1564, 1568, 1573, 1567, 1574, 1580, 1574, 1569, 1576, 1581,
-     1571, 1583, 1581, 1572, 1582, 1582, 1584, 1577, 1585, 1585,
-     1586, 1588, 1591, 1589, 1586, 1580, 1583, 1589, 1590, 1590,
-     1593, 1593, 1594, 1601, 1584, 1591, 1588, 1595, 1595, 1596,
-     1596, 1600, 1600, 1602, 1603, 1604, 1606, 1605, 1609, 1607,
-     1604, 1594, 1605, 1603, 1610, 1601, 1602, 1607, 1612, 1610,
-
-     1635, 1611,    0, 1609, 1615, 1606, 1611, 1613, 1613, 1614,
-     1614, 1615, 1616, 1612, 1617, 1618, 1623, 1616, 1635, 1617,
-     1618, 1619, 1619, 1620, 1620, 1624, 1627, 1625, 1626, 1623,
-     1624, 1625, 1628, 1626, 1629, 1627, 1630, 1631, 1636, 1634,
-     1633, 1630, 1629, 1633, 1634, 1637, 1638, 1628, 1640, 1631,
-     1642, 1636, 1639, 1639, 1637, 1638, 1643, 1640, 1644, 1645,
-     1645, 1646, 1647, 1648, 1649, 1649, 1650, 1653, 1651, 1642,
-     1657, 1647, 1651, 1652, 1652, 1653, 1643, 1644, 1648, 1654,
-     1646, 1656, 1659, 1657, 1654, 1650, 1659, 1660, 1661, 1668,
-     1656, 1663, 1663, 1665, 1665, 1669, 1669, 1670, 1670, 1671,
-
-     1675, 1660, 1671, 1661, 1672, 1672, 1673, 1673, 1676, 1668,
-     1674, 1674, 1677, 1678, 1678, 1679, 1682, 1677, 1675, 1679,
-     1682, 1682, 1676, 1683, 1684, 1689, 1685, 1688, 1690, 1691,
-     1684, 1685, 1688, 1690, 1692, 1693, 1694, 1694, 1695, 1697,
-     1696, 1704, 1689, 1689, 1698, 1698, 1683, 1691, 1696, 1693,
-     1699, 1699, 1700, 1700, 1692, 1701, 1702, 1695, 1697, 1703,
-     1705, 1702, 1706, 1707, 1709, 1709, 1711, 1704, 1716, 1705,
-     1710, 1701, 1714, 1710, 1713, 1713, 1720, 1714, 1719, 1703,
-     1717, 1717, 1706, 1707, 1711, 1718, 1716, 1719, 1721, 1718,
-     1722, 1720, 1721, 1721, 1726, 1723, 1725, 1728, 1733, 1733,
-
-     1734,    0, 1732, 1722, 1723, 1725, 1726, 1732, 1736, 1734,
-     1737, 1737, 1740, 1736, 1737, 1739, 1739, 1741, 1742, 1743,
-     1744, 1740, 1728, 1742, 1745, 1744, 1746, 1747, 1748, 1748,
-     1750, 1746, 1751, 1752, 1752, 1753, 1755, 1741, 1756, 1754,
-     1743, 1757, 1745, 1754, 1760, 1755, 1759, 1751, 1753, 1750,
-     1758, 1759, 1747, 1762, 1756, 1761, 1761, 1771, 1758, 1772,
-     1757, 1764, 1764, 1765, 1765, 1767, 1767, 1773, 1768, 1776,
-     1760, 1777, 1762, 1768, 1770, 1770, 1780, 1771, 1775, 1775,
-     1778, 1778, 1772, 1776, 1779, 1779, 1773, 1781, 1782, 1783,
-     1783, 1784, 1787, 1777, 1784, 1780, 1785, 1785, 1788, 1781,
-
-     1789, 1790, 1791, 1789, 1787, 1792, 1790, 1793, 1782, 1797,
-     1792, 1794, 1794, 1796, 1796, 1799, 1799, 1800, 1788, 1801,
-     1885, 1791, 1800, 1885, 1793, 1793, 1802, 1806, 1797, 1803,
-     1803, 1802, 1806, 1801, 1804, 1804, 1805, 1805, 1808, 1808,
-     1812, 1812, 1814, 1814, 1815, 1816, 1817, 1818, 1818, 1819,
-     1826, 1822, 1823, 1823, 1819, 1817, 1824, 1827, 1815, 1822,
-     1829, 1824, 1828, 1830, 1831, 1816, 1879, 1828, 1832, 1833,
-     1826, 1830, 1829, 1834, 1835, 1838, 1858, 1827, 1879, 1835,
-     1840, 1840, 1831, 1851, 1832, 1858, 1833, 1833, 1841, 1841,
-     1846, 1846, 1842, 1848, 1834, 1838, 1842, 1848, 1850, 1850,
-
-     1852, 1851, 1854, 1854, 1855, 1857, 1859, 1859, 1860, 1860,
-     1861, 1861, 1862, 1863, 1852, 1864, 1865, 1862,    0, 1855,
-     1866, 1867, 1868, 1857, 1886, 1866, 1867, 1869, 1869, 1886,
-     1864, 1872, 1872, 1874, 1874, 1876, 1881, 1865, 1863, 1877,
-     1877, 1868, 1880, 1880, 1876, 1882, 1882, 1887, 1888, 1889,
-     1891, 1881, 1890, 1888, 1895, 1897, 1898, 1895, 1899, 1897,
-     1901, 1887, 1902, 1903, 1905, 1904, 1891, 1906, 1889, 1907,
-     1890, 1901, 1899, 1908,    0, 1902, 1898, 1909, 1909, 1910,
-     1905, 1915, 1903, 1904, 1907, 1911, 1911, 1916, 1910, 1912,
-     1912, 1913, 1906, 1908, 1914, 1917, 1913, 1918, 1921, 1914,
-
-     1917, 1924, 1916, 1919, 1919, 1925, 1915, 1926, 1927, 1929,
-     1925, 1918, 1926, 1921, 1928, 1931, 1932, 1933, 1934, 1935,
-     1924, 1936, 1927, 1938, 1939, 1939, 1936, 1928, 1929, 1931,
-     1933, 1934, 1937, 1943, 1940, 1932, 1941, 1937, 1935, 1940,
-     1942, 1941, 1938, 1944, 1946, 1942, 1945, 1945, 1944, 1947,
-     1948, 1946, 1943, 1949, 1950, 1953, 1954, 1951, 1949, 1955,
-     1953, 1956, 1957, 1957, 1959, 1964, 1958, 1962, 1947, 1948,
-     1951, 1958, 1962, 1950, 1956, 1954, 1960, 1960, 1955, 1961,
-     1961, 1963, 1966, 1959, 1964, 1965, 1965, 1967, 1963, 1966,
-     1968, 1969, 1970, 1972, 1967, 1973, 1969, 1974, 1972, 1975,
-
-     1973, 1976, 1976, 1977, 1978, 1979, 1979, 1980, 1980, 1968,
-     1981, 1970, 1982, 1982, 1983, 1983, 1974, 1981, 1975, 1984,
-     1986, 1990, 1977, 1978, 1989, 1986, 1984, 1991,    0, 1989,
-     1992, 1992, 1993, 1993,    0,    0,    0,    0,    0,    0,
-     1990,    0,    0,    0,    0,    0, 1991, 1997, 1997, 1997,
-     1997, 1997, 1997, 1997, 1998, 1998, 1998, 1998, 1998, 1998,
-     1998, 1999, 1999, 1999, 1999, 1999, 1999, 1999, 2000, 2000,
-     2000, 2000, 2000, 2000, 2000, 2001, 2001, 2001, 2001, 2001,
-     2001, 2001, 2003, 2003,    0, 2003, 2003, 2003, 2003, 2004,
-     2004,    0,    0,    0, 2004, 2004, 2005, 2005,    0,    0,
-
-     2005,    0, 2005, 2006,    0,    0,    0,    0,    0, 2006,
-     2007, 2007,    0,    0,    0, 2007, 2007, 2008,    0,    0,
-        0,    0,    0, 2008, 2009, 2009,    0, 2009, 2009, 2009,
-     2009, 2010, 2010,    0, 2010, 2010, 2010, 2010, 1996, 1996,
-     1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996,
-     1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996,
-     1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996,
-     1996, 1996, 1996, 1996, 1996, 1996, 1996, 1996
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+       14,   14,   28,   29,   30,   33,   14,   35,   14,   14,
+       14,   14,   67,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       15,   76,   15,   19,   19,   19,   15,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+       19,   19,   19,   20,   20,   20,   77,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+       20,   20,   20,   21,   21,   22,   23,   24,   25,   39,
+       23,   78,   22,   23,   39,   23,   23,   80,   81,   22,
+       26,   21,   25,   38,   26,   38,   23,   24,   26,   27,
+       31,   32,   27,   34,   31,   32,   84,   34,   31,   27,
+
+       38,   27,   37,   34,   31,   52,   34,   52,   31,   32,
+       36,   32,   37,   34,   36,   40,   37,   37,   79,   40,
+       82,   83,   83,   40,   36,   85,   82,   36,   41,   41,
+       41,   79,   87,   88,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   41,   41,
+       41,   41,   41,   41,   41,   41,   41,   41,   45,   45,
+       45,   89,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   46,   46,
+       46,   90,   91,   46,   46,   92,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   46,   46,
+       46,   46,   46,   46,   46,   46,   46,   46,   50,   50,
+       50,   93,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   51,   51,
+       94,   95,   96,   98,   51,   99,   51,   51,   51,   51,
+
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   56,   56,
+       56,  102,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   56,   56,
+       56,   56,   56,   56,   56,   56,   56,   56,   57,   57,
+       57,  103,  103,  104,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+       57,   57,   57,   57,   57,   57,   57,   57,   57,   57,
+
+       57,   57,   57,   57,   57,   57,   57,   57,   61,   61,
+       61,  105,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   61,   61,
+       61,   61,   61,   61,   61,   61,   61,   61,   62,   62,
+      106,  101,  107,  108,   62,  101,   62,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   62,   62,   64,   64,
+       64,  109,   64,   64,   64,   64,   64,   64,   64,   64,
+
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   66,   66,
+       66,  110,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   71,   71,
+       71,  111,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+
+       71,   71,   71,   71,   71,   71,   71,   71,   74,   74,
+       74,  112,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+       74,   74,   74,   74,   74,   74,   74,   74,   86,  100,
+      113,   97,  114,  115,   97,  116,  117,  115,  118,  119,
+      120,  122,  123,  121,  124,  125,   86,   97,   97,  100,
+      121,  126,  127,  128,  129,  130,  131,  132,  133,  152,
+      154,  155,  156,  157,  158,  125,  159,  160,  163,  164,
+      165,  168,  150,  150,  150,  129,  150,  150,  150,  150,
+
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  150,  150,  150,  150,  150,  150,  150,  150,
+      150,  150,  161,  162,  166,  167,  169,  170,  171,  162,
+      167,  172,  173,  161,  174,  167,  175,  176,  177,  178,
+      179,  167,  167,  179,  180,  181,  166,  182,  183,  184,
+      173,  185,  186,  183,  187,  188,  189,  190,  191,  192,
+      193,  194,  195,  196,  197,  183,  188,  183,  198,  199,
+      200,  201,  197,  202,  203,  204,  205,  206,  201,  207,
+      208,  209,  210,  211,  212,  213,  213,  214,  215,  216,
+
+      217,  204,  218,  219,  220,  221,  222,  223,  224,  225,
+      227,  228,  229,  230,  231,  232,  233,  216,  234,  235,
+      236,  237,  238,  239,  240,  224,  241,  242,  243,  222,
+      241,  244,  245,  246,  247,  247,  248,  249,  237,  250,
+      251,  252,  253,  254,  255,  256,  257,  258,  259,  260,
+      261,  262,  263,  264,  265,  266,  267,  268,  269,  270,
+      271,  272,  272,  273,  274,  275,  276,  277,  278,  272,
+      279,  279,  280,  281,  282,  284,  283,  272,  272,  283,
+      272,  282,  285,  286,  287,  280,  288,  289,  290,  291,
+      292,  293,  294,  295,  295,  296,  297,  298,  299,  298,
+
+      300,  301,  302,  300,  303,  300,  304,  305,  306,  307,
+      308,  309,  311,  312,  304,  310,  310,  313,  314,  316,
+      315,  313,  317,  318,  319,  310,  308,  310,  310,  310,
+      315,  320,  310,  321,  322,  323,  324,  325,  326,  327,
+      328,  329,  330,  331,  331,  332,  333,  334,  335,  336,
+      337,  331,  319,  338,  339,  338,  340,  341,  342,  343,
+      344,  336,  329,  345,  346,  347,  348,  349,  350,  351,
+      340,  352,  343,  353,  354,  355,  356,  357,  358,  359,
+      360,  361,  362,  350,  356,  363,  364,  365,  366,  367,
+      368,  368,  369,  349,  370,  371,  372,  374,  375,  376,
+
+      377,  378,  367,  379,  380,  382,  383,  382,  384,  385,
+      386,  387,  367,  377,  388,  389,  390,  391,  392,  390,
+      393,  394,  395,  396,  397,  398,  399,  401,  400,  402,
+      403,  405,  404,  400,  396,  400,  406,  407,  408,  409,
+      410,  392,  404,  400,  411,  412,  400,  393,  413,  414,
+      415,  416,  417,  400,  418,  419,  421,  422,  423,  424,
+      426,  425,  408,  427,  419,  424,  425,  428,  429,  430,
+      431,  432,  427,  433,  434,  435,  436,  437,  435,  438,
+      436,  439,  440,  441,  442,  443,  444,  445,  446,  447,
+      444,  448,  449,  450,  451,  452,  453,  454,  455,  456,
+
+      457,  458,  459,  460,  461,  457,  462,  450,  456,  457,
+      463,  464,  465,  466,  467,  468,  469,  470,  471,  472,
+      473,  474,  475,  476,  477,  478,  479,  480,  481,  482,
+      472,  483,  484,  485,  486,  487,  467,  488,  489,  490,
+      491,  492,  493,  494,  495,  496,  497,  494,  498,  499,
+      500,  501,  502,  503,  504,  506,  500,  505,  504,  501,
+      505,  507,  508,  509,  510,  511,  512,  502,  513,  514,
+      515,  516,  517,  518,  519,  520,  521,  522,  523,  524,
+      525,  526,  527,  528,  529,  523,  530,  531,  532,  528,
+      533,  534,  535,  536,  537,  538,  539,  540,  541,  542,
+
+      543,  545,  546,  547,  548,  549,  550,  542,  551,  552,
+      553,  556,  548,  562,  554,  541,  563,  553,  554,  563,
+      559,  554,  559,  565,  566,  567,  568,  570,  554,  569,
+      569,  554,  569,  571,  572,  569,  573,  574,  575,  576,
+      569,  577,  578,  576,  579,  580,  569,  569,  581,  582,
+      583,  584,  585,  586,  584,  587,  588,  589,  590,  591,
+      592,  593,  594,  595,  596,  597,  598,  599,  600,  601,
+      602,  603,  604,  605,  606,  607,  608,  609,  610,  611,
+      612,  613,  614,  615,  616,  617,  618,  620,  621,  622,
+      623,  624,  625,  626,  627,  628,  629,  630,  633,  631,
+
+      634,  635,  636,  637,  638,  637,  630,  631,  627,  639,
+      640,  641,  642,  643,  644,  640,  645,  646,  647,  648,
+      649,  650,  651,  652,  653,  654,  655,  656,  657,  658,
+      659,  660,  661,  654,  662,  663,  664,  661,  665,  666,
+      667,  668,  669,  670,  671,  672,  673,  674,  673,  675,
+      676,  677,  673,  678,  673,  679,  680,  681,  682,  673,
+      683,  677,  684,  685,  673,  686,  687,  688,  689,  690,
+      691,  692,  693,  685,  694,  695,  696,  697,  698,  694,
+      699,  694,  700,  701,  702,  703,  701,  704,  705,  706,
+      707,  709,  694,  710,  711,  712,  713,  714,  715,  694,
+
+      716,  717,  718,  719,  720,  721,  722,  723,  724,  718,
+      725,  726,  727,  728,  729,  731,  732,  733,  734,  735,
+      736,  737,  738,  735,  739,  740,  741,  742,  743,  744,
+      735,  745,  747,  748,  750,  749,  751,  748,  749,  752,
+      753,  754,  755,  756,  757,  758,  759,  760,  761,  762,
+      763,  764,  765,  766,  767,  768,  769,  770,  771,  772,
+      773,  774,  775,  776,  777,  760,  779,  780,  781,  782,
+      783,  784,  785,  786,  787,  788,  781,  789,  790,  791,
+      792,  793,  794,  795,  797,  799,  800,  801,  802,  795,
+      803,  804,  805,  806,  807,  791,  808,  809,  810,  811,
+
+      812,  813,  814,  815,  816,  817,  818,  819,  820,  821,
+      822,  811,  823,  824,  825,  826,  827,  828,  829,  830,
+      832,  833,  834,  835,  836,  837,  819,  838,  839,  840,
+      841,  840,  842,  843,  844,  832,  845,  846,  847,  849,
+      850,  851,  852,  853,  854,  855,  856,  851,  857,  855,
+      858,  858,  859,  860,  861,  862,  863,  864,  865,  866,
+      867,  868,  865,  869,  870,  871,  872,  873,  874,  875,
+      876,  877,  878,  879,  880,  881,  882,  883,  884,  866,
+      885,  886,  887,  889,  888,  891,  886,  888,  886,  892,
+      886,  893,  886,  886,  894,  895,  889,  896,  897,  895,
+
+      898,  900,  902,  903,  904,  905,  906,  907,  908,  909,
+      911,  900,  912,  913,  914,  915,  916,  917,  918,  919,
+      920,  921,  922,  923,  924,  925,  926,  927,  927,  928,
+      930,  931,  932,  933,  918,  934,  935,  936,  926,  937,
+      938,  939,  940,  941,  942,  940,  943,  944,  945,  946,
+      942,  947,  948,  949,  950,  944,  951,  952,  953,  955,
+      956,  957,  958,  959,  956,  960,  961,  962,  963,  959,
+      964,  965,  966,  967,  968,  969,  962,  970,  965,  971,
+      972,  973,  974,  975,  976,  976,  977,  978,  979,  980,
+      981,  982,  983,  984,  985,  986,  987,  988,  989,  990,
+
+      991,  992,  993,  995,  996,  997,  998,  999, 1000, 1001,
+     1002, 1003,  988, 1004, 1002, 1003, 1006, 1007, 1008, 1009,
+     1010, 1011, 1012, 1013, 1014, 1015, 1016, 1014, 1017, 1018,
+     1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
+     1029, 1030, 1031, 1030, 1032, 1033, 1034, 1035, 1036, 1037,
+     1038, 1039, 1041, 1042, 1043, 1039, 1045, 1036, 1046, 1047,
+     1048, 1049, 1051, 1053, 1054, 1055, 1057, 1059, 1039, 1060,
+     1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071,
+     1072, 1073, 1074, 1065, 1075, 1076, 1060, 1077, 1079, 1080,
+     1081, 1082, 1083, 1074, 1084, 1085, 1086, 1087, 1088, 1089,
+
+     1090, 1091, 1073, 1092, 1094, 1095, 1096, 1097, 1099, 1100,
+     1101, 1102, 1103, 1104, 1105, 1103, 1088, 1106, 1107, 1108,
+     1097, 1109, 1110, 1111, 1112, 1113, 1099, 1103, 1114, 1115,
+     1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125,
+     1126, 1127, 1128, 1129, 1130, 1130, 1131, 1132, 1133, 1134,
+     1135, 1137, 1138, 1139, 1140, 1141, 1142, 1135, 1143, 1142,
+     1145, 1119, 1147, 1141, 1140, 1145, 1148, 1143, 1149, 1150,
+     1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160,
+     1161, 1162, 1163, 1164, 1165, 1163, 1166, 1167, 1168, 1169,
+     1170, 1171, 1172, 1173, 1174, 1176, 1177, 1178, 1179, 1180,
+
+     1181, 1182, 1183, 1184, 1186, 1183, 1187, 1188, 1189, 1190,
+     1191, 1192, 1193, 1194, 1195, 1182, 1198, 1199, 1200, 1201,
+     1195, 1202, 1203, 1204, 1205, 1207, 1208, 1209, 1199, 1210,
+     1211, 1212, 1213, 1214, 1216, 1217, 1218, 1219, 1220, 1221,
+     1222, 1223, 1216, 1209, 1219, 1224, 1225, 1214, 1226, 1227,
+     1228, 1229, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238,
+     1239, 1240, 1241, 1242, 1243, 1244, 1245, 1247, 1248, 1249,
+     1250, 1251, 1252, 1253, 1240, 1254, 1255, 1256, 1258, 1259,
+     1260, 1261, 1262, 1263, 1264, 1265, 1266, 1265, 1263, 1267,
+     1267, 1267, 1245, 1268, 1269, 1270, 1267, 1271, 1273, 1274,
+
+     1275, 1276, 1273, 1277, 1278, 1279, 1280, 1281, 1280, 1282,
+     1283, 1284, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294,
+     1295, 1296, 1297, 1298, 1290, 1299, 1300, 1301, 1302, 1296,
+     1277, 1304, 1289, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+     1312, 1313, 1314, 1302, 1315, 1316, 1317, 1318, 1319, 1320,
+     1321, 1322, 1323, 1324, 1325, 1326, 1327, 1326, 1328, 1329,
+     1330, 1331, 1332, 1333, 1329, 1325, 1334, 1335, 1336, 1337,
+     1338, 1339, 1336, 1340, 1342, 1343, 1344, 1345, 1346, 1347,
+     1348, 1349, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358,
+     1345, 1359, 1361, 1363, 1364, 1366, 1367, 1368, 1369, 1370,
+
+     1371, 1372, 1373, 1374, 1375, 1377, 1378, 1379, 1380, 1382,
+     1384, 1386, 1387, 1388, 1389, 1390, 1377, 1391, 1391, 1393,
+     1394, 1396, 1397, 1398, 1399, 1400, 1401, 1384, 1402, 1396,
+     1403, 1404, 1405, 1406, 1408, 1409, 1389, 1411, 1412, 1413,
+     1414, 1415, 1416, 1417, 1419, 1421, 1406, 1422, 1423, 1424,
+     1425, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435,
+     1436, 1437, 1438, 1439, 1440, 1441, 1443, 1444, 1445, 1446,
+     1447, 1439, 1448, 1441, 1449, 1450, 1451, 1452, 1453, 1454,
+     1455, 1456, 1454, 1457, 1458, 1460, 1461, 1463, 1464, 1465,
+     1466, 1468, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
+
+     1478, 1479, 1480, 1481, 1472, 1482, 1483, 1481, 1486, 1487,
+     1488, 1489, 1490, 1491, 1492, 1478, 1493, 1494, 1496, 1497,
+     1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507,
+     1508, 1510, 1511, 1512, 1512, 1513, 1515, 1514, 1498, 1514,
+     1516, 1517, 1519, 1520, 1521, 1522, 1522, 1520, 1523, 1524,
+     1507, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1530,
+     1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541, 1542,
+     1543, 1544, 1545, 1546, 1548, 1549, 1550, 1551, 1552, 1553,
+     1554, 1555, 1556, 1557, 1558, 1559, 1560, 1561, 1562, 1564,
+     1565, 1566, 1554, 1567, 1568, 1569, 1570, 1556, 1572, 1573,
+
+     1574, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1574, 1584,
+     1564, 1583, 1585, 1586, 1587, 1588, 1590, 1592, 1593, 1594,
+     1595, 1598, 1596, 1578, 1596, 1583, 1599, 1601, 1595, 1603,
+     1604, 1605, 1606, 1587, 1607, 1609, 1610, 1611, 1612, 1613,
+     1614, 1615, 1617, 1618, 1619, 1620, 1621, 1622, 1623, 1624,
+     1625, 1626, 1627, 1628, 1629, 1631, 1632, 1633, 1634, 1635,
+     1638, 1639, 1640, 1641, 1642, 1635, 1631, 1646, 1648, 1651,
+     1653, 1634, 1654, 1655, 1657, 1658, 1659, 1661, 1663, 1664,
+     1665, 1666, 1667, 1668, 1670, 1671, 1672, 1648, 1667, 1673,
+     1675, 1676, 1677, 1678, 1680, 1682, 1683, 1684, 1685, 1686,
+
+     1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696,
+     1697, 1698, 1699, 1700, 1701, 1702, 1703, 1704, 1705, 1706,
+     1707, 1708, 1702, 1709, 1710, 1711, 1712, 1703, 1713, 1716,
+     1717, 1718, 1719, 1720, 1721, 1722, 1723, 1725, 1726, 1727,
+     1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737,
+     1738, 1728, 1739, 1740, 1741, 1742, 1743, 1744, 1746, 1748,
+     1749, 1751, 1752, 1755, 1756, 1757, 1758, 1759, 1760, 1761,
+     1762, 1763, 1765, 1766, 1767, 1768, 1770, 1771, 1772, 1763,
+     1773, 1777, 1757, 1778, 1779, 1780, 1781, 1782, 1783, 1784,
+     1785, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795,
+
+     1796, 1785, 1797, 1798, 1801, 1802, 1803, 1804, 1805, 1806,
+     1807, 1808, 1809, 1811, 1812, 1813, 1814, 1815, 1816, 1817,
+     1818, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829,
+     1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1839, 1840,
+     1842, 1843, 1844, 1845, 1842, 1847, 1849, 1852, 1853, 1854,
+     1855, 1856, 1844, 1857, 1858, 1859, 1860, 1861, 1862, 1863,
+     1864, 1867, 1868, 1869, 1870, 1867, 1873, 1874, 1874, 1875,
+     1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885,
+     1869, 1868, 1886, 1887, 1888, 1889, 1890, 1891, 1892, 1894,
+     1895, 1889, 1896, 1898, 1899, 1901, 1904, 1886, 1905, 1906,
+
+     1907, 1908, 1909, 1911, 1912, 1909, 1913, 1914, 1912, 1916,
+     1917, 1919, 1920, 1924, 1925, 1926, 1928, 1929, 1931, 1932,
+     1929, 1933, 1934, 1935, 1936, 1920, 1937, 1938, 1939, 1940,
+     1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951,
+     1952, 1953, 1954, 1956, 1957, 1959, 1960, 1961, 1962, 1935,
+     1964, 1965, 1966, 1967, 1968, 1969, 1971, 1972, 1968, 1973,
+     1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1960,
+     1972, 1981, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 1990,
+     1991, 1993, 1994, 1996, 1997, 1998, 1999, 2000, 2001, 2002,
+     2003, 2005, 2009, 2010, 2011, 2013, 2014, 2015, 2016, 2017,
+
+     2018, 2019, 2020, 2022, 2024, 2025, 2026, 2028, 2029, 2030,
+     2031, 2032, 2033, 2034, 2036, 2034, 2035, 2035, 2037, 2036,
+     2040, 2042, 2033, 2043, 2044, 2048, 2050, 2051, 2052, 2044,
+     2054, 2055, 2056, 2057, 2058, 2060, 2061, 2062, 2064, 2065,
+     2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075,
+     2076, 2079, 2083, 2062, 2084, 2085, 2087, 2088, 2091, 2092,
+     2093, 2094, 2097, 2098, 2070, 2099, 2097, 2100, 2101, 2102,
+     2103, 2098, 2107, 2109, 2111, 2112, 2113, 2115, 2117, 2116,
+     2115, 2116, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125,
+     2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2135, 2137,
+
+     2140, 2141, 2142, 2143, 2144, 2145, 2147, 2148, 2149, 2150,
+     2151, 2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160,
+     2161, 2162, 2163, 2164, 2165, 2166, 2167, 2169, 2170, 2162,
+     2171, 2172, 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180,
+     2181, 2182, 2183, 2184, 2185, 2186, 2188, 2189, 2190, 2191,
+     2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2202,
+     2205, 2206, 2207, 2208, 2209, 2212, 2212, 2212, 2212, 2212,
+     2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212,
+     2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212,
+     2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212, 2212,
+
+     2212, 2212, 2212, 2212, 2212
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -2191,7 +2093,7 @@ static void config_end_include(void)
 #define YY_NO_INPUT 1
 #endif
 
-#line 2193 "<stdout>"
+#line 2095 "<stdout>"
 
 #define INITIAL 0
 #define quotedstring 1
@@ -2414,7 +2316,7 @@ YY_DECL
 	{
 #line 207 "./util/configlexer.lex"
 
-#line 2416 "<stdout>"
+#line 2318 "<stdout>"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2447,13 +2349,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1997 )
+				if ( yy_current_state >= 2213 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 3939 );
+		while ( yy_base[yy_current_state] != 3166 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -2768,670 +2670,780 @@ YY_RULE_SETUP
 case 58:
 YY_RULE_SETUP
 #line 268 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
+{ YDVAR(1, VAR_HEDGE_PERCENTILE) }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 269 "./util/configlexer.lex"
-{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
+{ YDVAR(1, VAR_HEDGE_BUDGET) }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 270 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DELAY_CLOSE) }
+{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 271 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
+{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 272 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
+{ YDVAR(1, VAR_MESH_CLIENT_QUOTA) }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
 #line 273 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
+{ YDVAR(1, VAR_MESH_ZONE_QUOTA) }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 274 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_GLUE) }
+{ YDVAR(1, VAR_MESH_PREFETCH_RESERVE) }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
 #line 275 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
+{ YDVAR(1, VAR_DELAY_CLOSE) }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
 #line 276 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
+{ YDVAR(1, VAR_OUTGOING_UDP_POOL) }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
 #line 277 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
+{ YDVAR(1, VAR_OUTGOING_UDP_POOL_ROTATE) }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
 #line 278 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
+{ YDVAR(1, VAR_OUTGOING_UDP_POOL_USES) }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
 #line 279 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
+{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 280 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CAPS_WHITELIST) }
+{ YDVAR(1, VAR_TARGET_FETCH_PARALLEL) }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
 #line 281 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
+{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
 #line 282 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
+{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
 #line 283 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
+{ YDVAR(1, VAR_HARDEN_GLUE) }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
 #line 284 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH_KEY) }
+{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
 #line 285 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH) }
+{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
 #line 286 "./util/configlexer.lex"
-{ YDVAR(0, VAR_STUB_ZONE) }
+{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 287 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NAME) }
+{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 288 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_ADDR) }
+{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 289 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_HOST) }
+{ YDVAR(1, VAR_CAPS_WHITELIST) }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 290 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_PRIME) }
+{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 291 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_FIRST) }
+{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 292 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 293 "./util/configlexer.lex"
-{ YDVAR(0, VAR_FORWARD_ZONE) }
+{ YDVAR(1, VAR_PREFETCH_KEY) }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 294 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_ADDR) }
+{ YDVAR(1, VAR_PREFETCH) }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 295 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_HOST) }
+{ YDVAR(0, VAR_STUB_ZONE) }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 296 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_FIRST) }
+{ YDVAR(1, VAR_NAME) }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 297 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_STUB_ADDR) }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 298 "./util/configlexer.lex"
-{ YDVAR(0, VAR_VIEW) }
+{ YDVAR(1, VAR_STUB_HOST) }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 299 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VIEW_FIRST) }
+{ YDVAR(1, VAR_STUB_PRIME) }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 300 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
+{ YDVAR(1, VAR_STUB_FIRST) }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 301 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
+{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 302 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL) }
+{ YDVAR(0, VAR_FORWARD_ZONE) }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 303 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_IDENTITY) }
+{ YDVAR(1, VAR_FORWARD_ADDR) }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 304 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_VERSION) }
+{ YDVAR(1, VAR_FORWARD_HOST) }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 305 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IDENTITY) }
+{ YDVAR(1, VAR_FORWARD_FIRST) }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 306 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VERSION) }
+{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
 #line 307 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MODULE_CONF) }
+{ YDVAR(0, VAR_VIEW) }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
 #line 308 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR) }
+{ YDVAR(1, VAR_VIEW_FIRST) }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 309 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
 #line 310 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
 #line 311 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
+{ YDVAR(2, VAR_ACCESS_CONTROL) }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
 #line 312 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
+{ YDVAR(1, VAR_HIDE_IDENTITY) }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
 #line 313 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR) }
+{ YDVAR(1, VAR_HIDE_VERSION) }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
 #line 314 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
+{ YDVAR(1, VAR_IDENTITY) }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
 #line 315 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
+{ YDVAR(1, VAR_VERSION) }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
 #line 316 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
+{ YDVAR(1, VAR_MODULE_CONF) }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
 #line 317 "./util/configlexer.lex"
-{ YDVAR(1, VAR_BOGUS_TTL) }
+{ YDVAR(1, VAR_DLV_ANCHOR) }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
 #line 318 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
+{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
 #line 319 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
 #line 320 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
+{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
 #line 321 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED) }
+{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
 #line 322 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_DSA) }
+{ YDVAR(1, VAR_TRUST_ANCHOR) }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
 #line 323 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
+{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
 #line 324 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
 #line 325 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
 #line 326 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
+{ YDVAR(1, VAR_BOGUS_TTL) }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
 #line 327 "./util/configlexer.lex"
-{ 
-				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
+{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
-#line 329 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ADD_HOLDDOWN) }
+#line 328 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
-#line 330 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEL_HOLDDOWN) }
+#line 329 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
-#line 331 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEEP_MISSING) }
+#line 330 "./util/configlexer.lex"
+{ YDVAR(1, VAR_SERVE_EXPIRED) }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
-#line 332 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
+#line 331 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAKE_DSA) }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
-#line 333 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSLOG) }
+#line 332 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
-#line 334 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_IDENTITY) }
+#line 333 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
-#line 335 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TIME_ASCII) }
+#line 334 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
-#line 336 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_QUERIES) }
+#line 335 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
-#line 337 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_REPLIES) }
+#line 336 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NSEC3_HASH_CACHE_SIZE) }
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
-#line 338 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE) }
+#line 337 "./util/configlexer.lex"
+{ 
+				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
 #line 339 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA) }
+{ YDVAR(1, VAR_ADD_HOLDDOWN) }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 340 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
+{ YDVAR(1, VAR_DEL_HOLDDOWN) }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 341 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
+{ YDVAR(1, VAR_KEEP_MISSING) }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 342 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
+{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 343 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
+{ YDVAR(1, VAR_USE_SYSLOG) }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
 #line 344 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
+{ YDVAR(1, VAR_LOG_IDENTITY) }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
 #line 345 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
+{ YDVAR(1, VAR_LOG_TIME_ASCII) }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
 #line 346 "./util/configlexer.lex"
-{ YDVAR(0, VAR_REMOTE_CONTROL) }
+{ YDVAR(1, VAR_LOG_QUERIES) }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
 #line 347 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_ENABLE) }
+{ YDVAR(1, VAR_LOG_REPLIES) }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
 #line 348 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+{ YDVAR(1, VAR_LOG_ASYNC) }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
 #line 349 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_PORT) }
+{ YDVAR(1, VAR_LOG_ASYNC_SIZE) }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
 #line 350 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_USE_CERT) }
+{ YDVAR(1, VAR_LOG_BINARY_FILE) }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
 #line 351 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+{ YDVAR(2, VAR_LOCAL_ZONE) }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
 #line 352 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+{ YDVAR(1, VAR_LOCAL_DATA) }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 353 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
 #line 354 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
 #line 355 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
 #line 356 "./util/configlexer.lex"
-{ YDVAR(0, VAR_PYTHON) }
+{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
 #line 357 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
 #line 358 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
 #line 359 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+{ YDVAR(1, VAR_METRICS_ENABLE) }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
 #line 360 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+{ YDVAR(1, VAR_METRICS_INTERFACE) }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
 #line 361 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_PREFIX) }
+{ YDVAR(1, VAR_METRICS_PORT) }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 362 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+{ YDVAR(0, VAR_REMOTE_CONTROL) }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
 #line 363 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEFINE_TAG) }
+{ YDVAR(1, VAR_CONTROL_ENABLE) }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 364 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
+{ YDVAR(1, VAR_CONTROL_INTERFACE) }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 365 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
+{ YDVAR(1, VAR_CONTROL_PORT) }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 366 "./util/configlexer.lex"
-{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
+{ YDVAR(1, VAR_CONTROL_USE_CERT) }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 367 "./util/configlexer.lex"
-{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
+{ YDVAR(1, VAR_SERVER_KEY_FILE) }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 368 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
+{ YDVAR(1, VAR_SERVER_CERT_FILE) }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 369 "./util/configlexer.lex"
-{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
+{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 370 "./util/configlexer.lex"
-{ YDVAR(0, VAR_DNSTAP) }
+{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 371 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+{ YDVAR(1, VAR_PYTHON_SCRIPT) }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 372 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+{ YDVAR(0, VAR_PYTHON) }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 373 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
+{ YDVAR(1, VAR_DYNLIB_FILE) }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 374 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
+{ YDVAR(0, VAR_DYNLIB) }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
 #line 375 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
+{ YDVAR(1, VAR_DOMAIN_INSECURE) }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 376 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_VERSION) }
+{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
 #line 377 "./util/configlexer.lex"
-{
-		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
+{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
+#line 378 "./util/configlexer.lex"
+{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+	YY_BREAK
+case 168:
+YY_RULE_SETUP
 #line 379 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_PREFIX) }
+	YY_BREAK
+case 169:
+YY_RULE_SETUP
+#line 380 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+	YY_BREAK
+case 170:
+YY_RULE_SETUP
+#line 381 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DEFINE_TAG) }
+	YY_BREAK
+case 171:
+YY_RULE_SETUP
+#line 382 "./util/configlexer.lex"
+{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
+	YY_BREAK
+case 172:
+YY_RULE_SETUP
+#line 383 "./util/configlexer.lex"
+{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
+	YY_BREAK
+case 173:
+YY_RULE_SETUP
+#line 384 "./util/configlexer.lex"
+{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
+	YY_BREAK
+case 174:
+YY_RULE_SETUP
+#line 385 "./util/configlexer.lex"
+{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
+	YY_BREAK
+case 175:
+YY_RULE_SETUP
+#line 386 "./util/configlexer.lex"
+{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
+	YY_BREAK
+case 176:
+YY_RULE_SETUP
+#line 387 "./util/configlexer.lex"
+{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
+	YY_BREAK
+case 177:
+YY_RULE_SETUP
+#line 388 "./util/configlexer.lex"
+{ YDVAR(0, VAR_DNSTAP) }
+	YY_BREAK
+case 178:
+YY_RULE_SETUP
+#line 389 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+	YY_BREAK
+case 179:
+YY_RULE_SETUP
+#line 390 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+	YY_BREAK
+case 180:
+YY_RULE_SETUP
+#line 391 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
+	YY_BREAK
+case 181:
+YY_RULE_SETUP
+#line 392 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
+	YY_BREAK
+case 182:
+YY_RULE_SETUP
+#line 393 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
+	YY_BREAK
+case 183:
+YY_RULE_SETUP
+#line 394 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_VERSION) }
+	YY_BREAK
+case 184:
+YY_RULE_SETUP
+#line 395 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
+	YY_BREAK
+case 185:
+YY_RULE_SETUP
+#line 397 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 168:
+case 186:
 YY_RULE_SETUP
-#line 381 "./util/configlexer.lex"
+#line 399 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES) }
 	YY_BREAK
-case 169:
+case 187:
 YY_RULE_SETUP
-#line 383 "./util/configlexer.lex"
+#line 401 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 170:
+case 188:
 YY_RULE_SETUP
-#line 385 "./util/configlexer.lex"
+#line 403 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES) }
 	YY_BREAK
-case 171:
+case 189:
 YY_RULE_SETUP
-#line 387 "./util/configlexer.lex"
+#line 405 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 172:
+case 190:
 YY_RULE_SETUP
-#line 389 "./util/configlexer.lex"
+#line 407 "./util/configlexer.lex"
 { YDVAR(1, VAR_DISABLE_DNSSEC_LAME_CHECK) }
 	YY_BREAK
-case 173:
+case 191:
 YY_RULE_SETUP
-#line 390 "./util/configlexer.lex"
+#line 408 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT) }
 	YY_BREAK
-case 174:
+case 192:
 YY_RULE_SETUP
-#line 391 "./util/configlexer.lex"
+#line 409 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT) }
 	YY_BREAK
-case 175:
+case 193:
 YY_RULE_SETUP
-#line 392 "./util/configlexer.lex"
+#line 410 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_SLABS) }
 	YY_BREAK
-case 176:
+case 194:
 YY_RULE_SETUP
-#line 393 "./util/configlexer.lex"
+#line 411 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SLABS) }
 	YY_BREAK
-case 177:
+case 195:
 YY_RULE_SETUP
-#line 394 "./util/configlexer.lex"
+#line 412 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_SIZE) }
 	YY_BREAK
-case 178:
+case 196:
 YY_RULE_SETUP
-#line 395 "./util/configlexer.lex"
+#line 413 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SIZE) }
 	YY_BREAK
-case 179:
+case 197:
 YY_RULE_SETUP
-#line 396 "./util/configlexer.lex"
+#line 414 "./util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_FOR_DOMAIN) }
 	YY_BREAK
-case 180:
+case 198:
 YY_RULE_SETUP
-#line 397 "./util/configlexer.lex"
+#line 415 "./util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_BELOW_DOMAIN) }
 	YY_BREAK
-case 181:
+case 199:
 YY_RULE_SETUP
-#line 398 "./util/configlexer.lex"
+#line 416 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_FACTOR) }
 	YY_BREAK
-case 182:
+case 200:
 YY_RULE_SETUP
-#line 399 "./util/configlexer.lex"
+#line 417 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_FACTOR) }
 	YY_BREAK
-case 183:
-/* rule 183 can match eol */
+case 201:
 YY_RULE_SETUP
-#line 400 "./util/configlexer.lex"
+#line 418 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RRL_RATELIMIT) }
+	YY_BREAK
+case 202:
+YY_RULE_SETUP
+#line 419 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RRL_SLIP) }
+	YY_BREAK
+case 203:
+YY_RULE_SETUP
+#line 420 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RRL_SIZE) }
+	YY_BREAK
+case 204:
+YY_RULE_SETUP
+#line 421 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RRL_SLABS) }
+	YY_BREAK
+case 205:
+/* rule 205 can match eol */
+YY_RULE_SETUP
+#line 422 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++; }
 	YY_BREAK
 /* Quoted strings. Strip leading and ending quotes */
-case 184:
+case 206:
 YY_RULE_SETUP
-#line 403 "./util/configlexer.lex"
+#line 425 "./util/configlexer.lex"
 { BEGIN(quotedstring); LEXOUT(("QS ")); }
 	YY_BREAK
 case YY_STATE_EOF(quotedstring):
-#line 404 "./util/configlexer.lex"
+#line 426 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 185:
+case 207:
 YY_RULE_SETUP
-#line 409 "./util/configlexer.lex"
+#line 431 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 186:
-/* rule 186 can match eol */
+case 208:
+/* rule 208 can match eol */
 YY_RULE_SETUP
-#line 410 "./util/configlexer.lex"
+#line 432 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end \""); 
 			  cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 187:
+case 209:
 YY_RULE_SETUP
-#line 412 "./util/configlexer.lex"
+#line 434 "./util/configlexer.lex"
 {
         LEXOUT(("QE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -3444,34 +3456,34 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* Single Quoted strings. Strip leading and ending quotes */
-case 188:
+case 210:
 YY_RULE_SETUP
-#line 424 "./util/configlexer.lex"
+#line 446 "./util/configlexer.lex"
 { BEGIN(singlequotedstr); LEXOUT(("SQS ")); }
 	YY_BREAK
 case YY_STATE_EOF(singlequotedstr):
-#line 425 "./util/configlexer.lex"
+#line 447 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 189:
+case 211:
 YY_RULE_SETUP
-#line 430 "./util/configlexer.lex"
+#line 452 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 190:
-/* rule 190 can match eol */
+case 212:
+/* rule 212 can match eol */
 YY_RULE_SETUP
-#line 431 "./util/configlexer.lex"
+#line 453 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end '"); 
 			     cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 191:
+case 213:
 YY_RULE_SETUP
-#line 433 "./util/configlexer.lex"
+#line 455 "./util/configlexer.lex"
 {
         LEXOUT(("SQE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -3484,38 +3496,38 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* include: directive */
-case 192:
+case 214:
 YY_RULE_SETUP
-#line 445 "./util/configlexer.lex"
+#line 467 "./util/configlexer.lex"
 { 
 	LEXOUT(("v(%s) ", yytext)); inc_prev = YYSTATE; BEGIN(include); }
 	YY_BREAK
 case YY_STATE_EOF(include):
-#line 447 "./util/configlexer.lex"
+#line 469 "./util/configlexer.lex"
 {
         yyerror("EOF inside include directive");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 193:
+case 215:
 YY_RULE_SETUP
-#line 451 "./util/configlexer.lex"
+#line 473 "./util/configlexer.lex"
 { LEXOUT(("ISP ")); /* ignore */ }
 	YY_BREAK
-case 194:
-/* rule 194 can match eol */
+case 216:
+/* rule 216 can match eol */
 YY_RULE_SETUP
-#line 452 "./util/configlexer.lex"
+#line 474 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++;}
 	YY_BREAK
-case 195:
+case 217:
 YY_RULE_SETUP
-#line 453 "./util/configlexer.lex"
+#line 475 "./util/configlexer.lex"
 { LEXOUT(("IQS ")); BEGIN(include_quoted); }
 	YY_BREAK
-case 196:
+case 218:
 YY_RULE_SETUP
-#line 454 "./util/configlexer.lex"
+#line 476 "./util/configlexer.lex"
 {
 	LEXOUT(("Iunquotedstr(%s) ", yytext));
 	config_start_include_glob(yytext);
@@ -3523,27 +3535,27 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case YY_STATE_EOF(include_quoted):
-#line 459 "./util/configlexer.lex"
+#line 481 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 197:
+case 219:
 YY_RULE_SETUP
-#line 463 "./util/configlexer.lex"
+#line 485 "./util/configlexer.lex"
 { LEXOUT(("ISTR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 198:
-/* rule 198 can match eol */
+case 220:
+/* rule 220 can match eol */
 YY_RULE_SETUP
-#line 464 "./util/configlexer.lex"
+#line 486 "./util/configlexer.lex"
 { yyerror("newline before \" in include name"); 
 				  cfg_parser->line++; BEGIN(inc_prev); }
 	YY_BREAK
-case 199:
+case 221:
 YY_RULE_SETUP
-#line 466 "./util/configlexer.lex"
+#line 488 "./util/configlexer.lex"
 {
 	LEXOUT(("IQE "));
 	yytext[yyleng - 1] = '\0';
@@ -3553,7 +3565,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(val):
-#line 472 "./util/configlexer.lex"
+#line 494 "./util/configlexer.lex"
 {
 	LEXOUT(("LEXEOF "));
 	yy_set_bol(1); /* Set beginning of line, so "^" rules match.  */
@@ -3565,33 +3577,33 @@ case YY_STATE_EOF(val):
 	}
 }
 	YY_BREAK
-case 200:
+case 222:
 YY_RULE_SETUP
-#line 483 "./util/configlexer.lex"
+#line 505 "./util/configlexer.lex"
 { LEXOUT(("unquotedstr(%s) ", yytext)); 
 			if(--num_args == 0) { BEGIN(INITIAL); }
 			yylval.str = strdup(yytext); return STRING_ARG; }
 	YY_BREAK
-case 201:
+case 223:
 YY_RULE_SETUP
-#line 487 "./util/configlexer.lex"
+#line 509 "./util/configlexer.lex"
 {
 	ub_c_error_msg("unknown keyword '%s'", yytext);
 	}
 	YY_BREAK
-case 202:
+case 224:
 YY_RULE_SETUP
-#line 491 "./util/configlexer.lex"
+#line 513 "./util/configlexer.lex"
 {
 	ub_c_error_msg("stray '%s'", yytext);
 	}
 	YY_BREAK
-case 203:
+case 225:
 YY_RULE_SETUP
-#line 495 "./util/configlexer.lex"
+#line 517 "./util/configlexer.lex"
 ECHO;
 	YY_BREAK
-#line 3593 "<stdout>"
+#line 3535 "<stdout>"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3882,7 +3894,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1997 )
+			if ( yy_current_state >= 2213 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -3910,11 +3922,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1997 )
+		if ( yy_current_state >= 2213 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 1996);
+	yy_is_jam = (yy_current_state == 2212);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -4553,7 +4565,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 495 "./util/configlexer.lex"
+#line 517 "./util/configlexer.lex"
 
 
 
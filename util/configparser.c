@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,8 @@
 
 
 
-/* Copy the first part of user declarations.  */
-#line 38 "./util/configparser.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 38 "./util/configparser.y"
 
 #include "config.h"
 
@@ -89,473 +94,561 @@ extern struct config_parser_state* cfg_parser;
 #endif
 
 
-#line 93 "util/configparser.c" /* yacc.c:339  */
+#line 98 "util/configparser.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "configparser.h".  */
-#ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-# define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    SPACE = 258,
-    LETTER = 259,
-    NEWLINE = 260,
-    COMMENT = 261,
-    COLON = 262,
-    ANY = 263,
-    ZONESTR = 264,
-    STRING_ARG = 265,
-    VAR_SERVER = 266,
-    VAR_VERBOSITY = 267,
-    VAR_NUM_THREADS = 268,
-    VAR_PORT = 269,
-    VAR_OUTGOING_RANGE = 270,
-    VAR_INTERFACE = 271,
-    VAR_DO_IP4 = 272,
-    VAR_DO_IP6 = 273,
-    VAR_PREFER_IP6 = 274,
-    VAR_DO_UDP = 275,
-    VAR_DO_TCP = 276,
-    VAR_TCP_MSS = 277,
-    VAR_OUTGOING_TCP_MSS = 278,
-    VAR_CHROOT = 279,
-    VAR_USERNAME = 280,
-    VAR_DIRECTORY = 281,
-    VAR_LOGFILE = 282,
-    VAR_PIDFILE = 283,
-    VAR_MSG_CACHE_SIZE = 284,
-    VAR_MSG_CACHE_SLABS = 285,
-    VAR_NUM_QUERIES_PER_THREAD = 286,
-    VAR_RRSET_CACHE_SIZE = 287,
-    VAR_RRSET_CACHE_SLABS = 288,
-    VAR_OUTGOING_NUM_TCP = 289,
-    VAR_INFRA_HOST_TTL = 290,
-    VAR_INFRA_LAME_TTL = 291,
-    VAR_INFRA_CACHE_SLABS = 292,
-    VAR_INFRA_CACHE_NUMHOSTS = 293,
-    VAR_INFRA_CACHE_LAME_SIZE = 294,
-    VAR_NAME = 295,
-    VAR_STUB_ZONE = 296,
-    VAR_STUB_HOST = 297,
-    VAR_STUB_ADDR = 298,
-    VAR_TARGET_FETCH_POLICY = 299,
-    VAR_HARDEN_SHORT_BUFSIZE = 300,
-    VAR_HARDEN_LARGE_QUERIES = 301,
-    VAR_FORWARD_ZONE = 302,
-    VAR_FORWARD_HOST = 303,
-    VAR_FORWARD_ADDR = 304,
-    VAR_DO_NOT_QUERY_ADDRESS = 305,
-    VAR_HIDE_IDENTITY = 306,
-    VAR_HIDE_VERSION = 307,
-    VAR_IDENTITY = 308,
-    VAR_VERSION = 309,
-    VAR_HARDEN_GLUE = 310,
-    VAR_MODULE_CONF = 311,
-    VAR_TRUST_ANCHOR_FILE = 312,
-    VAR_TRUST_ANCHOR = 313,
-    VAR_VAL_OVERRIDE_DATE = 314,
-    VAR_BOGUS_TTL = 315,
-    VAR_VAL_CLEAN_ADDITIONAL = 316,
-    VAR_VAL_PERMISSIVE_MODE = 317,
-    VAR_INCOMING_NUM_TCP = 318,
-    VAR_MSG_BUFFER_SIZE = 319,
-    VAR_KEY_CACHE_SIZE = 320,
-    VAR_KEY_CACHE_SLABS = 321,
-    VAR_TRUSTED_KEYS_FILE = 322,
-    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 323,
-    VAR_USE_SYSLOG = 324,
-    VAR_OUTGOING_INTERFACE = 325,
-    VAR_ROOT_HINTS = 326,
-    VAR_DO_NOT_QUERY_LOCALHOST = 327,
-    VAR_CACHE_MAX_TTL = 328,
-    VAR_HARDEN_DNSSEC_STRIPPED = 329,
-    VAR_ACCESS_CONTROL = 330,
-    VAR_LOCAL_ZONE = 331,
-    VAR_LOCAL_DATA = 332,
-    VAR_INTERFACE_AUTOMATIC = 333,
-    VAR_STATISTICS_INTERVAL = 334,
-    VAR_DO_DAEMONIZE = 335,
-    VAR_USE_CAPS_FOR_ID = 336,
-    VAR_STATISTICS_CUMULATIVE = 337,
-    VAR_OUTGOING_PORT_PERMIT = 338,
-    VAR_OUTGOING_PORT_AVOID = 339,
-    VAR_DLV_ANCHOR_FILE = 340,
-    VAR_DLV_ANCHOR = 341,
-    VAR_NEG_CACHE_SIZE = 342,
-    VAR_HARDEN_REFERRAL_PATH = 343,
-    VAR_PRIVATE_ADDRESS = 344,
-    VAR_PRIVATE_DOMAIN = 345,
-    VAR_REMOTE_CONTROL = 346,
-    VAR_CONTROL_ENABLE = 347,
-    VAR_CONTROL_INTERFACE = 348,
-    VAR_CONTROL_PORT = 349,
-    VAR_SERVER_KEY_FILE = 350,
-    VAR_SERVER_CERT_FILE = 351,
-    VAR_CONTROL_KEY_FILE = 352,
-    VAR_CONTROL_CERT_FILE = 353,
-    VAR_CONTROL_USE_CERT = 354,
-    VAR_EXTENDED_STATISTICS = 355,
-    VAR_LOCAL_DATA_PTR = 356,
-    VAR_JOSTLE_TIMEOUT = 357,
-    VAR_STUB_PRIME = 358,
-    VAR_UNWANTED_REPLY_THRESHOLD = 359,
-    VAR_LOG_TIME_ASCII = 360,
-    VAR_DOMAIN_INSECURE = 361,
-    VAR_PYTHON = 362,
-    VAR_PYTHON_SCRIPT = 363,
-    VAR_VAL_SIG_SKEW_MIN = 364,
-    VAR_VAL_SIG_SKEW_MAX = 365,
-    VAR_CACHE_MIN_TTL = 366,
-    VAR_VAL_LOG_LEVEL = 367,
-    VAR_AUTO_TRUST_ANCHOR_FILE = 368,
-    VAR_KEEP_MISSING = 369,
-    VAR_ADD_HOLDDOWN = 370,
-    VAR_DEL_HOLDDOWN = 371,
-    VAR_SO_RCVBUF = 372,
-    VAR_EDNS_BUFFER_SIZE = 373,
-    VAR_PREFETCH = 374,
-    VAR_PREFETCH_KEY = 375,
-    VAR_SO_SNDBUF = 376,
-    VAR_SO_REUSEPORT = 377,
-    VAR_HARDEN_BELOW_NXDOMAIN = 378,
-    VAR_IGNORE_CD_FLAG = 379,
-    VAR_LOG_QUERIES = 380,
-    VAR_LOG_REPLIES = 381,
-    VAR_TCP_UPSTREAM = 382,
-    VAR_SSL_UPSTREAM = 383,
-    VAR_SSL_SERVICE_KEY = 384,
-    VAR_SSL_SERVICE_PEM = 385,
-    VAR_SSL_PORT = 386,
-    VAR_FORWARD_FIRST = 387,
-    VAR_STUB_SSL_UPSTREAM = 388,
-    VAR_FORWARD_SSL_UPSTREAM = 389,
-    VAR_STUB_FIRST = 390,
-    VAR_MINIMAL_RESPONSES = 391,
-    VAR_RRSET_ROUNDROBIN = 392,
-    VAR_MAX_UDP_SIZE = 393,
-    VAR_DELAY_CLOSE = 394,
-    VAR_UNBLOCK_LAN_ZONES = 395,
-    VAR_INSECURE_LAN_ZONES = 396,
-    VAR_INFRA_CACHE_MIN_RTT = 397,
-    VAR_DNS64_PREFIX = 398,
-    VAR_DNS64_SYNTHALL = 399,
-    VAR_DNSTAP = 400,
-    VAR_DNSTAP_ENABLE = 401,
-    VAR_DNSTAP_SOCKET_PATH = 402,
-    VAR_DNSTAP_SEND_IDENTITY = 403,
-    VAR_DNSTAP_SEND_VERSION = 404,
-    VAR_DNSTAP_IDENTITY = 405,
-    VAR_DNSTAP_VERSION = 406,
-    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 407,
-    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 408,
-    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 409,
-    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 410,
-    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 411,
-    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 412,
-    VAR_HARDEN_ALGO_DOWNGRADE = 413,
-    VAR_IP_TRANSPARENT = 414,
-    VAR_DISABLE_DNSSEC_LAME_CHECK = 415,
-    VAR_IP_RATELIMIT = 416,
-    VAR_IP_RATELIMIT_SLABS = 417,
-    VAR_IP_RATELIMIT_SIZE = 418,
-    VAR_RATELIMIT = 419,
-    VAR_RATELIMIT_SLABS = 420,
-    VAR_RATELIMIT_SIZE = 421,
-    VAR_RATELIMIT_FOR_DOMAIN = 422,
-    VAR_RATELIMIT_BELOW_DOMAIN = 423,
-    VAR_IP_RATELIMIT_FACTOR = 424,
-    VAR_RATELIMIT_FACTOR = 425,
-    VAR_CAPS_WHITELIST = 426,
-    VAR_CACHE_MAX_NEGATIVE_TTL = 427,
-    VAR_PERMIT_SMALL_HOLDDOWN = 428,
-    VAR_QNAME_MINIMISATION = 429,
-    VAR_QNAME_MINIMISATION_STRICT = 430,
-    VAR_IP_FREEBIND = 431,
-    VAR_DEFINE_TAG = 432,
-    VAR_LOCAL_ZONE_TAG = 433,
-    VAR_ACCESS_CONTROL_TAG = 434,
-    VAR_LOCAL_ZONE_OVERRIDE = 435,
-    VAR_ACCESS_CONTROL_TAG_ACTION = 436,
-    VAR_ACCESS_CONTROL_TAG_DATA = 437,
-    VAR_VIEW = 438,
-    VAR_ACCESS_CONTROL_VIEW = 439,
-    VAR_VIEW_FIRST = 440,
-    VAR_SERVE_EXPIRED = 441,
-    VAR_FAKE_DSA = 442,
-    VAR_LOG_IDENTITY = 443,
-    VAR_USE_SYSTEMD = 444
-  };
-#endif
-/* Tokens.  */
-#define SPACE 258
-#define LETTER 259
-#define NEWLINE 260
-#define COMMENT 261
-#define COLON 262
-#define ANY 263
-#define ZONESTR 264
-#define STRING_ARG 265
-#define VAR_SERVER 266
-#define VAR_VERBOSITY 267
-#define VAR_NUM_THREADS 268
-#define VAR_PORT 269
-#define VAR_OUTGOING_RANGE 270
-#define VAR_INTERFACE 271
-#define VAR_DO_IP4 272
-#define VAR_DO_IP6 273
-#define VAR_PREFER_IP6 274
-#define VAR_DO_UDP 275
-#define VAR_DO_TCP 276
-#define VAR_TCP_MSS 277
-#define VAR_OUTGOING_TCP_MSS 278
-#define VAR_CHROOT 279
-#define VAR_USERNAME 280
-#define VAR_DIRECTORY 281
-#define VAR_LOGFILE 282
-#define VAR_PIDFILE 283
-#define VAR_MSG_CACHE_SIZE 284
-#define VAR_MSG_CACHE_SLABS 285
-#define VAR_NUM_QUERIES_PER_THREAD 286
-#define VAR_RRSET_CACHE_SIZE 287
-#define VAR_RRSET_CACHE_SLABS 288
-#define VAR_OUTGOING_NUM_TCP 289
-#define VAR_INFRA_HOST_TTL 290
-#define VAR_INFRA_LAME_TTL 291
-#define VAR_INFRA_CACHE_SLABS 292
-#define VAR_INFRA_CACHE_NUMHOSTS 293
-#define VAR_INFRA_CACHE_LAME_SIZE 294
-#define VAR_NAME 295
-#define VAR_STUB_ZONE 296
-#define VAR_STUB_HOST 297
-#define VAR_STUB_ADDR 298
-#define VAR_TARGET_FETCH_POLICY 299
-#define VAR_HARDEN_SHORT_BUFSIZE 300
-#define VAR_HARDEN_LARGE_QUERIES 301
-#define VAR_FORWARD_ZONE 302
-#define VAR_FORWARD_HOST 303
-#define VAR_FORWARD_ADDR 304
-#define VAR_DO_NOT_QUERY_ADDRESS 305
-#define VAR_HIDE_IDENTITY 306
-#define VAR_HIDE_VERSION 307
-#define VAR_IDENTITY 308
-#define VAR_VERSION 309
-#define VAR_HARDEN_GLUE 310
-#define VAR_MODULE_CONF 311
-#define VAR_TRUST_ANCHOR_FILE 312
-#define VAR_TRUST_ANCHOR 313
-#define VAR_VAL_OVERRIDE_DATE 314
-#define VAR_BOGUS_TTL 315
-#define VAR_VAL_CLEAN_ADDITIONAL 316
-#define VAR_VAL_PERMISSIVE_MODE 317
-#define VAR_INCOMING_NUM_TCP 318
-#define VAR_MSG_BUFFER_SIZE 319
-#define VAR_KEY_CACHE_SIZE 320
-#define VAR_KEY_CACHE_SLABS 321
-#define VAR_TRUSTED_KEYS_FILE 322
-#define VAR_VAL_NSEC3_KEYSIZE_ITERATIONS 323
-#define VAR_USE_SYSLOG 324
-#define VAR_OUTGOING_INTERFACE 325
-#define VAR_ROOT_HINTS 326
-#define VAR_DO_NOT_QUERY_LOCALHOST 327
-#define VAR_CACHE_MAX_TTL 328
-#define VAR_HARDEN_DNSSEC_STRIPPED 329
-#define VAR_ACCESS_CONTROL 330
-#define VAR_LOCAL_ZONE 331
-#define VAR_LOCAL_DATA 332
-#define VAR_INTERFACE_AUTOMATIC 333
-#define VAR_STATISTICS_INTERVAL 334
-#define VAR_DO_DAEMONIZE 335
-#define VAR_USE_CAPS_FOR_ID 336
-#define VAR_STATISTICS_CUMULATIVE 337
-#define VAR_OUTGOING_PORT_PERMIT 338
-#define VAR_OUTGOING_PORT_AVOID 339
-#define VAR_DLV_ANCHOR_FILE 340
-#define VAR_DLV_ANCHOR 341
-#define VAR_NEG_CACHE_SIZE 342
-#define VAR_HARDEN_REFERRAL_PATH 343
-#define VAR_PRIVATE_ADDRESS 344
-#define VAR_PRIVATE_DOMAIN 345
-#define VAR_REMOTE_CONTROL 346
-#define VAR_CONTROL_ENABLE 347
-#define VAR_CONTROL_INTERFACE 348
-#define VAR_CONTROL_PORT 349
-#define VAR_SERVER_KEY_FILE 350
-#define VAR_SERVER_CERT_FILE 351
-#define VAR_CONTROL_KEY_FILE 352
-#define VAR_CONTROL_CERT_FILE 353
-#define VAR_CONTROL_USE_CERT 354
-#define VAR_EXTENDED_STATISTICS 355
-#define VAR_LOCAL_DATA_PTR 356
-#define VAR_JOSTLE_TIMEOUT 357
-#define VAR_STUB_PRIME 358
-#define VAR_UNWANTED_REPLY_THRESHOLD 359
-#define VAR_LOG_TIME_ASCII 360
-#define VAR_DOMAIN_INSECURE 361
-#define VAR_PYTHON 362
-#define VAR_PYTHON_SCRIPT 363
-#define VAR_VAL_SIG_SKEW_MIN 364
-#define VAR_VAL_SIG_SKEW_MAX 365
-#define VAR_CACHE_MIN_TTL 366
-#define VAR_VAL_LOG_LEVEL 367
-#define VAR_AUTO_TRUST_ANCHOR_FILE 368
-#define VAR_KEEP_MISSING 369
-#define VAR_ADD_HOLDDOWN 370
-#define VAR_DEL_HOLDDOWN 371
-#define VAR_SO_RCVBUF 372
-#define VAR_EDNS_BUFFER_SIZE 373
-#define VAR_PREFETCH 374
-#define VAR_PREFETCH_KEY 375
-#define VAR_SO_SNDBUF 376
-#define VAR_SO_REUSEPORT 377
-#define VAR_HARDEN_BELOW_NXDOMAIN 378
-#define VAR_IGNORE_CD_FLAG 379
-#define VAR_LOG_QUERIES 380
-#define VAR_LOG_REPLIES 381
-#define VAR_TCP_UPSTREAM 382
-#define VAR_SSL_UPSTREAM 383
-#define VAR_SSL_SERVICE_KEY 384
-#define VAR_SSL_SERVICE_PEM 385
-#define VAR_SSL_PORT 386
-#define VAR_FORWARD_FIRST 387
-#define VAR_STUB_SSL_UPSTREAM 388
-#define VAR_FORWARD_SSL_UPSTREAM 389
-#define VAR_STUB_FIRST 390
-#define VAR_MINIMAL_RESPONSES 391
-#define VAR_RRSET_ROUNDROBIN 392
-#define VAR_MAX_UDP_SIZE 393
-#define VAR_DELAY_CLOSE 394
-#define VAR_UNBLOCK_LAN_ZONES 395
-#define VAR_INSECURE_LAN_ZONES 396
-#define VAR_INFRA_CACHE_MIN_RTT 397
-#define VAR_DNS64_PREFIX 398
-#define VAR_DNS64_SYNTHALL 399
-#define VAR_DNSTAP 400
-#define VAR_DNSTAP_ENABLE 401
-#define VAR_DNSTAP_SOCKET_PATH 402
-#define VAR_DNSTAP_SEND_IDENTITY 403
-#define VAR_DNSTAP_SEND_VERSION 404
-#define VAR_DNSTAP_IDENTITY 405
-#define VAR_DNSTAP_VERSION 406
-#define VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES 407
-#define VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES 408
-#define VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES 409
-#define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 410
-#define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 411
-#define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 412
-#define VAR_HARDEN_ALGO_DOWNGRADE 413
-#define VAR_IP_TRANSPARENT 414
-#define VAR_DISABLE_DNSSEC_LAME_CHECK 415
-#define VAR_IP_RATELIMIT 416
-#define VAR_IP_RATELIMIT_SLABS 417
-#define VAR_IP_RATELIMIT_SIZE 418
-#define VAR_RATELIMIT 419
-#define VAR_RATELIMIT_SLABS 420
-#define VAR_RATELIMIT_SIZE 421
-#define VAR_RATELIMIT_FOR_DOMAIN 422
-#define VAR_RATELIMIT_BELOW_DOMAIN 423
-#define VAR_IP_RATELIMIT_FACTOR 424
-#define VAR_RATELIMIT_FACTOR 425
-#define VAR_CAPS_WHITELIST 426
-#define VAR_CACHE_MAX_NEGATIVE_TTL 427
-#define VAR_PERMIT_SMALL_HOLDDOWN 428
-#define VAR_QNAME_MINIMISATION 429
-#define VAR_QNAME_MINIMISATION_STRICT 430
-#define VAR_IP_FREEBIND 431
-#define VAR_DEFINE_TAG 432
-#define VAR_LOCAL_ZONE_TAG 433
-#define VAR_ACCESS_CONTROL_TAG 434
-#define VAR_LOCAL_ZONE_OVERRIDE 435
-#define VAR_ACCESS_CONTROL_TAG_ACTION 436
-#define VAR_ACCESS_CONTROL_TAG_DATA 437
-#define VAR_VIEW 438
-#define VAR_ACCESS_CONTROL_VIEW 439
-#define VAR_VIEW_FIRST 440
-#define VAR_SERVE_EXPIRED 441
-#define VAR_FAKE_DSA 442
-#define VAR_LOG_IDENTITY 443
-#define VAR_USE_SYSTEMD 444
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
-union YYSTYPE
+#include "configparser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 64 "./util/configparser.y" /* yacc.c:355  */
-
-	char*	str;
-
-#line 515 "util/configparser.c" /* yacc.c:355  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SPACE = 3,                      /* SPACE  */
+  YYSYMBOL_LETTER = 4,                     /* LETTER  */
+  YYSYMBOL_NEWLINE = 5,                    /* NEWLINE  */
+  YYSYMBOL_COMMENT = 6,                    /* COMMENT  */
+  YYSYMBOL_COLON = 7,                      /* COLON  */
+  YYSYMBOL_ANY = 8,                        /* ANY  */
+  YYSYMBOL_ZONESTR = 9,                    /* ZONESTR  */
+  YYSYMBOL_STRING_ARG = 10,                /* STRING_ARG  */
+  YYSYMBOL_VAR_SERVER = 11,                /* VAR_SERVER  */
+  YYSYMBOL_VAR_VERBOSITY = 12,             /* VAR_VERBOSITY  */
+  YYSYMBOL_VAR_NUM_THREADS = 13,           /* VAR_NUM_THREADS  */
+  YYSYMBOL_VAR_PORT = 14,                  /* VAR_PORT  */
+  YYSYMBOL_VAR_OUTGOING_RANGE = 15,        /* VAR_OUTGOING_RANGE  */
+  YYSYMBOL_VAR_INTERFACE = 16,             /* VAR_INTERFACE  */
+  YYSYMBOL_VAR_DO_IP4 = 17,                /* VAR_DO_IP4  */
+  YYSYMBOL_VAR_DO_IP6 = 18,                /* VAR_DO_IP6  */
+  YYSYMBOL_VAR_PREFER_IP6 = 19,            /* VAR_PREFER_IP6  */
+  YYSYMBOL_VAR_DO_UDP = 20,                /* VAR_DO_UDP  */
+  YYSYMBOL_VAR_DO_TCP = 21,                /* VAR_DO_TCP  */
+  YYSYMBOL_VAR_TCP_MSS = 22,               /* VAR_TCP_MSS  */
+  YYSYMBOL_VAR_OUTGOING_TCP_MSS = 23,      /* VAR_OUTGOING_TCP_MSS  */
+  YYSYMBOL_VAR_CHROOT = 24,                /* VAR_CHROOT  */
+  YYSYMBOL_VAR_USERNAME = 25,              /* VAR_USERNAME  */
+  YYSYMBOL_VAR_DIRECTORY = 26,             /* VAR_DIRECTORY  */
+  YYSYMBOL_VAR_LOGFILE = 27,               /* VAR_LOGFILE  */
+  YYSYMBOL_VAR_PIDFILE = 28,               /* VAR_PIDFILE  */
+  YYSYMBOL_VAR_MSG_CACHE_SIZE = 29,        /* VAR_MSG_CACHE_SIZE  */
+  YYSYMBOL_VAR_MSG_CACHE_SLABS = 30,       /* VAR_MSG_CACHE_SLABS  */
+  YYSYMBOL_VAR_NUM_QUERIES_PER_THREAD = 31, /* VAR_NUM_QUERIES_PER_THREAD  */
+  YYSYMBOL_VAR_RRSET_CACHE_SIZE = 32,      /* VAR_RRSET_CACHE_SIZE  */
+  YYSYMBOL_VAR_RRSET_CACHE_SLABS = 33,     /* VAR_RRSET_CACHE_SLABS  */
+  YYSYMBOL_VAR_OUTGOING_NUM_TCP = 34,      /* VAR_OUTGOING_NUM_TCP  */
+  YYSYMBOL_VAR_INFRA_HOST_TTL = 35,        /* VAR_INFRA_HOST_TTL  */
+  YYSYMBOL_VAR_INFRA_LAME_TTL = 36,        /* VAR_INFRA_LAME_TTL  */
+  YYSYMBOL_VAR_INFRA_CACHE_SLABS = 37,     /* VAR_INFRA_CACHE_SLABS  */
+  YYSYMBOL_VAR_INFRA_CACHE_NUMHOSTS = 38,  /* VAR_INFRA_CACHE_NUMHOSTS  */
+  YYSYMBOL_VAR_INFRA_CACHE_LAME_SIZE = 39, /* VAR_INFRA_CACHE_LAME_SIZE  */
+  YYSYMBOL_VAR_NAME = 40,                  /* VAR_NAME  */
+  YYSYMBOL_VAR_STUB_ZONE = 41,             /* VAR_STUB_ZONE  */
+  YYSYMBOL_VAR_STUB_HOST = 42,             /* VAR_STUB_HOST  */
+  YYSYMBOL_VAR_STUB_ADDR = 43,             /* VAR_STUB_ADDR  */
+  YYSYMBOL_VAR_TARGET_FETCH_POLICY = 44,   /* VAR_TARGET_FETCH_POLICY  */
+  YYSYMBOL_VAR_HARDEN_SHORT_BUFSIZE = 45,  /* VAR_HARDEN_SHORT_BUFSIZE  */
+  YYSYMBOL_VAR_HARDEN_LARGE_QUERIES = 46,  /* VAR_HARDEN_LARGE_QUERIES  */
+  YYSYMBOL_VAR_FORWARD_ZONE = 47,          /* VAR_FORWARD_ZONE  */
+  YYSYMBOL_VAR_FORWARD_HOST = 48,          /* VAR_FORWARD_HOST  */
+  YYSYMBOL_VAR_FORWARD_ADDR = 49,          /* VAR_FORWARD_ADDR  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_ADDRESS = 50,  /* VAR_DO_NOT_QUERY_ADDRESS  */
+  YYSYMBOL_VAR_HIDE_IDENTITY = 51,         /* VAR_HIDE_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_VERSION = 52,          /* VAR_HIDE_VERSION  */
+  YYSYMBOL_VAR_IDENTITY = 53,              /* VAR_IDENTITY  */
+  YYSYMBOL_VAR_VERSION = 54,               /* VAR_VERSION  */
+  YYSYMBOL_VAR_HARDEN_GLUE = 55,           /* VAR_HARDEN_GLUE  */
+  YYSYMBOL_VAR_MODULE_CONF = 56,           /* VAR_MODULE_CONF  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_FILE = 57,     /* VAR_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_TRUST_ANCHOR = 58,          /* VAR_TRUST_ANCHOR  */
+  YYSYMBOL_VAR_VAL_OVERRIDE_DATE = 59,     /* VAR_VAL_OVERRIDE_DATE  */
+  YYSYMBOL_VAR_BOGUS_TTL = 60,             /* VAR_BOGUS_TTL  */
+  YYSYMBOL_VAR_VAL_CLEAN_ADDITIONAL = 61,  /* VAR_VAL_CLEAN_ADDITIONAL  */
+  YYSYMBOL_VAR_VAL_PERMISSIVE_MODE = 62,   /* VAR_VAL_PERMISSIVE_MODE  */
+  YYSYMBOL_VAR_INCOMING_NUM_TCP = 63,      /* VAR_INCOMING_NUM_TCP  */
+  YYSYMBOL_VAR_MSG_BUFFER_SIZE = 64,       /* VAR_MSG_BUFFER_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SIZE = 65,        /* VAR_KEY_CACHE_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SLABS = 66,       /* VAR_KEY_CACHE_SLABS  */
+  YYSYMBOL_VAR_TRUSTED_KEYS_FILE = 67,     /* VAR_TRUSTED_KEYS_FILE  */
+  YYSYMBOL_VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 68, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
+  YYSYMBOL_VAR_USE_SYSLOG = 69,            /* VAR_USE_SYSLOG  */
+  YYSYMBOL_VAR_OUTGOING_INTERFACE = 70,    /* VAR_OUTGOING_INTERFACE  */
+  YYSYMBOL_VAR_ROOT_HINTS = 71,            /* VAR_ROOT_HINTS  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_LOCALHOST = 72, /* VAR_DO_NOT_QUERY_LOCALHOST  */
+  YYSYMBOL_VAR_CACHE_MAX_TTL = 73,         /* VAR_CACHE_MAX_TTL  */
+  YYSYMBOL_VAR_HARDEN_DNSSEC_STRIPPED = 74, /* VAR_HARDEN_DNSSEC_STRIPPED  */
+  YYSYMBOL_VAR_ACCESS_CONTROL = 75,        /* VAR_ACCESS_CONTROL  */
+  YYSYMBOL_VAR_LOCAL_ZONE = 76,            /* VAR_LOCAL_ZONE  */
+  YYSYMBOL_VAR_LOCAL_DATA = 77,            /* VAR_LOCAL_DATA  */
+  YYSYMBOL_VAR_INTERFACE_AUTOMATIC = 78,   /* VAR_INTERFACE_AUTOMATIC  */
+  YYSYMBOL_VAR_STATISTICS_INTERVAL = 79,   /* VAR_STATISTICS_INTERVAL  */
+  YYSYMBOL_VAR_DO_DAEMONIZE = 80,          /* VAR_DO_DAEMONIZE  */
+  YYSYMBOL_VAR_USE_CAPS_FOR_ID = 81,       /* VAR_USE_CAPS_FOR_ID  */
+  YYSYMBOL_VAR_STATISTICS_CUMULATIVE = 82, /* VAR_STATISTICS_CUMULATIVE  */
+  YYSYMBOL_VAR_OUTGOING_PORT_PERMIT = 83,  /* VAR_OUTGOING_PORT_PERMIT  */
+  YYSYMBOL_VAR_OUTGOING_PORT_AVOID = 84,   /* VAR_OUTGOING_PORT_AVOID  */
+  YYSYMBOL_VAR_DLV_ANCHOR_FILE = 85,       /* VAR_DLV_ANCHOR_FILE  */
+  YYSYMBOL_VAR_DLV_ANCHOR = 86,            /* VAR_DLV_ANCHOR  */
+  YYSYMBOL_VAR_NEG_CACHE_SIZE = 87,        /* VAR_NEG_CACHE_SIZE  */
+  YYSYMBOL_VAR_HARDEN_REFERRAL_PATH = 88,  /* VAR_HARDEN_REFERRAL_PATH  */
+  YYSYMBOL_VAR_PRIVATE_ADDRESS = 89,       /* VAR_PRIVATE_ADDRESS  */
+  YYSYMBOL_VAR_PRIVATE_DOMAIN = 90,        /* VAR_PRIVATE_DOMAIN  */
+  YYSYMBOL_VAR_REMOTE_CONTROL = 91,        /* VAR_REMOTE_CONTROL  */
+  YYSYMBOL_VAR_CONTROL_ENABLE = 92,        /* VAR_CONTROL_ENABLE  */
+  YYSYMBOL_VAR_CONTROL_INTERFACE = 93,     /* VAR_CONTROL_INTERFACE  */
+  YYSYMBOL_VAR_CONTROL_PORT = 94,          /* VAR_CONTROL_PORT  */
+  YYSYMBOL_VAR_SERVER_KEY_FILE = 95,       /* VAR_SERVER_KEY_FILE  */
+  YYSYMBOL_VAR_SERVER_CERT_FILE = 96,      /* VAR_SERVER_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_KEY_FILE = 97,      /* VAR_CONTROL_KEY_FILE  */
+  YYSYMBOL_VAR_CONTROL_CERT_FILE = 98,     /* VAR_CONTROL_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_USE_CERT = 99,      /* VAR_CONTROL_USE_CERT  */
+  YYSYMBOL_VAR_EXTENDED_STATISTICS = 100,  /* VAR_EXTENDED_STATISTICS  */
+  YYSYMBOL_VAR_LOCAL_DATA_PTR = 101,       /* VAR_LOCAL_DATA_PTR  */
+  YYSYMBOL_VAR_JOSTLE_TIMEOUT = 102,       /* VAR_JOSTLE_TIMEOUT  */
+  YYSYMBOL_VAR_STUB_PRIME = 103,           /* VAR_STUB_PRIME  */
+  YYSYMBOL_VAR_UNWANTED_REPLY_THRESHOLD = 104, /* VAR_UNWANTED_REPLY_THRESHOLD  */
+  YYSYMBOL_VAR_LOG_TIME_ASCII = 105,       /* VAR_LOG_TIME_ASCII  */
+  YYSYMBOL_VAR_DOMAIN_INSECURE = 106,      /* VAR_DOMAIN_INSECURE  */
+  YYSYMBOL_VAR_PYTHON = 107,               /* VAR_PYTHON  */
+  YYSYMBOL_VAR_PYTHON_SCRIPT = 108,        /* VAR_PYTHON_SCRIPT  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MIN = 109,     /* VAR_VAL_SIG_SKEW_MIN  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MAX = 110,     /* VAR_VAL_SIG_SKEW_MAX  */
+  YYSYMBOL_VAR_CACHE_MIN_TTL = 111,        /* VAR_CACHE_MIN_TTL  */
+  YYSYMBOL_VAR_VAL_LOG_LEVEL = 112,        /* VAR_VAL_LOG_LEVEL  */
+  YYSYMBOL_VAR_AUTO_TRUST_ANCHOR_FILE = 113, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_KEEP_MISSING = 114,         /* VAR_KEEP_MISSING  */
+  YYSYMBOL_VAR_ADD_HOLDDOWN = 115,         /* VAR_ADD_HOLDDOWN  */
+  YYSYMBOL_VAR_DEL_HOLDDOWN = 116,         /* VAR_DEL_HOLDDOWN  */
+  YYSYMBOL_VAR_SO_RCVBUF = 117,            /* VAR_SO_RCVBUF  */
+  YYSYMBOL_VAR_EDNS_BUFFER_SIZE = 118,     /* VAR_EDNS_BUFFER_SIZE  */
+  YYSYMBOL_VAR_PREFETCH = 119,             /* VAR_PREFETCH  */
+  YYSYMBOL_VAR_PREFETCH_KEY = 120,         /* VAR_PREFETCH_KEY  */
+  YYSYMBOL_VAR_SO_SNDBUF = 121,            /* VAR_SO_SNDBUF  */
+  YYSYMBOL_VAR_SO_REUSEPORT = 122,         /* VAR_SO_REUSEPORT  */
+  YYSYMBOL_VAR_HARDEN_BELOW_NXDOMAIN = 123, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+  YYSYMBOL_VAR_IGNORE_CD_FLAG = 124,       /* VAR_IGNORE_CD_FLAG  */
+  YYSYMBOL_VAR_LOG_QUERIES = 125,          /* VAR_LOG_QUERIES  */
+  YYSYMBOL_VAR_LOG_REPLIES = 126,          /* VAR_LOG_REPLIES  */
+  YYSYMBOL_VAR_TCP_UPSTREAM = 127,         /* VAR_TCP_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_UPSTREAM = 128,         /* VAR_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_SERVICE_KEY = 129,      /* VAR_SSL_SERVICE_KEY  */
+  YYSYMBOL_VAR_SSL_SERVICE_PEM = 130,      /* VAR_SSL_SERVICE_PEM  */
+  YYSYMBOL_VAR_SSL_PORT = 131,             /* VAR_SSL_PORT  */
+  YYSYMBOL_VAR_FORWARD_FIRST = 132,        /* VAR_FORWARD_FIRST  */
+  YYSYMBOL_VAR_STUB_SSL_UPSTREAM = 133,    /* VAR_STUB_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_FORWARD_SSL_UPSTREAM = 134, /* VAR_FORWARD_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_STUB_FIRST = 135,           /* VAR_STUB_FIRST  */
+  YYSYMBOL_VAR_MINIMAL_RESPONSES = 136,    /* VAR_MINIMAL_RESPONSES  */
+  YYSYMBOL_VAR_RRSET_ROUNDROBIN = 137,     /* VAR_RRSET_ROUNDROBIN  */
+  YYSYMBOL_VAR_MAX_UDP_SIZE = 138,         /* VAR_MAX_UDP_SIZE  */
+  YYSYMBOL_VAR_DELAY_CLOSE = 139,          /* VAR_DELAY_CLOSE  */
+  YYSYMBOL_VAR_UNBLOCK_LAN_ZONES = 140,    /* VAR_UNBLOCK_LAN_ZONES  */
+  YYSYMBOL_VAR_INSECURE_LAN_ZONES = 141,   /* VAR_INSECURE_LAN_ZONES  */
+  YYSYMBOL_VAR_INFRA_CACHE_MIN_RTT = 142,  /* VAR_INFRA_CACHE_MIN_RTT  */
+  YYSYMBOL_VAR_DNS64_PREFIX = 143,         /* VAR_DNS64_PREFIX  */
+  YYSYMBOL_VAR_DNS64_SYNTHALL = 144,       /* VAR_DNS64_SYNTHALL  */
+  YYSYMBOL_VAR_DNSTAP = 145,               /* VAR_DNSTAP  */
+  YYSYMBOL_VAR_DNSTAP_ENABLE = 146,        /* VAR_DNSTAP_ENABLE  */
+  YYSYMBOL_VAR_DNSTAP_SOCKET_PATH = 147,   /* VAR_DNSTAP_SOCKET_PATH  */
+  YYSYMBOL_VAR_DNSTAP_SEND_IDENTITY = 148, /* VAR_DNSTAP_SEND_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_SEND_VERSION = 149,  /* VAR_DNSTAP_SEND_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_IDENTITY = 150,      /* VAR_DNSTAP_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_VERSION = 151,       /* VAR_DNSTAP_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 152, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 153, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 154, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 155, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 156, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 157, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_HARDEN_ALGO_DOWNGRADE = 158, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+  YYSYMBOL_VAR_IP_TRANSPARENT = 159,       /* VAR_IP_TRANSPARENT  */
+  YYSYMBOL_VAR_DISABLE_DNSSEC_LAME_CHECK = 160, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
+  YYSYMBOL_VAR_IP_RATELIMIT = 161,         /* VAR_IP_RATELIMIT  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SLABS = 162,   /* VAR_IP_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SIZE = 163,    /* VAR_IP_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT = 164,            /* VAR_RATELIMIT  */
+  YYSYMBOL_VAR_RATELIMIT_SLABS = 165,      /* VAR_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_RATELIMIT_SIZE = 166,       /* VAR_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT_FOR_DOMAIN = 167, /* VAR_RATELIMIT_FOR_DOMAIN  */
+  YYSYMBOL_VAR_RATELIMIT_BELOW_DOMAIN = 168, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+  YYSYMBOL_VAR_IP_RATELIMIT_FACTOR = 169,  /* VAR_IP_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_RATELIMIT_FACTOR = 170,     /* VAR_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_CAPS_WHITELIST = 171,       /* VAR_CAPS_WHITELIST  */
+  YYSYMBOL_VAR_CACHE_MAX_NEGATIVE_TTL = 172, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+  YYSYMBOL_VAR_PERMIT_SMALL_HOLDDOWN = 173, /* VAR_PERMIT_SMALL_HOLDDOWN  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION = 174,   /* VAR_QNAME_MINIMISATION  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION_STRICT = 175, /* VAR_QNAME_MINIMISATION_STRICT  */
+  YYSYMBOL_VAR_IP_FREEBIND = 176,          /* VAR_IP_FREEBIND  */
+  YYSYMBOL_VAR_DEFINE_TAG = 177,           /* VAR_DEFINE_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_TAG = 178,       /* VAR_LOCAL_ZONE_TAG  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG = 179,   /* VAR_ACCESS_CONTROL_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_OVERRIDE = 180,  /* VAR_LOCAL_ZONE_OVERRIDE  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_ACTION = 181, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_DATA = 182, /* VAR_ACCESS_CONTROL_TAG_DATA  */
+  YYSYMBOL_VAR_VIEW = 183,                 /* VAR_VIEW  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_VIEW = 184,  /* VAR_ACCESS_CONTROL_VIEW  */
+  YYSYMBOL_VAR_VIEW_FIRST = 185,           /* VAR_VIEW_FIRST  */
+  YYSYMBOL_VAR_SERVE_EXPIRED = 186,        /* VAR_SERVE_EXPIRED  */
+  YYSYMBOL_VAR_FAKE_DSA = 187,             /* VAR_FAKE_DSA  */
+  YYSYMBOL_VAR_LOG_IDENTITY = 188,         /* VAR_LOG_IDENTITY  */
+  YYSYMBOL_VAR_USE_SYSTEMD = 189,          /* VAR_USE_SYSTEMD  */
+  YYSYMBOL_VAR_HEDGE_PERCENTILE = 190,     /* VAR_HEDGE_PERCENTILE  */
+  YYSYMBOL_VAR_HEDGE_BUDGET = 191,         /* VAR_HEDGE_BUDGET  */
+  YYSYMBOL_VAR_TARGET_FETCH_PARALLEL = 192, /* VAR_TARGET_FETCH_PARALLEL  */
+  YYSYMBOL_VAR_METRICS_ENABLE = 193,       /* VAR_METRICS_ENABLE  */
+  YYSYMBOL_VAR_METRICS_INTERFACE = 194,    /* VAR_METRICS_INTERFACE  */
+  YYSYMBOL_VAR_METRICS_PORT = 195,         /* VAR_METRICS_PORT  */
+  YYSYMBOL_VAR_MESH_CLIENT_QUOTA = 196,    /* VAR_MESH_CLIENT_QUOTA  */
+  YYSYMBOL_VAR_MESH_ZONE_QUOTA = 197,      /* VAR_MESH_ZONE_QUOTA  */
+  YYSYMBOL_VAR_MESH_PREFETCH_RESERVE = 198, /* VAR_MESH_PREFETCH_RESERVE  */
+  YYSYMBOL_VAR_RRL_RATELIMIT = 199,        /* VAR_RRL_RATELIMIT  */
+  YYSYMBOL_VAR_RRL_SLIP = 200,             /* VAR_RRL_SLIP  */
+  YYSYMBOL_VAR_RRL_SIZE = 201,             /* VAR_RRL_SIZE  */
+  YYSYMBOL_VAR_RRL_SLABS = 202,            /* VAR_RRL_SLABS  */
+  YYSYMBOL_VAR_OUTGOING_UDP_POOL = 203,    /* VAR_OUTGOING_UDP_POOL  */
+  YYSYMBOL_VAR_OUTGOING_UDP_POOL_ROTATE = 204, /* VAR_OUTGOING_UDP_POOL_ROTATE  */
+  YYSYMBOL_VAR_OUTGOING_UDP_POOL_USES = 205, /* VAR_OUTGOING_UDP_POOL_USES  */
+  YYSYMBOL_VAR_NSEC3_HASH_CACHE_SIZE = 206, /* VAR_NSEC3_HASH_CACHE_SIZE  */
+  YYSYMBOL_VAR_DYNLIB = 207,               /* VAR_DYNLIB  */
+  YYSYMBOL_VAR_DYNLIB_FILE = 208,          /* VAR_DYNLIB_FILE  */
+  YYSYMBOL_VAR_LOG_ASYNC = 209,            /* VAR_LOG_ASYNC  */
+  YYSYMBOL_VAR_LOG_ASYNC_SIZE = 210,       /* VAR_LOG_ASYNC_SIZE  */
+  YYSYMBOL_VAR_LOG_BINARY_FILE = 211,      /* VAR_LOG_BINARY_FILE  */
+  YYSYMBOL_YYACCEPT = 212,                 /* $accept  */
+  YYSYMBOL_toplevelvars = 213,             /* toplevelvars  */
+  YYSYMBOL_toplevelvar = 214,              /* toplevelvar  */
+  YYSYMBOL_serverstart = 215,              /* serverstart  */
+  YYSYMBOL_contents_server = 216,          /* contents_server  */
+  YYSYMBOL_content_server = 217,           /* content_server  */
+  YYSYMBOL_stubstart = 218,                /* stubstart  */
+  YYSYMBOL_contents_stub = 219,            /* contents_stub  */
+  YYSYMBOL_content_stub = 220,             /* content_stub  */
+  YYSYMBOL_forwardstart = 221,             /* forwardstart  */
+  YYSYMBOL_contents_forward = 222,         /* contents_forward  */
+  YYSYMBOL_content_forward = 223,          /* content_forward  */
+  YYSYMBOL_viewstart = 224,                /* viewstart  */
+  YYSYMBOL_contents_view = 225,            /* contents_view  */
+  YYSYMBOL_content_view = 226,             /* content_view  */
+  YYSYMBOL_server_num_threads = 227,       /* server_num_threads  */
+  YYSYMBOL_server_verbosity = 228,         /* server_verbosity  */
+  YYSYMBOL_server_statistics_interval = 229, /* server_statistics_interval  */
+  YYSYMBOL_server_statistics_cumulative = 230, /* server_statistics_cumulative  */
+  YYSYMBOL_server_extended_statistics = 231, /* server_extended_statistics  */
+  YYSYMBOL_server_port = 232,              /* server_port  */
+  YYSYMBOL_server_interface = 233,         /* server_interface  */
+  YYSYMBOL_server_outgoing_interface = 234, /* server_outgoing_interface  */
+  YYSYMBOL_server_outgoing_range = 235,    /* server_outgoing_range  */
+  YYSYMBOL_server_outgoing_port_permit = 236, /* server_outgoing_port_permit  */
+  YYSYMBOL_server_outgoing_port_avoid = 237, /* server_outgoing_port_avoid  */
+  YYSYMBOL_server_outgoing_num_tcp = 238,  /* server_outgoing_num_tcp  */
+  YYSYMBOL_server_incoming_num_tcp = 239,  /* server_incoming_num_tcp  */
+  YYSYMBOL_server_interface_automatic = 240, /* server_interface_automatic  */
+  YYSYMBOL_server_do_ip4 = 241,            /* server_do_ip4  */
+  YYSYMBOL_server_do_ip6 = 242,            /* server_do_ip6  */
+  YYSYMBOL_server_do_udp = 243,            /* server_do_udp  */
+  YYSYMBOL_server_do_tcp = 244,            /* server_do_tcp  */
+  YYSYMBOL_server_prefer_ip6 = 245,        /* server_prefer_ip6  */
+  YYSYMBOL_server_tcp_mss = 246,           /* server_tcp_mss  */
+  YYSYMBOL_server_outgoing_tcp_mss = 247,  /* server_outgoing_tcp_mss  */
+  YYSYMBOL_server_tcp_upstream = 248,      /* server_tcp_upstream  */
+  YYSYMBOL_server_ssl_upstream = 249,      /* server_ssl_upstream  */
+  YYSYMBOL_server_ssl_service_key = 250,   /* server_ssl_service_key  */
+  YYSYMBOL_server_ssl_service_pem = 251,   /* server_ssl_service_pem  */
+  YYSYMBOL_server_ssl_port = 252,          /* server_ssl_port  */
+  YYSYMBOL_server_use_systemd = 253,       /* server_use_systemd  */
+  YYSYMBOL_server_do_daemonize = 254,      /* server_do_daemonize  */
+  YYSYMBOL_server_use_syslog = 255,        /* server_use_syslog  */
+  YYSYMBOL_server_log_time_ascii = 256,    /* server_log_time_ascii  */
+  YYSYMBOL_server_log_queries = 257,       /* server_log_queries  */
+  YYSYMBOL_server_log_replies = 258,       /* server_log_replies  */
+  YYSYMBOL_server_log_async = 259,         /* server_log_async  */
+  YYSYMBOL_server_log_async_size = 260,    /* server_log_async_size  */
+  YYSYMBOL_server_log_binary_file = 261,   /* server_log_binary_file  */
+  YYSYMBOL_server_chroot = 262,            /* server_chroot  */
+  YYSYMBOL_server_username = 263,          /* server_username  */
+  YYSYMBOL_server_directory = 264,         /* server_directory  */
+  YYSYMBOL_server_logfile = 265,           /* server_logfile  */
+  YYSYMBOL_server_pidfile = 266,           /* server_pidfile  */
+  YYSYMBOL_server_root_hints = 267,        /* server_root_hints  */
+  YYSYMBOL_server_dlv_anchor_file = 268,   /* server_dlv_anchor_file  */
+  YYSYMBOL_server_dlv_anchor = 269,        /* server_dlv_anchor  */
+  YYSYMBOL_server_auto_trust_anchor_file = 270, /* server_auto_trust_anchor_file  */
+  YYSYMBOL_server_trust_anchor_file = 271, /* server_trust_anchor_file  */
+  YYSYMBOL_server_trusted_keys_file = 272, /* server_trusted_keys_file  */
+  YYSYMBOL_server_trust_anchor = 273,      /* server_trust_anchor  */
+  YYSYMBOL_server_domain_insecure = 274,   /* server_domain_insecure  */
+  YYSYMBOL_server_hide_identity = 275,     /* server_hide_identity  */
+  YYSYMBOL_server_hide_version = 276,      /* server_hide_version  */
+  YYSYMBOL_server_identity = 277,          /* server_identity  */
+  YYSYMBOL_server_version = 278,           /* server_version  */
+  YYSYMBOL_server_so_rcvbuf = 279,         /* server_so_rcvbuf  */
+  YYSYMBOL_server_so_sndbuf = 280,         /* server_so_sndbuf  */
+  YYSYMBOL_server_so_reuseport = 281,      /* server_so_reuseport  */
+  YYSYMBOL_server_ip_transparent = 282,    /* server_ip_transparent  */
+  YYSYMBOL_server_ip_freebind = 283,       /* server_ip_freebind  */
+  YYSYMBOL_server_edns_buffer_size = 284,  /* server_edns_buffer_size  */
+  YYSYMBOL_server_msg_buffer_size = 285,   /* server_msg_buffer_size  */
+  YYSYMBOL_server_msg_cache_size = 286,    /* server_msg_cache_size  */
+  YYSYMBOL_server_msg_cache_slabs = 287,   /* server_msg_cache_slabs  */
+  YYSYMBOL_server_num_queries_per_thread = 288, /* server_num_queries_per_thread  */
+  YYSYMBOL_server_jostle_timeout = 289,    /* server_jostle_timeout  */
+  YYSYMBOL_server_delay_close = 290,       /* server_delay_close  */
+  YYSYMBOL_server_outgoing_udp_pool = 291, /* server_outgoing_udp_pool  */
+  YYSYMBOL_server_outgoing_udp_pool_rotate = 292, /* server_outgoing_udp_pool_rotate  */
+  YYSYMBOL_server_outgoing_udp_pool_uses = 293, /* server_outgoing_udp_pool_uses  */
+  YYSYMBOL_server_unblock_lan_zones = 294, /* server_unblock_lan_zones  */
+  YYSYMBOL_server_insecure_lan_zones = 295, /* server_insecure_lan_zones  */
+  YYSYMBOL_server_rrset_cache_size = 296,  /* server_rrset_cache_size  */
+  YYSYMBOL_server_rrset_cache_slabs = 297, /* server_rrset_cache_slabs  */
+  YYSYMBOL_server_infra_host_ttl = 298,    /* server_infra_host_ttl  */
+  YYSYMBOL_server_infra_lame_ttl = 299,    /* server_infra_lame_ttl  */
+  YYSYMBOL_server_infra_cache_numhosts = 300, /* server_infra_cache_numhosts  */
+  YYSYMBOL_server_infra_cache_lame_size = 301, /* server_infra_cache_lame_size  */
+  YYSYMBOL_server_infra_cache_slabs = 302, /* server_infra_cache_slabs  */
+  YYSYMBOL_server_infra_cache_min_rtt = 303, /* server_infra_cache_min_rtt  */
+  YYSYMBOL_server_hedge_percentile = 304,  /* server_hedge_percentile  */
+  YYSYMBOL_server_hedge_budget = 305,      /* server_hedge_budget  */
+  YYSYMBOL_server_target_fetch_policy = 306, /* server_target_fetch_policy  */
+  YYSYMBOL_server_target_fetch_parallel = 307, /* server_target_fetch_parallel  */
+  YYSYMBOL_server_metrics_enable = 308,    /* server_metrics_enable  */
+  YYSYMBOL_server_metrics_interface = 309, /* server_metrics_interface  */
+  YYSYMBOL_server_metrics_port = 310,      /* server_metrics_port  */
+  YYSYMBOL_server_mesh_client_quota = 311, /* server_mesh_client_quota  */
+  YYSYMBOL_server_mesh_zone_quota = 312,   /* server_mesh_zone_quota  */
+  YYSYMBOL_server_mesh_prefetch_reserve = 313, /* server_mesh_prefetch_reserve  */
+  YYSYMBOL_server_harden_short_bufsize = 314, /* server_harden_short_bufsize  */
+  YYSYMBOL_server_harden_large_queries = 315, /* server_harden_large_queries  */
+  YYSYMBOL_server_harden_glue = 316,       /* server_harden_glue  */
+  YYSYMBOL_server_harden_dnssec_stripped = 317, /* server_harden_dnssec_stripped  */
+  YYSYMBOL_server_harden_below_nxdomain = 318, /* server_harden_below_nxdomain  */
+  YYSYMBOL_server_harden_referral_path = 319, /* server_harden_referral_path  */
+  YYSYMBOL_server_harden_algo_downgrade = 320, /* server_harden_algo_downgrade  */
+  YYSYMBOL_server_use_caps_for_id = 321,   /* server_use_caps_for_id  */
+  YYSYMBOL_server_caps_whitelist = 322,    /* server_caps_whitelist  */
+  YYSYMBOL_server_private_address = 323,   /* server_private_address  */
+  YYSYMBOL_server_private_domain = 324,    /* server_private_domain  */
+  YYSYMBOL_server_prefetch = 325,          /* server_prefetch  */
+  YYSYMBOL_server_prefetch_key = 326,      /* server_prefetch_key  */
+  YYSYMBOL_server_unwanted_reply_threshold = 327, /* server_unwanted_reply_threshold  */
+  YYSYMBOL_server_do_not_query_address = 328, /* server_do_not_query_address  */
+  YYSYMBOL_server_do_not_query_localhost = 329, /* server_do_not_query_localhost  */
+  YYSYMBOL_server_access_control = 330,    /* server_access_control  */
+  YYSYMBOL_server_module_conf = 331,       /* server_module_conf  */
+  YYSYMBOL_server_val_override_date = 332, /* server_val_override_date  */
+  YYSYMBOL_server_val_sig_skew_min = 333,  /* server_val_sig_skew_min  */
+  YYSYMBOL_server_val_sig_skew_max = 334,  /* server_val_sig_skew_max  */
+  YYSYMBOL_server_cache_max_ttl = 335,     /* server_cache_max_ttl  */
+  YYSYMBOL_server_cache_max_negative_ttl = 336, /* server_cache_max_negative_ttl  */
+  YYSYMBOL_server_cache_min_ttl = 337,     /* server_cache_min_ttl  */
+  YYSYMBOL_server_bogus_ttl = 338,         /* server_bogus_ttl  */
+  YYSYMBOL_server_val_clean_additional = 339, /* server_val_clean_additional  */
+  YYSYMBOL_server_val_permissive_mode = 340, /* server_val_permissive_mode  */
+  YYSYMBOL_server_ignore_cd_flag = 341,    /* server_ignore_cd_flag  */
+  YYSYMBOL_server_serve_expired = 342,     /* server_serve_expired  */
+  YYSYMBOL_server_fake_dsa = 343,          /* server_fake_dsa  */
+  YYSYMBOL_server_val_log_level = 344,     /* server_val_log_level  */
+  YYSYMBOL_server_val_nsec3_keysize_iterations = 345, /* server_val_nsec3_keysize_iterations  */
+  YYSYMBOL_server_add_holddown = 346,      /* server_add_holddown  */
+  YYSYMBOL_server_del_holddown = 347,      /* server_del_holddown  */
+  YYSYMBOL_server_keep_missing = 348,      /* server_keep_missing  */
+  YYSYMBOL_server_permit_small_holddown = 349, /* server_permit_small_holddown  */
+  YYSYMBOL_server_key_cache_size = 350,    /* server_key_cache_size  */
+  YYSYMBOL_server_key_cache_slabs = 351,   /* server_key_cache_slabs  */
+  YYSYMBOL_server_neg_cache_size = 352,    /* server_neg_cache_size  */
+  YYSYMBOL_server_nsec3_hash_cache_size = 353, /* server_nsec3_hash_cache_size  */
+  YYSYMBOL_server_local_zone = 354,        /* server_local_zone  */
+  YYSYMBOL_server_local_data = 355,        /* server_local_data  */
+  YYSYMBOL_server_local_data_ptr = 356,    /* server_local_data_ptr  */
+  YYSYMBOL_server_minimal_responses = 357, /* server_minimal_responses  */
+  YYSYMBOL_server_rrset_roundrobin = 358,  /* server_rrset_roundrobin  */
+  YYSYMBOL_server_max_udp_size = 359,      /* server_max_udp_size  */
+  YYSYMBOL_server_dns64_prefix = 360,      /* server_dns64_prefix  */
+  YYSYMBOL_server_dns64_synthall = 361,    /* server_dns64_synthall  */
+  YYSYMBOL_server_define_tag = 362,        /* server_define_tag  */
+  YYSYMBOL_server_local_zone_tag = 363,    /* server_local_zone_tag  */
+  YYSYMBOL_server_access_control_tag = 364, /* server_access_control_tag  */
+  YYSYMBOL_server_access_control_tag_action = 365, /* server_access_control_tag_action  */
+  YYSYMBOL_server_access_control_tag_data = 366, /* server_access_control_tag_data  */
+  YYSYMBOL_server_local_zone_override = 367, /* server_local_zone_override  */
+  YYSYMBOL_server_access_control_view = 368, /* server_access_control_view  */
+  YYSYMBOL_server_ip_ratelimit = 369,      /* server_ip_ratelimit  */
+  YYSYMBOL_server_ratelimit = 370,         /* server_ratelimit  */
+  YYSYMBOL_server_ip_ratelimit_size = 371, /* server_ip_ratelimit_size  */
+  YYSYMBOL_server_ratelimit_size = 372,    /* server_ratelimit_size  */
+  YYSYMBOL_server_ip_ratelimit_slabs = 373, /* server_ip_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_slabs = 374,   /* server_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_for_domain = 375, /* server_ratelimit_for_domain  */
+  YYSYMBOL_server_ratelimit_below_domain = 376, /* server_ratelimit_below_domain  */
+  YYSYMBOL_server_ip_ratelimit_factor = 377, /* server_ip_ratelimit_factor  */
+  YYSYMBOL_server_rrl_ratelimit = 378,     /* server_rrl_ratelimit  */
+  YYSYMBOL_server_rrl_slip = 379,          /* server_rrl_slip  */
+  YYSYMBOL_server_rrl_size = 380,          /* server_rrl_size  */
+  YYSYMBOL_server_rrl_slabs = 381,         /* server_rrl_slabs  */
+  YYSYMBOL_server_ratelimit_factor = 382,  /* server_ratelimit_factor  */
+  YYSYMBOL_server_qname_minimisation = 383, /* server_qname_minimisation  */
+  YYSYMBOL_server_qname_minimisation_strict = 384, /* server_qname_minimisation_strict  */
+  YYSYMBOL_stub_name = 385,                /* stub_name  */
+  YYSYMBOL_stub_host = 386,                /* stub_host  */
+  YYSYMBOL_stub_addr = 387,                /* stub_addr  */
+  YYSYMBOL_stub_first = 388,               /* stub_first  */
+  YYSYMBOL_stub_ssl_upstream = 389,        /* stub_ssl_upstream  */
+  YYSYMBOL_stub_prime = 390,               /* stub_prime  */
+  YYSYMBOL_forward_name = 391,             /* forward_name  */
+  YYSYMBOL_forward_host = 392,             /* forward_host  */
+  YYSYMBOL_forward_addr = 393,             /* forward_addr  */
+  YYSYMBOL_forward_first = 394,            /* forward_first  */
+  YYSYMBOL_forward_ssl_upstream = 395,     /* forward_ssl_upstream  */
+  YYSYMBOL_view_name = 396,                /* view_name  */
+  YYSYMBOL_view_local_zone = 397,          /* view_local_zone  */
+  YYSYMBOL_view_local_data = 398,          /* view_local_data  */
+  YYSYMBOL_view_first = 399,               /* view_first  */
+  YYSYMBOL_rcstart = 400,                  /* rcstart  */
+  YYSYMBOL_contents_rc = 401,              /* contents_rc  */
+  YYSYMBOL_content_rc = 402,               /* content_rc  */
+  YYSYMBOL_rc_control_enable = 403,        /* rc_control_enable  */
+  YYSYMBOL_rc_control_port = 404,          /* rc_control_port  */
+  YYSYMBOL_rc_control_interface = 405,     /* rc_control_interface  */
+  YYSYMBOL_rc_control_use_cert = 406,      /* rc_control_use_cert  */
+  YYSYMBOL_rc_server_key_file = 407,       /* rc_server_key_file  */
+  YYSYMBOL_rc_server_cert_file = 408,      /* rc_server_cert_file  */
+  YYSYMBOL_rc_control_key_file = 409,      /* rc_control_key_file  */
+  YYSYMBOL_rc_control_cert_file = 410,     /* rc_control_cert_file  */
+  YYSYMBOL_dtstart = 411,                  /* dtstart  */
+  YYSYMBOL_contents_dt = 412,              /* contents_dt  */
+  YYSYMBOL_content_dt = 413,               /* content_dt  */
+  YYSYMBOL_dt_dnstap_enable = 414,         /* dt_dnstap_enable  */
+  YYSYMBOL_dt_dnstap_socket_path = 415,    /* dt_dnstap_socket_path  */
+  YYSYMBOL_dt_dnstap_send_identity = 416,  /* dt_dnstap_send_identity  */
+  YYSYMBOL_dt_dnstap_send_version = 417,   /* dt_dnstap_send_version  */
+  YYSYMBOL_dt_dnstap_identity = 418,       /* dt_dnstap_identity  */
+  YYSYMBOL_dt_dnstap_version = 419,        /* dt_dnstap_version  */
+  YYSYMBOL_dt_dnstap_log_resolver_query_messages = 420, /* dt_dnstap_log_resolver_query_messages  */
+  YYSYMBOL_dt_dnstap_log_resolver_response_messages = 421, /* dt_dnstap_log_resolver_response_messages  */
+  YYSYMBOL_dt_dnstap_log_client_query_messages = 422, /* dt_dnstap_log_client_query_messages  */
+  YYSYMBOL_dt_dnstap_log_client_response_messages = 423, /* dt_dnstap_log_client_response_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_query_messages = 424, /* dt_dnstap_log_forwarder_query_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_response_messages = 425, /* dt_dnstap_log_forwarder_response_messages  */
+  YYSYMBOL_pythonstart = 426,              /* pythonstart  */
+  YYSYMBOL_contents_py = 427,              /* contents_py  */
+  YYSYMBOL_content_py = 428,               /* content_py  */
+  YYSYMBOL_py_script = 429,                /* py_script  */
+  YYSYMBOL_dynlibstart = 430,              /* dynlibstart  */
+  YYSYMBOL_contents_dl = 431,              /* contents_dl  */
+  YYSYMBOL_content_dl = 432,               /* content_dl  */
+  YYSYMBOL_dl_file = 433,                  /* dl_file  */
+  YYSYMBOL_server_disable_dnssec_lame_check = 434, /* server_disable_dnssec_lame_check  */
+  YYSYMBOL_server_log_identity = 435       /* server_log_identity  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
 
-extern YYSTYPE yylval;
 
-int yyparse (void);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-#line 532 "util/configparser.c" /* yacc.c:358  */
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -563,15 +656,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -585,47 +691,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -638,8 +740,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -704,8 +820,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -714,17 +829,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -737,11 +852,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -753,12 +868,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -770,27 +885,30 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   375
+#define YYLAST   418
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  190
+#define YYNTOKENS  212
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  200
+#define YYNNTS  224
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  383
+#define YYNRULES  429
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  574
+#define YYNSTATES  641
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   466
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   444
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
+   as returned by yylex.  */
 static const yytype_uint8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -837,66 +955,80 @@ static const yytype_uint8 yytranslate[] =
      155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
      165,   166,   167,   168,   169,   170,   171,   172,   173,   174,
      175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
-     185,   186,   187,   188,   189
+     185,   186,   187,   188,   189,   190,   191,   192,   193,   194,
+     195,   196,   197,   198,   199,   200,   201,   202,   203,   204,
+     205,   206,   207,   208,   209,   210,   211
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   141,   141,   141,   142,   142,   143,   143,   144,   144,
-     144,   149,   154,   155,   156,   156,   156,   157,   157,   158,
-     158,   159,   159,   160,   160,   161,   161,   161,   162,   162,
-     162,   163,   163,   164,   164,   165,   165,   166,   166,   167,
-     167,   168,   168,   169,   169,   170,   170,   171,   171,   171,
-     172,   172,   172,   173,   173,   173,   174,   174,   175,   175,
-     176,   176,   177,   177,   178,   178,   178,   179,   179,   180,
-     180,   181,   181,   181,   182,   182,   183,   183,   184,   184,
-     185,   185,   185,   186,   186,   187,   187,   188,   188,   189,
-     189,   190,   190,   191,   191,   191,   192,   192,   193,   193,
-     193,   194,   194,   194,   195,   195,   195,   196,   196,   196,
-     196,   197,   197,   197,   198,   198,   198,   199,   199,   200,
-     200,   201,   201,   202,   202,   203,   203,   203,   204,   204,
-     205,   205,   206,   207,   207,   208,   209,   209,   210,   210,
-     211,   211,   211,   212,   212,   213,   213,   214,   214,   215,
-     215,   216,   216,   216,   218,   230,   231,   232,   232,   232,
-     232,   232,   233,   235,   247,   248,   249,   249,   249,   249,
-     250,   252,   266,   267,   268,   268,   268,   268,   270,   279,
-     288,   299,   308,   317,   326,   339,   354,   363,   372,   381,
-     390,   399,   408,   417,   426,   435,   444,   453,   462,   471,
-     480,   489,   496,   503,   512,   521,   530,   544,   553,   562,
-     571,   578,   585,   611,   619,   626,   633,   640,   647,   655,
-     663,   671,   678,   685,   694,   703,   710,   717,   725,   733,
-     743,   753,   763,   776,   787,   795,   808,   817,   826,   835,
-     845,   855,   863,   876,   885,   893,   902,   910,   923,   932,
-     939,   949,   959,   969,   979,   989,   999,  1009,  1019,  1026,
-    1033,  1040,  1049,  1058,  1067,  1074,  1084,  1101,  1108,  1126,
-    1139,  1152,  1161,  1170,  1179,  1188,  1198,  1208,  1217,  1226,
-    1239,  1248,  1255,  1264,  1273,  1282,  1291,  1299,  1312,  1320,
-    1348,  1355,  1370,  1380,  1390,  1397,  1404,  1413,  1427,  1446,
-    1465,  1477,  1489,  1501,  1512,  1522,  1531,  1539,  1547,  1560,
-    1573,  1586,  1599,  1608,  1617,  1627,  1637,  1647,  1654,  1661,
-    1670,  1680,  1690,  1700,  1707,  1714,  1723,  1733,  1743,  1772,
-    1781,  1790,  1795,  1796,  1797,  1797,  1797,  1798,  1798,  1798,
-    1799,  1799,  1801,  1811,  1820,  1827,  1837,  1844,  1851,  1858,
-    1865,  1870,  1871,  1872,  1872,  1873,  1873,  1874,  1874,  1875,
-    1876,  1877,  1878,  1879,  1880,  1882,  1890,  1897,  1905,  1913,
-    1920,  1927,  1936,  1945,  1954,  1963,  1972,  1981,  1986,  1987,
-    1988,  1990,  1996,  2006
+       0,   149,   149,   149,   150,   150,   151,   151,   152,   152,
+     152,   153,   157,   162,   163,   164,   164,   164,   165,   165,
+     166,   166,   167,   167,   168,   168,   169,   169,   169,   170,
+     170,   170,   171,   171,   172,   172,   173,   173,   174,   174,
+     175,   175,   176,   176,   177,   177,   178,   178,   179,   179,
+     179,   180,   180,   180,   181,   181,   181,   182,   182,   183,
+     183,   184,   184,   185,   185,   186,   186,   186,   187,   187,
+     188,   188,   189,   189,   189,   190,   190,   191,   191,   192,
+     192,   193,   193,   193,   194,   194,   195,   195,   196,   196,
+     197,   197,   198,   198,   199,   199,   199,   200,   200,   201,
+     201,   201,   202,   202,   202,   203,   203,   203,   204,   204,
+     204,   204,   205,   205,   205,   206,   206,   206,   207,   207,
+     208,   208,   209,   209,   210,   210,   211,   211,   211,   212,
+     212,   213,   213,   214,   215,   215,   216,   217,   217,   218,
+     218,   219,   219,   219,   220,   220,   221,   221,   222,   222,
+     223,   223,   224,   224,   224,   225,   225,   226,   226,   227,
+     227,   228,   228,   229,   229,   230,   230,   230,   231,   231,
+     232,   233,   233,   234,   234,   236,   248,   249,   250,   250,
+     250,   250,   250,   251,   253,   265,   266,   267,   267,   267,
+     267,   268,   270,   284,   285,   286,   286,   286,   286,   288,
+     299,   308,   319,   328,   337,   346,   359,   374,   383,   392,
+     401,   410,   419,   428,   437,   446,   455,   464,   473,   482,
+     491,   500,   509,   516,   523,   532,   541,   550,   564,   573,
+     582,   591,   600,   609,   616,   623,   630,   656,   664,   671,
+     678,   685,   692,   700,   708,   716,   723,   730,   739,   748,
+     755,   762,   770,   778,   788,   798,   808,   821,   832,   840,
+     853,   862,   871,   880,   889,   898,   907,   917,   927,   935,
+     948,   957,   965,   974,   982,   995,  1004,  1015,  1026,  1033,
+    1043,  1053,  1060,  1069,  1078,  1087,  1096,  1106,  1116,  1126,
+    1136,  1146,  1156,  1166,  1176,  1183,  1190,  1197,  1206,  1215,
+    1224,  1231,  1241,  1258,  1265,  1283,  1296,  1309,  1318,  1327,
+    1336,  1345,  1355,  1365,  1374,  1383,  1396,  1405,  1412,  1421,
+    1430,  1439,  1448,  1456,  1469,  1477,  1486,  1514,  1521,  1536,
+    1546,  1556,  1563,  1570,  1579,  1593,  1612,  1631,  1643,  1655,
+    1667,  1678,  1688,  1697,  1705,  1713,  1726,  1739,  1752,  1765,
+    1774,  1783,  1792,  1800,  1813,  1822,  1832,  1842,  1852,  1859,
+    1866,  1875,  1885,  1895,  1905,  1912,  1919,  1928,  1938,  1948,
+    1977,  1986,  1995,  2000,  2001,  2002,  2002,  2002,  2003,  2003,
+    2003,  2004,  2004,  2006,  2016,  2025,  2032,  2042,  2049,  2056,
+    2063,  2070,  2075,  2076,  2077,  2077,  2078,  2078,  2079,  2079,
+    2080,  2081,  2082,  2083,  2084,  2085,  2087,  2095,  2102,  2110,
+    2118,  2125,  2132,  2141,  2150,  2159,  2168,  2177,  2186,  2191,
+    2192,  2193,  2195,  2201,  2206,  2207,  2208,  2210,  2216,  2226
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "SPACE", "LETTER", "NEWLINE", "COMMENT",
-  "COLON", "ANY", "ZONESTR", "STRING_ARG", "VAR_SERVER", "VAR_VERBOSITY",
-  "VAR_NUM_THREADS", "VAR_PORT", "VAR_OUTGOING_RANGE", "VAR_INTERFACE",
-  "VAR_DO_IP4", "VAR_DO_IP6", "VAR_PREFER_IP6", "VAR_DO_UDP", "VAR_DO_TCP",
-  "VAR_TCP_MSS", "VAR_OUTGOING_TCP_MSS", "VAR_CHROOT", "VAR_USERNAME",
-  "VAR_DIRECTORY", "VAR_LOGFILE", "VAR_PIDFILE", "VAR_MSG_CACHE_SIZE",
+  "\"end of file\"", "error", "\"invalid token\"", "SPACE", "LETTER",
+  "NEWLINE", "COMMENT", "COLON", "ANY", "ZONESTR", "STRING_ARG",
+  "VAR_SERVER", "VAR_VERBOSITY", "VAR_NUM_THREADS", "VAR_PORT",
+  "VAR_OUTGOING_RANGE", "VAR_INTERFACE", "VAR_DO_IP4", "VAR_DO_IP6",
+  "VAR_PREFER_IP6", "VAR_DO_UDP", "VAR_DO_TCP", "VAR_TCP_MSS",
+  "VAR_OUTGOING_TCP_MSS", "VAR_CHROOT", "VAR_USERNAME", "VAR_DIRECTORY",
+  "VAR_LOGFILE", "VAR_PIDFILE", "VAR_MSG_CACHE_SIZE",
   "VAR_MSG_CACHE_SLABS", "VAR_NUM_QUERIES_PER_THREAD",
   "VAR_RRSET_CACHE_SIZE", "VAR_RRSET_CACHE_SLABS", "VAR_OUTGOING_NUM_TCP",
   "VAR_INFRA_HOST_TTL", "VAR_INFRA_LAME_TTL", "VAR_INFRA_CACHE_SLABS",
@@ -958,11 +1090,19 @@ static const char *const yytname[] =
   "VAR_ACCESS_CONTROL_TAG_ACTION", "VAR_ACCESS_CONTROL_TAG_DATA",
   "VAR_VIEW", "VAR_ACCESS_CONTROL_VIEW", "VAR_VIEW_FIRST",
   "VAR_SERVE_EXPIRED", "VAR_FAKE_DSA", "VAR_LOG_IDENTITY",
-  "VAR_USE_SYSTEMD", "$accept", "toplevelvars", "toplevelvar",
-  "serverstart", "contents_server", "content_server", "stubstart",
-  "contents_stub", "content_stub", "forwardstart", "contents_forward",
-  "content_forward", "viewstart", "contents_view", "content_view",
-  "server_num_threads", "server_verbosity", "server_statistics_interval",
+  "VAR_USE_SYSTEMD", "VAR_HEDGE_PERCENTILE", "VAR_HEDGE_BUDGET",
+  "VAR_TARGET_FETCH_PARALLEL", "VAR_METRICS_ENABLE",
+  "VAR_METRICS_INTERFACE", "VAR_METRICS_PORT", "VAR_MESH_CLIENT_QUOTA",
+  "VAR_MESH_ZONE_QUOTA", "VAR_MESH_PREFETCH_RESERVE", "VAR_RRL_RATELIMIT",
+  "VAR_RRL_SLIP", "VAR_RRL_SIZE", "VAR_RRL_SLABS", "VAR_OUTGOING_UDP_POOL",
+  "VAR_OUTGOING_UDP_POOL_ROTATE", "VAR_OUTGOING_UDP_POOL_USES",
+  "VAR_NSEC3_HASH_CACHE_SIZE", "VAR_DYNLIB", "VAR_DYNLIB_FILE",
+  "VAR_LOG_ASYNC", "VAR_LOG_ASYNC_SIZE", "VAR_LOG_BINARY_FILE", "$accept",
+  "toplevelvars", "toplevelvar", "serverstart", "contents_server",
+  "content_server", "stubstart", "contents_stub", "content_stub",
+  "forwardstart", "contents_forward", "content_forward", "viewstart",
+  "contents_view", "content_view", "server_num_threads",
+  "server_verbosity", "server_statistics_interval",
   "server_statistics_cumulative", "server_extended_statistics",
   "server_port", "server_interface", "server_outgoing_interface",
   "server_outgoing_range", "server_outgoing_port_permit",
@@ -973,7 +1113,8 @@ static const char *const yytname[] =
   "server_ssl_upstream", "server_ssl_service_key",
   "server_ssl_service_pem", "server_ssl_port", "server_use_systemd",
   "server_do_daemonize", "server_use_syslog", "server_log_time_ascii",
-  "server_log_queries", "server_log_replies", "server_chroot",
+  "server_log_queries", "server_log_replies", "server_log_async",
+  "server_log_async_size", "server_log_binary_file", "server_chroot",
   "server_username", "server_directory", "server_logfile",
   "server_pidfile", "server_root_hints", "server_dlv_anchor_file",
   "server_dlv_anchor", "server_auto_trust_anchor_file",
@@ -985,12 +1126,18 @@ static const char *const yytname[] =
   "server_msg_buffer_size", "server_msg_cache_size",
   "server_msg_cache_slabs", "server_num_queries_per_thread",
   "server_jostle_timeout", "server_delay_close",
-  "server_unblock_lan_zones", "server_insecure_lan_zones",
-  "server_rrset_cache_size", "server_rrset_cache_slabs",
-  "server_infra_host_ttl", "server_infra_lame_ttl",
-  "server_infra_cache_numhosts", "server_infra_cache_lame_size",
-  "server_infra_cache_slabs", "server_infra_cache_min_rtt",
-  "server_target_fetch_policy", "server_harden_short_bufsize",
+  "server_outgoing_udp_pool", "server_outgoing_udp_pool_rotate",
+  "server_outgoing_udp_pool_uses", "server_unblock_lan_zones",
+  "server_insecure_lan_zones", "server_rrset_cache_size",
+  "server_rrset_cache_slabs", "server_infra_host_ttl",
+  "server_infra_lame_ttl", "server_infra_cache_numhosts",
+  "server_infra_cache_lame_size", "server_infra_cache_slabs",
+  "server_infra_cache_min_rtt", "server_hedge_percentile",
+  "server_hedge_budget", "server_target_fetch_policy",
+  "server_target_fetch_parallel", "server_metrics_enable",
+  "server_metrics_interface", "server_metrics_port",
+  "server_mesh_client_quota", "server_mesh_zone_quota",
+  "server_mesh_prefetch_reserve", "server_harden_short_bufsize",
   "server_harden_large_queries", "server_harden_glue",
   "server_harden_dnssec_stripped", "server_harden_below_nxdomain",
   "server_harden_referral_path", "server_harden_algo_downgrade",
@@ -1008,8 +1155,9 @@ static const char *const yytname[] =
   "server_val_nsec3_keysize_iterations", "server_add_holddown",
   "server_del_holddown", "server_keep_missing",
   "server_permit_small_holddown", "server_key_cache_size",
-  "server_key_cache_slabs", "server_neg_cache_size", "server_local_zone",
-  "server_local_data", "server_local_data_ptr", "server_minimal_responses",
+  "server_key_cache_slabs", "server_neg_cache_size",
+  "server_nsec3_hash_cache_size", "server_local_zone", "server_local_data",
+  "server_local_data_ptr", "server_minimal_responses",
   "server_rrset_roundrobin", "server_max_udp_size", "server_dns64_prefix",
   "server_dns64_synthall", "server_define_tag", "server_local_zone_tag",
   "server_access_control_tag", "server_access_control_tag_action",
@@ -1018,7 +1166,8 @@ static const char *const yytname[] =
   "server_ip_ratelimit_size", "server_ratelimit_size",
   "server_ip_ratelimit_slabs", "server_ratelimit_slabs",
   "server_ratelimit_for_domain", "server_ratelimit_below_domain",
-  "server_ip_ratelimit_factor", "server_ratelimit_factor",
+  "server_ip_ratelimit_factor", "server_rrl_ratelimit", "server_rrl_slip",
+  "server_rrl_size", "server_rrl_slabs", "server_ratelimit_factor",
   "server_qname_minimisation", "server_qname_minimisation_strict",
   "stub_name", "stub_host", "stub_addr", "stub_first", "stub_ssl_upstream",
   "stub_prime", "forward_name", "forward_host", "forward_addr",
@@ -1036,120 +1185,107 @@ static const char *const yytname[] =
   "dt_dnstap_log_client_response_messages",
   "dt_dnstap_log_forwarder_query_messages",
   "dt_dnstap_log_forwarder_response_messages", "pythonstart",
-  "contents_py", "content_py", "py_script",
-  "server_disable_dnssec_lame_check", "server_log_identity", YY_NULLPTR
+  "contents_py", "content_py", "py_script", "dynlibstart", "contents_dl",
+  "content_dl", "dl_file", "server_disable_dnssec_lame_check",
+  "server_log_identity", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -132
+#define YYPACT_NINF (-202)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-132)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -1
+#define YYTABLE_NINF (-1)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -132,     0,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,   134,   -39,
-     -35,   -11,   -62,  -131,  -106,    -4,    -3,    -2,    -1,     2,
-      17,    18,    28,    29,    30,    32,    33,    34,    35,    36,
+    -202,     0,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+     196,   -38,   -34,   -39,   -64,  -130,  -105,  -201,    -2,    -1,
+       2,     3,    26,    29,    30,    32,    33,    34,    35,    36,
       38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    52,    53,    57,    58,    59,    60,
-      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
-      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
-      82,    83,    85,    88,    90,    91,    92,    93,    94,    95,
-      96,    98,    99,   100,   101,   102,   103,   104,   105,   106,
-     107,   108,   109,   110,   111,   112,   113,   114,   115,   116,
-     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,   129,   130,   131,   132,   133,   165,   166,   167,
-     171,   172,   215,   216,   217,   218,   219,   220,   221,   222,
-     223,   227,   231,   232,   256,   257,   258,   259,   269,   270,
-     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
-     281,   307,   309,   314,   315,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,   316,   317,   318,   319,
-     320,   321,  -132,  -132,  -132,  -132,  -132,  -132,  -132,   322,
-     323,   324,   325,   326,  -132,  -132,  -132,  -132,  -132,  -132,
-     327,   328,   329,   330,  -132,  -132,  -132,  -132,  -132,   331,
-     332,   333,   334,   335,   336,   337,   338,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,   339,   340,   341,   342,
-     343,   344,   345,   346,   347,   348,   349,   350,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,   351,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-     352,   353,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,   354,   355,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,   356,   357,   358,   359,   360,   361,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,   362,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,   363,   364,   365,  -132,
-    -132,  -132,  -132,  -132
+      48,    49,    50,    51,    52,    53,    54,    56,    57,    58,
+      59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
+      79,    80,    82,    83,    84,    86,    89,    91,    92,    93,
+      94,    95,    96,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     137,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   158,   159,   160,   161,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   172,   174,   175,   176,   177,
+     178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
+     188,   189,   190,   191,   192,   193,   194,   195,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,   226,
+     227,   228,   229,   233,   234,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,   235,   277,   278,   279,   280,  -202,  -202,  -202,
+    -202,  -202,  -202,   281,   282,   283,   284,  -202,  -202,  -202,
+    -202,  -202,   285,   289,   293,   294,   318,   319,   320,   321,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,   331,
+     332,   333,   334,   335,   336,   337,   338,   339,   340,   341,
+     342,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,   343,  -202,  -202,   369,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,   371,   393,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,   394,
+     398,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+     399,   400,   401,   402,   403,   404,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,   405,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,   406,   407,   408,  -202,  -202,  -202,  -202,
+    -202
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
 {
-       2,     0,     1,    11,   154,   163,   331,   377,   350,   171,
-       3,    13,   156,   165,   173,   333,   352,   379,     4,     5,
-       6,    10,     8,     9,     7,     0,     0,     0,     0,     0,
+       2,     0,     1,    12,   175,   184,   372,   418,   391,   192,
+     423,     3,    14,   177,   186,   194,   374,   393,   420,   425,
+       4,     5,     6,    10,     8,     9,     7,    11,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -1163,230 +1299,258 @@ static const yytype_uint16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    12,    14,    15,    74,    77,
-      86,    16,    25,    65,    17,    78,    79,    36,    58,    73,
-      18,    19,    21,    22,    20,    23,    24,   109,   110,   111,
-     112,   113,   153,    75,    64,    90,   107,   108,    26,    27,
-      28,    29,    30,    66,    80,    81,    96,    52,    62,    53,
-      91,    46,    47,    48,    49,   100,   104,   117,   125,   140,
-     101,    59,    31,    32,    33,    88,   118,   119,   120,    34,
-      35,    37,    38,    40,    41,    39,   123,    42,    43,    44,
-      50,    69,   105,    83,   124,    76,   136,    84,    85,   102,
-     103,    89,    45,    67,    70,    51,    54,    92,    93,    68,
-     137,    94,    55,    56,    57,   106,   150,   151,    95,    63,
-      97,    98,    99,   138,    60,    61,    82,    71,    72,    87,
-     114,   115,   116,   121,   122,   141,   142,   144,   146,   147,
-     145,   148,   126,   127,   130,   131,   128,   129,   132,   133,
-     135,   134,   139,   149,   143,   152,     0,     0,     0,     0,
-       0,     0,   155,   157,   158,   159,   161,   162,   160,     0,
-       0,     0,     0,     0,   164,   166,   167,   168,   169,   170,
-       0,     0,     0,     0,   172,   174,   175,   176,   177,     0,
-       0,     0,     0,     0,     0,     0,     0,   332,   334,   336,
-     335,   341,   337,   338,   339,   340,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   351,   353,
-     354,   355,   356,   357,   358,   359,   360,   361,   362,   363,
-     364,     0,   378,   380,   179,   178,   183,   186,   184,   192,
-     193,   196,   194,   195,   197,   198,   210,   211,   212,   213,
-     214,   234,   235,   236,   241,   242,   189,   243,   244,   247,
-     245,   246,   249,   250,   251,   264,   223,   224,   225,   226,
-     252,   267,   219,   221,   268,   274,   275,   276,   190,   233,
-     286,   287,   220,   281,   206,   185,   215,   265,   271,   253,
-       0,     0,   290,   191,   180,   205,   257,   181,   187,   188,
-     216,   217,   288,   255,   259,   260,   182,   291,   237,   263,
-     207,   222,   269,   270,   273,   280,   218,   284,   282,   283,
-     227,   232,   261,   262,   228,   229,   254,   277,   208,   209,
-     199,   200,   201,   202,   203,   292,   293,   294,   238,   239,
-     240,   248,   295,   296,   256,   230,   382,   304,   308,   306,
-     305,   309,   307,     0,     0,   312,   313,   258,   272,   285,
-     314,   315,   231,   297,     0,     0,     0,     0,     0,     0,
-     278,   279,   383,   204,   316,   317,   318,   321,   320,   319,
-     322,   323,   324,   325,   326,   327,     0,   329,   330,   342,
-     344,   343,   346,   347,   348,   349,   345,   365,   366,   367,
-     368,   369,   370,   371,   372,   373,   374,   375,   376,   381,
-     266,   289,   310,   311,   298,   299,     0,     0,     0,   303,
-     328,   302,   300,   301
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    13,    15,
+      16,    75,    78,    87,    17,    26,    66,    18,    79,    80,
+      37,    59,    74,    19,    20,    22,    23,    21,    24,    25,
+     110,   111,   112,   113,   114,   154,    76,    65,    91,   108,
+     109,   172,   173,   174,    27,    28,    29,    30,    31,    67,
+      81,    82,    97,    53,    63,    54,    92,    47,    48,    49,
+      50,   101,   105,   118,   126,   141,   102,    60,    32,    33,
+      34,    89,   119,   168,   169,   170,   120,   121,    35,    36,
+      38,    39,    41,    42,    40,   124,   155,   156,    43,   157,
+     158,   159,   160,   161,   162,   163,    44,    45,    51,    70,
+     106,    84,   125,    77,   137,    85,    86,   103,   104,    90,
+      46,    68,    71,    52,    55,    93,    94,    69,   138,    95,
+      56,    57,    58,   107,   151,   152,    96,    64,    98,    99,
+     100,   139,    61,    62,    83,   171,    72,    73,    88,   115,
+     116,   117,   122,   123,   142,   143,   145,   147,   148,   146,
+     149,   127,   128,   131,   132,   129,   130,   133,   134,   136,
+     164,   165,   166,   167,   135,   140,   150,   144,   153,     0,
+       0,     0,     0,     0,     0,   176,   178,   179,   180,   182,
+     183,   181,     0,     0,     0,     0,     0,   185,   187,   188,
+     189,   190,   191,     0,     0,     0,     0,   193,   195,   196,
+     197,   198,     0,     0,     0,     0,     0,     0,     0,     0,
+     373,   375,   377,   376,   382,   378,   379,   380,   381,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   392,   394,   395,   396,   397,   398,   399,   400,   401,
+     402,   403,   404,   405,     0,   419,   421,     0,   424,   426,
+     200,   199,   204,   207,   205,   213,   214,   217,   215,   216,
+     218,   219,   234,   235,   236,   237,   238,   258,   259,   260,
+     268,   269,   210,   270,   271,   274,   272,   273,   278,   286,
+     287,   300,   247,   248,   249,   250,   288,   303,   243,   245,
+     304,   310,   311,   312,   211,   257,   322,   323,   244,   317,
+     227,   206,   239,   301,   307,   289,     0,     0,   327,   212,
+     201,   226,   293,   202,   208,   209,   240,   241,   324,   291,
+     295,   296,   203,   328,   261,   299,   228,   246,   305,   306,
+     309,   316,   242,   320,   318,   319,   251,   256,   297,   298,
+     252,   253,   290,   313,   229,   230,   220,   221,   222,   223,
+     224,   329,   330,   331,   262,   266,   267,   275,   332,   333,
+     292,   254,   428,   341,   345,   343,   342,   346,   344,     0,
+       0,   349,   354,   294,   308,   321,   355,   356,   255,   334,
+       0,     0,     0,     0,     0,     0,   314,   315,   429,   225,
+     276,   277,   279,   280,   281,   282,   283,   284,   285,   350,
+     351,   352,   353,   263,   264,   265,   325,   231,   232,   233,
+     357,   358,   359,   362,   361,   360,   363,   364,   365,   366,
+     367,   368,     0,   370,   371,   383,   385,   384,   387,   388,
+     389,   390,   386,   406,   407,   408,   409,   410,   411,   412,
+     413,   414,   415,   416,   417,   422,   427,   302,   326,   347,
+     348,   335,   336,     0,     0,     0,   340,   369,   339,   337,
+     338
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,
-    -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132,  -132
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,  -202,
+    -202,  -202,  -202,  -202
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,    10,    11,    18,   165,    12,    19,   312,    13,
-      20,   324,    14,    21,   334,   166,   167,   168,   169,   170,
-     171,   172,   173,   174,   175,   176,   177,   178,   179,   180,
-     181,   182,   183,   184,   185,   186,   187,   188,   189,   190,
-     191,   192,   193,   194,   195,   196,   197,   198,   199,   200,
-     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
-     221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
-     261,   262,   263,   264,   265,   266,   267,   268,   269,   270,
-     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
-     281,   282,   283,   284,   285,   286,   287,   288,   289,   290,
-     291,   292,   293,   294,   295,   296,   297,   298,   299,   300,
-     301,   302,   303,   313,   314,   315,   316,   317,   318,   325,
-     326,   327,   328,   329,   335,   336,   337,   338,    15,    22,
-     347,   348,   349,   350,   351,   352,   353,   354,   355,    16,
-      23,   368,   369,   370,   371,   372,   373,   374,   375,   376,
-     377,   378,   379,   380,    17,    24,   382,   383,   304,   305
+       0,     1,    11,    12,    20,   188,    13,    21,   355,    14,
+      22,   367,    15,    23,   377,   189,   190,   191,   192,   193,
+     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
+     204,   205,   206,   207,   208,   209,   210,   211,   212,   213,
+     214,   215,   216,   217,   218,   219,   220,   221,   222,   223,
+     224,   225,   226,   227,   228,   229,   230,   231,   232,   233,
+     234,   235,   236,   237,   238,   239,   240,   241,   242,   243,
+     244,   245,   246,   247,   248,   249,   250,   251,   252,   253,
+     254,   255,   256,   257,   258,   259,   260,   261,   262,   263,
+     264,   265,   266,   267,   268,   269,   270,   271,   272,   273,
+     274,   275,   276,   277,   278,   279,   280,   281,   282,   283,
+     284,   285,   286,   287,   288,   289,   290,   291,   292,   293,
+     294,   295,   296,   297,   298,   299,   300,   301,   302,   303,
+     304,   305,   306,   307,   308,   309,   310,   311,   312,   313,
+     314,   315,   316,   317,   318,   319,   320,   321,   322,   323,
+     324,   325,   326,   327,   328,   329,   330,   331,   332,   333,
+     334,   335,   336,   337,   338,   339,   340,   341,   342,   343,
+     344,   345,   346,   356,   357,   358,   359,   360,   361,   368,
+     369,   370,   371,   372,   378,   379,   380,   381,    16,    24,
+     390,   391,   392,   393,   394,   395,   396,   397,   398,    17,
+      25,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,    18,    26,   425,   426,    19,    27,
+     428,   429,   347,   348
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
-static const yytype_uint16 yytable[] =
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
 {
-       2,   306,   381,   307,   308,   319,   384,   385,   386,   387,
-       0,     3,   388,   320,   321,   356,   357,   358,   359,   360,
-     361,   362,   363,   364,   365,   366,   367,   389,   390,   330,
-     339,   340,   341,   342,   343,   344,   345,   346,   391,   392,
-     393,     4,   394,   395,   396,   397,   398,     5,   399,   400,
-     401,   402,   403,   404,   405,   406,   407,   408,   409,   410,
-     411,   412,   413,   414,   309,   331,   332,   415,   416,   417,
-     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
-     428,   429,   430,   431,   432,   433,   434,   435,   436,   437,
-     438,     6,   439,   440,   310,   441,   311,   322,   442,   323,
-     443,   444,   445,   446,   447,   448,   449,     7,   450,   451,
-     452,   453,   454,   455,   456,   457,   458,   459,   460,   461,
-     462,   463,   464,   465,   466,   467,   468,   469,   470,   471,
-     472,   473,   474,   475,   476,   477,   478,   479,   480,   481,
-     482,   483,   484,   485,     0,     8,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,    37,    38,
-      39,    40,    41,    42,    43,    44,    45,    46,    47,    48,
-      49,    50,    51,    52,   333,   486,   487,   488,    53,    54,
-      55,   489,   490,     9,    56,    57,    58,    59,    60,    61,
-      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
-      82,    83,    84,    85,    86,    87,    88,    89,    90,    91,
-      92,    93,    94,    95,    96,   491,   492,   493,   494,   495,
-     496,   497,   498,   499,    97,    98,    99,   500,   100,   101,
-     102,   501,   502,   103,   104,   105,   106,   107,   108,   109,
-     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,   121,   122,   123,   124,   125,   503,   504,   505,   506,
-     126,   127,   128,   129,   130,   131,   132,   133,   134,   507,
-     508,   509,   510,   511,   512,   513,   514,   515,   516,   517,
-     518,   519,   135,   136,   137,   138,   139,   140,   141,   142,
-     143,   144,   145,   146,   147,   148,   149,   150,   151,   152,
-     153,   154,   155,   156,   157,   158,   159,   520,   160,   521,
-     161,   162,   163,   164,   522,   523,   524,   525,   526,   527,
-     528,   529,   530,   531,   532,   533,   534,   535,   536,   537,
-     538,   539,   540,   541,   542,   543,   544,   545,   546,   547,
-     548,   549,   550,   551,   552,   553,   554,   555,   556,   557,
-     558,   559,   560,   561,   562,   563,   564,   565,   566,   567,
-     568,   569,   570,   571,   572,   573
+       2,   373,   349,   424,   350,   351,   362,   427,   430,   431,
+       0,     3,   432,   433,   363,   364,   399,   400,   401,   402,
+     403,   404,   405,   406,   407,   408,   409,   410,   382,   383,
+     384,   385,   386,   387,   388,   389,   434,   374,   375,   435,
+     436,     4,   437,   438,   439,   440,   441,     5,   442,   443,
+     444,   445,   446,   447,   448,   449,   450,   451,   452,   453,
+     454,   455,   456,   457,   458,   352,   459,   460,   461,   462,
+     463,   464,   465,   466,   467,   468,   469,   470,   471,   472,
+     473,   474,   475,   476,   477,   478,   479,   480,   481,   482,
+     483,     6,   484,   485,   486,   353,   487,   354,   365,   488,
+     366,   489,   490,   491,   492,   493,   494,     7,   495,   496,
+     497,   498,   499,   500,   501,   502,   503,   504,   505,   506,
+     507,   508,   509,   510,   511,   512,   513,   514,   515,   516,
+     517,   518,   519,   520,   521,   522,   523,   524,   525,   526,
+     527,   528,   529,   530,   531,     8,   376,   532,   533,   534,
+     535,   536,   537,   538,   539,   540,   541,   542,   543,   544,
+     545,   546,   547,   548,   549,   550,   551,   552,   553,   554,
+     555,   556,   557,   558,   559,   560,   561,   562,   563,   564,
+     565,   566,   567,     9,   568,   569,   570,   571,   572,   573,
+     574,   575,   576,   577,   578,   579,   580,   581,   582,   583,
+     584,   585,   586,   587,   588,   589,     0,    10,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
+      50,    51,    52,    53,    54,    55,   590,   591,   592,   593,
+      56,    57,    58,   594,   595,   596,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    91,    92,
+      93,    94,    95,    96,    97,    98,    99,   597,   598,   599,
+     600,   601,   602,   603,   604,   605,   100,   101,   102,   606,
+     103,   104,   105,   607,   608,   106,   107,   108,   109,   110,
+     111,   112,   113,   114,   115,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   609,   610,
+     611,   612,   129,   130,   131,   132,   133,   134,   135,   136,
+     137,   613,   614,   615,   616,   617,   618,   619,   620,   621,
+     622,   623,   624,   625,   138,   139,   140,   141,   142,   143,
+     144,   145,   146,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,   156,   157,   158,   159,   160,   161,   162,   626,
+     163,   627,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   628,   629,   185,   186,   187,   630,   631,
+     632,   633,   634,   635,   636,   637,   638,   639,   640
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,    40,   108,    42,    43,    40,    10,    10,    10,    10,
-      -1,    11,    10,    48,    49,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,   157,    10,    10,    40,
-      92,    93,    94,    95,    96,    97,    98,    99,    10,    10,
+       0,    40,    40,   108,    42,    43,    40,   208,    10,    10,
+      -1,    11,    10,    10,    48,    49,   146,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,   157,    92,    93,
+      94,    95,    96,    97,    98,    99,    10,    76,    77,    10,
       10,    41,    10,    10,    10,    10,    10,    47,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,   103,    76,    77,    10,    10,    10,
+      10,    10,    10,    10,    10,   103,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    91,    10,    10,   133,    10,   135,   132,    10,   134,
-      10,    10,    10,    10,    10,    10,    10,   107,    10,    10,
+      10,    91,    10,    10,    10,   133,    10,   135,   132,    10,
+     134,    10,    10,    10,    10,    10,    10,   107,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    -1,   145,    12,    13,    14,    15,
-      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
-      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,    38,    39,   185,    10,    10,    10,    44,    45,
-      46,    10,    10,   183,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-      86,    87,    88,    89,    90,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,   100,   101,   102,    10,   104,   105,
-     106,    10,    10,   109,   110,   111,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,   129,   130,   131,    10,    10,    10,    10,
-     136,   137,   138,   139,   140,   141,   142,   143,   144,    10,
+      10,    10,    10,    10,    10,   145,   185,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,   158,   159,   160,   161,   162,   163,   164,   165,
-     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
-     176,   177,   178,   179,   180,   181,   182,    10,   184,    10,
-     186,   187,   188,   189,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,   183,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10
-};
-
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
-{
-       0,   191,     0,    11,    41,    47,    91,   107,   145,   183,
-     192,   193,   196,   199,   202,   358,   369,   384,   194,   197,
-     200,   203,   359,   370,   385,    12,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    44,    45,    46,    50,    51,    52,    53,
+      10,    10,    10,    10,    10,    10,    -1,   207,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    10,    10,    10,    10,
+      44,    45,    46,    10,    10,    10,    50,    51,    52,    53,
       54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
       64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
       74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
-      84,    85,    86,    87,    88,    89,    90,   100,   101,   102,
-     104,   105,   106,   109,   110,   111,   112,   113,   114,   115,
-     116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,   129,   130,   131,   136,   137,   138,   139,
-     140,   141,   142,   143,   144,   158,   159,   160,   161,   162,
-     163,   164,   165,   166,   167,   168,   169,   170,   171,   172,
-     173,   174,   175,   176,   177,   178,   179,   180,   181,   182,
-     184,   186,   187,   188,   189,   195,   205,   206,   207,   208,
-     209,   210,   211,   212,   213,   214,   215,   216,   217,   218,
-     219,   220,   221,   222,   223,   224,   225,   226,   227,   228,
-     229,   230,   231,   232,   233,   234,   235,   236,   237,   238,
-     239,   240,   241,   242,   243,   244,   245,   246,   247,   248,
-     249,   250,   251,   252,   253,   254,   255,   256,   257,   258,
-     259,   260,   261,   262,   263,   264,   265,   266,   267,   268,
-     269,   270,   271,   272,   273,   274,   275,   276,   277,   278,
-     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
-     289,   290,   291,   292,   293,   294,   295,   296,   297,   298,
-     299,   300,   301,   302,   303,   304,   305,   306,   307,   308,
-     309,   310,   311,   312,   313,   314,   315,   316,   317,   318,
-     319,   320,   321,   322,   323,   324,   325,   326,   327,   328,
-     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
-     339,   340,   341,   342,   388,   389,    40,    42,    43,   103,
-     133,   135,   198,   343,   344,   345,   346,   347,   348,    40,
-      48,    49,   132,   134,   201,   349,   350,   351,   352,   353,
-      40,    76,    77,   185,   204,   354,   355,   356,   357,    92,
-      93,    94,    95,    96,    97,    98,    99,   360,   361,   362,
-     363,   364,   365,   366,   367,   368,   146,   147,   148,   149,
-     150,   151,   152,   153,   154,   155,   156,   157,   371,   372,
-     373,   374,   375,   376,   377,   378,   379,   380,   381,   382,
-     383,   108,   386,   387,    10,    10,    10,    10,    10,    10,
+      84,    85,    86,    87,    88,    89,    90,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,   100,   101,   102,    10,
+     104,   105,   106,    10,    10,   109,   110,   111,   112,   113,
+     114,   115,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   130,   131,    10,    10,
+      10,    10,   136,   137,   138,   139,   140,   141,   142,   143,
+     144,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,   158,   159,   160,   161,   162,   163,
+     164,   165,   166,   167,   168,   169,   170,   171,   172,   173,
+     174,   175,   176,   177,   178,   179,   180,   181,   182,    10,
+     184,    10,   186,   187,   188,   189,   190,   191,   192,   193,
+     194,   195,   196,   197,   198,   199,   200,   201,   202,   203,
+     204,   205,   206,    10,    10,   209,   210,   211,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
+{
+       0,   213,     0,    11,    41,    47,    91,   107,   145,   183,
+     207,   214,   215,   218,   221,   224,   400,   411,   426,   430,
+     216,   219,   222,   225,   401,   412,   427,   431,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    44,    45,    46,    50,
+      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      81,    82,    83,    84,    85,    86,    87,    88,    89,    90,
+     100,   101,   102,   104,   105,   106,   109,   110,   111,   112,
+     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   136,
+     137,   138,   139,   140,   141,   142,   143,   144,   158,   159,
+     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
+     170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
+     180,   181,   182,   184,   186,   187,   188,   189,   190,   191,
+     192,   193,   194,   195,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,   206,   209,   210,   211,   217,   227,
+     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,   269,   270,   271,   272,   273,   274,   275,   276,   277,
+     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
+     288,   289,   290,   291,   292,   293,   294,   295,   296,   297,
+     298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
+     308,   309,   310,   311,   312,   313,   314,   315,   316,   317,
+     318,   319,   320,   321,   322,   323,   324,   325,   326,   327,
+     328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
+     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
+     348,   349,   350,   351,   352,   353,   354,   355,   356,   357,
+     358,   359,   360,   361,   362,   363,   364,   365,   366,   367,
+     368,   369,   370,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,   380,   381,   382,   383,   384,   434,   435,    40,
+      42,    43,   103,   133,   135,   220,   385,   386,   387,   388,
+     389,   390,    40,    48,    49,   132,   134,   223,   391,   392,
+     393,   394,   395,    40,    76,    77,   185,   226,   396,   397,
+     398,   399,    92,    93,    94,    95,    96,    97,    98,    99,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,   146,
+     147,   148,   149,   150,   151,   152,   153,   154,   155,   156,
+     157,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   108,   428,   429,   208,   432,   433,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
@@ -1405,58 +1569,64 @@ static const yytype_uint16 yystos[] =
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10
+      10
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
 {
-       0,   190,   191,   191,   192,   192,   192,   192,   192,   192,
-     192,   193,   194,   194,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   195,   195,   195,   195,   195,   195,
-     195,   195,   195,   195,   196,   197,   197,   198,   198,   198,
-     198,   198,   198,   199,   200,   200,   201,   201,   201,   201,
-     201,   202,   203,   203,   204,   204,   204,   204,   205,   206,
-     207,   208,   209,   210,   211,   212,   213,   214,   215,   216,
-     217,   218,   219,   220,   221,   222,   223,   224,   225,   226,
-     227,   228,   229,   230,   231,   232,   233,   234,   235,   236,
-     237,   238,   239,   240,   241,   242,   243,   244,   245,   246,
-     247,   248,   249,   250,   251,   252,   253,   254,   255,   256,
-     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
-     267,   268,   269,   270,   271,   272,   273,   274,   275,   276,
-     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
-     287,   288,   289,   290,   291,   292,   293,   294,   295,   296,
-     297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
-     307,   308,   309,   310,   311,   312,   313,   314,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
-     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
-     337,   338,   339,   340,   341,   342,   343,   344,   345,   346,
-     347,   348,   349,   350,   351,   352,   353,   354,   355,   356,
-     357,   358,   359,   359,   360,   360,   360,   360,   360,   360,
-     360,   360,   361,   362,   363,   364,   365,   366,   367,   368,
-     369,   370,   370,   371,   371,   371,   371,   371,   371,   371,
-     371,   371,   371,   371,   371,   372,   373,   374,   375,   376,
-     377,   378,   379,   380,   381,   382,   383,   384,   385,   385,
-     386,   387,   388,   389
+       0,   212,   213,   213,   214,   214,   214,   214,   214,   214,
+     214,   214,   215,   216,   216,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   217,   217,   217,   217,   217,
+     217,   217,   217,   217,   217,   218,   219,   219,   220,   220,
+     220,   220,   220,   220,   221,   222,   222,   223,   223,   223,
+     223,   223,   224,   225,   225,   226,   226,   226,   226,   227,
+     228,   229,   230,   231,   232,   233,   234,   235,   236,   237,
+     238,   239,   240,   241,   242,   243,   244,   245,   246,   247,
+     248,   249,   250,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
+     268,   269,   270,   271,   272,   273,   274,   275,   276,   277,
+     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
+     288,   289,   290,   291,   292,   293,   294,   295,   296,   297,
+     298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
+     308,   309,   310,   311,   312,   313,   314,   315,   316,   317,
+     318,   319,   320,   321,   322,   323,   324,   325,   326,   327,
+     328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
+     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
+     348,   349,   350,   351,   352,   353,   354,   355,   356,   357,
+     358,   359,   360,   361,   362,   363,   364,   365,   366,   367,
+     368,   369,   370,   371,   372,   373,   374,   375,   376,   377,
+     378,   379,   380,   381,   382,   383,   384,   385,   386,   387,
+     388,   389,   390,   391,   392,   393,   394,   395,   396,   397,
+     398,   399,   400,   401,   401,   402,   402,   402,   402,   402,
+     402,   402,   402,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   412,   413,   413,   413,   413,   413,   413,
+     413,   413,   413,   413,   413,   413,   414,   415,   416,   417,
+     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
+     427,   428,   429,   430,   431,   431,   432,   433,   434,   435
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
-       2,     1,     2,     0,     1,     1,     1,     1,     1,     1,
+       2,     2,     1,     2,     0,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
@@ -1470,9 +1640,9 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     2,     0,     1,     1,
        1,     1,     1,     1,     1,     2,     0,     1,     1,     1,
-       1,     1,     1,     1,     2,     0,     1,     1,     1,     1,
-       1,     1,     2,     0,     1,     1,     1,     1,     2,     2,
+       1,     1,     1,     2,     0,     1,     1,     1,     1,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1481,55 +1651,57 @@ static const yytype_uint8 yyr2[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     3,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     3,     2,     2,     2,
+       2,     2,     2,     2,     2,     3,     3,     4,     4,     4,
+       3,     2,     2,     2,     2,     2,     2,     3,     3,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     3,
-       2,     2,     2,     2,     2,     2,     2,     2,     3,     3,
-       4,     4,     4,     3,     2,     2,     2,     2,     2,     2,
-       3,     3,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     3,     2,
+       2,     2,     1,     2,     0,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     2,     2,     2,     2,     2,     2,
        2,     1,     2,     0,     1,     1,     1,     1,     1,     1,
-       1,     1,     2,     2,     2,     2,     2,     2,     2,     2,
-       1,     2,     0,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     1,     2,     0,
-       1,     2,     2,     2
+       1,     1,     1,     1,     1,     1,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     1,     2,
+       0,     1,     2,     1,     2,     0,     1,     2,     2,     2
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -1546,55 +1718,52 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1603,7 +1772,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1626,21 +1795,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1655,8 +1824,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1679,249 +1848,30 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -1930,6 +1880,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -1937,43 +1889,36 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
+    int yyerrstatus = 0;
 
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
-
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -1981,71 +1926,75 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
-
         yyss = yyss1;
         yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -2053,30 +2002,31 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2087,18 +2037,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2126,15 +2087,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2149,7 +2108,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -2169,17 +2128,17 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 11:
-#line 150 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 12: /* serverstart: VAR_SERVER  */
+#line 158 "./util/configparser.y"
+        { 
 		OUTYY(("\nP(server:)\n")); 
 	}
-#line 2178 "util/configparser.c" /* yacc.c:1646  */
+#line 2137 "util/configparser.c"
     break;
 
-  case 154:
-#line 219 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 175: /* stubstart: VAR_STUB_ZONE  */
+#line 237 "./util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(stub_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2189,12 +2148,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2193 "util/configparser.c" /* yacc.c:1646  */
+#line 2152 "util/configparser.c"
     break;
 
-  case 163:
-#line 236 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 184: /* forwardstart: VAR_FORWARD_ZONE  */
+#line 254 "./util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(forward_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2204,12 +2163,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2208 "util/configparser.c" /* yacc.c:1646  */
+#line 2167 "util/configparser.c"
     break;
 
-  case 171:
-#line 253 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 192: /* viewstart: VAR_VIEW  */
+#line 271 "./util/configparser.y"
+        {
 		struct config_view* s;
 		OUTYY(("\nP(view:)\n")); 
 		s = (struct config_view*)calloc(1, sizeof(struct config_view));
@@ -2221,36 +2180,38 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2225 "util/configparser.c" /* yacc.c:1646  */
+#line 2184 "util/configparser.c"
     break;
 
-  case 178:
-#line 271 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 199: /* server_num_threads: VAR_NUM_THREADS STRING_ARG  */
+#line 289 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_num_threads:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0 || atoi((yyvsp[0].str)) > CFG_MAX_THREADS)
+			yyerror("num-threads must be between 0 and 10000");
 		else cfg_parser->cfg->num_threads = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2237 "util/configparser.c" /* yacc.c:1646  */
+#line 2198 "util/configparser.c"
     break;
 
-  case 179:
-#line 280 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 200: /* server_verbosity: VAR_VERBOSITY STRING_ARG  */
+#line 300 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_verbosity:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->verbosity = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2249 "util/configparser.c" /* yacc.c:1646  */
+#line 2210 "util/configparser.c"
     break;
 
-  case 180:
-#line 289 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 201: /* server_statistics_interval: VAR_STATISTICS_INTERVAL STRING_ARG  */
+#line 309 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_statistics_interval:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
 			cfg_parser->cfg->stat_interval = 0;
@@ -2259,48 +2220,48 @@ yyreduce:
 		else cfg_parser->cfg->stat_interval = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2263 "util/configparser.c" /* yacc.c:1646  */
+#line 2224 "util/configparser.c"
     break;
 
-  case 181:
-#line 300 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 202: /* server_statistics_cumulative: VAR_STATISTICS_CUMULATIVE STRING_ARG  */
+#line 320 "./util/configparser.y"
+        {
 		OUTYY(("P(server_statistics_cumulative:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stat_cumulative = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2275 "util/configparser.c" /* yacc.c:1646  */
+#line 2236 "util/configparser.c"
     break;
 
-  case 182:
-#line 309 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 203: /* server_extended_statistics: VAR_EXTENDED_STATISTICS STRING_ARG  */
+#line 329 "./util/configparser.y"
+        {
 		OUTYY(("P(server_extended_statistics:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stat_extended = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2287 "util/configparser.c" /* yacc.c:1646  */
+#line 2248 "util/configparser.c"
     break;
 
-  case 183:
-#line 318 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 204: /* server_port: VAR_PORT STRING_ARG  */
+#line 338 "./util/configparser.y"
+        {
 		OUTYY(("P(server_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
 		else cfg_parser->cfg->port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2299 "util/configparser.c" /* yacc.c:1646  */
+#line 2260 "util/configparser.c"
     break;
 
-  case 184:
-#line 327 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 205: /* server_interface: VAR_INTERFACE STRING_ARG  */
+#line 347 "./util/configparser.y"
+        {
 		OUTYY(("P(server_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_ifs == 0)
 			cfg_parser->cfg->ifs = calloc(1, sizeof(char*));
@@ -2311,12 +2272,12 @@ yyreduce:
 		else
 			cfg_parser->cfg->ifs[cfg_parser->cfg->num_ifs++] = (yyvsp[0].str);
 	}
-#line 2315 "util/configparser.c" /* yacc.c:1646  */
+#line 2276 "util/configparser.c"
     break;
 
-  case 185:
-#line 340 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 206: /* server_outgoing_interface: VAR_OUTGOING_INTERFACE STRING_ARG  */
+#line 360 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_out_ifs == 0)
 			cfg_parser->cfg->out_ifs = calloc(1, sizeof(char*));
@@ -2329,248 +2290,248 @@ yyreduce:
 			cfg_parser->cfg->out_ifs[
 				cfg_parser->cfg->num_out_ifs++] = (yyvsp[0].str);
 	}
-#line 2333 "util/configparser.c" /* yacc.c:1646  */
+#line 2294 "util/configparser.c"
     break;
 
-  case 186:
-#line 355 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 207: /* server_outgoing_range: VAR_OUTGOING_RANGE STRING_ARG  */
+#line 375 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_range:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_num_ports = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2345 "util/configparser.c" /* yacc.c:1646  */
+#line 2306 "util/configparser.c"
     break;
 
-  case 187:
-#line 364 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 208: /* server_outgoing_port_permit: VAR_OUTGOING_PORT_PERMIT STRING_ARG  */
+#line 384 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_port_permit:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 1, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 2357 "util/configparser.c" /* yacc.c:1646  */
+#line 2318 "util/configparser.c"
     break;
 
-  case 188:
-#line 373 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 209: /* server_outgoing_port_avoid: VAR_OUTGOING_PORT_AVOID STRING_ARG  */
+#line 393 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_port_avoid:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 0, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 2369 "util/configparser.c" /* yacc.c:1646  */
+#line 2330 "util/configparser.c"
     break;
 
-  case 189:
-#line 382 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 210: /* server_outgoing_num_tcp: VAR_OUTGOING_NUM_TCP STRING_ARG  */
+#line 402 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2381 "util/configparser.c" /* yacc.c:1646  */
+#line 2342 "util/configparser.c"
     break;
 
-  case 190:
-#line 391 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 211: /* server_incoming_num_tcp: VAR_INCOMING_NUM_TCP STRING_ARG  */
+#line 411 "./util/configparser.y"
+        {
 		OUTYY(("P(server_incoming_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->incoming_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2393 "util/configparser.c" /* yacc.c:1646  */
+#line 2354 "util/configparser.c"
     break;
 
-  case 191:
-#line 400 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 212: /* server_interface_automatic: VAR_INTERFACE_AUTOMATIC STRING_ARG  */
+#line 420 "./util/configparser.y"
+        {
 		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2405 "util/configparser.c" /* yacc.c:1646  */
+#line 2366 "util/configparser.c"
     break;
 
-  case 192:
-#line 409 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 213: /* server_do_ip4: VAR_DO_IP4 STRING_ARG  */
+#line 429 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2417 "util/configparser.c" /* yacc.c:1646  */
+#line 2378 "util/configparser.c"
     break;
 
-  case 193:
-#line 418 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 214: /* server_do_ip6: VAR_DO_IP6 STRING_ARG  */
+#line 438 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2429 "util/configparser.c" /* yacc.c:1646  */
+#line 2390 "util/configparser.c"
     break;
 
-  case 194:
-#line 427 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 215: /* server_do_udp: VAR_DO_UDP STRING_ARG  */
+#line 447 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_udp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_udp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2441 "util/configparser.c" /* yacc.c:1646  */
+#line 2402 "util/configparser.c"
     break;
 
-  case 195:
-#line 436 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 216: /* server_do_tcp: VAR_DO_TCP STRING_ARG  */
+#line 456 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_tcp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_tcp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2453 "util/configparser.c" /* yacc.c:1646  */
+#line 2414 "util/configparser.c"
     break;
 
-  case 196:
-#line 445 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 217: /* server_prefer_ip6: VAR_PREFER_IP6 STRING_ARG  */
+#line 465 "./util/configparser.y"
+        {
 		OUTYY(("P(server_prefer_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefer_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2465 "util/configparser.c" /* yacc.c:1646  */
+#line 2426 "util/configparser.c"
     break;
 
-  case 197:
-#line 454 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 218: /* server_tcp_mss: VAR_TCP_MSS STRING_ARG  */
+#line 474 "./util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_mss:%s)\n", (yyvsp[0].str)));
                 if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
                         yyerror("number expected");
                 else cfg_parser->cfg->tcp_mss = atoi((yyvsp[0].str));
                 free((yyvsp[0].str));
 	}
-#line 2477 "util/configparser.c" /* yacc.c:1646  */
+#line 2438 "util/configparser.c"
     break;
 
-  case 198:
-#line 463 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 219: /* server_outgoing_tcp_mss: VAR_OUTGOING_TCP_MSS STRING_ARG  */
+#line 483 "./util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_tcp_mss:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_tcp_mss = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2489 "util/configparser.c" /* yacc.c:1646  */
+#line 2450 "util/configparser.c"
     break;
 
-  case 199:
-#line 472 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 220: /* server_tcp_upstream: VAR_TCP_UPSTREAM STRING_ARG  */
+#line 492 "./util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2501 "util/configparser.c" /* yacc.c:1646  */
+#line 2462 "util/configparser.c"
     break;
 
-  case 200:
-#line 481 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 221: /* server_ssl_upstream: VAR_SSL_UPSTREAM STRING_ARG  */
+#line 501 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2513 "util/configparser.c" /* yacc.c:1646  */
+#line 2474 "util/configparser.c"
     break;
 
-  case 201:
-#line 490 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 222: /* server_ssl_service_key: VAR_SSL_SERVICE_KEY STRING_ARG  */
+#line 510 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_key);
 		cfg_parser->cfg->ssl_service_key = (yyvsp[0].str);
 	}
-#line 2523 "util/configparser.c" /* yacc.c:1646  */
+#line 2484 "util/configparser.c"
     break;
 
-  case 202:
-#line 497 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 223: /* server_ssl_service_pem: VAR_SSL_SERVICE_PEM STRING_ARG  */
+#line 517 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_pem);
 		cfg_parser->cfg->ssl_service_pem = (yyvsp[0].str);
 	}
-#line 2533 "util/configparser.c" /* yacc.c:1646  */
+#line 2494 "util/configparser.c"
     break;
 
-  case 203:
-#line 504 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 224: /* server_ssl_port: VAR_SSL_PORT STRING_ARG  */
+#line 524 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
 		else cfg_parser->cfg->ssl_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2545 "util/configparser.c" /* yacc.c:1646  */
+#line 2506 "util/configparser.c"
     break;
 
-  case 204:
-#line 513 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 225: /* server_use_systemd: VAR_USE_SYSTEMD STRING_ARG  */
+#line 533 "./util/configparser.y"
+        {
 		OUTYY(("P(server_use_systemd:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->use_systemd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2557 "util/configparser.c" /* yacc.c:1646  */
+#line 2518 "util/configparser.c"
     break;
 
-  case 205:
-#line 522 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 226: /* server_do_daemonize: VAR_DO_DAEMONIZE STRING_ARG  */
+#line 542 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_daemonize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_daemonize = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2569 "util/configparser.c" /* yacc.c:1646  */
+#line 2530 "util/configparser.c"
     break;
 
-  case 206:
-#line 531 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 227: /* server_use_syslog: VAR_USE_SYSLOG STRING_ARG  */
+#line 551 "./util/configparser.y"
+        {
 		OUTYY(("P(server_use_syslog:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -2582,72 +2543,106 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 2586 "util/configparser.c" /* yacc.c:1646  */
+#line 2547 "util/configparser.c"
     break;
 
-  case 207:
-#line 545 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 228: /* server_log_time_ascii: VAR_LOG_TIME_ASCII STRING_ARG  */
+#line 565 "./util/configparser.y"
+        {
 		OUTYY(("P(server_log_time_ascii:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->log_time_ascii = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2598 "util/configparser.c" /* yacc.c:1646  */
+#line 2559 "util/configparser.c"
     break;
 
-  case 208:
-#line 554 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 229: /* server_log_queries: VAR_LOG_QUERIES STRING_ARG  */
+#line 574 "./util/configparser.y"
+        {
 		OUTYY(("P(server_log_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->log_queries = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2610 "util/configparser.c" /* yacc.c:1646  */
+#line 2571 "util/configparser.c"
     break;
 
-  case 209:
-#line 563 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 230: /* server_log_replies: VAR_LOG_REPLIES STRING_ARG  */
+#line 583 "./util/configparser.y"
+  {
   	OUTYY(("P(server_log_replies:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
   		yyerror("expected yes or no.");
   	else cfg_parser->cfg->log_replies = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 2622 "util/configparser.c" /* yacc.c:1646  */
+#line 2583 "util/configparser.c"
     break;
 
-  case 210:
-#line 572 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_chroot:%s)\n", (yyvsp[0].str)));
-		free(cfg_parser->cfg->chrootdir);
-		cfg_parser->cfg->chrootdir = (yyvsp[0].str);
+  case 231: /* server_log_async: VAR_LOG_ASYNC STRING_ARG  */
+#line 592 "./util/configparser.y"
+        {
+		OUTYY(("P(server_log_async:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->log_async = (strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
 	}
-#line 2632 "util/configparser.c" /* yacc.c:1646  */
+#line 2595 "util/configparser.c"
     break;
 
-  case 211:
-#line 579 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_username:%s)\n", (yyvsp[0].str)));
-		free(cfg_parser->cfg->username);
-		cfg_parser->cfg->username = (yyvsp[0].str);
+  case 232: /* server_log_async_size: VAR_LOG_ASYNC_SIZE STRING_ARG  */
+#line 601 "./util/configparser.y"
+        {
+		OUTYY(("P(server_log_async_size:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) <= 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->log_async_size = (size_t)atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
 	}
-#line 2642 "util/configparser.c" /* yacc.c:1646  */
+#line 2607 "util/configparser.c"
     break;
 
-  case 212:
-#line 586 "./util/configparser.y" /* yacc.c:1646  */
-    {
-		OUTYY(("P(server_directory:%s)\n", (yyvsp[0].str)));
-		free(cfg_parser->cfg->directory);
-		cfg_parser->cfg->directory = (yyvsp[0].str);
-		/* change there right away for includes relative to this */
+  case 233: /* server_log_binary_file: VAR_LOG_BINARY_FILE STRING_ARG  */
+#line 610 "./util/configparser.y"
+        {
+		OUTYY(("P(server_log_binary_file:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->log_binary_file);
+		cfg_parser->cfg->log_binary_file = (yyvsp[0].str);
+	}
+#line 2617 "util/configparser.c"
+    break;
+
+  case 234: /* server_chroot: VAR_CHROOT STRING_ARG  */
+#line 617 "./util/configparser.y"
+        {
+		OUTYY(("P(server_chroot:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->chrootdir);
+		cfg_parser->cfg->chrootdir = (yyvsp[0].str);
+	}
+#line 2627 "util/configparser.c"
+    break;
+
+  case 235: /* server_username: VAR_USERNAME STRING_ARG  */
+#line 624 "./util/configparser.y"
+        {
+		OUTYY(("P(server_username:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->username);
+		cfg_parser->cfg->username = (yyvsp[0].str);
+	}
+#line 2637 "util/configparser.c"
+    break;
+
+  case 236: /* server_directory: VAR_DIRECTORY STRING_ARG  */
+#line 631 "./util/configparser.y"
+        {
+		OUTYY(("P(server_directory:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->directory);
+		cfg_parser->cfg->directory = (yyvsp[0].str);
+		/* change there right away for includes relative to this */
 		if((yyvsp[0].str)[0]) {
 			char* d;
 #ifdef UB_ON_WINDOWS
@@ -2667,181 +2662,181 @@ yyreduce:
 			}
 		}
 	}
-#line 2671 "util/configparser.c" /* yacc.c:1646  */
+#line 2666 "util/configparser.c"
     break;
 
-  case 213:
-#line 612 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 237: /* server_logfile: VAR_LOGFILE STRING_ARG  */
+#line 657 "./util/configparser.y"
+        {
 		OUTYY(("P(server_logfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->logfile);
 		cfg_parser->cfg->logfile = (yyvsp[0].str);
 		cfg_parser->cfg->use_syslog = 0;
 	}
-#line 2682 "util/configparser.c" /* yacc.c:1646  */
+#line 2677 "util/configparser.c"
     break;
 
-  case 214:
-#line 620 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 238: /* server_pidfile: VAR_PIDFILE STRING_ARG  */
+#line 665 "./util/configparser.y"
+        {
 		OUTYY(("P(server_pidfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->pidfile);
 		cfg_parser->cfg->pidfile = (yyvsp[0].str);
 	}
-#line 2692 "util/configparser.c" /* yacc.c:1646  */
+#line 2687 "util/configparser.c"
     break;
 
-  case 215:
-#line 627 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 239: /* server_root_hints: VAR_ROOT_HINTS STRING_ARG  */
+#line 672 "./util/configparser.y"
+        {
 		OUTYY(("P(server_root_hints:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->root_hints, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2702 "util/configparser.c" /* yacc.c:1646  */
+#line 2697 "util/configparser.c"
     break;
 
-  case 216:
-#line 634 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 240: /* server_dlv_anchor_file: VAR_DLV_ANCHOR_FILE STRING_ARG  */
+#line 679 "./util/configparser.y"
+        {
 		OUTYY(("P(server_dlv_anchor_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dlv_anchor_file);
 		cfg_parser->cfg->dlv_anchor_file = (yyvsp[0].str);
 	}
-#line 2712 "util/configparser.c" /* yacc.c:1646  */
+#line 2707 "util/configparser.c"
     break;
 
-  case 217:
-#line 641 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 241: /* server_dlv_anchor: VAR_DLV_ANCHOR STRING_ARG  */
+#line 686 "./util/configparser.y"
+        {
 		OUTYY(("P(server_dlv_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dlv_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2722 "util/configparser.c" /* yacc.c:1646  */
+#line 2717 "util/configparser.c"
     break;
 
-  case 218:
-#line 648 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 242: /* server_auto_trust_anchor_file: VAR_AUTO_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 693 "./util/configparser.y"
+        {
 		OUTYY(("P(server_auto_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			auto_trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2733 "util/configparser.c" /* yacc.c:1646  */
+#line 2728 "util/configparser.c"
     break;
 
-  case 219:
-#line 656 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 243: /* server_trust_anchor_file: VAR_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 701 "./util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2744 "util/configparser.c" /* yacc.c:1646  */
+#line 2739 "util/configparser.c"
     break;
 
-  case 220:
-#line 664 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 244: /* server_trusted_keys_file: VAR_TRUSTED_KEYS_FILE STRING_ARG  */
+#line 709 "./util/configparser.y"
+        {
 		OUTYY(("P(server_trusted_keys_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trusted_keys_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2755 "util/configparser.c" /* yacc.c:1646  */
+#line 2750 "util/configparser.c"
     break;
 
-  case 221:
-#line 672 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 245: /* server_trust_anchor: VAR_TRUST_ANCHOR STRING_ARG  */
+#line 717 "./util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->trust_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2765 "util/configparser.c" /* yacc.c:1646  */
+#line 2760 "util/configparser.c"
     break;
 
-  case 222:
-#line 679 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 246: /* server_domain_insecure: VAR_DOMAIN_INSECURE STRING_ARG  */
+#line 724 "./util/configparser.y"
+        {
 		OUTYY(("P(server_domain_insecure:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->domain_insecure, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2775 "util/configparser.c" /* yacc.c:1646  */
+#line 2770 "util/configparser.c"
     break;
 
-  case 223:
-#line 686 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 247: /* server_hide_identity: VAR_HIDE_IDENTITY STRING_ARG  */
+#line 731 "./util/configparser.y"
+        {
 		OUTYY(("P(server_hide_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_identity = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2787 "util/configparser.c" /* yacc.c:1646  */
+#line 2782 "util/configparser.c"
     break;
 
-  case 224:
-#line 695 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 248: /* server_hide_version: VAR_HIDE_VERSION STRING_ARG  */
+#line 740 "./util/configparser.y"
+        {
 		OUTYY(("P(server_hide_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_version = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2799 "util/configparser.c" /* yacc.c:1646  */
+#line 2794 "util/configparser.c"
     break;
 
-  case 225:
-#line 704 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 249: /* server_identity: VAR_IDENTITY STRING_ARG  */
+#line 749 "./util/configparser.y"
+        {
 		OUTYY(("P(server_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->identity);
 		cfg_parser->cfg->identity = (yyvsp[0].str);
 	}
-#line 2809 "util/configparser.c" /* yacc.c:1646  */
+#line 2804 "util/configparser.c"
     break;
 
-  case 226:
-#line 711 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 250: /* server_version: VAR_VERSION STRING_ARG  */
+#line 756 "./util/configparser.y"
+        {
 		OUTYY(("P(server_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->version);
 		cfg_parser->cfg->version = (yyvsp[0].str);
 	}
-#line 2819 "util/configparser.c" /* yacc.c:1646  */
+#line 2814 "util/configparser.c"
     break;
 
-  case 227:
-#line 718 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 251: /* server_so_rcvbuf: VAR_SO_RCVBUF STRING_ARG  */
+#line 763 "./util/configparser.y"
+        {
 		OUTYY(("P(server_so_rcvbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_rcvbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 2830 "util/configparser.c" /* yacc.c:1646  */
+#line 2825 "util/configparser.c"
     break;
 
-  case 228:
-#line 726 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 252: /* server_so_sndbuf: VAR_SO_SNDBUF STRING_ARG  */
+#line 771 "./util/configparser.y"
+        {
 		OUTYY(("P(server_so_sndbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_sndbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 2841 "util/configparser.c" /* yacc.c:1646  */
+#line 2836 "util/configparser.c"
     break;
 
-  case 229:
-#line 734 "./util/configparser.y" /* yacc.c:1646  */
+  case 253: /* server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG  */
+#line 779 "./util/configparser.y"
     {
         OUTYY(("P(server_so_reuseport:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -2850,11 +2845,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 2854 "util/configparser.c" /* yacc.c:1646  */
+#line 2849 "util/configparser.c"
     break;
 
-  case 230:
-#line 744 "./util/configparser.y" /* yacc.c:1646  */
+  case 254: /* server_ip_transparent: VAR_IP_TRANSPARENT STRING_ARG  */
+#line 789 "./util/configparser.y"
     {
         OUTYY(("P(server_ip_transparent:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -2863,11 +2858,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 2867 "util/configparser.c" /* yacc.c:1646  */
+#line 2862 "util/configparser.c"
     break;
 
-  case 231:
-#line 754 "./util/configparser.y" /* yacc.c:1646  */
+  case 255: /* server_ip_freebind: VAR_IP_FREEBIND STRING_ARG  */
+#line 799 "./util/configparser.y"
     {
         OUTYY(("P(server_ip_freebind:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -2876,12 +2871,12 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 2880 "util/configparser.c" /* yacc.c:1646  */
+#line 2875 "util/configparser.c"
     break;
 
-  case 232:
-#line 764 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 256: /* server_edns_buffer_size: VAR_EDNS_BUFFER_SIZE STRING_ARG  */
+#line 809 "./util/configparser.y"
+        {
 		OUTYY(("P(server_edns_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -2892,12 +2887,12 @@ yyreduce:
 		else cfg_parser->cfg->edns_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2896 "util/configparser.c" /* yacc.c:1646  */
+#line 2891 "util/configparser.c"
     break;
 
-  case 233:
-#line 777 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 257: /* server_msg_buffer_size: VAR_MSG_BUFFER_SIZE STRING_ARG  */
+#line 822 "./util/configparser.y"
+        {
 		OUTYY(("P(server_msg_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -2906,23 +2901,23 @@ yyreduce:
 		else cfg_parser->cfg->msg_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2910 "util/configparser.c" /* yacc.c:1646  */
+#line 2905 "util/configparser.c"
     break;
 
-  case 234:
-#line 788 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 258: /* server_msg_cache_size: VAR_MSG_CACHE_SIZE STRING_ARG  */
+#line 833 "./util/configparser.y"
+        {
 		OUTYY(("P(server_msg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->msg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 2921 "util/configparser.c" /* yacc.c:1646  */
+#line 2916 "util/configparser.c"
     break;
 
-  case 235:
-#line 796 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 259: /* server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG  */
+#line 841 "./util/configparser.y"
+        {
 		OUTYY(("P(server_msg_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -2933,48 +2928,84 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 2937 "util/configparser.c" /* yacc.c:1646  */
+#line 2932 "util/configparser.c"
     break;
 
-  case 236:
-#line 809 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 260: /* server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG  */
+#line 854 "./util/configparser.y"
+        {
 		OUTYY(("P(server_num_queries_per_thread:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->num_queries_per_thread = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2949 "util/configparser.c" /* yacc.c:1646  */
+#line 2944 "util/configparser.c"
     break;
 
-  case 237:
-#line 818 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 261: /* server_jostle_timeout: VAR_JOSTLE_TIMEOUT STRING_ARG  */
+#line 863 "./util/configparser.y"
+        {
 		OUTYY(("P(server_jostle_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->jostle_time = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2961 "util/configparser.c" /* yacc.c:1646  */
+#line 2956 "util/configparser.c"
     break;
 
-  case 238:
-#line 827 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 262: /* server_delay_close: VAR_DELAY_CLOSE STRING_ARG  */
+#line 872 "./util/configparser.y"
+        {
 		OUTYY(("P(server_delay_close:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->delay_close = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2973 "util/configparser.c" /* yacc.c:1646  */
+#line 2968 "util/configparser.c"
     break;
 
-  case 239:
-#line 836 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 263: /* server_outgoing_udp_pool: VAR_OUTGOING_UDP_POOL STRING_ARG  */
+#line 881 "./util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_udp_pool:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->outgoing_udp_pool = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2980 "util/configparser.c"
+    break;
+
+  case 264: /* server_outgoing_udp_pool_rotate: VAR_OUTGOING_UDP_POOL_ROTATE STRING_ARG  */
+#line 890 "./util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_udp_pool_rotate:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->outgoing_udp_pool_rotate = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 2992 "util/configparser.c"
+    break;
+
+  case 265: /* server_outgoing_udp_pool_uses: VAR_OUTGOING_UDP_POOL_USES STRING_ARG  */
+#line 899 "./util/configparser.y"
+        {
+		OUTYY(("P(server_outgoing_udp_pool_uses:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->outgoing_udp_pool_uses = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3004 "util/configparser.c"
+    break;
+
+  case 266: /* server_unblock_lan_zones: VAR_UNBLOCK_LAN_ZONES STRING_ARG  */
+#line 908 "./util/configparser.y"
+        {
 		OUTYY(("P(server_unblock_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -2982,12 +3013,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2986 "util/configparser.c" /* yacc.c:1646  */
+#line 3017 "util/configparser.c"
     break;
 
-  case 240:
-#line 846 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 267: /* server_insecure_lan_zones: VAR_INSECURE_LAN_ZONES STRING_ARG  */
+#line 918 "./util/configparser.y"
+        {
 		OUTYY(("P(server_insecure_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -2995,23 +3026,23 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2999 "util/configparser.c" /* yacc.c:1646  */
+#line 3030 "util/configparser.c"
     break;
 
-  case 241:
-#line 856 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 268: /* server_rrset_cache_size: VAR_RRSET_CACHE_SIZE STRING_ARG  */
+#line 928 "./util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->rrset_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3010 "util/configparser.c" /* yacc.c:1646  */
+#line 3041 "util/configparser.c"
     break;
 
-  case 242:
-#line 864 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 269: /* server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG  */
+#line 936 "./util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3022,58 +3053,58 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3026 "util/configparser.c" /* yacc.c:1646  */
+#line 3057 "util/configparser.c"
     break;
 
-  case 243:
-#line 877 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 270: /* server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG  */
+#line 949 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_host_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->host_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3038 "util/configparser.c" /* yacc.c:1646  */
+#line 3069 "util/configparser.c"
     break;
 
-  case 244:
-#line 886 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 271: /* server_infra_lame_ttl: VAR_INFRA_LAME_TTL STRING_ARG  */
+#line 958 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_lame_ttl:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-lame-ttl: %s (option "
 			"removed, use infra-host-ttl)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3049 "util/configparser.c" /* yacc.c:1646  */
+#line 3080 "util/configparser.c"
     break;
 
-  case 245:
-#line 894 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 272: /* server_infra_cache_numhosts: VAR_INFRA_CACHE_NUMHOSTS STRING_ARG  */
+#line 966 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_numhosts:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->infra_cache_numhosts = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3061 "util/configparser.c" /* yacc.c:1646  */
+#line 3092 "util/configparser.c"
     break;
 
-  case 246:
-#line 903 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 273: /* server_infra_cache_lame_size: VAR_INFRA_CACHE_LAME_SIZE STRING_ARG  */
+#line 975 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_lame_size:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-cache-lame-size: %s "
 			"(option removed, use infra-cache-numhosts)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3072 "util/configparser.c" /* yacc.c:1646  */
+#line 3103 "util/configparser.c"
     break;
 
-  case 247:
-#line 911 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 274: /* server_infra_cache_slabs: VAR_INFRA_CACHE_SLABS STRING_ARG  */
+#line 983 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3084,34 +3115,146 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3088 "util/configparser.c" /* yacc.c:1646  */
+#line 3119 "util/configparser.c"
     break;
 
-  case 248:
-#line 924 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 275: /* server_infra_cache_min_rtt: VAR_INFRA_CACHE_MIN_RTT STRING_ARG  */
+#line 996 "./util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_min_rtt:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->infra_cache_min_rtt = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3100 "util/configparser.c" /* yacc.c:1646  */
+#line 3131 "util/configparser.c"
     break;
 
-  case 249:
-#line 933 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 276: /* server_hedge_percentile: VAR_HEDGE_PERCENTILE STRING_ARG  */
+#line 1005 "./util/configparser.y"
+        {
+		OUTYY(("P(server_hedge_percentile:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0 || atoi((yyvsp[0].str)) > 99)
+			yyerror("percentile must be between 0 and 99");
+		else cfg_parser->cfg->hedge_percentile = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3145 "util/configparser.c"
+    break;
+
+  case 277: /* server_hedge_budget: VAR_HEDGE_BUDGET STRING_ARG  */
+#line 1016 "./util/configparser.y"
+        {
+		OUTYY(("P(server_hedge_budget:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else if(atoi((yyvsp[0].str)) < 0 || atoi((yyvsp[0].str)) > 100)
+			yyerror("percentage must be between 0 and 100");
+		else cfg_parser->cfg->hedge_budget = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3159 "util/configparser.c"
+    break;
+
+  case 278: /* server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG  */
+#line 1027 "./util/configparser.y"
+        {
 		OUTYY(("P(server_target_fetch_policy:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->target_fetch_policy);
 		cfg_parser->cfg->target_fetch_policy = (yyvsp[0].str);
 	}
-#line 3110 "util/configparser.c" /* yacc.c:1646  */
+#line 3169 "util/configparser.c"
     break;
 
-  case 250:
-#line 940 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 279: /* server_target_fetch_parallel: VAR_TARGET_FETCH_PARALLEL STRING_ARG  */
+#line 1034 "./util/configparser.y"
+        {
+		OUTYY(("P(server_target_fetch_parallel:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->target_fetch_parallel = 
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3182 "util/configparser.c"
+    break;
+
+  case 280: /* server_metrics_enable: VAR_METRICS_ENABLE STRING_ARG  */
+#line 1044 "./util/configparser.y"
+        {
+		OUTYY(("P(server_metrics_enable:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->metrics_enable = 
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3195 "util/configparser.c"
+    break;
+
+  case 281: /* server_metrics_interface: VAR_METRICS_INTERFACE STRING_ARG  */
+#line 1054 "./util/configparser.y"
+        {
+		OUTYY(("P(server_metrics_interface:%s)\n", (yyvsp[0].str)));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->metrics_ifs, (yyvsp[0].str)))
+			yyerror("out of memory");
+	}
+#line 3205 "util/configparser.c"
+    break;
+
+  case 282: /* server_metrics_port: VAR_METRICS_PORT STRING_ARG  */
+#line 1061 "./util/configparser.y"
+        {
+		OUTYY(("P(server_metrics_port:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
+			yyerror("port number expected");
+		else cfg_parser->cfg->metrics_port = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3217 "util/configparser.c"
+    break;
+
+  case 283: /* server_mesh_client_quota: VAR_MESH_CLIENT_QUOTA STRING_ARG  */
+#line 1070 "./util/configparser.y"
+        {
+		OUTYY(("P(server_mesh_client_quota:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->mesh_client_quota = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3229 "util/configparser.c"
+    break;
+
+  case 284: /* server_mesh_zone_quota: VAR_MESH_ZONE_QUOTA STRING_ARG  */
+#line 1079 "./util/configparser.y"
+        {
+		OUTYY(("P(server_mesh_zone_quota:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->mesh_zone_quota = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3241 "util/configparser.c"
+    break;
+
+  case 285: /* server_mesh_prefetch_reserve: VAR_MESH_PREFETCH_RESERVE STRING_ARG  */
+#line 1088 "./util/configparser.y"
+        {
+		OUTYY(("P(server_mesh_prefetch_reserve:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->mesh_prefetch_reserve = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 3253 "util/configparser.c"
+    break;
+
+  case 286: /* server_harden_short_bufsize: VAR_HARDEN_SHORT_BUFSIZE STRING_ARG  */
+#line 1097 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_short_bufsize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3119,12 +3262,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3123 "util/configparser.c" /* yacc.c:1646  */
+#line 3266 "util/configparser.c"
     break;
 
-  case 251:
-#line 950 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 287: /* server_harden_large_queries: VAR_HARDEN_LARGE_QUERIES STRING_ARG  */
+#line 1107 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_large_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3132,12 +3275,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3136 "util/configparser.c" /* yacc.c:1646  */
+#line 3279 "util/configparser.c"
     break;
 
-  case 252:
-#line 960 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 288: /* server_harden_glue: VAR_HARDEN_GLUE STRING_ARG  */
+#line 1117 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_glue:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3145,12 +3288,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3149 "util/configparser.c" /* yacc.c:1646  */
+#line 3292 "util/configparser.c"
     break;
 
-  case 253:
-#line 970 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 289: /* server_harden_dnssec_stripped: VAR_HARDEN_DNSSEC_STRIPPED STRING_ARG  */
+#line 1127 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_dnssec_stripped:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3158,12 +3301,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3162 "util/configparser.c" /* yacc.c:1646  */
+#line 3305 "util/configparser.c"
     break;
 
-  case 254:
-#line 980 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 290: /* server_harden_below_nxdomain: VAR_HARDEN_BELOW_NXDOMAIN STRING_ARG  */
+#line 1137 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_below_nxdomain:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3171,12 +3314,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3175 "util/configparser.c" /* yacc.c:1646  */
+#line 3318 "util/configparser.c"
     break;
 
-  case 255:
-#line 990 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 291: /* server_harden_referral_path: VAR_HARDEN_REFERRAL_PATH STRING_ARG  */
+#line 1147 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_referral_path:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3184,12 +3327,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3188 "util/configparser.c" /* yacc.c:1646  */
+#line 3331 "util/configparser.c"
     break;
 
-  case 256:
-#line 1000 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 292: /* server_harden_algo_downgrade: VAR_HARDEN_ALGO_DOWNGRADE STRING_ARG  */
+#line 1157 "./util/configparser.y"
+        {
 		OUTYY(("P(server_harden_algo_downgrade:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3197,12 +3340,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3201 "util/configparser.c" /* yacc.c:1646  */
+#line 3344 "util/configparser.c"
     break;
 
-  case 257:
-#line 1010 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 293: /* server_use_caps_for_id: VAR_USE_CAPS_FOR_ID STRING_ARG  */
+#line 1167 "./util/configparser.y"
+        {
 		OUTYY(("P(server_use_caps_for_id:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3210,88 +3353,88 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3214 "util/configparser.c" /* yacc.c:1646  */
+#line 3357 "util/configparser.c"
     break;
 
-  case 258:
-#line 1020 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 294: /* server_caps_whitelist: VAR_CAPS_WHITELIST STRING_ARG  */
+#line 1177 "./util/configparser.y"
+        {
 		OUTYY(("P(server_caps_whitelist:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->caps_whitelist, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3224 "util/configparser.c" /* yacc.c:1646  */
+#line 3367 "util/configparser.c"
     break;
 
-  case 259:
-#line 1027 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 295: /* server_private_address: VAR_PRIVATE_ADDRESS STRING_ARG  */
+#line 1184 "./util/configparser.y"
+        {
 		OUTYY(("P(server_private_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_address, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3234 "util/configparser.c" /* yacc.c:1646  */
+#line 3377 "util/configparser.c"
     break;
 
-  case 260:
-#line 1034 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 296: /* server_private_domain: VAR_PRIVATE_DOMAIN STRING_ARG  */
+#line 1191 "./util/configparser.y"
+        {
 		OUTYY(("P(server_private_domain:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_domain, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3244 "util/configparser.c" /* yacc.c:1646  */
+#line 3387 "util/configparser.c"
     break;
 
-  case 261:
-#line 1041 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 297: /* server_prefetch: VAR_PREFETCH STRING_ARG  */
+#line 1198 "./util/configparser.y"
+        {
 		OUTYY(("P(server_prefetch:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefetch = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3256 "util/configparser.c" /* yacc.c:1646  */
+#line 3399 "util/configparser.c"
     break;
 
-  case 262:
-#line 1050 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 298: /* server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG  */
+#line 1207 "./util/configparser.y"
+        {
 		OUTYY(("P(server_prefetch_key:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefetch_key = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3268 "util/configparser.c" /* yacc.c:1646  */
+#line 3411 "util/configparser.c"
     break;
 
-  case 263:
-#line 1059 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 299: /* server_unwanted_reply_threshold: VAR_UNWANTED_REPLY_THRESHOLD STRING_ARG  */
+#line 1216 "./util/configparser.y"
+        {
 		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->unwanted_threshold = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3280 "util/configparser.c" /* yacc.c:1646  */
+#line 3423 "util/configparser.c"
     break;
 
-  case 264:
-#line 1068 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 300: /* server_do_not_query_address: VAR_DO_NOT_QUERY_ADDRESS STRING_ARG  */
+#line 1225 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_not_query_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->donotqueryaddrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3290 "util/configparser.c" /* yacc.c:1646  */
+#line 3433 "util/configparser.c"
     break;
 
-  case 265:
-#line 1075 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 301: /* server_do_not_query_localhost: VAR_DO_NOT_QUERY_LOCALHOST STRING_ARG  */
+#line 1232 "./util/configparser.y"
+        {
 		OUTYY(("P(server_do_not_query_localhost:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3299,12 +3442,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3303 "util/configparser.c" /* yacc.c:1646  */
+#line 3446 "util/configparser.c"
     break;
 
-  case 266:
-#line 1085 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 302: /* server_access_control: VAR_ACCESS_CONTROL STRING_ARG STRING_ARG  */
+#line 1242 "./util/configparser.y"
+        {
 		OUTYY(("P(server_access_control:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "deny")!=0 && strcmp((yyvsp[0].str), "refuse")!=0 &&
 			strcmp((yyvsp[0].str), "deny_non_local")!=0 &&
@@ -3319,22 +3462,22 @@ yyreduce:
 				fatal_exit("out of memory adding acl");
 		}
 	}
-#line 3323 "util/configparser.c" /* yacc.c:1646  */
+#line 3466 "util/configparser.c"
     break;
 
-  case 267:
-#line 1102 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 303: /* server_module_conf: VAR_MODULE_CONF STRING_ARG  */
+#line 1259 "./util/configparser.y"
+        {
 		OUTYY(("P(server_module_conf:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->module_conf);
 		cfg_parser->cfg->module_conf = (yyvsp[0].str);
 	}
-#line 3333 "util/configparser.c" /* yacc.c:1646  */
+#line 3476 "util/configparser.c"
     break;
 
-  case 268:
-#line 1109 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 304: /* server_val_override_date: VAR_VAL_OVERRIDE_DATE STRING_ARG  */
+#line 1266 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_override_date:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_date_override = 0;
@@ -3350,12 +3493,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3354 "util/configparser.c" /* yacc.c:1646  */
+#line 3497 "util/configparser.c"
     break;
 
-  case 269:
-#line 1127 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 305: /* server_val_sig_skew_min: VAR_VAL_SIG_SKEW_MIN STRING_ARG  */
+#line 1284 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_sig_skew_min:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_min = 0;
@@ -3366,12 +3509,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3370 "util/configparser.c" /* yacc.c:1646  */
+#line 3513 "util/configparser.c"
     break;
 
-  case 270:
-#line 1140 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 306: /* server_val_sig_skew_max: VAR_VAL_SIG_SKEW_MAX STRING_ARG  */
+#line 1297 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_sig_skew_max:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_max = 0;
@@ -3382,60 +3525,60 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3386 "util/configparser.c" /* yacc.c:1646  */
+#line 3529 "util/configparser.c"
     break;
 
-  case 271:
-#line 1153 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 307: /* server_cache_max_ttl: VAR_CACHE_MAX_TTL STRING_ARG  */
+#line 1310 "./util/configparser.y"
+        {
 		OUTYY(("P(server_cache_max_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->max_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3398 "util/configparser.c" /* yacc.c:1646  */
+#line 3541 "util/configparser.c"
     break;
 
-  case 272:
-#line 1162 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 308: /* server_cache_max_negative_ttl: VAR_CACHE_MAX_NEGATIVE_TTL STRING_ARG  */
+#line 1319 "./util/configparser.y"
+        {
 		OUTYY(("P(server_cache_max_negative_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->max_negative_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3410 "util/configparser.c" /* yacc.c:1646  */
+#line 3553 "util/configparser.c"
     break;
 
-  case 273:
-#line 1171 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 309: /* server_cache_min_ttl: VAR_CACHE_MIN_TTL STRING_ARG  */
+#line 1328 "./util/configparser.y"
+        {
 		OUTYY(("P(server_cache_min_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->min_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3422 "util/configparser.c" /* yacc.c:1646  */
+#line 3565 "util/configparser.c"
     break;
 
-  case 274:
-#line 1180 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 310: /* server_bogus_ttl: VAR_BOGUS_TTL STRING_ARG  */
+#line 1337 "./util/configparser.y"
+        {
 		OUTYY(("P(server_bogus_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->bogus_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3434 "util/configparser.c" /* yacc.c:1646  */
+#line 3577 "util/configparser.c"
     break;
 
-  case 275:
-#line 1189 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 311: /* server_val_clean_additional: VAR_VAL_CLEAN_ADDITIONAL STRING_ARG  */
+#line 1346 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_clean_additional:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3443,12 +3586,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3447 "util/configparser.c" /* yacc.c:1646  */
+#line 3590 "util/configparser.c"
     break;
 
-  case 276:
-#line 1199 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 312: /* server_val_permissive_mode: VAR_VAL_PERMISSIVE_MODE STRING_ARG  */
+#line 1356 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_permissive_mode:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3456,36 +3599,36 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3460 "util/configparser.c" /* yacc.c:1646  */
+#line 3603 "util/configparser.c"
     break;
 
-  case 277:
-#line 1209 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 313: /* server_ignore_cd_flag: VAR_IGNORE_CD_FLAG STRING_ARG  */
+#line 1366 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ignore_cd_flag:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->ignore_cd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3472 "util/configparser.c" /* yacc.c:1646  */
+#line 3615 "util/configparser.c"
     break;
 
-  case 278:
-#line 1218 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 314: /* server_serve_expired: VAR_SERVE_EXPIRED STRING_ARG  */
+#line 1375 "./util/configparser.y"
+        {
 		OUTYY(("P(server_serve_expired:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->serve_expired = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3484 "util/configparser.c" /* yacc.c:1646  */
+#line 3627 "util/configparser.c"
     break;
 
-  case 279:
-#line 1227 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 315: /* server_fake_dsa: VAR_FAKE_DSA STRING_ARG  */
+#line 1384 "./util/configparser.y"
+        {
 		OUTYY(("P(server_fake_dsa:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3496,70 +3639,70 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 3500 "util/configparser.c" /* yacc.c:1646  */
+#line 3643 "util/configparser.c"
     break;
 
-  case 280:
-#line 1240 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 316: /* server_val_log_level: VAR_VAL_LOG_LEVEL STRING_ARG  */
+#line 1397 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_log_level:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->val_log_level = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3512 "util/configparser.c" /* yacc.c:1646  */
+#line 3655 "util/configparser.c"
     break;
 
-  case 281:
-#line 1249 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 317: /* server_val_nsec3_keysize_iterations: VAR_VAL_NSEC3_KEYSIZE_ITERATIONS STRING_ARG  */
+#line 1406 "./util/configparser.y"
+        {
 		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->val_nsec3_key_iterations);
 		cfg_parser->cfg->val_nsec3_key_iterations = (yyvsp[0].str);
 	}
-#line 3522 "util/configparser.c" /* yacc.c:1646  */
+#line 3665 "util/configparser.c"
     break;
 
-  case 282:
-#line 1256 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 318: /* server_add_holddown: VAR_ADD_HOLDDOWN STRING_ARG  */
+#line 1413 "./util/configparser.y"
+        {
 		OUTYY(("P(server_add_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->add_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3534 "util/configparser.c" /* yacc.c:1646  */
+#line 3677 "util/configparser.c"
     break;
 
-  case 283:
-#line 1265 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 319: /* server_del_holddown: VAR_DEL_HOLDDOWN STRING_ARG  */
+#line 1422 "./util/configparser.y"
+        {
 		OUTYY(("P(server_del_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->del_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3546 "util/configparser.c" /* yacc.c:1646  */
+#line 3689 "util/configparser.c"
     break;
 
-  case 284:
-#line 1274 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 320: /* server_keep_missing: VAR_KEEP_MISSING STRING_ARG  */
+#line 1431 "./util/configparser.y"
+        {
 		OUTYY(("P(server_keep_missing:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->keep_missing = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3558 "util/configparser.c" /* yacc.c:1646  */
+#line 3701 "util/configparser.c"
     break;
 
-  case 285:
-#line 1283 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 321: /* server_permit_small_holddown: VAR_PERMIT_SMALL_HOLDDOWN STRING_ARG  */
+#line 1440 "./util/configparser.y"
+        {
 		OUTYY(("P(server_permit_small_holddown:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3567,23 +3710,23 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3571 "util/configparser.c" /* yacc.c:1646  */
+#line 3714 "util/configparser.c"
     break;
 
-  case 286:
-#line 1292 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 322: /* server_key_cache_size: VAR_KEY_CACHE_SIZE STRING_ARG  */
+#line 1449 "./util/configparser.y"
+        {
 		OUTYY(("P(server_key_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->key_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3582 "util/configparser.c" /* yacc.c:1646  */
+#line 3725 "util/configparser.c"
     break;
 
-  case 287:
-#line 1300 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 323: /* server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG  */
+#line 1457 "./util/configparser.y"
+        {
 		OUTYY(("P(server_key_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3594,23 +3737,35 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3598 "util/configparser.c" /* yacc.c:1646  */
+#line 3741 "util/configparser.c"
     break;
 
-  case 288:
-#line 1313 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 324: /* server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG  */
+#line 1470 "./util/configparser.y"
+        {
 		OUTYY(("P(server_neg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->neg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3609 "util/configparser.c" /* yacc.c:1646  */
+#line 3752 "util/configparser.c"
     break;
 
-  case 289:
-#line 1321 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 325: /* server_nsec3_hash_cache_size: VAR_NSEC3_HASH_CACHE_SIZE STRING_ARG  */
+#line 1478 "./util/configparser.y"
+        {
+		OUTYY(("P(server_nsec3_hash_cache_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str),
+			&cfg_parser->cfg->nsec3_hash_cache_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 3764 "util/configparser.c"
+    break;
+
+  case 326: /* server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 1487 "./util/configparser.y"
+        {
 		OUTYY(("P(server_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
 		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
@@ -3636,22 +3791,22 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 3640 "util/configparser.c" /* yacc.c:1646  */
+#line 3795 "util/configparser.c"
     break;
 
-  case 290:
-#line 1349 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 327: /* server_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 1515 "./util/configparser.y"
+        {
 		OUTYY(("P(server_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->local_data, (yyvsp[0].str)))
 			fatal_exit("out of memory adding local-data");
 	}
-#line 3650 "util/configparser.c" /* yacc.c:1646  */
+#line 3805 "util/configparser.c"
     break;
 
-  case 291:
-#line 1356 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 328: /* server_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 1522 "./util/configparser.y"
+        {
 		char* ptr;
 		OUTYY(("P(server_local_data_ptr:%s)\n", (yyvsp[0].str)));
 		ptr = cfg_ptr_reverse((yyvsp[0].str));
@@ -3664,12 +3819,12 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 3668 "util/configparser.c" /* yacc.c:1646  */
+#line 3823 "util/configparser.c"
     break;
 
-  case 292:
-#line 1371 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 329: /* server_minimal_responses: VAR_MINIMAL_RESPONSES STRING_ARG  */
+#line 1537 "./util/configparser.y"
+        {
 		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3677,12 +3832,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3681 "util/configparser.c" /* yacc.c:1646  */
+#line 3836 "util/configparser.c"
     break;
 
-  case 293:
-#line 1381 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 330: /* server_rrset_roundrobin: VAR_RRSET_ROUNDROBIN STRING_ARG  */
+#line 1547 "./util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3690,44 +3845,44 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3694 "util/configparser.c" /* yacc.c:1646  */
+#line 3849 "util/configparser.c"
     break;
 
-  case 294:
-#line 1391 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 331: /* server_max_udp_size: VAR_MAX_UDP_SIZE STRING_ARG  */
+#line 1557 "./util/configparser.y"
+        {
 		OUTYY(("P(server_max_udp_size:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->max_udp_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3704 "util/configparser.c" /* yacc.c:1646  */
+#line 3859 "util/configparser.c"
     break;
 
-  case 295:
-#line 1398 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 332: /* server_dns64_prefix: VAR_DNS64_PREFIX STRING_ARG  */
+#line 1564 "./util/configparser.y"
+        {
 		OUTYY(("P(dns64_prefix:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dns64_prefix);
 		cfg_parser->cfg->dns64_prefix = (yyvsp[0].str);
 	}
-#line 3714 "util/configparser.c" /* yacc.c:1646  */
+#line 3869 "util/configparser.c"
     break;
 
-  case 296:
-#line 1405 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 333: /* server_dns64_synthall: VAR_DNS64_SYNTHALL STRING_ARG  */
+#line 1571 "./util/configparser.y"
+        {
 		OUTYY(("P(server_dns64_synthall:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dns64_synthall = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3726 "util/configparser.c" /* yacc.c:1646  */
+#line 3881 "util/configparser.c"
     break;
 
-  case 297:
-#line 1414 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 334: /* server_define_tag: VAR_DEFINE_TAG STRING_ARG  */
+#line 1580 "./util/configparser.y"
+        {
 		char* p, *s = (yyvsp[0].str);
 		OUTYY(("P(server_define_tag:%s)\n", (yyvsp[0].str)));
 		while((p=strsep(&s, " \t\n")) != NULL) {
@@ -3739,12 +3894,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3743 "util/configparser.c" /* yacc.c:1646  */
+#line 3898 "util/configparser.c"
     break;
 
-  case 298:
-#line 1428 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 335: /* server_local_zone_tag: VAR_LOCAL_ZONE_TAG STRING_ARG STRING_ARG  */
+#line 1594 "./util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -3761,12 +3916,12 @@ yyreduce:
 			}
 		}
 	}
-#line 3765 "util/configparser.c" /* yacc.c:1646  */
+#line 3920 "util/configparser.c"
     break;
 
-  case 299:
-#line 1447 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 336: /* server_access_control_tag: VAR_ACCESS_CONTROL_TAG STRING_ARG STRING_ARG  */
+#line 1613 "./util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -3783,12 +3938,12 @@ yyreduce:
 			}
 		}
 	}
-#line 3787 "util/configparser.c" /* yacc.c:1646  */
+#line 3942 "util/configparser.c"
     break;
 
-  case 300:
-#line 1466 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 337: /* server_access_control_tag_action: VAR_ACCESS_CONTROL_TAG_ACTION STRING_ARG STRING_ARG STRING_ARG  */
+#line 1632 "./util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_tag_action:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_actions,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -3798,12 +3953,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 3802 "util/configparser.c" /* yacc.c:1646  */
+#line 3957 "util/configparser.c"
     break;
 
-  case 301:
-#line 1478 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 338: /* server_access_control_tag_data: VAR_ACCESS_CONTROL_TAG_DATA STRING_ARG STRING_ARG STRING_ARG  */
+#line 1644 "./util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_tag_data:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_datas,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -3813,12 +3968,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 3817 "util/configparser.c" /* yacc.c:1646  */
+#line 3972 "util/configparser.c"
     break;
 
-  case 302:
-#line 1490 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 339: /* server_local_zone_override: VAR_LOCAL_ZONE_OVERRIDE STRING_ARG STRING_ARG STRING_ARG  */
+#line 1656 "./util/configparser.y"
+        {
 		OUTYY(("P(server_local_zone_override:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->local_zone_overrides,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -3828,12 +3983,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 3832 "util/configparser.c" /* yacc.c:1646  */
+#line 3987 "util/configparser.c"
     break;
 
-  case 303:
-#line 1502 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 340: /* server_access_control_view: VAR_ACCESS_CONTROL_VIEW STRING_ARG STRING_ARG  */
+#line 1668 "./util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_view:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->acl_view,
 			(yyvsp[-1].str), (yyvsp[0].str))) {
@@ -3842,58 +3997,58 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 3846 "util/configparser.c" /* yacc.c:1646  */
+#line 4001 "util/configparser.c"
     break;
 
-  case 304:
-#line 1513 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 341: /* server_ip_ratelimit: VAR_IP_RATELIMIT STRING_ARG  */
+#line 1679 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_ip_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ip_ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3858 "util/configparser.c" /* yacc.c:1646  */
+#line 4013 "util/configparser.c"
     break;
 
-  case 305:
-#line 1523 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 342: /* server_ratelimit: VAR_RATELIMIT STRING_ARG  */
+#line 1689 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3870 "util/configparser.c" /* yacc.c:1646  */
+#line 4025 "util/configparser.c"
     break;
 
-  case 306:
-#line 1532 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 343: /* server_ip_ratelimit_size: VAR_IP_RATELIMIT_SIZE STRING_ARG  */
+#line 1698 "./util/configparser.y"
+  {
   	OUTYY(("P(server_ip_ratelimit_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ip_ratelimit_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 3881 "util/configparser.c" /* yacc.c:1646  */
+#line 4036 "util/configparser.c"
     break;
 
-  case 307:
-#line 1540 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 344: /* server_ratelimit_size: VAR_RATELIMIT_SIZE STRING_ARG  */
+#line 1706 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ratelimit_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3892 "util/configparser.c" /* yacc.c:1646  */
+#line 4047 "util/configparser.c"
     break;
 
-  case 308:
-#line 1548 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 345: /* server_ip_ratelimit_slabs: VAR_IP_RATELIMIT_SLABS STRING_ARG  */
+#line 1714 "./util/configparser.y"
+  {
   	OUTYY(("P(server_ip_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
   		yyerror("number expected");
@@ -3904,12 +4059,12 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 3908 "util/configparser.c" /* yacc.c:1646  */
+#line 4063 "util/configparser.c"
     break;
 
-  case 309:
-#line 1561 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 346: /* server_ratelimit_slabs: VAR_RATELIMIT_SLABS STRING_ARG  */
+#line 1727 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3920,12 +4075,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3924 "util/configparser.c" /* yacc.c:1646  */
+#line 4079 "util/configparser.c"
     break;
 
-  case 310:
-#line 1574 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 347: /* server_ratelimit_for_domain: VAR_RATELIMIT_FOR_DOMAIN STRING_ARG STRING_ARG  */
+#line 1740 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_for_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
@@ -3936,12 +4091,12 @@ yyreduce:
 					"ratelimit-for-domain");
 		}
 	}
-#line 3940 "util/configparser.c" /* yacc.c:1646  */
+#line 4095 "util/configparser.c"
     break;
 
-  case 311:
-#line 1587 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 348: /* server_ratelimit_below_domain: VAR_RATELIMIT_BELOW_DOMAIN STRING_ARG STRING_ARG  */
+#line 1753 "./util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_below_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
@@ -3952,36 +4107,87 @@ yyreduce:
 					"ratelimit-below-domain");
 		}
 	}
-#line 3956 "util/configparser.c" /* yacc.c:1646  */
+#line 4111 "util/configparser.c"
     break;
 
-  case 312:
-#line 1600 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 349: /* server_ip_ratelimit_factor: VAR_IP_RATELIMIT_FACTOR STRING_ARG  */
+#line 1766 "./util/configparser.y"
+  { 
   	OUTYY(("P(server_ip_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
   	if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
   		yyerror("number expected");
   	else cfg_parser->cfg->ip_ratelimit_factor = atoi((yyvsp[0].str));
   	free((yyvsp[0].str));
 	}
-#line 3968 "util/configparser.c" /* yacc.c:1646  */
+#line 4123 "util/configparser.c"
     break;
 
-  case 313:
-#line 1609 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 350: /* server_rrl_ratelimit: VAR_RRL_RATELIMIT STRING_ARG  */
+#line 1775 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrl_ratelimit:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_ratelimit = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4135 "util/configparser.c"
+    break;
+
+  case 351: /* server_rrl_slip: VAR_RRL_SLIP STRING_ARG  */
+#line 1784 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrl_slip:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_slip = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4147 "util/configparser.c"
+    break;
+
+  case 352: /* server_rrl_size: VAR_RRL_SIZE STRING_ARG  */
+#line 1793 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrl_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->rrl_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 4158 "util/configparser.c"
+    break;
+
+  case 353: /* server_rrl_slabs: VAR_RRL_SLABS STRING_ARG  */
+#line 1801 "./util/configparser.y"
+        {
+		OUTYY(("P(server_rrl_slabs:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0)
+			yyerror("number expected");
+		else {
+			cfg_parser->cfg->rrl_slabs = atoi((yyvsp[0].str));
+			if(!is_pow2(cfg_parser->cfg->rrl_slabs))
+				yyerror("must be a power of 2");
+		}
+		free((yyvsp[0].str));
+	}
+#line 4174 "util/configparser.c"
+    break;
+
+  case 354: /* server_ratelimit_factor: VAR_RATELIMIT_FACTOR STRING_ARG  */
+#line 1814 "./util/configparser.y"
+        { 
 		OUTYY(("P(server_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ratelimit_factor = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3980 "util/configparser.c" /* yacc.c:1646  */
+#line 4186 "util/configparser.c"
     break;
 
-  case 314:
-#line 1618 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 355: /* server_qname_minimisation: VAR_QNAME_MINIMISATION STRING_ARG  */
+#line 1823 "./util/configparser.y"
+        {
 		OUTYY(("P(server_qname_minimisation:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3989,12 +4195,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3993 "util/configparser.c" /* yacc.c:1646  */
+#line 4199 "util/configparser.c"
     break;
 
-  case 315:
-#line 1628 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 356: /* server_qname_minimisation_strict: VAR_QNAME_MINIMISATION_STRICT STRING_ARG  */
+#line 1833 "./util/configparser.y"
+        {
 		OUTYY(("P(server_qname_minimisation_strict:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4002,12 +4208,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4006 "util/configparser.c" /* yacc.c:1646  */
+#line 4212 "util/configparser.c"
     break;
 
-  case 316:
-#line 1638 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 357: /* stub_name: VAR_NAME STRING_ARG  */
+#line 1843 "./util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->stubs->name)
 			yyerror("stub name override, there must be one name "
@@ -4015,44 +4221,44 @@ yyreduce:
 		free(cfg_parser->cfg->stubs->name);
 		cfg_parser->cfg->stubs->name = (yyvsp[0].str);
 	}
-#line 4019 "util/configparser.c" /* yacc.c:1646  */
+#line 4225 "util/configparser.c"
     break;
 
-  case 317:
-#line 1648 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 358: /* stub_host: VAR_STUB_HOST STRING_ARG  */
+#line 1853 "./util/configparser.y"
+        {
 		OUTYY(("P(stub-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4029 "util/configparser.c" /* yacc.c:1646  */
+#line 4235 "util/configparser.c"
     break;
 
-  case 318:
-#line 1655 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 359: /* stub_addr: VAR_STUB_ADDR STRING_ARG  */
+#line 1860 "./util/configparser.y"
+        {
 		OUTYY(("P(stub-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4039 "util/configparser.c" /* yacc.c:1646  */
+#line 4245 "util/configparser.c"
     break;
 
-  case 319:
-#line 1662 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 360: /* stub_first: VAR_STUB_FIRST STRING_ARG  */
+#line 1867 "./util/configparser.y"
+        {
 		OUTYY(("P(stub-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stubs->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4051 "util/configparser.c" /* yacc.c:1646  */
+#line 4257 "util/configparser.c"
     break;
 
-  case 320:
-#line 1671 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 361: /* stub_ssl_upstream: VAR_STUB_SSL_UPSTREAM STRING_ARG  */
+#line 1876 "./util/configparser.y"
+        {
 		OUTYY(("P(stub-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4060,12 +4266,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4064 "util/configparser.c" /* yacc.c:1646  */
+#line 4270 "util/configparser.c"
     break;
 
-  case 321:
-#line 1681 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 362: /* stub_prime: VAR_STUB_PRIME STRING_ARG  */
+#line 1886 "./util/configparser.y"
+        {
 		OUTYY(("P(stub-prime:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4073,12 +4279,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4077 "util/configparser.c" /* yacc.c:1646  */
+#line 4283 "util/configparser.c"
     break;
 
-  case 322:
-#line 1691 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 363: /* forward_name: VAR_NAME STRING_ARG  */
+#line 1896 "./util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->forwards->name)
 			yyerror("forward name override, there must be one "
@@ -4086,44 +4292,44 @@ yyreduce:
 		free(cfg_parser->cfg->forwards->name);
 		cfg_parser->cfg->forwards->name = (yyvsp[0].str);
 	}
-#line 4090 "util/configparser.c" /* yacc.c:1646  */
+#line 4296 "util/configparser.c"
     break;
 
-  case 323:
-#line 1701 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 364: /* forward_host: VAR_FORWARD_HOST STRING_ARG  */
+#line 1906 "./util/configparser.y"
+        {
 		OUTYY(("P(forward-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4100 "util/configparser.c" /* yacc.c:1646  */
+#line 4306 "util/configparser.c"
     break;
 
-  case 324:
-#line 1708 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 365: /* forward_addr: VAR_FORWARD_ADDR STRING_ARG  */
+#line 1913 "./util/configparser.y"
+        {
 		OUTYY(("P(forward-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4110 "util/configparser.c" /* yacc.c:1646  */
+#line 4316 "util/configparser.c"
     break;
 
-  case 325:
-#line 1715 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 366: /* forward_first: VAR_FORWARD_FIRST STRING_ARG  */
+#line 1920 "./util/configparser.y"
+        {
 		OUTYY(("P(forward-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->forwards->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4122 "util/configparser.c" /* yacc.c:1646  */
+#line 4328 "util/configparser.c"
     break;
 
-  case 326:
-#line 1724 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 367: /* forward_ssl_upstream: VAR_FORWARD_SSL_UPSTREAM STRING_ARG  */
+#line 1929 "./util/configparser.y"
+        {
 		OUTYY(("P(forward-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4131,12 +4337,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4135 "util/configparser.c" /* yacc.c:1646  */
+#line 4341 "util/configparser.c"
     break;
 
-  case 327:
-#line 1734 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 368: /* view_name: VAR_NAME STRING_ARG  */
+#line 1939 "./util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->views->name)
 			yyerror("view name override, there must be one "
@@ -4144,12 +4350,12 @@ yyreduce:
 		free(cfg_parser->cfg->views->name);
 		cfg_parser->cfg->views->name = (yyvsp[0].str);
 	}
-#line 4148 "util/configparser.c" /* yacc.c:1646  */
+#line 4354 "util/configparser.c"
     break;
 
-  case 328:
-#line 1744 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 369: /* view_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 1949 "./util/configparser.y"
+        {
 		OUTYY(("P(view_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
 		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
@@ -4176,44 +4382,44 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 4180 "util/configparser.c" /* yacc.c:1646  */
+#line 4386 "util/configparser.c"
     break;
 
-  case 329:
-#line 1773 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 370: /* view_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 1978 "./util/configparser.y"
+        {
 		OUTYY(("P(view_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->views->local_data, (yyvsp[0].str))) {
 			fatal_exit("out of memory adding local-data");
 			free((yyvsp[0].str));
 		}
 	}
-#line 4192 "util/configparser.c" /* yacc.c:1646  */
+#line 4398 "util/configparser.c"
     break;
 
-  case 330:
-#line 1782 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 371: /* view_first: VAR_VIEW_FIRST STRING_ARG  */
+#line 1987 "./util/configparser.y"
+        {
 		OUTYY(("P(view-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->views->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4204 "util/configparser.c" /* yacc.c:1646  */
+#line 4410 "util/configparser.c"
     break;
 
-  case 331:
-#line 1791 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 372: /* rcstart: VAR_REMOTE_CONTROL  */
+#line 1996 "./util/configparser.y"
+        { 
 		OUTYY(("\nP(remote-control:)\n")); 
 	}
-#line 4212 "util/configparser.c" /* yacc.c:1646  */
+#line 4418 "util/configparser.c"
     break;
 
-  case 342:
-#line 1802 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 383: /* rc_control_enable: VAR_CONTROL_ENABLE STRING_ARG  */
+#line 2007 "./util/configparser.y"
+        {
 		OUTYY(("P(control_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4221,34 +4427,34 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4225 "util/configparser.c" /* yacc.c:1646  */
+#line 4431 "util/configparser.c"
     break;
 
-  case 343:
-#line 1812 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 384: /* rc_control_port: VAR_CONTROL_PORT STRING_ARG  */
+#line 2017 "./util/configparser.y"
+        {
 		OUTYY(("P(control_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("control port number expected");
 		else cfg_parser->cfg->control_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4237 "util/configparser.c" /* yacc.c:1646  */
+#line 4443 "util/configparser.c"
     break;
 
-  case 344:
-#line 1821 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 385: /* rc_control_interface: VAR_CONTROL_INTERFACE STRING_ARG  */
+#line 2026 "./util/configparser.y"
+        {
 		OUTYY(("P(control_interface:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->control_ifs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4247 "util/configparser.c" /* yacc.c:1646  */
+#line 4453 "util/configparser.c"
     break;
 
-  case 345:
-#line 1828 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 386: /* rc_control_use_cert: VAR_CONTROL_USE_CERT STRING_ARG  */
+#line 2033 "./util/configparser.y"
+        {
 		OUTYY(("P(control_use_cert:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4256,213 +4462,231 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4260 "util/configparser.c" /* yacc.c:1646  */
+#line 4466 "util/configparser.c"
     break;
 
-  case 346:
-#line 1838 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 387: /* rc_server_key_file: VAR_SERVER_KEY_FILE STRING_ARG  */
+#line 2043 "./util/configparser.y"
+        {
 		OUTYY(("P(rc_server_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_key_file);
 		cfg_parser->cfg->server_key_file = (yyvsp[0].str);
 	}
-#line 4270 "util/configparser.c" /* yacc.c:1646  */
+#line 4476 "util/configparser.c"
     break;
 
-  case 347:
-#line 1845 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 388: /* rc_server_cert_file: VAR_SERVER_CERT_FILE STRING_ARG  */
+#line 2050 "./util/configparser.y"
+        {
 		OUTYY(("P(rc_server_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_cert_file);
 		cfg_parser->cfg->server_cert_file = (yyvsp[0].str);
 	}
-#line 4280 "util/configparser.c" /* yacc.c:1646  */
+#line 4486 "util/configparser.c"
     break;
 
-  case 348:
-#line 1852 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 389: /* rc_control_key_file: VAR_CONTROL_KEY_FILE STRING_ARG  */
+#line 2057 "./util/configparser.y"
+        {
 		OUTYY(("P(rc_control_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_key_file);
 		cfg_parser->cfg->control_key_file = (yyvsp[0].str);
 	}
-#line 4290 "util/configparser.c" /* yacc.c:1646  */
+#line 4496 "util/configparser.c"
     break;
 
-  case 349:
-#line 1859 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 390: /* rc_control_cert_file: VAR_CONTROL_CERT_FILE STRING_ARG  */
+#line 2064 "./util/configparser.y"
+        {
 		OUTYY(("P(rc_control_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_cert_file);
 		cfg_parser->cfg->control_cert_file = (yyvsp[0].str);
 	}
-#line 4300 "util/configparser.c" /* yacc.c:1646  */
+#line 4506 "util/configparser.c"
     break;
 
-  case 350:
-#line 1866 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 391: /* dtstart: VAR_DNSTAP  */
+#line 2071 "./util/configparser.y"
+        {
 		OUTYY(("\nP(dnstap:)\n"));
 	}
-#line 4308 "util/configparser.c" /* yacc.c:1646  */
+#line 4514 "util/configparser.c"
     break;
 
-  case 365:
-#line 1883 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 406: /* dt_dnstap_enable: VAR_DNSTAP_ENABLE STRING_ARG  */
+#line 2088 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4319 "util/configparser.c" /* yacc.c:1646  */
+#line 4525 "util/configparser.c"
     break;
 
-  case 366:
-#line 1891 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 407: /* dt_dnstap_socket_path: VAR_DNSTAP_SOCKET_PATH STRING_ARG  */
+#line 2096 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_socket_path:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_socket_path);
 		cfg_parser->cfg->dnstap_socket_path = (yyvsp[0].str);
 	}
-#line 4329 "util/configparser.c" /* yacc.c:1646  */
+#line 4535 "util/configparser.c"
     break;
 
-  case 367:
-#line 1898 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 408: /* dt_dnstap_send_identity: VAR_DNSTAP_SEND_IDENTITY STRING_ARG  */
+#line 2103 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_send_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_send_identity = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4340 "util/configparser.c" /* yacc.c:1646  */
+#line 4546 "util/configparser.c"
     break;
 
-  case 368:
-#line 1906 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 409: /* dt_dnstap_send_version: VAR_DNSTAP_SEND_VERSION STRING_ARG  */
+#line 2111 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_send_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_send_version = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4351 "util/configparser.c" /* yacc.c:1646  */
+#line 4557 "util/configparser.c"
     break;
 
-  case 369:
-#line 1914 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 410: /* dt_dnstap_identity: VAR_DNSTAP_IDENTITY STRING_ARG  */
+#line 2119 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_identity);
 		cfg_parser->cfg->dnstap_identity = (yyvsp[0].str);
 	}
-#line 4361 "util/configparser.c" /* yacc.c:1646  */
+#line 4567 "util/configparser.c"
     break;
 
-  case 370:
-#line 1921 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 411: /* dt_dnstap_version: VAR_DNSTAP_VERSION STRING_ARG  */
+#line 2126 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_version);
 		cfg_parser->cfg->dnstap_version = (yyvsp[0].str);
 	}
-#line 4371 "util/configparser.c" /* yacc.c:1646  */
+#line 4577 "util/configparser.c"
     break;
 
-  case 371:
-#line 1928 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 412: /* dt_dnstap_log_resolver_query_messages: VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES STRING_ARG  */
+#line 2133 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_resolver_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_resolver_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4383 "util/configparser.c" /* yacc.c:1646  */
+#line 4589 "util/configparser.c"
     break;
 
-  case 372:
-#line 1937 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 413: /* dt_dnstap_log_resolver_response_messages: VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2142 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_resolver_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_resolver_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4395 "util/configparser.c" /* yacc.c:1646  */
+#line 4601 "util/configparser.c"
     break;
 
-  case 373:
-#line 1946 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 414: /* dt_dnstap_log_client_query_messages: VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES STRING_ARG  */
+#line 2151 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_client_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_client_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4407 "util/configparser.c" /* yacc.c:1646  */
+#line 4613 "util/configparser.c"
     break;
 
-  case 374:
-#line 1955 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 415: /* dt_dnstap_log_client_response_messages: VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES STRING_ARG  */
+#line 2160 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_client_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_client_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4419 "util/configparser.c" /* yacc.c:1646  */
+#line 4625 "util/configparser.c"
     break;
 
-  case 375:
-#line 1964 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 416: /* dt_dnstap_log_forwarder_query_messages: VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES STRING_ARG  */
+#line 2169 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_forwarder_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_forwarder_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4431 "util/configparser.c" /* yacc.c:1646  */
+#line 4637 "util/configparser.c"
     break;
 
-  case 376:
-#line 1973 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 417: /* dt_dnstap_log_forwarder_response_messages: VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2178 "./util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_forwarder_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_forwarder_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 4443 "util/configparser.c" /* yacc.c:1646  */
+#line 4649 "util/configparser.c"
     break;
 
-  case 377:
-#line 1982 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 418: /* pythonstart: VAR_PYTHON  */
+#line 2187 "./util/configparser.y"
+        { 
 		OUTYY(("\nP(python:)\n")); 
 	}
-#line 4451 "util/configparser.c" /* yacc.c:1646  */
+#line 4657 "util/configparser.c"
     break;
 
-  case 381:
-#line 1991 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 422: /* py_script: VAR_PYTHON_SCRIPT STRING_ARG  */
+#line 2196 "./util/configparser.y"
+        {
 		OUTYY(("P(python-script:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->python_script);
 		cfg_parser->cfg->python_script = (yyvsp[0].str);
 	}
-#line 4461 "util/configparser.c" /* yacc.c:1646  */
+#line 4667 "util/configparser.c"
     break;
 
-  case 382:
-#line 1997 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 423: /* dynlibstart: VAR_DYNLIB  */
+#line 2202 "./util/configparser.y"
+        { 
+		OUTYY(("\nP(dynlib:)\n")); 
+	}
+#line 4675 "util/configparser.c"
+    break;
+
+  case 427: /* dl_file: VAR_DYNLIB_FILE STRING_ARG  */
+#line 2211 "./util/configparser.y"
+        {
+		OUTYY(("P(dynlib-file:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->dynlib_file);
+		cfg_parser->cfg->dynlib_file = (yyvsp[0].str);
+	}
+#line 4685 "util/configparser.c"
+    break;
+
+  case 428: /* server_disable_dnssec_lame_check: VAR_DISABLE_DNSSEC_LAME_CHECK STRING_ARG  */
+#line 2217 "./util/configparser.y"
+        {
 		OUTYY(("P(disable_dnssec_lame_check:%s)\n", (yyvsp[0].str)));
 		if (strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4470,21 +4694,22 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4474 "util/configparser.c" /* yacc.c:1646  */
+#line 4698 "util/configparser.c"
     break;
 
-  case 383:
-#line 2007 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 429: /* server_log_identity: VAR_LOG_IDENTITY STRING_ARG  */
+#line 2227 "./util/configparser.y"
+        {
 		OUTYY(("P(server_log_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->log_identity);
 		cfg_parser->cfg->log_identity = (yyvsp[0].str);
 	}
-#line 4484 "util/configparser.c" /* yacc.c:1646  */
+#line 4708 "util/configparser.c"
     break;
 
 
-#line 4488 "util/configparser.c" /* yacc.c:1646  */
+#line 4712 "util/configparser.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -4498,25 +4723,23 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -4527,50 +4750,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -4599,12 +4786,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -4621,13 +4807,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -4641,7 +4828,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -4653,7 +4840,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -4664,26 +4851,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -4699,20 +4890,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 2013 "./util/configparser.y" /* yacc.c:1906  */
+
+#line 2233 "./util/configparser.y"
 
 
 /* parse helper routines could be here */
@@ -136,13 +136,21 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_VIEW_FIRST VAR_SERVE_EXPIRED VAR_FAKE_DSA
 %token VAR_LOG_IDENTITY
 %token VAR_USE_SYSTEMD
+%token VAR_HEDGE_PERCENTILE VAR_HEDGE_BUDGET VAR_TARGET_FETCH_PARALLEL
+%token VAR_METRICS_ENABLE VAR_METRICS_INTERFACE VAR_METRICS_PORT
+%token VAR_MESH_CLIENT_QUOTA VAR_MESH_ZONE_QUOTA VAR_MESH_PREFETCH_RESERVE
+%token VAR_RRL_RATELIMIT VAR_RRL_SLIP VAR_RRL_SIZE VAR_RRL_SLABS
+%token VAR_OUTGOING_UDP_POOL VAR_OUTGOING_UDP_POOL_ROTATE
+%token VAR_OUTGOING_UDP_POOL_USES
+%token VAR_NSEC3_HASH_CACHE_SIZE VAR_DYNLIB VAR_DYNLIB_FILE
+%token VAR_LOG_ASYNC VAR_LOG_ASYNC_SIZE VAR_LOG_BINARY_FILE
 
 %%
 toplevelvars: /* empty */ | toplevelvars toplevelvar ;
 toplevelvar: serverstart contents_server | stubstart contents_stub |
 	forwardstart contents_forward | pythonstart contents_py | 
 	rcstart contents_rc | dtstart contents_dt | viewstart 
-	contents_view
+	contents_view | dynlibstart contents_dl
 	;
 
 /* server: declaration */
@@ -213,7 +221,17 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_local_zone_override | server_access_control_tag_action |
 	server_access_control_tag_data | server_access_control_view |
 	server_qname_minimisation_strict | server_serve_expired |
-	server_fake_dsa | server_log_identity | server_use_systemd
+	server_fake_dsa | server_log_identity | server_use_systemd |
+	server_hedge_percentile | server_hedge_budget |
+	server_target_fetch_parallel | server_metrics_enable |
+	server_metrics_interface | server_metrics_port |
+	server_mesh_client_quota | server_mesh_zone_quota |
+	server_mesh_prefetch_reserve | server_rrl_ratelimit |
+	server_rrl_slip | server_rrl_size | server_rrl_slabs |
+	server_outgoing_udp_pool | server_outgoing_udp_pool_rotate |
+	server_outgoing_udp_pool_uses |
+	server_nsec3_hash_cache_size | server_log_async |
+	server_log_async_size | server_log_binary_file
 	;
 stubstart: VAR_STUB_ZONE
 	{
@@ -272,6 +290,8 @@ server_num_threads: VAR_NUM_THREADS STRING_ARG
 		OUTYY(("P(server_num_threads:%s)\n", $2)); 
 		if(atoi($2) == 0 && strcmp($2, "0") != 0)
 			yyerror("number expected");
+		else if(atoi($2) < 0 || atoi($2) > CFG_MAX_THREADS)
+			yyerror("num-threads must be between 0 and 10000");
 		else cfg_parser->cfg->num_threads = atoi($2);
 		free($2);
 	}
@@ -568,6 +588,31 @@ server_log_replies: VAR_LOG_REPLIES STRING_ARG
   	free($2);
   }
   ;
+server_log_async: VAR_LOG_ASYNC STRING_ARG
+	{
+		OUTYY(("P(server_log_async:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->log_async = (strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_log_async_size: VAR_LOG_ASYNC_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_log_async_size:%s)\n", $2));
+		if(atoi($2) <= 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->log_async_size = (size_t)atoi($2);
+		free($2);
+	}
+	;
+server_log_binary_file: VAR_LOG_BINARY_FILE STRING_ARG
+	{
+		OUTYY(("P(server_log_binary_file:%s)\n", $2));
+		free(cfg_parser->cfg->log_binary_file);
+		cfg_parser->cfg->log_binary_file = $2;
+	}
+	;
 server_chroot: VAR_CHROOT STRING_ARG
 	{
 		OUTYY(("P(server_chroot:%s)\n", $2));
@@ -832,6 +877,33 @@ server_delay_close: VAR_DELAY_CLOSE STRING_ARG
 		free($2);
 	}
 	;
+server_outgoing_udp_pool: VAR_OUTGOING_UDP_POOL STRING_ARG
+	{
+		OUTYY(("P(server_outgoing_udp_pool:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->outgoing_udp_pool = atoi($2);
+		free($2);
+	}
+	;
+server_outgoing_udp_pool_rotate: VAR_OUTGOING_UDP_POOL_ROTATE STRING_ARG
+	{
+		OUTYY(("P(server_outgoing_udp_pool_rotate:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->outgoing_udp_pool_rotate = atoi($2);
+		free($2);
+	}
+	;
+server_outgoing_udp_pool_uses: VAR_OUTGOING_UDP_POOL_USES STRING_ARG
+	{
+		OUTYY(("P(server_outgoing_udp_pool_uses:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->outgoing_udp_pool_uses = atoi($2);
+		free($2);
+	}
+	;
 server_unblock_lan_zones: VAR_UNBLOCK_LAN_ZONES STRING_ARG
 	{
 		OUTYY(("P(server_unblock_lan_zones:%s)\n", $2));
@@ -929,6 +1001,28 @@ server_infra_cache_min_rtt: VAR_INFRA_CACHE_MIN_RTT STRING_ARG
 		free($2);
 	}
 	;
+server_hedge_percentile: VAR_HEDGE_PERCENTILE STRING_ARG
+	{
+		OUTYY(("P(server_hedge_percentile:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0 || atoi($2) > 99)
+			yyerror("percentile must be between 0 and 99");
+		else cfg_parser->cfg->hedge_percentile = atoi($2);
+		free($2);
+	}
+	;
+server_hedge_budget: VAR_HEDGE_BUDGET STRING_ARG
+	{
+		OUTYY(("P(server_hedge_budget:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else if(atoi($2) < 0 || atoi($2) > 100)
+			yyerror("percentage must be between 0 and 100");
+		else cfg_parser->cfg->hedge_budget = atoi($2);
+		free($2);
+	}
+	;
 server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG
 	{
 		OUTYY(("P(server_target_fetch_policy:%s)\n", $2));
@@ -936,6 +1030,69 @@ server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG
 		cfg_parser->cfg->target_fetch_policy = $2;
 	}
 	;
+server_target_fetch_parallel: VAR_TARGET_FETCH_PARALLEL STRING_ARG
+	{
+		OUTYY(("P(server_target_fetch_parallel:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->target_fetch_parallel = 
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_metrics_enable: VAR_METRICS_ENABLE STRING_ARG
+	{
+		OUTYY(("P(server_metrics_enable:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->metrics_enable = 
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_metrics_interface: VAR_METRICS_INTERFACE STRING_ARG
+	{
+		OUTYY(("P(server_metrics_interface:%s)\n", $2));
+		if(!cfg_strlist_insert(&cfg_parser->cfg->metrics_ifs, $2))
+			yyerror("out of memory");
+	}
+	;
+server_metrics_port: VAR_METRICS_PORT STRING_ARG
+	{
+		OUTYY(("P(server_metrics_port:%s)\n", $2));
+		if(atoi($2) == 0)
+			yyerror("port number expected");
+		else cfg_parser->cfg->metrics_port = atoi($2);
+		free($2);
+	}
+	;
+server_mesh_client_quota: VAR_MESH_CLIENT_QUOTA STRING_ARG
+	{
+		OUTYY(("P(server_mesh_client_quota:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->mesh_client_quota = atoi($2);
+		free($2);
+	}
+	;
+server_mesh_zone_quota: VAR_MESH_ZONE_QUOTA STRING_ARG
+	{
+		OUTYY(("P(server_mesh_zone_quota:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->mesh_zone_quota = atoi($2);
+		free($2);
+	}
+	;
+server_mesh_prefetch_reserve: VAR_MESH_PREFETCH_RESERVE STRING_ARG
+	{
+		OUTYY(("P(server_mesh_prefetch_reserve:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->mesh_prefetch_reserve = atoi($2);
+		free($2);
+	}
+	;
 server_harden_short_bufsize: VAR_HARDEN_SHORT_BUFSIZE STRING_ARG
 	{
 		OUTYY(("P(server_harden_short_bufsize:%s)\n", $2));
@@ -1317,6 +1474,15 @@ server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG
 		free($2);
 	}
 	;
+server_nsec3_hash_cache_size: VAR_NSEC3_HASH_CACHE_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_nsec3_hash_cache_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2,
+			&cfg_parser->cfg->nsec3_hash_cache_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
 server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG
 	{
 		OUTYY(("P(server_local_zone:%s %s)\n", $2, $3));
@@ -1605,6 +1771,45 @@ server_ip_ratelimit_factor: VAR_IP_RATELIMIT_FACTOR STRING_ARG
   	free($2);
 	}
 	;
+server_rrl_ratelimit: VAR_RRL_RATELIMIT STRING_ARG
+	{
+		OUTYY(("P(server_rrl_ratelimit:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_ratelimit = atoi($2);
+		free($2);
+	}
+	;
+server_rrl_slip: VAR_RRL_SLIP STRING_ARG
+	{
+		OUTYY(("P(server_rrl_slip:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->rrl_slip = atoi($2);
+		free($2);
+	}
+	;
+server_rrl_size: VAR_RRL_SIZE STRING_ARG
+	{
+		OUTYY(("P(server_rrl_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2, &cfg_parser->cfg->rrl_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+server_rrl_slabs: VAR_RRL_SLABS STRING_ARG
+	{
+		OUTYY(("P(server_rrl_slabs:%s)\n", $2));
+		if(atoi($2) == 0)
+			yyerror("number expected");
+		else {
+			cfg_parser->cfg->rrl_slabs = atoi($2);
+			if(!is_pow2(cfg_parser->cfg->rrl_slabs))
+				yyerror("must be a power of 2");
+		}
+		free($2);
+	}
+	;
 server_ratelimit_factor: VAR_RATELIMIT_FACTOR STRING_ARG 
 	{ 
 		OUTYY(("P(server_ratelimit_factor:%s)\n", $2)); 
@@ -1993,6 +2198,21 @@ py_script: VAR_PYTHON_SCRIPT STRING_ARG
 		free(cfg_parser->cfg->python_script);
 		cfg_parser->cfg->python_script = $2;
 	}
+dynlibstart: VAR_DYNLIB
+	{ 
+		OUTYY(("\nP(dynlib:)\n")); 
+	}
+	;
+contents_dl: contents_dl content_dl
+	| ;
+content_dl: dl_file
+	;
+dl_file: VAR_DYNLIB_FILE STRING_ARG
+	{
+		OUTYY(("P(dynlib-file:%s)\n", $2));
+		free(cfg_parser->cfg->dynlib_file);
+		cfg_parser->cfg->dynlib_file = $2;
+	}
 server_disable_dnssec_lame_check: VAR_DISABLE_DNSSEC_LAME_CHECK STRING_ARG
 	{
 		OUTYY(("P(disable_dnssec_lame_check:%s)\n", $2));
@@ -44,9 +44,237 @@
 #include "util/data/dname.h"
 #include "util/data/msgparse.h"
 #include "util/log.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "sldns/sbuffer.h"
 
+/* The case folding and case insensitive compare of names is done with
+ * SSE2 (always there on x86_64), or AVX2 if the cpu has it at runtime. */
+#if defined(__SSE2__) && !defined(DNAME_NO_SIMD)
+#define USE_DNAME_SSE2 1
+#include <emmintrin.h>
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || \
+	(defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && \
+	__GNUC_MINOR__ >= 9))))
+#define USE_DNAME_AVX2 1
+#include <immintrin.h>
+#endif
+#endif
+
+/** lowercase a byte of a domain name, only 'A'-'Z' (RFC 4343), the same as
+ * tolower in the C locale but independent of the locale of the program */
+#define DNAME_LOWER(c) ((uint8_t)((c) | ((((unsigned)(c))-'A' < 26u) << 5)))
+
+/** the vector instructions in use.  The baseline is known at compile
+ * time, AVX2 is detected by a constructor that runs before main, so no
+ * thread ever sees it change. */
+#ifdef USE_DNAME_SSE2
+static int dname_simd = DNAME_SIMD_SSE2;
+#else
+static int dname_simd = DNAME_SIMD_NONE;
+#endif
+
+/** the best vector instructions the cpu and compiler support */
+static int
+dname_simd_detect(void)
+{
+#ifdef USE_DNAME_AVX2
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("avx2"))
+		return DNAME_SIMD_AVX2;
+#endif
+#ifdef USE_DNAME_SSE2
+	return DNAME_SIMD_SSE2;
+#else
+	return DNAME_SIMD_NONE;
+#endif
+}
+
+#ifdef USE_DNAME_AVX2
+/** select the vector instructions at program start, before threads */
+static void dname_simd_init(void) __attribute__((constructor));
+
+static void
+dname_simd_init(void)
+{
+	dname_simd = dname_simd_detect();
+}
+#endif
+
+int
+dname_simd_select(int level)
+{
+	int max = dname_simd_detect();
+	if(level < 0 || level > max)
+		level = max;
+	dname_simd = level;
+	return level;
+}
+
+/** get the vector instructions to use */
+static int
+dname_simd_level(void)
+{
+	return dname_simd;
+}
+
+#ifdef USE_DNAME_SSE2
+/** lowercase 16 bytes, like DNAME_LOWER */
+static __m128i
+fold_sse2(__m128i v)
+{
+	/* bytes >= 0x80 are negative in the signed compare */
+	__m128i up = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A'-1)),
+		_mm_cmplt_epi8(v, _mm_set1_epi8('Z'+1)));
+	return _mm_or_si128(v, _mm_and_si128(up, _mm_set1_epi8(0x20)));
+}
+
+/** lowercase copy whole blocks, returns number of bytes done */
+static size_t
+lowercopy_sse2(uint8_t* to, uint8_t* from, size_t len)
+{
+	size_t i;
+	for(i=0; i+16 <= len; i+=16)
+		_mm_storeu_si128((__m128i*)(to+i), fold_sse2(
+			_mm_loadu_si128((__m128i*)(from+i))));
+	return i;
+}
+
+/** lowercase compare whole blocks, returns position of the first
+ * difference, or the number of bytes done if they are all equal */
+static size_t
+lowereq_sse2(uint8_t* p1, uint8_t* p2, size_t len)
+{
+	size_t i;
+	unsigned int m;
+	for(i=0; i+16 <= len; i+=16) {
+		m = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(
+			fold_sse2(_mm_loadu_si128((__m128i*)(p1+i))),
+			fold_sse2(_mm_loadu_si128((__m128i*)(p2+i)))));
+		if(m != 0xffff)
+			return i + (size_t)__builtin_ctz(~m);
+	}
+	return i;
+}
+#endif /* USE_DNAME_SSE2 */
+
+#ifdef USE_DNAME_AVX2
+/** lowercase 32 bytes, 'A'-'Z' only */
+static __attribute__((target("avx2"))) __m256i
+fold_avx2(__m256i v)
+{
+	__m256i up = _mm256_and_si256(_mm256_cmpgt_epi8(v,
+		_mm256_set1_epi8('A'-1)), _mm256_cmpgt_epi8(
+		_mm256_set1_epi8('Z'+1), v));
+	return _mm256_or_si256(v, _mm256_and_si256(up,
+		_mm256_set1_epi8(0x20)));
+}
+
+/** lowercase copy whole blocks, returns number of bytes done */
+static __attribute__((target("avx2"))) size_t
+lowercopy_avx2(uint8_t* to, uint8_t* from, size_t len)
+{
+	size_t i;
+	for(i=0; i+32 <= len; i+=32)
+		_mm256_storeu_si256((__m256i*)(to+i), fold_avx2(
+			_mm256_loadu_si256((__m256i*)(from+i))));
+	return i;
+}
+
+/** lowercase compare whole blocks, returns position of the first
+ * difference, or the number of bytes done if they are all equal */
+static __attribute__((target("avx2"))) size_t
+lowereq_avx2(uint8_t* p1, uint8_t* p2, size_t len)
+{
+	size_t i;
+	unsigned int m;
+	for(i=0; i+32 <= len; i+=32) {
+		m = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(
+			fold_avx2(_mm256_loadu_si256((__m256i*)(p1+i))),
+			fold_avx2(_mm256_loadu_si256((__m256i*)(p2+i)))));
+		if(m != 0xffffffff)
+			return i + (size_t)__builtin_ctz(~m);
+	}
+	return i;
+}
+#endif /* USE_DNAME_AVX2 */
+
+/**
+ * Copy bytes and lowercase them. Length bytes of names are not changed
+ * by this, so it can be used on whole uncompressed names.
+ * @param to: destination, can be the same as from.
+ * @param from: source.
+ * @param len: number of bytes.
+ */
+static void
+lowercopy(uint8_t* to, uint8_t* from, size_t len)
+{
+	size_t i = 0;
+#ifdef USE_DNAME_SSE2
+	/* most labels are short, and not worth the vector setup */
+	if(len >= 16) {
+		int level = dname_simd_level();
+#ifdef USE_DNAME_AVX2
+		if(level == DNAME_SIMD_AVX2 && len >= 32)
+			i = lowercopy_avx2(to, from, len);
+#endif
+		/* the remainder of AVX2, or all of it */
+		if(level != DNAME_SIMD_NONE)
+			i += lowercopy_sse2(to+i, from+i, len-i);
+	}
+#endif
+	for(; i<len; i++)
+		to[i] = DNAME_LOWER(from[i]);
+}
+
+/**
+ * Compare bytes in memory, lowercase while comparing.
+ * @param p1: bytes 1
+ * @param p2: bytes 2
+ * @param len: number of bytes to compare.
+ * @return: 0, -1, +1 comparison result.
+ */
+static int
+memlowercmp(uint8_t* p1, uint8_t* p2, size_t len)
+{
+	size_t i = 0;
+#ifdef USE_DNAME_SSE2
+	/* most labels are short, and not worth the vector setup */
+	if(len >= 16) {
+		int level = dname_simd_level();
+#ifdef USE_DNAME_AVX2
+		if(level == DNAME_SIMD_AVX2 && len >= 32)
+			i = lowereq_avx2(p1, p2, len);
+#endif
+		/* the remainder of AVX2, or all of it */
+		if(level != DNAME_SIMD_NONE)
+			i += lowereq_sse2(p1+i, p2+i, len-i);
+	}
+#endif
+	for(; i<len; i++) {
+		/* compare bytes first for speed */
+		if(p1[i] != p2[i] && DNAME_LOWER(p1[i]) != DNAME_LOWER(p2[i])) {
+			if(DNAME_LOWER(p1[i]) < DNAME_LOWER(p2[i]))
+				return -1;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/** length of uncompressed name, by following the label lengths */
+static size_t
+dname_size(uint8_t* dname)
+{
+	size_t len = 1;
+	uint8_t lablen = *dname;
+	while(lablen) {
+		len += lablen+1;
+		dname += lablen+1;
+		lablen = *dname;
+	}
+	return len;
+}
+
 /* determine length of a dname in buffer, no compression pointers allowed */
 size_t
 query_dname_len(sldns_buffer* query)
@@ -70,6 +298,22 @@ query_dname_len(sldns_buffer* query)
 	}
 }
 
+size_t
+query_dname_len_hash(sldns_buffer* query, struct keyhash_state* s)
+{
+	uint8_t buf[LDNS_MAX_DOMAINLEN+1];
+	uint8_t* dname = sldns_buffer_current(query);
+	size_t len = query_dname_len(query);
+	if(len == 0)
+		return 0;
+	/* lowercase the whole name in one go, the label length bytes are
+	 * not changed by that, and hash it without the root label, like
+	 * dname_query_hash_update */
+	lowercopy(buf, dname, len-1);
+	keyhash_update(s, buf, len-1);
+	return len;
+}
+
 size_t 
 dname_valid(uint8_t* dname, size_t maxlen)
 {
@@ -98,7 +342,17 @@ int
 query_dname_compare(register uint8_t* d1, register uint8_t* d2)
 {
 	register uint8_t lab1, lab2;
+	int c;
 	log_assert(d1 && d2);
+	if(dname_simd_level() != DNAME_SIMD_NONE) {
+		/* the names have the same labels up to the first difference,
+		 * and lowercasing does not change label lengths, so a
+		 * bytewise compare of the whole names gives the label by
+		 * label result: a shorter label (or the end of the name)
+		 * is a smaller length byte. Only read the shortest name. */
+		size_t len1 = dname_size(d1), len2 = dname_size(d2);
+		return memlowercmp(d1, d2, (len1<len2)?len1:len2);
+	}
 	lab1 = *d1++;
 	lab2 = *d2++;
 	while( lab1 != 0 || lab2 != 0 ) {
@@ -111,17 +365,10 @@ query_dname_compare(register uint8_t* d1, register uint8_t* d2)
 		}
 		log_assert(lab1 == lab2 && lab1 != 0);
 		/* compare lowercased labels. */
-		while(lab1--) {
-			/* compare bytes first for speed */
-			if(*d1 != *d2 && 
-				tolower((unsigned char)*d1) != tolower((unsigned char)*d2)) {
-				if(tolower((unsigned char)*d1) < tolower((unsigned char)*d2))
-					return -1;
-				return 1;
-			}
-			d1++;
-			d2++;
-		}
+		if((c=memlowercmp(d1, d2, lab1)) != 0)
+			return c;
+		d1 += lab1;
+		d2 += lab1;
 		/* next pair of labels. */
 		lab1 = *d1++;
 		lab2 = *d2++;
@@ -132,17 +379,9 @@ query_dname_compare(register uint8_t* d1, register uint8_t* d2)
 void 
 query_dname_tolower(uint8_t* dname)
 {
-	/* the dname is stored uncompressed */
-	uint8_t labellen;
-	labellen = *dname;
-	while(labellen) {
-		dname++;
-		while(labellen--) {
-			*dname = (uint8_t)tolower((unsigned char)*dname);
-			dname++;
-		}
-		labellen = *dname;
-	}
+	/* the dname is stored uncompressed, the label lengths are not
+	 * changed by lowercasing */
+	lowercopy(dname, dname, dname_size(dname));
 }
 
 void 
@@ -167,7 +406,7 @@ pkt_dname_tolower(sldns_buffer* pkt, uint8_t* dname)
 		if(dname+lablen >= sldns_buffer_end(pkt))
 			return;
 		while(lablen--) {
-			*dname = (uint8_t)tolower((unsigned char)*dname);
+			*dname = DNAME_LOWER(*dname);
 			dname++;
 		}
 		if(dname >= sldns_buffer_end(pkt))
@@ -231,6 +470,7 @@ int
 dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 {
 	uint8_t len1, len2;
+	int c;
 	log_assert(pkt && d1 && d2);
 	len1 = *d1++;
 	len2 = *d2++;
@@ -255,47 +495,33 @@ dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 		}
 		log_assert(len1 == len2 && len1 != 0);
 		/* compare labels */
-		while(len1--) {
-			if(tolower((unsigned char)*d1) != tolower((unsigned char)*d2)) {
-				if(tolower((unsigned char)*d1) < tolower((unsigned char)*d2))
-					return -1;
-				return 1;
-			}
-			d1++;
-			d2++;
-		}
+		if((c=memlowercmp(d1, d2, len1)) != 0)
+			return c;
+		d1 += len1;
+		d2 += len1;
 		len1 = *d1++;
 		len2 = *d2++;
 	}
 	return 0;
 }
 
-hashvalue_type
-dname_query_hash(uint8_t* dname, hashvalue_type h)
+void
+dname_query_hash_update(struct keyhash_state* s, uint8_t* dname)
 {
-	uint8_t labuf[LDNS_MAX_LABELLEN+1];
-	uint8_t lablen;
-	int i;
-
-	/* preserve case of query, make hash label by label */
-	lablen = *dname++;
-	while(lablen) {
-		log_assert(lablen <= LDNS_MAX_LABELLEN);
-		labuf[0] = lablen;
-		i=0;
-		while(lablen--) {
-			labuf[++i] = (uint8_t)tolower((unsigned char)*dname);
-			dname++;
-		}
-		h = hashlittle(labuf, labuf[0] + 1, h);
-		lablen = *dname++;
-	}
-
-	return h;
+	uint8_t buf[LDNS_MAX_DOMAINLEN+1];
+	size_t len = dname_size(dname);
+
+	/* preserve case of query, lowercase a copy, and hash the labels
+	 * in one go, without the root label (the same as
+	 * dname_pkt_hash_update) */
+	log_assert(len <= sizeof(buf));
+	lowercopy(buf, dname, len);
+	keyhash_update(s, buf, len-1);
 }
 
-hashvalue_type
-dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_type h)
+void
+dname_pkt_hash_update(struct keyhash_state* s, sldns_buffer* pkt,
+	uint8_t* dname)
 {
 	uint8_t labuf[LDNS_MAX_LABELLEN+1];
 	uint8_t lablen;
@@ -314,14 +540,32 @@ dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_type h)
 		labuf[0] = lablen;
 		i=0;
 		while(lablen--) {
-			labuf[++i] = (uint8_t)tolower((unsigned char)*dname);
+			labuf[++i] = DNAME_LOWER(*dname);
 			dname++;
 		}
-		h = hashlittle(labuf, labuf[0] + 1, h);
+		keyhash_update(s, labuf, (size_t)labuf[0] + 1);
 		lablen = *dname++;
 	}
+}
+
+hashvalue_type
+dname_query_hash(uint8_t* dname, hashvalue_type h)
+{
+	struct keyhash_state s;
+	keyhash_init(&s);
+	keyhash_update(&s, &h, sizeof(h));
+	dname_query_hash_update(&s, dname);
+	return keyhash_final(&s);
+}
 
-	return h;
+hashvalue_type
+dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_type h)
+{
+	struct keyhash_state s;
+	keyhash_init(&s);
+	keyhash_update(&s, &h, sizeof(h));
+	dname_pkt_hash_update(&s, pkt, dname);
+	return keyhash_final(&s);
 }
 
 void dname_pkt_copy(sldns_buffer* pkt, uint8_t* to, uint8_t* dname)
@@ -418,32 +662,11 @@ dname_count_size_labels(uint8_t* dname, size_t* size)
 	return labs;
 }
 
-/**
- * Compare labels in memory, lowercase while comparing.
- * @param p1: label 1
- * @param p2: label 2
- * @param len: number of bytes to compare.
- * @return: 0, -1, +1 comparison result.
- */
-static int
-memlowercmp(uint8_t* p1, uint8_t* p2, uint8_t len)
-{
-	while(len--) {
-		if(*p1 != *p2 && tolower((unsigned char)*p1) != tolower((unsigned char)*p2)) {
-			if(tolower((unsigned char)*p1) < tolower((unsigned char)*p2))
-				return -1;
-			return 1;
-		}
-		p1++;
-		p2++;
-	}
-	return 0;
-}
-
 int 
 dname_lab_cmp(uint8_t* d1, int labs1, uint8_t* d2, int labs2, int* mlabs)
 {
 	uint8_t len1, len2;
+	int c;
 	int atlabel = labs1;
 	int lastmlabs;
 	int lastdiff = 0;
@@ -481,31 +704,12 @@ dname_lab_cmp(uint8_t* d1, int labs1, uint8_t* d2, int labs2, int* mlabs)
 			d1 += len1;
 			d2 += len2;
 		} else {
-			/* memlowercmp is inlined here; or just like
-			 * if((c=memlowercmp(d1, d2, len1)) != 0) { 
-			 *	lastdiff = c;
-			 *	lastmlabs = atlabel; } apart from d1++,d2++ */
-			while(len1) {
-				if(*d1 != *d2 && tolower((unsigned char)*d1) 
-					!= tolower((unsigned char)*d2)) {
-					if(tolower((unsigned char)*d1) < 
-						tolower((unsigned char)*d2)) {
-						lastdiff = -1;
-						lastmlabs = atlabel;
-						d1 += len1;
-						d2 += len1;
-						break;
-					}
-					lastdiff = 1;
-					lastmlabs = atlabel;
-					d1 += len1;
-					d2 += len1;
-					break; /* out of memlowercmp */
-				}
-				d1++;
-				d2++;
-				len1--;
+			if((c=memlowercmp(d1, d2, len1)) != 0) { 
+				lastdiff = c;
+				lastmlabs = atlabel;
 			}
+			d1 += len1;
+			d2 += len1;
 		}
 		atlabel--;
 	}
@@ -46,6 +46,7 @@
 #define UTIL_DATA_DNAME_H
 #include "util/storage/lruhash.h"
 struct sldns_buffer;
+struct keyhash_state;
 
 /** max number of compression ptrs to follow */
 #define MAX_COMPRESS_PTRS 256
@@ -58,6 +59,18 @@ struct sldns_buffer;
  */
 size_t query_dname_len(struct sldns_buffer* query);
 
+/**
+ * Determine length of dname in buffer, like query_dname_len, and hash it
+ * while it is read. The name is lowercased for the hash, like
+ * dname_query_hash_update does, and the hash state is updated with it.
+ * @param query: the ldns buffer, current position at start of dname.
+ *	at end, position is at end of the dname.
+ * @param s: the hash state, updated with the (lowercased) dname.
+ * @return: 0 on parse failure, or length including ending 0 of dname.
+ */
+size_t query_dname_len_hash(struct sldns_buffer* query,
+	struct keyhash_state* s);
+
 /**
  * Determine if dname in memory is correct. no compression ptrs allowed.
  * @param dname: where dname starts in memory.
@@ -69,6 +82,24 @@ size_t dname_valid(uint8_t* dname, size_t len);
 /** lowercase query dname */
 void query_dname_tolower(uint8_t* dname);
 
+/** the name functions use no vector instructions */
+#define DNAME_SIMD_NONE 0
+/** the name functions use SSE2 */
+#define DNAME_SIMD_SSE2 1
+/** the name functions use AVX2 (and SSE2 for the remainder) */
+#define DNAME_SIMD_AVX2 2
+
+/**
+ * Select the vector instructions that the name functions use, for the
+ * case folding and case insensitive compares. By default the best that
+ * the cpu supports is used, chosen when the program starts.  This is for
+ * tests and benchmarks, and must be called before threads are started.
+ * @param level: DNAME_SIMD_NONE, _SSE2 or _AVX2, or -1 for the best.
+ * @return the level that is in use, lower than requested if the cpu
+ *	or the compiler does not support it.
+ */
+int dname_simd_select(int level);
+
 /** 
  * lowercase pkt dname (follows compression pointers)
  * @param pkt: the packet, used to follow compression pointers. Position 
@@ -121,7 +152,7 @@ size_t pkt_dname_len(struct sldns_buffer* pkt);
 int dname_pkt_compare(struct sldns_buffer* pkt, uint8_t* d1, uint8_t* d2);
 
 /**
- * Hash dname, label by label, lowercasing, into hashvalue.
+ * Hash dname, lowercasing, into hashvalue, with the keyed hash.
  * Dname in query format (not compressed).
  * @param dname: dname to hash.
  * @param h: initial hash value.
@@ -130,7 +161,7 @@ int dname_pkt_compare(struct sldns_buffer* pkt, uint8_t* d1, uint8_t* d2);
 hashvalue_type dname_query_hash(uint8_t* dname, hashvalue_type h);
 
 /**
- * Hash dname, label by label, lowercasing, into hashvalue.
+ * Hash dname, lowercasing, into hashvalue, with the keyed hash.
  * Dname in pkt format (compressed).
  * @param pkt: packet, for resolving compression pointers.
  * @param dname: dname to hash, pointer to the pkt buffer.
@@ -142,6 +173,28 @@ hashvalue_type dname_query_hash(uint8_t* dname, hashvalue_type h);
 hashvalue_type dname_pkt_hash(struct sldns_buffer* pkt, uint8_t* dname,
 	hashvalue_type h);
 
+/**
+ * Absorb dname, lowercased, into a keyed hash computation, so that more
+ * parts of the key can be added to the same hash.
+ * Dname in query format (not compressed).
+ * @param s: the keyhash state.
+ * @param dname: dname to hash.
+ */
+void dname_query_hash_update(struct keyhash_state* s, uint8_t* dname);
+
+/**
+ * Absorb dname, lowercased, into a keyed hash computation.
+ * Dname in pkt format (compressed).
+ * @param s: the keyhash state.
+ * @param pkt: packet, for resolving compression pointers.
+ * @param dname: dname to hash, pointer to the pkt buffer.
+ * 	Must be valid format. No loops, etc.
+ * 	The state is the same as after dname_query_hash_update, even if
+ * 	compression is used.
+ */
+void dname_pkt_hash_update(struct keyhash_state* s, struct sldns_buffer* pkt,
+	uint8_t* dname);
+
 /**
  * Copy over a valid dname and decompress it.
  * @param pkt: packet to resolve compression pointers.
@@ -50,202 +50,171 @@
 #include "sldns/sbuffer.h"
 #include "services/localzone.h"
 
-/** return code that means the function ran out of memory. negative so it does
- * not conflict with DNS rcodes. */
-#define RETVAL_OUTMEM	-2
 /** return code that means the data did not fit (completely) in the packet */
 #define RETVAL_TRUNC	-4
 /** return code that means all is peachy keen. Equal to DNS rcode NOERROR */
 #define RETVAL_OK	0
 
+/** number of slots in the compression table, a power of two */
+#define COMPRESS_TABLE_SLOTS 1024
+/** max number of names in the compression table. If it is full, new
+ * names are not stored, only very big replies get that far, and names
+ * after PTR_MAX_OFFSET are not stored anyway */
+#define COMPRESS_TABLE_MAX 768
+/** max number of labels in a domain name, including the root label */
+#define COMPRESS_MAX_LABELS 128
+
 /**
  * Data structure to help domain name compression in outgoing messages.
- * A tree of dnames and their offsets in the packet is kept.
- * It is kept sorted, not canonical, but by label at least, so that after
- * a lookup of a name you know its closest match, and the parent from that
- * closest match. These are possible compression targets.
+ * The table has the domain names, and their suffixes, that are in the
+ * packet, with the offset where they are, these are compression targets.
  *
- * It is a binary tree, not a rbtree or balanced tree, as the effort
- * of keeping it balanced probably outweighs usefulness (given typical
- * DNS packet size).
+ * It is an open addressing hash table, keyed by a hash of the labels
+ * of the name. The hash is computed from the root label up, so that the
+ * hashes of all the suffixes of a name take one pass over the name. The
+ * table is on the stack, no memory is allocated for it per message.
  */
-struct compress_tree_node {
-	/** left node in tree, all smaller to this */
-	struct compress_tree_node* left;
-	/** right node in tree, all larger than this */
-	struct compress_tree_node* right;
-
-	/** the parent node - not for tree, but zone parent. One less label */
-	struct compress_tree_node* parent;
-	/** the domain name for this node. Pointer to uncompressed memory. */
-	uint8_t* dname;
-	/** number of labels in domain name, kept to help compare func. */
-	int labs;
-	/** offset in packet that points to this dname */
-	size_t offset;
+struct compress_table {
+	/** hash slots, 0 if empty, or the index+1 of the name */
+	uint16_t slot[COMPRESS_TABLE_SLOTS];
+	/** number of names in the table */
+	size_t num;
+	/** the names in the table, not initialised after num */
+	struct compress_name {
+		/** the domain name. Pointer to uncompressed memory. */
+		uint8_t* dname;
+		/** hash value of the domain name */
+		uint32_t hash;
+		/** offset in packet that points to this dname */
+		uint16_t offset;
+		/** number of labels in domain name, including the root */
+		uint8_t labs;
+	} name[COMPRESS_TABLE_MAX];
 };
 
 /**
- * Find domain name in tree, returns exact and closest match.
- * @param tree: root of tree.
- * @param dname: pointer to uncompressed dname.
- * @param labs: number of labels in domain name.
- * @param match: closest or exact match.
- *	guaranteed to be smaller or equal to the sought dname.
- *	can be null if the tree is empty.
- * @param matchlabels: number of labels that match with closest match.
- *	can be zero is there is no match.
- * @param insertpt: insert location for dname, if not found.
- * @return: 0 if no exact match.
+ * A domain name that is looked up in the compression table, it has the
+ * hashes of its suffixes, that are used to store it afterwards.
  */
-static int
-compress_tree_search(struct compress_tree_node** tree, uint8_t* dname,
-	int labs, struct compress_tree_node** match, int* matchlabels,
-	struct compress_tree_node*** insertpt)
+struct compress_lookup {
+	/** number of labels in domain name, including the root */
+	int labs;
+	/** start of every label */
+	uint8_t* lab[COMPRESS_MAX_LABELS];
+	/** hash of the suffix that starts at every label */
+	uint32_t hash[COMPRESS_MAX_LABELS];
+	/** the longest suffix that is in the table, or NULL */
+	struct compress_name* match;
+	/** the label where the match starts, the labels before it are not
+	 * in the table */
+	int matchlab;
+};
+
+/** init the compression table for a new message */
+static void
+compress_table_init(struct compress_table* t)
 {
-	int c, n, closen=0;
-	struct compress_tree_node* p = *tree;
-	struct compress_tree_node* close = 0;
-	struct compress_tree_node** prev = tree;
-	while(p) {
-		if((c = dname_lab_cmp(dname, labs, p->dname, p->labs, &n)) 
-			== 0) {
-			*matchlabels = n;
-			*match = p;
-			return 1;
-		}
-		if(c<0) {
-			prev = &p->left;
-			p = p->left;
-		} else	{
-			closen = n;
-			close = p; /* p->dname is smaller than dname */
-			prev = &p->right;
-			p = p->right;
-		}
-	}
-	*insertpt = prev;
-	*matchlabels = closen;
-	*match = close;
-	return 0;
+	memset(t->slot, 0, sizeof(t->slot));
+	t->num = 0;
+}
+
+/** hash a label, case insensitive, onto the hash of the labels after it */
+static uint32_t
+compress_hash_label(uint8_t* lab, uint32_t h)
+{
+	uint8_t len = *lab++;
+	/* FNV-1a, with the length byte and lowercased label bytes. The
+	 * 0x20 bit folds more than the letters, the compare sorts that out */
+	h = (h ^ len) * 16777619U;
+	while(len--)
+		h = (h ^ (uint32_t)(*lab++ | 0x20)) * 16777619U;
+	return h;
 }
 
+/** the slot to start probing for a hash value */
+#define COMPRESS_SLOT(h) (((h) ^ ((h)>>16)) & (COMPRESS_TABLE_SLOTS-1))
+
 /**
- * Lookup a domain name in compression tree.
- * @param tree: root of tree (not the node with '.').
+ * Lookup a domain name in the compression table, find the longest suffix
+ * of it that is in the packet already.
+ * @param t: the compression table.
  * @param dname: pointer to uncompressed dname.
  * @param labs: number of labels in domain name.
- * @param insertpt: insert location for dname, if not found.
- * @return: 0 if not found or compress treenode with best compression.
+ * @param cl: returns the labels and hashes, and the match.
+ * @return: 0 if not found, or the name with best compression.
  */
-static struct compress_tree_node*
-compress_tree_lookup(struct compress_tree_node** tree, uint8_t* dname,
-	int labs, struct compress_tree_node*** insertpt)
+static struct compress_name*
+compress_table_lookup(struct compress_table* t, uint8_t* dname, int labs,
+	struct compress_lookup* cl)
 {
-	struct compress_tree_node* p;
-	int m;
-	if(labs <= 1)
-		return 0; /* do not compress root node */
-	if(compress_tree_search(tree, dname, labs, &p, &m, insertpt)) {
-		/* exact match */
-		return p;
+	uint32_t h = 0x811c9dc5U;
+	int i;
+	cl->labs = labs;
+	cl->match = NULL;
+	cl->matchlab = labs-1; /* the root is not stored */
+	if(labs > COMPRESS_MAX_LABELS) {
+		/* not a valid name, do not compress or store it */
+		cl->matchlab = 0;
+		return NULL;
 	}
-	/* return some ancestor of p that compresses well. */
-	if(m>1) {
-		/* www.example.com. (labs=4) matched foo.example.com.(labs=4)
-		 * then matchcount = 3. need to go up. */
-		while(p && p->labs > m)
-			p = p->parent;
-		return p;
+	for(i=0; i<labs; i++) {
+		cl->lab[i] = dname;
+		dname += *dname + 1;
 	}
-	return 0;
-}
-
-/**
- * Create node for domain name compression tree.
- * @param dname: pointer to uncompressed dname (stored in tree).
- * @param labs: number of labels in dname.
- * @param offset: offset into packet for dname.
- * @param region: how to allocate memory for new node.
- * @return new node or 0 on malloc failure.
- */
-static struct compress_tree_node*
-compress_tree_newnode(uint8_t* dname, int labs, size_t offset, 
-	struct regional* region)
-{
-	struct compress_tree_node* n = (struct compress_tree_node*)
-		regional_alloc(region, sizeof(struct compress_tree_node));
-	if(!n) return 0;
-	n->left = 0;
-	n->right = 0;
-	n->parent = 0;
-	n->dname = dname;
-	n->labs = labs;
-	n->offset = offset;
-	return n;
+	for(i=labs-2; i>=0; i--) {
+		h = compress_hash_label(cl->lab[i], h);
+		cl->hash[i] = h;
+	}
+	/* the first match, from the full name down, is the longest */
+	for(i=0; i<labs-1; i++) {
+		size_t s = COMPRESS_SLOT(cl->hash[i]);
+		while(t->slot[s]) {
+			struct compress_name* n = &t->name[t->slot[s]-1];
+			if(n->hash == cl->hash[i] && n->labs == labs-i &&
+				query_dname_compare(n->dname, cl->lab[i]) == 0) {
+				cl->match = n;
+				cl->matchlab = i;
+				return n;
+			}
+			s = (s+1) & (COMPRESS_TABLE_SLOTS-1);
+		}
+	}
+	return NULL;
 }
 
 /**
- * Store domain name and ancestors into compression tree.
- * @param dname: pointer to uncompressed dname (stored in tree).
- * @param labs: number of labels in dname.
+ * Store domain name and its suffixes into the compression table, the
+ * ones that were not found by the lookup.
+ * @param t: the compression table.
+ * @param cl: the lookup of the name.
  * @param offset: offset into packet for dname.
- * @param region: how to allocate memory for new node.
- * @param closest: match from previous lookup, used to compress dname.
- *	may be NULL if no previous match.
- *	if the tree has an ancestor of dname already, this must be it.
- * @param insertpt: where to insert the dname in tree. 
- * @return: 0 on memory error.
  */
-static int
-compress_tree_store(uint8_t* dname, int labs, size_t offset, 
-	struct regional* region, struct compress_tree_node* closest, 
-	struct compress_tree_node** insertpt)
+static void
+compress_table_store(struct compress_table* t, struct compress_lookup* cl,
+	size_t offset)
 {
-	uint8_t lablen;
-	struct compress_tree_node* newnode;
-	struct compress_tree_node* prevnode = NULL;
-	int uplabs = labs-1; /* does not store root in tree */
-	if(closest) uplabs = labs - closest->labs;
-	log_assert(uplabs >= 0);
-	/* algorithms builds up a vine of dname-labels to hang into tree */
-	while(uplabs--) {
-		if(offset > PTR_MAX_OFFSET) {
-			/* insertion failed, drop vine */
-			return 1; /* compression pointer no longer useful */
-		}
-		if(!(newnode = compress_tree_newnode(dname, labs, offset, 
-			region))) {
-			/* insertion failed, drop vine */
-			return 0;
-		}
-
-		if(prevnode) {
-			/* chain nodes together, last one has one label more,
-			 * so is larger than newnode, thus goes right. */
-			newnode->right = prevnode;
-			prevnode->parent = newnode;
-		}
-
-		/* next label */
-		lablen = *dname++;
-		dname += lablen;
-		offset += lablen+1;
-		prevnode = newnode;
-		labs--;
-	}
-	/* if we have a vine, hang the vine into the tree */
-	if(prevnode) {
-		*insertpt = prevnode;
-		prevnode->parent = closest;
+	int i;
+	for(i=0; i<cl->matchlab; i++) {
+		size_t off = offset + (size_t)(cl->lab[i] - cl->lab[0]);
+		size_t s = COMPRESS_SLOT(cl->hash[i]);
+		struct compress_name* n;
+		if(off > PTR_MAX_OFFSET || t->num >= COMPRESS_TABLE_MAX)
+			return; /* compression pointer no longer useful */
+		while(t->slot[s])
+			s = (s+1) & (COMPRESS_TABLE_SLOTS-1);
+		n = &t->name[t->num++];
+		n->dname = cl->lab[i];
+		n->hash = cl->hash[i];
+		n->offset = (uint16_t)off;
+		n->labs = (uint8_t)(cl->labs - i);
+		t->slot[s] = (uint16_t)t->num;
 	}
-	return 1;
 }
 
 /** compress a domain name */
 static int
 write_compressed_dname(sldns_buffer* pkt, uint8_t* dname, int labs,
-	struct compress_tree_node* p)
+	struct compress_name* p)
 {
 	/* compress it */
 	int labcopy = labs - p->labs;
@@ -277,18 +246,18 @@ write_compressed_dname(sldns_buffer* pkt, uint8_t* dname, int labs,
 	return 1;
 }
 
-/** compress owner name of RR, return RETVAL_OUTMEM RETVAL_TRUNC */
+/** compress owner name of RR, return RETVAL_TRUNC */
 static int
 compress_owner(struct ub_packed_rrset_key* key, sldns_buffer* pkt, 
-	struct regional* region, struct compress_tree_node** tree, 
-	size_t owner_pos, uint16_t* owner_ptr, int owner_labs)
+	struct compress_table* tab, size_t owner_pos, uint16_t* owner_ptr,
+	int owner_labs)
 {
-	struct compress_tree_node* p;
-	struct compress_tree_node** insertpt = NULL;
+	struct compress_name* p;
+	struct compress_lookup cl;
 	if(!*owner_ptr) {
 		/* compress first time dname */
-		if((p = compress_tree_lookup(tree, key->rk.dname, 
-			owner_labs, &insertpt))) {
+		if((p = compress_table_lookup(tab, key->rk.dname, 
+			owner_labs, &cl))) {
 			if(p->labs == owner_labs) 
 				/* avoid ptr chains, since some software is
 				 * not capable of decoding ptr after a ptr. */
@@ -308,9 +277,7 @@ compress_owner(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 			if(owner_pos <= PTR_MAX_OFFSET)
 				*owner_ptr = htons(PTR_CREATE(owner_pos));
 		}
-		if(!compress_tree_store(key->rk.dname, owner_labs, 
-			owner_pos, region, p, insertpt))
-			return RETVAL_OUTMEM;
+		compress_table_store(tab, &cl, owner_pos);
 	} else {
 		/* always compress 2nd-further RRs in RRset */
 		if(owner_labs == 1) {
@@ -329,20 +296,19 @@ compress_owner(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 /** compress any domain name to the packet, return RETVAL_* */
 static int
 compress_any_dname(uint8_t* dname, sldns_buffer* pkt, int labs, 
-	struct regional* region, struct compress_tree_node** tree)
+	struct compress_table* tab)
 {
-	struct compress_tree_node* p;
-	struct compress_tree_node** insertpt = NULL;
+	struct compress_name* p;
+	struct compress_lookup cl;
 	size_t pos = sldns_buffer_position(pkt);
-	if((p = compress_tree_lookup(tree, dname, labs, &insertpt))) {
+	if((p = compress_table_lookup(tab, dname, labs, &cl))) {
 		if(!write_compressed_dname(pkt, dname, labs, p))
 			return RETVAL_TRUNC;
 	} else {
 		if(!dname_buffer_write(pkt, dname))
 			return RETVAL_TRUNC;
 	}
-	if(!compress_tree_store(dname, labs, pos, region, p, insertpt))
-		return RETVAL_OUTMEM;
+	compress_table_store(tab, &cl, pos);
 	return RETVAL_OK;
 }
 
@@ -360,8 +326,7 @@ type_rdata_compressable(struct ub_packed_rrset_key* key)
 /** compress domain names in rdata, return RETVAL_* */
 static int
 compress_rdata(sldns_buffer* pkt, uint8_t* rdata, size_t todolen, 
-	struct regional* region, struct compress_tree_node** tree, 
-	const sldns_rr_descriptor* desc)
+	struct compress_table* tab, const sldns_rr_descriptor* desc)
 {
 	int labs, r, rdf = 0;
 	size_t dname_len, len, pos = sldns_buffer_position(pkt);
@@ -375,8 +340,8 @@ compress_rdata(sldns_buffer* pkt, uint8_t* rdata, size_t todolen,
 		switch(desc->_wireformat[rdf]) {
 		case LDNS_RDF_TYPE_DNAME:
 			labs = dname_count_size_labels(rdata, &dname_len);
-			if((r=compress_any_dname(rdata, pkt, labs, region, 
-				tree)) != RETVAL_OK)
+			if((r=compress_any_dname(rdata, pkt, labs, tab))
+				!= RETVAL_OK)
 				return r;
 			rdata += dname_len;
 			todolen -= dname_len;
@@ -442,9 +407,8 @@ rrset_belongs_in_reply(sldns_pkt_section s, uint16_t rrtype, uint16_t qtype,
 /** store rrset in buffer in wireformat, return RETVAL_* */
 static int
 packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt, 
-	uint16_t* num_rrs, time_t timenow, struct regional* region,
-	int do_data, int do_sig, struct compress_tree_node** tree,
-	sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset)
+	uint16_t* num_rrs, time_t timenow, int do_data, int do_sig,
+	struct compress_table* tab, sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset)
 {
 	size_t i, j, owner_pos;
 	int r, owner_labs;
@@ -464,8 +428,8 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 		for(i=0; i<data->count; i++) {
 			/* rrset roundrobin */
 			j = (i + rr_offset) % data->count;
-			if((r=compress_owner(key, pkt, region, tree, 
-				owner_pos, &owner_ptr, owner_labs))
+			if((r=compress_owner(key, pkt, tab, owner_pos,
+				&owner_ptr, owner_labs))
 				!= RETVAL_OK)
 				return r;
 			sldns_buffer_write(pkt, &key->rk.type, 2);
@@ -476,7 +440,7 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 					data->rr_ttl[j]-timenow);
 			if(c) {
 				if((r=compress_rdata(pkt, data->rr_data[j],
-					data->rr_len[j], region, tree, c))
+					data->rr_len[j], tab, c))
 					!= RETVAL_OK)
 					return r;
 			} else {
@@ -498,7 +462,7 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 				sldns_buffer_write(pkt, &owner_ptr, 2);
 			} else {
 				if((r=compress_any_dname(key->rk.dname, 
-					pkt, owner_labs, region, tree))
+					pkt, owner_labs, tab))
 					!= RETVAL_OK)
 					return r;
 				if(sldns_buffer_remaining(pkt) < 
@@ -530,8 +494,7 @@ packed_rrset_encode(struct ub_packed_rrset_key* key, sldns_buffer* pkt,
 static int
 insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 	sldns_buffer* pkt, size_t rrsets_before, time_t timenow, 
-	struct regional* region, struct compress_tree_node** tree,
-	sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset)
+	struct compress_table* tab, sldns_pkt_section s, uint16_t qtype, int dnssec, size_t rr_offset)
 {
 	int r;
 	size_t i, setstart;
@@ -546,7 +509,7 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 	  	for(i=0; i<num_rrsets; i++) {
 			setstart = sldns_buffer_position(pkt);
 			if((r=packed_rrset_encode(rep->rrsets[rrsets_before+i], 
-				pkt, num_rrs, timenow, region, 1, 1, tree,
+				pkt, num_rrs, timenow, 1, 1, tab,
 				s, qtype, dnssec, rr_offset))
 				!= RETVAL_OK) {
 				/* Bad, but if due to size must set TC bit */
@@ -559,7 +522,7 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 	  	for(i=0; i<num_rrsets; i++) {
 			setstart = sldns_buffer_position(pkt);
 			if((r=packed_rrset_encode(rep->rrsets[rrsets_before+i], 
-				pkt, num_rrs, timenow, region, 1, 0, tree,
+				pkt, num_rrs, timenow, 1, 0, tab,
 				s, qtype, dnssec, rr_offset))
 				!= RETVAL_OK) {
 				sldns_buffer_set_position(pkt, setstart);
@@ -570,7 +533,7 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 	  	  for(i=0; i<num_rrsets; i++) {
 			setstart = sldns_buffer_position(pkt);
 			if((r=packed_rrset_encode(rep->rrsets[rrsets_before+i], 
-				pkt, num_rrs, timenow, region, 0, 1, tree,
+				pkt, num_rrs, timenow, 0, 1, tab,
 				s, qtype, dnssec, rr_offset))
 				!= RETVAL_OK) {
 				sldns_buffer_set_position(pkt, setstart);
@@ -583,9 +546,10 @@ insert_section(struct reply_info* rep, size_t num_rrsets, uint16_t* num_rrs,
 
 /** store query section in wireformat buffer, return RETVAL */
 static int
-insert_query(struct query_info* qinfo, struct compress_tree_node** tree, 
-	sldns_buffer* buffer, struct regional* region)
+insert_query(struct query_info* qinfo, struct compress_table* tab, 
+	sldns_buffer* buffer)
 {
+	struct compress_lookup cl;
 	uint8_t* qname = qinfo->local_alias ?
 		qinfo->local_alias->rrset->rk.dname : qinfo->qname;
 	size_t qname_len = qinfo->local_alias ?
@@ -593,10 +557,10 @@ insert_query(struct query_info* qinfo, struct compress_tree_node** tree,
 	if(sldns_buffer_remaining(buffer) < 
 		qinfo->qname_len+sizeof(uint16_t)*2)
 		return RETVAL_TRUNC; /* buffer too small */
-	/* the query is the first name inserted into the tree */
-	if(!compress_tree_store(qname, dname_count_labels(qname),
-		sldns_buffer_position(buffer), region, NULL, tree))
-		return RETVAL_OUTMEM;
+	/* the query is the first name inserted into the table */
+	(void)compress_table_lookup(tab, qname, dname_count_labels(qname),
+		&cl);
+	compress_table_store(tab, &cl, sldns_buffer_position(buffer));
 	if(sldns_buffer_current(buffer) == qname)
 		sldns_buffer_skip(buffer, (ssize_t)qname_len);
 	else	sldns_buffer_write(buffer, qname, qname_len);
@@ -633,13 +597,14 @@ positive_answer(struct reply_info* rep, uint16_t qtype) {
 int 
 reply_info_encode(struct query_info* qinfo, struct reply_info* rep, 
 	uint16_t id, uint16_t flags, sldns_buffer* buffer, time_t timenow, 
-	struct regional* region, uint16_t udpsize, int dnssec)
+	struct regional* ATTR_UNUSED(region), uint16_t udpsize, int dnssec)
 {
 	uint16_t ancount=0, nscount=0, arcount=0;
-	struct compress_tree_node* tree = 0;
+	struct compress_table tab;
 	int r;
 	size_t rr_offset; 
 
+	compress_table_init(&tab);
 	sldns_buffer_clear(buffer);
 	if(udpsize < sldns_buffer_limit(buffer))
 		sldns_buffer_set_limit(buffer, udpsize);
@@ -654,7 +619,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 
 	/* insert query section */
 	if(rep->qdcount) {
-		if((r=insert_query(qinfo, &tree, buffer, region)) != 
+		if((r=insert_query(qinfo, &tab, buffer)) != 
 			RETVAL_OK) {
 			if(r == RETVAL_TRUNC) {
 				/* create truncated message */
@@ -684,7 +649,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 		arep.rrset_count = 1;
 		arep.rrsets = &qinfo->local_alias->rrset;
 		if((r=insert_section(&arep, 1, &ancount, buffer, 0,
-			timezero, region, &tree, LDNS_SECTION_ANSWER,
+			timezero, &tab, LDNS_SECTION_ANSWER,
 			qinfo->qtype, dnssec, rr_offset)) != RETVAL_OK) {
 			if(r == RETVAL_TRUNC) {
 				/* create truncated message */
@@ -699,7 +664,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 
 	/* insert answer section */
 	if((r=insert_section(rep, rep->an_numrrsets, &ancount, buffer, 
-		0, timenow, region, &tree, LDNS_SECTION_ANSWER, qinfo->qtype, 
+		0, timenow, &tab, LDNS_SECTION_ANSWER, qinfo->qtype, 
 		dnssec, rr_offset)) != RETVAL_OK) {
 		if(r == RETVAL_TRUNC) {
 			/* create truncated message */
@@ -716,7 +681,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 	if( ! (MINIMAL_RESPONSES && positive_answer(rep, qinfo->qtype)) ) {
 		/* insert auth section */
 		if((r=insert_section(rep, rep->ns_numrrsets, &nscount, buffer, 
-			rep->an_numrrsets, timenow, region, &tree,
+			rep->an_numrrsets, timenow, &tab,
 			LDNS_SECTION_AUTHORITY, qinfo->qtype,
 			dnssec, rr_offset)) != RETVAL_OK) {
 			if(r == RETVAL_TRUNC) {
@@ -732,8 +697,8 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 
 		/* insert add section */
 		if((r=insert_section(rep, rep->ar_numrrsets, &arcount, buffer, 
-			rep->an_numrrsets + rep->ns_numrrsets, timenow, region, 
-			&tree, LDNS_SECTION_ADDITIONAL, qinfo->qtype, 
+			rep->an_numrrsets + rep->ns_numrrsets, timenow,
+			&tab, LDNS_SECTION_ADDITIONAL, qinfo->qtype, 
 			dnssec, rr_offset)) != RETVAL_OK) {
 			if(r == RETVAL_TRUNC) {
 				/* no need to set TC bit, this is the additional */
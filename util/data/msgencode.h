@@ -58,7 +58,7 @@ struct edns_data;
  * @param timenow: time to subtract.
  * @param cached: set true if a cached reply (so no AA bit).
  *	set false for the first reply.
- * @param region: where to allocate temp variables (for compression).
+ * @param region: not used, the name compression does not allocate memory.
  * @param udpsize: size of the answer, 512, from EDNS, or 64k for TCP.
  * @param edns: EDNS data included in the answer, NULL for none.
  *	or if edns_present = 0, it is not included.
@@ -82,7 +82,7 @@ int reply_info_answer_encode(struct query_info* qinf, struct reply_info* rep,
  * @param flags: flags value to store, host order.
  * @param buffer: buffer to store the packet into.
  * @param timenow: time now, to adjust ttl values.
- * @param region: to store temporary data in.
+ * @param region: not used, the name compression does not allocate memory.
  * @param udpsize: size of the answer, 512, from EDNS, or 64k for TCP.
  * @param dnssec: if 0 DNSSEC records are omitted from the answer.
  * @return: nonzero is success, or 
@@ -41,7 +41,7 @@
 #include "util/data/msgreply.h"
 #include "util/data/dname.h"
 #include "util/data/packed_rrset.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/regional.h"
 #include "sldns/rrdef.h"
 #include "sldns/sbuffer.h"
@@ -165,38 +165,43 @@ pkt_hash_rrset(sldns_buffer* pkt, uint8_t* dname, uint16_t type,
 {
 	/* note this MUST be identical to rrset_key_hash in packed_rrset.c */
 	/* this routine handles compressed names */
+	struct keyhash_state s;
 	hashvalue_type h = 0xab;
-	h = dname_pkt_hash(pkt, dname, h);
-	h = hashlittle(&type, sizeof(type), h);		/* host order */
-	h = hashlittle(&dclass, sizeof(dclass), h);	/* netw order */
-	h = hashlittle(&rrset_flags, sizeof(uint32_t), h);
-	return h;
+	keyhash_init(&s);
+	keyhash_update(&s, &h, sizeof(h));
+	dname_pkt_hash_update(&s, pkt, dname);
+	keyhash_update(&s, &type, sizeof(type));	/* host order */
+	keyhash_update(&s, &dclass, sizeof(dclass));	/* netw order */
+	keyhash_update(&s, &rrset_flags, sizeof(uint32_t));
+	return keyhash_final(&s);
 }
 
-/** create partial dname hash for rrset hash */
-static hashvalue_type
-pkt_hash_rrset_first(sldns_buffer* pkt, uint8_t* dname)
+/** create partial dname hash state for rrset hash */
+static void
+pkt_hash_rrset_first(sldns_buffer* pkt, uint8_t* dname,
+	struct keyhash_state* s)
 {
 	/* works together with pkt_hash_rrset_rest */
 	/* note this MUST be identical to rrset_key_hash in packed_rrset.c */
 	/* this routine handles compressed names */
 	hashvalue_type h = 0xab;
-	h = dname_pkt_hash(pkt, dname, h);
-	return h;
+	keyhash_init(s);
+	keyhash_update(s, &h, sizeof(h));
+	dname_pkt_hash_update(s, pkt, dname);
 }
 
-/** create a rrset hash from a partial dname hash */
+/** create a rrset hash from a partial dname hash state */
 static hashvalue_type
-pkt_hash_rrset_rest(hashvalue_type dname_h, uint16_t type, uint16_t dclass, 
-	uint32_t rrset_flags)
+pkt_hash_rrset_rest(struct keyhash_state* dname_h, uint16_t type,
+	uint16_t dclass, uint32_t rrset_flags)
 {
 	/* works together with pkt_hash_rrset_first */
 	/* note this MUST be identical to rrset_key_hash in packed_rrset.c */
-	hashvalue_type h;
-	h = hashlittle(&type, sizeof(type), dname_h);	/* host order */
-	h = hashlittle(&dclass, sizeof(dclass), h);	/* netw order */
-	h = hashlittle(&rrset_flags, sizeof(uint32_t), h);
-	return h;
+	struct keyhash_state s = *dname_h; /* dname_h is used again */
+	keyhash_update(&s, &type, sizeof(type));	/* host order */
+	keyhash_update(&s, &dclass, sizeof(dclass));	/* netw order */
+	keyhash_update(&s, &rrset_flags, sizeof(uint32_t));
+	return keyhash_final(&s);
 }
 
 /** compare rrset_parse with data */
@@ -462,8 +467,9 @@ find_rrset(struct msg_parse* msg, sldns_buffer* pkt, uint8_t* dname,
 	uint16_t* prev_dclass, struct rrset_parse** rrset_prev,
 	sldns_pkt_section section, struct regional* region)
 {
-	hashvalue_type dname_h = pkt_hash_rrset_first(pkt, dname);
+	struct keyhash_state dname_h;
 	uint16_t covtype;
+	pkt_hash_rrset_first(pkt, dname, &dname_h);
 	if(*rrset_prev) {
 		/* check if equal to previous item */
 		if(type == *prev_type && dclass == *prev_dclass &&
@@ -492,14 +498,14 @@ find_rrset(struct msg_parse* msg, sldns_buffer* pkt, uint8_t* dname,
 	/* if rrsig - try to lookup matching data set first */
 	if(type == LDNS_RR_TYPE_RRSIG && pkt_rrsig_covered(pkt, 
 		sldns_buffer_current(pkt), &covtype)) {
-		*hash = pkt_hash_rrset_rest(dname_h, covtype, dclass, 
+		*hash = pkt_hash_rrset_rest(&dname_h, covtype, dclass, 
 			*rrset_flags);
 		*rrset_prev = msgparse_hashtable_lookup(msg, pkt, *hash, 
 			*rrset_flags, dname, dnamelen, covtype, dclass);
 		if(!*rrset_prev && covtype == LDNS_RR_TYPE_NSEC) {
 			/* if NSEC try with NSEC apex bit twiddled */
 			*rrset_flags ^= PACKED_RRSET_NSEC_AT_APEX;
-			*hash = pkt_hash_rrset_rest(dname_h, covtype, dclass, 
+			*hash = pkt_hash_rrset_rest(&dname_h, covtype, dclass, 
 				*rrset_flags);
 			*rrset_prev = msgparse_hashtable_lookup(msg, pkt, 
 				*hash, *rrset_flags, dname, dnamelen, covtype, 
@@ -510,7 +516,7 @@ find_rrset(struct msg_parse* msg, sldns_buffer* pkt, uint8_t* dname,
 		if(!*rrset_prev && covtype == LDNS_RR_TYPE_SOA) {
 			/* if SOA try with SOA neg flag twiddled */
 			*rrset_flags ^= PACKED_RRSET_SOA_NEG;
-			*hash = pkt_hash_rrset_rest(dname_h, covtype, dclass, 
+			*hash = pkt_hash_rrset_rest(&dname_h, covtype, dclass, 
 				*rrset_flags);
 			*rrset_prev = msgparse_hashtable_lookup(msg, pkt, 
 				*hash, *rrset_flags, dname, dnamelen, covtype, 
@@ -530,7 +536,7 @@ find_rrset(struct msg_parse* msg, sldns_buffer* pkt, uint8_t* dname,
 	if(type != LDNS_RR_TYPE_RRSIG) {
 		int hasother = 0;
 		/* find matching rrsig */
-		*hash = pkt_hash_rrset_rest(dname_h, LDNS_RR_TYPE_RRSIG, 
+		*hash = pkt_hash_rrset_rest(&dname_h, LDNS_RR_TYPE_RRSIG, 
 			dclass, 0);
 		*rrset_prev = msgparse_hashtable_lookup(msg, pkt, *hash, 
 			0, dname, dnamelen, LDNS_RR_TYPE_RRSIG, 
@@ -551,7 +557,7 @@ find_rrset(struct msg_parse* msg, sldns_buffer* pkt, uint8_t* dname,
 		}
 	}
 
-	*hash = pkt_hash_rrset_rest(dname_h, type, dclass, *rrset_flags);
+	*hash = pkt_hash_rrset_rest(&dname_h, type, dclass, *rrset_flags);
 	*rrset_prev = msgparse_hashtable_lookup(msg, pkt, *hash, *rrset_flags, 
 		dname, dnamelen, type, dclass);
 	if(*rrset_prev)
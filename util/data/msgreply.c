@@ -41,7 +41,7 @@
 
 #include "config.h"
 #include "util/data/msgreply.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/log.h"
 #include "util/alloc.h"
 #include "util/netevent.h"
@@ -84,8 +84,8 @@ parse_create_qinfo(sldns_buffer* pkt, struct msg_parse* msg,
 
 /** constructor for replyinfo */
 struct reply_info*
-construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
-	time_t ttl, time_t prettl, size_t an, size_t ns, size_t ar, 
+construct_reply_info_base(struct regional* region,
+	struct alloc_cache* alloc, uint16_t flags, size_t qd, time_t ttl, time_t prettl, size_t an, size_t ns, size_t ar, 
 	size_t total, enum sec_status sec)
 {
 	struct reply_info* rep;
@@ -95,7 +95,7 @@ construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
 	if(total >= RR_COUNT_MAX) return NULL; /* sanity check on numRRS*/
 	if(region)
 		rep = (struct reply_info*)regional_alloc(region, s);
-	else	rep = (struct reply_info*)malloc(s + 
+	else	rep = (struct reply_info*)alloc_sized_obtain(alloc, s + 
 			sizeof(struct rrset_ref) * (total));
 	if(!rep) 
 		return NULL;
@@ -123,9 +123,9 @@ construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
 /** allocate replyinfo, return 0 on error */
 static int
 parse_create_repinfo(struct msg_parse* msg, struct reply_info** rep,
-	struct regional* region)
+	struct alloc_cache* alloc, struct regional* region)
 {
-	*rep = construct_reply_info_base(region, msg->flags, msg->qdcount, 0, 
+	*rep = construct_reply_info_base(region, alloc, msg->flags, msg->qdcount, 0, 
 		0, msg->an_rrsets, msg->ns_rrsets, msg->ar_rrsets, 
 		msg->rrset_count, sec_status_unchecked);
 	if(!*rep)
@@ -301,7 +301,8 @@ parse_rr_copy(sldns_buffer* pkt, struct rrset_parse* pset,
 /** create rrset return 0 on failure */
 static int
 parse_create_rrset(sldns_buffer* pkt, struct rrset_parse* pset,
-	struct packed_rrset_data** data, struct regional* region)
+	struct packed_rrset_data** data, struct alloc_cache* alloc,
+	struct regional* region)
 {
 	/* allocate */
 	size_t s;
@@ -314,12 +315,12 @@ parse_create_rrset(sldns_buffer* pkt, struct rrset_parse* pset,
 		pset->size;
 	if(region)
 		*data = regional_alloc(region, s);
-	else	*data = malloc(s);
+	else	*data = alloc_sized_obtain(alloc, s);
 	if(!*data)
 		return 0;
 	/* copy & decompress */
 	if(!parse_rr_copy(pkt, pset, *data)) {
-		if(!region) free(*data);
+		if(!region) alloc_sized_release(alloc, *data);
 		return 0;
 	}
 	return 1;
@@ -365,8 +366,8 @@ get_rrset_trust(struct msg_parse* msg, struct rrset_parse* rrset)
 
 int
 parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
-	struct rrset_parse *pset, struct regional* region, 
-	struct ub_packed_rrset_key* pk)
+	struct rrset_parse *pset, struct alloc_cache* alloc,
+	struct regional* region, struct ub_packed_rrset_key* pk)
 {
 	struct packed_rrset_data* data;
 	pk->rk.flags = pset->flags;
@@ -384,7 +385,7 @@ parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
 	pk->rk.type = htons(pset->type);
 	pk->rk.rrset_class = pset->rrset_class;
 	/** read data part. */
-	if(!parse_create_rrset(pkt, pset, &data, region))
+	if(!parse_create_rrset(pkt, pset, &data, alloc, region))
 		return 0;
 	pk->entry.data = (void*)data;
 	pk->entry.key = (void*)pk;
@@ -398,12 +399,14 @@ parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
  * @param pkt: the packet for compression pointer resolution.
  * @param msg: the parsed message
  * @param rep: reply info to put rrs into.
+ * @param alloc: used for the rrset data if region is NULL.
  * @param region: if not NULL, used for allocation.
  * @return 0 on failure.
  */
 static int
 parse_copy_decompress(sldns_buffer* pkt, struct msg_parse* msg,
-	struct reply_info* rep, struct regional* region)
+	struct reply_info* rep, struct alloc_cache* alloc,
+	struct regional* region)
 {
 	size_t i;
 	struct rrset_parse *pset = msg->rrset_first;
@@ -415,7 +418,7 @@ parse_copy_decompress(sldns_buffer* pkt, struct msg_parse* msg,
 		rep->ttl = NORR_TTL;
 
 	for(i=0; i<rep->rrset_count; i++) {
-		if(!parse_copy_decompress_rrset(pkt, msg, pset, region,
+		if(!parse_copy_decompress_rrset(pkt, msg, pset, alloc, region,
 			rep->rrsets[i]))
 			return 0;
 		data = (struct packed_rrset_data*)rep->rrsets[i]->entry.data;
@@ -436,11 +439,11 @@ parse_create_msg(sldns_buffer* pkt, struct msg_parse* msg,
 	log_assert(pkt && msg);
 	if(!parse_create_qinfo(pkt, msg, qinf, region))
 		return 0;
-	if(!parse_create_repinfo(msg, rep, region))
+	if(!parse_create_repinfo(msg, rep, alloc, region))
 		return 0;
 	if(!repinfo_alloc_rrset_keys(*rep, alloc, region))
 		return 0;
-	if(!parse_copy_decompress(pkt, msg, *rep, region))
+	if(!parse_copy_decompress(pkt, msg, *rep, alloc, region))
 		return 0;
 	return 1;
 }
@@ -525,7 +528,7 @@ reply_info_parsedelete(struct reply_info* rep, struct alloc_cache* alloc)
 	for(i=0; i<rep->rrset_count; i++) {
 		ub_packed_rrset_parsedelete(rep->rrsets[i], alloc);
 	}
-	free(rep);
+	alloc_sized_release(alloc, rep);
 }
 
 int 
@@ -550,6 +553,92 @@ query_info_parse(struct query_info* m, sldns_buffer* query)
 	return 1;
 }
 
+enum query_decode_status
+query_info_decode_header(sldns_buffer* pkt, int harden_large,
+	int* rcode)
+{
+	uint8_t* q = sldns_buffer_begin(pkt);
+	if(sldns_buffer_limit(pkt) < LDNS_HEADER_SIZE) {
+		verbose(VERB_QUERY, "request too short, discarded");
+		return query_decode_drop;
+	}
+	if(sldns_buffer_limit(pkt) > QUERY_DECODE_LARGE && harden_large) {
+		verbose(VERB_QUERY, "request too large, discarded");
+		return query_decode_drop;
+	}
+	if(LDNS_QR_WIRE(q)) {
+		verbose(VERB_QUERY, "request has QR bit on, discarded");
+		return query_decode_drop;
+	}
+	*rcode = LDNS_RCODE_FORMERR;
+	if(LDNS_TC_WIRE(q)) {
+		LDNS_TC_CLR(q);
+		verbose(VERB_QUERY, "request bad, has TC bit on");
+		return query_decode_header;
+	}
+	if(LDNS_OPCODE_WIRE(q) != LDNS_PACKET_QUERY) {
+		verbose(VERB_QUERY, "request unknown opcode %d", 
+			LDNS_OPCODE_WIRE(q));
+		*rcode = LDNS_RCODE_NOTIMPL;
+		return query_decode_header;
+	}
+	if(LDNS_QDCOUNT(q) != 1) {
+		verbose(VERB_QUERY, "request wrong nr qd=%d", LDNS_QDCOUNT(q));
+		return query_decode_header;
+	}
+	if(LDNS_ANCOUNT(q) != 0) {
+		verbose(VERB_QUERY, "request wrong nr an=%d", LDNS_ANCOUNT(q));
+		return query_decode_header;
+	}
+	if(LDNS_NSCOUNT(q) != 0) {
+		verbose(VERB_QUERY, "request wrong nr ns=%d", LDNS_NSCOUNT(q));
+		return query_decode_header;
+	}
+	if(LDNS_ARCOUNT(q) > 1) {
+		verbose(VERB_QUERY, "request wrong nr ar=%d", LDNS_ARCOUNT(q));
+		return query_decode_header;
+	}
+	return query_decode_ok;
+}
+
+enum query_decode_status
+query_info_decode(sldns_buffer* pkt, int harden_large,
+	struct query_info* qinfo, hashvalue_type* h, struct edns_data* edns,
+	struct regional* region, int* rcode)
+{
+	uint8_t* q = sldns_buffer_begin(pkt);
+	struct keyhash_state s;
+	enum query_decode_status qs;
+	uint8_t cd;
+	/* the header */
+	if((qs = query_info_decode_header(pkt, harden_large, rcode)) !=
+		query_decode_ok)
+		return qs;
+
+	/* the question, the qname is hashed while it is read */
+	sldns_buffer_set_position(pkt, LDNS_HEADER_SIZE);
+	keyhash_init(&s);
+	qinfo->qname = sldns_buffer_current(pkt);
+	if((qinfo->qname_len = query_dname_len_hash(pkt, &s)) == 0)
+		return query_decode_question;
+	if(sldns_buffer_remaining(pkt) < 4)
+		return query_decode_question;
+	qinfo->qtype = sldns_buffer_read_u16(pkt);
+	qinfo->qclass = sldns_buffer_read_u16(pkt);
+	qinfo->local_alias = NULL;
+	/* the rest of the hash, like query_info_hash */
+	cd = (qinfo->qtype == LDNS_RR_TYPE_AAAA && LDNS_CD_WIRE(q));
+	keyhash_update(&s, &qinfo->qtype, sizeof(qinfo->qtype));
+	keyhash_update(&s, &cd, sizeof(cd));
+	keyhash_update(&s, &qinfo->qclass, sizeof(qinfo->qclass));
+	*h = keyhash_final(&s);
+
+	/* the OPT record, right after the question */
+	if((*rcode = parse_edns_from_pkt(pkt, edns, region)) != 0)
+		return query_decode_edns;
+	return query_decode_ok;
+}
+
 /** tiny subroutine for msgreply_compare */
 #define COMPARE_IT(x, y) \
 	if( (x) < (y) ) return -1; \
@@ -584,48 +673,54 @@ msgreply_sizefunc(void* k, void* d)
 {
 	struct msgreply_entry* q = (struct msgreply_entry*)k;
 	struct reply_info* r = (struct reply_info*)d;
-	size_t s = sizeof(struct msgreply_entry) + sizeof(struct reply_info)
-		+ q->key.qname_len + lock_get_mem(&q->entry.lock)
-		- sizeof(struct rrset_ref);
-	s += r->rrset_count * sizeof(struct rrset_ref);
-	s += r->rrset_count * sizeof(struct ub_packed_rrset_key*);
+	/* the entry and the reply info are blocks from their size class */
+	size_t s = alloc_sized_size(sizeof(struct msgreply_entry))
+		+ q->key.qname_len + lock_get_mem(&q->entry.lock);
+	s += alloc_sized_size(sizeof(struct reply_info)
+		- sizeof(struct rrset_ref)
+		+ r->rrset_count * sizeof(struct rrset_ref)
+		+ r->rrset_count * sizeof(struct ub_packed_rrset_key*));
 	return s;
 }
 
 void 
-query_entry_delete(void *k, void* ATTR_UNUSED(arg))
+query_entry_delete(void *k, void* arg)
 {
 	struct msgreply_entry* q = (struct msgreply_entry*)k;
 	lock_rw_destroy(&q->entry.lock);
 	query_info_clear(&q->key);
-	free(q);
+	alloc_sized_release((struct alloc_cache*)arg, q);
 }
 
 void 
-reply_info_delete(void* d, void* ATTR_UNUSED(arg))
+reply_info_delete(void* d, void* arg)
 {
 	struct reply_info* r = (struct reply_info*)d;
-	free(r);
+	alloc_sized_release((struct alloc_cache*)arg, r);
 }
 
 hashvalue_type
 query_info_hash(struct query_info *q, uint16_t flags)
 {
-	hashvalue_type h = 0xab;
-	h = hashlittle(&q->qtype, sizeof(q->qtype), h);
-	if(q->qtype == LDNS_RR_TYPE_AAAA && (flags&BIT_CD))
-		h++;
-	h = hashlittle(&q->qclass, sizeof(q->qclass), h);
-	h = dname_query_hash(q->qname, h);
-	return h;
+	struct keyhash_state s;
+	/* the AAAA type with CD flag is stored separately */
+	uint8_t cd = (q->qtype == LDNS_RR_TYPE_AAAA && (flags&BIT_CD));
+	/* Note this MUST be identical to query_info_decode, the qname is
+	 * first, because that is read before the type and class. */
+	keyhash_init(&s);
+	dname_query_hash_update(&s, q->qname);
+	keyhash_update(&s, &q->qtype, sizeof(q->qtype));
+	keyhash_update(&s, &cd, sizeof(cd));
+	keyhash_update(&s, &q->qclass, sizeof(q->qclass));
+	return keyhash_final(&s);
 }
 
 struct msgreply_entry* 
 query_info_entrysetup(struct query_info* q, struct reply_info* r, 
-	hashvalue_type h)
+	hashvalue_type h, struct alloc_cache* alloc)
 {
-	struct msgreply_entry* e = (struct msgreply_entry*)malloc( 
-		sizeof(struct msgreply_entry));
+	struct msgreply_entry* e = (struct msgreply_entry*)alloc_sized_obtain(
+		alloc, sizeof(struct msgreply_entry));
 	if(!e) return NULL;
 	memcpy(&e->key, q, sizeof(*q));
 	e->entry.hash = h;
@@ -643,7 +738,7 @@ query_info_entrysetup(struct query_info* q, struct reply_info* r,
 /** copy rrsets from replyinfo to dest replyinfo */
 static int
 repinfo_copy_rrsets(struct reply_info* dest, struct reply_info* from, 
-	struct regional* region)
+	struct alloc_cache* alloc, struct regional* region)
 {
 	size_t i, s;
 	struct packed_rrset_data* fd, *dd;
@@ -667,7 +762,9 @@ repinfo_copy_rrsets(struct reply_info* dest, struct reply_info* from,
 		if(region)
 			dd = (struct packed_rrset_data*)regional_alloc_init(
 				region, fd, s);
-		else	dd = (struct packed_rrset_data*)memdup(fd, s);
+		else if((dd = (struct packed_rrset_data*)alloc_sized_obtain(
+			alloc, s)) != NULL)
+			memcpy(dd, fd, s);
 		if(!dd) 
 			return 0;
 		packed_rrset_ptr_fixup(dd);
@@ -681,8 +778,8 @@ reply_info_copy(struct reply_info* rep, struct alloc_cache* alloc,
 	struct regional* region)
 {
 	struct reply_info* cp;
-	cp = construct_reply_info_base(region, rep->flags, rep->qdcount, 
-		rep->ttl, rep->prefetch_ttl, rep->an_numrrsets, 
+	cp = construct_reply_info_base(region, alloc, rep->flags,
+		rep->qdcount, rep->ttl, rep->prefetch_ttl, rep->an_numrrsets, 
 		rep->ns_numrrsets, rep->ar_numrrsets, rep->rrset_count, 
 		rep->security);
 	if(!cp)
@@ -693,7 +790,7 @@ reply_info_copy(struct reply_info* rep, struct alloc_cache* alloc,
 			reply_info_parsedelete(cp, alloc);
 		return NULL;
 	}
-	if(!repinfo_copy_rrsets(cp, rep, region)) {
+	if(!repinfo_copy_rrsets(cp, rep, alloc, region)) {
 		if(!region)
 			reply_info_parsedelete(cp, alloc);
 		return NULL;
@@ -218,6 +218,8 @@ struct msgreply_entry {
 /**
  * Constructor for replyinfo.
  * @param region: where to allocate the results, pass NULL to use malloc.
+ * @param alloc: if region is NULL, the reply info is a cache memory block
+ *	from this alloc (or malloced if NULL), free with alloc_sized_release.
  * @param flags: flags for the replyinfo.
  * @param qd: qd count
  * @param ttl: TTL of replyinfo
@@ -231,7 +233,8 @@ struct msgreply_entry {
  * in.  The array has been zeroed.  Returns NULL on malloc failure.
  */
 struct reply_info*
-construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
+construct_reply_info_base(struct regional* region,
+		struct alloc_cache* alloc, uint16_t flags, size_t qd,
 		time_t ttl, time_t prettl, size_t an, size_t ns, size_t ar,
 		size_t total, enum sec_status sec);
 
@@ -247,6 +250,69 @@ construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
  */
 int query_info_parse(struct query_info* m, struct sldns_buffer* query);
 
+/** Size of an UDP datagram */
+#define NORMAL_UDP_SIZE	512 /* bytes */
+
+/** queries larger than this are dropped by query_info_decode, with the
+ * harden-large-queries option */
+#define QUERY_DECODE_LARGE NORMAL_UDP_SIZE
+
+/**
+ * The result of query_info_decode. The failures are in the order of the
+ * packet, the query is decoded up to the part that failed.
+ */
+enum query_decode_status {
+	/** the query is decoded */
+	query_decode_ok = 0,
+	/** the request is to be dropped, it is too short, too large,
+	 * or it is a reply */
+	query_decode_drop,
+	/** the header is wrong, the error rcode is returned */
+	query_decode_header,
+	/** the question section is malformed, formerror */
+	query_decode_question,
+	/** the EDNS record is malformed, the error rcode is returned,
+	 * the query info and hash are decoded */
+	query_decode_edns
+};
+
+/**
+ * Check the header of a query from a client, the first part of
+ * query_info_decode.  It is used for clients that are refused, before
+ * their query is decoded.
+ * @param pkt: the wireformat packet query, starts with ID.
+ *	If the TC flag is set, it is cleared (and formerror returned).
+ * @param harden_large: if true, packets larger than QUERY_DECODE_LARGE
+ *	are dropped.
+ * @param rcode: the rcode to reply with, for the header errors.
+ * @return query_decode_ok, query_decode_drop or query_decode_header.
+ */
+enum query_decode_status query_info_decode_header(struct sldns_buffer* pkt,
+	int harden_large, int* rcode);
+
+/**
+ * Decode a query from a client in one pass over the packet. It checks
+ * the header, reads the query info and hashes the qname while it is
+ * read, and then parses the EDNS record. The result is the same as
+ * query_info_parse, parse_edns_from_pkt and query_info_hash (with the
+ * header flags) together.
+ * The query info contains a pointer back into the buffer.
+ * @param pkt: the wireformat packet query, starts with ID. At the end the
+ *	position is after the question or EDNS data, like for those calls.
+ *	If the TC flag is set, it is cleared (and formerror returned).
+ * @param harden_large: if true, packets larger than QUERY_DECODE_LARGE
+ *	are dropped.
+ * @param qinfo: the query info is returned here.
+ * @param h: the hash of the query info for the message cache.
+ * @param edns: the edns data is returned here.
+ * @param region: to allocate the edns option contents.
+ * @param rcode: the rcode to reply with, for the header and edns errors.
+ * @return query_decode_ok, or where the query is wrong.
+ */
+enum query_decode_status query_info_decode(struct sldns_buffer* pkt,
+	int harden_large, struct query_info* qinfo, hashvalue_type* h,
+	struct edns_data* edns, struct regional* region, int* rcode);
+
 /**
  * Parse query reply.
  * Fills in preallocated query_info structure (with ptr into buffer).
@@ -337,15 +403,17 @@ hashvalue_type query_info_hash(struct query_info *q, uint16_t flags);
  * @param q: query info to copy. Emptied as if clear is called.
  * @param r: reply to init data.
  * @param h: hash value.
+ * @param alloc: the cache item is a memory block from this alloc.
  * @return: newly allocated message reply cache item.
  */
 struct msgreply_entry* query_info_entrysetup(struct query_info* q,
-	struct reply_info* r, hashvalue_type h);
+	struct reply_info* r, hashvalue_type h, struct alloc_cache* alloc);
 
 /**
  * Copy reply_info and all rrsets in it and allocate.
  * @param rep: what to copy, probably inside region, no ref[] array in it.
- * @param alloc: how to allocate rrset keys.
+ * @param alloc: how to allocate rrset keys, and the memory blocks for the
+ *	reply and the rrset data.
  *	Not used if region!=NULL, it can be NULL in that case.
  * @param region: if this parameter is NULL then malloc and the alloc is used.
  *	otherwise, everything is allocated in this region.
@@ -361,6 +429,7 @@ struct reply_info* reply_info_copy(struct reply_info* rep,
  * @param pkt: packet for decompression
  * @param msg: the parser message (for flags for trust).
  * @param pset: the parsed rrset to copy.
+ * @param alloc: if region is NULL, the rdata is a memory block from this.
  * @param region: if NULL - malloc, else data is allocated in this region.
  * @param pk: a freshly obtained rrsetkey structure. No dname is set yet,
  *	will be set on return.
@@ -368,8 +437,8 @@ struct reply_info* reply_info_copy(struct reply_info* rep,
  * @return false on alloc failure.
  */
 int parse_copy_decompress_rrset(struct sldns_buffer* pkt, struct msg_parse* msg,
-	struct rrset_parse *pset, struct regional* region, 
-	struct ub_packed_rrset_key* pk);
+	struct rrset_parse *pset, struct alloc_cache* alloc,
+	struct regional* region, struct ub_packed_rrset_key* pk);
 
 /**
  * Find final cname target in reply, the one matching qinfo. Follows CNAMEs.
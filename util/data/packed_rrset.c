@@ -42,7 +42,7 @@
 #include "config.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/log.h"
 #include "util/alloc.h"
 #include "util/regional.h"
@@ -57,7 +57,7 @@ ub_packed_rrset_parsedelete(struct ub_packed_rrset_key* pkey,
 {
 	if(!pkey)
 		return;
-	free(pkey->entry.data);
+	alloc_sized_release(alloc, pkey->entry.data);
 	pkey->entry.data = NULL;
 	free(pkey->rk.dname);
 	pkey->rk.dname = NULL;
@@ -71,7 +71,8 @@ ub_rrset_sizefunc(void* key, void* data)
 	struct ub_packed_rrset_key* k = (struct ub_packed_rrset_key*)key;
 	struct packed_rrset_data* d = (struct packed_rrset_data*)data;
 	size_t s = sizeof(struct ub_packed_rrset_key) + k->rk.dname_len;
-	s += packed_rrset_sizeof(d) + lock_get_mem(&k->entry.lock);
+	s += alloc_sized_size(packed_rrset_sizeof(d)) +
+		lock_get_mem(&k->entry.lock);
 	return s;
 }
 
@@ -135,10 +136,10 @@ ub_rrset_key_delete(void* key, void* userdata)
 }
 
 void 
-rrset_data_delete(void* data, void* ATTR_UNUSED(userdata))
+rrset_data_delete(void* data, void* userdata)
 {
 	struct packed_rrset_data* d = (struct packed_rrset_data*)data;
-	free(d);
+	alloc_sized_release((struct alloc_cache*)userdata, d);
 }
 
 int 
@@ -165,12 +166,15 @@ rrset_key_hash(struct packed_rrset_key* key)
 	uint16_t t = ntohs(key->type);
 	/* Note this MUST be identical to pkt_hash_rrset in msgparse.c */
 	/* this routine does not have a compressed name */
+	struct keyhash_state s;
 	hashvalue_type h = 0xab;
-	h = dname_query_hash(key->dname, h);
-	h = hashlittle(&t, sizeof(t), h);
-	h = hashlittle(&key->rrset_class, sizeof(uint16_t), h);
-	h = hashlittle(&key->flags, sizeof(uint32_t), h);
-	return h;
+	keyhash_init(&s);
+	keyhash_update(&s, &h, sizeof(h));
+	dname_query_hash_update(&s, key->dname);
+	keyhash_update(&s, &t, sizeof(t));
+	keyhash_update(&s, &key->rrset_class, sizeof(uint16_t));
+	keyhash_update(&s, &key->flags, sizeof(uint32_t));
+	return keyhash_final(&s);
 }
 
 void 
@@ -374,7 +378,10 @@ packed_rrset_copy_alloc(struct ub_packed_rrset_key* key,
 		alloc_special_release(alloc, dk);
 		return NULL;
 	}
-	dd = (struct packed_rrset_data*)memdup(fd, packed_rrset_sizeof(fd));
+	dd = (struct packed_rrset_data*)alloc_sized_obtain(alloc,
+		packed_rrset_sizeof(fd));
+	if(dd)
+		memcpy(dd, fd, packed_rrset_sizeof(fd));
 	if(!dd) {
 		free(dk->rk.dname);
 		alloc_special_release(alloc, dk);
@@ -275,7 +275,8 @@ struct packed_rrset_list {
  * Delete packed rrset key and data, not entered in hashtables yet.
  * Used during parsing.
  * @param pkey: rrset key structure with locks, key and data pointers.
- * @param alloc: where to return the unfree-able key structure.
+ * @param alloc: where to return the unfree-able key structure, and the
+ *	memory block of the data.
  */
 void ub_packed_rrset_parsedelete(struct ub_packed_rrset_key* pkey,
 	struct alloc_cache* alloc);
@@ -331,7 +332,7 @@ void ub_rrset_key_delete(void* key, void* userdata);
 /**
  * Old data to be deleted.
  * @param data: what to delete.
- * @param userdata: user data ptr.
+ * @param userdata: alloc structure to return the memory block to.
  */
 void rrset_data_delete(void* data, void* userdata);
 
@@ -60,6 +60,7 @@
 #include "validator/val_nsec3.h"
 #include "validator/val_sigcrypt.h"
 #include "validator/val_kentry.h"
+#include "validator/val_secalgo.h"
 #include "validator/val_neg.h"
 #include "validator/autotrust.h"
 #include "util/data/msgreply.h"
@@ -82,6 +83,9 @@
 #ifdef USE_CACHEDB
 #include "cachedb/cachedb.h"
 #endif
+#ifdef USE_DYNLIBMOD
+#include "dynlibmod/dynlibmod.h"
+#endif
 
 int 
 fptr_whitelist_comm_point(comm_point_callback_type *fptr)
@@ -100,6 +104,8 @@ fptr_whitelist_comm_point_raw(comm_point_callback_type *fptr)
 	else if(fptr == &tube_handle_write) return 1;
 	else if(fptr == &remote_accept_callback) return 1;
 	else if(fptr == &remote_control_callback) return 1;
+	else if(fptr == &metrics_accept_callback) return 1;
+	else if(fptr == &metrics_conn_callback) return 1;
 	return 0;
 }
 
@@ -111,6 +117,8 @@ fptr_whitelist_comm_timer(void (*fptr)(void*))
 	else if(fptr == &pending_udp_timer_delay_cb) return 1;
 	else if(fptr == &worker_stat_timer_cb) return 1;
 	else if(fptr == &worker_probe_timer_cb) return 1;
+	else if(fptr == &worker_hedge_timer_cb) return 1;
+	else if(fptr == &libworker_hedge_timer_cb) return 1;
 #ifdef UB_ON_WINDOWS
 	else if(fptr == &wsvc_cron_cb) return 1;
 #endif
@@ -149,6 +157,7 @@ fptr_whitelist_event(void (*fptr)(int, short, void *))
 	else if(fptr == &comm_point_raw_handle_callback) return 1;
 	else if(fptr == &tube_handle_signal) return 1;
 	else if(fptr == &comm_base_handle_slow_accept) return 1;
+	else if(fptr == &comm_base_wheel_callback) return 1;
 #ifdef UB_ON_WINDOWS
 	else if(fptr == &worker_win_stop_cb) return 1;
 #endif
@@ -190,8 +199,6 @@ fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 	else if(fptr == &local_zone_cmp) return 1;
 	else if(fptr == &local_data_cmp) return 1;
 	else if(fptr == &fwd_cmp) return 1;
-	else if(fptr == &pending_cmp) return 1;
-	else if(fptr == &serviced_cmp) return 1;
 	else if(fptr == &name_tree_compare) return 1;
 	else if(fptr == &order_lock_cmp) return 1;
 	else if(fptr == &codeline_cmp) return 1;
@@ -208,13 +215,25 @@ fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *))
 	return 0;
 }
 
+int 
+fptr_whitelist_hashindex_cmp(int (*fptr) (const void *, const void *))
+{
+	if(fptr == &mesh_state_compare) return 1;
+	else if(fptr == &pending_cmp) return 1;
+	else if(fptr == &serviced_cmp) return 1;
+	return 0;
+}
+
 int 
 fptr_whitelist_hash_sizefunc(lruhash_sizefunc_type fptr)
 {
 	if(fptr == &msgreply_sizefunc) return 1;
 	else if(fptr == &ub_rrset_sizefunc) return 1;
 	else if(fptr == &infra_sizefunc) return 1;
+	else if(fptr == &infra_lame_sizefunc) return 1;
 	else if(fptr == &key_entry_sizefunc) return 1;
+	else if(fptr == &secalgo_pkey_sizefunc) return 1;
+	else if(fptr == &nsec3_hcache_sizefunc) return 1;
 	else if(fptr == &rate_sizefunc) return 1;
 	else if(fptr == &ip_rate_sizefunc) return 1;
 	else if(fptr == &test_slabhash_sizefunc) return 1;
@@ -227,7 +246,10 @@ fptr_whitelist_hash_compfunc(lruhash_compfunc_type fptr)
 	if(fptr == &query_info_compare) return 1;
 	else if(fptr == &ub_rrset_compare) return 1;
 	else if(fptr == &infra_compfunc) return 1;
+	else if(fptr == &infra_lame_compfunc) return 1;
 	else if(fptr == &key_entry_compfunc) return 1;
+	else if(fptr == &secalgo_pkey_compfunc) return 1;
+	else if(fptr == &nsec3_hcache_compfunc) return 1;
 	else if(fptr == &rate_compfunc) return 1;
 	else if(fptr == &ip_rate_compfunc) return 1;
 	else if(fptr == &test_slabhash_compfunc) return 1;
@@ -240,7 +262,10 @@ fptr_whitelist_hash_delkeyfunc(lruhash_delkeyfunc_type fptr)
 	if(fptr == &query_entry_delete) return 1;
 	else if(fptr == &ub_rrset_key_delete) return 1;
 	else if(fptr == &infra_delkeyfunc) return 1;
+	else if(fptr == &infra_lame_delkeyfunc) return 1;
 	else if(fptr == &key_entry_delkeyfunc) return 1;
+	else if(fptr == &secalgo_pkey_delkeyfunc) return 1;
+	else if(fptr == &nsec3_hcache_delkeyfunc) return 1;
 	else if(fptr == &rate_delkeyfunc) return 1;
 	else if(fptr == &ip_rate_delkeyfunc) return 1;
 	else if(fptr == &test_slabhash_delkey) return 1;
@@ -253,7 +278,10 @@ fptr_whitelist_hash_deldatafunc(lruhash_deldatafunc_type fptr)
 	if(fptr == &reply_info_delete) return 1;
 	else if(fptr == &rrset_data_delete) return 1;
 	else if(fptr == &infra_deldatafunc) return 1;
+	else if(fptr == &infra_lame_deldatafunc) return 1;
 	else if(fptr == &key_entry_deldatafunc) return 1;
+	else if(fptr == &secalgo_pkey_deldatafunc) return 1;
+	else if(fptr == &nsec3_hcache_deldatafunc) return 1;
 	else if(fptr == &rate_deldatafunc) return 1;
 	else if(fptr == &test_slabhash_deldata) return 1;
 	return 0;
@@ -279,6 +307,15 @@ fptr_whitelist_modenv_send_query(struct outbound_entry* (*fptr)(
 	return 0;
 }
 
+int 
+fptr_whitelist_modenv_hedge_query(int (*fptr)(struct outbound_entry* e,
+	int ms))
+{
+	if(fptr == &worker_hedge_query) return 1;
+	else if(fptr == &libworker_hedge_query) return 1;
+	return 0;
+}
+
 int 
 fptr_whitelist_modenv_detach_subs(void (*fptr)(
         struct module_qstate* qstate))
@@ -287,6 +324,14 @@ fptr_whitelist_modenv_detach_subs(void (*fptr)(
 	return 0;
 }
 
+int 
+fptr_whitelist_modenv_cancel_subs(void (*fptr)(
+        struct module_qstate* qstate))
+{
+	if(fptr == &mesh_cancel_subs) return 1;
+	return 0;
+}
+
 int 
 fptr_whitelist_modenv_attach_sub(int (*fptr)(
         struct module_qstate* qstate, struct query_info* qinfo,
@@ -323,6 +368,9 @@ fptr_whitelist_mod_init(int (*fptr)(struct module_env* env, int id))
 #endif
 #ifdef USE_CACHEDB
 	else if(fptr == &cachedb_init) return 1;
+#endif
+#ifdef USE_DYNLIBMOD
+	else if(fptr == &dynlibmod_init) return 1;
 #endif
 	return 0;
 }
@@ -338,6 +386,9 @@ fptr_whitelist_mod_deinit(void (*fptr)(struct module_env* env, int id))
 #endif
 #ifdef USE_CACHEDB
 	else if(fptr == &cachedb_deinit) return 1;
+#endif
+#ifdef USE_DYNLIBMOD
+	else if(fptr == &dynlibmod_deinit) return 1;
 #endif
 	return 0;
 }
@@ -354,6 +405,9 @@ fptr_whitelist_mod_operate(void (*fptr)(struct module_qstate* qstate,
 #endif
 #ifdef USE_CACHEDB
 	else if(fptr == &cachedb_operate) return 1;
+#endif
+#ifdef USE_DYNLIBMOD
+	else if(fptr == &dynlibmod_operate) return 1;
 #endif
 	return 0;
 }
@@ -370,6 +424,9 @@ fptr_whitelist_mod_inform_super(void (*fptr)(
 #endif
 #ifdef USE_CACHEDB
 	else if(fptr == &cachedb_inform_super) return 1;
+#endif
+#ifdef USE_DYNLIBMOD
+	else if(fptr == &dynlibmod_inform_super) return 1;
 #endif
 	return 0;
 }
@@ -386,6 +443,9 @@ fptr_whitelist_mod_clear(void (*fptr)(struct module_qstate* qstate,
 #endif
 #ifdef USE_CACHEDB
 	else if(fptr == &cachedb_clear) return 1;
+#endif
+#ifdef USE_DYNLIBMOD
+	else if(fptr == &dynlibmod_clear) return 1;
 #endif
 	return 0;
 }
@@ -401,6 +461,9 @@ fptr_whitelist_mod_get_mem(size_t (*fptr)(struct module_env* env, int id))
 #endif
 #ifdef USE_CACHEDB
 	else if(fptr == &cachedb_get_mem) return 1;
+#endif
+#ifdef USE_DYNLIBMOD
+	else if(fptr == &dynlibmod_get_mem) return 1;
 #endif
 	return 0;
 }
@@ -439,30 +502,47 @@ int fptr_whitelist_print_func(void (*fptr)(char*,void*))
 int fptr_whitelist_inplace_cb_reply_generic(inplace_cb_reply_func_type* fptr,
 	enum inplace_cb_list_type type)
 {
-#ifndef WITH_PYTHONMODULE
+#if !defined(WITH_PYTHONMODULE) && !defined(USE_DYNLIBMOD)
 	(void)fptr;
 #endif
 	if(type == inplace_cb_reply) {
 #ifdef WITH_PYTHONMODULE
 		if(fptr == &python_inplace_cb_reply_generic) return 1;
+#endif
+#ifdef USE_DYNLIBMOD
+		if(fptr == &dynlib_inplace_cb_reply) return 1;
 #endif
 	} else if(type == inplace_cb_reply_cache) {
 #ifdef WITH_PYTHONMODULE
 		if(fptr == &python_inplace_cb_reply_generic) return 1;
+#endif
+#ifdef USE_DYNLIBMOD
+		if(fptr == &dynlib_inplace_cb_reply_cache) return 1;
 #endif
 	} else if(type == inplace_cb_reply_local) {
 #ifdef WITH_PYTHONMODULE
 		if(fptr == &python_inplace_cb_reply_generic) return 1;
+#endif
+#ifdef USE_DYNLIBMOD
+		if(fptr == &dynlib_inplace_cb_reply_local) return 1;
 #endif
 	} else if(type == inplace_cb_reply_servfail) {
 #ifdef WITH_PYTHONMODULE
 		if(fptr == &python_inplace_cb_reply_generic) return 1;
+#endif
+#ifdef USE_DYNLIBMOD
+		if(fptr == &dynlib_inplace_cb_reply_servfail) return 1;
 #endif
 	}
 	return 0;
 }
 
-int fptr_whitelist_inplace_cb_query(inplace_cb_query_func_type* ATTR_UNUSED(fptr))
+int fptr_whitelist_inplace_cb_query(inplace_cb_query_func_type* fptr)
 {
+#ifdef USE_DYNLIBMOD
+	if(fptr == &dynlib_inplace_cb_query) return 1;
+#else
+	(void)fptr;
+#endif
 	return 0;
 }
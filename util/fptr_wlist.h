@@ -163,6 +163,14 @@ int fptr_whitelist_serviced_query(comm_point_callback_type *fptr);
  */
 int fptr_whitelist_rbtree_cmp(int (*fptr) (const void *, const void *));
 
+/**
+ * Check function pointer whitelist for hash index cmp callback values.
+ *
+ * @param fptr: function pointer to check.
+ * @return false if not in whitelist.
+ */
+int fptr_whitelist_hashindex_cmp(int (*fptr) (const void *, const void *));
+
 /**
  * Check function pointer whitelist for lruhash sizefunc callback values.
  *
@@ -214,6 +222,15 @@ int fptr_whitelist_modenv_send_query(struct outbound_entry* (*fptr)(
 	int nocaps, struct sockaddr_storage* addr, socklen_t addrlen,
 	uint8_t* zone, size_t zonelen, int ssl_upstream, struct module_qstate* q));
 
+/**
+ * Check function pointer whitelist for module_env hedge_query callback values.
+ *
+ * @param fptr: function pointer to check.
+ * @return false if not in whitelist.
+ */
+int fptr_whitelist_modenv_hedge_query(int (*fptr)(struct outbound_entry* e,
+	int ms));
+
 /**
  * Check function pointer whitelist for module_env detach_subs callback values.
  *
@@ -223,6 +240,15 @@ int fptr_whitelist_modenv_send_query(struct outbound_entry* (*fptr)(
 int fptr_whitelist_modenv_detach_subs(void (*fptr)(
 	struct module_qstate* qstate));
 
+/**
+ * Check function pointer whitelist for module_env cancel_subs callback values.
+ *
+ * @param fptr: function pointer to check.
+ * @return false if not in whitelist.
+ */
+int fptr_whitelist_modenv_cancel_subs(void (*fptr)(
+	struct module_qstate* qstate));
+
 /**
  * Check function pointer whitelist for module_env attach_sub callback values.
  *
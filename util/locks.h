@@ -299,6 +299,28 @@ typedef void* ub_thread_key_type;
 #endif /* HAVE_PTHREAD */
 #endif /* USE_THREAD_DEBUG */
 
+/*
+ * Loads and stores of a value that other threads read without a lock.
+ * What a thread wrote before ub_store_release is visible to the thread
+ * that reads the value with ub_load_acquire.  ub_load_relaxed reads a
+ * counter that another thread writes, the value is read whole, without
+ * an order with the other loads.  UB_ATOMIC_ORDERED is defined when the
+ * compiler provides this ordering, or without threads.
+ */
+#ifdef __ATOMIC_ACQUIRE
+#define UB_ATOMIC_ORDERED 1
+#define ub_load_acquire(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define ub_store_release(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define ub_load_relaxed(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#else
+#ifdef THREADS_DISABLED
+#define UB_ATOMIC_ORDERED 1
+#endif
+#define ub_load_acquire(p) (*(p))
+#define ub_store_release(p, v) (*(p) = (v))
+#define ub_load_relaxed(p) (*(p))
+#endif
+
 /**
  * Block all signals for this thread.
  * fatal exit on error.
@@ -67,6 +67,7 @@ strmodulevent(enum module_ev e)
 	case module_event_capsfail: return "module_event_capsfail";
 	case module_event_moddone: return "module_event_moddone";
 	case module_event_error: return "module_event_error";
+	case module_event_hedge: return "module_event_hedge";
 	}
 	return "bad_event_value";
 }
@@ -269,6 +270,37 @@ inplace_cb_lists_delete(struct module_env* env)
     inplace_cb_query_delete(env);
 }
 
+void
+inplace_cb_delete_arg(struct module_env* env, enum inplace_cb_list_type type,
+	void* cb_arg)
+{
+	if(type == inplace_cb_query) {
+		struct inplace_cb_query** prevp = (struct inplace_cb_query**)
+			&env->inplace_cb_lists[type];
+		while(*prevp) {
+			struct inplace_cb_query* curr = *prevp;
+			if(curr->cb_arg == cb_arg) {
+				*prevp = curr->next;
+				free(curr);
+			} else {
+				prevp = &curr->next;
+			}
+		}
+	} else {
+		struct inplace_cb_reply** prevp = (struct inplace_cb_reply**)
+			&env->inplace_cb_lists[type];
+		while(*prevp) {
+			struct inplace_cb_reply* curr = *prevp;
+			if(curr->cb_arg == cb_arg) {
+				*prevp = curr->next;
+				free(curr);
+			} else {
+				prevp = &curr->next;
+			}
+		}
+	}
+}
+
 struct edns_known_option*
 edns_option_is_known(uint16_t opt_code, struct module_env* env)
 {
@@ -170,6 +170,7 @@ struct module_qstate;
 struct ub_randstate;
 struct mesh_area;
 struct mesh_state;
+struct qlog_ring;
 struct val_anchors;
 struct val_neg_cache;
 struct iter_forwards;
@@ -337,6 +338,18 @@ struct module_env {
 		uint8_t* zone, size_t zonelen, int ssl_upstream,
 		struct module_qstate* q);
 
+	/**
+	 * Start the hedge timer for an outstanding query. If no reply has
+	 * arrived when it expires, operate() is called with event
+	 * module_event_hedge for the outbound entry, and the module can
+	 * send the query to another server as well.  The timer is removed
+	 * when the outbound entry is removed.
+	 * @param e: outbound entry returned by send_query.
+	 * @param ms: time to wait, in msec.
+	 * @return false on failure (malloc), no timer is set.
+	 */
+	int (*hedge_query)(struct outbound_entry* e, int ms);
+
 	/**
 	 * Detach-subqueries.
 	 * Remove all sub-query references from this query state.
@@ -346,6 +359,16 @@ struct module_env {
 	 */
 	void (*detach_subs)(struct module_qstate* qstate);
 
+	/**
+	 * Cancel-subqueries.
+	 * Like detach_subs, but sub-queries that are left without any
+	 * super-query or client waiting for them are deleted, so their
+	 * outstanding queries are stopped.
+	 * Updates stat items in mesh_area structure.
+	 * @param qstate: used to find mesh state.
+	 */
+	void (*cancel_subs)(struct module_qstate* qstate);
+
 	/**
 	 * Attach subquery.
 	 * Creates it if it does not exist already.
@@ -406,6 +429,9 @@ struct module_env {
 	struct worker* worker;
 	/** mesh area with query state dependencies */
 	struct mesh_area* mesh;
+	/** ring of the asynchronous query log for this thread, NULL if
+	 * the queries and replies are logged directly */
+	struct qlog_ring* qlog;
 	/** allocation service */
 	struct alloc_cache* alloc;
 	/** random table to generate random numbers */
@@ -492,7 +518,10 @@ enum module_ev {
 	/** next module is done, and its reply is awaiting you */
 	module_event_moddone,
 	/** error */
-	module_event_error
+	module_event_error,
+	/** the hedge timer expired, no reply yet, another server may
+	 * be queried */
+	module_event_hedge
 };
 
 /** 
@@ -766,6 +795,16 @@ void inplace_cb_query_delete(struct module_env* env);
  */
 void inplace_cb_lists_delete(struct module_env* env);
 
+/**
+ * Delete the inplace callbacks with the given callback argument from a
+ * list, for a module that removes its callbacks when it is deleted.
+ * @param env: the module environment.
+ * @param type: the list of callbacks.
+ * @param cb_arg: the callback argument of the callbacks to delete.
+ */
+void inplace_cb_delete_arg(struct module_env* env,
+	enum inplace_cb_list_type type, void* cb_arg);
+
 /**
  * Check if an edns option is known.
  * @param opt_code: the edns option code.
@@ -44,6 +44,7 @@
 #include "util/log.h"
 #include "util/net_help.h"
 #include "util/fptr_wlist.h"
+#include "util/timewheel.h"
 #include "sldns/pkthdr.h"
 #include "sldns/sbuffer.h"
 #include "dnstap/dnstap.h"
@@ -117,6 +118,15 @@ struct internal_base {
 	struct ub_event* slow_accept;
 	/** true if slow_accept is enabled */
 	int slow_accept_enabled;
+	/** timing wheel for the coarse timers, created when the first
+	 * coarse timer is created */
+	struct timewheel* wheel;
+	/** the event that runs the timing wheel */
+	struct ub_event* wheel_ev;
+	/** when wheel_ev fires, in msec */
+	uint64_t wheel_wake;
+	/** true if wheel_ev is set */
+	int wheel_armed;
 };
 
 /**
@@ -131,6 +141,10 @@ struct internal_timer {
 	struct ub_event* ev;
 	/** is timer enabled */
 	uint8_t enabled;
+	/** if the timer is in the timing wheel, and has no ev */
+	uint8_t coarse;
+	/** entry in the timing wheel, for coarse timers */
+	struct timewheel_entry wentry;
 };
 
 /**
@@ -148,6 +162,9 @@ static struct comm_point* comm_point_create_tcp_handler(
 	struct comm_base *base, struct comm_point* parent, size_t bufsize,
         comm_point_callback_type* callback, void* callback_arg);
 
+/** delete the timing wheel of the comm base */
+static void comm_base_wheel_delete(struct comm_base* b);
+
 /* -------- End of local definitions -------- */
 
 struct comm_base* 
@@ -204,6 +221,7 @@ comm_base_delete(struct comm_base* b)
 		}
 		ub_event_free(b->eb->slow_accept);
 	}
+	comm_base_wheel_delete(b);
 	ub_event_base_free(b->eb->base);
 	b->eb->base = NULL;
 	free(b->eb);
@@ -221,6 +239,7 @@ comm_base_delete_no_base(struct comm_base* b)
 		}
 		ub_event_free(b->eb->slow_accept);
 	}
+	comm_base_wheel_delete(b);
 	b->eb->base = NULL;
 	free(b->eb);
 	free(b);
@@ -2193,12 +2212,119 @@ comm_timer_create(struct comm_base* base, void (*cb)(void*), void* cb_arg)
 	return &tm->super;
 }
 
+/** the time of the comm base in msec */
+static uint64_t
+comm_base_msec(struct comm_base* b)
+{
+	return ((uint64_t)b->eb->now.tv_sec)*1000 +
+		((uint64_t)b->eb->now.tv_usec)/1000;
+}
+
+/** set the event of the timing wheel to fire at the time, in msec */
+static void
+comm_base_wheel_arm(struct comm_base* b, uint64_t wake)
+{
+	struct internal_base* eb = b->eb;
+	uint64_t now = comm_base_msec(b);
+	struct timeval tv;
+	if(eb->wheel_armed) {
+		if(eb->wheel_wake <= wake)
+			return;
+		ub_timer_del(eb->wheel_ev);
+	}
+	wake = (wake > now)?wake - now:0;
+	tv.tv_sec = (time_t)(wake/1000);
+	tv.tv_usec = (suseconds_t)((wake%1000)*1000);
+	if(ub_timer_add(eb->wheel_ev, eb->base, comm_base_wheel_callback, b,
+		&tv) != 0) {
+		log_err("comm_base_wheel_arm: evtimer_add failed.");
+		return;
+	}
+	eb->wheel_wake = now + wake;
+	eb->wheel_armed = 1;
+}
+
+static void
+comm_base_wheel_delete(struct comm_base* b)
+{
+	if(!b->eb->wheel)
+		return;
+	if(b->eb->wheel_armed)
+		ub_timer_del(b->eb->wheel_ev);
+	ub_event_free(b->eb->wheel_ev);
+	timewheel_delete(b->eb->wheel);
+	b->eb->wheel = NULL;
+}
+
+void
+comm_base_wheel_callback(int ATTR_UNUSED(fd), short event, void* arg)
+{
+	struct comm_base* b = (struct comm_base*)arg;
+	struct timewheel_entry list, *e;
+	struct internal_timer* tm;
+	uint64_t next;
+	if(!(event&UB_EV_TIMEOUT))
+		return;
+	ub_comm_base_now(b);
+	b->eb->wheel_armed = 0;
+	timewheel_list_init(&list);
+	timewheel_expire(b->eb->wheel, comm_base_msec(b), &list);
+	/* the callbacks can delete or set timers, also ones in the list */
+	while(list.next != &list) {
+		e = list.next;
+		timewheel_remove(e);
+		tm = (struct internal_timer*)e->data;
+		tm->enabled = 0;
+		fptr_ok(fptr_whitelist_comm_timer(tm->super.callback));
+		(*tm->super.callback)(tm->super.cb_arg);
+	}
+	if(timewheel_next(b->eb->wheel, &next))
+		comm_base_wheel_arm(b, next);
+}
+
+struct comm_timer*
+comm_timer_create_coarse(struct comm_base* base, void (*cb)(void*),
+	void* cb_arg)
+{
+	struct internal_timer *tm;
+	if(!base->eb->wheel) {
+		base->eb->wheel = timewheel_create(comm_base_msec(base));
+		if(!base->eb->wheel) {
+			log_err("malloc failed");
+			return NULL;
+		}
+		base->eb->wheel_ev = ub_event_new(base->eb->base, -1,
+			UB_EV_TIMEOUT, comm_base_wheel_callback, base);
+		if(!base->eb->wheel_ev) {
+			log_err("timer_create: event_base_set failed.");
+			timewheel_delete(base->eb->wheel);
+			base->eb->wheel = NULL;
+			return NULL;
+		}
+	}
+	tm = (struct internal_timer*)calloc(1, sizeof(struct internal_timer));
+	if(!tm) {
+		log_err("malloc failed");
+		return NULL;
+	}
+	tm->super.ev_timer = tm;
+	tm->base = base;
+	tm->super.callback = cb;
+	tm->super.cb_arg = cb_arg;
+	tm->coarse = 1;
+	tm->wentry.data = tm;
+	return &tm->super;
+}
+
 void 
 comm_timer_disable(struct comm_timer* timer)
 {
 	if(!timer)
 		return;
-	ub_timer_del(timer->ev_timer->ev);
+	if(timer->ev_timer->coarse)
+		/* the wheel event is left, it finds nothing to do */
+		timewheel_remove(&timer->ev_timer->wentry);
+	else	ub_timer_del(timer->ev_timer->ev);
 	timer->ev_timer->enabled = 0;
 }
 
@@ -2208,6 +2334,16 @@ comm_timer_set(struct comm_timer* timer, struct timeval* tv)
 	log_assert(tv);
 	if(timer->ev_timer->enabled)
 		comm_timer_disable(timer);
+	if(timer->ev_timer->coarse) {
+		struct comm_base* b = timer->ev_timer->base;
+		timewheel_add(b->eb->wheel, &timer->ev_timer->wentry,
+			comm_base_msec(b) + ((uint64_t)tv->tv_sec)*1000 +
+			((uint64_t)tv->tv_usec)/1000);
+		comm_base_wheel_arm(b, timer->ev_timer->wentry.expire *
+			TIMEWHEEL_TICK);
+		timer->ev_timer->enabled = 1;
+		return;
+	}
 	if(ub_timer_add(timer->ev_timer->ev, timer->ev_timer->base->eb->base,
 		comm_timer_callback, timer, tv) != 0)
 		log_err("comm_timer_set: evtimer_add failed.");
@@ -2223,7 +2359,8 @@ comm_timer_delete(struct comm_timer* timer)
 	/* Free the sub struct timer->ev_timer derived from the super struct timer.
 	 * i.e. assert(timer == timer->ev_timer)
 	 */
-	ub_event_free(timer->ev_timer->ev);
+	if(!timer->ev_timer->coarse)
+		ub_event_free(timer->ev_timer->ev);
 	free(timer->ev_timer);
 }
 
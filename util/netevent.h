@@ -536,6 +536,19 @@ size_t comm_point_get_mem(struct comm_point* c);
 struct comm_timer* comm_timer_create(struct comm_base* base, 
 	void (*cb)(void*), void* cb_arg);
 
+/**
+ * create timer for a coarse timeout, like for a query sent upstream.
+ * The timer is kept in the timing wheel of the base, that is cheaper to
+ * set and disable for many timers. It fires up to TIMEWHEEL_TICK msec
+ * late. Not active upon creation.
+ * @param base: event handling base.
+ * @param cb: callback function: void myfunc(void* myarg);
+ * @param cb_arg: user callback argument.
+ * @return: the new timer or NULL on error.
+ */
+struct comm_timer* comm_timer_create_coarse(struct comm_base* base,
+	void (*cb)(void*), void* cb_arg);
+
 /**
  * disable timer. Stops callbacks from happening.
  * @param timer: to disable.
@@ -658,6 +671,16 @@ void comm_point_tcp_handle_callback(int fd, short event, void* arg);
  */
 void comm_timer_callback(int fd, short event, void* arg);
 
+/**
+ * This routine is published for checks and tests, and is only used internally.
+ * handle libevent callback for the timing wheel of the comm base.
+ * @param fd: file descriptor (always -1).
+ * @param event: event bits from libevent: 
+ *	EV_READ, EV_WRITE, EV_SIGNAL, EV_TIMEOUT.
+ * @param arg: the comm_base structure.
+ */
+void comm_base_wheel_callback(int fd, short event, void* arg);
+
 /**
  * This routine is published for checks and tests, and is only used internally.
  * handle libevent callback for signal comm.
@@ -0,0 +1,469 @@
+/*
+ * util/querylog.c - asynchronous query and reply logging.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the asynchronous query log, the rings of records
+ * that the workers fill, and the log thread that empties them.
+ */
+#include "config.h"
+#include "util/querylog.h"
+#include "util/log.h"
+#include "util/net_help.h"
+#include "util/config_file.h"
+#include "util/data/msgreply.h"
+#include "util/data/msgparse.h"
+#include "util/data/dname.h"
+#include "sldns/sbuffer.h"
+#include "sldns/wire2str.h"
+#include "sldns/pkthdr.h"
+
+#if defined(__ATOMIC_ACQUIRE) && !defined(THREADS_DISABLED)
+/** the rings and the log thread can be used */
+#define QLOG_ASYNC 1
+/** load a counter that another thread stores */
+#define qlog_load(p) __atomic_load_n((p), __ATOMIC_ACQUIRE)
+/** store a counter that another thread loads */
+#define qlog_store(p, v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#else
+#define qlog_load(p) (*(p))
+#define qlog_store(p, v) (*(p) = (v))
+#endif
+
+int
+qlog_supported(void)
+{
+#ifdef QLOG_ASYNC
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+size_t
+qlog_record_pack(struct qlog_record* rec, uint8_t* buf)
+{
+	size_t len = QLOG_RECORD_FIXED;
+	buf[0] = (uint8_t)rec->kind;
+	buf[1] = rec->flags;
+	buf[2] = rec->rcode;
+	buf[3] = rec->family;
+	sldns_write_uint32(buf+4, rec->sec);
+	sldns_write_uint32(buf+8, rec->usec);
+	sldns_write_uint32(buf+12, rec->duration);
+	sldns_write_uint16(buf+16, rec->port);
+	sldns_write_uint16(buf+18, rec->qtype);
+	sldns_write_uint16(buf+20, rec->qclass);
+	sldns_write_uint16(buf+22, rec->pktlen);
+	if(rec->family == 4) {
+		memmove(buf+len, rec->addr, 4);
+		len += 4;
+	} else if(rec->family == 6) {
+		memmove(buf+len, rec->addr, 16);
+		len += 16;
+	}
+	buf[len++] = (uint8_t)rec->qname_len;
+	memmove(buf+len, rec->qname, rec->qname_len);
+	return len + rec->qname_len;
+}
+
+size_t
+qlog_record_unpack(uint8_t* buf, size_t len, struct qlog_record* rec)
+{
+	size_t pos = QLOG_RECORD_FIXED, alen = 0;
+	if(len < QLOG_RECORD_FIXED+1)
+		return 0;
+	if(buf[0] != qlog_kind_query && buf[0] != qlog_kind_reply)
+		return 0;
+	rec->kind = (enum qlog_kind)buf[0];
+	rec->flags = buf[1];
+	rec->rcode = buf[2];
+	rec->family = buf[3];
+	rec->sec = sldns_read_uint32(buf+4);
+	rec->usec = sldns_read_uint32(buf+8);
+	rec->duration = sldns_read_uint32(buf+12);
+	rec->port = sldns_read_uint16(buf+16);
+	rec->qtype = sldns_read_uint16(buf+18);
+	rec->qclass = sldns_read_uint16(buf+20);
+	rec->pktlen = sldns_read_uint16(buf+22);
+	if(rec->family == 4)
+		alen = 4;
+	else if(rec->family == 6)
+		alen = 16;
+	else if(rec->family != 0)
+		return 0;
+	if(len < pos+alen+1)
+		return 0;
+	memset(rec->addr, 0, sizeof(rec->addr));
+	memmove(rec->addr, buf+pos, alen);
+	pos += alen;
+	rec->qname_len = buf[pos++];
+	if(len < pos+rec->qname_len)
+		return 0;
+	memmove(rec->qname, buf+pos, rec->qname_len);
+	/* the qname must be a complete uncompressed name */
+	if(rec->qname_len != 0 && dname_valid(rec->qname, rec->qname_len)
+		!= rec->qname_len)
+		return 0;
+	return pos + rec->qname_len;
+}
+
+/** fill in the record fields that queries and replies have */
+static void
+qlog_record_fill(struct qlog_record* rec, enum qlog_kind kind,
+	struct timeval* now, struct sockaddr_storage* addr, socklen_t addrlen,
+	struct query_info* qinfo)
+{
+	rec->kind = kind;
+	rec->flags = 0;
+	rec->rcode = 0;
+	rec->sec = (uint32_t)now->tv_sec;
+	rec->usec = (uint32_t)now->tv_usec;
+	rec->duration = 0;
+	rec->pktlen = 0;
+	if(addr_is_ip6(addr, addrlen)) {
+		struct sockaddr_in6* sa = (struct sockaddr_in6*)addr;
+		rec->family = 6;
+		rec->port = ntohs(sa->sin6_port);
+		memmove(rec->addr, &sa->sin6_addr, 16);
+	} else if(((struct sockaddr_in*)addr)->sin_family == AF_INET) {
+		struct sockaddr_in* sa = (struct sockaddr_in*)addr;
+		rec->family = 4;
+		rec->port = ntohs(sa->sin_port);
+		memmove(rec->addr, &sa->sin_addr, 4);
+	} else {
+		rec->family = 0;
+		rec->port = 0;
+	}
+	if(qinfo && qinfo->qname && qinfo->qname_len <= LDNS_MAX_DOMAINLEN) {
+		rec->qtype = qinfo->qtype;
+		rec->qclass = qinfo->qclass;
+		rec->qname_len = qinfo->qname_len;
+		memmove(rec->qname, qinfo->qname, qinfo->qname_len);
+	} else {
+		rec->qtype = 0;
+		rec->qclass = 0;
+		rec->qname_len = 0;
+	}
+}
+
+/** put a record in the ring, or drop it if the ring is full */
+static void
+qlog_ring_put(struct qlog_ring* r, struct qlog_record* rec)
+{
+	size_t head = r->head;
+	uint8_t* slot;
+	size_t len;
+	if(head - qlog_load(&r->tail) >= r->num) {
+		qlog_store(&r->dropped, r->dropped+1);
+		return;
+	}
+	slot = r->slots + (head & (r->num-1))*QLOG_SLOT_SIZE;
+	len = qlog_record_pack(rec, slot+2);
+	sldns_write_uint16(slot, (uint16_t)len);
+	qlog_store(&r->head, head+1);
+}
+
+void
+qlog_query(struct qlog_ring* r, struct timeval* now,
+	struct sockaddr_storage* addr, socklen_t addrlen,
+	struct query_info* qinfo)
+{
+	struct qlog_record rec;
+	qlog_record_fill(&rec, qlog_kind_query, now, addr, addrlen, qinfo);
+	qlog_ring_put(r, &rec);
+}
+
+void
+qlog_reply(struct qlog_ring* r, struct timeval* now,
+	struct sockaddr_storage* addr, socklen_t addrlen,
+	struct query_info* qinfo, struct timeval dur, int cached,
+	struct sldns_buffer* rmsg)
+{
+	struct qlog_record rec;
+	uint8_t rcode = (uint8_t)FLAGS_GET_RCODE(sldns_buffer_read_u16_at(
+		rmsg, 2));
+	/* the query info of a FORMERR reply is not printed */
+	qlog_record_fill(&rec, qlog_kind_reply, now, addr, addrlen,
+		rcode==LDNS_RCODE_FORMERR?NULL:qinfo);
+	rec.rcode = rcode;
+	if(cached)
+		rec.flags |= QLOG_FLAG_CACHED;
+	if(dur.tv_sec >= 4000)
+		rec.duration = 0xffffffff;
+	else	rec.duration = (uint32_t)dur.tv_sec*1000000 +
+			(uint32_t)dur.tv_usec;
+	rec.pktlen = (uint16_t)sldns_buffer_limit(rmsg);
+	qlog_ring_put(r, &rec);
+}
+
+size_t
+qlog_ring_drain(struct qlog_ring* r,
+	void (*func)(uint8_t*, size_t, void*), void* arg)
+{
+	size_t tail = r->tail;
+	size_t head = qlog_load(&r->head);
+	size_t n = head - tail;
+	uint8_t* slot;
+	for(; tail != head; tail++) {
+		slot = r->slots + (tail & (r->num-1))*QLOG_SLOT_SIZE;
+		(*func)(slot+2, (size_t)sldns_read_uint16(slot), arg);
+	}
+	/* the slots can be filled again */
+	qlog_store(&r->tail, tail);
+	return n;
+}
+
+void
+qlog_record_log(struct qlog_record* rec)
+{
+	char ip[128], qname[LDNS_MAX_DOMAINLEN+1];
+	char rcode[16], type[16], dclass[16];
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	memset(&addr, 0, sizeof(addr));
+	if(rec->family == 6) {
+		struct sockaddr_in6* sa = (struct sockaddr_in6*)&addr;
+		sa->sin6_family = AF_INET6;
+		memmove(&sa->sin6_addr, rec->addr, 16);
+		addrlen = (socklen_t)sizeof(*sa);
+		addr_to_str(&addr, addrlen, ip, sizeof(ip));
+	} else if(rec->family == 4) {
+		struct sockaddr_in* sa = (struct sockaddr_in*)&addr;
+		sa->sin_family = AF_INET;
+		memmove(&sa->sin_addr, rec->addr, 4);
+		addrlen = (socklen_t)sizeof(*sa);
+		addr_to_str(&addr, addrlen, ip, sizeof(ip));
+	} else	snprintf(ip, sizeof(ip), "-");
+	if(rec->kind == qlog_kind_query) {
+		/* like log-queries prints it */
+		log_nametypeclass(0, ip, rec->qname_len?rec->qname:
+			(uint8_t*)"", rec->qtype, rec->qclass);
+		return;
+	}
+	/* like log_reply_info prints it for log-replies */
+	sldns_wire2str_rcode_buf((int)rec->rcode, rcode, sizeof(rcode));
+	if(rec->rcode == LDNS_RCODE_FORMERR || rec->qname_len == 0) {
+		log_info("%s - - - %s - - - ", ip, rcode);
+		return;
+	}
+	dname_str(rec->qname, qname);
+	sldns_wire2str_type_buf(rec->qtype, type, sizeof(type));
+	sldns_wire2str_class_buf(rec->qclass, dclass, sizeof(dclass));
+	log_info("%s %s %s %s %s %d.%6.6d %d %d", ip, qname, type, dclass,
+		rcode, (int)(rec->duration/1000000),
+		(int)(rec->duration%1000000),
+		(rec->flags&QLOG_FLAG_CACHED)?1:0, (int)rec->pktlen);
+}
+
+/** print a packed record from the ring as a log line */
+static void
+qlog_print_func(uint8_t* buf, size_t len, void* ATTR_UNUSED(arg))
+{
+	struct qlog_record rec;
+	if(qlog_record_unpack(buf, len, &rec) != 0)
+		qlog_record_log(&rec);
+}
+
+/** write a packed record from the ring to the binary log file */
+static void
+qlog_write_func(uint8_t* buf, size_t len, void* arg)
+{
+	struct qlog* q = (struct qlog*)arg;
+	/* an error is reported after the batch, with ferror */
+	(void)fwrite(buf, 1, len, q->file);
+}
+
+/** take the records out of all rings, return the number of records */
+static size_t
+qlog_drain_all(struct qlog* q)
+{
+	size_t n = 0, dropped = 0;
+	int i;
+	for(i=0; i<q->num; i++) {
+		n += qlog_ring_drain(&q->rings[i], q->file?&qlog_write_func:
+			&qlog_print_func, q);
+		dropped += qlog_load(&q->rings[i].dropped);
+	}
+	if(q->file && n != 0) {
+		if(fflush(q->file) != 0 || ferror(q->file)) {
+			log_err("could not write log-binary-file: %s",
+				strerror(errno));
+			clearerr(q->file);
+		}
+	}
+	if(dropped != q->dropped_reported) {
+		log_warn("query log: %u records dropped, the log cannot "
+			"keep up", (unsigned)(dropped - q->dropped_reported));
+		q->dropped_reported = dropped;
+	}
+	return n;
+}
+
+#ifdef QLOG_ASYNC
+/** the log thread, it writes the records in batches */
+static void*
+qlog_thread(void* arg)
+{
+	struct qlog* q = (struct qlog*)arg;
+	log_thread_set(&q->num);
+	ub_thread_blocksigs();
+	while(!qlog_load(&q->stop)) {
+		if(qlog_drain_all(q) == 0) {
+#ifdef USE_WINSOCK
+			Sleep(QLOG_WAIT_MSEC);
+#else
+			usleep(QLOG_WAIT_MSEC*1000);
+#endif
+		}
+	}
+	/* the workers have stopped, write what is left */
+	(void)qlog_drain_all(q);
+	return NULL;
+}
+#endif /* QLOG_ASYNC */
+
+struct qlog*
+qlog_create(struct config_file* cfg, int num)
+{
+	struct qlog* q;
+	size_t slots = 1;
+	int i;
+	if(!qlog_supported()) {
+		log_warn("log-async is not supported, it needs threads and "
+			"atomic operations, logging from the workers");
+		return NULL;
+	}
+	while(slots < cfg->log_async_size)
+		slots <<= 1;
+	q = (struct qlog*)calloc(1, sizeof(*q));
+	if(!q) {
+		log_err("out of memory");
+		return NULL;
+	}
+	q->num = num;
+	q->rings = (struct qlog_ring*)calloc((size_t)num, sizeof(*q->rings));
+	if(!q->rings) {
+		log_err("out of memory");
+		qlog_delete(q);
+		return NULL;
+	}
+	for(i=0; i<num; i++) {
+		q->rings[i].num = slots;
+		q->rings[i].slots = (uint8_t*)malloc(slots*QLOG_SLOT_SIZE);
+		if(!q->rings[i].slots) {
+			log_err("out of memory");
+			qlog_delete(q);
+			return NULL;
+		}
+	}
+	if(cfg->log_binary_file && cfg->log_binary_file[0]) {
+		char* fname = cfg->log_binary_file;
+		long pos;
+		if(cfg->chrootdir && cfg->chrootdir[0] && strncmp(fname,
+			cfg->chrootdir, strlen(cfg->chrootdir)) == 0)
+			fname += strlen(cfg->chrootdir);
+		q->file = fopen(fname, "ab");
+		if(!q->file) {
+			log_err("could not open log-binary-file %s: %s",
+				fname, strerror(errno));
+			qlog_delete(q);
+			return NULL;
+		}
+		/* a new file starts with the magic and version */
+		if((pos = ftell(q->file)) == 0) {
+			uint8_t hdr[8];
+			memmove(hdr, QLOG_FILE_MAGIC, 4);
+			sldns_write_uint32(hdr+4, QLOG_FILE_VERSION);
+			if(fwrite(hdr, 1, sizeof(hdr), q->file) != sizeof(hdr)
+				|| fflush(q->file) != 0) {
+				log_err("could not write log-binary-file %s: "
+					"%s", fname, strerror(errno));
+				qlog_delete(q);
+				return NULL;
+			}
+		} else if(pos < 0) {
+			log_err("could not open log-binary-file %s: %s",
+				fname, strerror(errno));
+			qlog_delete(q);
+			return NULL;
+		}
+	}
+	return q;
+}
+
+void
+qlog_start(struct qlog* q)
+{
+#ifdef QLOG_ASYNC
+	q->stop = 0;
+	ub_thread_create(&q->thr, qlog_thread, q);
+	q->started = 1;
+#else
+	(void)q;
+#endif
+}
+
+void
+qlog_delete(struct qlog* q)
+{
+	int i;
+	if(!q)
+		return;
+#ifdef QLOG_ASYNC
+	if(q->started) {
+		qlog_store(&q->stop, 1);
+		ub_thread_join(q->thr);
+		q->started = 0;
+	}
+#endif
+	if(q->file)
+		fclose(q->file);
+	if(q->rings) {
+		for(i=0; i<q->num; i++)
+			free(q->rings[i].slots);
+		free(q->rings);
+	}
+	free(q);
+}
+
+struct qlog_ring*
+qlog_get_ring(struct qlog* q, int i)
+{
+	if(!q || i < 0 || i >= q->num)
+		return NULL;
+	return &q->rings[i];
+}
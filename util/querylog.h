@@ -0,0 +1,264 @@
+/*
+ * util/querylog.h - asynchronous query and reply logging.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the asynchronous query log, for log-queries and
+ * log-replies with log-async enabled.  Every worker thread has a ring
+ * of fixed size slots, and puts a compact binary record in it for every
+ * query or reply.  The ring has one writer and one reader and needs no
+ * locks.  A log thread takes the records out in batches, and prints them
+ * as log lines, or appends them to the binary log file.  If a ring is
+ * full the record is dropped and counted; the worker never waits.
+ *
+ * The binary log file starts with the 4 bytes "UBQL" and a 4 byte
+ * version number, and then has the records one after the other.  All
+ * numbers are in network byte order.  A record is:
+ *	kind (1 byte, 1 query, 2 reply), flags (1, bit 0x1 is from cache),
+ *	rcode (1), address family (1, 4 or 6 or 0 for unknown),
+ *	time seconds (4), time microseconds (4), duration in usec (4),
+ *	port (2), qtype (2), qclass (2), reply size (2),
+ *	address (4 or 16 bytes, none for family 0),
+ *	qname length (1), qname (in wire format, uncompressed).
+ */
+
+#ifndef UTIL_QUERYLOG_H
+#define UTIL_QUERYLOG_H
+#include "util/locks.h"
+struct config_file;
+struct query_info;
+struct sldns_buffer;
+
+/** magic at the start of the binary log file */
+#define QLOG_FILE_MAGIC "UBQL"
+/** version of the binary log file format */
+#define QLOG_FILE_VERSION 1
+/** size of a slot in the ring, it fits the largest record */
+#define QLOG_SLOT_SIZE 320
+/** size of the fixed part of a record, before the address */
+#define QLOG_RECORD_FIXED 24
+/** msec that the log thread sleeps if there are no records */
+#define QLOG_WAIT_MSEC 10
+
+/** the kind of query log record */
+enum qlog_kind {
+	/** a query from a client */
+	qlog_kind_query = 1,
+	/** a reply to a client */
+	qlog_kind_reply = 2
+};
+
+/** flag in the record, the reply was from the cache */
+#define QLOG_FLAG_CACHED 0x1
+
+/**
+ * A query log record, unpacked.
+ */
+struct qlog_record {
+	/** kind of record, query or reply */
+	enum qlog_kind kind;
+	/** the flags, QLOG_FLAG_CACHED */
+	uint8_t flags;
+	/** rcode of the reply */
+	uint8_t rcode;
+	/** the address family, 4 or 6, or 0 if unknown */
+	uint8_t family;
+	/** time of the query or reply */
+	uint32_t sec, usec;
+	/** time to resolve, in usec, for replies */
+	uint32_t duration;
+	/** the port of the client */
+	uint16_t port;
+	/** the qtype and qclass */
+	uint16_t qtype, qclass;
+	/** size of the reply in bytes */
+	uint16_t pktlen;
+	/** the address of the client, 4 or 16 bytes */
+	uint8_t addr[16];
+	/** length of the qname, 0 if there is none */
+	size_t qname_len;
+	/** the qname in wire format */
+	uint8_t qname[256];
+};
+
+/**
+ * The ring of records of one thread.  The worker is the only thread
+ * that changes head and dropped, and the log thread is the only one
+ * that changes tail.  The counters are on cache lines of their own.
+ */
+struct qlog_ring {
+	/** the slots, each QLOG_SLOT_SIZE bytes, a 2 byte length and then
+	 * the record */
+	uint8_t* slots;
+	/** number of slots, a power of two */
+	size_t num;
+	/** padding so head is not on the line of the fields above */
+	uint8_t pad1[64];
+	/** number of records put in the ring, by the worker */
+	size_t head;
+	/** number of records dropped because the ring was full */
+	size_t dropped;
+	/** padding so tail is not on the line of head */
+	uint8_t pad2[64];
+	/** number of records taken out, by the log thread */
+	size_t tail;
+	/** padding after tail */
+	uint8_t pad3[64];
+};
+
+/**
+ * The asynchronous query log, with the rings and the log thread.
+ */
+struct qlog {
+	/** the rings, one per worker thread */
+	struct qlog_ring* rings;
+	/** number of rings */
+	int num;
+	/** the binary log file, or NULL to log text lines */
+	FILE* file;
+	/** if the log thread has been started */
+	int started;
+	/** set to stop the log thread */
+	int stop;
+	/** the log thread */
+	ub_thread_type thr;
+	/** number of dropped records that has been reported in the log */
+	size_t dropped_reported;
+};
+
+/**
+ * See if asynchronous query logging is possible.  It needs threads and
+ * compiler support for atomic loads and stores.
+ * @return true if it is.
+ */
+int qlog_supported(void);
+
+/**
+ * Create the query log, for log-queries and log-replies with log-async.
+ * @param cfg: the config, with log-async-size and log-binary-file.
+ * @param num: number of worker threads.
+ * @return the query log, or NULL on failure, it is logged.
+ */
+struct qlog* qlog_create(struct config_file* cfg, int num);
+
+/**
+ * Start the log thread.
+ * @param q: the query log.
+ */
+void qlog_start(struct qlog* q);
+
+/**
+ * Delete the query log.  Stops the log thread, after it has written the
+ * records that are still in the rings.  The worker threads must have
+ * stopped.
+ * @param q: the query log, can be NULL.
+ */
+void qlog_delete(struct qlog* q);
+
+/**
+ * Get the ring for a worker thread.
+ * @param q: the query log, can be NULL.
+ * @param i: the thread number.
+ * @return the ring, or NULL if q is NULL.
+ */
+struct qlog_ring* qlog_get_ring(struct qlog* q, int i);
+
+/**
+ * Log a query from a client.  Called from the worker thread of the ring.
+ * @param r: the ring.
+ * @param now: the time now.
+ * @param addr: the address of the client.
+ * @param addrlen: length of addr.
+ * @param qinfo: the query.
+ */
+void qlog_query(struct qlog_ring* r, struct timeval* now,
+	struct sockaddr_storage* addr, socklen_t addrlen,
+	struct query_info* qinfo);
+
+/**
+ * Log a reply to a client.  Called from the worker thread of the ring.
+ * @param r: the ring.
+ * @param now: the time now.
+ * @param addr: the address of the client.
+ * @param addrlen: length of addr.
+ * @param qinfo: the query.
+ * @param dur: time to resolve.
+ * @param cached: if the reply is from the cache.
+ * @param rmsg: the reply message.
+ */
+void qlog_reply(struct qlog_ring* r, struct timeval* now,
+	struct sockaddr_storage* addr, socklen_t addrlen,
+	struct query_info* qinfo, struct timeval dur, int cached,
+	struct sldns_buffer* rmsg);
+
+/**
+ * Take the records out of the ring.  Called by the log thread, or by
+ * one reader only.
+ * @param r: the ring.
+ * @param func: called for every record, with the packed record, its
+ *	length and the arg.
+ * @param arg: user argument for func.
+ * @return the number of records taken out.
+ */
+size_t qlog_ring_drain(struct qlog_ring* r,
+	void (*func)(uint8_t*, size_t, void*), void* arg);
+
+/**
+ * Pack a record in the binary format.
+ * @param rec: the record.
+ * @param buf: destination, QLOG_SLOT_SIZE bytes at least.
+ * @return length of the packed record.
+ */
+size_t qlog_record_pack(struct qlog_record* rec, uint8_t* buf);
+
+/**
+ * Unpack a record from the binary format.
+ * @param buf: the packed record.
+ * @param len: length of the buffer, it can hold more records.
+ * @param rec: the record is returned here.
+ * @return the length of the record in the buffer, 0 if it is malformed,
+ *	or too short.
+ */
+size_t qlog_record_unpack(uint8_t* buf, size_t len, struct qlog_record* rec);
+
+/**
+ * Print a record as a log line, in the format of log-queries or
+ * log-replies.
+ * @param rec: the record.
+ */
+void qlog_record_log(struct qlog_record* rec);
+
+#endif /* UTIL_QUERYLOG_H */
@@ -119,3 +119,63 @@ int rtt_notimeout(const struct rtt_info* rtt)
 {
 	return calc_rto(rtt);
 }
+
+void
+rtt_hist_init(struct rtt_hist* hist)
+{
+	int i;
+	for(i=0; i<RTT_HIST_BUCKETS; i++)
+		hist->count[i] = 0;
+	hist->total = 0;
+}
+
+/** lowest roundtrip time in the bucket, in msec */
+static int
+rtt_hist_low(int b)
+{
+	return b==0?0:(1<<b);
+}
+
+void
+rtt_hist_add(struct rtt_hist* hist, int ms)
+{
+	int b = 0;
+	if(ms < 0)
+		return;
+	while(b < RTT_HIST_BUCKETS-1 && ms >= rtt_hist_low(b+1))
+		b++;
+	if(hist->total >= RTT_HIST_DECAY) {
+		/* decay the old observations */
+		int i;
+		hist->total = 0;
+		for(i=0; i<RTT_HIST_BUCKETS; i++) {
+			hist->count[i] /= 2;
+			hist->total += hist->count[i];
+		}
+	}
+	hist->count[b]++;
+	hist->total++;
+}
+
+int
+rtt_hist_percentile(const struct rtt_hist* hist, int pct)
+{
+	int b, seen = 0, want, low, high;
+	if(hist->total < RTT_HIST_MIN_SAMPLES || pct <= 0 || pct >= 100)
+		return -1;
+	/* the sample number (1..total) that sits at the percentile */
+	want = ((int)hist->total*pct + 99)/100;
+	for(b=0; b<RTT_HIST_BUCKETS; b++) {
+		if(seen + (int)hist->count[b] >= want)
+			break;
+		seen += (int)hist->count[b];
+	}
+	if(b >= RTT_HIST_BUCKETS || hist->count[b] == 0)
+		return -1; /* not reached, total is the sum of the counts */
+	low = rtt_hist_low(b);
+	if(b == RTT_HIST_BUCKETS-1)
+		return low;
+	high = rtt_hist_low(b+1);
+	/* interpolate linearly inside the bucket */
+	return low + (high-low)*(want-seen)/(int)hist->count[b];
+}
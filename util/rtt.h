@@ -55,6 +55,27 @@ struct rtt_info {
 	int rto;
 };
 
+/** number of buckets in the rtt histogram */
+#define RTT_HIST_BUCKETS 16
+/** samples needed in the rtt histogram before percentiles are reported */
+#define RTT_HIST_MIN_SAMPLES 8
+/** once the histogram holds this many samples, counts are halved, so
+ * that old observations decay and the percentiles follow the server */
+#define RTT_HIST_DECAY 512
+
+/**
+ * RTT histogram. Log2 spaced buckets of observed roundtrip times, used
+ * to estimate percentiles of the response time of a server.
+ * Bucket 0 holds [0, 2) msec, bucket i holds [2^i, 2^(i+1)) msec and
+ * the last bucket holds everything above.
+ */
+struct rtt_hist {
+	/** number of samples per bucket */
+	uint16_t count[RTT_HIST_BUCKETS];
+	/** total number of samples in the buckets */
+	uint16_t total;
+};
+
 /** min retransmit timeout value, in milliseconds */
 extern int RTT_MIN_TIMEOUT;
 /** max retransmit timeout value, in milliseconds */
@@ -104,4 +125,27 @@ void rtt_update(struct rtt_info* rtt, int ms);
  */
 void rtt_lost(struct rtt_info* rtt, int orig);
 
+/**
+ * Initialize RTT histogram, it is empty.
+ * @param hist: The histogram. Caller is responsible for allocation of it.
+ */
+void rtt_hist_init(struct rtt_hist* hist);
+
+/**
+ * Add a roundtrip observation to the histogram.
+ * @param hist: the histogram.
+ * @param ms: roundtrip time in milliseconds.
+ */
+void rtt_hist_add(struct rtt_hist* hist, int ms);
+
+/**
+ * Estimate a percentile of the roundtrip times in the histogram.
+ * The value is interpolated inside the bucket that holds the percentile.
+ * @param hist: the histogram.
+ * @param pct: percentile, 1..99.
+ * @return: roundtrip time in milliseconds, or -1 if there are not
+ *	enough samples (RTT_HIST_MIN_SAMPLES) for an estimate.
+ */
+int rtt_hist_percentile(const struct rtt_hist* hist, int pct);
+
 #endif /* UTIL_RTT_H */
@@ -174,48 +174,52 @@ int shm_main_run(struct worker *worker)
 	struct stats_info *stat_info;
 	int modstack;
 	int offset;
+	int i;
+
+	/* The first thread reads the counters of all the threads directly,
+	 * the other threads do not need to do anything */
+	if(worker->thread_num != 0)
+		return 1;
 
 	log_info("SHM RUN - worker [%d] - daemon [%p] - TIME [%d] - [%d]",
 			worker->thread_num, worker->daemon, worker->env.now_tv->tv_sec, worker->daemon->time_boot.tv_sec);
 
-	offset						= ((worker->thread_num + 1) * sizeof(struct stats_info));
 	stat_total 					= (struct stats_info *)(worker->daemon->shm_info->ptr_arr);
-	stat_info					= (struct stats_info *)(worker->daemon->shm_info->ptr_arr + offset);
 
-	/* Copy data to the current position */
-	server_stats_compile(worker, stat_info, 0);
+	/* Zero fill total, and copy general info */
+	memset(stat_total, 0, sizeof(struct stats_info));
 
-	/* First thread, zero fill total, and copy general info */
-	if (worker->thread_num == 0) {
+	/* Point to data into SHM */
+	shm_stat 					= (struct shm_stat_info *)worker->daemon->shm_info->ptr_ctl;
+	shm_stat->time.now 			= *worker->env.now_tv;
 
-		/* Copy data to the current position */
-		memset(stat_total, 0, sizeof(struct stats_info));
-
-		/* Point to data into SHM */
-		shm_stat 					= (struct shm_stat_info *)worker->daemon->shm_info->ptr_ctl;
-		shm_stat->time.now 			= *worker->env.now_tv;
-
-		timeval_subtract(&shm_stat->time.up, &shm_stat->time.now, &worker->daemon->time_boot);
-		timeval_subtract(&shm_stat->time.elapsed, &shm_stat->time.now, &worker->daemon->time_last_stat);
-
-		shm_stat->mem.msg 			= slabhash_get_mem(worker->env.msg_cache);
-		shm_stat->mem.rrset 		= slabhash_get_mem(&worker->env.rrset_cache->table);
-		shm_stat->mem.val 			= 0;
-		shm_stat->mem.iter			= 0;
-
-		modstack 					= modstack_find(&worker->env.mesh->mods, "validator");
-		if(modstack != -1) {
-			fptr_ok(fptr_whitelist_mod_get_mem(worker->env.mesh->mods.mod[modstack]->get_mem));
-			shm_stat->mem.val 		= (*worker->env.mesh->mods.mod[modstack]->get_mem)(&worker->env, modstack);
-		}
-		modstack 					= modstack_find(&worker->env.mesh->mods, "iterator");
-		if(modstack != -1) {
-			fptr_ok(fptr_whitelist_mod_get_mem(worker->env.mesh->mods.mod[modstack]->get_mem));
-			shm_stat->mem.iter 		= (*worker->env.mesh->mods.mod[modstack]->get_mem)(&worker->env, modstack);
-		}
+	timeval_subtract(&shm_stat->time.up, &shm_stat->time.now, &worker->daemon->time_boot);
+	timeval_subtract(&shm_stat->time.elapsed, &shm_stat->time.now, &worker->daemon->time_last_stat);
+
+	shm_stat->mem.msg 			= slabhash_get_mem(worker->env.msg_cache);
+	shm_stat->mem.rrset 		= slabhash_get_mem(&worker->env.rrset_cache->table);
+	shm_stat->mem.val 			= 0;
+	shm_stat->mem.iter			= 0;
+
+	modstack 					= modstack_find(&worker->env.mesh->mods, "validator");
+	if(modstack != -1) {
+		fptr_ok(fptr_whitelist_mod_get_mem(worker->env.mesh->mods.mod[modstack]->get_mem));
+		shm_stat->mem.val 		= (*worker->env.mesh->mods.mod[modstack]->get_mem)(&worker->env, modstack);
 	}
+	modstack 					= modstack_find(&worker->env.mesh->mods, "iterator");
+	if(modstack != -1) {
+		fptr_ok(fptr_whitelist_mod_get_mem(worker->env.mesh->mods.mod[modstack]->get_mem));
+		shm_stat->mem.iter 		= (*worker->env.mesh->mods.mod[modstack]->get_mem)(&worker->env, modstack);
+	}
+
+	for(i = 0; i < worker->daemon->num; i++) {
+		offset					= ((i + 1) * sizeof(struct stats_info));
+		stat_info				= (struct stats_info *)(worker->daemon->shm_info->ptr_arr + offset);
 
-	server_stats_add(stat_total, stat_info);
+		/* Copy data to the current position */
+		server_stats_compile(worker->daemon->workers[i], stat_info, 0);
+		server_stats_add(stat_total, stat_info);
+	}
 
 	/* print the thread statistics */
 	stat_total->mesh_time_median 	/= (double)worker->daemon->num;
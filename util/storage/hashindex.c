@@ -0,0 +1,192 @@
+/*
+ * util/storage/hashindex.c - hash index of elements with a key.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Hash index, an unordered set of elements that are looked up by key.
+ */
+
+#include "config.h"
+#include "util/storage/hashindex.h"
+#include "util/fptr_wlist.h"
+
+struct hashindex*
+hashindex_create(int (*cmpf)(const void*, const void*))
+{
+	struct hashindex* h = (struct hashindex*)calloc(1, sizeof(*h));
+	if(!h)
+		return NULL;
+	h->bins = (struct hashindex_node**)calloc(HASHINDEX_STARTSIZE,
+		sizeof(struct hashindex_node*));
+	if(!h->bins) {
+		free(h);
+		return NULL;
+	}
+	h->size = HASHINDEX_STARTSIZE;
+	h->mask = h->size-1;
+	h->count = 0;
+	h->cmp = cmpf;
+	return h;
+}
+
+void
+hashindex_delete(struct hashindex* h)
+{
+	if(!h)
+		return;
+	free(h->bins);
+	free(h);
+}
+
+void
+hashindex_clear(struct hashindex* h)
+{
+	memset(h->bins, 0, sizeof(struct hashindex_node*)*h->size);
+	h->count = 0;
+}
+
+/** move the nodes to a bin array of another size, if the malloc fails
+ * the index keeps the size it has */
+static void
+hashindex_resize(struct hashindex* h, size_t newsize)
+{
+	struct hashindex_node** newbins, *n, *nn;
+	size_t i, newmask = newsize-1;
+	newbins = (struct hashindex_node**)calloc(newsize,
+		sizeof(struct hashindex_node*));
+	if(!newbins)
+		return;
+	for(i=0; i<h->size; i++) {
+		for(n = h->bins[i]; n; n = nn) {
+			nn = n->next;
+			n->next = newbins[n->hash & newmask];
+			newbins[n->hash & newmask] = n;
+		}
+	}
+	free(h->bins);
+	h->bins = newbins;
+	h->size = newsize;
+	h->mask = newmask;
+}
+
+struct hashindex_node*
+hashindex_insert(struct hashindex* h, struct hashindex_node* node)
+{
+	struct hashindex_node** bin;
+	if(hashindex_search(h, node->key, node->hash))
+		return NULL;
+	if(h->count >= h->size)
+		hashindex_resize(h, h->size*2);
+	bin = &h->bins[node->hash & h->mask];
+	node->next = *bin;
+	*bin = node;
+	h->count++;
+	return node;
+}
+
+struct hashindex_node*
+hashindex_search(struct hashindex* h, const void* key, hashvalue_type hash)
+{
+	struct hashindex_node* n;
+	fptr_ok(fptr_whitelist_hashindex_cmp(h->cmp));
+	for(n = h->bins[hash & h->mask]; n; n = n->next) {
+		if(n->hash == hash && (*h->cmp)(key, n->key) == 0)
+			return n;
+	}
+	return NULL;
+}
+
+struct hashindex_node*
+hashindex_remove(struct hashindex* h, struct hashindex_node* node)
+{
+	struct hashindex_node** p = &h->bins[node->hash & h->mask];
+	while(*p) {
+		if(*p == node) {
+			*p = node->next;
+			node->next = NULL;
+			h->count--;
+			if(h->size > HASHINDEX_STARTSIZE && h->count < h->size/4)
+				hashindex_resize(h, h->size/2);
+			return node;
+		}
+		p = &(*p)->next;
+	}
+	return NULL;
+}
+
+/** first node from bin i onwards, or NULL */
+static struct hashindex_node*
+hashindex_from_bin(struct hashindex* h, size_t i)
+{
+	for(; i<h->size; i++)
+		if(h->bins[i])
+			return h->bins[i];
+	return NULL;
+}
+
+struct hashindex_node*
+hashindex_first(struct hashindex* h)
+{
+	return hashindex_from_bin(h, 0);
+}
+
+struct hashindex_node*
+hashindex_next(struct hashindex* h, struct hashindex_node* node)
+{
+	if(node->next)
+		return node->next;
+	return hashindex_from_bin(h, (node->hash & h->mask)+1);
+}
+
+void
+hashindex_traverse(struct hashindex* h,
+	void (*func)(struct hashindex_node*, void*), void* arg)
+{
+	struct hashindex_node* n, *nn;
+	size_t i;
+	for(i=0; i<h->size; i++) {
+		for(n = h->bins[i]; n; n = nn) {
+			nn = n->next;
+			(*func)(n, arg);
+		}
+	}
+}
+
+size_t
+hashindex_get_mem(struct hashindex* h)
+{
+	return sizeof(*h) + sizeof(struct hashindex_node*)*h->size;
+}
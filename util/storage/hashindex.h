@@ -0,0 +1,183 @@
+/*
+ * util/storage/hashindex.h - hash index of elements with a key.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Hash index, an unordered set of elements that are looked up by key.
+ * It is used like the rbtree, the element has a hashindex_node as its
+ * first member, and the node points to the key, but the lookup, insert
+ * and remove take constant time, instead of a walk down the tree.  The
+ * caller computes the hash value of the key, the compare function only
+ * has to say if two keys are equal, and it is called only for elements
+ * with the same hash value.
+ *
+ * The table grows when it has more elements than bins, and shrinks when
+ * it is mostly empty.  It has no locks and no LRU, like the rbtree it is
+ * owned by one thread.  If the iteration order matters, copy the
+ * elements and sort them.
+ */
+
+#ifndef UTIL_STORAGE_HASHINDEX_H
+#define UTIL_STORAGE_HASHINDEX_H
+#include "util/storage/lruhash.h"
+
+/** number of bins of an empty hash index, a power of 2 */
+#define HASHINDEX_STARTSIZE 64
+
+/**
+ * This structure must be the first member of the data structure in the
+ * hash index.  This allows easy casting between the node and the
+ * user data, as with the rbtree.
+ */
+struct hashindex_node {
+	/** next node in the same bin */
+	struct hashindex_node* next;
+	/** pointer to the key */
+	const void* key;
+	/** hash value of the key, set by the caller before insert */
+	hashvalue_type hash;
+};
+
+/**
+ * The hash index.
+ */
+struct hashindex {
+	/** the bins, the lists of nodes with the same hash in the low bits */
+	struct hashindex_node** bins;
+	/** number of bins, a power of 2 */
+	size_t size;
+	/** size-1, the mask for the bin number */
+	size_t mask;
+	/** number of nodes in the index */
+	size_t count;
+	/** compare function for the keys, like the rbtree compare, 0 if
+	 * the keys are equal */
+	int (*cmp)(const void*, const void*);
+};
+
+/**
+ * Create a new hash index.
+ * @param cmpf: compare function, takes pointers to two keys, 0 if equal.
+ * @return new index, empty, or NULL on malloc failure.
+ */
+struct hashindex* hashindex_create(int (*cmpf)(const void*, const void*));
+
+/**
+ * Delete the hash index.  The nodes are not deleted, see
+ * hashindex_traverse.
+ * @param h: the hash index, can be NULL.
+ */
+void hashindex_delete(struct hashindex* h);
+
+/**
+ * Remove all nodes from the index.  The nodes are not deleted.
+ * @param h: the hash index.
+ */
+void hashindex_clear(struct hashindex* h);
+
+/**
+ * Insert a node.  The node key and hash must be set.
+ * @param h: the hash index.
+ * @param node: the node to insert.
+ * @return the node, or NULL if a node with an equal key is present, then
+ *	the node is not inserted.
+ */
+struct hashindex_node* hashindex_insert(struct hashindex* h,
+	struct hashindex_node* node);
+
+/**
+ * Find a node with the key.
+ * @param h: the hash index.
+ * @param key: the key that must match.
+ * @param hash: hash value of the key.
+ * @return the node or NULL if not found.
+ */
+struct hashindex_node* hashindex_search(struct hashindex* h, const void* key,
+	hashvalue_type hash);
+
+/**
+ * Remove the node from the index.
+ * @param h: the hash index.
+ * @param node: the node to remove, its hash must be set.  It is found by
+ *	pointer, a node with an equal key is not removed.
+ * @return the node or NULL if it was not in the index.
+ */
+struct hashindex_node* hashindex_remove(struct hashindex* h,
+	struct hashindex_node* node);
+
+/**
+ * Returns the first node in the index, in no particular order.
+ * @param h: the hash index.
+ * @return the first node or NULL if the index is empty.
+ */
+struct hashindex_node* hashindex_first(struct hashindex* h);
+
+/**
+ * Returns the next node in the index.
+ * @param h: the hash index.
+ * @param node: the node that hashindex_first or hashindex_next returned.
+ * @return the next node or NULL if there are no more.
+ */
+struct hashindex_node* hashindex_next(struct hashindex* h,
+	struct hashindex_node* node);
+
+/**
+ * Call with node=variable of struct* with hashindex_node as first
+ * element.  The index must not be changed in the loop.
+ */
+#define HASHINDEX_FOR(node, type, h) \
+	for(node=(type)hashindex_first(h); node; \
+		node = (type)hashindex_next(h, (struct hashindex_node*)node))
+
+/**
+ * Call function for all nodes in the index, the function can delete
+ * the node, but it must not remove it from the index or insert nodes.
+ * Afterwards, clear or delete the index.
+ * @param h: the hash index.
+ * @param func: function called with the node and user arg.
+ * @param arg: user argument.
+ */
+void hashindex_traverse(struct hashindex* h,
+	void (*func)(struct hashindex_node*, void*), void* arg);
+
+/**
+ * Get the memory used by the index, without the nodes.
+ * @param h: the hash index.
+ * @return memory in bytes.
+ */
+size_t hashindex_get_mem(struct hashindex* h);
+
+#endif /* UTIL_STORAGE_HASHINDEX_H */
@@ -0,0 +1,203 @@
+/*
+ * util/storage/keyhash.c - keyed hash function for the cache tables.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the SipHash-1-3 keyed hash that is used for the
+ * keys of the cache tables. SipHash is by Jean-Philippe Aumasson and
+ * Daniel J. Bernstein, https://131002.net/siphash/ .
+ */
+
+#include "config.h"
+#include "util/storage/keyhash.h"
+
+/** rotate 64 bit value left */
+#define ROTL64(x, b) (uint64_t)(((x) << (b)) | ((x) >> (64 - (b))))
+
+/** read 64 bit little endian value from unaligned memory */
+#define U8TO64_LE(p) \
+	(((uint64_t)((p)[0])) | ((uint64_t)((p)[1]) << 8) | \
+	((uint64_t)((p)[2]) << 16) | ((uint64_t)((p)[3]) << 24) | \
+	((uint64_t)((p)[4]) << 32) | ((uint64_t)((p)[5]) << 40) | \
+	((uint64_t)((p)[6]) << 48) | ((uint64_t)((p)[7]) << 56))
+
+/** one SipHash round */
+#define SIPROUND(v0, v1, v2, v3) do { \
+	v0 += v1; v1 = ROTL64(v1, 13); v1 ^= v0; v0 = ROTL64(v0, 32); \
+	v2 += v3; v3 = ROTL64(v3, 16); v3 ^= v2; \
+	v0 += v3; v3 = ROTL64(v3, 21); v3 ^= v0; \
+	v2 += v1; v1 = ROTL64(v1, 17); v1 ^= v2; v2 = ROTL64(v2, 32); \
+	} while(0)
+
+/** initial state for the secret key, the key is only kept in this form.
+ * Until keyhash_set_key is called, it is the state for an arbitrary key,
+ * that keeps the results the same between runs for the tests. */
+static struct keyhash_state keyhash_start = {
+	(uint64_t)0x736f6d6570736575ULL ^ (uint64_t)0x0706050403020100ULL,
+	(uint64_t)0x646f72616e646f6dULL ^ (uint64_t)0x0f0e0d0c0b0a0908ULL,
+	(uint64_t)0x6c7967656e657261ULL ^ (uint64_t)0x0706050403020100ULL,
+	(uint64_t)0x7465646279746573ULL ^ (uint64_t)0x0f0e0d0c0b0a0908ULL,
+	0, 0
+};
+
+/** set the state to the start for the key */
+static void
+sip_init(struct keyhash_state* s, const uint8_t* key)
+{
+	uint64_t k0 = U8TO64_LE(key);
+	uint64_t k1 = U8TO64_LE(key+8);
+	s->v0 = (uint64_t)0x736f6d6570736575ULL ^ k0;
+	s->v1 = (uint64_t)0x646f72616e646f6dULL ^ k1;
+	s->v2 = (uint64_t)0x6c7967656e657261ULL ^ k0;
+	s->v3 = (uint64_t)0x7465646279746573ULL ^ k1;
+	s->tail = 0;
+	s->len = 0;
+}
+
+/** absorb data, with crounds per block */
+static inline void
+sip_update(struct keyhash_state* s, const uint8_t* p, size_t len,
+	int crounds)
+{
+	/* work on local copies, the data may alias the state */
+	uint64_t v0, v1, v2, v3, m, t = s->tail;
+	size_t fill = s->len & 7;
+	int i;
+	s->len += len;
+	if(fill + len < 8) {
+		/* the common case for the short parts of a key */
+		while(len--) {
+			t |= ((uint64_t)*p++) << (8*fill);
+			fill++;
+		}
+		s->tail = t;
+		return;
+	}
+	v0 = s->v0; v1 = s->v1; v2 = s->v2; v3 = s->v3;
+	if(fill) {
+		/* complete the partial block from the previous update */
+		while(fill < 8) {
+			t |= ((uint64_t)*p++) << (8*fill);
+			fill++;
+			len--;
+		}
+		v3 ^= t;
+		for(i=0; i<crounds; i++)
+			SIPROUND(v0, v1, v2, v3);
+		v0 ^= t;
+	}
+	while(len >= 8) {
+		m = U8TO64_LE(p);
+		v3 ^= m;
+		for(i=0; i<crounds; i++)
+			SIPROUND(v0, v1, v2, v3);
+		v0 ^= m;
+		p += 8;
+		len -= 8;
+	}
+	t = 0;
+	for(fill=0; fill<len; fill++)
+		t |= ((uint64_t)p[fill]) << (8*fill);
+	s->tail = t;
+	s->v0 = v0;
+	s->v1 = v1;
+	s->v2 = v2;
+	s->v3 = v3;
+}
+
+/** finish the hash, the last block holds the length */
+static inline uint64_t
+sip_final(struct keyhash_state* s, int crounds, int drounds)
+{
+	uint64_t v0 = s->v0, v1 = s->v1, v2 = s->v2, v3 = s->v3;
+	uint64_t b = (((uint64_t)s->len) << 56) | s->tail;
+	int i;
+	v3 ^= b;
+	for(i=0; i<crounds; i++)
+		SIPROUND(v0, v1, v2, v3);
+	v0 ^= b;
+	v2 ^= 0xff;
+	for(i=0; i<drounds; i++)
+		SIPROUND(v0, v1, v2, v3);
+	return v0 ^ v1 ^ v2 ^ v3;
+}
+
+void
+keyhash_set_key(const uint8_t* key)
+{
+	sip_init(&keyhash_start, key);
+}
+
+void
+keyhash_init(struct keyhash_state* s)
+{
+	*s = keyhash_start;
+}
+
+void
+keyhash_update(struct keyhash_state* s, const void* data, size_t len)
+{
+	sip_update(s, (const uint8_t*)data, len, KEYHASH_CROUNDS);
+}
+
+uint32_t
+keyhash_final(struct keyhash_state* s)
+{
+	uint64_t h = sip_final(s, KEYHASH_CROUNDS, KEYHASH_DROUNDS);
+	/* fold, the hash tables use both the top and the bottom bits */
+	return (uint32_t)(h ^ (h >> 32));
+}
+
+uint32_t
+keyhash(const void* data, size_t len, uint32_t initval)
+{
+	struct keyhash_state s;
+	keyhash_init(&s);
+	sip_update(&s, (const uint8_t*)&initval, sizeof(initval),
+		KEYHASH_CROUNDS);
+	sip_update(&s, (const uint8_t*)data, len, KEYHASH_CROUNDS);
+	return keyhash_final(&s);
+}
+
+uint64_t
+siphash(const uint8_t* key, const void* data, size_t len, int crounds,
+	int drounds)
+{
+	struct keyhash_state s;
+	sip_init(&s, key);
+	sip_update(&s, (const uint8_t*)data, len, crounds);
+	return sip_final(&s, crounds, drounds);
+}
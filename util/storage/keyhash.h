@@ -0,0 +1,123 @@
+/*
+ * util/storage/keyhash.h - keyed hash function for the cache tables.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the keyed hash that is used for the keys of the
+ * cache tables (message, rrset, infra, key and ratelimit caches).
+ * The hash is SipHash-1-3, with a secret key that is chosen at random
+ * when the server starts, so that remote parties cannot predict which
+ * names end up in the same hash bin.
+ *
+ * The hash is incremental: a key made of several parts (like the name,
+ * type and class of an rrset) is absorbed part by part into one state,
+ * and the result is the same for any split of the same bytes.
+ */
+
+#ifndef UTIL_STORAGE_KEYHASH_H
+#define UTIL_STORAGE_KEYHASH_H
+
+/** size of the secret key in bytes */
+#define KEYHASH_KEYSIZE 16
+/** number of SipHash rounds per 8 byte block */
+#define KEYHASH_CROUNDS 1
+/** number of SipHash rounds for the finalization */
+#define KEYHASH_DROUNDS 3
+
+/**
+ * State of an incremental hash computation.
+ */
+struct keyhash_state {
+	/** the SipHash internal state */
+	uint64_t v0, v1, v2, v3;
+	/** bytes that do not fill a block yet, little endian */
+	uint64_t tail;
+	/** total number of bytes absorbed */
+	size_t len;
+};
+
+/**
+ * Set the secret key, set this before threads start, and before hashing
+ * stuff (because it changes subsequent results).
+ * @param key: KEYHASH_KEYSIZE bytes of (random) key material.
+ */
+void keyhash_set_key(const uint8_t* key);
+
+/**
+ * Start hashing with the secret key.
+ * @param s: state to initialise.
+ */
+void keyhash_init(struct keyhash_state* s);
+
+/**
+ * Absorb data into the hash.
+ * @param s: the state.
+ * @param data: the bytes to hash.
+ * @param len: length of data.
+ */
+void keyhash_update(struct keyhash_state* s, const void* data, size_t len);
+
+/**
+ * Finish the hash computation and return the hash value.
+ * @param s: the state, it is changed, and cannot be updated after this.
+ * @return the hash value, in the width of the hash table hash values.
+ */
+uint32_t keyhash_final(struct keyhash_state* s);
+
+/**
+ * Hash a block of data, like hashlittle, with an initial value that is
+ * hashed as well, so the result can be chained.
+ * @param data: the bytes to hash.
+ * @param len: length of data.
+ * @param initval: the previous hash, or an arbitrary value.
+ * @return hash value.
+ */
+uint32_t keyhash(const void* data, size_t len, uint32_t initval);
+
+/**
+ * SipHash with a given key and number of rounds, with the full 64 bit
+ * result. Used to check against the reference test vectors.
+ * @param key: KEYHASH_KEYSIZE bytes of key.
+ * @param data: the bytes to hash.
+ * @param len: length of data.
+ * @param crounds: number of rounds per block, 2 for SipHash-2-4.
+ * @param drounds: number of finalization rounds, 4 for SipHash-2-4.
+ * @return 64 bit hash value.
+ */
+uint64_t siphash(const uint8_t* key, const void* data, size_t len,
+	int crounds, int drounds);
+
+#endif /* UTIL_STORAGE_KEYHASH_H */
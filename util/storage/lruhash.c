@@ -296,7 +296,7 @@ lru_touch(struct lruhash* table, struct lruhash_entry* entry)
 	lru_front(table, entry);
 }
 
-void 
+int
 lruhash_insert(struct lruhash* table, hashvalue_type hash,
         struct lruhash_entry* entry, void* data, void* cb_arg)
 {
@@ -313,6 +313,10 @@ lruhash_insert(struct lruhash* table, hashvalue_type hash,
 
 	/* find bin */
 	lock_quick_lock(&table->lock);
+	if(table->closed) {
+		lock_quick_unlock(&table->lock);
+		return 0;
+	}
 	bin = &table->array[hash & table->size_mask];
 	lock_quick_lock(&bin->lock);
 
@@ -350,6 +354,7 @@ lruhash_insert(struct lruhash* table, hashvalue_type hash,
 		(*table->deldatafunc)(d, cb_arg);
 		reclaimlist = n;
 	}
+	return 1;
 }
 
 struct lruhash_entry* 
@@ -411,7 +416,135 @@ lruhash_remove(struct lruhash* table, hashvalue_type hash, void* key)
 	(*table->deldatafunc)(d, table->cb_arg);
 }
 
-/** clear bin, respecting locks, does not do space, LRU */
+void
+lruhash_update_space_max(struct lruhash* table, void* cb_arg, size_t max)
+{
+	struct lruhash_entry* reclaimlist = NULL;
+	fptr_ok(fptr_whitelist_hash_sizefunc(table->sizefunc));
+	fptr_ok(fptr_whitelist_hash_delkeyfunc(table->delkeyfunc));
+	fptr_ok(fptr_whitelist_hash_deldatafunc(table->deldatafunc));
+	fptr_ok(fptr_whitelist_hash_markdelfunc(table->markdelfunc));
+	if(cb_arg == NULL) cb_arg = table->cb_arg;
+
+	lock_quick_lock(&table->lock);
+	table->space_max = max;
+	if(table->space_used > table->space_max)
+		reclaim_space(table, &reclaimlist);
+	lock_quick_unlock(&table->lock);
+
+	/* finish reclaim if any (outside of critical region) */
+	while(reclaimlist) {
+		struct lruhash_entry* n = reclaimlist->overflow_next;
+		void* d = reclaimlist->data;
+		(*table->delkeyfunc)(reclaimlist->key, cb_arg);
+		(*table->deldatafunc)(d, cb_arg);
+		reclaimlist = n;
+	}
+}
+
+/** add entry at the end of the LRU list */
+static void
+lru_back(struct lruhash* table, struct lruhash_entry* entry)
+{
+	entry->lru_next = NULL;
+	entry->lru_prev = table->lru_end;
+	if(!table->lru_end)
+		table->lru_start = entry;
+	else	table->lru_end->lru_next = entry;
+	table->lru_end = entry;
+}
+
+void
+lruhash_move_entry(struct lruhash* from, struct lruhash* to,
+	struct lruhash_entry* entry, struct lruhash_entry** list)
+{
+	struct lruhash_bin* bin;
+	size_t need_size;
+	fptr_ok(fptr_whitelist_hash_sizefunc(from->sizefunc));
+	fptr_ok(fptr_whitelist_hash_compfunc(to->compfunc));
+	fptr_ok(fptr_whitelist_hash_markdelfunc(to->markdelfunc));
+
+	/* take it out of the table */
+	lru_remove(from, entry);
+	bin = &from->array[entry->hash & from->size_mask];
+	lock_quick_lock(&bin->lock);
+	bin_overflow_remove(bin, entry);
+	from->num--;
+	/* flush users away from the entry, but it stays valid */
+	lock_rw_wrlock(&entry->lock);
+	need_size = (*from->sizefunc)(entry->key, entry->data);
+	lock_rw_unlock(&entry->lock);
+	from->space_used -= need_size;
+	lock_quick_unlock(&bin->lock);
+
+	/* and put it in the other table */
+	bin = &to->array[entry->hash & to->size_mask];
+	lock_quick_lock(&bin->lock);
+	if(bin_find_entry(to, bin, entry->hash, entry->key)) {
+		lock_quick_unlock(&bin->lock);
+		/* the entry in the table was stored after this one was
+		 * put in the old table, so it is newer */
+		lock_rw_wrlock(&entry->lock);
+		if(to->markdelfunc)
+			(*to->markdelfunc)(entry->key);
+		lock_rw_unlock(&entry->lock);
+		entry->overflow_next = *list;
+		*list = entry;
+		return;
+	}
+	entry->overflow_next = bin->overflow_list;
+	bin->overflow_list = entry;
+	lru_back(to, entry);
+	to->num++;
+	to->space_used += need_size;
+	lock_quick_unlock(&bin->lock);
+	if(to->space_used > to->space_max)
+		reclaim_space(to, list);
+	if(to->num >= to->size)
+		table_grow(to);
+}
+
+void
+lruhash_delete_list(struct lruhash* table, struct lruhash_entry* list)
+{
+	fptr_ok(fptr_whitelist_hash_delkeyfunc(table->delkeyfunc));
+	fptr_ok(fptr_whitelist_hash_deldatafunc(table->deldatafunc));
+	while(list) {
+		struct lruhash_entry* n = list->overflow_next;
+		void* d = list->data;
+		(*table->delkeyfunc)(list->key, table->cb_arg);
+		(*table->deldatafunc)(d, table->cb_arg);
+		list = n;
+	}
+}
+
+void
+lruhash_close(struct lruhash* table)
+{
+	struct lruhash_bin* newa;
+	size_t i;
+	log_assert(table->num == 0);
+	table->closed = 1;
+	if(table->size == 1)
+		return;
+	newa = calloc(1, sizeof(struct lruhash_bin));
+	if(!newa)
+		return; /* keep the empty bins */
+	bin_init(newa, 1);
+	lock_unprotect(&table->lock, table->array);
+	for(i=0; i<table->size; i++) {
+		/* wait for a lookup that still searches the bin */
+		lock_quick_lock(&table->array[i].lock);
+		lock_quick_unlock(&table->array[i].lock);
+		lock_quick_destroy(&table->array[i].lock);
+	}
+	free(table->array);
+	table->size = 1;
+	table->size_mask = 0;
+	table->array = newa;
+	lock_protect(&table->lock, table->array, sizeof(struct lruhash_bin));
+}
+
 static void
 bin_clear(struct lruhash* table, struct lruhash_bin* bin)
 {
@@ -178,6 +178,9 @@ struct lruhash {
 	size_t space_used;
 	/** the amount of space the hash table is maximally allowed to use. */
 	size_t space_max;
+	/** the entries moved to another table, and no entries are inserted
+	 * any more, see lruhash_close. */
+	int closed;
 };
 
 /**
@@ -268,8 +271,9 @@ void lruhash_clear(struct lruhash* table);
  * 	the existing entry. The data is then freed.
  * @param data: the data.
  * @param cb_override: if not null overrides the cb_arg for the deletefunc.
+ * @return false if the table is closed, the entry is then not inserted.
  */
-void lruhash_insert(struct lruhash* table, hashvalue_type hash, 
+int lruhash_insert(struct lruhash* table, hashvalue_type hash, 
 	struct lruhash_entry* entry, void* data, void* cb_override);
 
 /**
@@ -313,6 +317,49 @@ void lruhash_setmarkdel(struct lruhash* table, lruhash_markdelfunc_type md);
  */
 void lruhash_remove(struct lruhash* table, hashvalue_type hash, void* key);
 
+/**
+ * Change the maximum amount of space the table may use.
+ * If the table is now too large, least recently used entries are deleted
+ * until it fits; growing only raises the limit.
+ * @param table: hash table. Locked during the update.
+ * @param cb_arg: if not NULL overrides the cb_arg for the delete functions.
+ * @param max: new maximum amount of space.
+ */
+void lruhash_update_space_max(struct lruhash* table, void* cb_arg,
+	size_t max);
+
+/**
+ * Move an entry to another table.  The caller holds the locks of both
+ * tables, so the entry is in one of them for every lookup.  The entry is
+ * added at the least recently used end, so the entries that were used in
+ * the other table in the meantime stay in front.  If the key is already
+ * present there, that entry is the newer one, and the moved entry is
+ * marked deleted and put on the list.  Entries that do not fit in the
+ * other table are put on the list too.
+ * @param from: hash table that holds the entry. Caller holds the lock.
+ * @param to: hash table to move to. Caller holds the lock.
+ * @param entry: the entry in from.
+ * @param list: entries to delete, with lruhash_delete_list, after the
+ *	locks are released.
+ */
+void lruhash_move_entry(struct lruhash* from, struct lruhash* to,
+	struct lruhash_entry* entry, struct lruhash_entry** list);
+
+/**
+ * Delete the entries on a list made by lruhash_move_entry.
+ * @param table: hash table with the delete functions.
+ * @param list: the entries, linked with overflow_next.
+ */
+void lruhash_delete_list(struct lruhash* table, struct lruhash_entry* list);
+
+/**
+ * Close an empty table, after its entries moved to other tables.  Inserts
+ * fail from then on, so they go to the other tables, and the bins are
+ * reduced to one.
+ * @param table: hash table. Caller holds the lock.
+ */
+void lruhash_close(struct lruhash* table);
+
 /** init the hash bins for the table */
 void bin_init(struct lruhash_bin* array, size_t size);
 
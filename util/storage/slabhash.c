@@ -45,127 +45,363 @@
 #include "config.h"
 #include "util/storage/slabhash.h"
 
+/** helper routine to set the mask and shift for the number of slabs */
+static void
+slab_setmask(size_t size, uint32_t* mask, unsigned int* shift)
+{
+	*mask = (uint32_t)(size - 1);
+	*shift = 0;
+	if(*mask != 0) {
+		log_assert( (size & *mask) == 0 
+			/* size must be power of 2 */ );
+		while(!(*mask & 0x80000000)) {
+			*mask <<= 1;
+			(*shift) ++;
+		}
+	}
+}
+
+/** delete the tables in a slab array and the array */
+static void
+slab_array_delete(struct slab_array* a)
+{
+	size_t i;
+	if(!a)
+		return;
+	for(i=0; i<a->size; i++)
+		lruhash_delete(a->array[i]);
+	free(a->array);
+	free(a);
+}
+
+/** create a slab array with its tables */
+static struct slab_array*
+slab_array_create(size_t numtables, size_t start_size, size_t maxmem,
+	lruhash_sizefunc_type sizefunc, lruhash_compfunc_type compfunc,
+	lruhash_delkeyfunc_type delkeyfunc,
+	lruhash_deldatafunc_type deldatafunc, void* arg)
+{
+	size_t i;
+	struct slab_array* a = (struct slab_array*)calloc(1,
+		sizeof(struct slab_array));
+	if(!a) return NULL;
+	a->size = numtables;
+	log_assert(a->size > 0);
+	a->array = (struct lruhash**)calloc(a->size, sizeof(struct lruhash*));
+	if(!a->array) {
+		free(a);
+		return NULL;
+	}
+	slab_setmask(a->size, &a->mask, &a->shift);
+	for(i=0; i<a->size; i++) {
+		a->array[i] = lruhash_create(start_size, maxmem / a->size,
+			sizefunc, compfunc, delkeyfunc, deldatafunc, arg);
+		if(!a->array[i]) {
+			a->size = i;
+			slab_array_delete(a);
+			return NULL;
+		}
+	}
+	return a;
+}
+
 struct slabhash* slabhash_create(size_t numtables, size_t start_size, 
 	size_t maxmem, lruhash_sizefunc_type sizefunc, 
 	lruhash_compfunc_type compfunc, lruhash_delkeyfunc_type delkeyfunc, 
 	lruhash_deldatafunc_type deldatafunc, void* arg)
 {
-	size_t i;
 	struct slabhash* sl = (struct slabhash*)calloc(1, 
 		sizeof(struct slabhash));
 	if(!sl) return NULL;
-	sl->size = numtables;
-	log_assert(sl->size > 0);
-	sl->array = (struct lruhash**)calloc(sl->size, sizeof(struct lruhash*));
-	if(!sl->array) {
+	sl->cur = slab_array_create(numtables, start_size, maxmem, sizefunc,
+		compfunc, delkeyfunc, deldatafunc, arg);
+	if(!sl->cur) {
 		free(sl);
 		return NULL;
 	}
-	sl->mask = (uint32_t)(sl->size - 1);
-	if(sl->mask == 0) {
-		sl->shift = 0;
-	} else {
-		log_assert( (sl->size & sl->mask) == 0 
-			/* size must be power of 2 */ );
-		sl->shift = 0;
-		while(!(sl->mask & 0x80000000)) {
-			sl->mask <<= 1;
-			sl->shift ++;
-		}
-	}
-	for(i=0; i<sl->size; i++) {
-		sl->array[i] = lruhash_create(start_size, maxmem / sl->size,
-			sizefunc, compfunc, delkeyfunc, deldatafunc, arg);
-		if(!sl->array[i]) {
-			slabhash_delete(sl);
-			return NULL;
-		}
-	}
 	return sl;
 }
 
 void slabhash_delete(struct slabhash* sl)
 {
+	struct slab_array* a, *n;
 	if(!sl)
 		return;
-	if(sl->array) {
-		size_t i;
-		for(i=0; i<sl->size; i++)
-			lruhash_delete(sl->array[i]);
-		free(sl->array);
+	slab_array_delete(sl->cur->old);
+	slab_array_delete(sl->cur);
+	for(a = sl->retired; a; a = n) {
+		n = a->next;
+		slab_array_delete(a);
 	}
 	free(sl);
 }
 
+/** get the current slab array, that a rehash in another thread replaces */
+static struct slab_array*
+slab_cur(struct slabhash* sl)
+{
+	return ub_load_acquire(&sl->cur);
+}
+
+/** get the slab array that the entries move out of, or NULL */
+static struct slab_array*
+slab_old(struct slab_array* a)
+{
+	return ub_load_acquire(&a->old);
+}
+
 void slabhash_clear(struct slabhash* sl)
 {
+	struct slab_array* a, *old;
 	size_t i;
 	if(!sl)
 		return;
-	for(i=0; i<sl->size; i++)
-		lruhash_clear(sl->array[i]);
+	a = slab_cur(sl);
+	for(i=0; i<a->size; i++)
+		lruhash_clear(a->array[i]);
+	if((old = slab_old(a)) != NULL) {
+		for(i=0; i<old->size; i++)
+			lruhash_clear(old->array[i]);
+	}
 }
 
 /** helper routine to calculate the slabhash index */
 static unsigned int
-slab_idx(struct slabhash* sl, hashvalue_type hash)
+slab_idx(struct slab_array* a, hashvalue_type hash)
 {
-	return ((hash & sl->mask) >> sl->shift);
+	return ((hash & a->mask) >> a->shift);
 }
 
 void slabhash_insert(struct slabhash* sl, hashvalue_type hash, 
 	struct lruhash_entry* entry, void* data, void* arg)
 {
-	lruhash_insert(sl->array[slab_idx(sl, hash)], hash, entry, data, arg);
+	struct slab_array* a;
+	/* during a rehash, an entry for the key in the old array is
+	 * hidden by this one, and deleted when it is moved.  The table
+	 * is closed if the array was replaced and the entries moved out,
+	 * then the current array is used. */
+	do {
+		a = slab_cur(sl);
+	} while(!lruhash_insert(a->array[slab_idx(a, hash)], hash, entry,
+		data, arg));
 }
 
 struct lruhash_entry* slabhash_lookup(struct slabhash* sl, 
 	hashvalue_type hash, void* key, int wr)
 {
-	return lruhash_lookup(sl->array[slab_idx(sl, hash)], hash, key, wr);
+	struct slab_array* a = slab_cur(sl), *old, *n;
+	struct lruhash_entry* e;
+	while(1) {
+		e = lruhash_lookup(a->array[slab_idx(a, hash)], hash, key, wr);
+		if(e)
+			return e;
+		if((old = slab_old(a)) != NULL) {
+			/* the entry has not moved yet, or it moved after
+			 * the first lookup, entries only move into array */
+			e = lruhash_lookup(old->array[slab_idx(old, hash)],
+				hash, key, wr);
+			if(!e)
+				e = lruhash_lookup(a->array[slab_idx(a, hash)],
+					hash, key, wr);
+			if(e)
+				return e;
+		}
+		/* the entries move after the array is replaced, so if
+		 * it moved out of the table the new array is seen here */
+		if((n = slab_cur(sl)) == a)
+			return NULL;
+		a = n;
+	}
 }
 
 void slabhash_remove(struct slabhash* sl, hashvalue_type hash, void* key)
 {
-	lruhash_remove(sl->array[slab_idx(sl, hash)], hash, key);
+	struct slab_array* a = slab_cur(sl), *old, *n;
+	while(1) {
+		lruhash_remove(a->array[slab_idx(a, hash)], hash, key);
+		if((old = slab_old(a)) != NULL) {
+			/* in the same order as the lookup */
+			lruhash_remove(old->array[slab_idx(old, hash)], hash,
+				key);
+			lruhash_remove(a->array[slab_idx(a, hash)], hash, key);
+		}
+		if((n = slab_cur(sl)) == a)
+			return;
+		a = n;
+	}
 }
 
 void slabhash_status(struct slabhash* sl, const char* id, int extended)
 {
+	struct slab_array* a = slab_cur(sl), *old;
 	size_t i;
 	char num[17];
 	log_info("Slabhash %s: %u tables mask=%x shift=%d", 
-		id, (unsigned)sl->size, (unsigned)sl->mask, sl->shift);
-	for(i=0; i<sl->size; i++) {
+		id, (unsigned)a->size, (unsigned)a->mask, a->shift);
+	for(i=0; i<a->size; i++) {
 		snprintf(num, sizeof(num), "table %u", (unsigned)i);
-		lruhash_status(sl->array[i], num, extended);
+		lruhash_status(a->array[i], num, extended);
+	}
+	if((old = slab_old(a)) != NULL) {
+		log_info("Slabhash %s: rehash from %u tables", id,
+			(unsigned)old->size);
+		for(i=0; i<old->size; i++) {
+			snprintf(num, sizeof(num), "old table %u",
+				(unsigned)i);
+			lruhash_status(old->array[i], num, extended);
+		}
 	}
 }
 
 size_t slabhash_get_size(struct slabhash* sl)
 {
+	struct slab_array* a = slab_cur(sl);
 	size_t i, total = 0;
-	for(i=0; i<sl->size; i++) {
-		lock_quick_lock(&sl->array[i]->lock);
-		total += sl->array[i]->space_max;
-		lock_quick_unlock(&sl->array[i]->lock);
+	for(i=0; i<a->size; i++) {
+		lock_quick_lock(&a->array[i]->lock);
+		total += a->array[i]->space_max;
+		lock_quick_unlock(&a->array[i]->lock);
 	}
 	return total;
 }
 
+/** memory in use by a slab array */
+static size_t
+slab_array_get_mem(struct slab_array* a)
+{
+	size_t i, total = sizeof(*a) + sizeof(struct lruhash*)*a->size;
+	for(i=0; i<a->size; i++)
+		total += lruhash_get_mem(a->array[i]);
+	return total;
+}
+
 size_t slabhash_get_mem(struct slabhash* sl)
 {	
-	size_t i, total = sizeof(*sl);
-	total += sizeof(struct lruhash*)*sl->size;
-	for(i=0; i<sl->size; i++) {
-		total += lruhash_get_mem(sl->array[i]);
-	}
+	struct slab_array* a = slab_cur(sl), *old;
+	size_t total = sizeof(*sl) + slab_array_get_mem(a);
+	if((old = slab_old(a)) != NULL)
+		total += slab_array_get_mem(old);
 	return total;
 }
 
-struct lruhash* slabhash_gettable(struct slabhash* sl, hashvalue_type hash)
+void slabhash_update_space_max(struct slabhash* sl, size_t maxmem)
+{
+	struct slab_array* a = slab_cur(sl);
+	size_t i;
+	for(i=0; i<a->size; i++)
+		lruhash_update_space_max(a->array[i], NULL, maxmem/a->size);
+}
+
+/** move the most recently used entry of a table into the new array.
+ * The locks of both tables are held, so the entry is always in one.
+ * returns false if the table is empty, it is then closed. */
+static int
+slab_move_mru(struct lruhash* from, struct slab_array* a)
 {
-	return sl->array[slab_idx(sl, hash)];
+	struct lruhash_entry* e, *list = NULL;
+	struct lruhash* to;
+	lock_quick_lock(&from->lock);
+	if(!(e = from->lru_start)) {
+		lruhash_close(from);
+		lock_quick_unlock(&from->lock);
+		return 0;
+	}
+	to = a->array[slab_idx(a, e->hash)];
+	lock_quick_lock(&to->lock);
+	lruhash_move_entry(from, to, e, &list);
+	lock_quick_unlock(&to->lock);
+	lock_quick_unlock(&from->lock);
+	lruhash_delete_list(to, list);
+	return 1;
+}
+
+int slabhash_rehash(struct slabhash* sl, size_t numtables)
+{
+#ifdef UB_ATOMIC_ORDERED
+	struct slab_array* old = sl->cur, *a;
+	struct lruhash* t = old->array[0];
+	size_t i;
+	int moved;
+	if(numtables == old->size)
+		return 1;
+	log_assert(numtables > 0 && !old->old);
+	a = slab_array_create(numtables, HASH_DEFAULT_STARTARRAY,
+		slabhash_get_size(sl), t->sizefunc, t->compfunc,
+		t->delkeyfunc, t->deldatafunc, t->cb_arg);
+	if(!a)
+		return 0;
+	for(i=0; i<a->size; i++)
+		lruhash_setmarkdel(a->array[i], t->markdelfunc);
+	/* put the new array in place, the other threads search the old
+	 * array for entries that have not moved yet.  This thread is the
+	 * only one that changes the arrays. */
+	a->old = old;
+	ub_store_release(&sl->cur, a);
+
+	/* move the entries over one at a time, most recently used first,
+	 * to the end of the new LRU lists, so entries that the other
+	 * threads store in the meantime stay in front.  Take turns between
+	 * the old tables to keep their relative LRU order.  Only the locks
+	 * of the two tables are held for every entry, and nothing is
+	 * copied.  An emptied old table is closed, inserts with the old
+	 * array then go to the new array. */
+	do {
+		moved = 0;
+		for(i=0; i<old->size; i++) {
+			if(slab_move_mru(old->array[i], a))
+				moved = 1;
+		}
+	} while(moved);
+
+	/* other threads may still look at the old array, it is kept with
+	 * its closed and empty tables until the slabhash is deleted */
+	ub_store_release(&a->old, (struct slab_array*)NULL);
+	old->next = sl->retired;
+	sl->retired = old;
+	return 1;
+#else
+	/* the other threads cannot pick up a new array safely, so the
+	 * number of slabs changes on a reload */
+	return numtables == sl->cur->size;
+#endif /* UB_ATOMIC_ORDERED */
+}
+
+int slabhash_adjust(struct slabhash* sl, size_t numtables, size_t maxmem)
+{
+	if(numtables != slab_cur(sl)->size && !slabhash_rehash(sl, numtables))
+		return 0;
+	if(maxmem != slabhash_get_size(sl))
+		slabhash_update_space_max(sl, maxmem);
+	return 1;
+}
+
+struct slab_array* slabhash_array(struct slabhash* sl)
+{
+	return slab_cur(sl);
+}
+
+struct lruhash* slabhash_locktable(struct slabhash* sl, hashvalue_type hash,
+	struct lruhash_entry* entry)
+{
+	struct slab_array* a = slab_cur(sl);
+	struct lruhash* table = a->array[slab_idx(a, hash)];
+	struct lruhash_bin* bin;
+	struct lruhash_entry* p;
+	lock_quick_lock(&table->lock);
+	/* entries only leave the table with its lock held, but the array
+	 * can be replaced, and during a rehash the entry can be in the
+	 * other array, so see if the entry is in the bin */
+	bin = &table->array[hash & table->size_mask];
+	lock_quick_lock(&bin->lock);
+	for(p = bin->overflow_list; p; p = p->overflow_next)
+		if(p == entry)
+			break;
+	lock_quick_unlock(&bin->lock);
+	if(!p) {
+		lock_quick_unlock(&table->lock);
+		return NULL;
+	}
+	return table;
 }
 
 /* test code, here to avoid linking problems with fptr_wlist */
@@ -204,28 +440,42 @@ void test_slabhash_deldata(void* data, void* ATTR_UNUSED(arg))
 
 void slabhash_setmarkdel(struct slabhash* sl, lruhash_markdelfunc_type md)
 {
+	struct slab_array* a = slab_cur(sl);
 	size_t i;
-	for(i=0; i<sl->size; i++) {
-		lruhash_setmarkdel(sl->array[i], md);
+	for(i=0; i<a->size; i++) {
+		lruhash_setmarkdel(a->array[i], md);
 	}
 }
 
 void slabhash_traverse(struct slabhash* sh, int wr,
 	void (*func)(struct lruhash_entry*, void*), void* arg)
 {
+	struct slab_array* a = slab_cur(sh), *old;
 	size_t i;
-	for(i=0; i<sh->size; i++)
-		lruhash_traverse(sh->array[i], wr, func, arg);
+	for(i=0; i<a->size; i++)
+		lruhash_traverse(a->array[i], wr, func, arg);
+	if((old = slab_old(a)) != NULL) {
+		for(i=0; i<old->size; i++)
+			lruhash_traverse(old->array[i], wr, func, arg);
+	}
 }
 
 size_t count_slabhash_entries(struct slabhash* sh)
 {
+	struct slab_array* a = slab_cur(sh), *old;
 	size_t slab, cnt = 0;
 
-	for(slab=0; slab<sh->size; slab++) {
-		lock_quick_lock(&sh->array[slab]->lock);
-		cnt += sh->array[slab]->num;
-		lock_quick_unlock(&sh->array[slab]->lock);
+	for(slab=0; slab<a->size; slab++) {
+		lock_quick_lock(&a->array[slab]->lock);
+		cnt += a->array[slab]->num;
+		lock_quick_unlock(&a->array[slab]->lock);
+	}
+	if((old = slab_old(a)) != NULL) {
+		for(slab=0; slab<old->size; slab++) {
+			lock_quick_lock(&old->array[slab]->lock);
+			cnt += old->array[slab]->num;
+			lock_quick_unlock(&old->array[slab]->lock);
+		}
 	}
 	return cnt;
 }
@@ -37,8 +37,10 @@
  * \file
  *
  * Hash table that consists of smaller hash tables.
- * It cannot grow, but that gives it the ability to have multiple
- * locks. Also this means there are multiple LRU lists.
+ * It does not grow by itself, but that gives it the ability to have
+ * multiple locks. Also this means there are multiple LRU lists.
+ * The number of slabs can be changed with slabhash_rehash, that moves the
+ * entries into the new slab array while the table stays in use.
  */
 
 #ifndef UTIL_STORAGE_SLABHASH_H
@@ -49,12 +51,12 @@
 #define HASH_DEFAULT_SLABS 4
 
 /**
- * Hash table formed from several smaller ones. 
- * This results in a partitioned lruhash table, a 'slashtable'.
- * None of the data inside the slabhash may be altered.
- * Therefore, no locks are needed to access the structure.
+ * The smaller tables of a slabbed hash table, with the mask and shift
+ * that pick the table for a hash value.  A rehash puts a new slab array
+ * in place, and the old one stays allocated until the slabhash is
+ * deleted, because other threads may still be looking at it.
  */
-struct slabhash {
+struct slab_array {
 	/** the size of the array - must be power of 2 */
 	size_t size;
 	/** size bitmask - uses high bits. */
@@ -63,6 +65,25 @@ struct slabhash {
 	unsigned int shift;
 	/** lookup array of hash tables */
 	struct lruhash** array;
+	/** during a rehash, the previous slab array, that the entries move
+	 * out of, or NULL.  Its tables are searched before this array. */
+	struct slab_array* old;
+	/** next in the list of slab arrays that were replaced */
+	struct slab_array* next;
+};
+
+/**
+ * Hash table formed from several smaller ones. 
+ * This results in a partitioned lruhash table, a 'slashtable'.
+ * The operations read the current slab array without a lock, and only
+ * lock the smaller table that they use.
+ */
+struct slabhash {
+	/** the current slab array, replaced by slabhash_rehash */
+	struct slab_array* cur;
+	/** slab arrays that were replaced, their tables are closed and
+	 * empty. */
+	struct slab_array* retired;
 };
 
 /**
@@ -160,12 +181,57 @@ size_t slabhash_get_size(struct slabhash* table);
 size_t slabhash_get_mem(struct slabhash* table);
 
 /**
- * Get lruhash table for a given hash value
+ * Change the maximum memory of the slab hash table, without flushing it.
+ * Every table gets maxmem/numtables.  When shrinking, the least recently
+ * used entries are deleted until the tables fit.  Growing only raises the
+ * limit.  Safe to call while other threads use the table.
+ * @param table: slabbed hash table.
+ * @param maxmem: new maximum amount of memory.
+ */
+void slabhash_update_space_max(struct slabhash* table, size_t maxmem);
+
+/**
+ * Change the number of slabs of the slab hash table, without flushing it.
+ * The new slab array is put in place, and the entries move over one at a
+ * time, most recently used first, while the old array is still searched
+ * by lookups.  Other threads can use the table during the rehash.  Only
+ * one thread may rehash a table at a time.
+ * @param table: slabbed hash table.
+ * @param numtables: new number of slabs, power of 2.
+ * @return false on malloc failure, or if the compiler has no atomic
+ *	loads (UB_ATOMIC_ORDERED), the table is then unchanged.
+ */
+int slabhash_rehash(struct slabhash* table, size_t numtables);
+
+/**
+ * Adjust the slab hash table to a new number of slabs and memory size,
+ * keeping the entries.  Uses slabhash_rehash and slabhash_update_space_max.
+ * @param table: slabbed hash table.
+ * @param numtables: number of slabs, power of 2.
+ * @param maxmem: maximum amount of memory.
+ * @return false on malloc failure.
+ */
+int slabhash_adjust(struct slabhash* table, size_t numtables, size_t maxmem);
+
+/**
+ * Get the current slab array.  It stays allocated until the table is
+ * deleted, but a rehash in another thread can replace it.
+ * @param table: slabbed hash table.
+ * @return the slab array.
+ */
+struct slab_array* slabhash_array(struct slabhash* table);
+
+/**
+ * Lock the lruhash table that holds an entry.  The entry stays in the
+ * table while the lock is held.  The caller does not hold the entry lock.
  * @param table: slabbed hash table.
- * @param hash: hash value.
- * @return the lru hash table.
+ * @param hash: hash value of the entry.
+ * @param entry: the entry.
+ * @return the locked lru hash table, or NULL if the entry is not in the
+ *	table for the hash, because it was deleted or a rehash moves it.
  */
-struct lruhash* slabhash_gettable(struct slabhash* table, hashvalue_type hash);
+struct lruhash* slabhash_locktable(struct slabhash* table,
+	hashvalue_type hash, struct lruhash_entry* entry);
 
 /**
  * Set markdel function
@@ -46,6 +46,7 @@
 #include <sys/types.h>
 #include "util/timehist.h"
 #include "util/log.h"
+#include "util/locks.h"
 
 /** special timestwo operation for time values in histogram setup */
 static void
@@ -231,8 +232,9 @@ timehist_export(struct timehist* hist, size_t* array, size_t sz)
 	if(!hist) return;
 	if(sz > hist->num)
 		sz = hist->num;
+	/* the counts can be read by another thread while the owner adds */
 	for(i=0; i<sz; i++)
-		array[i] = hist->buckets[i].count;
+		array[i] = ub_load_relaxed(&hist->buckets[i].count);
 }
 
 void 
@@ -0,0 +1,206 @@
+/*
+ * util/timewheel.c - hashed timing wheel for coarse timeouts.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains the hashed timing wheel for coarse timeouts.
+ */
+#include "config.h"
+#include "util/timewheel.h"
+
+/** mask for the slot number */
+#define TIMEWHEEL_MASK (TIMEWHEEL_SLOTS-1)
+
+struct timewheel*
+timewheel_create(uint64_t now)
+{
+	struct timewheel* w = (struct timewheel*)calloc(1, sizeof(*w));
+	int i;
+	if(!w)
+		return NULL;
+	for(i=0; i<TIMEWHEEL_SLOTS; i++)
+		timewheel_list_init(&w->slots[i]);
+	w->cur = now / TIMEWHEEL_TICK;
+	return w;
+}
+
+void
+timewheel_delete(struct timewheel* w)
+{
+	free(w);
+}
+
+void
+timewheel_list_init(struct timewheel_entry* e)
+{
+	e->next = e;
+	e->prev = e;
+}
+
+/** append entry at the end of the list */
+static void
+list_append(struct timewheel_entry* list, struct timewheel_entry* e)
+{
+	e->next = list;
+	e->prev = list->prev;
+	list->prev->next = e;
+	list->prev = e;
+}
+
+void
+timewheel_add(struct timewheel* w, struct timewheel_entry* e,
+	uint64_t expire)
+{
+	size_t s;
+	/* round up, so that it does not expire early */
+	e->expire = (expire + TIMEWHEEL_TICK - 1) / TIMEWHEEL_TICK;
+	if(e->expire <= w->cur)
+		e->expire = w->cur + 1;
+	s = (size_t)(e->expire & TIMEWHEEL_MASK);
+	list_append(&w->slots[s], e);
+	w->used[s/64] |= ((uint64_t)1 << (s%64));
+}
+
+void
+timewheel_remove(struct timewheel_entry* e)
+{
+	if(!e->next)
+		return;
+	e->prev->next = e->next;
+	e->next->prev = e->prev;
+	e->next = NULL;
+	e->prev = NULL;
+}
+
+/**
+ * The clock went back, move the entries back by the same number of ticks,
+ * so that they keep the timeout they had, and are not late by the jump.
+ * @param w: the wheel.
+ * @param tick: the new current tick, before w->cur.
+ */
+static void
+timewheel_rebase(struct timewheel* w, uint64_t tick)
+{
+	uint64_t back = w->cur - tick;
+	struct timewheel_entry moved, *e;
+	size_t s;
+	timewheel_list_init(&moved);
+	for(s=0; s<TIMEWHEEL_SLOTS; s++) {
+		if(!(w->used[s/64] & ((uint64_t)1 << (s%64))))
+			continue;
+		while((e = w->slots[s].next) != &w->slots[s]) {
+			timewheel_remove(e);
+			/* the entries expire after w->cur */
+			if(e->expire > w->cur)
+				e->expire -= back;
+			else	e->expire = tick + 1;
+			list_append(&moved, e);
+		}
+		w->used[s/64] &= ~((uint64_t)1 << (s%64));
+	}
+	w->cur = tick;
+	while((e = moved.next) != &moved) {
+		timewheel_remove(e);
+		s = (size_t)(e->expire & TIMEWHEEL_MASK);
+		list_append(&w->slots[s], e);
+		w->used[s/64] |= ((uint64_t)1 << (s%64));
+	}
+}
+
+void
+timewheel_expire(struct timewheel* w, uint64_t now,
+	struct timewheel_entry* list)
+{
+	uint64_t tick = now / TIMEWHEEL_TICK, n, i;
+	struct timewheel_entry* e, *nx, *head;
+	size_t s;
+	if(tick < w->cur) {
+		/* the clock went back, continue from the new time */
+		timewheel_rebase(w, tick);
+		return;
+	}
+	if(tick == w->cur)
+		return;
+	n = tick - w->cur;
+	if(n > TIMEWHEEL_SLOTS)
+		n = TIMEWHEEL_SLOTS;
+	for(i=1; i<=n; i++) {
+		s = (size_t)((w->cur + i) & TIMEWHEEL_MASK);
+		if(!(w->used[s/64] & ((uint64_t)1 << (s%64))))
+			continue;
+		head = &w->slots[s];
+		for(e = head->next; e != head; e = nx) {
+			nx = e->next;
+			if(e->expire > tick)
+				continue; /* a later rotation */
+			timewheel_remove(e);
+			list_append(list, e);
+		}
+		if(head->next == head)
+			w->used[s/64] &= ~((uint64_t)1 << (s%64));
+	}
+	w->cur = tick;
+}
+
+int
+timewheel_next(struct timewheel* w, uint64_t* next)
+{
+	uint64_t i = 1, bits;
+	size_t s;
+	while(i <= TIMEWHEEL_SLOTS) {
+		s = (size_t)((w->cur + i) & TIMEWHEEL_MASK);
+		bits = w->used[s/64] >> (s%64);
+		if(bits == 0) {
+			/* skip the rest of this word */
+			i += 64 - (s%64);
+			continue;
+		}
+		while(!(bits&1)) {
+			bits >>= 1;
+			i++;
+		}
+		s = (size_t)((w->cur + i) & TIMEWHEEL_MASK);
+		if(w->slots[s].next == &w->slots[s]) {
+			/* the entries were removed */
+			w->used[s/64] &= ~((uint64_t)1 << (s%64));
+			i++;
+			continue;
+		}
+		*next = (w->cur + i) * TIMEWHEEL_TICK;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,143 @@
+/*
+ * util/timewheel.h - hashed timing wheel for coarse timeouts.
+ *
+ * Copyright (c) 2017, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * This file contains a hashed timing wheel. It holds many timeouts of the
+ * same coarse resolution, like the timeouts of outstanding upstream
+ * queries, with constant time insert and delete. An event based timer
+ * (an rbtree or heap insert and delete) is then only needed for the
+ * earliest of them.
+ *
+ * Time is divided in ticks of TIMEWHEEL_TICK msec. An entry is put in the
+ * slot for the tick of its expiry, modulo the number of slots, and entries
+ * that are more than a rotation away share the slot with earlier ones.
+ * An entry expires at the first check after its tick, it is never early,
+ * and up to a tick late.  If the clock goes back, the entries are moved
+ * back by as much, so they keep the timeout that they had left.
+ */
+
+#ifndef UTIL_TIMEWHEEL_H
+#define UTIL_TIMEWHEEL_H
+
+/** number of slots in the wheel, power of 2 */
+#define TIMEWHEEL_SLOTS 1024
+/** msec per slot, the resolution of the timeouts */
+#define TIMEWHEEL_TICK 8
+
+/**
+ * Entry in the timing wheel, the lists are circular with the slot as
+ * sentinel.
+ */
+struct timewheel_entry {
+	/** next in list, NULL if not in a list */
+	struct timewheel_entry* next;
+	/** previous in list */
+	struct timewheel_entry* prev;
+	/** the tick at which it expires */
+	uint64_t expire;
+	/** user data */
+	void* data;
+};
+
+/**
+ * The timing wheel.
+ */
+struct timewheel {
+	/** the slots, list sentinels */
+	struct timewheel_entry slots[TIMEWHEEL_SLOTS];
+	/** bit per slot that may hold entries, it is cleared when the slot
+	 * is found empty */
+	uint64_t used[TIMEWHEEL_SLOTS/64];
+	/** the last tick that was expired */
+	uint64_t cur;
+};
+
+/**
+ * Create a timing wheel.
+ * @param now: the time now, in msec.
+ * @return new wheel or NULL on malloc failure.
+ */
+struct timewheel* timewheel_create(uint64_t now);
+
+/**
+ * Delete the timing wheel, the entries are not changed.
+ * @param w: the wheel.
+ */
+void timewheel_delete(struct timewheel* w);
+
+/**
+ * Init an empty list, with the entry as list sentinel.
+ * @param e: the list sentinel.
+ */
+void timewheel_list_init(struct timewheel_entry* e);
+
+/**
+ * Add an entry to the wheel. It must not be in the wheel.
+ * @param w: the wheel.
+ * @param e: the entry, with data filled in.
+ * @param expire: when it expires, in msec.
+ */
+void timewheel_add(struct timewheel* w, struct timewheel_entry* e,
+	uint64_t expire);
+
+/**
+ * Remove an entry from the wheel, or from the list that it is in.
+ * Nothing happens if it is not in a list.
+ * @param e: the entry.
+ */
+void timewheel_remove(struct timewheel_entry* e);
+
+/**
+ * Move the expired entries to a list.
+ * @param w: the wheel.
+ * @param now: the time now, in msec.
+ * @param list: the expired entries are appended to this list, that is
+ * 	initialised with timewheel_list_init.
+ */
+void timewheel_expire(struct timewheel* w, uint64_t now,
+	struct timewheel_entry* list);
+
+/**
+ * Get the time of the next check, when entries may expire.
+ * @param w: the wheel.
+ * @param next: the time is returned, in msec. Entries that are more than
+ * 	a rotation away can make this earlier than their expiry.
+ * @return false if the wheel is empty.
+ */
+int timewheel_next(struct timewheel* w, uint64_t* next);
+
+#endif /* UTIL_TIMEWHEEL_H */
@@ -41,6 +41,7 @@
 #include "config.h"
 #include "validator/val_kcache.h"
 #include "validator/val_kentry.h"
+#include "validator/val_secalgo.h"
 #include "util/log.h"
 #include "util/config_file.h"
 #include "util/data/dname.h"
@@ -67,6 +68,8 @@ key_cache_create(struct config_file* cfg)
 		free(kcache);
 		return NULL;
 	}
+	/* the parsed keys get a quarter of the size of the key cache */
+	kcache->pkeys = secalgo_pkey_cache_create(numtables, maxmem/4);
 	return kcache;
 }
 
@@ -76,9 +79,20 @@ key_cache_delete(struct key_cache* kcache)
 	if(!kcache)
 		return;
 	slabhash_delete(kcache->slab);
+	slabhash_delete(kcache->pkeys);
 	free(kcache);
 }
 
+int
+key_cache_adjust(struct key_cache* kcache, struct config_file* cfg)
+{
+	if(kcache->pkeys && !slabhash_adjust(kcache->pkeys,
+		cfg->key_cache_slabs, cfg->key_cache_size/4))
+		return 0;
+	return slabhash_adjust(kcache->slab, cfg->key_cache_slabs,
+		cfg->key_cache_size);
+}
+
 void 
 key_cache_insert(struct key_cache* kcache, struct key_entry_key* kkey,
 	struct module_qstate* qstate)
@@ -156,7 +170,8 @@ key_cache_obtain(struct key_cache* kcache, uint8_t* name, size_t namelen,
 size_t 
 key_cache_get_mem(struct key_cache* kcache)
 {
-	return sizeof(*kcache) + slabhash_get_mem(kcache->slab);
+	return sizeof(*kcache) + slabhash_get_mem(kcache->slab) +
+		(kcache->pkeys?slabhash_get_mem(kcache->pkeys):0);
 }
 
 void key_cache_remove(struct key_cache* kcache,
@@ -54,6 +54,9 @@ struct module_qstate;
 struct key_cache {
 	/** uses slabhash for storage, type key_entry_key, key_entry_data */
 	struct slabhash* slab;
+	/** the parsed public keys of the DNSKEYs, for the crypto library,
+	 * see secalgo_pkey_cache_create. NULL if not supported. */
+	struct slabhash* pkeys;
 };
 
 /**
@@ -69,6 +72,16 @@ struct key_cache* key_cache_create(struct config_file* cfg);
  */
 void key_cache_delete(struct key_cache* kcache);
 
+/**
+ * Adjust the key cache to the size and number of slabs in the config.
+ * The contents are kept, see slabhash_adjust.  The parsed keys table is
+ * adjusted with it.  Other threads can use the cache meanwhile.
+ * @param kcache: the key cache.
+ * @param cfg: config settings for the key cache.
+ * @return false on malloc failure.
+ */
+int key_cache_adjust(struct key_cache* kcache, struct config_file* cfg);
+
 /**
  * Insert or update a key cache entry. Note that the insert may silently
  * fail if there is not enough memory.
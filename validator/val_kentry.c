@@ -42,7 +42,7 @@
 #include "validator/val_kentry.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
-#include "util/storage/lookup3.h"
+#include "util/storage/keyhash.h"
 #include "util/regional.h"
 #include "util/net_help.h"
 #include "sldns/rrdef.h"
@@ -101,10 +101,11 @@ key_entry_deldatafunc(void* data, void* ATTR_UNUSED(userarg))
 void 
 key_entry_hash(struct key_entry_key* kk)
 {
-	kk->entry.hash = 0x654;
-	kk->entry.hash = hashlittle(&kk->key_class, sizeof(kk->key_class), 
-		kk->entry.hash);
-	kk->entry.hash = dname_query_hash(kk->name, kk->entry.hash);
+	struct keyhash_state s;
+	keyhash_init(&s);
+	keyhash_update(&s, &kk->key_class, sizeof(kk->key_class));
+	dname_query_hash_update(&s, kk->name);
+	kk->entry.hash = keyhash_final(&s);
 }
 
 struct key_entry_key* 
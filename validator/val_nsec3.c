@@ -54,6 +54,8 @@
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
 #include "util/data/msgreply.h"
+#include "util/storage/slabhash.h"
+#include "util/storage/keyhash.h"
 /* we include nsec.h for the bitmap_has_type function */
 #include "validator/val_nsec.h"
 #include "sldns/sbuffer.h"
@@ -105,6 +107,40 @@ struct nsec3_filter {
 	size_t num;
 	/** class of records for the NSEC3, only this class applies */
 	uint16_t fclass;
+	/** the shared cache of NSEC3 hashes, or NULL */
+	struct slabhash* hcache;
+};
+
+/**
+ * Key of the shared cache of NSEC3 hashes, the hash parameters and the
+ * name. The hash of a name does not depend on the zone, other than that
+ * the name is in the zone.
+ */
+struct nsec3_hcache_key {
+	/** the hash table entry, data is nsec3_hcache_data */
+	struct lruhash_entry entry;
+	/** the NSEC3 hash algorithm */
+	int algo;
+	/** the number of iterations */
+	size_t iter;
+	/** the salt */
+	uint8_t* salt;
+	/** length of the salt */
+	size_t saltlen;
+	/** the name that is hashed, in lowercase */
+	uint8_t* dname;
+	/** length of the name */
+	size_t dname_len;
+	/* the salt and name are allocated after the struct */
+};
+
+/**
+ * Data of the shared cache of NSEC3 hashes, the hash of the name.
+ */
+struct nsec3_hcache_data {
+	/** length of the hash */
+	size_t hash_len;
+	/* the hash is allocated after the struct */
 };
 
 /** return number of rrs in an rrset */
@@ -404,7 +440,7 @@ nsec3_rrset_has_known(struct ub_packed_rrset_key* s)
  */
 static void
 filter_init(struct nsec3_filter* filter, struct ub_packed_rrset_key** list,
-	size_t num, struct query_info* qinfo)
+	size_t num, struct query_info* qinfo, struct slabhash* hcache)
 {
 	size_t i;
 	uint8_t* nm;
@@ -414,6 +450,7 @@ filter_init(struct nsec3_filter* filter, struct ub_packed_rrset_key** list,
 	filter->list = list;
 	filter->num = num;
 	filter->fclass = qinfo->qclass;
+	filter->hcache = hcache;
 	for(i=0; i<num; i++) {
 		/* ignore other stuff in the list */
 		if(ntohs(list[i]->rk.type) != LDNS_RR_TYPE_NSEC3 ||
@@ -601,6 +638,144 @@ nsec3_calc_hash(struct regional* region, sldns_buffer* buf,
 	return 1;
 }
 
+struct slabhash*
+nsec3_hcache_create(size_t numtables, size_t maxmem)
+{
+	if(maxmem == 0)
+		return NULL;
+	return slabhash_create(numtables, HASH_DEFAULT_STARTARRAY, maxmem,
+		&nsec3_hcache_sizefunc, &nsec3_hcache_compfunc,
+		&nsec3_hcache_delkeyfunc, &nsec3_hcache_deldatafunc, NULL);
+}
+
+size_t
+nsec3_hcache_sizefunc(void* key, void* data)
+{
+	struct nsec3_hcache_key* k = (struct nsec3_hcache_key*)key;
+	struct nsec3_hcache_data* d = (struct nsec3_hcache_data*)data;
+	return sizeof(*k) + k->saltlen + k->dname_len +
+		lock_get_mem(&k->entry.lock) + sizeof(*d) + d->hash_len;
+}
+
+int
+nsec3_hcache_compfunc(void* k1, void* k2)
+{
+	struct nsec3_hcache_key* n1 = (struct nsec3_hcache_key*)k1;
+	struct nsec3_hcache_key* n2 = (struct nsec3_hcache_key*)k2;
+	int c;
+	if(n1->algo != n2->algo)
+		return (n1->algo < n2->algo)?-1:1;
+	if(n1->iter != n2->iter)
+		return (n1->iter < n2->iter)?-1:1;
+	if(n1->saltlen != n2->saltlen)
+		return (n1->saltlen < n2->saltlen)?-1:1;
+	if((c=memcmp(n1->salt, n2->salt, n1->saltlen)) != 0)
+		return c;
+	return query_dname_compare(n1->dname, n2->dname);
+}
+
+void
+nsec3_hcache_delkeyfunc(void* key, void* ATTR_UNUSED(userarg))
+{
+	struct nsec3_hcache_key* k = (struct nsec3_hcache_key*)key;
+	if(!k)
+		return;
+	lock_rw_destroy(&k->entry.lock);
+	free(k);
+}
+
+void
+nsec3_hcache_deldatafunc(void* data, void* ATTR_UNUSED(userarg))
+{
+	free(data);
+}
+
+/** calculate the hash value of the shared NSEC3 hash cache key */
+static hashvalue_type
+nsec3_hcache_hash(struct nsec3_hcache_key* k)
+{
+	struct keyhash_state s;
+	uint32_t v[3];
+	v[0] = (uint32_t)k->algo;
+	v[1] = (uint32_t)k->iter;
+	v[2] = (uint32_t)k->saltlen;
+	keyhash_init(&s);
+	keyhash_update(&s, v, sizeof(v));
+	keyhash_update(&s, k->salt, k->saltlen);
+	dname_query_hash_update(&s, k->dname);
+	return keyhash_final(&s);
+}
+
+/**
+ * Perform hash of name, with the shared cache. The hash is looked up in
+ * the shared cache, or it is calculated and stored there.
+ * @param hcache: the shared cache, if NULL, the hash is calculated.
+ * @param region: to allocate the hash in.
+ * @param buf: temporary buffer.
+ * @param c: the entry that gets the hash.
+ * @return 1 on success, 0 on malloc failure, -1 on formerr.
+ */
+static int
+nsec3_calc_hash_shared(struct slabhash* hcache, struct regional* region,
+	sldns_buffer* buf, struct nsec3_cached_hash* c)
+{
+	struct nsec3_hcache_key lookfor, *k;
+	struct nsec3_hcache_data* d;
+	struct lruhash_entry* e;
+	int r;
+	if(!hcache)
+		return nsec3_calc_hash(region, buf, c);
+	lookfor.entry.key = &lookfor;
+	lookfor.algo = nsec3_get_algo(c->nsec3, c->rr);
+	lookfor.iter = nsec3_get_iter(c->nsec3, c->rr);
+	if(!nsec3_get_salt(c->nsec3, c->rr, &lookfor.salt, &lookfor.saltlen))
+		return -1;
+	lookfor.dname = c->dname;
+	lookfor.dname_len = c->dname_len;
+	lookfor.entry.hash = nsec3_hcache_hash(&lookfor);
+	e = slabhash_lookup(hcache, lookfor.entry.hash, &lookfor, 0);
+	if(e) {
+		d = (struct nsec3_hcache_data*)e->data;
+		c->hash_len = d->hash_len;
+		c->hash = (uint8_t*)regional_alloc_init(region, (uint8_t*)(d+1),
+			d->hash_len);
+		lock_rw_unlock(&e->lock);
+		if(!c->hash)
+			return 0;
+		return 1;
+	}
+	r = nsec3_calc_hash(region, buf, c);
+	if(r != 1)
+		return r;
+	/* store it, on malloc failure it is simply not stored */
+	k = (struct nsec3_hcache_key*)malloc(sizeof(*k) + lookfor.saltlen +
+		lookfor.dname_len);
+	d = (struct nsec3_hcache_data*)malloc(sizeof(*d) + c->hash_len);
+	if(!k || !d) {
+		free(k);
+		free(d);
+		return 1;
+	}
+	memset(k, 0, sizeof(*k));
+	lock_rw_init(&k->entry.lock);
+	k->entry.hash = lookfor.entry.hash;
+	k->entry.key = k;
+	k->entry.data = d;
+	k->algo = lookfor.algo;
+	k->iter = lookfor.iter;
+	k->salt = (uint8_t*)(k+1);
+	k->saltlen = lookfor.saltlen;
+	memmove(k->salt, lookfor.salt, lookfor.saltlen);
+	k->dname = k->salt + k->saltlen;
+	k->dname_len = lookfor.dname_len;
+	memmove(k->dname, lookfor.dname, lookfor.dname_len);
+	query_dname_tolower(k->dname);
+	d->hash_len = c->hash_len;
+	memmove((uint8_t*)(d+1), c->hash, c->hash_len);
+	slabhash_insert(hcache, k->entry.hash, &k->entry, d, NULL);
+	return 1;
+}
+
 /** perform b32 encoding of hash */
 static int
 nsec3_calc_b32(struct regional* region, sldns_buffer* buf, 
@@ -623,7 +798,8 @@ nsec3_calc_b32(struct regional* region, sldns_buffer* buf,
 }
 
 int
-nsec3_hash_name(rbtree_type* table, struct regional* region, sldns_buffer* buf,
+nsec3_hash_name(rbtree_type* table, struct slabhash* hcache,
+	struct regional* region, sldns_buffer* buf,
 	struct ub_packed_rrset_key* nsec3, int rr, uint8_t* dname, 
 	size_t dname_len, struct nsec3_cached_hash** hash)
 {
@@ -652,7 +828,7 @@ nsec3_hash_name(rbtree_type* table, struct regional* region, sldns_buffer* buf,
 	c->rr = rr;
 	c->dname = dname;
 	c->dname_len = dname_len;
-	r = nsec3_calc_hash(region, buf, c);
+	r = nsec3_calc_hash_shared(hcache, region, buf, c);
 	if(r != 1)
 		return r;
 	r = nsec3_calc_b32(region, buf, c);
@@ -743,8 +919,8 @@ find_matching_nsec3(struct module_env* env, struct nsec3_filter* flt,
 	for(s=filter_first(flt, &i_rs, &i_rr); s; 
 		s=filter_next(flt, &i_rs, &i_rr)) {
 		/* get name hashed for this NSEC3 RR */
-		r = nsec3_hash_name(ct, env->scratch, env->scratch_buffer,
-			s, i_rr, nm, nmlen, &hash);
+		r = nsec3_hash_name(ct, flt->hcache, env->scratch,
+			env->scratch_buffer, s, i_rr, nm, nmlen, &hash);
 		if(r == 0) {
 			log_err("nsec3: malloc failure");
 			break; /* alloc failure */
@@ -836,8 +1012,8 @@ find_covering_nsec3(struct module_env* env, struct nsec3_filter* flt,
 	for(s=filter_first(flt, &i_rs, &i_rr); s; 
 		s=filter_next(flt, &i_rs, &i_rr)) {
 		/* get name hashed for this NSEC3 RR */
-		r = nsec3_hash_name(ct, env->scratch, env->scratch_buffer,
-			s, i_rr, nm, nmlen, &hash);
+		r = nsec3_hash_name(ct, flt->hcache, env->scratch,
+			env->scratch_buffer, s, i_rr, nm, nmlen, &hash);
 		if(r == 0) {
 			log_err("nsec3: malloc failure");
 			break; /* alloc failure */
@@ -1068,7 +1244,8 @@ nsec3_prove_nameerror(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	/* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve->nsec3_hcache);
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
@@ -1227,7 +1404,8 @@ nsec3_prove_nodata(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	/* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve->nsec3_hcache);
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
@@ -1251,7 +1429,8 @@ nsec3_prove_wildcard(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	/* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve->nsec3_hcache);
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
@@ -1328,7 +1507,8 @@ nsec3_prove_nods(struct module_env* env, struct val_env* ve,
 	if(!list_is_secure(env, ve, list, num, kkey, reason))
 		return sec_status_bogus; /* not all NSEC3 records secure */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	/* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve->nsec3_hcache);
 	if(!flt.zone) {
 		*reason = "no NSEC3 records";
 		return sec_status_bogus; /* no RRs */
@@ -1410,7 +1590,8 @@ nsec3_prove_nxornodata(struct module_env* env, struct val_env* ve,
 	if(!list || num == 0 || !kkey || !key_entry_isgood(kkey))
 		return sec_status_bogus; /* no valid NSEC3s, bogus */
 	rbtree_init(&ct, &nsec3_hash_cmp); /* init names-to-hash cache */
-	filter_init(&flt, list, num, qinfo); /* init RR iterator */
+	/* init RR iterator */
+	filter_init(&flt, list, num, qinfo, ve->nsec3_hcache);
 	if(!flt.zone)
 		return sec_status_bogus; /* no RRs */
 	if(nsec3_iteration_count_high(ve, &flt, kkey))
@@ -76,6 +76,7 @@ struct reply_info;
 struct query_info;
 struct key_entry_key;
 struct sldns_buffer;
+struct slabhash;
 
 /**
  *     0 1 2 3 4 5 6 7
@@ -257,6 +258,8 @@ int nsec3_hash_cmp(const void* c1, const void* c2);
  * published to enable unit testing of hash algorithms and cache.
  *
  * @param table: the cache table. Must be initialised at start.
+ * @param hcache: the shared cache of NSEC3 hashes, or NULL.
+ * 	The hashes are looked up there, before they are calculated.
  * @param region: scratch region to use for allocation.
  * 	This region holds the tree, if you wipe the region, reinit the tree.
  * @param buf: temporary buffer.
@@ -271,9 +274,32 @@ int nsec3_hash_cmp(const void* c1, const void* c2);
  * 	0 on a malloc failure.
  * 	-1 if the NSEC3 rr was badly formatted (i.e. formerr).
  */
-int nsec3_hash_name(rbtree_type* table, struct regional* region,
-	struct sldns_buffer* buf, struct ub_packed_rrset_key* nsec3, int rr,
-	uint8_t* dname, size_t dname_len, struct nsec3_cached_hash** hash);
+int nsec3_hash_name(rbtree_type* table, struct slabhash* hcache,
+	struct regional* region, struct sldns_buffer* buf,
+	struct ub_packed_rrset_key* nsec3, int rr, uint8_t* dname,
+	size_t dname_len, struct nsec3_cached_hash** hash);
+
+/**
+ * Create the shared cache of NSEC3 hashes. It is used by the threads
+ * for the hashes of names with the NSEC3 parameters of their zone.
+ * Delete it with slabhash_delete.
+ * @param numtables: number of slabs.
+ * @param maxmem: memory limit, if 0, no cache is created.
+ * @return the cache, or NULL if maxmem is 0 or on malloc failure.
+ */
+struct slabhash* nsec3_hcache_create(size_t numtables, size_t maxmem);
+
+/** calculate size of the NSEC3 hash cache entry */
+size_t nsec3_hcache_sizefunc(void* key, void* data);
+
+/** compare NSEC3 hash cache entries */
+int nsec3_hcache_compfunc(void* k1, void* k2);
+
+/** delete NSEC3 hash cache key */
+void nsec3_hcache_delkeyfunc(void* key, void* userarg);
+
+/** delete NSEC3 hash cache data */
+void nsec3_hcache_deldatafunc(void* data, void* userarg);
 
 /**
  * Get next owner name, converted to base32 encoding and with the
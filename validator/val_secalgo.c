@@ -46,6 +46,9 @@
 #include "validator/val_secalgo.h"
 #include "validator/val_nsec3.h"
 #include "util/log.h"
+#include "util/net_help.h"
+#include "util/storage/slabhash.h"
+#include "util/storage/keyhash.h"
 #include "sldns/rrdef.h"
 #include "sldns/keyraw.h"
 #include "sldns/sbuffer.h"
@@ -54,6 +57,74 @@
 #error "Need crypto library to do digital signature cryptography"
 #endif
 
+/** estimate of the memory used by the key object of the crypto library,
+ * in addition to the size of the public key data */
+#define PKEY_OBJ_SIZE 1024
+
+/**
+ * Key of the cache of parsed public keys, the DNSKEY algorithm and the
+ * public key data.
+ */
+struct secalgo_pkey_key {
+	/** the hash table entry, data is secalgo_pkey_data */
+	struct lruhash_entry entry;
+	/** the DNSKEY algorithm */
+	int algo;
+	/** the public key data from the DNSKEY rdata, malloced */
+	unsigned char* key;
+	/** length of the public key data */
+	size_t keylen;
+};
+
+/**
+ * Data of the cache of parsed public keys, the key object of the crypto
+ * library that is ready for use in verification.
+ */
+struct secalgo_pkey_data {
+	/** the public key object */
+	void* pkey;
+	/** the digest type to use with the key */
+	const void* digest;
+};
+
+/** hash the public key for the cache */
+static hashvalue_type
+pkey_hash(int algo, unsigned char* key, size_t keylen)
+{
+	return keyhash(key, keylen, (uint32_t)algo);
+}
+
+size_t
+secalgo_pkey_sizefunc(void* key, void* ATTR_UNUSED(data))
+{
+	struct secalgo_pkey_key* k = (struct secalgo_pkey_key*)key;
+	return sizeof(*k) + k->keylen + lock_get_mem(&k->entry.lock) +
+		sizeof(struct secalgo_pkey_data) + PKEY_OBJ_SIZE;
+}
+
+int
+secalgo_pkey_compfunc(void* k1, void* k2)
+{
+	struct secalgo_pkey_key* n1 = (struct secalgo_pkey_key*)k1;
+	struct secalgo_pkey_key* n2 = (struct secalgo_pkey_key*)k2;
+	if(n1->algo != n2->algo)
+		return (n1->algo < n2->algo)?-1:1;
+	if(n1->keylen != n2->keylen)
+		return (n1->keylen < n2->keylen)?-1:1;
+	return memcmp(n1->key, n2->key, n1->keylen);
+}
+
+void
+secalgo_pkey_delkeyfunc(void* key, void* ATTR_UNUSED(userarg))
+{
+	struct secalgo_pkey_key* k = (struct secalgo_pkey_key*)key;
+	if(!k)
+		return;
+	lock_rw_destroy(&k->entry.lock);
+	free(k->key);
+	free(k);
+}
+
 /* OpenSSL implementation */
 #ifdef HAVE_SSL
 #ifdef HAVE_OPENSSL_ERR_H
@@ -538,6 +609,98 @@ setup_key_digest(int algo, EVP_PKEY** evp_key, const EVP_MD** digest_type,
 	return 1;
 }
 
+struct slabhash*
+secalgo_pkey_cache_create(size_t numtables, size_t maxmem)
+{
+#ifdef HAVE_EVP_PKEY_UP_REF
+	return slabhash_create(numtables, HASH_DEFAULT_STARTARRAY, maxmem,
+		&secalgo_pkey_sizefunc, &secalgo_pkey_compfunc,
+		&secalgo_pkey_delkeyfunc, &secalgo_pkey_deldatafunc, NULL);
+#else
+	/* the key objects cannot be shared without reference counts */
+	(void)numtables;
+	(void)maxmem;
+	return NULL;
+#endif
+}
+
+void
+secalgo_pkey_deldatafunc(void* data, void* ATTR_UNUSED(userarg))
+{
+	struct secalgo_pkey_data* d = (struct secalgo_pkey_data*)data;
+	if(!d)
+		return;
+	EVP_PKEY_free((EVP_PKEY*)d->pkey);
+	free(d);
+}
+
+/**
+ * Get the key and digest for verification, from the cache of parsed
+ * public keys, or set it up and store it in the cache.
+ * @param pkeys: the cache, or NULL.
+ * @param algo: key algorithm
+ * @param evp_key: EVP PKEY public key, caller must free it.
+ * @param digest_type: digest type to use
+ * @param key: key to setup for.
+ * @param keylen: length of key.
+ * @return false on failure.
+ */
+static int
+obtain_key_digest(struct slabhash* pkeys, int algo, EVP_PKEY** evp_key,
+	const EVP_MD** digest_type, unsigned char* key, size_t keylen)
+{
+#ifdef HAVE_EVP_PKEY_UP_REF
+	struct secalgo_pkey_key lookfor, *k;
+	struct secalgo_pkey_data* d;
+	struct lruhash_entry* e;
+	if(pkeys) {
+		lookfor.entry.key = &lookfor;
+		lookfor.algo = algo;
+		lookfor.key = key;
+		lookfor.keylen = keylen;
+		lookfor.entry.hash = pkey_hash(algo, key, keylen);
+		e = slabhash_lookup(pkeys, lookfor.entry.hash, &lookfor, 0);
+		if(e) {
+			/* the key object is shared, it is only read in the
+			 * verification */
+			d = (struct secalgo_pkey_data*)e->data;
+			*evp_key = (EVP_PKEY*)d->pkey;
+			*digest_type = (const EVP_MD*)d->digest;
+			EVP_PKEY_up_ref(*evp_key);
+			lock_rw_unlock(&e->lock);
+			return 1;
+		}
+	}
+#else
+	(void)pkeys;
+#endif
+	if(!setup_key_digest(algo, evp_key, digest_type, key, keylen))
+		return 0;
+#ifdef HAVE_EVP_PKEY_UP_REF
+	if(pkeys) {
+		/* on malloc failure, the key is simply not cached */
+		k = (struct secalgo_pkey_key*)calloc(1, sizeof(*k));
+		d = (struct secalgo_pkey_data*)malloc(sizeof(*d));
+		if(!k || !d || !(k->key = memdup(key, keylen))) {
+			free(k);
+			free(d);
+			return 1;
+		}
+		k->algo = algo;
+		k->keylen = keylen;
+		lock_rw_init(&k->entry.lock);
+		k->entry.hash = lookfor.entry.hash;
+		k->entry.key = k;
+		k->entry.data = d;
+		EVP_PKEY_up_ref(*evp_key);
+		d->pkey = *evp_key;
+		d->digest = *digest_type;
+		slabhash_insert(pkeys, k->entry.hash, &k->entry, d, NULL);
+	}
+#endif
+	return 1;
+}
+
 /**
  * Check a canonical sig+rrset and signature against a dnskey
  * @param buf: buffer with data to verify, the first rrsig part and the
@@ -547,6 +710,7 @@ setup_key_digest(int algo, EVP_PKEY** evp_key, const EVP_MD** digest_type,
  * @param sigblock_len: length of sigblock data.
  * @param key: public key data from DNSKEY RR.
  * @param keylen: length of keydata.
+ * @param pkeys: cache of parsed public keys, or NULL.
  * @param reason: bogus reason in more detail.
  * @return secure if verification succeeded, bogus on crypto failure,
  *	unchecked on format errors and alloc failures.
@@ -554,7 +718,7 @@ setup_key_digest(int algo, EVP_PKEY** evp_key, const EVP_MD** digest_type,
 enum sec_status
 verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock, 
 	unsigned int sigblock_len, unsigned char* key, unsigned int keylen,
-	char** reason)
+	struct slabhash* pkeys, char** reason)
 {
 	const EVP_MD *digest_type;
 	EVP_MD_CTX* ctx;
@@ -566,7 +730,8 @@ verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 		return sec_status_secure;
 #endif
 	
-	if(!setup_key_digest(algo, &evp_key, &digest_type, key, keylen)) {
+	if(!obtain_key_digest(pkeys, algo, &evp_key, &digest_type, key,
+		keylen)) {
 		verbose(VERB_QUERY, "verify: failed to setup key");
 		*reason = "use of key for crypto failed";
 		EVP_PKEY_free(evp_key);
@@ -1092,6 +1257,20 @@ nss_setup_key_digest(int algo, SECKEYPublicKey** pubkey, HASH_HashType* htype,
 	return 1;
 }
 
+struct slabhash*
+secalgo_pkey_cache_create(size_t ATTR_UNUSED(numtables),
+	size_t ATTR_UNUSED(maxmem))
+{
+	/* the public keys are not cached for this crypto library */
+	return NULL;
+}
+
+void
+secalgo_pkey_deldatafunc(void* data, void* ATTR_UNUSED(userarg))
+{
+	free(data);
+}
+
 /**
  * Check a canonical sig+rrset and signature against a dnskey
  * @param buf: buffer with data to verify, the first rrsig part and the
@@ -1101,6 +1280,7 @@ nss_setup_key_digest(int algo, SECKEYPublicKey** pubkey, HASH_HashType* htype,
  * @param sigblock_len: length of sigblock data.
  * @param key: public key data from DNSKEY RR.
  * @param keylen: length of keydata.
+ * @param pkeys: cache of parsed public keys, or NULL.
  * @param reason: bogus reason in more detail.
  * @return secure if verification succeeded, bogus on crypto failure,
  *	unchecked on format errors and alloc failures.
@@ -1108,7 +1288,7 @@ nss_setup_key_digest(int algo, SECKEYPublicKey** pubkey, HASH_HashType* htype,
 enum sec_status
 verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock, 
 	unsigned int sigblock_len, unsigned char* key, unsigned int keylen,
-	char** reason)
+	struct slabhash* ATTR_UNUSED(pkeys), char** reason)
 {
 	/* uses libNSS */
 	/* large enough for the different hashes */
@@ -1615,6 +1795,20 @@ _verify_nettle_ecdsa(sldns_buffer* buf, unsigned int digest_size, unsigned char*
 }
 #endif
 
+struct slabhash*
+secalgo_pkey_cache_create(size_t ATTR_UNUSED(numtables),
+	size_t ATTR_UNUSED(maxmem))
+{
+	/* the public keys are not cached for this crypto library */
+	return NULL;
+}
+
+void
+secalgo_pkey_deldatafunc(void* data, void* ATTR_UNUSED(userarg))
+{
+	free(data);
+}
+
 /**
  * Check a canonical sig+rrset and signature against a dnskey
  * @param buf: buffer with data to verify, the first rrsig part and the
@@ -1624,6 +1818,7 @@ _verify_nettle_ecdsa(sldns_buffer* buf, unsigned int digest_size, unsigned char*
  * @param sigblock_len: length of sigblock data.
  * @param key: public key data from DNSKEY RR.
  * @param keylen: length of keydata.
+ * @param pkeys: cache of parsed public keys, or NULL.
  * @param reason: bogus reason in more detail.
  * @return secure if verification succeeded, bogus on crypto failure,
  *	unchecked on format errors and alloc failures.
@@ -1631,7 +1826,7 @@ _verify_nettle_ecdsa(sldns_buffer* buf, unsigned int digest_size, unsigned char*
 enum sec_status
 verify_canonrrset(sldns_buffer* buf, int algo, unsigned char* sigblock,
 	unsigned int sigblock_len, unsigned char* key, unsigned int keylen,
-	char** reason)
+	struct slabhash* ATTR_UNUSED(pkeys), char** reason)
 {
 	unsigned int digest_size = 0;
 
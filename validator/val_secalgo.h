@@ -43,6 +43,7 @@
 #ifndef VALIDATOR_VAL_SECALGO_H
 #define VALIDATOR_VAL_SECALGO_H
 struct sldns_buffer;
+struct slabhash;
 
 /** Return size of nsec3 hash algorithm, 0 if not supported */
 size_t nsec3_hash_algo_size_supported(int id);
@@ -87,6 +88,29 @@ int secalgo_ds_digest(int algo, unsigned char* buf, size_t len,
 /** return true if DNSKEY algorithm id is supported */
 int dnskey_algo_id_is_supported(int id);
 
+/**
+ * Create the cache of parsed public keys. It holds the key objects of the
+ * crypto library, so that they are not created from the DNSKEY data for
+ * every signature. Delete it with slabhash_delete.
+ * @param numtables: number of slabs.
+ * @param maxmem: memory limit.
+ * @return the cache, or NULL on malloc failure, or if the crypto library
+ *	does not support it.
+ */
+struct slabhash* secalgo_pkey_cache_create(size_t numtables, size_t maxmem);
+
+/** calculate size of the public key cache entry */
+size_t secalgo_pkey_sizefunc(void* key, void* data);
+
+/** compare public key cache entries */
+int secalgo_pkey_compfunc(void* k1, void* k2);
+
+/** delete public key cache key */
+void secalgo_pkey_delkeyfunc(void* key, void* userarg);
+
+/** delete public key cache data, the key object */
+void secalgo_pkey_deldatafunc(void* data, void* userarg);
+
 /**
  * Check a canonical sig+rrset and signature against a dnskey
  * @param buf: buffer with data to verify, the first rrsig part and the
@@ -96,12 +120,14 @@ int dnskey_algo_id_is_supported(int id);
  * @param sigblock_len: length of sigblock data.
  * @param key: public key data from DNSKEY RR.
  * @param keylen: length of keydata.
+ * @param pkeys: cache of parsed public keys, or NULL.
  * @param reason: bogus reason in more detail.
  * @return secure if verification succeeded, bogus on crypto failure,
  *	unchecked on format errors and alloc failures.
  */
 enum sec_status verify_canonrrset(struct sldns_buffer* buf, int algo,
 	unsigned char* sigblock, unsigned int sigblock_len,
-	unsigned char* key, unsigned int keylen, char** reason);
+	unsigned char* key, unsigned int keylen, struct slabhash* pkeys,
+	char** reason);
 
 #endif /* VALIDATOR_VAL_SECALGO_H */
@@ -44,6 +44,7 @@
 #include "validator/val_sigcrypt.h"
 #include "validator/val_secalgo.h"
 #include "validator/validator.h"
+#include "validator/val_kcache.h"
 #include "util/data/msgreply.h"
 #include "util/data/msgparse.h"
 #include "util/data/dname.h"
@@ -1427,7 +1428,8 @@ dnskey_verify_rrset_sig(struct regional* region, sldns_buffer* buf,
 
 	/* verify */
 	sec = verify_canonrrset(buf, (int)sig[2+2],
-		sigblock, sigblock_len, key, keylen, reason);
+		sigblock, sigblock_len, key, keylen,
+		ve->kcache?ve->kcache->pkeys:NULL, reason);
 	
 	if(sec == sec_status_secure) {
 		/* check if TTL is too high - reduce if so */
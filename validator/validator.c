@@ -122,6 +122,10 @@ val_apply_cfg(struct module_env* env, struct val_env* val_env,
 	}
 	if(!val_env->kcache)
 		val_env->kcache = key_cache_create(cfg);
+	else if(!key_cache_adjust(val_env->kcache, cfg)) {
+		log_err("out of memory");
+		return 0;
+	}
 	if(!val_env->kcache) {
 		log_err("out of memory");
 		return 0;
@@ -153,6 +157,22 @@ val_apply_cfg(struct module_env* env, struct val_env* val_env,
 		return 0;
 	}
 	env->neg_cache = val_env->neg_cache;
+	if(val_env->nsec3_hcache && cfg->nsec3_hash_cache_size == 0) {
+		/* the cache is turned off */
+		slabhash_delete(val_env->nsec3_hcache);
+		val_env->nsec3_hcache = NULL;
+	} else if(!val_env->nsec3_hcache)
+		val_env->nsec3_hcache = nsec3_hcache_create(
+			cfg->key_cache_slabs, cfg->nsec3_hash_cache_size);
+	else if(!slabhash_adjust(val_env->nsec3_hcache, cfg->key_cache_slabs,
+		cfg->nsec3_hash_cache_size)) {
+		log_err("out of memory");
+		return 0;
+	}
+	if(!val_env->nsec3_hcache && cfg->nsec3_hash_cache_size != 0) {
+		log_err("out of memory");
+		return 0;
+	}
 	return 1;
 }
 
@@ -197,6 +217,7 @@ val_deinit(struct module_env* env, int id)
 	env->anchors = NULL;
 	key_cache_delete(val_env->kcache);
 	neg_cache_delete(val_env->neg_cache);
+	slabhash_delete(val_env->nsec3_hcache);
 	free(val_env->nsec3_keysize);
 	free(val_env->nsec3_maxiter);
 	free(val_env);
@@ -3044,6 +3065,7 @@ val_get_mem(struct module_env* env, int id)
 		return 0;
 	return sizeof(*ve) + key_cache_get_mem(ve->kcache) + 
 		val_neg_get_mem(ve->neg_cache) +
+		(ve->nsec3_hcache?slabhash_get_mem(ve->nsec3_hcache):0) +
 		sizeof(size_t)*2*ve->nsec3_keyiter_count;
 }
 
@@ -47,6 +47,7 @@
 #include "validator/val_utils.h"
 struct val_anchors;
 struct key_cache;
+struct slabhash;
 struct key_entry_key;
 struct val_neg_cache;
 struct config_strlist;
@@ -78,6 +79,9 @@ struct val_env {
 	/** aggressive negative cache. index into NSECs in rrset cache. */
 	struct val_neg_cache* neg_cache;
 
+	/** shared cache of NSEC3 hashes of names, NULL if disabled. */
+	struct slabhash* nsec3_hcache;
+
 	/** for debug testing a fixed validation date can be entered.
 	 * if 0, current time is used for rrsig validation */
 	int32_t date_override;